@@ -0,0 +1,69 @@
+#!/usr/bin/env python
+# encoding: utf-8
+"""
+Throughput benchmark for the allpass cascades (Hilbert, Phaser and Allpass2).
+
+For each test, NUM channels are processed in an offline server and DUR
+seconds of audio are rendered as fast as possible. The script prints the
+rendering time and the real-time factor (seconds of audio computed per
+second of CPU time, for all channels together).
+
+Phaser and Allpass2 are tested both with constant parameters and with
+audio-rate modulated frequencies, which exercises the coefficient updates.
+
+The multichannel tests compare one Phaser per channel with the MultiPhaser
+object, which processes CHNLS channels per instance with interleaved filter
+memories and shared coefficients.
+
+"""
+import os, time, tempfile
+from pyo import *
+
+NUM = 64
+CHNLS = 8
+DUR = 10
+SR = 44100
+BUFSIZE = 256
+
+def hilbert(src):
+    return Hilbert(src)
+
+def phaser_i(src):
+    return Phaser(src, freq=1000, spread=1.1, q=10, feedback=0.5, num=8)
+
+def phaser_a(src):
+    return Phaser(src, freq=Sine(.2, mul=500, add=1000), spread=1.1, q=10, feedback=0.5, num=8)
+
+def allpass2_i(src):
+    return Allpass2(src, freq=1000, bw=500)
+
+def allpass2_a(src):
+    return Allpass2(src, freq=Sine(.2, mul=500, add=1000), bw=500)
+
+def multiphaser_i(src):
+    return MultiPhaser(src, freq=1000, spread=1.1, q=10, feedback=0.5, num=8)
+
+def multiphaser_a(src):
+    return MultiPhaser(src, freq=Sine(.2, mul=500, add=1000), spread=1.1, q=10, feedback=0.5, num=8)
+
+# (name, function, number of channels per instance)
+TESTS = [("Hilbert", hilbert, 1), ("Phaser (i-rate freq)", phaser_i, 1), ("Phaser (a-rate freq)", phaser_a, 1),
+         ("Allpass2 (i-rate freq)", allpass2_i, 1), ("Allpass2 (a-rate freq)", allpass2_a, 1),
+         ("Phaser (i-rate freq)", phaser_i, CHNLS), ("MultiPhaser (i-rate freq)", multiphaser_i, CHNLS),
+         ("Phaser (a-rate freq)", phaser_a, CHNLS), ("MultiPhaser (a-rate freq)", multiphaser_a, CHNLS)]
+
+s = Server(sr=SR, nchnls=1, buffersize=BUFSIZE, duplex=0, audio="offline").boot()
+outfile = os.path.join(tempfile.gettempdir(), "pyo_allpass_benchmark.wav")
+
+for name, func, chnls in TESTS:
+    src = Noise(mul=[.1] * chnls)
+    objs = [func(src) for i in range(NUM // chnls)]
+    s.recordOptions(dur=DUR, filename=outfile)
+    t = time.time()
+    s.start()
+    elapsed = time.time() - t
+    print "%-26s %d x %d chnls: %.3f sec (x%.1f real-time)" % (name, NUM // chnls, chnls, elapsed, DUR * NUM / elapsed)
+    del objs, src
+
+if os.path.isfile(outfile):
+    os.remove(outfile)
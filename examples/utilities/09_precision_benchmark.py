@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+# encoding: utf-8
+"""
+Throughput and accuracy of the three precision builds of pyo.
+
+- pyo   : single precision signals and states.
+- pyomx : single precision signals, double precision filter states and
+          phase accumulators (setup.py --use-mixed).
+- pyo64 : double precision signals and states (setup.py --use-double).
+
+Each available build is run in its own process. The throughput test renders
+DUR seconds of NUM instances of a few filters and oscillators as fast as
+possible. The accuracy tests compare against the double precision build:
+
+- a 20 Hz Biquad lowpass, where single precision coefficients and states
+  are the most fragile.
+- a 1000.1 Hz Sine after a long run, where a single precision phase
+  accumulator drifts.
+
+Errors are given in dB relative to the reference signal.
+
+"""
+import os, sys, time, math, tempfile, subprocess
+
+NUM = 32
+DUR = 10
+SR = 44100
+BUFSIZE = 256
+BUILDS = ["pyo", "pyomx", "pyo64"]
+
+CHILD = r"""
+import time, math
+from %(build)s import *
+s = Server(sr=%(sr)d, nchnls=1, buffersize=%(bufsize)d, duplex=0, audio="offline").boot()
+outfile = %(outfile)r
+
+def render(dur):
+    s.recordOptions(dur=dur, filename=outfile)
+    t = time.time()
+    s.start()
+    return time.time() - t
+
+results = {}
+tests = [("Biquad", lambda src: Biquad(src, freq=1000, q=2)),
+         ("SVF", lambda src: SVF(src, freq=1000, q=2, type=0.5)),
+         ("ButLP", lambda src: ButLP(src, freq=1000)),
+         ("Sine", lambda src: Sine(freq=440, mul=src)),
+         ("FM", lambda src: FM(carrier=250, ratio=.5, index=4, mul=src))]
+for name, func in tests:
+    src = Noise(.1)
+    objs = [func(src) for i in range(%(num)d)]
+    results[name] = render(%(dur)d)
+    del objs, src
+
+# Accuracy: signals captured at the end of a long run.
+lp = Biquad(Sine(3, mul=.5), freq=20, q=0.707, type=0)
+osc = Sine(freq=1000.1)
+length = 4096
+tlp = NewTable(length / float(%(sr)d))
+tosc = NewTable(length / float(%(sr)d))
+render(%(longdur)d - length / float(%(sr)d))
+rlp = TableRec(lp, tlp).play()
+rosc = TableRec(osc, tosc).play()
+render(length / float(%(sr)d) + 0.1)
+results["lp"] = tlp.getTable()
+results["osc"] = tosc.getTable()
+print repr(results)
+"""
+
+def run(build, outfile):
+    code = CHILD % dict(build=build, sr=SR, bufsize=BUFSIZE, outfile=outfile, num=NUM, dur=DUR, longdur=60)
+    proc = subprocess.Popen([sys.executable, "-c", code], stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    out, err = proc.communicate()
+    try:
+        return eval(out.strip().splitlines()[-1])
+    except:
+        return None
+
+def error_db(x, ref):
+    num = sum((a - b) ** 2 for a, b in zip(x, ref))
+    den = sum(b ** 2 for b in ref)
+    if num == 0:
+        return -999.0
+    return 10 * math.log10(num / den)
+
+outfile = os.path.join(tempfile.gettempdir(), "pyo_precision_benchmark.wav")
+results = {}
+for build in BUILDS:
+    res = run(build, outfile)
+    if res is None:
+        print "%s: not available" % build
+    else:
+        results[build] = res
+
+names = ["Biquad", "SVF", "ButLP", "Sine", "FM"]
+print "\nThroughput (%d instances, %d sec, x real-time):" % (NUM, DUR)
+print "%-8s" % "" + "".join(["%10s" % n for n in names])
+for build in BUILDS:
+    if build in results:
+        print "%-8s" % build + "".join(["%10.1f" % (DUR * NUM / results[build][n]) for n in names])
+
+if "pyo64" in results:
+    ref = results["pyo64"]
+    print "\nError against pyo64 after 60 seconds (dB):"
+    for build in BUILDS:
+        if build in results and build != "pyo64":
+            print "%-8s lowpass 20 Hz: %8.1f   sine 1000.1 Hz: %8.1f" % (build, error_db(results[build]["lp"], ref["lp"]),
+                                                                       error_db(results[build]["osc"], ref["osc"]))
+
+if os.path.isfile(outfile):
+    os.remove(outfile)
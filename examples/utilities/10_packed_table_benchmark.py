@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+# encoding: utf-8
+"""
+Memory versus CPU cost of the packed storage formats of SndTable.
+
+A sound of SNDDUR seconds is loaded in a SndTable with each storage format
+(full precision floats, "int16", "int24" and "float16"). The script prints
+the memory used by the samples, then renders DUR seconds of NUM instances
+of each table reader as fast as possible and prints the rendering time and
+the real-time factor (seconds of audio computed per second of CPU time, for
+all instances together).
+
+Packed samples are decoded inside the readers, one block at a time, so the
+memory saving costs some CPU time on every read.
+
+"""
+import os, time, tempfile, __builtin__
+from pyo import *
+
+NUM = 16
+DUR = 10
+SNDDUR = 60
+SR = 44100
+BUFSIZE = 256
+PACKINGS = [None, "int16", "int24", "float16"]
+BYTES = {None: 8 if hasattr(__builtin__, "pyo_use_double") else 4, "int16": 2, "int24": 3, "float16": 2}
+
+def osc(t):
+    return Osc(t, freq=[t.getRate() * (1 + i * 0.01) for i in range(NUM)], interp=4)
+
+def tableread(t):
+    return TableRead(t, freq=[t.getRate() * (1 + i * 0.01) for i in range(NUM)], loop=1, interp=2).play()
+
+def looper(t):
+    return Looper(t, pitch=[1 + i * 0.01 for i in range(NUM)], start=1, dur=5, xfade=20, interp=4)
+
+def granulator(t):
+    return Granulator(t, HannTable(), pitch=[1 + i * 0.01 for i in range(NUM)],
+                      pos=Phasor(0.05, mul=t.getSize()), dur=0.1, grains=8)
+
+TESTS = [("Osc (cubic)", osc), ("TableRead (linear)", tableread), ("Looper (cubic)", looper), ("Granulator (8 grains)", granulator)]
+
+s = Server(sr=SR, nchnls=1, buffersize=BUFSIZE, duplex=0, audio="offline").boot()
+sndfile = os.path.join(tempfile.gettempdir(), "pyo_packed_table_source.wav")
+outfile = os.path.join(tempfile.gettempdir(), "pyo_packed_table_benchmark.wav")
+
+# Source material.
+src = Noise(0.5).out()
+s.recordOptions(dur=SNDDUR, filename=sndfile)
+s.start()
+del src
+
+tables = {}
+for packing in PACKINGS:
+    tables[packing] = SndTable(sndfile, packing=packing)
+    size = tables[packing].getSize()
+    print "%-8s sample storage: %.2f MB" % (packing or "float", size * BYTES[packing] / 1048576.0)
+print
+
+for name, func in TESTS:
+    for packing in PACKINGS:
+        objs = func(tables[packing])
+        s.recordOptions(dur=DUR, filename=outfile)
+        t = time.time()
+        s.start()
+        elapsed = time.time() - t
+        print "%-22s %-8s %d instances: %.3f sec (x%.1f real-time)" % (name, packing or "float", NUM, elapsed, DUR * NUM / elapsed)
+        del objs
+
+for f in [sndfile, outfile]:
+    if os.path.isfile(f):
+        os.remove(f)
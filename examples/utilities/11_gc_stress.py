@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+# encoding: utf-8
+"""
+Garbage collector stress test for Server.setGCIsolation().
+
+NUM objects are created, then DUR seconds of audio are rendered in a
+background thread (offline_nb server) while the main thread runs full
+collections (gc.collect()) in a loop. Each collection holds the interpreter
+lock, which the rendering thread needs to compute every buffer.
+
+The test is run with the objects tracked by the collector, then isolated
+from it. For each run, the script prints the number of objects tracked by
+the collector, the mean and maximum duration of a collection (the time the
+audio thread may have to wait) and the rendering time.
+
+Finally, objects are created and deleted while isolated, to check that
+they are still released.
+
+"""
+import os, gc, time, tempfile
+from pyo import *
+
+NUM = 2000
+DUR = 10
+SR = 44100
+BUFSIZE = 256
+
+s = Server(sr=SR, nchnls=1, buffersize=BUFSIZE, duplex=0, audio="offline_nb").boot()
+outfile = os.path.join(tempfile.gettempdir(), "pyo_gc_stress.wav")
+
+# A few chains of objects, NUM of them in total.
+objs = []
+for i in range(NUM // 4):
+    lfo = Sine(.1 + i * 0.01, mul=100, add=500)
+    osc = SineLoop(lfo, feedback=0.05)
+    filt = Biquad(osc, freq=lfo * 2)
+    objs.append(Pan(filt, outs=1, mul=0.0001).out())
+
+def run(isolate):
+    s.setGCIsolation(isolate)
+    gc.collect()
+    durations = []
+    s.recordOptions(dur=DUR, filename=outfile)
+    start = time.time()
+    s.start()
+    while s.getIsStarted():
+        t = time.time()
+        gc.collect()
+        durations.append(time.time() - t)
+    elapsed = time.time() - start
+    print "%-10s tracked objects: %6d, gc.collect mean: %6.3f ms, max: %6.3f ms, rendering: %.3f sec" % \
+          ("isolated" if isolate else "tracked", len(gc.get_objects()), 1000 * sum(durations) / len(durations),
+           1000 * max(durations), elapsed)
+
+run(False)
+run(True)
+
+numstreams = len(s.getStreams())
+for i in range(100):
+    tmp = [Sine(freq=100 + j) for j in range(50)]
+    del tmp
+print "streams before: %d, after creating and deleting 5000 isolated objects: %d" % (numstreams, len(s.getStreams()))
+
+s.setGCIsolation(False)
+if os.path.isfile(outfile):
+    os.remove(outfile)
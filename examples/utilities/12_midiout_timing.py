@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+# encoding: utf-8
+"""
+Checks the ordering and the timing of the midi output scheduler.
+
+The same midi port must be opened for output and for input, with a
+loopback between the two ("Midi Through" on Linux, an IAC bus on MacOS,
+loopMIDI on Windows). Launch this script from a terminal.
+
+A Noteout object plays notes on a steady pulse. Its velocity envelope moves
+while the notes are sounding, which must not retrigger them. In parallel,
+notes are sent from python with Server.noteout(), using the timestamp
+argument to schedule them in the future.
+
+The received messages are stamped with time.time() when they arrive in the
+RawMidi callback, so the measured jitter includes up to one buffer of input
+latency (BUFSIZE / SR seconds).
+
+"""
+from pyo import *
+import time
+
+SR = 44100
+BUFSIZE = 64
+PERIOD = .1 # seconds between Noteout notes
+DUR = 5
+
+pm_list_devices()
+num = input("Enter the number of the loopback midi port : ")
+
+s = Server(sr=SR, buffersize=BUFSIZE, duplex=0)
+s.setMidiInputDevice(num)
+s.setMidiOutputDevice(num)
+s.boot()
+
+received = []
+def event(status, data1, data2):
+    received.append((time.time(), status, data1, data2))
+
+raw = RawMidi(event)
+
+# Noteout on channel 1: one note per pulse, the velocity decays during the note.
+met = Metro(PERIOD).play()
+pit = TrigChoice(met, [60, 62, 64, 67, 69])
+vel = TrigEnv(met, LinTable([(0,1),(4000,.5),(4001,0),(8192,0)]), dur=PERIOD)
+notes = Noteout(pit, vel, channel=1)
+
+s.start()
+
+# Server.noteout() on channel 2: the whole sequence is sent at once, with
+# increasing timestamps, and must come out in order and on time.
+for i in range(20):
+    s.noteout(72 + i % 12, 100, channel=2, timestamp=1000 + i * 150)
+    s.noteout(72 + i % 12, 0, channel=2, timestamp=1000 + i * 150 + 100)
+
+time.sleep(DUR)
+notes.stop()
+time.sleep(.5)
+s.stop()
+
+def check(chnl, period, label):
+    ons, sounding, errors = [], None, 0
+    for t, status, d1, d2 in received:
+        if (status & 0x0F) != chnl - 1 or (status & 0xE0) != 0x80:
+            continue
+        if (status & 0xF0) == 0x90 and d2 > 0:
+            if sounding is not None:
+                errors += 1 # note on received before the note off of the previous note
+            sounding = d1
+            ons.append(t)
+        elif d1 == sounding:
+            sounding = None
+    if sounding is not None:
+        errors += 1 # hanging note
+    deltas = [(b - a) * 1000. for a, b in zip(ons, ons[1:])]
+    print "%s: %d notes, %d ordering errors" % (label, len(ons), errors)
+    if deltas:
+        mean = sum(deltas) / len(deltas)
+        print "    interval: mean %.2f ms (expected %.2f ms), min %.2f ms, max %.2f ms" % \
+              (mean, period * 1000, min(deltas), max(deltas))
+
+check(1, PERIOD, "Noteout")
+check(2, .15, "Server.noteout")
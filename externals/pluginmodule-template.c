@@ -0,0 +1,167 @@
+/*************************************************************************
+ * Copyright 2010 Olivier Belanger                                        *
+ *                                                                        *
+ * This file is part of pyo, a python module to help digital signal       *
+ * processing script creation.                                            *
+ *                                                                        *
+ * pyo is free software: you can redistribute it and/or modify            *
+ * it under the terms of the GNU General Public License as published by   *
+ * the Free Software Foundation, either version 3 of the License, or      *
+ * (at your option) any later version.                                    *
+ *                                                                        *
+ * pyo is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU General Public License for more details.                           *
+ *                                                                        *
+ * You should have received a copy of the GNU General Public License      *
+ * along with pyo.  If not, see <http://www.gnu.org/licenses/>.           *
+ *************************************************************************/
+
+/*****************************************************
+Template for a runtime-loadable plugin: a saturated
+two-pole lowpass filter called "SoftLP".
+
+Unlike externalmodule-template.c, a plugin doesn't need
+pyo to be recompiled. It only includes "pyoplugin.h"
+and is compiled on its own as a shared library:
+
+    gcc -shared -fPIC -O2 -I include \
+        externals/pluginmodule-template.c -o libsoftlp.so -lm
+
+(on OSX, use -dynamiclib instead of -shared) then loaded
+from python:
+
+    SoftLP = loadPlugin("libsoftlp.so")
+    a = SoftLP(Noise(.3), freq=1000, q=4, drive=2).out()
+*****************************************************/
+
+#include <math.h>
+#include "pyoplugin.h"
+
+/*****************************************************
+State of one instance. pyo allocates state_size bytes,
+zeroed, for each stream of the object. Nothing else
+than this block should be used to keep data between
+two calls of the kernel.
+*****************************************************/
+typedef struct {
+    double sr;
+    double z1;
+    double z2;
+    /* Coefficients, recomputed when freq or q change. */
+    double last_freq;
+    double last_q;
+    double b0;
+    double a1;
+    double a2;
+} SoftLP;
+
+/*****************************************************
+Parameter schema. Each parameter becomes an attribute
+of the python object and accepts a float or an audio
+signal. The kernel always receives a vector of
+samples per parameter.
+*****************************************************/
+static const PyoPluginParam SoftLP_params[] = {
+    {"freq", "Cutoff frequency in Hz.", 1000.0, 20.0, 15000.0},
+    {"q", "Resonance of the filter.", 1.0, 0.5, 20.0},
+    {"drive", "Gain applied before the saturation.", 1.0, 1.0, 20.0},
+};
+
+/* Called once the state is allocated. */
+static void
+SoftLP_init(void *state, double sr, int bufsize)
+{
+    SoftLP *self = (SoftLP *)state;
+    self->sr = sr;
+    self->last_freq = self->last_q = -1.0;
+}
+
+/* Called by the reset() method of the python object. */
+static void
+SoftLP_reset(void *state)
+{
+    SoftLP *self = (SoftLP *)state;
+    self->z1 = self->z2 = 0.0;
+}
+
+static void
+SoftLP_coeffs(SoftLP *self, double freq, double q)
+{
+    double w0, alpha, a0;
+    if (freq < 1.0)
+        freq = 1.0;
+    else if (freq > self->sr * 0.49)
+        freq = self->sr * 0.49;
+    if (q < 0.1)
+        q = 0.1;
+    w0 = 2.0 * M_PI * freq / self->sr;
+    alpha = sin(w0) / (2.0 * q);
+    a0 = 1.0 + alpha;
+    self->b0 = (1.0 - cos(w0)) * 0.5 / a0;
+    self->a1 = -2.0 * cos(w0) / a0;
+    self->a2 = (1.0 - alpha) / a0;
+    self->last_freq = freq;
+    self->last_q = q;
+}
+
+/*****************************************************
+Processing kernel. It runs in the audio thread: no
+allocation, no lock, no i/o. inputs[0] is the audio
+input, params[] follow the order of the schema. pyo
+applies mul and add on the output.
+
+The same code serves the single and double precision
+builds of pyo, the macro defines one kernel per type.
+*****************************************************/
+#define SOFTLP_KERNEL(name, T) \
+static void \
+name(void *state, const T **inputs, const T **params, T *output, int n) \
+{ \
+    int i; \
+    double x, y; \
+    SoftLP *self = (SoftLP *)state; \
+    const T *in = inputs[0], *freq = params[0], *q = params[1], *drive = params[2]; \
+    for (i=0; i<n; i++) { \
+        if (freq[i] != self->last_freq || q[i] != self->last_q) \
+            SoftLP_coeffs(self, freq[i], q[i]); \
+        x = tanh(in[i] * drive[i]); \
+        /* Biquad lowpass, transposed direct form II (b1 = 2*b0, b2 = b0). */ \
+        y = self->b0 * x + self->z1; \
+        self->z1 = 2.0 * self->b0 * x - self->a1 * y + self->z2; \
+        self->z2 = self->b0 * x - self->a2 * y; \
+        output[i] = (T)y; \
+    } \
+}
+
+SOFTLP_KERNEL(SoftLP_process_float, float)
+SOFTLP_KERNEL(SoftLP_process_double, double)
+
+/*****************************************************
+Descriptor returned to pyo. The class created by
+loadPlugin is named after the "name" field.
+*****************************************************/
+static const PyoPluginDescriptor SoftLP_descriptor = {
+    PYO_PLUGIN_ABI_VERSION,
+    "SoftLP",
+    "Saturated two-pole lowpass filter (plugin template).",
+    1, /* audio inputs */
+    sizeof(SoftLP_params) / sizeof(PyoPluginParam),
+    SoftLP_params,
+    sizeof(SoftLP),
+    SoftLP_init,
+    NULL, /* release, nothing allocated by the plugin */
+    SoftLP_reset,
+    SoftLP_process_float,
+    SoftLP_process_double,
+};
+
+/* Entry point, the only exported symbol. */
+PYO_PLUGIN_EXPORT const PyoPluginDescriptor *
+pyo_plugin_descriptor(unsigned int abi_version)
+{
+    if (abi_version != PYO_PLUGIN_ABI_VERSION)
+        return NULL;
+    return &SoftLP_descriptor;
+}
@@ -42,6 +42,26 @@ extern void PVStream_setFreq(PVStream * self, MYFLT **data);
 extern void PVStream_setCount(PVStream * self, int *data);
 extern PyTypeObject PVStreamType;
 
+/* Phase vocoder analysis file, written by pvanalysis() and played by PVRead.
+** A PV_FILE_HEADER_SIZE bytes header, then numframes frames of hsize
+** magnitudes followed by hsize frequencies, as 32-bit floats in native byte
+** order. Frames are one hopsize (fftsize / olaps) apart. */
+#define PV_FILE_MAGIC "PYPV"
+#define PV_FILE_VERSION 1
+#define PV_FILE_HEADER_SIZE 64
+
+typedef struct {
+    char magic[4];
+    int version;
+    int fftsize;
+    int olaps;
+    int hsize;
+    int numframes;
+    int wintype;
+    int reserved;
+    double sr; /* Sampling rate of the analyzed sound. */
+} PVFileHeader;
+
 #define MAKE_NEW_PV_STREAM(self, type, rt_error) \
     (self) = (PVStream *)(type)->tp_alloc((type), 0); \
     if ((self) == rt_error) { return rt_error; } \
@@ -27,7 +27,11 @@
 #define __MYFLT_DEF
 
 #ifndef USE_DOUBLE
+#ifdef USE_MIXED
+#define LIB_BASE_NAME "_pyomx"
+#else
 #define LIB_BASE_NAME "_pyo"
+#endif
 #define MYFLT float
 #define FLOAT_VALUE f
 #define TYPE_F "f"
@@ -78,6 +82,7 @@
 #define TYPE_O_OOOOFF "O|OOOOff"
 #define TYPE_O_IFFO "O|iffO"
 #define TYPE_O_OOIF "O|OOif"
+#define TYPE_O_OOF "O|OOf"
 #define TYPE_O_FFFFIOO "O|ffffiOO"
 #define TYPE_OO_FOO "OO|fOO"
 #define TYPE_OO_FFOO "OO|ffOO"
@@ -87,6 +92,8 @@
 #define TYPE_O_OOFFOO "O|OOffOO"
 #define TYPE_O_OOOFOO "O|OOOfOO"
 #define TYPE_OO_OOOIFOO "OO|OOOifOO"
+#define TYPE_OI_FFI "Oi|ffi"
+#define TYPE_O_FII "O|fii"
 
 #define SF_WRITE sf_write_float
 #define SF_READ sf_read_float
@@ -162,6 +169,7 @@
 #define TYPE_O_OOOOFF "O|OOOOdd"
 #define TYPE_O_IFFO "O|iddO"
 #define TYPE_O_OOIF "O|OOid"
+#define TYPE_O_OOF "O|OOd"
 #define TYPE_O_FFFFIOO "O|ddddiOO"
 #define TYPE_OO_FOO "OO|dOO"
 #define TYPE_OO_FFOO "OO|ddOO"
@@ -171,6 +179,8 @@
 #define TYPE_O_OOFFOO "O|OOddOO"
 #define TYPE_O_OOOFOO "O|OOOdOO"
 #define TYPE_OO_OOOIFOO "OO|OOOidOO"
+#define TYPE_OI_FFI "Oi|ddi"
+#define TYPE_O_FII "O|dii"
 
 #define SF_WRITE sf_write_double
 #define SF_READ sf_read_double
@@ -195,6 +205,28 @@
 #define MYTANH tanh
 
 #endif
+
+/* Type of the recursive filter memories and phase accumulators. Signal
+** buffers and tables use MYFLT, but the mixed precision build (USE_MIXED)
+** keeps these internal states in double while MYFLT stays float. */
+#if defined(USE_DOUBLE) || defined(USE_MIXED)
+#define MYSTATE double
+#define STSQRT sqrt
+#define STCOS cos
+#define STSIN sin
+#define STTAN tan
+#define STPOW pow
+#define STEXP exp
+#else
+#define MYSTATE float
+#define STSQRT sqrtf
+#define STCOS cosf
+#define STSIN sinf
+#define STTAN tanf
+#define STPOW powf
+#define STEXP expf
+#endif
+
 #endif
 
 #ifdef COMPILE_EXTERNALS
@@ -258,6 +290,7 @@ extern PyTypeObject FaderType;
 extern PyTypeObject AdsrType;
 extern PyTypeObject LinsegType;
 extern PyTypeObject ExpsegType;
+extern PyTypeObject AutomationType;
 extern PyTypeObject RandiType;
 extern PyTypeObject RandhType;
 extern PyTypeObject RandDurType;
@@ -278,6 +311,8 @@ extern PyTypeObject PortType;
 extern PyTypeObject AllpassType;
 extern PyTypeObject Allpass2Type;
 extern PyTypeObject PhaserType;
+extern PyTypeObject MultiPhaserMainType;
+extern PyTypeObject MultiPhaserType;
 extern PyTypeObject VocoderType;
 extern PyTypeObject DenormType;
 extern PyTypeObject DistoType;
@@ -296,6 +331,8 @@ extern PyTypeObject AllpassWGType;
 extern PyTypeObject FreeverbType;
 extern PyTypeObject WGVerbType;
 extern PyTypeObject ChorusType;
+extern PyTypeObject MultiChorusMainType;
+extern PyTypeObject MultiChorusType;
 extern PyTypeObject ConvolveType;
 extern PyTypeObject IRWinSincType;
 extern PyTypeObject IRPulseType;
@@ -304,6 +341,8 @@ extern PyTypeObject IRFMType;
 extern PyTypeObject GranulatorType;
 extern PyTypeObject LooperType;
 extern PyTypeObject HarmonizerType;
+extern PyTypeObject MultiHarmonizerMainType;
+extern PyTypeObject MultiHarmonizerType;
 extern PyTypeObject MidictlType;
 extern PyTypeObject CtlScanType;
 extern PyTypeObject CtlScan2Type;
@@ -439,6 +478,8 @@ extern PyTypeObject YinType;
 extern PyTypeObject SVFType;
 extern PyTypeObject AverageType;
 extern PyTypeObject CvlVerbType;
+extern PyTypeObject CvlMatrixMainType;
+extern PyTypeObject CvlMatrixType;
 extern PyTypeObject SpectrumType;
 extern PyTypeObject ResonType;
 extern PyTypeObject ResonxType;
@@ -464,10 +505,12 @@ extern PyTypeObject PVFreqModType;
 extern PyTypeObject PVBufLoopsType;
 extern PyTypeObject PVBufTabLoopsType;
 extern PyTypeObject PVMixType;
+extern PyTypeObject PVReadType;
 extern PyTypeObject GranuleType;
 extern PyTypeObject TableScaleType;
 extern PyTypeObject TrackHoldType;
 extern PyTypeObject ComplexResType;
+extern PyTypeObject ModalBankType;
 extern PyTypeObject STReverbType;
 extern PyTypeObject STRevType;
 extern PyTypeObject Pointer2Type;
@@ -486,6 +529,17 @@ extern PyTypeObject MainParticleType;
 extern PyTypeObject ParticleType;
 extern PyTypeObject AtanTableType;
 extern PyTypeObject RawMidiType;
+extern PyTypeObject NoteoutType;
+extern PyTypeObject CtloutType;
+extern PyTypeObject BendoutType;
+extern PyTypeObject DomainType;
+extern PyTypeObject DomainInType;
+extern PyTypeObject DomainOutType;
+extern PyTypeObject BusInType;
+extern PyTypeObject PluginLibType;
+extern PyTypeObject PluginType;
+extern PyTypeObject StepSeqerType;
+extern PyTypeObject StepSeqType;
 
 /* Constants */
 #define E M_E
@@ -525,6 +579,7 @@ extern PyTypeObject RawMidiType;
 #define URN_ID 26
 #define GRANULE_ID 27
 #define MAINPARTICLE_ID 28
+#define STEPSEQ_ID 29
 /* Do not forget to modify Server_generateSeed function */
 
 /* object headers */
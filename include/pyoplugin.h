@@ -0,0 +1,108 @@
+/**************************************************************************
+ * Copyright 2009-2015 Olivier Belanger                                   *
+ *                                                                        *
+ * This file is part of pyo, a python module to help digital signal       *
+ * processing script creation.                                            *
+ *                                                                        *
+ * pyo is free software: you can redistribute it and/or modify            *
+ * it under the terms of the GNU Lesser General Public License as         *
+ * published by the Free Software Foundation, either version 3 of the     *
+ * License, or (at your option) any later version.                        *
+ *                                                                        *
+ * pyo is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU Lesser General Public License for more details.                    *
+ *                                                                        *
+ * You should have received a copy of the GNU Lesser General Public       *
+ * License along with pyo.  If not, see <http://www.gnu.org/licenses/>.   *
+ *************************************************************************/
+
+/* Binary interface of the runtime-loadable DSP plugins (see loadPlugin).
+**
+** A plugin is a shared library that only depends on this header, not on
+** Python nor on the pyo headers. It exports one function, named
+** PYO_PLUGIN_ENTRY, that returns a pointer to a static descriptor:
+**
+**     const PyoPluginDescriptor * pyo_plugin_descriptor(unsigned int abi_version);
+**
+** The host passes the ABI version it was compiled with. The plugin returns
+** NULL if it can't provide a compatible descriptor. The host rejects
+** descriptors whose abi_version differs from its own. The layout of the
+** structures below never changes for a given PYO_PLUGIN_ABI_VERSION.
+**
+** Each instance owns a zeroed block of state_size bytes, allocated by pyo,
+** given to every call. An instance computes one mono stream. Multichannel
+** expansion (lists given as arguments) creates one instance per stream, as
+** for the built-in objects. mul and add are applied by pyo.
+**
+** See externals/pluginmodule-template.c. */
+
+#ifndef Py_PYOPLUGIN_H
+#define Py_PYOPLUGIN_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PYO_PLUGIN_ABI_VERSION 1
+
+#define PYO_PLUGIN_ENTRY "pyo_plugin_descriptor"
+
+#define PYO_PLUGIN_MAX_INPUTS 8
+#define PYO_PLUGIN_MAX_PARAMS 16
+
+#if defined(_WIN32)
+#define PYO_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define PYO_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+/* Parameter schema. Values are given, one per sample, as floats or as
+** audio signals. min and max are hints for the user interfaces, pyo
+** doesn't clip the values. */
+typedef struct {
+    const char *name; /* A valid python identifier. */
+    const char *doc;
+    double init; /* Default value. */
+    double min;
+    double max;
+} PyoPluginParam;
+
+/* inputs: num_inputs signals, params: num_params signals, output: the
+** stream buffer. All buffers hold n samples. The kernels must not allocate,
+** lock or call any blocking function, they run in the audio thread. */
+typedef void (*PyoPluginProcessFloat)(void *state, const float **inputs, const float **params, float *output, int n);
+typedef void (*PyoPluginProcessDouble)(void *state, const double **inputs, const double **params, double *output, int n);
+
+typedef struct {
+    unsigned int abi_version; /* PYO_PLUGIN_ABI_VERSION */
+    const char *name; /* Class name, a valid python identifier. */
+    const char *doc;
+    int num_inputs; /* 0 for a generator, up to PYO_PLUGIN_MAX_INPUTS. */
+    int num_params; /* Up to PYO_PLUGIN_MAX_PARAMS. */
+    const PyoPluginParam *params;
+    size_t state_size;
+    /* Called once the state is allocated and zeroed (may be NULL). */
+    void (*init)(void *state, double sr, int bufsize);
+    /* Called before the state is freed, for the state's own resources
+    ** (may be NULL). Not called from the audio thread. */
+    void (*release)(void *state);
+    /* Called by the object's reset() method (may be NULL). */
+    void (*reset)(void *state);
+    /* Kernels for the single and double precision builds of pyo. A plugin
+    ** can provide only one of them, it then loads only in the matching
+    ** builds. */
+    PyoPluginProcessFloat process_float;
+    PyoPluginProcessDouble process_double;
+} PyoPluginDescriptor;
+
+typedef const PyoPluginDescriptor * (*PyoPluginEntry)(unsigned int abi_version);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* Py_PYOPLUGIN_H */
@@ -0,0 +1,64 @@
+/**************************************************************************
+ * Copyright 2009-2015 Olivier Belanger                                   *
+ *                                                                        *
+ * This file is part of pyo, a python module to help digital signal       *
+ * processing script creation.                                            *
+ *                                                                        *
+ * pyo is free software: you can redistribute it and/or modify            *
+ * it under the terms of the GNU Lesser General Public License as         *
+ * published by the Free Software Foundation, either version 3 of the     *
+ * License, or (at your option) any later version.                        *
+ *                                                                        *
+ * pyo is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU Lesser General Public License for more details.                    *
+ *                                                                        *
+ * You should have received a copy of the GNU Lesser General Public       *
+ * License along with pyo.  If not, see <http://www.gnu.org/licenses/>.   *
+ *************************************************************************/
+
+/* Interface between the server and the real-time violations detector
+** (src/rtcheck/pyortcheck.c), a library preloaded with LD_PRELOAD that
+** interposes the allocator and the blocking calls of the C library. The
+** server looks the functions up at run time, so _pyo doesn't link with it. */
+
+#ifndef Py_PYORTCHECK_H
+#define Py_PYORTCHECK_H
+
+/* Kinds of violations counted. */
+#define PYO_RT_MALLOC 0 /* malloc, calloc, realloc, memalign */
+#define PYO_RT_FREE 1
+#define PYO_RT_FILE 2 /* open, read, write, fopen, fwrite, ... */
+#define PYO_RT_PRINT 3 /* printf family, puts */
+#define PYO_RT_SOCKET 4 /* send, sendto, recv, ... */
+#define PYO_RT_LOCK 5 /* mutex locks and semaphore waits (condition waits are not wrapped) */
+#define PYO_RT_SLEEP 6 /* sleep, usleep, nanosleep, poll, select */
+#define PYO_RT_KINDS 7
+
+#define PYO_RT_MAX_ENTRIES 1024
+
+/* Counts for one context, a stream (class name and stream id) or the server. */
+typedef struct {
+    const char *name;
+    int id;
+    unsigned long counts[PYO_RT_KINDS];
+} PyoRTCheckEntry;
+
+/* Names of the functions exported by the library. */
+#define PYO_RT_SET_CONTEXT "pyo_rtcheck_set_context"
+#define PYO_RT_GET_REPORT "pyo_rtcheck_get_report"
+#define PYO_RT_RESET "pyo_rtcheck_reset"
+
+/* void pyo_rtcheck_set_context(const char *name, int id);
+**     Attributes the next hits of the calling thread to (name, id). The name
+**     must outlive the report (a type name). NULL stops the counting.
+** int pyo_rtcheck_get_report(PyoRTCheckEntry *entries, int max);
+**     Copies up to max entries, returns how many were copied.
+** void pyo_rtcheck_reset(void);
+**     Clears the counts. */
+typedef void (*pyo_rtcheck_set_context_t)(const char *, int);
+typedef int (*pyo_rtcheck_get_report_t)(PyoRTCheckEntry *, int);
+typedef void (*pyo_rtcheck_reset_t)(void);
+
+#endif /* Py_PYORTCHECK_H */
@@ -28,10 +28,12 @@
 extern "C" {
 #endif
 
+#include <pthread.h>
 #include "portaudio.h"
 #include "portmidi.h"
 #include "sndfile.h"
 #include "pyomodule.h"
+#include "taskpool.h"
 
 #ifdef USE_JACK
 #include <jack/jack.h>
@@ -41,6 +43,32 @@ extern "C" {
 # include <CoreAudio/AudioHardware.h>
 #endif
 
+#define MAX_DOMAINS 64
+#define MAX_BUSES 256
+
+/* Block timeline tracing, event categories */
+#define TRACE_CALLBACK 0 /* Server_process_buffers */
+#define TRACE_STREAM 1 /* Stream_callFunction */
+#define TRACE_GIL 2 /* audio thread waiting for the GIL */
+#define TRACE_PYTHON 3 /* python callbacks and python threads */
+#define TRACE_MAX_THREADS 16
+#define TRACE_NAME_SIZE 26
+
+typedef struct {
+    double ts; /* microseconds since the start of the trace */
+    int id; /* stream id, 0 if not a stream */
+    char phase; /* 'B' (begin) or 'E' (end) */
+    char cat;
+    char name[TRACE_NAME_SIZE];
+} TraceEvent;
+
+/* One ring per thread, written only by that thread. */
+typedef struct {
+    TraceEvent *events;
+    volatile long head; /* events written since the start of the trace */
+    char thread[16];
+} TraceRing;
+
 typedef enum {
     PyoPortaudio = 0,
     PyoCoreaudio = 1,
@@ -139,6 +167,68 @@ typedef struct {
     int verbosity; /* a sum of values to display different levels: 1 = error */
                    /* 2 = message, 4 = warning , 8 = debug. Default 7.*/
     int globalSeed; /* initial seed for random objects. If -1, objects are seeded with the clock. */
+
+    /* Midi output scheduler, fed by objects in the audio graph and by the python methods */
+    PmEvent *midiout_queue;
+    volatile long midiout_head; /* written by the audio thread */
+    volatile long midiout_tail; /* written by the midi output thread */
+    PmEvent *midiout_pyqueue;
+    volatile long midiout_pyhead; /* written by the python thread */
+    volatile long midiout_pytail; /* written by the midi output thread */
+    volatile int midiout_closing;
+    int midiout_running;
+    long midiout_dropped;
+    double midiout_origin; /* Pt_Time() value, in ms, of the sample 0 */
+    pthread_t midiout_thread;
+#if defined(__APPLE__)
+    dispatch_semaphore_t midiout_wake; /* posted by the producers */
+#else
+    sem_t midiout_wake; /* posted by the producers */
+#endif
+
+    /* Multirate subgraphs */
+    PyObject *domain; /* Domain receiving the new streams, NULL at full rate */
+    int domainFactor; /* decimation factor of the active domain */
+    PyObject *domains[MAX_DOMAINS]; /* every living Domain, borrowed references */
+    int domain_count;
+
+    /* Aux buses, filled by the streams' sends */
+    MYFLT *buses; /* bus_count * bufferSize samples */
+    int bus_count; /* highest bus index in use + 1 */
+
+    /* Real-time violations detector (needs libpyortcheck preloaded) */
+    int rtcheck;
+
+    /* Streams' objects are kept out of the cyclic garbage collector */
+    int gc_isolation;
+
+    /* Worker threads shared by the objects splitting their work (NULL = none) */
+    TaskPool *taskpool;
+
+    /* Real-time thread hygiene, requested with setRealtime */
+    int rt_mlock;
+    int rt_prefault; /* heap reserve, in MB, faulted in at boot */
+    int rt_audio_cpu; /* -1 = not pinned */
+    int rt_worker_cpus[TASKPOOL_MAX_THREADS];
+    int rt_worker_cpu_count;
+    int rt_priority; /* SCHED_FIFO priority, 0 = left to the audio backend */
+    volatile int rt_audio_pending; /* audio thread settings applied on the next buffer */
+    /* effective settings */
+    int rt_mlock_done;
+    int rt_prefault_done; /* in MB */
+    int rt_audio_cpu_done;
+    int rt_audio_priority_done;
+
+    /* Block timeline tracing */
+    int tracing;
+    int trace_session; /* invalidates the rings claimed by threads in a previous trace */
+    int trace_period; /* streams are traced every trace_period blocks, 0 = never */
+    int trace_now; /* streams are traced in the current block */
+    long trace_block;
+    long trace_size; /* events per ring, a power of two */
+    volatile int trace_ring_count;
+    TraceRing trace_rings[TRACE_MAX_THREADS];
+    double trace_origin;
 } Server;
 
 PyObject * PyServer_get_server();
@@ -146,6 +236,24 @@ extern PyObject * Server_removeStream(Server *self, int sid);
 extern MYFLT * Server_getInputBuffer(Server *self);
 extern PmEvent * Server_getMidiEventBuffer(Server *self);
 extern int Server_getMidiEventCount(Server *self);
+extern void Server_midiOutPost(Server *self, PmMessage message, int offset);
+extern void Server_midiOutSend(Server *self, PmMessage message, PmTimestamp timestamp);
+extern PmTimestamp Server_midiOutTime(Server *self, int offset);
+extern MYFLT * Server_getBusBuffer(Server *self, int bus);
+extern TaskPool * Server_getTaskPool(Server *self);
+extern void Server_prefaultMemory(Server *self, void *ptr, size_t bytes);
+extern void Server_registerDomain(Server *self, PyObject *domain);
+extern void Server_unregisterDomain(Server *self, PyObject *domain);
+extern void Server_rtcheckEnter(Server *self, PyObject *stream);
+extern void Server_traceEvent(Server *self, char phase, int cat, const char *name, int id);
+extern void Server_traceStream(Server *self, char phase, PyObject *stream);
+extern void Server_traceCallable(Server *self, char phase, PyObject *callable);
+
+/* Implemented in src/objects/domainmodule.c */
+extern void Domain_addStream(PyObject *domain, PyObject *stream);
+extern int Domain_removeStream(PyObject *domain, int sid);
+extern PyObject * Domain_getStreamList(PyObject *domain);
+extern int Domain_getFactor(PyObject *domain);
 extern int Server_generateSeed(Server *self, int oid);
 extern PyTypeObject ServerType;
 
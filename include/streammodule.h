@@ -21,10 +21,18 @@
 #include <Python.h>
 #include "pyomodule.h"
 
+/* Bus send, accumulated into a server bus right after the stream computes. */
+typedef struct {
+    int bus;
+    MYFLT gain;
+    MYFLT lastgain;
+} StreamSend;
+
 typedef struct {
     PyObject_HEAD
     PyObject *streamobject;
     void (*funcptr)();
+    long (*memfuncptr)(); /* bytes held by the object's own buffers, may be NULL */
     int sid;
     int chnl;
     int bufsize;
@@ -34,6 +42,8 @@ typedef struct {
     int bufferCountWait;
     int bufferCount;
     MYFLT *data;
+    StreamSend *sends;
+    int numsends;
 } Stream;
 
 extern int Stream_getNewStreamId();
@@ -48,8 +58,12 @@ extern MYFLT * Stream_getData(Stream *self);
 extern void Stream_setData(Stream * self, MYFLT *data);
 extern void Stream_setFunctionPtr(Stream *self, void *ptr);
 extern void Stream_callFunction(Stream *self);
+extern void Stream_setMemoryFunctionPtr(Stream *self, void *ptr);
+extern long Stream_getMemory(Stream *self);
 extern void Stream_IncrementBufferCount(Stream *self);
 extern void Stream_IncrementDurationCount(Stream *self);
+extern int Stream_setSend(Stream *self, int bus, MYFLT gain);
+extern void Stream_removeSend(Stream *self, int bus);
 extern PyTypeObject StreamType;
 
 #define MAKE_NEW_STREAM(self, type, rt_error) \
@@ -57,7 +71,10 @@ extern PyTypeObject StreamType;
   if ((self) == rt_error) { return rt_error; } \
  \
   (self)->sid = (self)->chnl = (self)->todac = (self)->bufferCountWait = (self)->bufferCount = (self)->bufsize = (self)->duration = 0; \
-  (self)->active = 1;
+  (self)->active = 1; \
+  (self)->memfuncptr = NULL; \
+  (self)->sends = NULL; \
+  (self)->numsends = 0;
 
 
 typedef struct {
@@ -21,6 +21,49 @@
 #include "Python.h"
 #include "pyomodule.h"
 
+/* Packed storage formats for table samples */
+#define TABLE_PACK_NONE 0
+#define TABLE_PACK_INT16 1
+#define TABLE_PACK_INT24 2
+#define TABLE_PACK_HALF 3
+
+/* Table reads deferred by a reader until the end of its block, then
+** decoded from the packed storage and interpolated in a single pass. */
+typedef struct {
+    int count;
+    int maxsize;
+    int *index;
+    MYFLT *frac;
+    MYFLT *amp;
+    int *slot;
+    MYFLT *frame; /* 4 decoded samples around each read */
+} TableReadQueue;
+
+/* The queue is sized when the reader is created (TableReadQueue_reserve),
+** never in the processing functions. Reads beyond its size are dropped. */
+#define TableReadQueue_push(q, i, f, a, s) \
+do { \
+    if ((q)->count < (q)->maxsize) { \
+        (q)->index[(q)->count] = (i); \
+        (q)->frac[(q)->count] = (f); \
+        (q)->amp[(q)->count] = (a); \
+        (q)->slot[(q)->count++] = (s); \
+    } \
+} while (0)
+
+#define TableReadQueue_clear(q) ((q)->count = 0)
+
+extern int TableReadQueue_reserve(TableReadQueue *q, int size);
+extern void TableReadQueue_free(TableReadQueue *q);
+
+/* Readers able to read packed samples through a TableReadQueue get their
+** table stream with this macro. The "getTableStream" method of a packed
+** table makes a decoded copy of the samples for the other readers. */
+#define GET_PACKED_TABLE_STREAM(table) \
+    (PyObject_HasAttrString((PyObject *)(table), "getPackedTableStream") ? \
+     PyObject_CallMethod((PyObject *)(table), "getPackedTableStream", "") : \
+     PyObject_CallMethod((PyObject *)(table), "getTableStream", ""))
+
 #ifdef __TABLE_MODULE
 
 typedef struct {
@@ -28,6 +71,10 @@ typedef struct {
     int size;
     double samplingRate;
     MYFLT *data;
+    int packing; /* TABLE_PACK_* */
+    void *packed; /* size + 1 packed samples, owned by the table object */
+    MYFLT *expanded; /* decoded copy for readers without packed support */
+    int expand; /* set once a reader without packed support got the stream */
 } TableStream;
 
 
@@ -42,6 +89,10 @@ if ((self) == rt_error) { return rt_error; }	\
 int TableStream_getSize(PyObject *self);
 double TableStream_getSamplingRate(PyObject *self);
 MYFLT * TableStream_getData(PyObject *self);
+int TableStream_isPacked(PyObject *self);
+void TableStream_decode(PyObject *self, int start, int count, MYFLT *out);
+void TableReadQueue_flush(TableReadQueue *q, PyObject *table, MYFLT (*interp)(MYFLT *, int, MYFLT, int), MYFLT *out);
+long TableStream_getMemory(PyObject *self);
 extern PyTypeObject TableStreamType;
 
 #endif
\ No newline at end of file
@@ -0,0 +1,82 @@
+/**************************************************************************
+ * Copyright 2009-2015 Olivier Belanger                                   *
+ *                                                                        *
+ * This file is part of pyo, a python module to help digital signal       *
+ * processing script creation.                                            *
+ *                                                                        *
+ * pyo is free software: you can redistribute it and/or modify            *
+ * it under the terms of the GNU Lesser General Public License as         *
+ * published by the Free Software Foundation, either version 3 of the     *
+ * License, or (at your option) any later version.                        *
+ *                                                                        *
+ * pyo is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU Lesser General Public License for more details.                    *
+ *                                                                        *
+ * You should have received a copy of the GNU Lesser General Public       *
+ * License along with pyo.  If not, see <http://www.gnu.org/licenses/>.   *
+ *************************************************************************/
+
+/* Fork/join pool used by the heaviest objects to split the work of one
+** buffer (partials, bands, ...) across cores.
+**
+** The work is divided by the object in ntasks independent tasks. The
+** partition must only depend on the object (never on the number of
+** threads) and every task must write in its own memory: the caller then
+** reduces the partial results in task order, so that the output is the
+** same, sample for sample, with or without worker threads.
+**
+** TaskPool_run is called from the audio thread. It wakes the workers, takes
+** part in the work and spins until every task is done. It never allocates
+** nor locks. With a NULL pool, or a single task, the tasks are computed in
+** the calling thread. Task functions run without the GIL: they must not
+** touch any python object. */
+
+#ifndef _TASKPOOL_
+#define _TASKPOOL_
+
+#include <pthread.h>
+#if defined(__APPLE__)
+#include <dispatch/dispatch.h>
+#else
+#include <semaphore.h>
+#endif
+
+#define TASKPOOL_MAX_THREADS 32
+
+typedef void (*TaskPoolFunc)(void *data, int task);
+
+typedef struct {
+    int nthreads;
+    pthread_t threads[TASKPOOL_MAX_THREADS];
+#if defined(__APPLE__)
+    dispatch_semaphore_t wake;
+#else
+    sem_t wake;
+#endif
+    /* Current job, written by the caller before opening the counter. */
+    TaskPoolFunc func;
+    void *data;
+    int ntasks;
+    volatile int next; /* next task to claim, TASKPOOL_CLOSED between jobs */
+    volatile int done;
+    volatile int quit;
+    /* Effective settings of the workers, -1 = not pinned, 0 = normal priority */
+    int cpus[TASKPOOL_MAX_THREADS];
+    int priority;
+} TaskPool;
+
+TaskPool * TaskPool_new(int nthreads);
+void TaskPool_free(TaskPool *pool);
+void TaskPool_run(TaskPool *pool, TaskPoolFunc func, void *data, int ntasks);
+void TaskPool_configure(TaskPool *pool, int *cpus, int ncpus, int priority);
+
+/* Thread helpers, also used for the audio thread. TaskPool_pinThread returns
+** 0 on success. TaskPool_setThreadPriority switches the thread to SCHED_FIFO
+** and returns the priority obtained: the one asked, or the highest allowed
+** by RLIMIT_RTPRIO, or 0 if the thread keeps its normal scheduling. */
+int TaskPool_pinThread(pthread_t thread, int cpu);
+int TaskPool_setThreadPriority(pthread_t thread, int priority);
+
+#endif
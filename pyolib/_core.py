@@ -19,14 +19,17 @@ You should have received a copy of the GNU Lesser General Public
 License along with pyo.  If not, see <http://www.gnu.org/licenses/>.
 """
 from types import BooleanType, ListType, TupleType, SliceType, LongType, IntType, FloatType, StringType, UnicodeType, NoneType
-import random, os, sys, inspect, tempfile
+import random, os, sys, inspect, tempfile, struct, array, threading, multiprocessing, Queue
 from subprocess import call
-from weakref import proxy
+from weakref import proxy, ref, WeakSet
 
 import __builtin__
 if hasattr(__builtin__, 'pyo_use_double'):
     import pyo64 as current_pyo
     from _pyo64 import *
+elif hasattr(__builtin__, 'pyo_use_mixed'):
+    import pyomx as current_pyo
+    from _pyomx import *
 else:
     import pyo as current_pyo
     from _pyo import *
@@ -54,6 +57,10 @@ FUNCTIONS_INIT_LINES = {"pa_count_host_apis": "pa_count_host_apis()", "pa_list_h
                         "sndinfo": "sndinfo(path, print=False)", "savefile": "savefile(samples, path, sr=44100, channels=1, fileformat=0, sampletype=0)",
                         "savefileFromTable": "savefileFromTable(table, path, fileformat=0, sampletype=0)",
                         "upsamp": "upsamp(path, outfile, up=4, order=128)", "downsamp": "downsamp(path, outfile, down=4, order=128)",
+                        "sndfeatures": "sndfeatures(path, outfile, features=['rms', 'peak', 'zcross', 'centroid', 'pitch'], hopsize=512, winsize=1024, minfreq=40, maxfreq=1000, tolerance=0.15)",
+                        "sndfeaturesBatch": "sndfeaturesBatch(paths, outdir, features=None, hopsize=512, winsize=1024, threads=0)",
+                        "readFeatures": "readFeatures(path)",
+                        "pvanalysis": "pvanalysis(input, outfile, size=1024, olaps=4, wintype=2)",
                         "midiToHz": "midiToHz(x)", "hzToMidi": "hzToMidi(x)", "midiToTranspo": "midiToTranspo(x)", "sampsToSec": "sampsToSec(x)",
                         "secToSamps": "secToSamps(x)", "linToCosCurve": "linToCosCurve(data, yrange=[0, 1], totaldur=1, points=1024, log=False)",
                         "rescale": "rescale(data, xmin=0.0, xmax=1.0, ymin=0.0, ymax=1.0, xlog=False, ylog=False)",
@@ -360,6 +367,128 @@ def getVersion():
     major, minor, rev = PYO_VERSION.split('.')
     return (int(major), int(minor), int(rev))
 
+def readFeatures(path):
+    """
+    Reads a features file created by `sndfeatures` or `sndfeaturesBatch`.
+
+    Returns a tuple (header, frames). `header` is a dictionary with keys
+    'features' (list of feature names), 'numframes', 'hopsize', 'winsize'
+    and 'sr' (sampling rate of the analyzed sound). `frames` is a list of
+    lists, one list of values per frame, in the order given by 'features'.
+
+    :Args:
+
+        path : string
+            Full path of the features file.
+
+    >>> header, frames = readFeatures("/home/user/transparent.pyf")
+    >>> pitches = [f[header['features'].index('pitch')] for f in frames]
+
+    """
+    f = open(path, "rb")
+    try:
+        if f.read(4) != "PYOF":
+            print "readFeatures: %s is not a features file." % path
+            return None
+        numfeats, numframes, hopsize, winsize, version = struct.unpack("=5i", f.read(20))
+        sr = struct.unpack("=d", f.read(8))[0]
+        names = [f.read(16).rstrip("\0") for i in range(numfeats)]
+        data = array.array("f")
+        data.fromfile(f, numfeats * numframes)
+    finally:
+        f.close()
+    header = {"features": names, "numframes": numframes, "hopsize": hopsize, "winsize": winsize, "sr": sr}
+    frames = [data[i:i+numfeats].tolist() for i in range(0, len(data), numfeats)]
+    return header, frames
+
+def sndfeaturesBatch(paths, outdir, features=None, hopsize=512, winsize=1024, threads=0, **kwargs):
+    """
+    Analyzes a list of audio files in parallel.
+
+    Every file is processed by `sndfeatures`, which releases the Python
+    interpreter lock while the C analysis kernels are running, so files are
+    analyzed concurrently by a pool of worker threads. The features of each
+    file are written in `outdir`, using the file's name with a ".pyf" extension.
+    The directories of the input files, relative to their common parent
+    directory, are recreated under `outdir`, so that files with the same name
+    in different directories don't overwrite each other. A ValueError is
+    raised if two input files would still share the same features file (same
+    name with a different extension in the same directory, or the same file
+    given twice).
+
+    Returns a list of tuples (input path, features file, number of frames),
+    in the same order as `paths`. The number of frames is -1 if the analysis
+    of a file failed.
+
+    :Args:
+
+        paths : list of strings
+            Full paths of the audio files to analyze.
+        outdir : string
+            Directory where to save the features files.
+        features : list of strings, optional
+            Features to compute. See `sndfeatures` for the available features.
+            If None, `sndfeatures` defaults are used. Defaults to None.
+        hopsize : int, optional
+            Number of samples between two successive frames. Defaults to 512.
+        winsize : int, optional
+            Size, in samples, of the analysis window. Defaults to 1024.
+        threads : int, optional
+            Number of worker threads. If 0, the number of cores is used.
+            Defaults to 0.
+
+    Other keyword arguments (`minfreq`, `maxfreq`, `tolerance`) are given to `sndfeatures`.
+
+    >>> import glob
+    >>> files = glob.glob("/home/user/samples/*.wav")
+    >>> results = sndfeaturesBatch(files, "/home/user/features", ["rms", "centroid"])
+
+    """
+    if threads <= 0:
+        try:
+            threads = multiprocessing.cpu_count()
+        except NotImplementedError:
+            threads = 1
+    # Mirrors the directories of the input files, relative to their common
+    # parent, under outdir.
+    abspaths = [os.path.abspath(path) for path in paths]
+    root = os.path.dirname(os.path.commonprefix([os.path.dirname(path) + os.sep for path in abspaths]))
+    outfiles, owners = [], {}
+    for i, path in enumerate(abspaths):
+        outfile = os.path.join(outdir, os.path.splitext(os.path.relpath(path, root))[0] + ".pyf")
+        key = os.path.normcase(os.path.abspath(outfile))
+        if key in owners:
+            raise ValueError("sndfeaturesBatch: %s and %s would both be written to %s." % (paths[owners[key]], paths[i], outfile))
+        owners[key] = i
+        outfiles.append(outfile)
+    for folder in set([outdir] + [os.path.dirname(outfile) for outfile in outfiles]):
+        if not os.path.isdir(folder):
+            os.makedirs(folder)
+    results = [None] * len(paths)
+    jobs = Queue.Queue()
+    for i, path in enumerate(paths):
+        jobs.put(i)
+
+    def worker():
+        while True:
+            try:
+                i = jobs.get_nowait()
+            except Queue.Empty:
+                return
+            path, outfile = paths[i], outfiles[i]
+            ret = sndfeatures(path, outfile, features, hopsize, winsize, **kwargs)
+            if type(ret) == TupleType:
+                results[i] = (path, outfile, ret[0])
+            else:
+                results[i] = (path, outfile, -1)
+
+    workers = [threading.Thread(target=worker) for i in range(min(threads, max(len(paths), 1)))]
+    for w in workers:
+        w.start()
+    for w in workers:
+        w.join()
+    return results
+
 def getWeakMethodRef(x):
     if type(x) in [ListType, TupleType]:
         tmp = []
@@ -397,6 +526,73 @@ class WeakMethod(object):
 ######################################################################
 ### PyoObjectBase -> abstract class for pyo objects
 ######################################################################
+# Living pyo objects, walked by Server.getMemoryReport().
+_PYO_OBJECTS = WeakSet()
+
+def _baseMemory(obj):
+    """
+    Return a list of (key, bytes) tuples, one for each stream, table
+    or matrix managed by `obj`. The key identifies the native object,
+    so that buffers shared between pyo objects are counted once.
+
+    """
+    mem = []
+    for base in obj._base_objs + getattr(obj, "_base_players", []):
+        if hasattr(base, "_getStream"):
+            stream = base._getStream()
+            mem.append((("stream", stream.getId()), stream.getMemory()))
+        elif hasattr(base, "getPackedTableStream"):
+            # getTableStream() would make a decoded copy of packed samples.
+            stream = base.getPackedTableStream()
+            mem.append((("table", id(stream)), stream.getMemory()))
+        elif hasattr(base, "getTableStream"):
+            stream = base.getTableStream()
+            mem.append((("table", id(stream)), stream.getMemory()))
+        elif hasattr(base, "getMatrixStream"):
+            stream = base.getMatrixStream()
+            mem.append((("matrix", id(stream)), stream.getMemory()))
+    return mem
+
+# Memory accounted at the creation and at the deletion of the objects, so
+# that the peaks reached between two memory reports are not missed.
+# "classes" maps a class name to [living bytes, peak bytes].
+_PYO_MEMORY = {"total": 0, "peak": 0, "classes": {}}
+_PYO_MEMORY_REFS = set()
+
+def _memoryAdd(name, bytes):
+    cls = _PYO_MEMORY["classes"].setdefault(name, [0, 0])
+    cls[0] += bytes
+    cls[1] = max(cls[1], cls[0])
+    _PYO_MEMORY["total"] += bytes
+    _PYO_MEMORY["peak"] = max(_PYO_MEMORY["peak"], _PYO_MEMORY["total"])
+
+def _memoryCreated(obj):
+    if not hasattr(obj, "_base_objs"):
+        return
+    name = obj.__class__.__name__
+    bytes = sum([mem for key, mem in _baseMemory(obj)])
+    _memoryAdd(name, bytes)
+    def deleted(wr, name=name, bytes=bytes):
+        _PYO_MEMORY_REFS.discard(wr)
+        _memoryAdd(name, -bytes)
+    _PYO_MEMORY_REFS.add(ref(obj, deleted))
+
+def _memoryResetPeaks():
+    _PYO_MEMORY["peak"] = _PYO_MEMORY["total"]
+    for cls in _PYO_MEMORY["classes"].values():
+        cls[1] = cls[0]
+
+class _PyoObjectType(type):
+    """
+    Metaclass of the pyo objects, accounts the memory of a new object once
+    its __init__ method has created all its native objects.
+
+    """
+    def __call__(cls, *args, **kwargs):
+        obj = type.__call__(cls, *args, **kwargs)
+        _memoryCreated(obj)
+        return obj
+
 class PyoObjectBase(object):
     """
     Base class for all pyo objects.
@@ -416,6 +612,8 @@ class PyoObjectBase(object):
 
     """
 
+    __metaclass__ = _PyoObjectType
+
     # Descriptive word for this kind of object, for use in printing
     # descriptions of the object. Subclasses need to set this.
     _STREAM_TYPE = ''
@@ -425,6 +623,7 @@ class PyoObjectBase(object):
             raise PyoServerStateException("You must create and boot a Server before creating any audio object.")
         if not serverBooted():
             raise PyoServerStateException("The Server must be booted before creating any audio object.")
+        _PYO_OBJECTS.add(self)
 
     def dump(self):
         """
@@ -451,6 +650,17 @@ class PyoObjectBase(object):
         """
         return self._base_objs
 
+    def getMemory(self):
+        """
+        Return the native memory, in bytes, used by the object.
+
+        This includes the object structures and output buffers of the
+        streams and, for the objects that allocate them, the delay lines,
+        analysis frames, table samples, etc.
+
+        """
+        return sum([bytes for key, bytes in _baseMemory(self)])
+
     def getServer(self):
         """
         Return a reference to the current Server object.
@@ -894,6 +1104,68 @@ class PyoObject(PyoObjectBase):
         [obj.stop() for obj in self._base_objs]
         return self
 
+    def send(self, bus=0, gain=1, inc=1):
+        """
+        Accumulate the object's samples into an aux bus of the server.
+
+        The samples are added to the bus right after the object computes,
+        with no intermediate object. Use a BusIn object to read the sum of
+        all the sends to a bus. Calling `send` again with the same bus only
+        updates the gain, which is ramped over one buffer.
+
+        This method returns `self`, allowing it to be applied at the object
+        creation.
+
+        :Args:
+
+            bus : int or list of ints, optional
+                Bus assigned to the first audio stream of the object.
+                Defaults to 0.
+            gain : float or list of floats, optional
+                Amplitude of the send. Defaults to 1.
+            inc : int, optional
+                Bus increment value for successive streams. Use 0 to send
+                every stream to the same bus. Defaults to 1.
+
+        .. note::
+
+            BusIn objects read the bus when they compute, so they should be
+            created after the objects sending to them.
+
+        """
+        pyoArgsAssert(self, "inI", bus, gain, inc)
+        server = self._base_objs[0].getServer()
+        gain, lmax = convertArgsToLists(gain)
+        for i, obj in enumerate(self._base_objs):
+            if type(bus) == ListType:
+                b = wrap(bus,i)
+            else:
+                b = bus + i * inc
+            server._setSend(obj._getStream(), b, wrap(gain,i))
+        return self
+
+    def unsend(self, bus=None):
+        """
+        Remove the object's sends to aux buses.
+
+        This method returns `self`, allowing it to be applied at the object
+        creation.
+
+        :Args:
+
+            bus : int, optional
+                Bus to stop sending to. If None, all the sends are removed.
+                Defaults to None.
+
+        """
+        server = self._base_objs[0].getServer()
+        for obj in self._base_objs:
+            if bus is None:
+                server._removeSend(obj._getStream())
+            else:
+                server._removeSend(obj._getStream(), bus)
+        return self
+
     def mix(self, voices=1):
         """
         Mix the object's audio streams into `voices` streams and return
@@ -32,13 +32,96 @@ from _maps import *
 from _widgets import createSpectrumWindow, createScopeWindow
 from pattern import Pattern
 
-class Follower(PyoObject):
+class HopRateObject(PyoObject):
+    """
+    Base class for the analysis objects with a hop-rate output mode.
+
+    In hop-rate mode, the analysis is not written in the audio-rate buffer,
+    it is published once per analysis hop and can be read with
+    `getHopValue` or received by a function given to `setHopFunction`.
+
+    :Parent: :py:class:`PyoObject`
+
+    """
+    _hoprate = False
+    _hopfunction = None
+
+    def setHopRate(self, x):
+        """
+        Activates or deactivates the hop-rate output mode.
+
+        In hop-rate mode, the object does not fill its audio-rate buffer
+        anymore (its signal is silent and `mul` and `add` are ignored).
+        Instead, it publishes a value at each analysis hop (see the object's
+        documentation for what is published and when). The last published
+        value can be retrieved with the `getHopValue` method, and a function
+        can be called every time a new value is published (see
+        `setHopFunction`).
+
+        :Args:
+
+            x : boolean
+                True activates the hop-rate mode, False deactivates it.
+
+        """
+        pyoArgsAssert(self, "b", x)
+        self._hoprate = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setHopRate(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setHopFunction(self, function):
+        """
+        Sets the function called at each new value published in hop-rate mode.
+
+        The function is called from the audio thread with the published value
+        as argument. If the object has more than one stream, the function is
+        called independently for each stream.
+
+        :Args:
+
+            function : Python callable
+                Function called with the published value. None removes the function.
+
+        """
+        pyoArgsAssert(self, "z", function)
+        self._hopfunction = getWeakMethodRef(function)
+        [obj.setHopFunction(self._hopfunction) for obj in self._base_objs]
+
+    def getHopValue(self, all=False):
+        """
+        Returns the last value published in hop-rate mode.
+
+        :Args:
+
+            all : boolean, optional
+                If True, the first value of each object's stream
+                will be returned as a list. Otherwise, only the value
+                of the first object's stream will be returned as a float.
+                Defaults to False.
+
+        """
+        if not all:
+            return self._base_objs[0].getHopValue()
+        else:
+            return [obj.getHopValue() for obj in self._base_objs]
+
+    @property
+    def hoprate(self):
+        """boolean. Activates the hop-rate output mode."""
+        return self._hoprate
+    @hoprate.setter
+    def hoprate(self, x): self.setHopRate(x)
+
+class Follower(HopRateObject):
     """
     Envelope follower.
 
     Output signal is the continuous mean amplitude of an input signal.
 
-    :Parent: :py:class:`PyoObject`
+    In hop-rate mode (see `setHopRate`), Follower publishes once per buffer
+    the amplitude reached at the end of the buffer.
+
+    :Parent: :py:class:`HopRateObject`
 
     :Args:
 
@@ -233,14 +316,17 @@ class Follower2(PyoObject):
     @falltime.setter
     def falltime(self, x): self.setFalltime(x)
 
-class ZCross(PyoObject):
+class ZCross(HopRateObject):
     """
     Zero-crossing counter.
 
     Output signal is the number of zero-crossing occured during each
     buffer size, normalized between 0 and 1.
 
-    :Parent: :py:class:`PyoObject`
+    In hop-rate mode (see `setHopRate`), ZCross publishes once per buffer the
+    zero-crossing rate of that buffer.
+
+    :Parent: :py:class:`HopRateObject`
 
     :Args:
 
@@ -323,7 +409,7 @@ class ZCross(PyoObject):
     @thresh.setter
     def thresh(self, x): self.setThresh(x)
 
-class Yin(PyoObject):
+class Yin(HopRateObject):
     """
     Pitch tracker using the Yin algorithm.
 
@@ -335,7 +421,10 @@ class Yin(PyoObject):
 
     The audio output of the object is the estimated frequency, in Hz, of the input sound.
 
-    :Parent: :py:class:`PyoObject`
+    In hop-rate mode (see `setHopRate`), Yin publishes the estimated pitch at
+    the end of each analysis window (`winsize` samples).
+
+    :Parent: :py:class:`HopRateObject`
 
     :Args:
 
@@ -505,7 +594,7 @@ class Yin(PyoObject):
     @cutoff.setter
     def cutoff(self, x): self.setCutoff(x)
 
-class Centroid(PyoObject):
+class Centroid(HopRateObject):
     """
     Computes the spectral centroid of an input signal.
 
@@ -516,7 +605,10 @@ class Centroid(PyoObject):
     Centroid does its computation with two overlaps, so a new output value
     comes every half of the FFT window size.
 
-    :Parent: :py:class:`PyoObject`
+    In hop-rate mode (see `setHopRate`), Centroid publishes the spectral
+    centroid every `size` / 2 samples.
+
+    :Parent: :py:class:`HopRateObject`
 
     :Args:
 
@@ -580,7 +672,7 @@ class Centroid(PyoObject):
     @input.setter
     def input(self, x): self.setInput(x)
 
-class AttackDetector(PyoObject):
+class AttackDetector(HopRateObject):
     """
     Audio signal onset detection.
 
@@ -590,7 +682,10 @@ class AttackDetector(PyoObject):
     carefully tuned depending on the nature of the analysed signal and the level
     of the background noise.
 
-    :Parent: :py:class:`PyoObject`
+    In hop-rate mode (see `setHopRate`), AttackDetector publishes the value 1
+    at each detected attack.
+
+    :Parent: :py:class:`HopRateObject`
 
     :Args:
 
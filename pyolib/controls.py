@@ -698,6 +698,180 @@ class Expseg(PyoObject):
     @inverse.setter
     def inverse(self, x): self.setInverse(x)
 
+class Automation(PyoObject):
+    """
+    Sample accurate break-points automation lane.
+
+    Automation renders a series of curved segments between break-points
+    natively, one segment run at a time, without any python call during
+    playback. Break-points are given once at creation (or with `setList`)
+    or can be streamed in chunks with `append`, which makes it suitable
+    for driving a large number of parameters from a score.
+
+    The play() method starts the lane from the beginning and is not called
+    at the object creation time.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        list : list of tuples
+            Points used to construct the segments. Each tuple is a new
+            point in the form (time, value), (time, value, curve) or
+            (time, value, curve, shape). `curve` and `shape` give the
+            kind of segment going from this point to the next one:
+
+            0. linear (default)
+            1. exponential, `shape` is the exponent (defaults to 10)
+            2. cosine (smooth start and end)
+            3. step, holds the value until the next point
+
+            Times are given in seconds and must be in increasing order.
+        loop : boolean, optional
+            Looping mode. Defaults to False.
+        initToFirstVal : boolean, optional
+            If True, audio buffer will be filled at initialization with the
+            first value of the lane. Defaults to False.
+
+    .. note::
+
+        The out() method is bypassed. Automation's signal can not be sent to audio outs.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> pts = [(0,500), (1,1000,1,4), (2,700,2), (3,300,3), (4,500)]
+    >>> l = Automation(pts, loop=True)
+    >>> a = Sine(freq=l, mul=.3).mix(2).out()
+    >>> # then call:
+    >>> l.play()
+
+    """
+    def __init__(self, list, loop=False, initToFirstVal=False, mul=1, add=0):
+        pyoArgsAssert(self, "lbbOO", list, loop, initToFirstVal, mul, add)
+        PyoObject.__init__(self, mul, add)
+        self._list = list
+        self._loop = loop
+        initToFirstVal, loop, mul, add, lmax = convertArgsToLists(initToFirstVal, loop, mul, add)
+        if len(list) == 0 or type(list[0]) != ListType:
+            self._base_objs = [Automation_base(list, wrap(loop,i), wrap(initToFirstVal,i), wrap(mul,i), wrap(add,i)) for i in range(lmax)]
+        else:
+            listlen = len(list)
+            lmax = max(listlen, lmax)
+            self._base_objs = [Automation_base(wrap(list,i), wrap(loop,i), wrap(initToFirstVal,i), wrap(mul,i), wrap(add,i)) for i in range(lmax)]
+
+    def out(self, chnl=0, inc=1, dur=0, delay=0):
+        return self.play(dur, delay)
+
+    def setList(self, x):
+        """
+        Replace the `list` attribute.
+
+        The new break-points take effect immediately, the playback
+        position is kept.
+
+        :Args:
+
+            x : list of tuples
+                new `list` attribute.
+
+        """
+        pyoArgsAssert(self, "l", x)
+        self._list = x
+        if len(x) == 0 or type(x[0]) != ListType:
+            [obj.setList(x) for i, obj in enumerate(self._base_objs)]
+        else:
+            [obj.setList(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def append(self, x):
+        """
+        Adds break-points at the end of the lane.
+
+        Useful to stream a long automation in chunks while it is playing.
+        The times of the new points must be greater or equal to the time
+        of the last point already in the lane.
+
+        If the lane is not looping, the points already played (the ones
+        before the current segment) are discarded first, so that the
+        memory used by a streamed lane stays bounded. They are removed from
+        the `list` attribute too, and setTime() or play() can't go back
+        before the first remaining point.
+
+        :Args:
+
+            x : list of tuples
+                Break-points to add, in the same format as the `list` attribute.
+
+        """
+        pyoArgsAssert(self, "l", x)
+        if len(x) == 0:
+            return
+        if type(x[0]) != ListType:
+            trimmed = [obj.append(x) for obj in self._base_objs]
+            x = [x]
+        else:
+            trimmed = [obj.append(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+        if len(self._list) == 0 or type(self._list[0]) != ListType:
+            cur = [self._list]
+        else:
+            cur = self._list
+        lists = [wrap(cur,i)[wrap(trimmed,i):] + wrap(x,i) for i in range(max(len(cur), len(x)))]
+        if len(lists) == 1:
+            self._list = lists[0]
+        else:
+            self._list = lists
+
+    def getPoints(self):
+        return self._list
+
+    def setTime(self, x):
+        """
+        Moves the playback position.
+
+        :Args:
+
+            x : float
+                New position, in seconds.
+
+        """
+        pyoArgsAssert(self, "n", x)
+        [obj.setTime(x) for obj in self._base_objs]
+
+    def getTime(self):
+        """
+        Returns the current playback position, in seconds.
+
+        """
+        return self._base_objs[0].getTime()
+
+    def setLoop(self, x):
+        """
+        Replace the `loop` attribute.
+
+        :Args:
+
+            x : boolean
+                new `loop` attribute.
+
+        """
+        pyoArgsAssert(self, "b", x)
+        self._loop = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setLoop(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    @property
+    def list(self):
+        """float. List of points (time, value[, curve[, shape]])."""
+        return self._list
+    @list.setter
+    def list(self, x): self.setList(x)
+
+    @property
+    def loop(self):
+        """boolean. Looping mode."""
+        return self._loop
+    @loop.setter
+    def loop(self, x): self.setLoop(x)
+
 class SigTo(PyoObject):
     """
     Convert numeric value to PyoObject signal with portamento.
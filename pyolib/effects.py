@@ -1258,6 +1258,299 @@ class Harmonizer(PyoObject):
     @winsize.setter
     def winsize(self, x): self.setWinsize(x)
 
+class MultiChorus(PyoObject):
+    """
+    Multichannel 8 modulated delay lines chorus processor.
+
+    MultiChorus works like Chorus but processes all the streams of its
+    input signal in a single object. The eight delay line modulations are
+    computed once per sample and shared by every channel, and the delay
+    lines are stored interleaved so that each tap reads the samples of all
+    channels at once. This is much cheaper than one Chorus per channel when
+    processing stereo or multichannel signals.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        input : PyoObject
+            Input signal to process. There will be one output stream
+            for each stream of the input signal.
+        depth : float or PyoObject, optional
+            Chorus depth, between 0 and 5. Defaults to 1.
+        feedback : float or PyoObject, optional
+            Amount of output signal sent back into the delay lines.
+            Defaults to 0.25.
+        bal : float or PyoObject, optional
+            Balance between wet and dry signals, between 0 and 1. 0 means no
+            chorus. Defaults to 0.5.
+
+    .. note::
+
+        `depth`, `feedback` and `bal` are shared by all channels. If a list
+        or a multi-streams PyoObject is given, only the first value is used.
+
+    >>> s = Server(nchnls=2).boot()
+    >>> s.start()
+    >>> sf = SfPlayer(SNDS_PATH + '/transparent.aif', loop=True, mul=.5)
+    >>> chor = MultiChorus([sf, Delay(sf, .01)], depth=1.5, feedback=0.5, bal=0.5).out()
+
+    """
+    def __init__(self, input, depth=1, feedback=0.25, bal=0.5, mul=1, add=0):
+        pyoArgsAssert(self, "oOOOOO", input, depth, feedback, bal, mul, add)
+        PyoObject.__init__(self, mul, add)
+        self._input = input
+        self._depth = depth
+        self._feedback = feedback
+        self._bal = bal
+        self._in_fader = InputFader(input)
+        in_fader, mul, add, lmax = convertArgsToLists(self._in_fader, mul, add)
+        depth, feedback, bal, tmp = convertArgsToLists(depth, feedback, bal)
+        self._base_players = [MultiChorusMain_base(self._in_fader.getBaseObjects(), wrap(depth,0), wrap(feedback,0), wrap(bal,0))]
+        self._base_objs = [MultiChorus_base(self._base_players[0], i, wrap(mul,i), wrap(add,i)) for i in range(len(self._in_fader))]
+
+    def setInput(self, x, fadetime=0.05):
+        """
+        Replace the `input` attribute.
+
+        :Args:
+
+            x : PyoObject
+                New signal to process.
+            fadetime : float, optional
+                Crossfade time between old and new input. Defaults to 0.05.
+
+        """
+        pyoArgsAssert(self, "oN", x, fadetime)
+        self._input = x
+        self._in_fader.setInput(x, fadetime)
+
+    def setDepth(self, x):
+        """
+        Replace the `depth` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `depth` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._depth = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setDepth(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def setFeedback(self, x):
+        """
+        Replace the `feedback` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `feedback` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._feedback = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setFeedback(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def setBal(self, x):
+        """
+        Replace the `bal` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `bal` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._bal = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setMix(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def ctrl(self, map_list=None, title=None, wxnoserver=False):
+        self._map_list = [SLMap(0., 5., 'lin', 'depth', self._depth),
+                          SLMap(0., 1., 'lin', 'feedback', self._feedback),
+                          SLMap(0., 1., 'lin', 'bal', self._bal),
+                          SLMapMul(self._mul)]
+        PyoObject.ctrl(self, map_list, title, wxnoserver)
+
+    @property
+    def input(self):
+        """PyoObject. Input signal to process."""
+        return self._input
+    @input.setter
+    def input(self, x): self.setInput(x)
+
+    @property
+    def depth(self):
+        """float or PyoObject. Chorus depth, between 0 and 5."""
+        return self._depth
+    @depth.setter
+    def depth(self, x): self.setDepth(x)
+
+    @property
+    def feedback(self):
+        """float or PyoObject. Amount of output signal sent back into the delay lines."""
+        return self._feedback
+    @feedback.setter
+    def feedback(self, x): self.setFeedback(x)
+
+    @property
+    def bal(self):
+        """float or PyoObject. wet - dry balance."""
+        return self._bal
+    @bal.setter
+    def bal(self, x): self.setBal(x)
+
+class MultiHarmonizer(PyoObject):
+    """
+    Generates harmonizing voices in synchrony with a multichannel input.
+
+    MultiHarmonizer works like Harmonizer but processes all the streams of
+    its input signal in a single object. The window envelopes and the read
+    positions of the two overlaps are computed once per sample and shared
+    by every channel, and the one second delay memory is stored interleaved
+    so that each read reaches the samples of all channels at once.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        input : PyoObject
+            Input signal to process. There will be one output stream
+            for each stream of the input signal.
+        transpo : float or PyoObject, optional
+           Transposition factor in semitone. Defaults to -7.0.
+        feedback : float or PyoObject, optional
+            Amount of output signal sent back into the delay line.
+            Defaults to 0.
+        winsize : float, optional
+            Window size in seconds (max = 1.0).
+            Defaults to 0.1.
+
+    .. note::
+
+        `transpo`, `feedback` and `winsize` are shared by all channels. If a
+        list or a multi-streams PyoObject is given, only the first value is used.
+
+    >>> s = Server(nchnls=2).boot()
+    >>> s.start()
+    >>> sf = SfPlayer(SNDS_PATH + '/transparent.aif', loop=True, mul=.3)
+    >>> harm = MultiHarmonizer([sf, Delay(sf, .01)], transpo=-5, winsize=0.05).out()
+
+    """
+    def __init__(self, input, transpo=-7.0, feedback=0, winsize=0.1, mul=1, add=0):
+        pyoArgsAssert(self, "oOOnOO", input, transpo, feedback, winsize, mul, add)
+        PyoObject.__init__(self, mul, add)
+        self._input = input
+        self._transpo = transpo
+        self._feedback = feedback
+        self._winsize = winsize
+        self._in_fader = InputFader(input)
+        in_fader, mul, add, lmax = convertArgsToLists(self._in_fader, mul, add)
+        transpo, feedback, winsize, tmp = convertArgsToLists(transpo, feedback, winsize)
+        self._base_players = [MultiHarmonizerMain_base(self._in_fader.getBaseObjects(), wrap(transpo,0), wrap(feedback,0), wrap(winsize,0))]
+        self._base_objs = [MultiHarmonizer_base(self._base_players[0], i, wrap(mul,i), wrap(add,i)) for i in range(len(self._in_fader))]
+
+    def setInput(self, x, fadetime=0.05):
+        """
+        Replace the `input` attribute.
+
+        :Args:
+
+            x : PyoObject
+                New signal to process.
+            fadetime : float, optional
+                Crossfade time between old and new input. Defaults to 0.05.
+
+        """
+        pyoArgsAssert(self, "oN", x, fadetime)
+        self._input = x
+        self._in_fader.setInput(x, fadetime)
+
+    def setTranspo(self, x):
+        """
+        Replace the `transpo` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `transpo` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._transpo = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setTranspo(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def setFeedback(self, x):
+        """
+        Replace the `feedback` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `feedback` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._feedback = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setFeedback(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def setWinsize(self, x):
+        """
+        Replace the `winsize` attribute.
+
+        :Args:
+
+            x : float
+                New `winsize` attribute.
+
+        """
+        pyoArgsAssert(self, "n", x)
+        self._winsize = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setWinsize(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def ctrl(self, map_list=None, title=None, wxnoserver=False):
+        self._map_list = [SLMap(-24.0, 24.0, 'lin', 'transpo',  self._transpo),
+                          SLMap(0., 1., 'lin', 'feedback', self._feedback),
+                          SLMap(0.001, 1, 'log', 'winsize',  self._winsize, dataOnly=True),
+                          SLMapMul(self._mul)]
+        PyoObject.ctrl(self, map_list, title, wxnoserver)
+
+    @property
+    def input(self):
+        """PyoObject. Input signal to process."""
+        return self._input
+    @input.setter
+    def input(self, x): self.setInput(x)
+
+    @property
+    def transpo(self):
+        """float or PyoObject. Transposition factor in semitone."""
+        return self._transpo
+    @transpo.setter
+    def transpo(self, x): self.setTranspo(x)
+
+    @property
+    def feedback(self):
+        """float or PyoObject. Amount of output signal sent back into the delay line."""
+        return self._feedback
+    @feedback.setter
+    def feedback(self, x): self.setFeedback(x)
+
+    @property
+    def winsize(self):
+        """float. Window size in seconds (max = 1.0)."""
+        return self._winsize
+    @winsize.setter
+    def winsize(self, x): self.setWinsize(x)
+
 class Delay1(PyoObject):
     """
     Delays a signal by one sample.
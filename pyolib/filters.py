@@ -1840,6 +1840,191 @@ class Phaser(PyoObject):
     @feedback.setter
     def feedback(self, x): self.setFeedback(x)
 
+class MultiPhaser(PyoObject):
+    """
+    Multichannel multi-stages second-order phase shifter allpass filters.
+
+    MultiPhaser works like Phaser but processes all the streams of its
+    input signal in a single object. The allpass coefficients are computed
+    once for all channels, at most once per sample when a parameter is an
+    audio signal and only when a value changes otherwise. The filter
+    memories of every channel are stored side by side, so that each stage
+    is applied to all the channels with a few vector instructions. The
+    output of each channel is the same as the one of Phaser.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        input : PyoObject
+            Input signal to process. There will be one output stream
+            for each stream of the input signal.
+        freq : float or PyoObject, optional
+            Center frequency of the first notch. Defaults to 1000.
+        spread : float or PyoObject, optional
+            Spreading factor for upper notch frequencies. Defaults to 1.1.
+        q : float or PyoObject, optional
+            Q of the filter as center frequency / bandwidth. Defaults to 10.
+        feedback : float or PyoObject, optional
+            Amount of output signal which is fed back into the input of the
+            allpass chain. Defaults to 0.
+        num : int, optional
+            The number of allpass stages in series. Defines the number of
+            notches in the spectrum. Defaults to 8.
+
+            Available at initialization only.
+
+    .. note::
+
+        `freq`, `spread`, `q` and `feedback` are shared by all channels. If
+        a list or a multi-streams PyoObject is given, only the first value
+        is used.
+
+    >>> s = Server(nchnls=2).boot()
+    >>> s.start()
+    >>> fade = Fader(fadein=.1, mul=.07).play()
+    >>> a = Noise(fade).mix(8)
+    >>> lf1 = Sine(freq=.1, mul=100, add=250)
+    >>> lf2 = Sine(freq=.18, mul=.4, add=1.5)
+    >>> b = MultiPhaser(a, freq=lf1, spread=lf2, q=1, num=20, mul=.5)
+    >>> c = b.mix(2).out()
+
+    """
+    def __init__(self, input, freq=1000, spread=1.1, q=10, feedback=0, num=8, mul=1, add=0):
+        pyoArgsAssert(self, "oOOOOiOO", input, freq, spread, q, feedback, num, mul, add)
+        PyoObject.__init__(self, mul, add)
+        self._input = input
+        self._freq = freq
+        self._spread = spread
+        self._q = q
+        self._feedback = feedback
+        self._num= num
+        self._in_fader = InputFader(input)
+        in_fader, mul, add, lmax = convertArgsToLists(self._in_fader, mul, add)
+        freq, spread, q, feedback, tmp = convertArgsToLists(freq, spread, q, feedback)
+        self._base_players = [MultiPhaserMain_base(self._in_fader.getBaseObjects(), wrap(freq,0), wrap(spread,0),
+                                                   wrap(q,0), wrap(feedback,0), num)]
+        self._base_objs = [MultiPhaser_base(self._base_players[0], i, wrap(mul,i), wrap(add,i)) for i in range(len(self._in_fader))]
+
+    def setInput(self, x, fadetime=0.05):
+        """
+        Replace the `input` attribute.
+
+        :Args:
+
+            x : PyoObject
+                New signal to process.
+            fadetime : float, optional
+                Crossfade time between old and new input. Defaults to 0.05.
+
+        """
+        pyoArgsAssert(self, "oN", x, fadetime)
+        self._input = x
+        self._in_fader.setInput(x, fadetime)
+
+    def setFreq(self, x):
+        """
+        Replace the `freq` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `freq` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._freq = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setFreq(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def setSpread(self, x):
+        """
+        Replace the `spread` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `spread` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._spread = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setSpread(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def setQ(self, x):
+        """
+        Replace the `q` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `q` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._q = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setQ(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def setFeedback(self, x):
+        """
+        Replace the `feedback` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `feedback` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._feedback = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setFeedback(wrap(x,i)) for i, obj in enumerate(self._base_players)]
+
+    def ctrl(self, map_list=None, title=None, wxnoserver=False):
+        self._map_list = [SLMap(20, 2000, "log", "freq", self._freq),
+                          SLMap(0.5, 2, "lin", "spread", self._spread),
+                          SLMap(0.5, 100, "log", "q", self._q),
+                          SLMap(0, 1, "lin", "feedback", self._feedback),
+                          SLMapMul(self._mul)]
+        PyoObject.ctrl(self, map_list, title, wxnoserver)
+
+    @property
+    def input(self):
+        """PyoObject. Input signal to process."""
+        return self._input
+    @input.setter
+    def input(self, x): self.setInput(x)
+
+    @property
+    def freq(self):
+        """float or PyoObject. Center frequency of the first notch."""
+        return self._freq
+    @freq.setter
+    def freq(self, x): self.setFreq(x)
+
+    @property
+    def spread(self):
+        """float or PyoObject. Spreading factor for upper notch frequencies."""
+        return self._spread
+    @spread.setter
+    def spread(self, x): self.setSpread(x)
+
+    @property
+    def q(self):
+        """float or PyoObject. Q factor of the filter."""
+        return self._q
+    @q.setter
+    def q(self, x): self.setQ(x)
+
+    @property
+    def feedback(self):
+        """float or PyoObject. Feedback factor of the filter."""
+        return self._feedback
+    @feedback.setter
+    def feedback(self, x): self.setFeedback(x)
+
 class Vocoder(PyoObject):
     """
     Applies the spectral envelope of a first sound to the spectrum of a second sound.
@@ -1878,23 +2063,48 @@ class Vocoder(PyoObject):
         stages : int, optional
             The number of bands in the filter bank. Defines the number of notches in
             the spectrum. Defaults to 24.
+        mode : int, optional
+            Processing mode. Defaults to 0.
+
+            0. Filters. Each band is a pair of bandpass filters, on both inputs, and
+               an envelope follower, computed for every sample. The CPU cost grows
+               with the number of bands.
+            1. FFT. Both inputs are analyzed with an FFT of `size` samples (4 overlaps).
+               Each bin belongs to the band with the nearest center frequency and is
+               weighted by the response of the band's filters. The envelope of a band
+               is the energy of its bins in the first input, smoothed according to
+               `slope`, and is applied to the same bins of the exciter. The CPU cost
+               hardly depends on the number of bands, hundreds of them can be used.
+               The output is delayed by `size` * 3 / 4 samples.
+        size : int {pow-of-two}, optional
+            FFT size of the fft mode, between 64 and 16384. Larger sizes give a better
+            frequency resolution, needed by narrow low bands, but a longer latency and
+            a slower time response. Defaults to 1024.
 
     .. note::
 
-        Altough parameters can be audio signals, values are sampled only four times
+        Altough parameters can be audio signals, values are sampled only once
         per buffer size. To avoid artefacts, it is recommended to keep variations
         at low rate (< 20 Hz).
 
+    .. note::
+
+        The two modes don't have the same output level. In fft mode, a sine of
+        amplitude A in the exciter, centered in a band where the first input is a
+        sine of amplitude B, comes out with an amplitude of about A * B.
+
     >>> s = Server().boot()
     >>> s.start()
     >>> sf = SfPlayer(SNDS_PATH+'/transparent.aif', loop=True)
     >>> ex = BrownNoise(0.5)
     >>> voc = Vocoder(sf, ex, freq=80, spread=1.2, q=20, slope=0.5)
     >>> out = voc.mix(2).out()
+    >>> # 256 bands, in fft mode
+    >>> voc2 = Vocoder(sf, ex, freq=40, spread=1.05, q=30, stages=256, mode=1, size=2048, mul=3)
 
     """
-    def __init__(self, input, input2, freq=60, spread=1.25, q=20, slope=0.5, stages=24, mul=1, add=0):
-        pyoArgsAssert(self, "ooOOOOiOO", input, input2, freq, spread, q, slope, stages, mul, add)
+    def __init__(self, input, input2, freq=60, spread=1.25, q=20, slope=0.5, stages=24, mode=0, size=1024, mul=1, add=0):
+        pyoArgsAssert(self, "ooOOOOiiiOO", input, input2, freq, spread, q, slope, stages, mode, size, mul, add)
         PyoObject.__init__(self, mul, add)
         self._input = input
         self._input2 = input2
@@ -1903,10 +2113,13 @@ class Vocoder(PyoObject):
         self._q = q
         self._slope = slope
         self._stages = stages
+        self._mode = mode
+        self._size = size
         self._in_fader = InputFader(input)
         self._in_fader2 = InputFader(input2)
-        in_fader, in_fader2, freq, spread, q, slope, stages, mul, add, lmax = convertArgsToLists(self._in_fader, self._in_fader2, freq, spread, q, slope, stages, mul, add)
-        self._base_objs = [Vocoder_base(wrap(in_fader,i), wrap(in_fader2,i), wrap(freq,i), wrap(spread,i), wrap(q,i), wrap(slope,i), wrap(stages,i), wrap(mul,i), wrap(add,i)) for i in range(lmax)]
+        in_fader, in_fader2, freq, spread, q, slope, stages, mode, size, mul, add, lmax = convertArgsToLists(self._in_fader, self._in_fader2, freq, spread, q, slope, stages, mode, size, mul, add)
+        self._base_objs = [Vocoder_base(wrap(in_fader,i), wrap(in_fader2,i), wrap(freq,i), wrap(spread,i), wrap(q,i), wrap(slope,i), wrap(stages,i),
+                                        wrap(mode,i), wrap(size,i), wrap(mul,i), wrap(add,i)) for i in range(lmax)]
 
     def setInput(self, x, fadetime=0.05):
         """
@@ -2015,6 +2228,36 @@ class Vocoder(PyoObject):
         x, lmax = convertArgsToLists(x)
         [obj.setStages(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
 
+    def setMode(self, x):
+        """
+        Replace the `mode` attribute.
+
+        :Args:
+
+            x : int {0, 1}
+                New `mode` attribute.
+
+        """
+        pyoArgsAssert(self, "i", x)
+        self._mode = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setMode(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setSize(self, x):
+        """
+        Replace the `size` attribute.
+
+        :Args:
+
+            x : int
+                New `size` attribute.
+
+        """
+        pyoArgsAssert(self, "i", x)
+        self._size = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setSize(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
     def ctrl(self, map_list=None, title=None, wxnoserver=False):
         self._map_list = [SLMap(10, 1000, "log", "freq", self._freq),
                           SLMap(0.25, 2, "lin", "spread", self._spread),
@@ -2073,6 +2316,20 @@ class Vocoder(PyoObject):
     @stages.setter
     def stages(self, x): self.setStages(x)
 
+    @property
+    def mode(self):
+        """int. Processing mode, 0 = filters, 1 = fft."""
+        return self._mode
+    @mode.setter
+    def mode(self, x): self.setMode(x)
+
+    @property
+    def size(self):
+        """int. FFT size of the fft mode."""
+        return self._size
+    @size.setter
+    def size(self, x): self.setSize(x)
+
 class IRWinSinc(PyoObject):
     """
     Windowed-sinc filter using circular convolution.
@@ -3596,4 +3853,225 @@ class ComplexRes(PyoObject):
         """float or PyoObject. Decay time of the filter's response."""
         return self._decay
     @decay.setter
-    def decay(self, x): self.setDecay(x)
\ No newline at end of file
+    def decay(self, x): self.setDecay(x)
+
+class ModalBank(PyoObject):
+    """
+    Bank of complex one-pole resonators for modal synthesis.
+
+    ModalBank runs hundreds, or thousands, of ComplexRes-like resonators
+    (the modes of a vibrating object) on the same input, in a single object.
+    The modes are computed by groups, several at once with the processor's
+    vector instructions, and large banks are split over the server's worker
+    threads (see Server.setTaskThreads). Coefficients are computed at the
+    beginning of a buffer, only when a value has changed.
+
+    Frequencies, decays and gains are given as lists of floats or as tables
+    (PyoTableObject), in which case the tables are read again at every buffer,
+    so their content can be modified while the bank is playing. The number of
+    modes is the length of the `freqs` list (or the size of the table).
+    Shorter `decays` and `gains` lists or tables are read circularly.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        input : PyoObject
+            Excitation signal.
+        freqs : list of floats or PyoTableObject
+            Frequencies, in Hz, of the modes. Modes at 0 Hz or above the
+            Nyquist frequency are silent.
+        decays : float, list of floats or PyoTableObject, optional
+            Decay times, in seconds, of the modes, as the `decay` argument
+            of ComplexRes. Defaults to 1.
+        gains : float, list of floats or PyoTableObject, optional
+            Gains of the modes. Defaults to 1.
+        freqscale : float or PyoObject, optional
+            Multiplier applied to all frequencies. Sampled once per buffer.
+            Defaults to 1.
+        decayscale : float or PyoObject, optional
+            Multiplier applied to all decay times. Sampled once per buffer.
+            Defaults to 1.
+
+    .. note::
+
+        A bank of a single mode gives the same output as ComplexRes.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> import random
+    >>> freqs = [100 * (i + 1) * (1 + 0.001 * i * i) for i in range(200)]
+    >>> decays = [2.0 / (1 + 0.02 * i) for i in range(200)]
+    >>> gains = [random.uniform(.2, 1) for i in range(200)]
+    >>> trig = Metro(1).play()
+    >>> exc = TrigEnv(trig, HannTable(), dur=0.003, mul=Noise(.5))
+    >>> bank = ModalBank(exc, freqs, decays, gains, mul=.2).out()
+
+    """
+    def __init__(self, input, freqs, decays=1, gains=1, freqscale=1, decayscale=1, mul=1, add=0):
+        pyoArgsAssert(self, "oOOOO", input, freqscale, decayscale, mul, add)
+        PyoObject.__init__(self, mul, add)
+        self._input = input
+        self._freqs = freqs
+        self._decays = decays
+        self._gains = gains
+        self._freqscale = freqscale
+        self._decayscale = decayscale
+        self._in_fader = InputFader(input)
+        in_fader, freqscale, decayscale, mul, add, lmax = convertArgsToLists(self._in_fader, freqscale, decayscale, mul, add)
+        self._base_objs = [ModalBank_base(wrap(in_fader,i), self._source(freqs, i), self._source(decays, i), self._source(gains, i),
+                                          wrap(freqscale,i), wrap(decayscale,i), wrap(mul,i), wrap(add,i)) for i in range(lmax)]
+
+    def _source(self, x, i):
+        # Lists are shared by all streams, tables are distributed.
+        if isinstance(x, PyoTableObject):
+            return x._base_objs[i % len(x._base_objs)]
+        return x
+
+    def setInput(self, x, fadetime=0.05):
+        """
+        Replace the `input` attribute.
+
+        :Args:
+
+            x : PyoObject
+                New signal to process.
+            fadetime : float, optional
+                Crossfade time between old and new input. Default to 0.05.
+
+        """
+        pyoArgsAssert(self, "oN", x, fadetime)
+        self._input = x
+        self._in_fader.setInput(x, fadetime)
+
+    def setFreqs(self, x):
+        """
+        Replace the `freqs` attribute. Changes the number of modes if the
+        length differs.
+
+        :Args:
+
+            x : list of floats or PyoTableObject
+                New `freqs` attribute.
+
+        """
+        self._freqs = x
+        [obj.setFreqs(self._source(x, i)) for i, obj in enumerate(self._base_objs)]
+
+    def setDecays(self, x):
+        """
+        Replace the `decays` attribute.
+
+        :Args:
+
+            x : float, list of floats or PyoTableObject
+                New `decays` attribute.
+
+        """
+        self._decays = x
+        [obj.setDecays(self._source(x, i)) for i, obj in enumerate(self._base_objs)]
+
+    def setGains(self, x):
+        """
+        Replace the `gains` attribute.
+
+        :Args:
+
+            x : float, list of floats or PyoTableObject
+                New `gains` attribute.
+
+        """
+        self._gains = x
+        [obj.setGains(self._source(x, i)) for i, obj in enumerate(self._base_objs)]
+
+    def setFreqScale(self, x):
+        """
+        Replace the `freqscale` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `freqscale` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._freqscale = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setFreqScale(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setDecayScale(self, x):
+        """
+        Replace the `decayscale` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `decayscale` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._decayscale = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setDecayScale(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def reset(self):
+        """
+        Silences all modes immediately.
+
+        """
+        [obj.reset() for obj in self._base_objs]
+
+    def getNumModes(self):
+        """
+        Returns the number of modes of the bank.
+
+        """
+        return self._base_objs[0].getNumModes()
+
+    def ctrl(self, map_list=None, title=None, wxnoserver=False):
+        self._map_list = [SLMap(0.25, 4, "log", "freqscale", self._freqscale),
+                          SLMap(0.01, 10, "log", "decayscale", self._decayscale),
+                          SLMapMul(self._mul)]
+        PyoObject.ctrl(self, map_list, title, wxnoserver)
+
+    @property
+    def input(self):
+        """PyoObject. Excitation signal."""
+        return self._input
+    @input.setter
+    def input(self, x): self.setInput(x)
+
+    @property
+    def freqs(self):
+        """list of floats or PyoTableObject. Frequencies of the modes."""
+        return self._freqs
+    @freqs.setter
+    def freqs(self, x): self.setFreqs(x)
+
+    @property
+    def decays(self):
+        """float, list of floats or PyoTableObject. Decay times of the modes."""
+        return self._decays
+    @decays.setter
+    def decays(self, x): self.setDecays(x)
+
+    @property
+    def gains(self):
+        """float, list of floats or PyoTableObject. Gains of the modes."""
+        return self._gains
+    @gains.setter
+    def gains(self, x): self.setGains(x)
+
+    @property
+    def freqscale(self):
+        """float or PyoObject. Multiplier of the frequencies."""
+        return self._freqscale
+    @freqscale.setter
+    def freqscale(self, x): self.setFreqScale(x)
+
+    @property
+    def decayscale(self):
+        """float or PyoObject. Multiplier of the decay times."""
+        return self._decayscale
+    @decayscale.setter
+    def decayscale(self, x): self.setDecayScale(x)
@@ -1264,4 +1264,121 @@ class CvlVerb(PyoObject):
         """float or PyoObject. Wet / dry balance."""
         return self._bal
     @bal.setter
-    def bal(self, x): self.setBal(x)
\ No newline at end of file
+    def bal(self, x): self.setBal(x)
+
+class CvlMatrix(PyoObject):
+    """
+    Multichannel convolution based reverb.
+
+    CvlMatrix convolves every channel of its input with an impulse response
+    for each output channel (true-stereo or matrix reverbs). Each input
+    channel is transformed only once per partition and its spectrum is
+    multiplied against the spectra of all its impulse responses. Each output
+    is accumulated in the frequency domain and needs a single inverse
+    transform. A true-stereo reverb costs about half as much as the four
+    CvlVerb objects needed to build it, and the saving grows with larger
+    matrices.
+
+    The impulse soundfile must contain one channel per input/output pair.
+    Channel `i * outs + o` is the response from input channel `i` to output
+    channel `o`, so a four channels true-stereo impulse is ordered LL, LR,
+    RL, RR. If the file has less channels than needed, the channels wrap
+    around.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        input : PyoObject
+            Input signal to process. Each stream of the object is an input
+            channel of the matrix.
+        impulse : string, optional
+            Path to the impulse response soundfile. The file must have the same
+            sampling rate as the server to get the proper convolution. Available at
+            initialization time only. Defaults to 'IRMediumHallStereo.wav', located
+            in pyolib SNDS_PATH folder.
+        outs : int, optional
+            Number of output channels. Available at initialization time only.
+            Defaults to 2.
+        bal : float or PyoObject, optional
+            Balance between wet and dry signal, between 0 and 1. 0 means no
+            reverb. The dry signal of output `o` is input channel `o`, wrapping
+            around if there is less inputs than outputs. Defaults to 0.25.
+        size : int {pow-of-two}, optional
+            The size in samples of each partition of the impulse file. Small size means
+            smaller latency but more computation time. If not a power-of-2, the object
+            will find the next power-of-2 greater and use that as the actual partition size.
+            This value must also be greater or equal than the server's buffer size.
+            Available at initialization time only. Defaults to 1024.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> sf = SfPlayer(SNDS_PATH+"/transparent.aif", loop=True, mul=0.5)
+    >>> src = Pan(sf, outs=2, pan=Sine(.1, mul=.5, add=.5))
+    >>> cv = CvlMatrix(src, SNDS_PATH+"/IRMediumHallStereo.wav", outs=2, bal=0.4).out()
+
+    """
+    def __init__(self, input, impulse=SNDS_PATH+"/IRMediumHallStereo.wav", outs=2, bal=0.25, size=1024, mul=1, add=0):
+        pyoArgsAssert(self, "osIOIOO", input, impulse, outs, bal, size, mul, add)
+        PyoObject.__init__(self, mul, add)
+        self._input = input
+        self._impulse = impulse
+        self._outs = outs
+        self._bal = bal
+        self._size = size
+        self._in_fader = InputFader(input)
+        mul, add, lmax = convertArgsToLists(mul, add)
+        self._base_players = [CvlMatrixMain_base(self._in_fader.getBaseObjects(), impulse, outs, bal, size)]
+        self._base_objs = [CvlMatrix_base(self._base_players[0], i, wrap(mul,i), wrap(add,i)) for i in range(outs)]
+
+    def setInput(self, x, fadetime=0.05):
+        """
+        Replace the `input` attribute.
+
+        The new input should have the same number of channels than the
+        original one.
+
+        :Args:
+
+            x : PyoObject
+                New signal to process.
+            fadetime : float, optional
+                Crossfade time between old and new input. Default to 0.05.
+
+        """
+        pyoArgsAssert(self, "oN", x, fadetime)
+        self._input = x
+        self._in_fader.setInput(x, fadetime)
+
+    def setBal(self, x):
+        """
+        Replace the `bal` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                new `bal` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._bal = x
+        [obj.setBal(x) for obj in self._base_players]
+
+    def ctrl(self, map_list=None, title=None, wxnoserver=False):
+        self._map_list = [SLMap(0., 1., "lin", "bal", self._bal),
+                          SLMapMul(self._mul)]
+        PyoObject.ctrl(self, map_list, title, wxnoserver)
+
+    @property
+    def input(self):
+        """PyoObject. Input signal to process."""
+        return self._input
+    @input.setter
+    def input(self, x): self.setInput(x)
+
+    @property
+    def bal(self):
+        """float or PyoObject. Wet / dry balance."""
+        return self._bal
+    @bal.setter
+    def bal(self, x): self.setBal(x)
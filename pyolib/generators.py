@@ -323,6 +323,70 @@ class Input(PyoObject):
         self._map_list = [SLMapMul(self._mul)]
         PyoObject.ctrl(self, map_list, title, wxnoserver)
 
+class BusIn(PyoObject):
+    """
+    Read the sum of the signals sent to an aux bus.
+
+    Any PyoObject can accumulate its samples into a server bus with its
+    `send` method. BusIn outputs the sum of these sends, which makes aux
+    sends (reverb, delay, etc.) cheaper than a Mix or an arithmetic
+    expression for each destination.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        bus : int, optional
+            Bus to read from. Defaults to 0.
+
+    .. note::
+
+        The bus is read when the BusIn object computes, so it must be
+        created after the objects sending to it to get the sum of the
+        current buffer.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> a = SfPlayer(SNDS_PATH + "/transparent.aif", loop=True, mul=.3).mix(2).out()
+    >>> b = FM(carrier=[99,100], ratio=.4987, index=8, mul=.1).out()
+    >>> a.send(bus=0, gain=.5)
+    >>> b.send(bus=0, gain=.2)
+    >>> rev = STRev(BusIn([0,1]), inpos=[0,1], revtime=2, bal=1).out()
+
+    """
+    def __init__(self, bus=0, mul=1, add=0):
+        pyoArgsAssert(self, "iOO", bus, mul, add)
+        PyoObject.__init__(self, mul, add)
+        self._bus = bus
+        bus, mul, add, lmax = convertArgsToLists(bus, mul, add)
+        self._base_objs = [BusIn_base(wrap(bus,i), wrap(mul,i), wrap(add,i)) for i in range(lmax)]
+
+    def setBus(self, x):
+        """
+        Replace the `bus` attribute.
+
+        :Args:
+
+            x : int
+                New `bus` attribute.
+
+        """
+        pyoArgsAssert(self, "i", x)
+        self._bus = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setBus(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def ctrl(self, map_list=None, title=None, wxnoserver=False):
+        self._map_list = [SLMapMul(self._mul)]
+        PyoObject.ctrl(self, map_list, title, wxnoserver)
+
+    @property
+    def bus(self):
+        """int. Bus to read from."""
+        return self._bus
+    @bus.setter
+    def bus(self, x): self.setBus(x)
+
 class Noise(PyoObject):
     """
     A white noise generator.
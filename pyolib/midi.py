@@ -1329,3 +1329,441 @@ class RawMidi(PyoObject):
     @function.setter
     def function(self, x):
         self.setFunction(x)
+
+class Noteout(PyoObject):
+    """
+    Sends Midi notes from pitch and velocity signals.
+
+    A note on is sent each time the velocity becomes greater than 0, or
+    when the pitch changes while a note is sounding (the previous note is
+    then turned off). The velocity of the note is the one of its first
+    sample, later velocity changes are ignored. A note off is sent when the
+    velocity falls back to 0. The signals are scanned sample by sample and
+    the midi messages are timestamped from their position in the buffer,
+    then sent by the server's midi output thread. The timing is
+    sample-accurate and doesn't depend on Python.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        pitch : PyoObject
+            Midi pitch, rounded to the nearest integer.
+        velocity : PyoObject
+            Normalized velocity, between 0 and 1.
+        channel : int, optional
+            Midi channel, 1 to 16. 0 means channel 1. Defaults to 0.
+
+    .. note::
+
+        A midi output device must be opened by the server (see
+        `Server.setMidiOutputDevice`).
+
+        The out() method is bypassed. Noteout's signal can not be sent
+        to audio outs.
+
+        Noteout has no `mul` and `add` attributes.
+
+    .. seealso::
+
+        :py:class:`Notein`
+
+    >>> s = Server()
+    >>> s.setMidiOutputDevice(99) # opens all devices
+    >>> s.boot()
+    >>> s.start()
+    >>> met = Metro(.125).play()
+    >>> pit = TrigChoice(met, [60, 62, 64, 67, 69])
+    >>> vel = TrigEnv(met, LinTable([(0,.8),(4000,.8),(4001,0),(8192,0)]), dur=.125)
+    >>> notes = Noteout(pit, vel)
+
+    """
+    def __init__(self, pitch, velocity, channel=0):
+        pyoArgsAssert(self, "ooi", pitch, velocity, channel)
+        PyoObject.__init__(self)
+        self._pitch = pitch
+        self._velocity = velocity
+        self._channel = channel
+        pitch, velocity, channel, lmax = convertArgsToLists(pitch, velocity, channel)
+        self._base_objs = [Noteout_base(wrap(pitch,i), wrap(velocity,i), wrap(channel,i)) for i in range(lmax)]
+
+    def out(self, chnl=0, inc=1, dur=0, delay=0):
+        return self.play(dur, delay)
+
+    def setMul(self, x):
+        pass
+
+    def setAdd(self, x):
+        pass
+
+    def setSub(self, x):
+        pass
+
+    def setDiv(self, x):
+        pass
+
+    def setChannel(self, x):
+        """
+        Replace the `channel` attribute.
+
+        :Args:
+
+            x : int
+                new `channel` attribute.
+
+        """
+        pyoArgsAssert(self, "i", x)
+        self._channel = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setChannel(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    @property
+    def channel(self):
+        """int. Midi channel."""
+        return self._channel
+    @channel.setter
+    def channel(self, x): self.setChannel(x)
+
+class Ctlout(PyoObject):
+    """
+    Sends Midi control changes from a signal.
+
+    The input signal is rescaled from [minscale, maxscale] to [0, 127] and
+    a control change is sent each time the integer value changes. The
+    messages are timestamped from their position in the buffer and sent by
+    the server's midi output thread.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        input : PyoObject
+            Input signal.
+        ctlnumber : int
+            Controller number.
+        minscale : float, optional
+            Input value giving a controller value of 0. Defaults to 0.
+        maxscale : float, optional
+            Input value giving a controller value of 127. Defaults to 1.
+        channel : int, optional
+            Midi channel, 1 to 16. 0 means channel 1. Defaults to 0.
+
+    .. note::
+
+        A midi output device must be opened by the server (see
+        `Server.setMidiOutputDevice`).
+
+        The out() method is bypassed. Ctlout's signal can not be sent
+        to audio outs.
+
+        Ctlout has no `mul` and `add` attributes.
+
+    .. seealso::
+
+        :py:class:`Midictl`
+
+    >>> s = Server()
+    >>> s.setMidiOutputDevice(99) # opens all devices
+    >>> s.boot()
+    >>> s.start()
+    >>> lfo = Sine(.25, mul=.5, add=.5)
+    >>> ctl = Ctlout(lfo, ctlnumber=7)
+
+    """
+    def __init__(self, input, ctlnumber, minscale=0, maxscale=1, channel=0):
+        pyoArgsAssert(self, "oinni", input, ctlnumber, minscale, maxscale, channel)
+        PyoObject.__init__(self)
+        self._input = input
+        self._ctlnumber = ctlnumber
+        self._minscale = minscale
+        self._maxscale = maxscale
+        self._channel = channel
+        self._in_fader = InputFader(input)
+        in_fader, ctlnumber, minscale, maxscale, channel, lmax = convertArgsToLists(self._in_fader, ctlnumber, minscale, maxscale, channel)
+        self._base_objs = [Ctlout_base(wrap(in_fader,i), wrap(ctlnumber,i), wrap(minscale,i), wrap(maxscale,i), wrap(channel,i)) for i in range(lmax)]
+
+    def out(self, chnl=0, inc=1, dur=0, delay=0):
+        return self.play(dur, delay)
+
+    def setMul(self, x):
+        pass
+
+    def setAdd(self, x):
+        pass
+
+    def setSub(self, x):
+        pass
+
+    def setDiv(self, x):
+        pass
+
+    def setInput(self, x, fadetime=0.05):
+        """
+        Replace the `input` attribute.
+
+        :Args:
+
+            x : PyoObject
+                New signal to process.
+            fadetime : float, optional
+                Crossfade time between old and new input. Defaults to 0.05.
+
+        """
+        pyoArgsAssert(self, "oN", x, fadetime)
+        self._input = x
+        self._in_fader.setInput(x, fadetime)
+
+    def setCtlNumber(self, x):
+        """
+        Replace the `ctlnumber` attribute.
+
+        :Args:
+
+            x : int
+                new `ctlnumber` attribute.
+
+        """
+        pyoArgsAssert(self, "i", x)
+        self._ctlnumber = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setCtlNumber(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setMinScale(self, x):
+        """
+        Replace the `minscale` attribute.
+
+        :Args:
+
+            x : float
+                new `minscale` attribute.
+
+        """
+        pyoArgsAssert(self, "n", x)
+        self._minscale = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setMinScale(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setMaxScale(self, x):
+        """
+        Replace the `maxscale` attribute.
+
+        :Args:
+
+            x : float
+                new `maxscale` attribute.
+
+        """
+        pyoArgsAssert(self, "n", x)
+        self._maxscale = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setMaxScale(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setChannel(self, x):
+        """
+        Replace the `channel` attribute.
+
+        :Args:
+
+            x : int
+                new `channel` attribute.
+
+        """
+        pyoArgsAssert(self, "i", x)
+        self._channel = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setChannel(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    @property
+    def input(self):
+        """PyoObject. Input signal."""
+        return self._input
+    @input.setter
+    def input(self, x): self.setInput(x)
+
+    @property
+    def ctlnumber(self):
+        """int. Controller number."""
+        return self._ctlnumber
+    @ctlnumber.setter
+    def ctlnumber(self, x): self.setCtlNumber(x)
+
+    @property
+    def minscale(self):
+        """float. Input value giving 0."""
+        return self._minscale
+    @minscale.setter
+    def minscale(self, x): self.setMinScale(x)
+
+    @property
+    def maxscale(self):
+        """float. Input value giving 127."""
+        return self._maxscale
+    @maxscale.setter
+    def maxscale(self, x): self.setMaxScale(x)
+
+    @property
+    def channel(self):
+        """int. Midi channel."""
+        return self._channel
+    @channel.setter
+    def channel(self, x): self.setChannel(x)
+
+class Bendout(PyoObject):
+    """
+    Sends Midi pitch bend messages from a signal.
+
+    A pitch bend message is sent each time the 14-bit value computed from
+    the input signal changes. The messages are timestamped from their
+    position in the buffer and sent by the server's midi output thread.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        input : PyoObject
+            Input signal, in semitones (scale=0) or as a transposition
+            factor (scale=1).
+        brange : float, optional
+            Bending range, in semitones, of the receiver. Defaults to 2.
+        scale : int {0, 1}, optional
+            Input format. 0 means semitones, between -brange and brange,
+            1 means a transposition factor. Defaults to 0.
+        channel : int, optional
+            Midi channel, 1 to 16. 0 means channel 1. Defaults to 0.
+
+    .. note::
+
+        A midi output device must be opened by the server (see
+        `Server.setMidiOutputDevice`).
+
+        The out() method is bypassed. Bendout's signal can not be sent
+        to audio outs.
+
+        Bendout has no `mul` and `add` attributes.
+
+    .. seealso::
+
+        :py:class:`Bendin`
+
+    >>> s = Server()
+    >>> s.setMidiOutputDevice(99) # opens all devices
+    >>> s.boot()
+    >>> s.start()
+    >>> vib = Sine(5, mul=.25)
+    >>> bend = Bendout(vib, brange=2)
+
+    """
+    def __init__(self, input, brange=2, scale=0, channel=0):
+        pyoArgsAssert(self, "onii", input, brange, scale, channel)
+        PyoObject.__init__(self)
+        self._input = input
+        self._brange = brange
+        self._scale = scale
+        self._channel = channel
+        self._in_fader = InputFader(input)
+        in_fader, brange, scale, channel, lmax = convertArgsToLists(self._in_fader, brange, scale, channel)
+        self._base_objs = [Bendout_base(wrap(in_fader,i), wrap(brange,i), wrap(scale,i), wrap(channel,i)) for i in range(lmax)]
+
+    def out(self, chnl=0, inc=1, dur=0, delay=0):
+        return self.play(dur, delay)
+
+    def setMul(self, x):
+        pass
+
+    def setAdd(self, x):
+        pass
+
+    def setSub(self, x):
+        pass
+
+    def setDiv(self, x):
+        pass
+
+    def setInput(self, x, fadetime=0.05):
+        """
+        Replace the `input` attribute.
+
+        :Args:
+
+            x : PyoObject
+                New signal to process.
+            fadetime : float, optional
+                Crossfade time between old and new input. Defaults to 0.05.
+
+        """
+        pyoArgsAssert(self, "oN", x, fadetime)
+        self._input = x
+        self._in_fader.setInput(x, fadetime)
+
+    def setBrange(self, x):
+        """
+        Replace the `brange` attribute.
+
+        :Args:
+
+            x : float
+                new `brange` attribute.
+
+        """
+        pyoArgsAssert(self, "n", x)
+        self._brange = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setBrange(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setScale(self, x):
+        """
+        Replace the `scale` attribute.
+
+        :Args:
+
+            x : int {0, 1}
+                new `scale` attribute.
+
+        """
+        pyoArgsAssert(self, "i", x)
+        self._scale = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setScale(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setChannel(self, x):
+        """
+        Replace the `channel` attribute.
+
+        :Args:
+
+            x : int
+                new `channel` attribute.
+
+        """
+        pyoArgsAssert(self, "i", x)
+        self._channel = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setChannel(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    @property
+    def input(self):
+        """PyoObject. Input signal."""
+        return self._input
+    @input.setter
+    def input(self, x): self.setInput(x)
+
+    @property
+    def brange(self):
+        """float. Bending range in semitones."""
+        return self._brange
+    @brange.setter
+    def brange(self, x): self.setBrange(x)
+
+    @property
+    def scale(self):
+        """int. Input format."""
+        return self._scale
+    @scale.setter
+    def scale(self, x): self.setScale(x)
+
+    @property
+    def channel(self):
+        """int. Midi channel."""
+        return self._channel
+    @channel.setter
+    def channel(self, x): self.setChannel(x)
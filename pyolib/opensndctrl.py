@@ -61,6 +61,17 @@ class OscSend(PyoObject):
         host : string, optional
             IP address of the target computer. The default, '127.0.0.1',
             is the localhost.
+        changes : boolean, optional
+            If True, a value is sent only if it differs from the last
+            one sent. Defaults to False.
+        maxrate : float, optional
+            Maximum number of messages per second for each stream. If
+            values come faster, only the most recent one is sent. 0 means
+            no limit. Defaults to 0.
+        bundle : boolean, optional
+            If True, messages for the same destination are grouped in OSC
+            bundles. If False, every message is sent on its own, for
+            receivers that don't understand bundles. Defaults to True.
 
     .. note::
 
@@ -69,19 +80,33 @@ class OscSend(PyoObject):
 
         OscSend has no `mul` and `add` attributes.
 
+        Values are not sent from the audio callback. They are queued and
+        a network thread sends them, grouping the messages for the same
+        destination in OSC bundles of at most 1452 bytes (one UDP datagram
+        on an ethernet network). Use getStats() to monitor the traffic.
+
     >>> s = Server().boot()
     >>> s.start()
     >>> a = Sine(freq=[1,1.5], mul=[100,.1], add=[600, .1])
     >>> b = OscSend(a, port=10001, address=['/pitch','/amp'])
 
     """
-    def __init__(self, input, port, address, host="127.0.0.1"):
-        pyoArgsAssert(self, "oiss", input, port, address, host)
+    def __init__(self, input, port, address, host="127.0.0.1", changes=False, maxrate=0, bundle=True):
+        pyoArgsAssert(self, "oissBNB", input, port, address, host, changes, maxrate, bundle)
         PyoObject.__init__(self)
         self._input = input
+        self._changes = changes
+        self._maxrate = maxrate
+        self._bundle = bundle
         self._in_fader = InputFader(input)
         in_fader, port, address, host, lmax = convertArgsToLists(self._in_fader, port, address, host)
         self._base_objs = [OscSend_base(wrap(in_fader,i), wrap(port,i), wrap(address,i), wrap(host,i)) for i in range(lmax)]
+        if changes:
+            [obj.setChanges(changes) for obj in self._base_objs]
+        if maxrate > 0:
+            [obj.setMaxRate(maxrate) for obj in self._base_objs]
+        if not bundle:
+            [obj.setBundle(bundle) for obj in self._base_objs]
 
     def setInput(self, x, fadetime=0.05):
         """
@@ -122,6 +147,61 @@ class OscSend(PyoObject):
         pyoArgsAssert(self, "I", x)
         [obj.setBufferRate(x) for obj in self._base_objs]
 
+    def setChanges(self, x):
+        """
+        Replace the `changes` attribute.
+
+        :Args:
+
+            x : boolean
+                If True, only values that differ from the last sent one
+                are sent.
+
+        """
+        pyoArgsAssert(self, "B", x)
+        self._changes = x
+        [obj.setChanges(x) for obj in self._base_objs]
+
+    def setMaxRate(self, x):
+        """
+        Replace the `maxrate` attribute.
+
+        :Args:
+
+            x : float
+                Maximum number of messages per second for each stream.
+                0 means no limit.
+
+        """
+        pyoArgsAssert(self, "N", x)
+        self._maxrate = x
+        [obj.setMaxRate(x) for obj in self._base_objs]
+
+    def setBundle(self, x):
+        """
+        Replace the `bundle` attribute.
+
+        :Args:
+
+            x : boolean
+                If True, messages are grouped in OSC bundles.
+
+        """
+        pyoArgsAssert(self, "B", x)
+        self._bundle = x
+        [obj.setBundle(x) for obj in self._base_objs]
+
+    def getStats(self):
+        """
+        Returns, for each stream, a tuple (sent, coalesced, dropped).
+
+        `sent` is the number of messages sent on the network, `coalesced`
+        the number of values replaced by a newer one before being sent
+        and `dropped` the number of values lost because the queue was full.
+
+        """
+        return [obj.getStats() for obj in self._base_objs]
+
     @property
     def input(self):
         """PyoObject. Input signal."""
@@ -129,6 +209,27 @@ class OscSend(PyoObject):
     @input.setter
     def input(self, x): self.setInput(x)
 
+    @property
+    def changes(self):
+        """boolean. Send only values that changed."""
+        return self._changes
+    @changes.setter
+    def changes(self, x): self.setChanges(x)
+
+    @property
+    def maxrate(self):
+        """float. Maximum number of messages per second."""
+        return self._maxrate
+    @maxrate.setter
+    def maxrate(self, x): self.setMaxRate(x)
+
+    @property
+    def bundle(self):
+        """boolean. Group messages in OSC bundles."""
+        return self._bundle
+    @bundle.setter
+    def bundle(self, x): self.setBundle(x)
+
 class OscReceive(PyoObject):
     """
     Receives values over a network via the Open Sound Control protocol.
@@ -336,6 +437,10 @@ class OscDataSend(PyoObject):
         host : string, optional
             IP address of the target computer. The default, '127.0.0.1',
             is the localhost.
+        bundle : boolean, optional
+            If True, messages for the same destination are grouped in OSC
+            bundles of at most 1452 bytes. If False, every message is sent
+            on its own. Defaults to True.
 
     .. note::
 
@@ -363,11 +468,14 @@ class OscDataSend(PyoObject):
     >>> c.send(msg)
 
     """
-    def __init__(self, types, port, address, host="127.0.0.1"):
-        pyoArgsAssert(self, "siss", types, port, address, host)
+    def __init__(self, types, port, address, host="127.0.0.1", bundle=True):
+        pyoArgsAssert(self, "sissB", types, port, address, host, bundle)
         PyoObject.__init__(self)
+        self._bundle = bundle
         types, port, address, host, lmax = convertArgsToLists(types, port, address, host)
         self._base_objs = [OscDataSend_base(wrap(types,i), wrap(port,i), wrap(address,i), wrap(host,i)) for i in range(lmax)]
+        if not bundle:
+            [obj.setBundle(bundle) for obj in self._base_objs]
         self._addresses = {}
         for i, adr in enumerate(address):
             self._addresses[adr] = self._base_objs[i]
@@ -388,6 +496,32 @@ class OscDataSend(PyoObject):
         """
         return self._addresses.keys()
 
+    def getStats(self):
+        """
+        Returns a dictionary of (sent, coalesced, dropped) tuples, one per address.
+
+        Messages are sent by a network thread, at the buffer following the
+        call to send(). `coalesced` counts messages replaced by a newer one
+        during the same buffer and `dropped` the messages lost because the
+        queue was full.
+
+        """
+        return dict([(adr, obj.getStats()) for adr, obj in self._addresses.items()])
+
+    def setBundle(self, x):
+        """
+        Replace the `bundle` attribute.
+
+        :Args:
+
+            x : boolean
+                If True, messages are grouped in OSC bundles.
+
+        """
+        pyoArgsAssert(self, "B", x)
+        self._bundle = x
+        [obj.setBundle(x) for obj in self._base_objs]
+
     def addAddress(self, types, port, address, host="127.0.0.1"):
         """
         Adds new address(es) to the object's handler.
@@ -419,6 +553,8 @@ class OscDataSend(PyoObject):
         pyoArgsAssert(self, "siss", types, port, address, host)
         types, port, address, host, lmax = convertArgsToLists(types, port, address, host)
         objs = [OscDataSend_base(wrap(types,i), wrap(port,i), wrap(address,i), wrap(host,i)) for i in range(lmax)]
+        if not self._bundle:
+            [obj.setBundle(self._bundle) for obj in objs]
         self._base_objs.extend(objs)
         for i, adr in enumerate(address):
             self._addresses[adr] = objs[i]
@@ -461,6 +597,13 @@ class OscDataSend(PyoObject):
             pyoArgsAssert(self, "lS", msg, address)
             self._addresses[address].send(msg)
 
+    @property
+    def bundle(self):
+        """boolean. Group messages in OSC bundles."""
+        return self._bundle
+    @bundle.setter
+    def bundle(self, x): self.setBundle(x)
+
 class OscDataReceive(PyoObject):
     """
     Receives data values over a network via the Open Sound Control protocol.
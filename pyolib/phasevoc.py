@@ -2168,4 +2168,155 @@ class PVMix(PyoPVObject):
         """PyoPVObject. Phase vocoder streaming object 2."""
         return self._input2
     @input2.setter
-    def input2(self, x): self.setInput2(x)
\ No newline at end of file
+    def input2(self, x): self.setInput2(x)
+
+class PVRead(PyoPVObject):
+    """
+    Phase vocoder analysis file player.
+
+    PVRead plays back a file created by the `pvanalysis` function. The
+    frames (bin's magnitudes and true frequencies), analyzed offline, are
+    loaded in memory when the object is created and sent directly as a
+    phase vocoder stream, so the same sound can be used by many PVxxx
+    objects without running the analysis again. The FFT size and the number
+    of overlaps of the stream are those of the file.
+
+    Between two frames, magnitudes are linearly interpolated and true
+    frequencies are taken from the nearest frame.
+
+    If the file was analyzed at a different sampling rate than the server's,
+    a warning is printed and the frames are still read at the analysis rate,
+    so the duration and the pitch are kept. Partials above the server's
+    nyquist frequency will alias.
+
+    :Parent: :py:class:`PyoPVObject`
+
+    :Args:
+
+        path : string
+            Full path of the analysis file created by `pvanalysis`.
+        speed : float or PyoObject, optional
+            Reading speed, 1 reads the frames at the analysis rate, 0
+            freezes the current frame and negative values read backward.
+            Defaults to 1.
+        loop : boolean, optional
+            If True, the reading position wraps around the ends of the
+            file. Otherwise, silence is output outside of the file.
+            Defaults to False.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> import os
+    >>> pvfile = os.path.join(os.path.expanduser('~'), 'transparent.pvf')
+    >>> frames, rate = pvanalysis(SNDS_PATH+'/transparent.aif', pvfile, size=1024, olaps=4)
+    >>> pvr = PVRead(pvfile, speed=Sine(.1, mul=.5, add=.5), loop=True)
+    >>> pvs = PVSynth(pvr).out()
+
+    """
+    def __init__(self, path, speed=1.0, loop=False):
+        pyoArgsAssert(self, "sOb", path, speed, loop)
+        PyoPVObject.__init__(self)
+        self._path = path
+        self._speed = speed
+        self._loop = loop
+        path, speed, loop, lmax = convertArgsToLists(path, speed, loop)
+        self._base_objs = [PVRead_base(wrap(path,i), wrap(speed,i), wrap(loop,i)) for i in range(lmax)]
+
+    def setSpeed(self, x):
+        """
+        Replace the `speed` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                new `speed` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._speed = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setSpeed(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setLoop(self, x):
+        """
+        Replace the `loop` attribute.
+
+        :Args:
+
+            x : boolean
+                new `loop` attribute.
+
+        """
+        pyoArgsAssert(self, "b", x)
+        self._loop = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setLoop(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setPosition(self, x):
+        """
+        Move the reading position.
+
+        :Args:
+
+            x : float
+                New position, in seconds from the beginning of the sound.
+
+        """
+        pyoArgsAssert(self, "n", x)
+        x, lmax = convertArgsToLists(x)
+        [obj.setPosition(wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def getPosition(self, all=False):
+        """
+        Return the current reading position, in seconds.
+
+        :Args:
+
+            all : boolean, optional
+                If True, returns the position of every stream in a list.
+                Otherwise, returns the position of the first one.
+                Defaults to False.
+
+        """
+        pyoArgsAssert(self, "B", all)
+        if all:
+            return [obj.getPosition() for obj in self._base_objs]
+        return self._base_objs[0].getPosition()
+
+    def getInfo(self):
+        """
+        Return the analysis parameters of the file(s).
+
+        Returns a dictionary with keys 'size', 'olaps', 'numframes', 'sr'
+        (sampling rate of the analyzed sound) and 'dur' (duration of the
+        sound, in seconds), or a list of dictionaries if the object reads
+        more than one file.
+
+        """
+        info = [obj.getInfo() for obj in self._base_objs]
+        if len(info) == 1:
+            return info[0]
+        return info
+
+    def ctrl(self, map_list=None, title=None, wxnoserver=False):
+        self._map_list = [SLMap(-2, 2, "lin", "speed", self._speed)]
+        PyoPVObject.ctrl(self, map_list, title, wxnoserver)
+
+    @property
+    def path(self):
+        """string. Analysis file. Available at initialization time only."""
+        return self._path
+
+    @property
+    def speed(self):
+        """float or PyoObject. Reading speed."""
+        return self._speed
+    @speed.setter
+    def speed(self, x): self.setSpeed(x)
+
+    @property
+    def loop(self):
+        """boolean. Looping mode."""
+        return self._loop
+    @loop.setter
+    def loop(self, x): self.setLoop(x)
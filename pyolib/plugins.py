@@ -0,0 +1,208 @@
+"""
+Native DSP plugins loaded at runtime.
+
+A plugin is a shared library, compiled against include/pyoplugin.h only,
+which exposes a processing kernel, a parameter schema and the size of its
+state. `loadPlugin` opens the library and returns a new PyoObject class
+whose instances run the kernel in the audio graph, like the built-in
+objects. See externals/pluginmodule-template.c for a commented example.
+
+"""
+
+"""
+Copyright 2009-2015 Olivier Belanger
+
+This file is part of pyo, a python module to help digital signal
+processing script creation.
+
+pyo is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+pyo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with pyo.  If not, see <http://www.gnu.org/licenses/>.
+"""
+import os
+from _core import *
+from _maps import *
+
+class PyoPlugin(PyoObject):
+    """
+    Base class of the objects created by `loadPlugin`.
+
+    A plugin class takes its audio inputs as positional arguments, followed
+    by its parameters, which can also be given by keyword. Every parameter
+    accepts a float or a PyoObject and gets a `setName` method and a `name`
+    attribute. Lists given as arguments create one instance of the kernel
+    per stream, as for any PyoObject.
+
+    The user should never instantiate this class directly.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        *inputs : PyoObject
+            Audio inputs of the plugin, as many as declared by the plugin.
+        *params : float or PyoObject, optional
+            Parameters of the plugin, in the declared order (or by keyword).
+            Default to the values declared by the plugin.
+        mul : float or PyoObject, optional
+            Multiplication factor. Defaults to 1.
+        add : float or PyoObject, optional
+            Addition factor. Defaults to 0.
+
+    """
+    _lib = None
+    _info = None
+
+    def __init__(self, *args, **kwargs):
+        info = self._info
+        mul = kwargs.pop("mul", 1)
+        add = kwargs.pop("add", 0)
+        pyoArgsAssert(self, "OO", mul, add)
+        PyoObject.__init__(self, mul, add)
+        ninputs, names = info["inputs"], [p[0] for p in info["params"]]
+        if len(args) < ninputs:
+            raise TypeError("%s needs %d audio input(s)." % (self.__class__.__name__, ninputs))
+        if len(args) > ninputs + len(names):
+            raise TypeError("%s takes at most %d parameter(s)." % (self.__class__.__name__, len(names)))
+        for key in kwargs:
+            if key not in names:
+                raise TypeError("%s got an unexpected parameter '%s'." % (self.__class__.__name__, key))
+        self._inputs = list(args[:ninputs])
+        for input in self._inputs:
+            pyoArgsAssert(self, "o", input)
+        self._params = [p[2] for p in info["params"]]
+        for i, value in enumerate(args[ninputs:]):
+            self._params[i] = value
+        for key, value in kwargs.items():
+            self._params[names.index(key)] = value
+        for value in self._params:
+            pyoArgsAssert(self, "O", value)
+        args = convertArgsToLists(*(self._inputs + self._params + [mul, add]))
+        lmax = args[-1]
+        ins = args[:ninputs]
+        params = args[ninputs:ninputs+len(names)]
+        mul, add = args[-3], args[-2]
+        self._base_objs = [Plugin_base(self._lib, [wrap(x,i) for x in ins], [wrap(x,i) for x in params],
+                                       wrap(mul,i), wrap(add,i)) for i in range(lmax)]
+
+    def setInput(self, x, index=0):
+        """
+        Replace an audio input.
+
+        :Args:
+
+            x : PyoObject
+                New signal to process.
+            index : int, optional
+                Index of the input to replace. Defaults to 0.
+
+        """
+        pyoArgsAssert(self, "oI", x, index)
+        self._inputs[index] = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setInput(index, wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def setParam(self, name, x):
+        """
+        Replace a parameter, given by name.
+
+        :Args:
+
+            name : string
+                Name of the parameter.
+            x : float or PyoObject
+                New value of the parameter.
+
+        """
+        pyoArgsAssert(self, "SO", name, x)
+        index = [p[0] for p in self._info["params"]].index(name)
+        self._params[index] = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setParam(index, wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+
+    def getParam(self, name):
+        """
+        Return the current value of a parameter, given by name.
+
+        """
+        return self._params[[p[0] for p in self._info["params"]].index(name)]
+
+    def reset(self):
+        """
+        Reset the internal state of the plugin.
+
+        """
+        [obj.reset() for obj in self._base_objs]
+
+    def ctrl(self, map_list=None, title=None, wxnoserver=False):
+        self._map_list = [SLMap(p[3], p[4], 'lin', p[0], self._params[i]) for i, p in enumerate(self._info["params"])
+                          if p[3] < p[4] and type(self._params[i]) in [IntType, FloatType]]
+        self._map_list.append(SLMapMul(self._mul))
+        PyoObject.ctrl(self, map_list, title, wxnoserver)
+
+def _pluginParamMethods(name, index, doc):
+    def setter(self, x):
+        pyoArgsAssert(self, "O", x)
+        self._params[index] = x
+        x, lmax = convertArgsToLists(x)
+        [obj.setParam(index, wrap(x,i)) for i, obj in enumerate(self._base_objs)]
+    setter.__name__ = "set" + name[0].upper() + name[1:]
+    setter.__doc__ = """
+        Replace the `%s` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                new `%s` attribute.
+
+        """ % (name, name)
+    prop = property(lambda self: self._params[index], lambda self, x: setter(self, x), doc=doc)
+    return setter, prop
+
+def loadPlugin(path):
+    """
+    Load a native DSP plugin and return its class.
+
+    The shared library is opened with dlopen (LoadLibrary on Windows) and
+    its descriptor is checked against the plugin ABI version of pyo. The
+    returned class inherits from :py:class:`PyoPlugin` and is named after
+    the plugin. Its docstring lists the inputs and the parameters.
+
+    The library stays loaded as long as the class or one of its instances
+    exists.
+
+    :Args:
+
+        path : string
+            Path of the shared library.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> SoftLP = loadPlugin("externals/libsoftlp.so")
+    >>> a = SoftLP(Noise(.3), freq=Sine(.2, mul=1000, add=1500), drive=4).out()
+
+    """
+    lib = PluginLib_base(os.path.abspath(os.path.expanduser(path)))
+    info = lib.getInfo()
+    doc = info["doc"] + "\n\n    Native plugin loaded from %s.\n\n    :Parent: :py:class:`PyoPlugin`\n\n" % path
+    doc += "    :Args:\n\n"
+    for i in range(info["inputs"]):
+        doc += "        input%d : PyoObject\n            Audio input.\n" % i
+    for p in info["params"]:
+        doc += "        %s : float or PyoObject, optional\n            %s Defaults to %g (range %g to %g).\n" % \
+               (p[0], p[1], p[2], p[3], p[4])
+    attrs = {"_lib": lib, "_info": info, "__doc__": doc, "__module__": __name__}
+    for index, p in enumerate(info["params"]):
+        setter, prop = _pluginParamMethods(p[0], index, p[1])
+        attrs[setter.__name__] = setter
+        attrs[p[0]] = prop
+    return type(info["name"], (PyoPlugin,), attrs)
@@ -18,8 +18,9 @@ GNU Lesser General Public License for more details.
 You should have received a copy of the GNU Lesser General Public
 License along with pyo.  If not, see <http://www.gnu.org/licenses/>.
 """
-import os, time
+import os, time, threading
 from _core import *
+from _core import _PYO_OBJECTS, _PYO_MEMORY, _baseMemory, _memoryResetPeaks
 from _widgets import createServerGUI
 
 ######################################################################
@@ -118,6 +119,7 @@ class Server(object):
         self._filename = None
         self._fileformat = 0
         self._sampletype = 0
+        _memoryResetPeaks()
         self._server = Server_base(sr, nchnls, buffersize, duplex, audio, jackname, self._ichnls)
         self._server._setDefaultRecPath(os.path.join(os.path.expanduser("~"), "pyo_rec.wav"))
 
@@ -494,6 +496,169 @@ class Server(object):
         self._startoffset = x
         self._server.setStartOffset(x)
 
+    def setRTCheck(self, x):
+        """
+        Activate the real-time violations detector (debugging tool, Linux only).
+
+        While active, every memory allocation and potentially blocking call
+        (file, console or socket i/o, locks, sleeps) made by the audio thread
+        during the processing of a buffer is counted for the object that
+        was computing. Use `getRTViolations` to retrieve the counts.
+
+        The detector is a separate library that must be preloaded. Build it
+        with `scripts/compile_rtcheck_linux.sh`, then start python with
+        `LD_PRELOAD=/path/to/libpyortcheck.so`.
+
+        Stack allocations and calls made within the C library are not seen.
+
+        :Args:
+
+            x : boolean
+                True to activate the detector, False to deactivate it.
+
+        """
+        self._server.setRTCheck(x)
+
+    def setGCIsolation(self, x):
+        """
+        Keep the audio objects out of python's cyclic garbage collector.
+
+        A full collection walks every container object while holding the
+        interpreter lock (GIL), which the audio callback needs to compute a
+        buffer. With thousands of objects alive, the collections can last
+        long enough to cause dropouts.
+
+        When active, the existing pyo objects (with their attribute
+        dictionaries and lists) and the internal objects of every stream
+        loaded in the server are untracked by the collector. The internal
+        objects of the streams created afterward are untracked as they are
+        created, call this method again, once the new part of the graph is
+        built, to also isolate their python objects.
+
+        Isolated objects are still released as usual when they are deleted.
+        Only reference cycles that go through them (e.g. a Pattern whose
+        function refers to the Pattern itself) are no longer broken by the
+        collector, such a cycle must be broken by hand (setting the function
+        to None, for example).
+
+        Deactivating the isolation gives the objects back to the collector.
+
+        :Args:
+
+            x : boolean
+                True to isolate the objects, False to track them again.
+
+        """
+        objs = []
+        for obj in list(_PYO_OBJECTS):
+            objs.extend([obj, obj.__dict__])
+            objs.extend([v for v in obj.__dict__.values() if type(v) in [ListType, TupleType]])
+        self._server.setGCIsolation(x, objs)
+
+    def setRealtime(self, mlock=False, prefault=0, audiocpu=None, workercpus=None, priority=0):
+        """
+        Set the real-time behaviour of the process and of the audio threads.
+
+        The first pass over freshly allocated memory (delay lines, tables,
+        buffers) causes page faults that can make the audio thread miss
+        its deadline. Memory locking keeps every page of the process in
+        RAM and prefaulting touches the pages before the audio thread
+        uses them.
+
+        Should be called before booting the server. The effective settings
+        are printed at boot and returned by `getRealtimeReport()`. The
+        settings that can't be applied (missing privileges, unsupported
+        platform) fall back to the default behaviour. The audio thread
+        settings are applied, by the audio thread itself, on its first
+        buffer. They are ignored by the offline and embedded servers.
+
+        .. note::
+
+            With glibc, prefaulting changes the allocator settings of the
+            whole process, even after the server is shut down: `mallopt`
+            sets M_MMAP_MAX to 0 and M_TRIM_THRESHOLD to -1, so that the
+            objects reuse the prefaulted pages. Large blocks then come from
+            the heap instead of their own mapping, and freed memory is
+            never given back to the system: the resident size of the
+            process doesn't shrink.
+
+        :Args:
+
+            mlock : boolean, optional
+                Lock the current and future memory of the process in RAM
+                (mlockall). Needs the RLIMIT_MEMLOCK limit to be high
+                enough. Defaults to False.
+            prefault : int, optional
+                Size, in MB, of the heap reserve written at boot and kept
+                for the objects' allocations. The output buffer and the
+                work buffers left unwritten by the constructor (calloc'ed
+                task buffers, for example) of each new object are also
+                touched at its creation. Memory allocated beyond the
+                reserve, or by other libraries, is not prefaulted; use
+                `mlock` to cover the whole process. 0 disables prefaulting.
+                Defaults to 0.
+            audiocpu : int, optional
+                Core on which the audio thread is pinned (Linux only).
+                Defaults to None (not pinned).
+            workercpus : list of ints, optional
+                Cores on which the worker threads (see `setTaskThreads`)
+                are pinned, in turn (Linux only). Defaults to None.
+            priority : int, optional
+                SCHED_FIFO priority of the audio thread, the worker threads
+                get priority - 1. If the priority can't be set, the highest
+                one allowed by RLIMIT_RTPRIO is used, then the normal
+                scheduling is kept. 0 leaves the priority to the audio
+                backend. Defaults to 0.
+
+        """
+        if audiocpu is None:
+            audiocpu = -1
+        self._server.setRealtime(int(mlock), prefault, audiocpu, workercpus, priority)
+
+    def getRealtimeReport(self):
+        """
+        Return the effective real-time settings as a dictionary.
+
+        Keys are "mlock" (memory locked), "prefault" (MB of heap
+        prefaulted), "audiocpu" (core of the audio thread, -1 if not
+        pinned), "priority" (SCHED_FIFO priority of the audio thread, 0 if
+        unchanged), "pending" (True until the audio thread has applied its
+        settings), "workercpus" (core of each worker thread) and
+        "workerpriority".
+
+        """
+        return self._server.getRealtimeReport()
+
+    def setTaskThreads(self, x):
+        """
+        Set the number of worker threads shared by the heavy objects.
+
+        Some objects (OscBank, Vocoder) split the work of one buffer into
+        independent tasks (ranges of partials or bands). With worker
+        threads, these tasks are computed in parallel, the audio thread
+        taking a share of the work and waiting for the others to finish
+        before going on with the graph. The partial results are always
+        summed in the same order: the output doesn't depend on the number
+        of threads.
+
+        A good value is the number of cores minus one. 0 (the default)
+        computes every task in the audio thread.
+
+        :Args:
+
+            x : int
+                Number of worker threads, up to 32.
+
+        """
+        self._server.setTaskThreads(x)
+
+    def getTaskThreads(self):
+        """
+        Return the number of worker threads shared by the heavy objects.
+
+        """
+        return self._server.getTaskThreads()
+
     def setAmp(self, x):
         """
         Set the overall amplitude.
@@ -800,6 +965,165 @@ class Server(object):
         """
         return self._server.getStreams()
 
+    def getMemoryReport(self):
+        """
+        Return the native memory used by the living objects and tables.
+
+        The report is a dictionary with these keys:
+
+            total : int
+                Memory, in bytes, used by all objects.
+            peak : int
+                Highest total reached since the server creation.
+            classes : dict
+                For each class name, a dictionary {"count": number of
+                objects, "bytes": memory used, "peak": highest memory seen
+                for this class}. Classes without living objects are kept
+                with their peak.
+            objects : list
+                Tuples (class name, object, bytes), largest objects first.
+
+        Buffers shared between objects are counted once, in the first
+        object found. Streams that don't belong to a python object are
+        reported under the name of their internal class.
+
+        Peaks are updated when objects are created and deleted, and when
+        this method is called. Memory allocated by an object after its
+        creation (a table resized, for example) is seen by this method only.
+
+        """
+        seen = set()
+        classes = {}
+        objects = []
+        for obj in list(_PYO_OBJECTS):
+            bytes = 0
+            for key, mem in _baseMemory(obj):
+                if key not in seen:
+                    seen.add(key)
+                    bytes += mem
+            objects.append((obj.__class__.__name__, obj, bytes))
+        for stream in self._server.getStreams():
+            if ("stream", stream.getId()) not in seen:
+                name = type(stream.getStreamObject()).__name__.replace("_base", "")
+                objects.append((name, stream, stream.getMemory()))
+        for name, obj, bytes in objects:
+            cls = classes.setdefault(name, {"count": 0, "bytes": 0, "peak": 0})
+            cls["count"] += 1
+            cls["bytes"] += bytes
+        total = sum([cls["bytes"] for cls in classes.values()])
+        _PYO_MEMORY["peak"] = max(_PYO_MEMORY["peak"], total)
+        for name, cls in classes.items():
+            peak = _PYO_MEMORY["classes"].setdefault(name, [0, 0])
+            peak[1] = max(peak[1], cls["bytes"])
+            cls["peak"] = peak[1]
+        for name, peak in _PYO_MEMORY["classes"].items():
+            if name not in classes and peak[1] > 0:
+                classes[name] = {"count": 0, "bytes": 0, "peak": peak[1]}
+        objects.sort(key=lambda x: x[2], reverse=True)
+        return {"total": total, "peak": _PYO_MEMORY["peak"], "classes": classes, "objects": objects}
+
+    def getRTViolations(self):
+        """
+        Return the real-time violations counted since the detector was
+        activated (see `setRTCheck`), worst offenders first.
+
+        Each element is a tuple (class name, stream id, counts), where counts
+        is a dictionary whose keys are the kinds of call ("malloc", "free",
+        "file", "print", "socket", "lock", "sleep"). Calls made by the server
+        itself, outside the objects, are reported under "Server".
+
+        """
+        report = [(name.replace("_pyo.", "").replace("_base", ""), id, counts) for name, id, counts in self._server.getRTViolations()]
+        return sorted(report, key=lambda x: sum(x[2].values()), reverse=True)
+
+    def resetRTViolations(self):
+        """
+        Clear the real-time violations counts.
+
+        """
+        self._server.resetRTViolations()
+
+    def traceStart(self, size=65536, period=1, python=False):
+        """
+        Start recording the block timeline.
+
+        Begin and end events are logged, with a monotonic timestamp in
+        microseconds (with fractions), for each buffer computed by the audio
+        callback, for the time the audio thread waits for the python
+        interpreter lock (GIL), for the objects computed in the buffer and
+        for the python functions called from the audio thread (Pattern,
+        TrigFunc, CallAfter, ...). Each thread logs its events in its own
+        ring buffer, without locking. A ring is allocated by the first event
+        of its thread (the first traced buffer for the audio thread) and
+        reused by the next traces. When a ring is full, its oldest events
+        are overwritten.
+
+        Use `traceSave` to write the timeline to a file that can be opened
+        in chrome://tracing or in the Perfetto UI (ui.perfetto.dev).
+
+        :Args:
+
+            size : int, optional
+                Number of events kept per thread, rounded up to a power of
+                two. Can't change while the server is running. Defaults to 65536.
+            period : int, optional
+                The objects are traced every `period` buffers, 0 to trace the
+                audio callback only. Defaults to 1 (every buffer).
+            python : boolean, optional
+                If True, the python function calls of the current thread and
+                of the threads started afterward are traced too, to see how
+                the control threads interleave with the audio callback.
+                Defaults to False.
+
+        """
+        self._server.traceStart(size, period, python)
+        if python:
+            threading.setprofile(self._server.traceProfile)
+
+    def traceStop(self):
+        """
+        Stop recording the block timeline. The events are kept until the next
+        call to `traceStart`.
+
+        """
+        threading.setprofile(None)
+        self._server.traceStop()
+
+    def traceBegin(self, name):
+        """
+        Log the beginning of a user event in the timeline of the current thread.
+
+        :Args:
+
+            name : string
+                Name of the event.
+
+        """
+        self._server.traceBegin(name)
+
+    def traceEnd(self):
+        """
+        Log the end of the last user event started in the current thread.
+
+        """
+        self._server.traceEnd()
+
+    def traceSave(self, filename):
+        """
+        Save the block timeline in the Chrome trace event format (json).
+
+        The file can be opened in chrome://tracing or in the Perfetto UI.
+        Call `traceStop` first, otherwise the oldest events may be overwritten
+        while they are written.
+
+        :Args:
+
+            filename : string
+                Full path of the file to create.
+
+        """
+        self._server.traceSave(filename)
+
     def getSamplingRate(self):
         """
         Return the current sampling rate.
@@ -863,6 +1187,53 @@ class Server(object):
         """
         return len(self._server.getStreams())
 
+    def process(self, input=None, output=None, blocks=None):
+        """
+        Compute blocks of samples in the calling thread.
+
+        The graph is advanced synchronously, without audio device nor
+        file: the samples of `input` are read by the Input objects and the
+        output of the server (what the objects send with out()) is written
+        in `output`. Both are objects exporting the buffer protocol (numpy
+        arrays, ctypes arrays, ...) of C-contiguous float32 or float64
+        samples, shaped (frames,) for a single channel or (frames,
+        channels). Missing channels are silent, extra ones are ignored.
+
+        The whole chunk is computed in one call, without any python code
+        between the blocks. The number of frames is given by `blocks`
+        (blocks * buffersize), or else by the shortest of the arrays. A
+        last, partial, block is computed entirely but only its first
+        frames are written in `output`.
+
+        The server must be booted and not started. The offline server
+        ("offline" audio) is a natural choice, nothing is recorded unless
+        `recstart()` is called.
+
+        :Args:
+
+            input : buffer object, optional
+                Input samples, read by the Input objects. Defaults to None.
+            output : buffer object, optional
+                Preallocated array receiving the output samples.
+                Defaults to None.
+            blocks : int, optional
+                Number of blocks to compute. Defaults to None.
+
+        Returns the number of frames computed.
+
+        >>> import numpy
+        >>> s = Server(sr=48000, nchnls=1, buffersize=256, audio="offline").boot()
+        >>> src = Input(0)
+        >>> f = Biquad(src, freq=1000).out()
+        >>> x = numpy.random.uniform(-1, 1, 48000 * 10).astype(numpy.float32)
+        >>> y = numpy.zeros_like(x)
+        >>> n = s.process(x, y)
+
+        """
+        if blocks is None:
+            blocks = -1
+        return self._server.process(input, output, blocks)
+
     def setServer(self):
         """
         Sets this server as the one to use for new objects when using the embedded device
@@ -24,6 +24,8 @@ from types import ListType
 from math import pi
 import copy
 
+SNDTABLE_PACKINGS = {None: 0, "int16": 1, "int24": 2, "float16": 3}
+
 ######################################################################
 ### Tables
 ######################################################################
@@ -1380,6 +1382,25 @@ class SndTable(PyoTableObject):
             Stops reading at `stop` seconds into the file. Available at
             initialization time only. The default (None) means the end of
             the file.
+        packing : string, optional
+            Storage format of the samples in memory. None (the default) keeps
+            full precision floats. "int16", "int24" and "float16" keep the
+            samples packed, using respectively 2, 3 and 2 bytes per sample.
+
+    .. note::
+
+        Packed samples are decoded, one block at a time, inside Osc, TableRead,
+        Pointer, Looper and Granulator. Any other object reading the table
+        (or writing into it) works on a decoded copy of the whole table,
+        which cancels the memory saving. This copy is made when the object
+        is created, and made again each time the table is packed, never
+        during the audio processing.
+
+        Methods modifying the samples (normalize, reverse, fadein, etc.)
+        decode the table, apply the process and pack the result again.
+
+        "float16" keeps about 11 bits of precision, which is enough for
+        most sound material but adds noise around -66 dB.
 
     >>> s = Server().boot()
     >>> s.start()
@@ -1389,12 +1410,13 @@ class SndTable(PyoTableObject):
     >>> a = Osc(table=t, freq=[freq, freq*.995], mul=.3).out()
 
     """
-    def __init__(self, path=None, chnl=None, start=0, stop=None, initchnls=1):
+    def __init__(self, path=None, chnl=None, start=0, stop=None, initchnls=1, packing=None):
         PyoTableObject.__init__(self)
         self._path = path
         self._chnl = chnl
         self._start = start
         self._stop = stop
+        self._packing = packing
         self._size = []
         self._dur = []
         self._base_objs = []
@@ -1419,6 +1441,24 @@ class SndTable(PyoTableObject):
             if lmax == 1:
                 self._size = self._base_objs[-1].getSize()
                 self._dur = self._size / float(_snd_sr)
+        if packing != None:
+            self.setPacking(packing)
+
+    def setPacking(self, x):
+        """
+        Changes the storage format of the samples in memory.
+
+        :Args:
+
+            x : string
+                None, "int16", "int24" or "float16".
+
+        """
+        if x not in SNDTABLE_PACKINGS:
+            print "SndTable packing must be one of None, 'int16', 'int24' or 'float16'."
+            return
+        self._packing = x
+        [obj.setPacking(SNDTABLE_PACKINGS[x]) for obj in self._base_objs]
 
     def setSound(self, path, start=0, stop=None):
         """
@@ -1734,6 +1774,13 @@ class SndTable(PyoTableObject):
     @size.setter
     def size(self, x): print "SndTable 'size' attribute is read-only."
 
+    @property
+    def packing(self):
+        """string. Storage format of the samples."""
+        return self._packing
+    @packing.setter
+    def packing(self, x): self.setPacking(x)
+
 class NewTable(PyoTableObject):
     """
     Create an empty table ready for recording.
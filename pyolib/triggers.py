@@ -279,6 +279,209 @@ class Seq(PyoObject):
     @seq.setter
     def seq(self, x): self.setSeq(x)
 
+class StepSeq(PyoObject):
+    """
+    Multi-track step sequencer.
+
+    Each track is a list of steps played one after the other, every `time`
+    seconds, and looped. A step holds a note, a velocity, a probability, a
+    micro-timing offset and optional parameter values. All tracks are
+    evaluated sample by sample in a single native object, which replaces
+    chains of Seq, TrigFunc and python callbacks.
+
+    The object outputs one trigger stream per track. A trigger is emitted
+    when a step with a velocity greater than 0 starts and passes its
+    probability test. The note, velocity, step index and parameters of the
+    last triggered step are available, as held values, with the syntax
+    `obj['note']`, `obj['vel']`, `obj['step']`, `obj['param0']`, ...
+
+    The play() method starts the sequencer and is not called at the object
+    creation time.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        tracks : list of lists
+            One list of steps per track. A step can be:
+
+            - None : a rest.
+            - a number : a note with velocity 1, probability 1 and no offset.
+            - a list [note, vel, prob, offset, param0, param1, ...] :
+              missing values default to [0, 1, 1, 0, 0, ...]. `prob` is
+              the probability, between 0 and 1, for the step to trigger.
+              `offset` delays the trigger by a fraction of the step duration
+              (0 to 1).
+
+            The number of tracks is fixed at initialization.
+        time : float or PyoObject, optional
+            Duration of a step in seconds. Defaults to 0.125.
+        params : int, optional
+            Number of free parameter values per step. Available only at
+            initialization. Defaults to 0.
+
+    .. note::
+
+        The out() method is bypassed. StepSeq's signal can not be sent to audio outs.
+
+        StepSeq has no `mul` and `add` attributes.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> env = CosTable([(0,0),(100,1),(1000,.3),(8191,0)])
+    >>> sq = StepSeq([[60, None, 67, [72, .5, .5]], [36, None, None, [36, 1, 1, .5]]], time=.125).play()
+    >>> amp = TrigEnv(sq, table=env, dur=.2, mul=Sig(sq['vel'], mul=.2))
+    >>> a = SineLoop(MToF(sq['note']), feedback=0.05, mul=amp).out()
+
+    """
+    def __init__(self, tracks, time=0.125, params=0):
+        pyoArgsAssert(self, "lOI", tracks, time, params)
+        PyoObject.__init__(self)
+        self._time = time
+        self._params = params
+        self._tracks = [list(steps) for steps in tracks]
+        self._base_players = [StepSeqer_base(time, len(tracks), params)]
+        self._base_players[0].setTracks([self._steps(steps) for steps in self._tracks], 0)
+        self._base_objs = [StepSeq_base(self._base_players[0], i, 0) for i in range(len(tracks))]
+        self._outputs = {}
+        self._dummies = []
+
+    def _steps(self, steps):
+        width = 4 + self._params
+        defaults = [0, 1, 1, 0] + [0] * self._params
+        result = []
+        for step in steps:
+            if step is None:
+                step = [0, 0]
+            elif type(step) not in [ListType, TupleType]:
+                step = [step]
+            step = [float(x) for x in step[:width]]
+            result.append(step + defaults[len(step):])
+        return result
+
+    def __getitem__(self, i):
+        names = ['note', 'vel', 'step'] + ['param%d' % j for j in range(self._params)]
+        if i in names:
+            if i not in self._outputs:
+                output = names.index(i) + 1
+                self._outputs[i] = [StepSeq_base(self._base_players[0], j, output) for j in range(len(self._base_objs))]
+            self._dummies.append(Dummy([obj for obj in self._outputs[i]]))
+            return self._dummies[-1]
+        if type(i) == SliceType:
+            return self._base_objs[i]
+        if i < len(self._base_objs):
+            return self._base_objs[i]
+        else:
+            print "'i' too large!"
+
+    def setTrack(self, track, steps, sync=True):
+        """
+        Replace the steps of one track.
+
+        :Args:
+
+            track : int
+                Index of the track.
+            steps : list
+                New list of steps (see the `tracks` argument).
+            sync : boolean, optional
+                If True, the new steps are used when the track wraps
+                around, otherwise they are used right away, from the
+                current step index. Defaults to True.
+
+        """
+        pyoArgsAssert(self, "IlB", track, steps, sync)
+        tracks = [None] * len(self._base_objs)
+        tracks[track] = steps
+        self.setPattern(tracks, sync)
+
+    def setPattern(self, tracks, sync=True):
+        """
+        Replace the steps of several tracks at once.
+
+        The new steps of every track are applied together, between two
+        buffers, so that the tracks never play a mix of old and new
+        patterns.
+
+        :Args:
+
+            tracks : list
+                One list of steps per track, or None to leave a
+                track unchanged.
+            sync : boolean, optional
+                If True, each track switches to its new steps when it
+                wraps around, otherwise the new steps are used right
+                away. Defaults to True.
+
+        """
+        pyoArgsAssert(self, "lB", tracks, sync)
+        tracks = tracks[:len(self._base_objs)]
+        self._base_players[0].setTracks([None if steps is None else self._steps(steps) for steps in tracks], sync)
+        for i, steps in enumerate(tracks):
+            if steps is not None:
+                self._tracks[i] = list(steps)
+
+    def setTime(self, x):
+        """
+        Replace the `time` attribute.
+
+        :Args:
+
+            x : float or PyoObject
+                New `time` attribute.
+
+        """
+        pyoArgsAssert(self, "O", x)
+        self._time = x
+        self._base_players[0].setTime(x)
+
+    def reset(self):
+        """
+        Move every track back to its first step.
+
+        """
+        self._base_players[0].reset()
+
+    def getPosition(self):
+        """
+        Return the list of the current step index of each track.
+
+        """
+        return self._base_players[0].getPositions()
+
+    def out(self, chnl=0, inc=1, dur=0, delay=0):
+        return self.play(dur, delay)
+
+    def setMul(self, x):
+        pass
+
+    def setAdd(self, x):
+        pass
+
+    def setSub(self, x):
+        pass
+
+    def setDiv(self, x):
+        pass
+
+    def ctrl(self, map_list=None, title=None, wxnoserver=False):
+        self._map_list = [SLMap(0.01, 1., 'log', 'time', self._time)]
+        PyoObject.ctrl(self, map_list, title, wxnoserver)
+
+    @property
+    def time(self):
+        """float or PyoObject. Duration of a step in seconds."""
+        return self._time
+    @time.setter
+    def time(self, x): self.setTime(x)
+
+    @property
+    def tracks(self):
+        """list of lists. Steps of each track."""
+        return self._tracks
+    @tracks.setter
+    def tracks(self, x): self.setPattern(x)
+
 class Cloud(PyoObject):
     """
     Generates random triggers.
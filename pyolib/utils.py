@@ -746,13 +746,24 @@ class ControlRec(PyoObject):
 
             If greater than 0.0, the `stop` method is automatically called
             at the end of the recording.
+        flush : boolean, optional
+            If True, the values are streamed to binary files on the disk,
+            by a background thread, while recording. Memory usage stays
+            constant, which is useful for very long performances. Files are
+            complete when the object is stopped. Defaults to False.
 
     .. note::
 
         All parameters can only be set at intialization time.
 
-        The write() method must be called on the object to write the files
-        on the disk.
+        Values are stored in native memory chunks, allocated in advance,
+        until the write() method is called to write the files on the disk
+        (unless `flush` is True).
+
+        Files in binary format (see the write() method) are much more compact
+        and faster to load than text files. ControlRead detects the format
+        automatically. A ControlRec object can also be given directly to
+        ControlRead to play back the recorded values without using files.
 
         The out() method is bypassed. ControlRec's signal can not be sent to
         audio outs.
@@ -776,30 +787,51 @@ class ControlRec(PyoObject):
     >>> call = CallAfter(function=write_files, time=4.5)
 
     """
-    def __init__(self, input, filename, rate=1000, dur=0.0):
-        pyoArgsAssert(self, "oSIN", input, filename, rate, dur)
+    def __init__(self, input, filename, rate=1000, dur=0.0, flush=False):
+        pyoArgsAssert(self, "oSINB", input, filename, rate, dur, flush)
         PyoObject.__init__(self)
         self._input = input
         self._filename = filename
         self._path, self._name = os.path.split(filename)
         self._rate = rate
         self._dur = dur
+        self._flush = flush
         self._in_fader = InputFader(input)
         in_fader, lmax = convertArgsToLists(self._in_fader)
-        self._base_objs = [ControlRec_base(wrap(in_fader,i), rate, dur) for i in range(lmax)]
+        if flush:
+            self._base_objs = [ControlRec_base(wrap(in_fader,i), rate, dur, self._getPath(i)) for i in range(lmax)]
+        else:
+            self._base_objs = [ControlRec_base(wrap(in_fader,i), rate, dur) for i in range(lmax)]
+
+    def _getPath(self, i):
+        return os.path.join(self._path, "%s_%03d" % (self._name, i))
 
     def out(self, chnl=0, inc=1, dur=0, delay=0):
         return self.play(dur, delay)
 
-    def write(self):
+    def write(self, binary=False):
         """
         Writes recorded values in text files on the disk.
 
+        Does nothing if the object was created with `flush` set to True,
+        the files are already written.
+
+        :Args:
+
+            binary : boolean, optional
+                If True, values are written as 64-bit floats in a compact
+                binary format instead of text lines. Defaults to False.
+
         """
+        if self._flush:
+            return
         for i, obj in enumerate(self._base_objs):
-            f = open(os.path.join(self._path, "%s_%03d" % (self._name, i)), "w")
-            [f.write("%f %f\n" % p) for p in obj.getData()]
-            f.close()
+            if binary:
+                obj.writeFile(self._getPath(i))
+            else:
+                f = open(self._getPath(i), "w")
+                [f.write("%f %f\n" % p) for p in obj.getData()]
+                f.close()
 
 class ControlRead(PyoObject):
     """
@@ -811,7 +843,7 @@ class ControlRead(PyoObject):
 
     :Args:
 
-        filename : string
+        filename : string or ControlRec
             Full path (without extension) used to create the files.
 
             Usually the same filename as the one given to a ControlRec
@@ -819,6 +851,10 @@ class ControlRead(PyoObject):
 
             The directory will be scaned and all files
             named "filename_xxx" will add a new stream in the object.
+            Text and binary files are both accepted.
+
+            If a ControlRec object is given, values recorded in its
+            memory are read directly, one stream per recorded stream.
         rate : int, optional
             Rate at which the values are sampled. Defaults to 1000.
         loop : boolean, optional
@@ -858,22 +894,34 @@ class ControlRead(PyoObject):
 
     """
     def __init__(self, filename, rate=1000, loop=False, interp=2, mul=1, add=0):
-        pyoArgsAssert(self, "SIBIOO", filename, rate, loop, interp, mul, add)
+        if isinstance(filename, ControlRec):
+            pyoArgsAssert(self, "IBIOO", rate, loop, interp, mul, add)
+        else:
+            pyoArgsAssert(self, "SIBIOO", filename, rate, loop, interp, mul, add)
         PyoObject.__init__(self, mul, add)
         self._filename = filename
-        self._path, self._name = os.path.split(filename)
         self._rate = rate
         self._loop = loop
         self._interp = interp
-        files = sorted([f for f in os.listdir(self._path) if self._name+"_" in f])
         mul, add, lmax = convertArgsToLists(mul, add)
-        self._base_objs = []
-        for i in range(len(files)):
-            path = os.path.join(self._path, files[i])
-            f = open(path, "r")
-            values = [float(l.split()[1]) for l in f.readlines()]
-            f.close()
-            self._base_objs.append(ControlRead_base(values, rate, loop, interp, wrap(mul,i), wrap(add,i)))
+        if isinstance(filename, ControlRec):
+            # Values are copied from the recorder's memory chunks.
+            sources = filename.getBaseObjects()
+        else:
+            self._path, self._name = os.path.split(filename)
+            files = sorted([f for f in os.listdir(self._path) if self._name+"_" in f])
+            sources = []
+            for file in files:
+                path = os.path.join(self._path, file)
+                f = open(path, "rb")
+                if f.read(4) == "PYOC":
+                    # Binary files are loaded by the C object.
+                    sources.append(path)
+                else:
+                    f.seek(0)
+                    sources.append([float(l.split()[1]) for l in f.readlines()])
+                f.close()
+        self._base_objs = [ControlRead_base(src, rate, loop, interp, wrap(mul,i), wrap(add,i)) for i, src in enumerate(sources)]
         self._trig_objs = Dummy([TriggerDummy_base(obj) for obj in self._base_objs])
 
     def out(self, chnl=0, inc=1, dur=0, delay=0):
@@ -973,13 +1021,18 @@ class NoteinRec(PyoObject):
 
             The same filename can be passed to a NoteinRead object to read
             all related files.
+        flush : boolean, optional
+            If True, the events are streamed to binary files on the disk,
+            by a background thread, while recording. Files are complete
+            when the object is stopped. Defaults to False.
 
     .. note::
 
         All parameters can only be set at intialization time.
 
-        The `write` method must be called on the object to write the files
-        on the disk.
+        Events are stored in native memory chunks until the `write` method
+        is called to write the files on the disk (unless `flush` is True).
+        A NoteinRec object can also be given directly to NoteinRead.
 
         The out() method is bypassed. NoteinRec's signal can not be sent to
         audio outs.
@@ -998,29 +1051,50 @@ class NoteinRec(PyoObject):
     >>> # call rec.write() to save "test_000" and "test_001" in the home directory.
 
     """
-    def __init__(self, input, filename):
-        pyoArgsAssert(self, "oS", input, filename)
+    def __init__(self, input, filename, flush=False):
+        pyoArgsAssert(self, "oSB", input, filename, flush)
         PyoObject.__init__(self)
         self._input = input
         self._filename = filename
         self._path, self._name = os.path.split(filename)
+        self._flush = flush
         self._in_pitch = self._input["pitch"]
         self.in_velocity = self._input["velocity"]
         in_pitch, in_velocity, lmax = convertArgsToLists(self._in_pitch, self.in_velocity)
-        self._base_objs = [NoteinRec_base(wrap(in_pitch,i), wrap(in_velocity,i)) for i in range(lmax)]
+        if flush:
+            self._base_objs = [NoteinRec_base(wrap(in_pitch,i), wrap(in_velocity,i), self._getPath(i)) for i in range(lmax)]
+        else:
+            self._base_objs = [NoteinRec_base(wrap(in_pitch,i), wrap(in_velocity,i)) for i in range(lmax)]
+
+    def _getPath(self, i):
+        return os.path.join(self._path, "%s_%03d" % (self._name, i))
 
     def out(self, chnl=0, inc=1, dur=0, delay=0):
         return self.play(dur, delay)
 
-    def write(self):
+    def write(self, binary=False):
         """
         Writes recorded values in text files on the disk.
 
+        Does nothing if the object was created with `flush` set to True,
+        the files are already written.
+
+        :Args:
+
+            binary : boolean, optional
+                If True, events are written as 64-bit floats in a compact
+                binary format instead of text lines. Defaults to False.
+
         """
+        if self._flush:
+            return
         for i, obj in enumerate(self._base_objs):
-            f = open(os.path.join(self._path, "%s_%03d" % (self._name, i)), "w")
-            [f.write("%f %f %f\n" % p) for p in obj.getData()]
-            f.close()
+            if binary:
+                obj.writeFile(self._getPath(i))
+            else:
+                f = open(self._getPath(i), "w")
+                [f.write("%f %f %f\n" % p) for p in obj.getData()]
+                f.close()
 
 class NoteinRead(PyoObject):
     """
@@ -1030,7 +1104,7 @@ class NoteinRead(PyoObject):
 
     :Args:
 
-        filename : string
+        filename : string or NoteinRec
             Full path (without extension) used to create the files.
 
             Usually the same filename as the one given to a NoteinRec
@@ -1038,6 +1112,10 @@ class NoteinRead(PyoObject):
 
             The directory will be scaned and all files
             named "filename_xxx" will add a new stream in the object.
+            Text and binary files are both accepted.
+
+            If a NoteinRec object is given, events recorded in its
+            memory are read directly.
         loop : boolean, optional
             Looping mode, False means off, True means on.
             Defaults to False.
@@ -1069,28 +1147,45 @@ class NoteinRead(PyoObject):
 
     """
     def __init__(self, filename, loop=False, mul=1, add=0):
-        pyoArgsAssert(self, "SBOO", filename, loop, mul, add)
+        if isinstance(filename, NoteinRec):
+            pyoArgsAssert(self, "BOO", loop, mul, add)
+        else:
+            pyoArgsAssert(self, "SBOO", filename, loop, mul, add)
         PyoObject.__init__(self, mul, add)
         self._pitch_dummy = []
         self._velocity_dummy = []
         self._filename = filename
-        self._path, self._name = os.path.split(filename)
         self._loop = loop
-        files = sorted([f for f in os.listdir(self._path) if self._name+"_" in f])
         mul, add, lmax = convertArgsToLists(mul, add)
+        if isinstance(filename, NoteinRec):
+            # Events are copied from the recorder's memory chunks.
+            sources = filename.getBaseObjects()
+        else:
+            self._path, self._name = os.path.split(filename)
+            files = sorted([f for f in os.listdir(self._path) if self._name+"_" in f])
+            sources = [os.path.join(self._path, file) for file in files]
         self._base_objs = []
         _trig_objs_tmp = []
-        self._poly = len(files)
-        for i in range(self._poly):
-            path = os.path.join(self._path, files[i])
-            f = open(path, "r")
-            vals = [l.split() for l in f.readlines()]
-            timestamps = [float(v[0]) for v in vals]
-            pitches = [float(v[1]) for v in vals]
-            amps = [float(v[2]) for v in vals]
-            f.close()
-            self._base_objs.append(NoteinRead_base(pitches, timestamps, loop))
-            self._base_objs.append(NoteinRead_base(amps, timestamps, loop, wrap(mul,i), wrap(add,i)))
+        self._poly = len(sources)
+        for i, src in enumerate(sources):
+            if not isinstance(src, NoteinRec_base):
+                f = open(src, "rb")
+                if f.read(4) != "PYOC":
+                    f.seek(0)
+                    vals = [l.split() for l in f.readlines()]
+                    timestamps = [float(v[0]) for v in vals]
+                    pitches = [float(v[1]) for v in vals]
+                    amps = [float(v[2]) for v in vals]
+                    f.close()
+                    self._base_objs.append(NoteinRead_base(pitches, timestamps, loop))
+                    self._base_objs.append(NoteinRead_base(amps, timestamps, loop, wrap(mul,i), wrap(add,i)))
+                    _trig_objs_tmp.append(TriggerDummy_base(self._base_objs[-1]))
+                    continue
+                f.close()
+            # Binary files and recorders are read by the C object, the
+            # second argument selects the column (1 = pitch, 2 = velocity).
+            self._base_objs.append(NoteinRead_base(src, 1, loop))
+            self._base_objs.append(NoteinRead_base(src, 2, loop, wrap(mul,i), wrap(add,i)))
             _trig_objs_tmp.append(TriggerDummy_base(self._base_objs[-1]))
         self._trig_objs = Dummy(_trig_objs_tmp)
 
@@ -1971,4 +2066,233 @@ class TrackHold(PyoObject):
         """float or PyoObject. Target value."""
         return self._value
     @value.setter
-    def value(self, x): self.setValue(x)
\ No newline at end of file
+    def value(self, x): self.setValue(x)
+
+class Domain(PyoObject):
+    """
+    Computes a subgraph at a decimated sampling rate.
+
+    Every object created inside a Domain (with the `with` statement) is
+    computed by the Domain instead of the server, on blocks `factor` times
+    shorter than the server's buffer size. These objects see a sampling rate
+    and a buffer size divided by `factor`, so any PyoObject can be used
+    unchanged. This is useful for analysis, control signals or any process
+    whose meaningful bandwidth is well below the server's nyquist frequency.
+
+    Full rate signals enter the domain through the `input` method, which
+    applies an anti-aliasing lowpass filter before the decimation, and
+    domain signals come back to the full rate through the `output` method,
+    which interpolates and filters the decimated signal.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        factor : int, optional
+            Decimation factor. Must divide the server's buffer size.
+            Defaults to 2.
+
+    .. note::
+
+        Signals created inside a Domain must not be read directly by full
+        rate objects (and vice versa), use the `input` and `output` methods
+        to cross the boundary. Beware that arithmetic on full rate signals
+        (ie. `a + b`) inside the `with` block creates decimated objects.
+
+        Objects are computed in the order they are created, so signals given
+        to the `input` method should be created before the Domain object,
+        and the `output` method called after it.
+
+        The out() method is bypassed, for the Domain and for the objects
+        created inside it. Domain has no `mul` and `add` attributes.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> src = SfPlayer(SNDS_PATH + '/transparent.aif', loop=True, mul=.4).mix(2).out()
+    >>> dom = Domain(factor=8)
+    >>> with dom:
+    ...     low = dom.input(src)
+    ...     amp = Follower(low, freqcut=10)
+    ...     lfo = Sine(freq=amp*40, mul=300, add=1000)
+    >>> cut = dom.output(lfo)
+    >>> n = ButLP(Noise(.1), freq=cut).out(1)
+
+    """
+    def __init__(self, factor=2):
+        pyoArgsAssert(self, "I", factor)
+        PyoObject.__init__(self)
+        self._factor = factor
+        self._previous = None
+        self._base_objs = [Domain_base(factor)]
+
+    def __enter__(self):
+        server = self._base_objs[0].getServer()
+        self._previous = server._getDomain()
+        server._setDomain(self._base_objs[0])
+        return self
+
+    def __exit__(self, type, value, traceback):
+        self._base_objs[0].getServer()._setDomain(self._previous)
+        self._previous = None
+
+    def input(self, x, mul=1, add=0):
+        """
+        Returns a DomainIn object bringing a full rate signal into the domain.
+
+        :Args:
+
+            x : PyoObject
+                Full rate signal to decimate.
+            mul : float or PyoObject, optional
+                Multiplication factor. Defaults to 1.
+            add : float or PyoObject, optional
+                Addition factor. Defaults to 0.
+
+        """
+        return DomainIn(x, self, mul, add)
+
+    def output(self, x, mul=1, add=0):
+        """
+        Returns a DomainOut object bringing a domain signal back to full rate.
+
+        :Args:
+
+            x : PyoObject
+                Signal computed inside the domain.
+            mul : float or PyoObject, optional
+                Multiplication factor. Defaults to 1.
+            add : float or PyoObject, optional
+                Addition factor. Defaults to 0.
+
+        """
+        return DomainOut(x, self, mul, add)
+
+    def getStreams(self):
+        """
+        Returns the list of streams computed at the decimated rate.
+
+        """
+        return self._base_objs[0].getStreams()
+
+    def out(self, chnl=0, inc=1, dur=0, delay=0):
+        return self.play(dur, delay)
+
+    def setMul(self, x):
+        pass
+
+    def setAdd(self, x):
+        pass
+
+    def setSub(self, x):
+        pass
+
+    def setDiv(self, x):
+        pass
+
+    @property
+    def factor(self):
+        """int. Decimation factor."""
+        return self._factor
+
+class DomainIn(PyoObject):
+    """
+    Decimates a full rate signal into a Domain.
+
+    The input signal is filtered by an 8th order butterworth lowpass, with
+    a cutoff at 80% of the domain's nyquist frequency, then one sample out
+    of `factor` is kept. DomainIn objects are usually created with the
+    `input` method of the Domain.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        input : PyoObject
+            Full rate signal to decimate.
+        domain : Domain
+            Domain receiving the decimated signal.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> a = Noise(.3)
+    >>> dom = Domain(factor=4)
+    >>> with dom:
+    ...     low = DomainIn(a, dom)
+    ...     rms = Follower(low)
+    >>> p = Print(dom.output(rms), interval=.5)
+
+    """
+    def __init__(self, input, domain, mul=1, add=0):
+        pyoArgsAssert(self, "ooOO", input, domain, mul, add)
+        PyoObject.__init__(self, mul, add)
+        self._input = input
+        self._domain = domain
+        server = domain._base_objs[0].getServer()
+        previous = server._getDomain()
+        server._setDomain(domain._base_objs[0])
+        try:
+            input, mul, add, lmax = convertArgsToLists(input, mul, add)
+            self._base_objs = [DomainIn_base(wrap(input,i), domain._base_objs[0], wrap(mul,i), wrap(add,i)) for i in range(lmax)]
+        finally:
+            server._setDomain(previous)
+
+    @property
+    def input(self):
+        """PyoObject. Input signal."""
+        return self._input
+
+    @property
+    def domain(self):
+        """Domain. Domain receiving the decimated signal."""
+        return self._domain
+
+class DomainOut(PyoObject):
+    """
+    Interpolates a Domain signal back to the full sampling rate.
+
+    The decimated signal is linearly interpolated, then smoothed by an 8th
+    order butterworth lowpass, with a cutoff at 80% of the domain's nyquist
+    frequency, to remove the images of the upsampling. DomainOut objects are
+    usually created with the `output` method of the Domain.
+
+    :Parent: :py:class:`PyoObject`
+
+    :Args:
+
+        input : PyoObject
+            Signal computed inside the domain.
+        domain : Domain
+            Domain computing the input signal.
+
+    >>> s = Server().boot()
+    >>> s.start()
+    >>> dom = Domain(factor=4)
+    >>> with dom:
+    ...     lfo = Sine(freq=[.2,.25], mul=400, add=800)
+    >>> freq = DomainOut(lfo, dom)
+    >>> a = SineLoop(freq, feedback=0.05, mul=.2).out()
+
+    """
+    def __init__(self, input, domain, mul=1, add=0):
+        pyoArgsAssert(self, "ooOO", input, domain, mul, add)
+        PyoObject.__init__(self, mul, add)
+        self._input = input
+        self._domain = domain
+        server = domain._base_objs[0].getServer()
+        previous = server._getDomain()
+        server._setDomain(None)
+        try:
+            input, mul, add, lmax = convertArgsToLists(input, mul, add)
+            self._base_objs = [DomainOut_base(wrap(input,i), domain._base_objs[0], wrap(mul,i), wrap(add,i)) for i in range(lmax)]
+        finally:
+            server._setDomain(previous)
+
+    @property
+    def input(self):
+        """PyoObject. Input signal."""
+        return self._input
+
+    @property
+    def domain(self):
+        """Domain. Domain computing the input signal."""
+        return self._domain
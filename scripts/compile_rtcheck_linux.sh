@@ -0,0 +1,11 @@
+#! /bin/sh
+
+# Builds libpyortcheck.so, the real-time violations detector (debugging
+# tool, Linux only). Usage, from the pyo source directory:
+#
+#     sh scripts/compile_rtcheck_linux.sh
+#     LD_PRELOAD=$PWD/libpyortcheck.so python my_script.py
+#
+# and call Server.setRTCheck(True) in the script.
+
+gcc -shared -fPIC -O2 -Wall -I include src/rtcheck/pyortcheck.c -o libpyortcheck.so -ldl
@@ -43,6 +43,12 @@ if '--use-double' in sys.argv and not '--only-double' in sys.argv:
     main_modules.append('pyo64')
     extra_macros_per_extension.append([('USE_DOUBLE',None)])
     
+if '--use-mixed' in sys.argv: 
+    sys.argv.remove('--use-mixed') 
+    extension_names.append('_pyomx')
+    main_modules.append('pyomx')
+    extra_macros_per_extension.append([('USE_MIXED',None)])
+    
 if '--use-jack' in sys.argv: 
     sys.argv.remove('--use-jack') 
     if sys.platform == "darwin":
@@ -67,7 +73,7 @@ if sys.platform == "darwin":
 
 path = 'src/engine/'
 files = ['pyomodule.c', 'servermodule.c', 'pvstreammodule.c', 'streammodule.c', 'dummymodule.c', 
-        'mixmodule.c', 'inputfadermodule.c', 'interpolation.c', 'fft.c', "wind.c"]
+        'mixmodule.c', 'inputfadermodule.c', 'interpolation.c', 'fft.c', "wind.c", 'taskpool.c', 'yin.c']
 source_files = [path + f for f in files]
 
 path = 'src/objects/'
@@ -79,7 +85,7 @@ files = ['granulatormodule.c', 'tablemodule.c', 'wgverbmodule.c', 'freeverbmodul
         'metromodule.c', 'trigmodule.c', 'patternmodule.c', 'bandsplitmodule.c', 'hilbertmodule.c', 'panmodule.c',
         'selectmodule.c', 'compressmodule.c', 'utilsmodule.c',
         'convolvemodule.c', 'arithmeticmodule.c', 'sigmodule.c',
-        'matrixprocessmodule.c', 'harmonizermodule.c', 'chorusmodule.c']
+        'matrixprocessmodule.c', 'harmonizermodule.c', 'chorusmodule.c', 'domainmodule.c', 'pluginmodule.c']
 
 if compile_externals:
     source_files = source_files + ["externals/externalmodule.c"] + [path + f for f in files]
@@ -101,6 +107,8 @@ else:
         include_dirs.append('/opt/local/include')
     library_dirs = []
     libraries = ['portaudio', 'portmidi', 'sndfile', 'lo']
+    if sys.platform.startswith("linux"):
+        libraries.append('dl')
     if build_osx_with_jack_support:
         libraries.append('jack')
 
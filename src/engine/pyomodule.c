@@ -29,6 +29,9 @@
 #include "dummymodule.h"
 #include "tablemodule.h"
 #include "matrixmodule.h"
+#include "fft.h"
+#include "wind.h"
+#include "yin.h"
 
 /** Note :
  ** Add an argument to pa_get_* and pm_get_* functions to allow printing to the console
@@ -1361,6 +1364,546 @@ downsamp(PyObject *self, PyObject *args, PyObject *kwds)
     Py_RETURN_NONE;
 }
 
+/****** Offline feature extraction ******/
+#define sndfeatures_info \
+"\nAnalyzes an audio file and writes its per-frame features to disk.\n\n\
+The file is mixed down to mono and cut into overlapping analysis windows of `winsize`\n\
+samples, advancing by `hopsize` samples. For every frame, the requested features are\n\
+computed directly by the C analysis kernels, without any server or audio callback. The\n\
+Python interpreter lock is released during the analysis, so several files can be processed\n\
+concurrently from different threads (see `sndfeaturesBatch`).\n\n\
+Available features are:\n\n    \
+'rms' : Root-mean-square amplitude of the window.\n    \
+'peak' : Absolute peak amplitude of the window.\n    \
+'zcross' : Zero-crossing rate of the window (crossings per sample).\n    \
+'centroid' : Spectral centroid, in Hz.\n    \
+'flux' : Spectral flux, the positive magnitude difference with the previous frame.\n    \
+'pitch' : Fundamental frequency estimated with the YIN algorithm, in Hz.\n\n\
+The output file starts with a small header (see `readFeatures`) followed by the frames,\n\
+stored as 32-bit floats in native byte order, one value per feature.\n\n\
+Returns a tuple (number of frames, frame rate in Hz) or -1 if the analysis failed.\n\n\
+:Args:\n\n    \
+path : string\n        Full path (including extension) of the audio file to analyze.\n    \
+outfile : string\n        Full path of the features file to create.\n    \
+features : list of strings, optional\n        Features to compute, in the order they will be stored in each frame.\n        \
+Defaults to ['rms', 'peak', 'zcross', 'centroid', 'pitch'].\n    \
+hopsize : int, optional\n        Number of samples between the start of two successive frames. Defaults to 512.\n    \
+winsize : int, optional\n        Size, in samples, of the analysis window. Will be rounded up to the next\n        \
+power-of-two. Defaults to 1024.\n    \
+minfreq : float, optional\n        Minimum frequency, in Hz, accepted by the pitch detector. Defaults to 40.\n    \
+maxfreq : float, optional\n        Maximum frequency, in Hz, accepted by the pitch detector. Also used as the\n        \
+cutoff frequency of the lowpass filter applied before the pitch detection. Defaults to 1000.\n    \
+tolerance : float, optional\n        Tolerance of the pitch detector, between 0 and 1. Defaults to 0.15.\n\n\
+>>> import os\n\
+>>> home = os.path.expanduser('~')\n\
+>>> featfile = os.path.join(home, 'transparent.pyf')\n\
+>>> frames, rate = sndfeatures(SNDS_PATH+'/transparent.aif', featfile, ['rms', 'pitch'])\n\
+>>> header, data = readFeatures(featfile)\n\n"
+
+#define SNDFEATURES_MAX 16
+
+enum { FEAT_RMS = 0, FEAT_PEAK, FEAT_ZCROSS, FEAT_CENTROID, FEAT_FLUX, FEAT_PITCH, FEAT_NUM };
+
+static const char *FEATURE_NAMES[FEAT_NUM] = {"rms", "peak", "zcross", "centroid", "flux", "pitch"};
+
+/* Computes all frames of `snd` and writes them to `outpath`. Runs without the GIL. */
+static int
+sndfeatures_process(MYFLT *snd, int snd_size, MYFLT sr, const char *outpath, int *feats, int numfeats,
+                    int hopsize, int winsize, MYFLT minfreq, MYFLT maxfreq, MYFLT tolerance, int *numframes) {
+    int i, j, k, start, count, n8, hsize, need_fft = 0, need_pitch = 0;
+    int header[5];
+    char names[SNDFEATURES_MAX][16];
+    MYFLT val, re, im, mag, sum1, sum2, b, c2, y1, pitch = 0.0;
+    MYFLT *frame, *lpsnd = NULL, *lpframe = NULL, *yin_buffer = NULL;
+    MYFLT *inframe = NULL, *outframe = NULL, *window = NULL, *mags = NULL, *lastmags = NULL;
+    MYFLT **twiddle = NULL;
+    double dsr = (double)sr;
+    float outvals[SNDFEATURES_MAX];
+    FILE *fout;
+
+    if ((fout = fopen(outpath, "wb")) == NULL)
+        return -1;
+
+    hsize = winsize / 2;
+    *numframes = snd_size > 0 ? (snd_size + hopsize - 1) / hopsize : 1;
+
+    for (i=0; i<numfeats; i++) {
+        if (feats[i] == FEAT_CENTROID || feats[i] == FEAT_FLUX)
+            need_fft = 1;
+        else if (feats[i] == FEAT_PITCH)
+            need_pitch = 1;
+    }
+
+    frame = (MYFLT *)malloc(winsize * sizeof(MYFLT));
+
+    if (need_fft) {
+        n8 = winsize >> 3;
+        inframe = (MYFLT *)malloc(winsize * sizeof(MYFLT));
+        outframe = (MYFLT *)malloc(winsize * sizeof(MYFLT));
+        mags = (MYFLT *)malloc(hsize * sizeof(MYFLT));
+        lastmags = (MYFLT *)malloc(hsize * sizeof(MYFLT));
+        for (i=0; i<hsize; i++)
+            lastmags[i] = 0.0;
+        twiddle = (MYFLT **)malloc(4 * sizeof(MYFLT *));
+        for(i=0; i<4; i++)
+            twiddle[i] = (MYFLT *)malloc(n8 * sizeof(MYFLT));
+        fft_compute_split_twiddle(twiddle, winsize);
+        window = (MYFLT *)malloc(winsize * sizeof(MYFLT));
+        gen_window(window, winsize, 2);
+    }
+
+    if (need_pitch) {
+        /* Same one-pole lowpass as the Yin object, with maxfreq as cutoff. */
+        if (maxfreq >= sr * 0.5)
+            maxfreq = sr * 0.5;
+        b = 2.0 - MYCOS(TWOPI * maxfreq / sr);
+        c2 = (b - MYSQRT(b * b - 1.0));
+        y1 = 0.0;
+        lpsnd = (MYFLT *)malloc((snd_size > 0 ? snd_size : 1) * sizeof(MYFLT));
+        for (i=0; i<snd_size; i++) {
+            y1 = snd[i] + (y1 - snd[i]) * c2;
+            lpsnd[i] = y1;
+        }
+        lpframe = (MYFLT *)malloc(winsize * sizeof(MYFLT));
+        yin_buffer = (MYFLT *)malloc(hsize * sizeof(MYFLT));
+    }
+
+    /* header */
+    memset(names, 0, sizeof(names));
+    for (i=0; i<numfeats; i++)
+        strncpy(names[i], FEATURE_NAMES[feats[i]], 15);
+    header[0] = numfeats;
+    header[1] = *numframes;
+    header[2] = hopsize;
+    header[3] = winsize;
+    header[4] = 1; /* format version */
+    fwrite("PYOF", 1, 4, fout);
+    fwrite(header, sizeof(int), 5, fout);
+    fwrite(&dsr, sizeof(double), 1, fout);
+    fwrite(names, 16, numfeats, fout);
+
+    for (k=0; k<*numframes; k++) {
+        start = k * hopsize;
+        count = snd_size - start;
+        if (count > winsize)
+            count = winsize;
+        for (i=0; i<count; i++)
+            frame[i] = snd[start+i];
+        for (i=count; i<winsize; i++)
+            frame[i] = 0.0;
+
+        if (need_fft) {
+            for (i=0; i<winsize; i++)
+                inframe[i] = frame[i] * window[i];
+            realfft_split(inframe, outframe, winsize, twiddle);
+            for (i=1; i<hsize; i++) {
+                re = outframe[i];
+                im = outframe[winsize - i];
+                mags[i] = MYSQRT(re*re + im*im);
+            }
+            mags[0] = MYFABS(outframe[0]);
+        }
+
+        if (need_pitch) {
+            for (i=0; i<count; i++)
+                lpframe[i] = lpsnd[start+i];
+            for (i=count; i<winsize; i++)
+                lpframe[i] = 0.0;
+            val = yin_period(lpframe, yin_buffer, winsize / 2, tolerance);
+            if (val > 0.0) {
+                val = sr / val;
+                if (val > minfreq && val < maxfreq)
+                    pitch = val;
+            }
+        }
+
+        for (j=0; j<numfeats; j++) {
+            val = 0.0;
+            switch (feats[j]) {
+                case FEAT_RMS:
+                    for (i=0; i<winsize; i++)
+                        val += frame[i] * frame[i];
+                    val = MYSQRT(val / winsize);
+                    break;
+                case FEAT_PEAK:
+                    for (i=0; i<winsize; i++) {
+                        if (MYFABS(frame[i]) > val)
+                            val = MYFABS(frame[i]);
+                    }
+                    break;
+                case FEAT_ZCROSS:
+                    for (i=1; i<winsize; i++) {
+                        if ((frame[i-1] >= 0.0 && frame[i] < 0.0) || (frame[i-1] < 0.0 && frame[i] >= 0.0))
+                            val += 1.0;
+                    }
+                    val /= winsize;
+                    break;
+                case FEAT_CENTROID:
+                    sum1 = sum2 = 0.0;
+                    for (i=1; i<hsize; i++) {
+                        sum1 += mags[i] * i;
+                        sum2 += mags[i];
+                    }
+                    if (sum2 >= 0.000000001)
+                        val = sum1 / sum2 * sr / winsize;
+                    break;
+                case FEAT_FLUX:
+                    for (i=0; i<hsize; i++) {
+                        mag = mags[i] - lastmags[i];
+                        if (mag > 0.0)
+                            val += mag;
+                    }
+                    val /= hsize;
+                    break;
+                case FEAT_PITCH:
+                    val = pitch;
+                    break;
+            }
+            outvals[j] = (float)val;
+        }
+        if (need_fft) {
+            for (i=0; i<hsize; i++)
+                lastmags[i] = mags[i];
+        }
+        fwrite(outvals, sizeof(float), numfeats, fout);
+    }
+
+    fclose(fout);
+
+    free(frame);
+    if (need_fft) {
+        free(inframe);
+        free(outframe);
+        free(mags);
+        free(lastmags);
+        for(i=0; i<4; i++)
+            free(twiddle[i]);
+        free(twiddle);
+        free(window);
+    }
+    if (need_pitch) {
+        free(lpsnd);
+        free(lpframe);
+        free(yin_buffer);
+    }
+
+    return 0;
+}
+
+static PyObject *
+sndfeatures(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    int i, j, err = 0, numfeats, numframes = 0;
+    int feats[SNDFEATURES_MAX];
+    char *inpath;
+    char *outpath;
+    char *name;
+    SNDFILE *sf;
+    SF_INFO info;
+    unsigned int snd_size = 0, snd_chnls, num_items;
+    MYFLT snd_sr = 44100.0;
+    MYFLT *tmp, *samples = NULL;
+    PyObject *featlist = NULL;
+    int hopsize = 512;
+    int winsize = 1024;
+    int size = 64;
+    MYFLT minfreq = 40.0, maxfreq = 1000.0, tolerance = 0.15;
+    static char *kwlist[] = {"path", "outfile", "features", "hopsize", "winsize", "minfreq", "maxfreq", "tolerance", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "ss|Oii"TYPE_F TYPE_F TYPE_F, kwlist, &inpath, &outpath, &featlist, &hopsize, &winsize, &minfreq, &maxfreq, &tolerance))
+        return PyInt_FromLong(-1);
+
+    if (featlist == NULL || featlist == Py_None) {
+        numfeats = 5;
+        for (i=0; i<numfeats; i++)
+            feats[i] = i == 4 ? FEAT_PITCH : i;
+    }
+    else {
+        if (! PySequence_Check(featlist)) {
+            printf("sndfeatures: features argument must be a list of strings.\n");
+            return PyInt_FromLong(-1);
+        }
+        numfeats = PySequence_Size(featlist);
+        if (numfeats < 1 || numfeats > SNDFEATURES_MAX) {
+            printf("sndfeatures: number of features must be between 1 and %d.\n", SNDFEATURES_MAX);
+            return PyInt_FromLong(-1);
+        }
+        for (i=0; i<numfeats; i++) {
+            PyObject *item = PySequence_GetItem(featlist, i);
+            name = item != NULL ? PyString_AsString(item) : NULL;
+            feats[i] = -1;
+            for (j=0; name != NULL && j<FEAT_NUM; j++) {
+                if (strcmp(name, FEATURE_NAMES[j]) == 0)
+                    feats[i] = j;
+            }
+            Py_XDECREF(item);
+            if (feats[i] == -1) {
+                PyErr_Clear();
+                printf("sndfeatures: unknown feature at position %d.\n", i);
+                return PyInt_FromLong(-1);
+            }
+        }
+    }
+
+    if (hopsize < 1)
+        hopsize = 1;
+    while (size < winsize)
+        size *= 2;
+    winsize = size;
+
+    Py_BEGIN_ALLOW_THREADS
+
+    /* opening input soundfile, mixed down to mono */
+    info.format = 0;
+    sf = sf_open(inpath, SFM_READ, &info);
+    if (sf == NULL)
+        err = 1;
+    else {
+        snd_size = info.frames;
+        snd_sr = info.samplerate;
+        snd_chnls = info.channels;
+        num_items = snd_size * snd_chnls;
+        tmp = (MYFLT *)malloc(num_items * sizeof(MYFLT));
+        sf_seek(sf, 0, SEEK_SET);
+        SF_READ(sf, tmp, num_items);
+        sf_close(sf);
+        samples = (MYFLT *)calloc(snd_size > 0 ? snd_size : 1, sizeof(MYFLT));
+        for (i=0; i<num_items; i++)
+            samples[i/snd_chnls] += tmp[i];
+        for (i=0; i<snd_size; i++)
+            samples[i] /= snd_chnls;
+        free(tmp);
+
+        if (sndfeatures_process(samples, snd_size, snd_sr, outpath, feats, numfeats, hopsize, winsize,
+                                minfreq, maxfreq, tolerance, &numframes) < 0)
+            err = 2;
+        free(samples);
+    }
+
+    Py_END_ALLOW_THREADS
+
+    if (err == 1) {
+        printf("sndfeatures: failed to open the input file %s.\n", inpath);
+        return PyInt_FromLong(-1);
+    }
+    else if (err == 2) {
+        printf("sndfeatures: failed to open output file %s.\n", outpath);
+        return PyInt_FromLong(-1);
+    }
+
+    return Py_BuildValue("id", numframes, (double)snd_sr / hopsize);
+}
+
+/****** Offline phase vocoder analysis ******/
+#define pvanalysis_info \
+"\nPerforms the phase vocoder analysis of a sound and writes the frames to disk.\n\n\
+The sound is analyzed exactly as PVAnal would do it, but once and offline. The resulting\n\
+file holds, for every hop of `size` / `olaps` samples, the magnitudes and the true\n\
+frequencies of the bins, and can be played back with PVRead, which maps it in memory and\n\
+outputs these frames directly as a phase vocoder stream, without any FFT. The Python\n\
+interpreter lock is released during the analysis.\n\n\
+The output file starts with a 64 bytes header (magic 'PYPV', format version, fft size,\n\
+overlaps, number of bins, number of frames, window type and the sampling rate of the sound)\n\
+followed by the frames, stored as 32-bit floats in native byte order, magnitudes first.\n\n\
+Returns a tuple (number of frames, frame rate in Hz) or -1 if the analysis failed.\n\n\
+:Args:\n\n    \
+input : string or PyoTableObject\n        Full path (including extension) of the audio file to analyze, mixed down\n        \
+to mono, or a table whose first channel will be analyzed.\n    \
+outfile : string\n        Full path of the analysis file to create.\n    \
+size : int, optional\n        FFT size. Will be rounded up to the next power-of-two. Defaults to 1024.\n    \
+olaps : int, optional\n        Number of overlaped analysis blocks. Will be rounded up to the next power-of-two.\n        \
+Defaults to 4.\n    \
+wintype : int, optional\n        Shape of the analysis window (see PVAnal). Defaults to 2 (Hanning).\n\n\
+>>> import os\n\
+>>> home = os.path.expanduser('~')\n\
+>>> pvfile = os.path.join(home, 'transparent.pvf')\n\
+>>> frames, rate = pvanalysis(SNDS_PATH+'/transparent.aif', pvfile, size=1024, olaps=4)\n\
+>>> pvr = PVRead(pvfile, speed=0.5, loop=True)\n\
+>>> pvs = PVSynth(pvr).out()\n\n"
+
+/* Computes all frames of `snd` and writes them to `outpath`. Frame `f` is the one
+** PVAnal outputs after f+1 hops, so the file replays PVAnal's stream. Runs without the GIL. */
+static int
+pvanalysis_process(MYFLT *snd, int snd_size, MYFLT sr, const char *outpath, int size, int olaps,
+                   int wintype, int *numframes) {
+    int i, k, f, start, mod, n8, hsize, hopsize;
+    MYFLT re, im, phase, tmp, factor, scale;
+    MYFLT *inframe, *outframe, *window, *lastPhase;
+    MYFLT **twiddle;
+    float *frame;
+    char header[PV_FILE_HEADER_SIZE];
+    PVFileHeader *hd = (PVFileHeader *)header;
+    FILE *fout;
+
+    if ((fout = fopen(outpath, "wb")) == NULL)
+        return -1;
+
+    hsize = size / 2;
+    hopsize = size / olaps;
+    factor = sr / (hopsize * TWOPI);
+    scale = TWOPI * hopsize / size;
+    /* Up to the frame whose window holds the last sample. */
+    *numframes = (snd_size + size - 1) / hopsize;
+
+    memset(header, 0, PV_FILE_HEADER_SIZE);
+    memcpy(hd->magic, PV_FILE_MAGIC, 4);
+    hd->version = PV_FILE_VERSION;
+    hd->fftsize = size;
+    hd->olaps = olaps;
+    hd->hsize = hsize;
+    hd->numframes = *numframes;
+    hd->wintype = wintype;
+    hd->sr = (double)sr;
+    fwrite(header, 1, PV_FILE_HEADER_SIZE, fout);
+
+    n8 = size >> 3;
+    inframe = (MYFLT *)malloc(size * sizeof(MYFLT));
+    outframe = (MYFLT *)malloc(size * sizeof(MYFLT));
+    lastPhase = (MYFLT *)calloc(hsize, sizeof(MYFLT));
+    frame = (float *)malloc(size * sizeof(float));
+    twiddle = (MYFLT **)malloc(4 * sizeof(MYFLT *));
+    for(i=0; i<4; i++)
+        twiddle[i] = (MYFLT *)malloc(n8 * sizeof(MYFLT));
+    fft_compute_split_twiddle(twiddle, size);
+    window = (MYFLT *)malloc(size * sizeof(MYFLT));
+    gen_window(window, size, wintype);
+
+    for (f=0; f<*numframes; f++) {
+        start = (f + 1) * hopsize - size;
+        mod = hopsize * (f % olaps);
+        for (k=0; k<size; k++) {
+            i = start + k;
+            inframe[(k+mod)%size] = (i >= 0 && i < snd_size) ? snd[i] * window[k] : 0.0;
+        }
+        realfft_split(inframe, outframe, size, twiddle);
+        for (k=0; k<hsize; k++) {
+            re = outframe[k];
+            im = k == 0 ? 0.0 : outframe[size - k];
+            phase = MYATAN2(im, re);
+            tmp = phase - lastPhase[k];
+            lastPhase[k] = phase;
+            while (tmp > PI) tmp -= TWOPI;
+            while (tmp < -PI) tmp += TWOPI;
+            frame[k] = (float)MYSQRT(re*re + im*im);
+            frame[hsize+k] = (float)((tmp + k * scale) * factor);
+        }
+        fwrite(frame, sizeof(float), size, fout);
+    }
+
+    fclose(fout);
+
+    free(inframe);
+    free(outframe);
+    free(lastPhase);
+    free(frame);
+    for(i=0; i<4; i++)
+        free(twiddle[i]);
+    free(twiddle);
+    free(window);
+
+    return 0;
+}
+
+static PyObject *
+pvanalysis(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    int i, err = 0, numframes = 0;
+    char *inpath = NULL;
+    char *outpath;
+    SNDFILE *sf;
+    SF_INFO info;
+    unsigned int snd_size = 0, snd_chnls, num_items;
+    MYFLT snd_sr = 44100.0;
+    MYFLT *tmp, *data, *samples = NULL;
+    PyObject *input, *base_objs, *tablestream;
+    int size = 1024, olaps = 4, wintype = 2, k;
+    static char *kwlist[] = {"input", "outfile", "size", "olaps", "wintype", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "Os|iii", kwlist, &input, &outpath, &size, &olaps, &wintype))
+        return PyInt_FromLong(-1);
+
+    k = 16;
+    while (k < size)
+        k *= 2;
+    size = k;
+    k = 1;
+    while (k < olaps)
+        k *= 2;
+    olaps = k < size ? k : size / 2;
+
+    if (PyString_Check(input))
+        inpath = PyString_AsString(input);
+    else {
+        /* Table input, the samples are copied while we hold the GIL. */
+        base_objs = PyObject_GetAttrString(input, "_base_objs");
+        if (base_objs == NULL || !PyList_Check(base_objs) || PyList_Size(base_objs) < 1) {
+            PyErr_Clear();
+            Py_XDECREF(base_objs);
+            printf("pvanalysis: input must be a path or a PyoTableObject.\n");
+            return PyInt_FromLong(-1);
+        }
+        tablestream = PyObject_CallMethod(PyList_GetItem(base_objs, 0), "getTableStream", NULL);
+        Py_DECREF(base_objs);
+        if (tablestream == NULL) {
+            PyErr_Clear();
+            printf("pvanalysis: input must be a path or a PyoTableObject.\n");
+            return PyInt_FromLong(-1);
+        }
+        snd_size = TableStream_getSize(tablestream);
+        snd_sr = TableStream_getSamplingRate(tablestream);
+        data = TableStream_getData(tablestream);
+        samples = (MYFLT *)malloc((snd_size > 0 ? snd_size : 1) * sizeof(MYFLT));
+        for (i=0; i<snd_size; i++)
+            samples[i] = data[i];
+        Py_DECREF(tablestream);
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+
+    if (inpath != NULL) {
+        /* opening input soundfile, mixed down to mono */
+        info.format = 0;
+        sf = sf_open(inpath, SFM_READ, &info);
+        if (sf == NULL)
+            err = 1;
+        else {
+            snd_size = info.frames;
+            snd_sr = info.samplerate;
+            snd_chnls = info.channels;
+            num_items = snd_size * snd_chnls;
+            tmp = (MYFLT *)malloc(num_items * sizeof(MYFLT));
+            sf_seek(sf, 0, SEEK_SET);
+            SF_READ(sf, tmp, num_items);
+            sf_close(sf);
+            samples = (MYFLT *)calloc(snd_size > 0 ? snd_size : 1, sizeof(MYFLT));
+            for (i=0; i<num_items; i++)
+                samples[i/snd_chnls] += tmp[i];
+            for (i=0; i<snd_size; i++)
+                samples[i] /= snd_chnls;
+            free(tmp);
+        }
+    }
+
+    if (err == 0) {
+        if (pvanalysis_process(samples, snd_size, snd_sr, outpath, size, olaps, wintype, &numframes) < 0)
+            err = 2;
+        free(samples);
+    }
+
+    Py_END_ALLOW_THREADS
+
+    if (err == 1) {
+        printf("pvanalysis: failed to open the input file %s.\n", inpath);
+        return PyInt_FromLong(-1);
+    }
+    else if (err == 2) {
+        printf("pvanalysis: failed to open output file %s.\n", outpath);
+        return PyInt_FromLong(-1);
+    }
+
+    return Py_BuildValue("id", numframes, (double)snd_sr * olaps / size);
+}
+
 /****** Algorithm utilities ******/
 #define reducePoints_info \
 "\nDouglas-Peucker curve reduction algorithm.\n\n\
@@ -2217,6 +2760,8 @@ static PyMethodDef pyo_functions[] = {
 {"savefileFromTable", (PyCFunction)savefileFromTable, METH_VARARGS|METH_KEYWORDS, savefileFromTable_info},
 {"upsamp", (PyCFunction)upsamp, METH_VARARGS|METH_KEYWORDS, upsamp_info},
 {"downsamp", (PyCFunction)downsamp, METH_VARARGS|METH_KEYWORDS, downsamp_info},
+{"sndfeatures", (PyCFunction)sndfeatures, METH_VARARGS|METH_KEYWORDS, sndfeatures_info},
+{"pvanalysis", (PyCFunction)pvanalysis, METH_VARARGS|METH_KEYWORDS, pvanalysis_info},
 {"reducePoints", (PyCFunction)reducePoints, METH_VARARGS|METH_KEYWORDS, reducePoints_info},
 {"distanceToSegment", (PyCFunction)distanceToSegment, METH_VARARGS|METH_KEYWORDS, distanceToSegment_info},
 {"rescale", (PyCFunction)rescale, METH_VARARGS|METH_KEYWORDS, rescale_info},
@@ -2242,10 +2787,12 @@ module_add_object(PyObject *module, const char *name, PyTypeObject *type) {
 }
 
 PyMODINIT_FUNC
-#ifndef USE_DOUBLE
-init_pyo(void)
-#else
+#if defined(USE_DOUBLE)
 init_pyo64(void)
+#elif defined(USE_MIXED)
+init_pyomx(void)
+#else
+init_pyo(void)
 #endif
 {
     PyObject *m;
@@ -2253,7 +2800,9 @@ init_pyo64(void)
     m = Py_InitModule3(LIB_BASE_NAME, pyo_functions, "Python digital signal processing module.");
 
 #ifndef NO_MESSAGES
-#ifndef USE_DOUBLE
+#if defined(USE_MIXED)
+    printf("pyo version %s (uses single precision, double precision states)\n", PYO_VERSION);
+#elif !defined(USE_DOUBLE)
     printf("pyo version %s (uses single precision)\n", PYO_VERSION);
 #else
     printf("pyo version %s (uses double precision)\n", PYO_VERSION);
@@ -2282,6 +2831,7 @@ init_pyo64(void)
     module_add_object(m, "Adsr_base", &AdsrType);
     module_add_object(m, "Linseg_base", &LinsegType);
     module_add_object(m, "Expseg_base", &ExpsegType);
+    module_add_object(m, "Automation_base", &AutomationType);
     module_add_object(m, "HarmTable_base", &HarmTableType);
     module_add_object(m, "ChebyTable_base", &ChebyTableType);
     module_add_object(m, "HannTable_base", &HannTableType);
@@ -2374,6 +2924,8 @@ init_pyo64(void)
     module_add_object(m, "Allpass_base", &AllpassType);
     module_add_object(m, "Allpass2_base", &Allpass2Type);
     module_add_object(m, "Phaser_base", &PhaserType);
+    module_add_object(m, "MultiPhaserMain_base", &MultiPhaserMainType);
+    module_add_object(m, "MultiPhaser_base", &MultiPhaserType);
     module_add_object(m, "Vocoder_base", &VocoderType);
     module_add_object(m, "Port_base", &PortType);
     module_add_object(m, "Denorm_base", &DenormType);
@@ -2451,6 +3003,8 @@ init_pyo64(void)
     module_add_object(m, "Freeverb_base", &FreeverbType);
     module_add_object(m, "WGVerb_base", &WGVerbType);
     module_add_object(m, "Chorus_base", &ChorusType);
+    module_add_object(m, "MultiChorusMain_base", &MultiChorusMainType);
+    module_add_object(m, "MultiChorus_base", &MultiChorusType);
     module_add_object(m, "Convolve_base", &ConvolveType);
     module_add_object(m, "IRWinSinc_base", &IRWinSincType);
     module_add_object(m, "IRPulse_base", &IRPulseType);
@@ -2459,6 +3013,8 @@ init_pyo64(void)
     module_add_object(m, "Granulator_base", &GranulatorType);
     module_add_object(m, "Looper_base", &LooperType);
     module_add_object(m, "Harmonizer_base", &HarmonizerType);
+    module_add_object(m, "MultiHarmonizerMain_base", &MultiHarmonizerMainType);
+    module_add_object(m, "MultiHarmonizer_base", &MultiHarmonizerType);
     module_add_object(m, "Print_base", &PrintType);
     module_add_object(m, "M_Sin_base", &M_SinType);
     module_add_object(m, "M_Cos_base", &M_CosType);
@@ -2504,6 +3060,8 @@ init_pyo64(void)
     module_add_object(m, "SVF_base", &SVFType);
     module_add_object(m, "Average_base", &AverageType);
     module_add_object(m, "CvlVerb_base", &CvlVerbType);
+    module_add_object(m, "CvlMatrixMain_base", &CvlMatrixMainType);
+    module_add_object(m, "CvlMatrix_base", &CvlMatrixType);
     module_add_object(m, "Spectrum_base", &SpectrumType);
     module_add_object(m, "Reson_base", &ResonType);
     module_add_object(m, "Resonx_base", &ResonxType);
@@ -2529,10 +3087,12 @@ init_pyo64(void)
     module_add_object(m, "PVBufLoops_base", &PVBufLoopsType);
     module_add_object(m, "PVBufTabLoops_base", &PVBufTabLoopsType);
     module_add_object(m, "PVMix_base", &PVMixType);
+    module_add_object(m, "PVRead_base", &PVReadType);
     module_add_object(m, "Granule_base", &GranuleType);
     module_add_object(m, "TableScale_base", &TableScaleType);
     module_add_object(m, "TrackHold_base", &TrackHoldType);
     module_add_object(m, "ComplexRes_base", &ComplexResType);
+    module_add_object(m, "ModalBank_base", &ModalBankType);
     module_add_object(m, "STReverb_base", &STReverbType);
     module_add_object(m, "STRev_base", &STRevType);
     module_add_object(m, "Pointer2_base", &Pointer2Type);
@@ -2551,6 +3111,17 @@ init_pyo64(void)
     module_add_object(m, "Particle_base", &ParticleType);
     module_add_object(m, "AtanTable_base", &AtanTableType);
     module_add_object(m, "RawMidi_base", &RawMidiType);
+    module_add_object(m, "Noteout_base", &NoteoutType);
+    module_add_object(m, "Ctlout_base", &CtloutType);
+    module_add_object(m, "Bendout_base", &BendoutType);
+    module_add_object(m, "Domain_base", &DomainType);
+    module_add_object(m, "DomainIn_base", &DomainInType);
+    module_add_object(m, "DomainOut_base", &DomainOutType);
+    module_add_object(m, "BusIn_base", &BusInType);
+    module_add_object(m, "PluginLib_base", &PluginLibType);
+    module_add_object(m, "Plugin_base", &PluginType);
+    module_add_object(m, "StepSeqer_base", &StepSeqerType);
+    module_add_object(m, "StepSeq_base", &StepSeqType);
 
     PyModule_AddStringConstant(m, "PYO_VERSION", PYO_VERSION);
 #ifdef COMPILE_EXTERNALS
@@ -2564,4 +3135,9 @@ init_pyo64(void)
 #else
     PyModule_AddIntConstant(m, "USE_DOUBLE", 1);
 #endif
+#ifdef USE_MIXED
+    PyModule_AddIntConstant(m, "USE_MIXED", 1);
+#else
+    PyModule_AddIntConstant(m, "USE_MIXED", 0);
+#endif
 }
\ No newline at end of file
@@ -25,8 +25,18 @@
 #include <time.h>
 #include <stdlib.h>
 #include <pthread.h>
+#include <sys/time.h>
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 
 #include "structmember.h"
+#include "frameobject.h"
 #include "portaudio.h"
 #include "portmidi.h"
 #include "porttime.h"
@@ -34,6 +44,7 @@
 #include "streammodule.h"
 #include "pyomodule.h"
 #include "servermodule.h"
+#include "pyortcheck.h"
 
 
 #define MAX_NBR_SERVER 256
@@ -46,14 +57,15 @@ static PyObject *Server_stop(Server *self);
 static void Server_process_gui(Server *server);
 static void Server_process_time(Server *server);
 static inline void Server_process_buffers(Server *server);
+static void Server_rtApply(Server *self);
 static int Server_start_rec_internal(Server *self, char *filename);
 
 /* random objects count and multiplier to assign different seed to each instance. */
-#define num_rnd_objs 29
+#define num_rnd_objs 30
 
-int rnd_objs_count[num_rnd_objs] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+int rnd_objs_count[num_rnd_objs] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
 int rnd_objs_mult[num_rnd_objs] = {1993,1997,1999,2003,2011,2017,2027,2029,2039,2053,2063,2069,
-                         2081,2083,2087,2089,2099,2111,2113,2129,2131,2137,2141,2143,2153,2161,2179,2203,2207};
+                         2081,2083,2087,2089,2099,2111,2113,2129,2131,2137,2141,2143,2153,2161,2179,2203,2207,2213};
 
 #ifdef USE_COREAUDIO
 static int coreaudio_stop_callback(Server *self);
@@ -1327,9 +1339,636 @@ Server_embedded_stop(Server *self)
     return 0;
 }
 
+/******* Synchronous processing *******/
+/* Server.process() computes blocks in the calling thread, reading the input
+** from and writing the output to objects exporting the buffer protocol
+** (numpy arrays, ctypes arrays, ...) of C-contiguous float32 or float64
+** samples, shaped (frames,) for the first channel or (frames, channels). */
+
+typedef struct {
+    Py_buffer view;
+    int isdouble;
+    Py_ssize_t frames;
+    int chnls;
+} ServerProcessBuffer;
+
+static int
+Server_process_getBuffer(PyObject *obj, ServerProcessBuffer *buf, int writable)
+{
+    const char *format;
+
+    if (PyObject_GetBuffer(obj, &buf->view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0)) < 0)
+        return -1;
+
+    format = buf->view.format == NULL ? "B" : buf->view.format;
+    if (*format == '@' || *format == '=' || *format == '<')
+        format++;
+    if (strcmp(format, "f") == 0 && buf->view.itemsize == sizeof(float))
+        buf->isdouble = 0;
+    else if (strcmp(format, "d") == 0 && buf->view.itemsize == sizeof(double))
+        buf->isdouble = 1;
+    else {
+        PyErr_SetString(PyExc_TypeError, "Server.process: buffers must hold float32 or float64 native samples.");
+        PyBuffer_Release(&buf->view);
+        return -1;
+    }
+
+    if (buf->view.ndim == 1) {
+        buf->frames = buf->view.shape[0];
+        buf->chnls = 1;
+    }
+    else if (buf->view.ndim == 2) {
+        buf->frames = buf->view.shape[0];
+        buf->chnls = buf->view.shape[1];
+    }
+    else {
+        PyErr_SetString(PyExc_ValueError, "Server.process: buffers must have 1 or 2 dimensions.");
+        PyBuffer_Release(&buf->view);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject *
+Server_process(Server *self, PyObject *args)
+{
+    int i, j, n, chnls, blocks = -1, block, bufsize = self->bufferSize;
+    Py_ssize_t frame, frames = -1;
+    PyObject *input = Py_None, *output = Py_None;
+    ServerProcessBuffer in, out;
+
+    if (! PyArg_ParseTuple(args, "|OOi", &input, &output, &blocks))
+        return NULL;
+
+    if (self->server_booted == 0 || self->server_started == 1) {
+        PyErr_SetString(PyExc_RuntimeError, "Server.process: the server must be booted and not started.");
+        return NULL;
+    }
+
+    if (input != Py_None) {
+        if (Server_process_getBuffer(input, &in, 0) < 0)
+            return NULL;
+        frames = in.frames;
+    }
+    if (output != Py_None) {
+        if (Server_process_getBuffer(output, &out, 1) < 0) {
+            if (input != Py_None)
+                PyBuffer_Release(&in.view);
+            return NULL;
+        }
+        if (frames < 0 || out.frames < frames)
+            frames = out.frames;
+    }
+    if (blocks >= 0)
+        frames = (Py_ssize_t)blocks * bufsize;
+    else if (frames < 0)
+        frames = bufsize;
+
+    /* The fade set up by start() is applied from the current amplitude. */
+    if (self->timeStep == 0) {
+        self->timeStep = (int)(0.01 * self->samplingRate);
+        self->timeCount = self->timeStep;
+        self->currentAmp = self->lastAmp = self->amp;
+    }
+
+    for (frame=0, block=0; frame<frames; frame+=bufsize, block++) {
+        n = frames - frame < bufsize ? (int)(frames - frame) : bufsize;
+        if (input != Py_None) {
+            chnls = in.chnls < self->ichnls ? in.chnls : self->ichnls;
+            memset(self->input_buffer, 0, bufsize * self->ichnls * sizeof(MYFLT));
+            for (i=0; i<n && frame+i<in.frames; i++) {
+                for (j=0; j<chnls; j++) {
+                    if (in.isdouble)
+                        self->input_buffer[i*self->ichnls+j] = (MYFLT)((double *)in.view.buf)[(frame+i)*in.chnls+j];
+                    else
+                        self->input_buffer[i*self->ichnls+j] = (MYFLT)((float *)in.view.buf)[(frame+i)*in.chnls+j];
+                }
+            }
+        }
+        Server_process_buffers(self);
+        if (output != Py_None) {
+            chnls = out.chnls < self->nchnls ? out.chnls : self->nchnls;
+            for (i=0; i<n && frame+i<out.frames; i++) {
+                for (j=0; j<chnls; j++) {
+                    if (out.isdouble)
+                        ((double *)out.view.buf)[(frame+i)*out.chnls+j] = self->output_buffer[i*self->nchnls+j];
+                    else
+                        ((float *)out.view.buf)[(frame+i)*out.chnls+j] = self->output_buffer[i*self->nchnls+j];
+                }
+            }
+        }
+    }
+
+    if (input != Py_None)
+        PyBuffer_Release(&in.view);
+    if (output != Py_None)
+        PyBuffer_Release(&out.view);
+
+    return PyInt_FromLong((long)frames);
+}
+
+/* Midi output scheduler. Objects post messages from the audio thread with
+   the offset of the event in the current buffer. Timestamps are derived from
+   the sample clock and a thread writes the messages on the output streams
+   when they are due, so the timing doesn't depend on python scheduling.
+   The python methods (noteout, ctlout, ...) use a second queue drained by
+   the same thread, which is the only one calling Pm_Write. Each queue has a
+   single producer. The thread sleeps until the next message is due or a
+   producer posts a new one, then hands the due messages to PortMidi, which
+   emits them at their timestamp plus the streams' latency. */
+#define MIDIOUT_QUEUE_SIZE 1024
+#define MIDIOUT_MARGIN 5 /* ms added to the buffer duration to absorb the audio callback jitter */
+#define MIDIOUT_LATENCY 5 /* ms, latency of every output stream, absorbs the thread wake-up */
+
+#if defined(__APPLE__)
+#define MIDIOUT_POST(s) dispatch_semaphore_signal((s)->midiout_wake)
+#else
+#define MIDIOUT_POST(s) sem_post(&(s)->midiout_wake)
+#endif
+
+static void
+Server_midiout_anchor(Server *self)
+{
+    self->midiout_origin = Pt_Time() + MIDIOUT_MARGIN + self->bufferSize * 1000.0 / self->samplingRate
+                           - self->elapsedSamples * 1000.0 / self->samplingRate;
+}
+
+static void
+Server_midiout_push(Server *self, PmEvent *queue, volatile long *head, volatile long *tail,
+                    PmMessage message, PmTimestamp timestamp)
+{
+    PmEvent *ev;
+    long h = *head;
+
+    if (!self->midiout_running || (h - *tail) >= MIDIOUT_QUEUE_SIZE) {
+        __sync_fetch_and_add(&self->midiout_dropped, 1);
+        return;
+    }
+    ev = &queue[h % MIDIOUT_QUEUE_SIZE];
+    ev->message = message;
+    ev->timestamp = timestamp;
+    __sync_synchronize();
+    *head = h + 1;
+    MIDIOUT_POST(self);
+}
+
+/* Timestamp of the sample at `offset` in the current buffer. */
+PmTimestamp
+Server_midiOutTime(Server *self, int offset)
+{
+    return (PmTimestamp)(self->midiout_origin + (self->elapsedSamples + offset) * 1000.0 / self->samplingRate);
+}
+
+/* To be called from the audio thread only. */
+void
+Server_midiOutPost(Server *self, PmMessage message, int offset)
+{
+    Server_midiout_push(self, self->midiout_queue, &self->midiout_head, &self->midiout_tail,
+                        message, Server_midiOutTime(self, offset));
+}
+
+/* To be called from the python thread only, with a Pt_Time() timestamp. */
+void
+Server_midiOutSend(Server *self, PmMessage message, PmTimestamp timestamp)
+{
+    Server_midiout_push(self, self->midiout_pyqueue, &self->midiout_pyhead, &self->midiout_pytail,
+                        message, timestamp);
+}
+
+/* Called once per buffer: follows the drift between the sample clock and the midi timer. */
+static inline void
+Server_midiout_sync(Server *self)
+{
+    double expected, now;
+
+    if (!self->midiout_running)
+        return;
+    expected = self->midiout_origin + self->elapsedSamples * 1000.0 / self->samplingRate;
+    now = Pt_Time();
+    if (expected < now || expected > (now + MIDIOUT_MARGIN + 3 * self->bufferSize * 1000.0 / self->samplingRate))
+        Server_midiout_anchor(self);
+}
+
+/* Moves the new messages of a queue to the pending list, kept sorted by
+   timestamp. Messages with the same timestamp stay in arrival order. */
+static int
+Server_midiout_drain(PmEvent *queue, volatile long *head, volatile long *tail, PmEvent *pending, int count, int size)
+{
+    int i;
+    PmEvent ev;
+
+    __sync_synchronize();
+    while (*tail < *head && count < size) {
+        ev = queue[*tail % MIDIOUT_QUEUE_SIZE];
+        __sync_synchronize();
+        (*tail)++;
+        for (i=count; i>0 && pending[i-1].timestamp > ev.timestamp; i--)
+            pending[i] = pending[i-1];
+        pending[i] = ev;
+        count++;
+    }
+    return count;
+}
+
+/* Waits for a post from a producer, at most `ms` milliseconds if positive. */
+static void
+Server_midiout_wait(Server *self, int ms)
+{
+#if defined(__APPLE__)
+    dispatch_semaphore_wait(self->midiout_wake, ms < 0 ? DISPATCH_TIME_FOREVER :
+                            dispatch_time(DISPATCH_TIME_NOW, (int64_t)ms * 1000000));
+#else
+    struct timespec ts;
+
+    if (ms < 0) {
+        sem_wait(&self->midiout_wake);
+        return;
+    }
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += ms / 1000;
+    ts.tv_nsec += (long)(ms % 1000) * 1000000;
+    if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+    sem_timedwait(&self->midiout_wake, &ts);
+#endif
+}
+
+static void *
+Server_midiout_run(void *arg)
+{
+    int i, k, closing, count = 0;
+    PmTimestamp now;
+    PmEvent pending[2 * MIDIOUT_QUEUE_SIZE];
+    Server *self = (Server *)arg;
+
+    for (;;) {
+        closing = self->midiout_closing;
+        count = Server_midiout_drain(self->midiout_queue, &self->midiout_head, &self->midiout_tail,
+                                     pending, count, 2 * MIDIOUT_QUEUE_SIZE);
+        count = Server_midiout_drain(self->midiout_pyqueue, &self->midiout_pyhead, &self->midiout_pytail,
+                                     pending, count, 2 * MIDIOUT_QUEUE_SIZE);
+
+        now = Pt_Time();
+        for (i=0; i<count && (pending[i].timestamp <= now || closing); i++) {
+            for (k=0; k<self->midiout_count; k++) {
+                Pm_Write(self->midiout[k], &pending[i], 1);
+            }
+        }
+        if (i > 0) {
+            count -= i;
+            memmove(pending, pending + i, count * sizeof(PmEvent));
+        }
+
+        if (closing)
+            break;
+        /* Messages left are all in the future, sleeps until the first one. */
+        Server_midiout_wait(self, count > 0 ? (int)(pending[0].timestamp - now) : -1);
+    }
+    return NULL;
+}
+
+static void
+Server_midiout_start(Server *self)
+{
+    if (self->midiout_queue == NULL)
+        self->midiout_queue = (PmEvent *)malloc(MIDIOUT_QUEUE_SIZE * sizeof(PmEvent));
+    if (self->midiout_pyqueue == NULL)
+        self->midiout_pyqueue = (PmEvent *)malloc(MIDIOUT_QUEUE_SIZE * sizeof(PmEvent));
+    if (self->midiout_queue == NULL || self->midiout_pyqueue == NULL) {
+        Server_warning(self, "Portmidi warning: could not allocate the midi output queues.\n");
+        return;
+    }
+    self->midiout_head = self->midiout_tail = 0;
+    self->midiout_pyhead = self->midiout_pytail = 0;
+    self->midiout_closing = 0;
+    Server_midiout_anchor(self);
+#if defined(__APPLE__)
+    self->midiout_wake = dispatch_semaphore_create(0);
+#else
+    sem_init(&self->midiout_wake, 0, 0);
+#endif
+    if (pthread_create(&self->midiout_thread, NULL, Server_midiout_run, self) == 0)
+        self->midiout_running = 1;
+    else {
+        Server_warning(self, "Portmidi warning: could not start the midi output thread.\n");
+#if defined(__APPLE__)
+        dispatch_release(self->midiout_wake);
+#else
+        sem_destroy(&self->midiout_wake);
+#endif
+    }
+}
+
+static void
+Server_midiout_stop(Server *self)
+{
+    if (!self->midiout_running)
+        return;
+    self->midiout_running = 0;
+    __sync_synchronize();
+    self->midiout_closing = 1;
+    MIDIOUT_POST(self);
+    pthread_join(self->midiout_thread, NULL);
+#if defined(__APPLE__)
+    dispatch_release(self->midiout_wake);
+#else
+    sem_destroy(&self->midiout_wake);
+#endif
+    if (self->midiout_dropped > 0)
+        Server_warning(self, "Portmidi warning: %ld midi output messages dropped.\n", self->midiout_dropped);
+    self->midiout_dropped = 0;
+}
+
+/***************************************************/
+/*  Aux buses                                      */
+
+/* Push model summing: each send is accumulated into its bus right after
+** its stream computed, so a send costs one multiply-add pass and no object. */
+static void
+Server_process_sends(Server *server, Stream *stream)
+{
+    int i, j, bufsize = server->bufferSize;
+    MYFLT gain, inc;
+    MYFLT *bus;
+    MYFLT *data = Stream_getData(stream);
+    StreamSend *send;
+
+    for (i=0; i<stream->numsends; i++) {
+        send = &stream->sends[i];
+        bus = server->buses + send->bus * bufsize;
+        if (send->gain == send->lastgain) {
+            gain = send->gain;
+            for (j=0; j<bufsize; j++)
+                bus[j] += data[j] * gain;
+        }
+        else {
+            gain = send->lastgain;
+            inc = (send->gain - gain) / bufsize;
+            for (j=0; j<bufsize; j++) {
+                gain += inc;
+                bus[j] += data[j] * gain;
+            }
+            send->lastgain = send->gain;
+        }
+    }
+}
+
+/* Returns the bus samples, or NULL if nothing was ever sent to it. */
+MYFLT *
+Server_getBusBuffer(Server *self, int bus)
+{
+    if (bus < 0 || bus >= self->bus_count)
+        return NULL;
+    return self->buses + bus * self->bufferSize;
+}
+
+static int
+Server_allocateBuses(Server *self, int count)
+{
+    MYFLT *tmp = (MYFLT *)realloc(self->buses, count * self->bufferSize * sizeof(MYFLT));
+    if (tmp == NULL)
+        return -1;
+    self->buses = tmp;
+    self->bus_count = count;
+    memset(self->buses, 0, count * self->bufferSize * sizeof(MYFLT));
+    return 0;
+}
+
+/***************************************************/
+/*  Real-time violations detector                  */
+
+/* The detector is a library preloaded with LD_PRELOAD (src/rtcheck), its
+** functions are looked up at run time so _pyo doesn't depend on it. */
+static pyo_rtcheck_set_context_t rtcheck_set_context = NULL;
+static pyo_rtcheck_get_report_t rtcheck_get_report = NULL;
+static pyo_rtcheck_reset_t rtcheck_reset = NULL;
+
+static const char *rtcheck_kinds[PYO_RT_KINDS] = {"malloc", "free", "file", "print", "socket", "lock", "sleep"};
+
+static int
+Server_rtcheck_load()
+{
+#ifndef _WIN32
+    if (rtcheck_set_context == NULL) {
+        *(void **)(&rtcheck_get_report) = dlsym(RTLD_DEFAULT, PYO_RT_GET_REPORT);
+        *(void **)(&rtcheck_reset) = dlsym(RTLD_DEFAULT, PYO_RT_RESET);
+        *(void **)(&rtcheck_set_context) = dlsym(RTLD_DEFAULT, PYO_RT_SET_CONTEXT);
+    }
+#endif
+    return rtcheck_set_context != NULL && rtcheck_get_report != NULL && rtcheck_reset != NULL;
+}
+
+/* Attributes the next hits of the audio thread to `stream`, or to the
+** server itself if NULL. */
+void
+Server_rtcheckEnter(Server *self, PyObject *stream)
+{
+    if (!self->rtcheck)
+        return;
+    if (stream == NULL)
+        (*rtcheck_set_context)("Server", 0);
+    else
+        (*rtcheck_set_context)(Py_TYPE(((Stream *)stream)->streamobject)->tp_name, Stream_getStreamId((Stream *)stream));
+}
+
+/* Not conditioned on self->rtcheck, which may be reset by another thread
+** while the audio thread is between enter and leave. */
+static void
+Server_rtcheckLeave(Server *self)
+{
+    if (rtcheck_set_context != NULL)
+        (*rtcheck_set_context)(NULL, 0);
+}
+
+/***************************************************/
+/*  Block timeline tracing                         */
+
+/* Each thread writes its events in its own ring, claimed on first use and
+** remembered in a thread specific key as (session << 8 | ring index + 1),
+** so the audio thread never waits for the threads reading or tracing. A
+** ring's events are allocated by the first thread claiming it, then kept
+** for the next traces of the same size. */
+static pthread_key_t trace_key;
+static pthread_once_t trace_key_once = PTHREAD_ONCE_INIT;
+static int trace_sessions = 0;
+
+static const char *trace_categories[4] = {"callback", "stream", "gil", "python"};
+
+static void
+Server_trace_make_key()
+{
+    pthread_key_create(&trace_key, NULL);
+}
+
+/* Monotonic clock in microseconds, not affected by the system time adjustments. */
+static double
+Server_trace_clock()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000.0 + ts.tv_nsec / 1000.0;
+}
+
+static TraceRing *
+Server_trace_ring(Server *self, int cat)
+{
+    int index;
+    long key = (long)(intptr_t)pthread_getspecific(trace_key);
+
+    if (key != 0 && (key >> 8) == self->trace_session) {
+        index = key & 0xFF;
+        return index == 0 ? NULL : &self->trace_rings[index - 1];
+    }
+
+    index = __sync_fetch_and_add(&self->trace_ring_count, 1);
+    if (index < TRACE_MAX_THREADS && self->trace_rings[index].events == NULL)
+        self->trace_rings[index].events = (TraceEvent *)malloc(self->trace_size * sizeof(TraceEvent));
+    if (index >= TRACE_MAX_THREADS || self->trace_rings[index].events == NULL) {
+        pthread_setspecific(trace_key, (void *)(intptr_t)((long)self->trace_session << 8));
+        return NULL;
+    }
+    strcpy(self->trace_rings[index].thread, cat == TRACE_PYTHON ? "python" : "audio");
+    pthread_setspecific(trace_key, (void *)(intptr_t)(((long)self->trace_session << 8) | (index + 1)));
+    return &self->trace_rings[index];
+}
+
+void
+Server_traceEvent(Server *self, char phase, int cat, const char *name, int id)
+{
+    TraceRing *ring;
+    TraceEvent *ev;
+
+    if (!self->tracing)
+        return;
+
+    ring = Server_trace_ring(self, cat);
+    if (ring == NULL)
+        return;
+
+    ev = &ring->events[ring->head & (self->trace_size - 1)];
+    ev->ts = Server_trace_clock() - self->trace_origin;
+    ev->id = id;
+    ev->phase = phase;
+    ev->cat = cat;
+    if (name != NULL) {
+        strncpy(ev->name, name, TRACE_NAME_SIZE - 1);
+        ev->name[TRACE_NAME_SIZE - 1] = '\0';
+    }
+    else
+        ev->name[0] = '\0';
+    __sync_synchronize();
+    ring->head++;
+}
+
+/* Stream events are sampled, every trace_period blocks. */
+void
+Server_traceStream(Server *self, char phase, PyObject *stream)
+{
+    if (self->trace_now)
+        Server_traceEvent(self, phase, TRACE_STREAM, Py_TYPE(((Stream *)stream)->streamobject)->tp_name,
+                          Stream_getStreamId((Stream *)stream));
+}
+
+/* Python callback dispatched from the audio thread. */
+void
+Server_traceCallable(Server *self, char phase, PyObject *callable)
+{
+    const char *name = NULL;
+
+    if (!self->tracing)
+        return;
+
+    if (phase == 'B') {
+        if (PyMethod_Check(callable))
+            callable = PyMethod_GET_FUNCTION(callable);
+        if (PyFunction_Check(callable))
+            name = PyString_AsString(((PyFunctionObject *)callable)->func_name);
+        else
+            name = Py_TYPE(callable)->tp_name;
+    }
+    Server_traceEvent(self, phase, TRACE_PYTHON, name, 0);
+}
+
+/* Profile function of the python threads, uninstalls itself when the trace stops. */
+static int
+Server_trace_profile(PyObject *obj, PyFrameObject *frame, int what, PyObject *arg)
+{
+    Server *self = (Server *)obj;
+
+    if (!self->tracing) {
+        PyEval_SetProfile(NULL, NULL);
+        return 0;
+    }
+
+    switch (what) {
+        case PyTrace_CALL:
+            Server_traceEvent(self, 'B', TRACE_PYTHON, PyString_AsString(frame->f_code->co_name), 0);
+            break;
+        case PyTrace_C_CALL:
+            if (PyCFunction_Check(arg))
+                Server_traceEvent(self, 'B', TRACE_PYTHON, ((PyCFunctionObject *)arg)->m_ml->ml_name, 0);
+            break;
+        case PyTrace_RETURN:
+            Server_traceEvent(self, 'E', TRACE_PYTHON, NULL, 0);
+            break;
+        case PyTrace_C_RETURN:
+        case PyTrace_C_EXCEPTION:
+            if (PyCFunction_Check(arg))
+                Server_traceEvent(self, 'E', TRACE_PYTHON, NULL, 0);
+            break;
+    }
+    return 0;
+}
+
+/* Writes an event name as a json string, without the "_pyo." and "_base" decorations. */
+static void
+Server_trace_write_name(FILE *f, const char *name)
+{
+    int i, len;
+
+    if (strncmp(name, "_pyo.", 5) == 0)
+        name += 5;
+    len = strlen(name);
+    if (len > 5 && strcmp(name + len - 5, "_base") == 0)
+        len -= 5;
+    fputc('"', f);
+    for (i=0; i<len; i++) {
+        if (name[i] == '"' || name[i] == '\\')
+            fputc('\\', f);
+        fputc(name[i], f);
+    }
+    fputc('"', f);
+}
+
 /***************************************************/
 /*  Main Processing functions                      */
 
+/* Stream_callFunction wrapped by the debugging tools. */
+static void
+Server_debug_callFunction(Server *server, Stream *stream)
+{
+    Server_traceStream(server, 'B', (PyObject *)stream);
+    Server_rtcheckEnter(server, (PyObject *)stream);
+    Stream_callFunction(stream);
+    Server_rtcheckEnter(server, NULL);
+    Server_traceStream(server, 'E', (PyObject *)stream);
+}
+
+/* Called by the audio thread itself, on its first buffer, as the audio
+** backends create their callback thread. */
+static void
+Server_rtApplyAudioThread(Server *server)
+{
+    server->rt_audio_pending = 0;
+    if (server->rt_audio_cpu >= 0 && TaskPool_pinThread(pthread_self(), server->rt_audio_cpu) == 0)
+        server->rt_audio_cpu_done = server->rt_audio_cpu;
+    if (server->rt_priority > 0)
+        server->rt_audio_priority_done = TaskPool_setThreadPriority(pthread_self(), server->rt_priority);
+}
+
 static inline void
 Server_process_buffers(Server *server)
 {
@@ -1341,12 +1980,27 @@ Server_process_buffers(Server *server)
     Stream *stream_tmp;
     MYFLT *data;
 
+    if (server->rt_audio_pending)
+        Server_rtApplyAudioThread(server);
+    Server_traceEvent(server, 'B', TRACE_CALLBACK, "process_buffers", 0);
     memset(&buffer, 0, sizeof(buffer));
+    Server_traceEvent(server, 'B', TRACE_GIL, "GIL wait", 0);
     PyGILState_STATE s = PyGILState_Ensure();
+    Server_traceEvent(server, 'E', TRACE_GIL, NULL, 0);
+    Server_rtcheckEnter(server, NULL);
+    server->trace_now = server->tracing && server->trace_period > 0 && (server->trace_block++ % server->trace_period) == 0;
+    Server_midiout_sync(server);
+    if (server->bus_count > 0)
+        memset(server->buses, 0, server->bus_count * server->bufferSize * sizeof(MYFLT));
     for (i=0; i<server->stream_count; i++) {
         stream_tmp = (Stream *)PyList_GET_ITEM(server->streams, i);
         if (Stream_getStreamActive(stream_tmp) == 1) {
-            Stream_callFunction(stream_tmp);
+            if (server->rtcheck || server->trace_now)
+                Server_debug_callFunction(server, stream_tmp);
+            else
+                Stream_callFunction(stream_tmp);
+            if (stream_tmp->numsends != 0)
+                Server_process_sends(server, stream_tmp);
             if (Stream_getStreamToDac(stream_tmp) != 0) {
                 data = Stream_getData(stream_tmp);
                 chnl = Stream_getStreamChnl(stream_tmp);
@@ -1368,6 +2022,7 @@ Server_process_buffers(Server *server)
         Server_process_time(server);
     }
     server->elapsedSamples += server->bufferSize;
+    Server_rtcheckLeave(server);
     PyGILState_Release(s);
     if (amp != server->lastAmp) {
         server->timeCount = 0;
@@ -1386,7 +2041,7 @@ Server_process_buffers(Server *server)
     }
     if (server->record == 1)
         sf_write_float(server->recfile, out, server->bufferSize * server->nchnls);
-
+    Server_traceEvent(server, 'E', TRACE_CALLBACK, NULL, 0);
 }
 
 static void
@@ -1552,12 +2207,24 @@ Server_clear(Server *self)
 static void
 Server_dealloc(Server* self)
 {
+    int i;
     if (self->server_booted == 1)
         Server_shut_down(self);
     Server_clear(self);
     free(self->input_buffer);
     free(self->output_buffer);
     free(self->serverName);
+    if (self->midiout_queue != NULL)
+        free(self->midiout_queue);
+    if (self->midiout_pyqueue != NULL)
+        free(self->midiout_pyqueue);
+    if (self->buses != NULL)
+        free(self->buses);
+    TaskPool_free(self->taskpool);
+    for (i=0; i<TRACE_MAX_THREADS; i++) {
+        if (self->trace_rings[i].events != NULL)
+            free(self->trace_rings[i].events);
+    }
     my_server[self->thisServerID] = NULL;
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -1565,6 +2232,7 @@ Server_dealloc(Server* self)
 static PyObject *
 Server_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
+    int i;
     /* Unused variables to allow the safety check of the embeded audio backend. */
     double samplingRate = 44100.0;
     int  nchnls = 2;
@@ -1602,6 +2270,7 @@ Server_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     Server *self;
     self = (Server *)type->tp_alloc(type, 0);
+    self->rt_audio_cpu = self->rt_audio_cpu_done = -1;
     self->server_booted = 0;
     self->audio_be_data = NULL;
     self->serverName = (char *) calloc(32, sizeof(char));
@@ -1633,6 +2302,28 @@ Server_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->rectype = 0;
     self->startoffset = 0.0;
     self->globalSeed = 0;
+    self->midiout_queue = NULL;
+    self->midiout_pyqueue = NULL;
+    self->midiout_running = 0;
+    self->midiout_dropped = 0;
+    self->domain = NULL;
+    self->domainFactor = 1;
+    self->domain_count = 0;
+    self->buses = NULL;
+    self->bus_count = 0;
+    self->rtcheck = 0;
+    self->gc_isolation = 0;
+    self->tracing = 0;
+    self->trace_session = 0;
+    self->trace_period = 1;
+    self->trace_now = 0;
+    self->trace_block = 0;
+    self->trace_size = 0;
+    self->trace_ring_count = 0;
+    for (i=0; i<TRACE_MAX_THREADS; i++) {
+        self->trace_rings[i].events = NULL;
+        self->trace_rings[i].head = 0;
+    }
     self->thisServerID = serverID;
     Py_XDECREF(my_server[serverID]);
     my_server[serverID] = (Server *)self;
@@ -1921,6 +2612,207 @@ Server_setJackAutoConnectOutputPorts(Server *self, PyObject *arg)
     return Py_None;
 }
 
+static PyObject *
+Server_setRTCheck(Server *self, PyObject *arg)
+{
+    int check = PyObject_IsTrue(arg);
+
+    if (check == 1 && !Server_rtcheck_load()) {
+        Server_warning(self, "Real-time check unavailable, libpyortcheck is not preloaded (see scripts/compile_rtcheck_linux.sh).\n");
+        check = 0;
+    }
+    self->rtcheck = check == 1 ? 1 : 0;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+/* List of (type name, stream id, {kind: count}) tuples. */
+static PyObject *
+Server_getRTViolations(Server *self)
+{
+    int i, k, count;
+    PyObject *list, *dict, *tmp;
+    PyoRTCheckEntry *entries;
+
+    list = PyList_New(0);
+    if (!Server_rtcheck_load())
+        return list;
+
+    entries = (PyoRTCheckEntry *)PyMem_Malloc(PYO_RT_MAX_ENTRIES * sizeof(PyoRTCheckEntry));
+    if (entries == NULL) {
+        Py_DECREF(list);
+        return PyErr_NoMemory();
+    }
+    count = (*rtcheck_get_report)(entries, PYO_RT_MAX_ENTRIES);
+    for (i=0; i<count; i++) {
+        dict = PyDict_New();
+        for (k=0; k<PYO_RT_KINDS; k++) {
+            if (entries[i].counts[k] == 0)
+                continue;
+            tmp = PyLong_FromUnsignedLong(entries[i].counts[k]);
+            PyDict_SetItemString(dict, rtcheck_kinds[k], tmp);
+            Py_DECREF(tmp);
+        }
+        tmp = Py_BuildValue("(siN)", entries[i].name, entries[i].id, dict);
+        PyList_Append(list, tmp);
+        Py_DECREF(tmp);
+    }
+    PyMem_Free(entries);
+
+    return list;
+}
+
+static PyObject *
+Server_resetRTViolations(Server *self)
+{
+    if (Server_rtcheck_load())
+        (*rtcheck_reset)();
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Server_traceStart(Server *self, PyObject *args, PyObject *kwds)
+{
+    int i, period = 1, python = 0;
+    long size = 65536, tmp = 1;
+
+    static char *kwlist[] = {"size", "period", "python", NULL};
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "|lii", kwlist, &size, &period, &python))
+        return NULL;
+
+    self->tracing = 0;
+    pthread_once(&trace_key_once, Server_trace_make_key);
+
+    while (tmp < size)
+        tmp *= 2;
+    /* The rings can't be reallocated under the feet of a running audio thread. */
+    if (tmp != self->trace_size && self->trace_size != 0 && self->server_started == 1)
+        Server_warning(self, "Server.traceStart: the trace size can't change while the server is running.\n");
+    else if (tmp != self->trace_size) {
+        /* Reallocated at the new size by the threads claiming them. */
+        for (i=0; i<TRACE_MAX_THREADS; i++) {
+            free(self->trace_rings[i].events);
+            self->trace_rings[i].events = NULL;
+        }
+        self->trace_size = tmp;
+    }
+
+    for (i=0; i<TRACE_MAX_THREADS; i++)
+        self->trace_rings[i].head = 0;
+    self->trace_ring_count = 0;
+    self->trace_session = ++trace_sessions;
+    self->trace_period = period < 0 ? 0 : period;
+    self->trace_block = 0;
+    self->trace_origin = Server_trace_clock();
+    __sync_synchronize();
+    self->tracing = 1;
+
+    if (python)
+        PyEval_SetProfile(Server_trace_profile, (PyObject *)self);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Server_traceStop(Server *self)
+{
+    self->tracing = 0;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+/* Installs the profile function in the calling thread. Given to
+** threading.setprofile(), so it replaces itself on the first event. */
+static PyObject *
+Server_traceProfile(Server *self, PyObject *args)
+{
+    if (self->tracing)
+        PyEval_SetProfile(Server_trace_profile, (PyObject *)self);
+    else
+        PyEval_SetProfile(NULL, NULL);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Server_traceBegin(Server *self, PyObject *arg)
+{
+    if (! PyString_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "Server.traceBegin: the event name must be a string.");
+        return NULL;
+    }
+    Server_traceEvent(self, 'B', TRACE_PYTHON, PyString_AsString(arg), 0);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Server_traceEnd(Server *self)
+{
+    Server_traceEvent(self, 'E', TRACE_PYTHON, NULL, 0);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+/* Dumps the rings in the Chrome trace event format (json). */
+static PyObject *
+Server_traceSave(Server *self, PyObject *arg)
+{
+    int i, count, first = 1;
+    long j, head, start;
+    char *filename;
+    FILE *f;
+    TraceRing *ring;
+    TraceEvent *ev;
+
+    if (! PyString_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "Server.traceSave: the filename must be a string.");
+        return NULL;
+    }
+    filename = PyString_AsString(arg);
+
+    f = fopen(filename, "w");
+    if (f == NULL)
+        return PyErr_SetFromErrnoWithFilename(PyExc_IOError, filename);
+
+    count = self->trace_ring_count < TRACE_MAX_THREADS ? self->trace_ring_count : TRACE_MAX_THREADS;
+    fprintf(f, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    for (i=0; i<count; i++) {
+        ring = &self->trace_rings[i];
+        if (ring->events == NULL)
+            continue;
+        fprintf(f, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"%s\"}}",
+                first ? "" : ",\n", i + 1, ring->thread);
+        first = 0;
+        head = ring->head;
+        __sync_synchronize();
+        start = head > self->trace_size ? head - self->trace_size : 0;
+        for (j=start; j<head; j++) {
+            ev = &ring->events[j & (self->trace_size - 1)];
+            fprintf(f, ",\n{\"name\": ");
+            Server_trace_write_name(f, ev->name);
+            fprintf(f, ", \"cat\": \"%s\", \"ph\": \"%c\", \"ts\": %.3f, \"pid\": 1, \"tid\": %d",
+                    trace_categories[(int)ev->cat], ev->phase, ev->ts, i + 1);
+            if (ev->id != 0)
+                fprintf(f, ", \"args\": {\"id\": %d}", ev->id);
+            fputc('}', f);
+        }
+    }
+    fprintf(f, "\n]}\n");
+    fclose(f);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
 static PyObject *
 Server_setGlobalSeed(Server *self, PyObject *arg)
 {
@@ -2163,7 +3055,7 @@ Server_pm_init(Server *self)
                 if (outinfo != NULL) {
                     if (outinfo->output) {
                         Pt_Start(1, 0, 0); /* start a timer with millisecond accuracy */
-                        pmerr = Pm_OpenOutput(&self->midiout[0], self->midi_output, NULL, 0, NULL, NULL, 1);
+                        pmerr = Pm_OpenOutput(&self->midiout[0], self->midi_output, NULL, MIDIOUT_LATENCY, NULL, NULL, 0);
                         if (pmerr) {
                             Server_warning(self,
                                      "Portmidi warning: could not open midi output %d (%s): %s\n",
@@ -2191,7 +3083,7 @@ Server_pm_init(Server *self)
                     const PmDeviceInfo *outinfo = Pm_GetDeviceInfo(i);
                     if (outinfo != NULL) {
                         if (outinfo->output) {
-                            pmerr = Pm_OpenOutput(&self->midiout[self->midiout_count], i, NULL, 100, NULL, NULL, 1);
+                            pmerr = Pm_OpenOutput(&self->midiout[self->midiout_count], i, NULL, MIDIOUT_LATENCY, NULL, NULL, 0);
                             if (pmerr) {
                                 Server_warning(self,
                                      "Portmidi warning: could not open midi output %d (%s): %s\n",
@@ -2233,6 +3125,8 @@ Server_pm_init(Server *self)
             Pm_SetFilter(self->midiin[i], PM_FILT_ACTIVE | PM_FILT_CLOCK);
         }
     }
+    if (self->withPortMidiOut == 1)
+        Server_midiout_start(self);
     return 0;
 }
 
@@ -2316,6 +3210,8 @@ Server_boot(Server *self, PyObject *arg)
         }
         self->output_buffer = (float *)calloc(self->bufferSize * self->nchnls, sizeof(float));
     }
+    if (self->bus_count > 0)
+        Server_allocateBuses(self, self->bus_count);
     for (i=0; i<self->bufferSize*self->ichnls; i++) {
         self->input_buffer[i] = 0.0;
     }
@@ -2324,6 +3220,7 @@ Server_boot(Server *self, PyObject *arg)
     }
     if (audioerr == 0) {
         self->server_booted = 1;
+        Server_rtApply(self);
     }
     else {
         self->server_booted = 0;
@@ -2334,6 +3231,155 @@ Server_boot(Server *self, PyObject *arg)
     return Py_None;
 }
 
+/* Writes every page, keeping its content, so that the audio thread
+** doesn't take the page faults on its first pass. */
+static void
+Server_prefault(void *ptr, size_t bytes)
+{
+#ifndef _WIN32
+    size_t i, page = (size_t)sysconf(_SC_PAGESIZE);
+    volatile char *p = (volatile char *)ptr;
+
+    for (i=0; i<bytes; i+=page)
+        p[i] = p[i];
+    if (bytes > 0)
+        p[bytes-1] = p[bytes-1];
+#endif
+}
+
+/* Prefaulting hook for the objects' work buffers that are not written at
+** their creation (calloc'ed, or filled later by the audio thread). Does
+** nothing if prefaulting is disabled. */
+void
+Server_prefaultMemory(Server *self, void *ptr, size_t bytes)
+{
+    if (self != NULL && self->rt_prefault && ptr != NULL)
+        Server_prefault(ptr, bytes);
+}
+
+static void
+Server_rtReport(Server *self)
+{
+    int i;
+    char cpus[256] = "";
+
+    Server_message(self, "Real-time settings:\n");
+    if (self->rt_mlock)
+        Server_message(self, "    memory locking: %s\n", self->rt_mlock_done ? "locked (mlockall)" : "failed (check RLIMIT_MEMLOCK)");
+    if (self->rt_prefault)
+        Server_message(self, "    prefaulted heap: %d MB of %d MB\n", self->rt_prefault_done, self->rt_prefault);
+    if (self->rt_audio_cpu >= 0 || self->rt_priority > 0) {
+        if (self->audio_be_type == PyoPortaudio || self->audio_be_type == PyoJack || self->audio_be_type == PyoCoreaudio)
+            Server_message(self, "    audio thread: cpu %d, SCHED_FIFO priority %d, applied on the first buffer\n",
+                           self->rt_audio_cpu, self->rt_priority);
+        else
+            Server_message(self, "    audio thread: left unchanged, no real-time audio backend\n");
+    }
+    if (self->taskpool != NULL) {
+        for (i=0; i<self->taskpool->nthreads && strlen(cpus) < 240; i++)
+            sprintf(cpus + strlen(cpus), i == 0 ? "%d" : ",%d", self->taskpool->cpus[i]);
+        Server_message(self, "    %d worker threads: cpus %s, priority %d\n", self->taskpool->nthreads, cpus,
+                       self->taskpool->priority);
+    }
+}
+
+/* Applies the process-wide settings at boot, reports the effective ones. */
+static void
+Server_rtApply(Server *self)
+{
+    char *reserve;
+    size_t bytes;
+
+    if (!self->rt_mlock && !self->rt_prefault && self->rt_audio_cpu < 0 && self->rt_priority <= 0 && self->rt_worker_cpu_count == 0)
+        return;
+
+#ifndef _WIN32
+    if (self->rt_mlock && !self->rt_mlock_done)
+        self->rt_mlock_done = mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+#endif
+
+    if (self->rt_prefault > self->rt_prefault_done) {
+#ifdef __GLIBC__
+        /* Keeps the freed memory in the heap instead of giving it back to the
+        ** system, so that the objects' allocations reuse prefaulted pages. */
+        mallopt(M_MMAP_MAX, 0);
+        mallopt(M_TRIM_THRESHOLD, -1);
+#endif
+        bytes = (size_t)self->rt_prefault * 1024 * 1024;
+        reserve = (char *)malloc(bytes);
+        if (reserve != NULL) {
+            /* Volatile writes, a memset before free() is removed as a dead store. */
+            Server_prefault(reserve, bytes);
+            free(reserve);
+            self->rt_prefault_done = self->rt_prefault;
+        }
+    }
+
+    TaskPool_configure(self->taskpool, self->rt_worker_cpus, self->rt_worker_cpu_count,
+                       self->rt_priority > 1 ? self->rt_priority - 1 : self->rt_priority);
+
+    Server_rtReport(self);
+}
+
+static PyObject *
+Server_setRealtime(Server *self, PyObject *args)
+{
+    int i;
+    PyObject *workercpus = NULL, *seq;
+
+    if (! PyArg_ParseTuple(args, "iiiOi", &self->rt_mlock, &self->rt_prefault, &self->rt_audio_cpu, &workercpus, &self->rt_priority))
+        return NULL;
+
+    self->rt_worker_cpu_count = 0;
+    if (workercpus != Py_None) {
+        seq = PySequence_Fast(workercpus, "setRealtime: workercpus must be a sequence of ints.");
+        if (seq == NULL)
+            return NULL;
+        for (i=0; i<PySequence_Fast_GET_SIZE(seq) && i<TASKPOOL_MAX_THREADS; i++)
+            self->rt_worker_cpus[i] = PyInt_AsLong(PySequence_Fast_GET_ITEM(seq, i));
+        self->rt_worker_cpu_count = i;
+        Py_DECREF(seq);
+        if (PyErr_Occurred())
+            return NULL;
+    }
+
+    if (self->server_booted)
+        Server_rtApply(self);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Server_getRealtimeReport(Server *self)
+{
+    int i;
+    PyObject *dict = PyDict_New(), *cpus, *tmp;
+
+    tmp = PyBool_FromLong(self->rt_mlock_done);
+    PyDict_SetItemString(dict, "mlock", tmp); Py_DECREF(tmp);
+    tmp = PyInt_FromLong(self->rt_prefault_done);
+    PyDict_SetItemString(dict, "prefault", tmp); Py_DECREF(tmp);
+    tmp = PyInt_FromLong(self->rt_audio_cpu_done);
+    PyDict_SetItemString(dict, "audiocpu", tmp); Py_DECREF(tmp);
+    tmp = PyInt_FromLong(self->rt_audio_priority_done);
+    PyDict_SetItemString(dict, "priority", tmp); Py_DECREF(tmp);
+    tmp = PyBool_FromLong(self->rt_audio_pending);
+    PyDict_SetItemString(dict, "pending", tmp); Py_DECREF(tmp);
+    cpus = PyList_New(0);
+    if (self->taskpool != NULL) {
+        for (i=0; i<self->taskpool->nthreads; i++) {
+            tmp = PyInt_FromLong(self->taskpool->cpus[i]);
+            PyList_Append(cpus, tmp); Py_DECREF(tmp);
+        }
+    }
+    PyDict_SetItemString(dict, "workercpus", cpus); Py_DECREF(cpus);
+    tmp = PyInt_FromLong(self->taskpool == NULL ? 0 : self->taskpool->priority);
+    PyDict_SetItemString(dict, "workerpriority", tmp); Py_DECREF(tmp);
+
+    return dict;
+}
+
 static PyObject *
 Server_start(Server *self)
 {
@@ -2357,6 +3403,10 @@ Server_start(Server *self)
 
     self->server_stopped = 0;
     self->server_started = 1;
+
+    if ((self->rt_audio_cpu >= 0 || self->rt_priority > 0) &&
+        (self->audio_be_type == PyoPortaudio || self->audio_be_type == PyoJack || self->audio_be_type == PyoCoreaudio))
+        self->rt_audio_pending = 1;
     self->timeStep = (int)(0.01 * self->samplingRate);
 
     if (self->audio_be_type != PyoOffline && self->audio_be_type != PyoOfflineNB && self->audio_be_type != PyoEmbedded) {
@@ -2455,6 +3505,7 @@ Server_stop(Server *self)
             }
         }
         if (self->withPortMidiOut == 1) {
+            Server_midiout_stop(self);
             for (i=0; i<self->midiout_count; i++) {
                 Pm_Close(self->midiout[i]);
             }
@@ -2595,6 +3646,103 @@ Server_stop_rec(Server *self, PyObject *args)
     return Py_None;
 }
 
+/* While isolated, the objects are only released by reference counting, the
+** collector doesn't walk them anymore. Streams don't own a reference to
+** their object, so this is safe for the objects themselves; cycles created by
+** the user through them (a Pattern's function referring to the Pattern) are
+** never broken. */
+static void
+Server_gcSetTracked(PyObject *obj, int track)
+{
+    if (!PyObject_IS_GC(obj))
+        return;
+    if (!track && _PyObject_GC_IS_TRACKED(obj))
+        PyObject_GC_UnTrack(obj);
+    else if (track && !_PyObject_GC_IS_TRACKED(obj))
+        PyObject_GC_Track(obj);
+}
+
+static void
+Server_gcIsolateStreams(PyObject *streams, int isolate)
+{
+    int i;
+
+    for (i=0; i<PyList_Size(streams); i++)
+        Server_gcSetTracked(((Stream *)PyList_GET_ITEM(streams, i))->streamobject, !isolate);
+}
+
+/* Also (un)tracks the python objects given in the optional sequence (the
+** PyoObjects, their dictionaries, ...). */
+static PyObject *
+Server_setGCIsolation(Server *self, PyObject *args)
+{
+    int i, isolate;
+    PyObject *arg, *objects = NULL, *seq;
+
+    if (! PyArg_ParseTuple(args, "O|O", &arg, &objects))
+        return NULL;
+
+    isolate = PyObject_IsTrue(arg) == 1 ? 1 : 0;
+
+    Server_gcIsolateStreams(self->streams, isolate);
+    for (i=0; i<self->domain_count; i++)
+        Server_gcIsolateStreams(Domain_getStreamList(self->domains[i]), isolate);
+
+    if (objects != NULL && objects != Py_None) {
+        seq = PySequence_Fast(objects, "setGCIsolation: objects must be a sequence.");
+        if (seq == NULL)
+            return NULL;
+        for (i=0; i<PySequence_Fast_GET_SIZE(seq); i++)
+            Server_gcSetTracked(PySequence_Fast_GET_ITEM(seq, i), !isolate);
+        Py_DECREF(seq);
+    }
+
+    self->gc_isolation = isolate;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+TaskPool *
+Server_getTaskPool(Server *self)
+{
+    return self->taskpool;
+}
+
+/* The pool is replaced while holding the GIL, never during a buffer. */
+static PyObject *
+Server_setTaskThreads(Server *self, PyObject *arg)
+{
+    int nthreads;
+
+    if (! PyInt_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "setTaskThreads: argument must be an integer.");
+        return NULL;
+    }
+
+    nthreads = PyInt_AsLong(arg);
+    if (nthreads > TASKPOOL_MAX_THREADS) {
+        Server_warning(self, "setTaskThreads: number of threads limited to %d.\n", TASKPOOL_MAX_THREADS);
+        nthreads = TASKPOOL_MAX_THREADS;
+    }
+
+    TaskPool_free(self->taskpool);
+    self->taskpool = TaskPool_new(nthreads);
+    if (nthreads > 0 && self->taskpool == NULL)
+        Server_error(self, "setTaskThreads: unable to start the worker threads.\n");
+    TaskPool_configure(self->taskpool, self->rt_worker_cpus, self->rt_worker_cpu_count,
+                       self->rt_priority > 1 ? self->rt_priority - 1 : self->rt_priority);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Server_getTaskThreads(Server *self)
+{
+    return PyInt_FromLong(self->taskpool == NULL ? 0 : self->taskpool->nthreads);
+}
+
 static PyObject *
 Server_addStream(Server *self, PyObject *args)
 {
@@ -2608,6 +3756,17 @@ Server_addStream(Server *self, PyObject *args)
         return PyInt_FromLong(-1);
     }
 
+    if (self->gc_isolation)
+        Server_gcSetTracked(((Stream *)tmp)->streamobject, 0);
+
+    Server_prefaultMemory(self, Stream_getData((Stream *)tmp), self->bufferSize * sizeof(MYFLT));
+
+    if (self->domain != NULL) {
+        Domain_addStream(self->domain, tmp);
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
     PyList_Append(self->streams, tmp);
 
     self->stream_count++;
@@ -2629,14 +3788,125 @@ Server_removeStream(Server *self, int id)
             Server_debug(self, "Removed stream id %d\n", id);
             PySequence_DelItem(self->streams, i);
             self->stream_count--;
+            Py_INCREF(Py_None);
+            return Py_None;
+        }
+    }
+
+    /* Not a full rate stream, look into the subgraphs. */
+    for (i=0; i<self->domain_count; i++) {
+        if (Domain_removeStream(self->domains[i], id))
+            break;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+void
+Server_registerDomain(Server *self, PyObject *domain)
+{
+    if (self->domain_count < MAX_DOMAINS)
+        self->domains[self->domain_count++] = domain;
+    else
+        Server_warning(self, "Too many Domain objects, streams deleted inside the last ones will be kept alive.\n");
+}
+
+void
+Server_unregisterDomain(Server *self, PyObject *domain)
+{
+    int i, j;
+
+    if (self->domain == domain) {
+        self->domain = NULL;
+        self->domainFactor = 1;
+    }
+    for (i=0; i<self->domain_count; i++) {
+        if (self->domains[i] == domain) {
+            for (j=i+1; j<self->domain_count; j++)
+                self->domains[j-1] = self->domains[j];
+            self->domain_count--;
             break;
         }
     }
+}
+
+static PyObject *
+Server_setDomain(Server *self, PyObject *arg)
+{
+    if (arg == Py_None) {
+        self->domain = NULL;
+        self->domainFactor = 1;
+    }
+    else if (PyObject_TypeCheck(arg, &DomainType)) {
+        self->domain = arg;
+        self->domainFactor = Domain_getFactor(arg);
+    }
+    else {
+        PyErr_SetString(PyExc_TypeError, "_setDomain argument must be a Domain object or None.");
+        return NULL;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Server_setSend(Server *self, PyObject *args)
+{
+    int bus;
+    MYFLT gain;
+    Stream *stream;
+
+    if (! PyArg_ParseTuple(args, "O!i"TYPE_F, &StreamType, &stream, &bus, &gain))
+        return NULL;
+
+    if (bus < 0 || bus >= MAX_BUSES) {
+        PyErr_Format(PyExc_ValueError, "bus must be between 0 and %d.", MAX_BUSES - 1);
+        return NULL;
+    }
+    if (stream->bufsize != self->bufferSize) {
+        PyErr_SetString(PyExc_ValueError, "objects computed inside a Domain can't send to a bus.");
+        return NULL;
+    }
+    if (bus >= self->bus_count) {
+        if (Server_allocateBuses(self, bus + 1) < 0)
+            return PyErr_NoMemory();
+    }
+
+    if (Stream_setSend(stream, bus, gain) < 0)
+        return PyErr_NoMemory();
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Server_removeSend(Server *self, PyObject *args)
+{
+    int bus = -1;
+    Stream *stream;
+
+    if (! PyArg_ParseTuple(args, "O!|i", &StreamType, &stream, &bus))
+        return NULL;
+
+    Stream_removeSend(stream, bus);
 
     Py_INCREF(Py_None);
     return Py_None;
 }
 
+static PyObject *
+Server_getDomain(Server *self)
+{
+    if (self->domain == NULL) {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    Py_INCREF(self->domain);
+    return self->domain;
+}
+
 PyObject *
 Server_changeStreamPosition(Server *self, PyObject *args)
 {
@@ -2678,23 +3948,19 @@ Server_changeStreamPosition(Server *self, PyObject *args)
 PyObject *
 Server_noteout(Server *self, PyObject *args)
 {
-    int i, pit, vel, chan, curtime;
-    PmEvent buffer[1];
+    int pit, vel, chan;
+    PmMessage message;
     PmTimestamp timestamp;
 
     if (! PyArg_ParseTuple(args, "iiii", &pit, &vel, &chan, &timestamp))
         return PyInt_FromLong(-1);
 
     if (self->withPortMidiOut) {
-        curtime = Pt_Time();
-        buffer[0].timestamp = curtime + timestamp;
         if (chan == 0)
-            buffer[0].message = Pm_Message(0x90, pit, vel);
+            message = Pm_Message(0x90, pit, vel);
         else
-            buffer[0].message = Pm_Message(0x90 | (chan - 1), pit, vel);
-        for (i=0; i<self->midiout_count; i++) {
-            Pm_Write(self->midiout[i], buffer, 1);
-        }
+            message = Pm_Message(0x90 | (chan - 1), pit, vel);
+        Server_midiOutSend(self, message, Pt_Time() + timestamp);
     }
     Py_INCREF(Py_None);
     return Py_None;
@@ -2703,23 +3969,19 @@ Server_noteout(Server *self, PyObject *args)
 PyObject *
 Server_afterout(Server *self, PyObject *args)
 {
-    int i, pit, vel, chan, curtime;
-    PmEvent buffer[1];
+    int pit, vel, chan;
+    PmMessage message;
     PmTimestamp timestamp;
 
     if (! PyArg_ParseTuple(args, "iiii", &pit, &vel, &chan, &timestamp))
         return PyInt_FromLong(-1);
 
     if (self->withPortMidiOut) {
-        curtime = Pt_Time();
-        buffer[0].timestamp = curtime + timestamp;
         if (chan == 0)
-            buffer[0].message = Pm_Message(0xA0, pit, vel);
+            message = Pm_Message(0xA0, pit, vel);
         else
-            buffer[0].message = Pm_Message(0xA0 | (chan - 1), pit, vel);
-        for (i=0; i<self->midiout_count; i++) {
-            Pm_Write(self->midiout[i], buffer, 1);
-        }
+            message = Pm_Message(0xA0 | (chan - 1), pit, vel);
+        Server_midiOutSend(self, message, Pt_Time() + timestamp);
     }
     Py_INCREF(Py_None);
     return Py_None;
@@ -2728,23 +3990,19 @@ Server_afterout(Server *self, PyObject *args)
 PyObject *
 Server_ctlout(Server *self, PyObject *args)
 {
-    int i, ctlnum, value, chan, curtime;
-    PmEvent buffer[1];
+    int ctlnum, value, chan;
+    PmMessage message;
     PmTimestamp timestamp;
 
     if (! PyArg_ParseTuple(args, "iiii", &ctlnum, &value, &chan, &timestamp))
         return PyInt_FromLong(-1);
 
     if (self->withPortMidiOut) {
-        curtime = Pt_Time();
-        buffer[0].timestamp = curtime + timestamp;
         if (chan == 0)
-            buffer[0].message = Pm_Message(0xB0, ctlnum, value);
+            message = Pm_Message(0xB0, ctlnum, value);
         else
-            buffer[0].message = Pm_Message(0xB0 | (chan - 1), ctlnum, value);
-        for (i=0; i<self->midiout_count; i++) {
-            Pm_Write(self->midiout[i], buffer, 1);
-        }
+            message = Pm_Message(0xB0 | (chan - 1), ctlnum, value);
+        Server_midiOutSend(self, message, Pt_Time() + timestamp);
     }
     Py_INCREF(Py_None);
     return Py_None;
@@ -2753,23 +4011,19 @@ Server_ctlout(Server *self, PyObject *args)
 PyObject *
 Server_programout(Server *self, PyObject *args)
 {
-    int i, value, chan, curtime;
-    PmEvent buffer[1];
+    int value, chan;
+    PmMessage message;
     PmTimestamp timestamp;
 
     if (! PyArg_ParseTuple(args, "iii", &value, &chan, &timestamp))
         return PyInt_FromLong(-1);
 
     if (self->withPortMidiOut) {
-        curtime = Pt_Time();
-        buffer[0].timestamp = curtime + timestamp;
         if (chan == 0)
-            buffer[0].message = Pm_Message(0xC0, value, 0);
+            message = Pm_Message(0xC0, value, 0);
         else
-            buffer[0].message = Pm_Message(0xC0 | (chan - 1), value, 0);
-        for (i=0; i<self->midiout_count; i++) {
-            Pm_Write(self->midiout[i], buffer, 1);
-        }
+            message = Pm_Message(0xC0 | (chan - 1), value, 0);
+        Server_midiOutSend(self, message, Pt_Time() + timestamp);
     }
     Py_INCREF(Py_None);
     return Py_None;
@@ -2778,23 +4032,19 @@ Server_programout(Server *self, PyObject *args)
 PyObject *
 Server_pressout(Server *self, PyObject *args)
 {
-    int i, value, chan, curtime;
-    PmEvent buffer[1];
+    int value, chan;
+    PmMessage message;
     PmTimestamp timestamp;
 
     if (! PyArg_ParseTuple(args, "iii", &value, &chan, &timestamp))
         return PyInt_FromLong(-1);
 
     if (self->withPortMidiOut) {
-        curtime = Pt_Time();
-        buffer[0].timestamp = curtime + timestamp;
         if (chan == 0)
-            buffer[0].message = Pm_Message(0xD0, value, 0);
+            message = Pm_Message(0xD0, value, 0);
         else
-            buffer[0].message = Pm_Message(0xD0 | (chan - 1), value, 0);
-        for (i=0; i<self->midiout_count; i++) {
-            Pm_Write(self->midiout[i], buffer, 1);
-        }
+            message = Pm_Message(0xD0 | (chan - 1), value, 0);
+        Server_midiOutSend(self, message, Pt_Time() + timestamp);
     }
     Py_INCREF(Py_None);
     return Py_None;
@@ -2803,25 +4053,21 @@ Server_pressout(Server *self, PyObject *args)
 PyObject *
 Server_bendout(Server *self, PyObject *args)
 {
-    int i, lsb, msb, value, chan, curtime;
-    PmEvent buffer[1];
+    int lsb, msb, value, chan;
+    PmMessage message;
     PmTimestamp timestamp;
 
     if (! PyArg_ParseTuple(args, "iii", &value, &chan, &timestamp))
         return PyInt_FromLong(-1);
 
     if (self->withPortMidiOut) {
-        curtime = Pt_Time();
-        buffer[0].timestamp = curtime + timestamp;
         lsb = value & 0x007F;
         msb = (value & (0x007F << 7)) >> 7;
         if (chan == 0)
-            buffer[0].message = Pm_Message(0xE0, lsb, msb);
+            message = Pm_Message(0xE0, lsb, msb);
         else
-            buffer[0].message = Pm_Message(0xE0 | (chan - 1), lsb, msb);
-        for (i=0; i<self->midiout_count; i++) {
-            Pm_Write(self->midiout[i], buffer, 1);
-        }
+            message = Pm_Message(0xE0 | (chan - 1), lsb, msb);
+        Server_midiOutSend(self, message, Pt_Time() + timestamp);
     }
     Py_INCREF(Py_None);
     return Py_None;
@@ -2845,7 +4091,7 @@ Server_getMidiEventCount(Server *self) {
 static PyObject *
 Server_getSamplingRate(Server *self)
 {
-    return PyFloat_FromDouble(self->samplingRate);
+    return PyFloat_FromDouble(self->samplingRate / self->domainFactor);
 }
 
 static PyObject *
@@ -2869,7 +4115,7 @@ Server_getGlobalSeed(Server *self)
 static PyObject *
 Server_getBufferSize(Server *self)
 {
-    return PyInt_FromLong(self->bufferSize);
+    return PyInt_FromLong(self->bufferSize / self->domainFactor);
 }
 
 static PyObject *
@@ -2978,6 +4224,21 @@ static PyMethodDef Server_methods[] = {
     {"setJackAutoConnectInputPorts", (PyCFunction)Server_setJackAutoConnectInputPorts, METH_O, "Sets a list of ports to auto-connect inputs when using Jack."},
     {"setJackAutoConnectOutputPorts", (PyCFunction)Server_setJackAutoConnectOutputPorts, METH_O, "Sets a list of ports to auto-connect outputs when using Jack."},
     {"setGlobalSeed", (PyCFunction)Server_setGlobalSeed, METH_O, "Sets the server's global seed for random objects."},
+    {"setRTCheck", (PyCFunction)Server_setRTCheck, METH_O, "Activates the real-time violations detector."},
+    {"setGCIsolation", (PyCFunction)Server_setGCIsolation, METH_VARARGS, "Keeps the objects of the graph out of the cyclic garbage collector."},
+    {"setTaskThreads", (PyCFunction)Server_setTaskThreads, METH_O, "Sets the number of worker threads used by the objects splitting their work."},
+    {"getTaskThreads", (PyCFunction)Server_getTaskThreads, METH_NOARGS, "Returns the number of worker threads used by the objects splitting their work."},
+    {"process", (PyCFunction)Server_process, METH_VARARGS, "Computes blocks in the calling thread, from and to buffer objects."},
+    {"setRealtime", (PyCFunction)Server_setRealtime, METH_VARARGS, "Sets memory locking, prefaulting, cpu pinning and real-time priority."},
+    {"getRealtimeReport", (PyCFunction)Server_getRealtimeReport, METH_NOARGS, "Returns the effective real-time settings."},
+    {"getRTViolations", (PyCFunction)Server_getRTViolations, METH_NOARGS, "Returns the real-time violations counted per stream."},
+    {"resetRTViolations", (PyCFunction)Server_resetRTViolations, METH_NOARGS, "Clears the real-time violations counts."},
+    {"traceStart", (PyCFunction)Server_traceStart, METH_VARARGS|METH_KEYWORDS, "Starts recording the block timeline."},
+    {"traceStop", (PyCFunction)Server_traceStop, METH_NOARGS, "Stops recording the block timeline."},
+    {"traceProfile", (PyCFunction)Server_traceProfile, METH_VARARGS, "Traces the python calls of the current thread."},
+    {"traceBegin", (PyCFunction)Server_traceBegin, METH_O, "Begins a user event in the timeline."},
+    {"traceEnd", (PyCFunction)Server_traceEnd, METH_NOARGS, "Ends the last user event in the timeline."},
+    {"traceSave", (PyCFunction)Server_traceSave, METH_O, "Saves the timeline as a Chrome trace file."},
     {"setAmp", (PyCFunction)Server_setAmp, METH_O, "Sets the overall amplitude."},
     {"setAmpCallable", (PyCFunction)Server_setAmpCallable, METH_O, "Sets the Server's GUI callable object."},
     {"setTimeCallable", (PyCFunction)Server_setTimeCallable, METH_O, "Sets the Server's TIME callable object."},
@@ -2994,6 +4255,13 @@ static PyMethodDef Server_methods[] = {
                                                                 This is for internal use and must never be called by the user."},
     {"removeStream", (PyCFunction)Server_removeStream, METH_VARARGS, "Adds an audio stream to the server. \
                                                                 This is for internal use and must never be called by the user."},
+    {"_setDomain", (PyCFunction)Server_setDomain, METH_O, "Sets the Domain object receiving the new streams (None for full rate). \
+                                                                This is for internal use and must never be called by the user."},
+    {"_setSend", (PyCFunction)Server_setSend, METH_VARARGS, "Sets the gain of a stream's send to an aux bus. \
+                                                                This is for internal use and must never be called by the user."},
+    {"_removeSend", (PyCFunction)Server_removeSend, METH_VARARGS, "Removes a stream's send to an aux bus (all sends if bus is omitted). \
+                                                                This is for internal use and must never be called by the user."},
+    {"_getDomain", (PyCFunction)Server_getDomain, METH_NOARGS, "Returns the Domain object receiving the new streams, or None."},
     {"changeStreamPosition", (PyCFunction)Server_changeStreamPosition, METH_VARARGS, "Puts an audio stream before another in the stack. \
                                                                 This is for internal use and must never be called by the user."},
     {"noteout", (PyCFunction)Server_noteout, METH_VARARGS, "Send a Midi note event to Portmidi output stream."},
@@ -52,6 +52,8 @@ static void
 Stream_dealloc(Stream* self)
 {
     self->data = NULL;
+    if (self->sends != NULL)
+        free(self->sends);
     Stream_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -114,6 +116,22 @@ void Stream_callFunction(Stream *self)
     (*self->funcptr)(self->streamobject);
 }
 
+void Stream_setMemoryFunctionPtr(Stream *self, void *ptr)
+{
+    self->memfuncptr = ptr;
+}
+
+/* Native heap footprint, in bytes, of the object: its structure, its output
+** buffer and the buffers reported by its memory function, if any. */
+long Stream_getMemory(Stream *self)
+{
+    long bytes = sizeof(Stream) + Py_TYPE(self->streamobject)->tp_basicsize;
+    bytes += self->bufsize * sizeof(MYFLT) + self->numsends * sizeof(StreamSend);
+    if (self->memfuncptr != NULL)
+        bytes += (*self->memfuncptr)(self->streamobject);
+    return bytes;
+}
+
 void Stream_IncrementBufferCount(Stream *self)
 {
     self->bufferCount++;
@@ -132,6 +150,47 @@ void Stream_IncrementDurationCount(Stream *self)
     }
 }
 
+/* Adds a send to `bus` or updates its gain. The first block after a
+** gain change is ramped to avoid clicks. Returns -1 if out of memory,
+** the existing sends are then left unchanged. */
+int Stream_setSend(Stream *self, int bus, MYFLT gain)
+{
+    int i;
+    StreamSend *sends;
+    for (i=0; i<self->numsends; i++) {
+        if (self->sends[i].bus == bus) {
+            self->sends[i].gain = gain;
+            return 0;
+        }
+    }
+    sends = (StreamSend *)realloc(self->sends, (self->numsends + 1) * sizeof(StreamSend));
+    if (sends == NULL)
+        return -1;
+    self->sends = sends;
+    self->sends[self->numsends].bus = bus;
+    self->sends[self->numsends].gain = self->sends[self->numsends].lastgain = gain;
+    self->numsends++;
+    return 0;
+}
+
+/* Removes the send to `bus`, or every send if `bus` is negative. */
+void Stream_removeSend(Stream *self, int bus)
+{
+    int i, j;
+    if (bus < 0) {
+        self->numsends = 0;
+        return;
+    }
+    for (i=0; i<self->numsends; i++) {
+        if (self->sends[i].bus == bus) {
+            for (j=i+1; j<self->numsends; j++)
+                self->sends[j-1] = self->sends[j];
+            self->numsends--;
+            return;
+        }
+    }
+}
+
 static PyObject *
 Stream_getValue(Stream *self) {
     return Py_BuildValue(TYPE_F, self->data[self->bufsize-1]);
@@ -149,6 +208,12 @@ Stream_getStreamObject(Stream *self)
     return self->streamobject;
 }
 
+static PyObject *
+Stream_memory(Stream *self)
+{
+    return PyInt_FromLong(Stream_getMemory(self));
+}
+
 PyObject *
 Stream_isPlaying(Stream *self)
 {
@@ -181,6 +246,7 @@ static PyMethodDef Stream_methods[] = {
 {"getStreamObject", (PyCFunction)Stream_getStreamObject, METH_NOARGS, "Returns the object associated with this stream."},
 {"isPlaying", (PyCFunction)Stream_isPlaying, METH_NOARGS, "Returns True if the stream is playing, otherwise, returns False."},
 {"isOutputting", (PyCFunction)Stream_isOutputting, METH_NOARGS, "Returns True if the stream outputs to dac, otherwise, returns False."},
+{"getMemory", (PyCFunction)Stream_memory, METH_NOARGS, "Returns the native memory, in bytes, used by the object."},
 {NULL}  /* Sentinel */
 };
 
@@ -0,0 +1,237 @@
+/**************************************************************************
+ * Copyright 2009-2015 Olivier Belanger                                   *
+ *                                                                        *
+ * This file is part of pyo, a python module to help digital signal       *
+ * processing script creation.                                            *
+ *                                                                        *
+ * pyo is free software: you can redistribute it and/or modify            *
+ * it under the terms of the GNU Lesser General Public License as         *
+ * published by the Free Software Foundation, either version 3 of the     *
+ * License, or (at your option) any later version.                        *
+ *                                                                        *
+ * pyo is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU Lesser General Public License for more details.                    *
+ *                                                                        *
+ * You should have received a copy of the GNU Lesser General Public       *
+ * License along with pyo.  If not, see <http://www.gnu.org/licenses/>.   *
+ *************************************************************************/
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* cpu_set_t, pthread_setaffinity_np */
+#endif
+#include <stdlib.h>
+#include <sched.h>
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+#include "taskpool.h"
+
+/* Spins before giving the core away while joining, in case a worker was
+** preempted in the middle of a task (more threads than cores). */
+#define TASKPOOL_SPINS 4096
+
+/* Large enough that late workers, incrementing it, never reach a valid task. */
+#define TASKPOOL_CLOSED (1 << 30)
+
+#if defined(__APPLE__)
+#define TASKPOOL_POST(p) dispatch_semaphore_signal((p)->wake)
+#define TASKPOOL_WAIT(p) dispatch_semaphore_wait((p)->wake, DISPATCH_TIME_FOREVER)
+#else
+#define TASKPOOL_POST(p) sem_post(&(p)->wake)
+#define TASKPOOL_WAIT(p) sem_wait(&(p)->wake)
+#endif
+
+#if defined(__i386__) || defined(__x86_64__)
+#define TASKPOOL_PAUSE() __asm__ __volatile__("pause")
+#else
+#define TASKPOOL_PAUSE() __sync_synchronize()
+#endif
+
+/* Claims and computes tasks until none is left. The job's fields are read
+** only after a task is claimed, they are valid until every task is done. */
+static void
+TaskPool_work(TaskPool *pool)
+{
+    int task;
+
+    for (;;) {
+        task = __sync_fetch_and_add(&pool->next, 1);
+        if (task >= pool->ntasks)
+            break;
+        (*pool->func)(pool->data, task);
+        __sync_fetch_and_add(&pool->done, 1);
+    }
+}
+
+static void *
+TaskPool_worker(void *arg)
+{
+    TaskPool *pool = (TaskPool *)arg;
+
+    for (;;) {
+        TASKPOOL_WAIT(pool);
+        if (pool->quit)
+            break;
+        TaskPool_work(pool);
+    }
+    return NULL;
+}
+
+TaskPool *
+TaskPool_new(int nthreads)
+{
+    int i;
+    TaskPool *pool;
+
+    if (nthreads < 1)
+        return NULL;
+    if (nthreads > TASKPOOL_MAX_THREADS)
+        nthreads = TASKPOOL_MAX_THREADS;
+
+    pool = (TaskPool *)calloc(1, sizeof(TaskPool));
+#if defined(__APPLE__)
+    pool->wake = dispatch_semaphore_create(0);
+#else
+    sem_init(&pool->wake, 0, 0);
+#endif
+    pool->next = TASKPOOL_CLOSED;
+
+    for (i=0; i<nthreads; i++) {
+        pool->cpus[i] = -1;
+        if (pthread_create(&pool->threads[i], NULL, TaskPool_worker, pool) != 0)
+            break;
+    }
+    pool->nthreads = i;
+
+    if (pool->nthreads == 0) {
+        TaskPool_free(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+void
+TaskPool_free(TaskPool *pool)
+{
+    int i;
+
+    if (pool == NULL)
+        return;
+
+    pool->quit = 1;
+    __sync_synchronize();
+    for (i=0; i<pool->nthreads; i++)
+        TASKPOOL_POST(pool);
+    for (i=0; i<pool->nthreads; i++)
+        pthread_join(pool->threads[i], NULL);
+#if defined(__APPLE__)
+    dispatch_release(pool->wake);
+#else
+    sem_destroy(&pool->wake);
+#endif
+    free(pool);
+}
+
+void
+TaskPool_run(TaskPool *pool, TaskPoolFunc func, void *data, int ntasks)
+{
+    int i, nwake, spins = 0;
+
+    if (pool == NULL || ntasks < 2) {
+        for (i=0; i<ntasks; i++)
+            (*func)(data, i);
+        return;
+    }
+
+    pool->func = func;
+    pool->data = data;
+    pool->ntasks = ntasks;
+    pool->done = 0;
+    __sync_synchronize();
+    pool->next = 0;
+    __sync_synchronize();
+
+    /* The caller takes a share of the work, wake only the needed workers. */
+    nwake = ntasks - 1 < pool->nthreads ? ntasks - 1 : pool->nthreads;
+    for (i=0; i<nwake; i++)
+        TASKPOOL_POST(pool);
+
+    TaskPool_work(pool);
+
+    while (pool->done < ntasks) {
+        if (++spins < TASKPOOL_SPINS)
+            TASKPOOL_PAUSE();
+        else
+            sched_yield();
+    }
+
+    pool->next = TASKPOOL_CLOSED;
+    __sync_synchronize();
+}
+
+int
+TaskPool_pinThread(pthread_t thread, int cpu)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+        return -1;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &set);
+#else
+    return -1;
+#endif
+}
+
+int
+TaskPool_setThreadPriority(pthread_t thread, int priority)
+{
+#if !defined(_WIN32)
+    int max = sched_get_priority_max(SCHED_FIFO);
+    struct sched_param param;
+#if defined(RLIMIT_RTPRIO)
+    struct rlimit limit;
+#endif
+
+    if (priority <= 0)
+        return 0;
+    if (priority > max)
+        priority = max;
+    param.sched_priority = priority;
+    if (pthread_setschedparam(thread, SCHED_FIFO, &param) == 0)
+        return priority;
+#if defined(RLIMIT_RTPRIO)
+    /* Unprivileged users may be allowed a lower real-time priority. */
+    if (getrlimit(RLIMIT_RTPRIO, &limit) == 0 && limit.rlim_cur > 0 && (int)limit.rlim_cur < priority) {
+        param.sched_priority = (int)limit.rlim_cur;
+        if (pthread_setschedparam(thread, SCHED_FIFO, &param) == 0)
+            return param.sched_priority;
+    }
+#endif
+#endif
+    return 0;
+}
+
+/* Pins the workers on the given cpus, in turn, and sets their priority.
+** Called with the GIL held, never while a job is running. */
+void
+TaskPool_configure(TaskPool *pool, int *cpus, int ncpus, int priority)
+{
+    int i, prio = priority;
+
+    if (pool == NULL)
+        return;
+
+    for (i=0; i<pool->nthreads; i++) {
+        pool->cpus[i] = -1;
+        if (ncpus > 0 && TaskPool_pinThread(pool->threads[i], cpus[i % ncpus]) == 0)
+            pool->cpus[i] = cpus[i % ncpus];
+        if (priority > 0)
+            prio = TaskPool_setThreadPriority(pool->threads[i], priority);
+    }
+    pool->priority = priority > 0 ? prio : 0;
+}
@@ -0,0 +1,81 @@
+/**************************************************************************
+ * Copyright 2009-2015 Olivier Belanger                                   *
+ *                                                                        *
+ * This file is part of pyo, a python module to help digital signal       *
+ * processing script creation.                                            *
+ *                                                                        *
+ * pyo is free software: you can redistribute it and/or modify            *
+ * it under the terms of the GNU Lesser General Public License as         *
+ * published by the Free Software Foundation, either version 3 of the     *
+ * License, or (at your option) any later version.                        *
+ *                                                                        *
+ * pyo is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU Lesser General Public License for more details.                    *
+ *                                                                        *
+ * You should have received a copy of the GNU Lesser General Public       *
+ * License along with pyo.  If not, see <http://www.gnu.org/licenses/>.   *
+ *************************************************************************/
+#include "yin.h"
+
+static int
+min_elem_pos(MYFLT *buf, int size) {
+    int i;
+    int pos = 0;
+    for (i=1; i<size; i++) {
+        if (buf[i] < buf[pos])
+            pos = i;
+    }
+    return pos;
+}
+
+static MYFLT
+quadraticInterpolation(MYFLT *buf, int period, int size) {
+    int x0, x2;
+    MYFLT pitch, s0, s1, s2;
+    x0 = period < 1 ? period : period - 1;
+    x2 = period + 1 < size ? period + 1 : period;
+    if (x0 == period)
+        pitch = buf[period] <= buf[x2] ? period : x2;
+    else if (x2 == period)
+        pitch = buf[period] <= buf[x0] ? period : x0;
+    else {
+        s0 = buf[x0];
+        s1 = buf[period];
+        s2 = buf[x2];
+        pitch = period + 0.5 * (s2 - s0) / (s2 - 2.0 * s1 + s0);
+    }
+    return pitch;
+}
+
+MYFLT
+yin_period(MYFLT *frame, MYFLT *yin_buffer, int halfsize, MYFLT tolerance) {
+    int j, period, tau = 0;
+    MYFLT candidate, tmp = 0.0, tmp2 = 0.0;
+
+    yin_buffer[0] = 1.0;
+    for (tau = 1; tau < halfsize; tau++) {
+        yin_buffer[tau] = 0.0;
+        for (j = 0; j < halfsize; j++) {
+            tmp = frame[j] - frame[j+tau];
+            yin_buffer[tau] += tmp*tmp;
+        }
+        tmp2 += yin_buffer[tau];
+        if (tmp2 > 0.0)
+            yin_buffer[tau] *= tau / tmp2;
+        else
+            yin_buffer[tau] = 1.0;
+        period = tau - 3;
+        if (tau > 4 && (yin_buffer[period] < tolerance) &&
+            (yin_buffer[period] < yin_buffer[period+1])) {
+            candidate = quadraticInterpolation(yin_buffer, period, halfsize);
+            goto founded;
+        }
+    }
+    candidate = quadraticInterpolation(yin_buffer, min_elem_pos(yin_buffer, halfsize), halfsize);
+
+founded:
+
+    return candidate > 0.0 ? candidate : 0.0;
+}
@@ -27,6 +27,77 @@
 #include "interpolation.h"
 #include "fft.h"
 #include "wind.h"
+#include "yin.h"
+
+/* Hop-rate output, shared by Follower, ZCross, Yin, Centroid and AttackDetector.
+** When `hoprate` is on, the object publishes one value per analysis hop in
+** `hopvalue` (and calls `hopfunc`, if any) instead of filling its audio buffer. */
+#define pyo_hop_HEAD \
+    int hoprate; \
+    MYFLT hopvalue; \
+    PyObject *hopfunc;
+
+static void
+analysis_hop_publish(MYFLT *slot, PyObject *func, MYFLT value) {
+    PyObject *tuple, *result;
+
+    *slot = value;
+    if (func != NULL) {
+        tuple = PyTuple_New(1);
+        PyTuple_SET_ITEM(tuple, 0, PyFloat_FromDouble(value));
+        result = PyObject_Call(func, tuple, NULL);
+        if (result == NULL)
+            PyErr_Print();
+        Py_XDECREF(result);
+        Py_DECREF(tuple);
+    }
+}
+
+static void analysis_hop_postprocessing(void *self) {};
+
+#define SET_HOP_RATE \
+    int i; \
+    if (arg == NULL) { \
+        Py_INCREF(Py_None); \
+        return Py_None; \
+    } \
+    self->hoprate = PyObject_IsTrue(arg); \
+    if (self->hoprate) { \
+        for (i=0; i<self->bufsize; i++) \
+            self->data[i] = 0.0; \
+    } \
+    (*self->mode_func_ptr)(self); \
+    Py_INCREF(Py_None); \
+    return Py_None;
+
+#define SET_HOP_FUNCTION \
+    PyObject *tmp; \
+    if (arg == NULL) { \
+        Py_INCREF(Py_None); \
+        return Py_None; \
+    } \
+    if (arg != Py_None && ! PyCallable_Check(arg)) { \
+        PyErr_SetString(PyExc_TypeError, "The function attribute must be callable."); \
+        return NULL; \
+    } \
+    tmp = self->hopfunc; \
+    if (arg == Py_None) \
+        self->hopfunc = NULL; \
+    else { \
+        Py_INCREF(arg); \
+        self->hopfunc = arg; \
+    } \
+    Py_XDECREF(tmp); \
+    Py_INCREF(Py_None); \
+    return Py_None;
+
+#define GET_HOP_VALUE \
+    return PyFloat_FromDouble(self->hopvalue);
+
+#define HOP_METHODS(name) \
+{"setHopRate", (PyCFunction)name##_setHopRate, METH_O, "Activates the hop-rate output mode."}, \
+{"setHopFunction", (PyCFunction)name##_setHopFunction, METH_O, "Sets the function called at each analysis hop."}, \
+{"getHopValue", (PyCFunction)name##_getHopValue, METH_NOARGS, "Returns the last value published at hop rate."},
 
 /************/
 /* Follower */
@@ -38,6 +109,7 @@ typedef struct {
     PyObject *freq;
     Stream *freq_stream;
     int modebuffer[3]; // need at least 2 slots for mul & add
+    pyo_hop_HEAD
     MYFLT follow;
     MYFLT last_freq;
     MYFLT factor;
@@ -85,6 +157,50 @@ Follower_filters_a(Follower *self) {
     }
 }
 
+static void
+Follower_filters_hop_i(Follower *self) {
+    MYFLT absin, freq;
+    int i;
+
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    freq = PyFloat_AS_DOUBLE(self->freq);
+
+    if (freq != self->last_freq) {
+        self->factor = MYEXP(-1.0 / (self->sr / freq));
+        self->last_freq = freq;
+    }
+
+    for (i=0; i<self->bufsize; i++) {
+        absin = in[i];
+        if (absin < 0.0)
+            absin = -absin;
+        self->follow = absin + self->factor * (self->follow - absin);
+    }
+    analysis_hop_publish(&self->hopvalue, self->hopfunc, self->follow);
+}
+
+static void
+Follower_filters_hop_a(Follower *self) {
+    MYFLT freq, absin;
+    int i;
+
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        freq = fr[i];
+        if (freq != self->last_freq) {
+            self->factor = MYEXP(-1.0 / (self->sr / freq));
+            self->last_freq = freq;
+        }
+        absin = in[i];
+        if (absin < 0.0)
+            absin = -absin;
+        self->follow = absin + self->factor * (self->follow - absin);
+    }
+    analysis_hop_publish(&self->hopvalue, self->hopfunc, self->follow);
+}
+
 static void Follower_postprocessing_ii(Follower *self) { POST_PROCESSING_II };
 static void Follower_postprocessing_ai(Follower *self) { POST_PROCESSING_AI };
 static void Follower_postprocessing_ia(Follower *self) { POST_PROCESSING_IA };
@@ -139,6 +255,14 @@ Follower_setProcMode(Follower *self)
             self->muladd_func_ptr = Follower_postprocessing_revareva;
             break;
     }
+
+    if (self->hoprate) {
+        if (procmode == 0)
+            self->proc_func_ptr = Follower_filters_hop_i;
+        else
+            self->proc_func_ptr = Follower_filters_hop_a;
+        self->muladd_func_ptr = analysis_hop_postprocessing;
+    }
 }
 
 static void
@@ -152,6 +276,7 @@ static int
 Follower_traverse(Follower *self, visitproc visit, void *arg)
 {
     pyo_VISIT
+    Py_VISIT(self->hopfunc);
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
     Py_VISIT(self->freq);
@@ -163,6 +288,7 @@ static int
 Follower_clear(Follower *self)
 {
     pyo_CLEAR
+    Py_CLEAR(self->hopfunc);
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
     Py_CLEAR(self->freq);
@@ -193,6 +319,8 @@ Follower_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
 	self->modebuffer[2] = 0;
+    self->hoprate = 0;
+    self->hopvalue = 0.0;
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, Follower_compute_next_data_frame);
@@ -234,6 +362,10 @@ static PyObject * Follower_setDiv(Follower *self, PyObject *arg) { SET_DIV };
 static PyObject * Follower_play(Follower *self, PyObject *args, PyObject *kwds) { PLAY };
 static PyObject * Follower_stop(Follower *self) { STOP };
 
+static PyObject * Follower_setHopRate(Follower *self, PyObject *arg) { SET_HOP_RATE };
+static PyObject * Follower_setHopFunction(Follower *self, PyObject *arg) { SET_HOP_FUNCTION };
+static PyObject * Follower_getHopValue(Follower *self) { GET_HOP_VALUE };
+
 static PyObject * Follower_multiply(Follower *self, PyObject *arg) { MULTIPLY };
 static PyObject * Follower_inplace_multiply(Follower *self, PyObject *arg) { INPLACE_MULTIPLY };
 static PyObject * Follower_add(Follower *self, PyObject *arg) { ADD };
@@ -292,6 +424,7 @@ static PyMethodDef Follower_methods[] = {
 {"_getStream", (PyCFunction)Follower_getStream, METH_NOARGS, "Returns stream object."},
 {"play", (PyCFunction)Follower_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
 {"stop", (PyCFunction)Follower_stop, METH_NOARGS, "Stops computing."},
+HOP_METHODS(Follower)
 {"setFreq", (PyCFunction)Follower_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
 {"setMul", (PyCFunction)Follower_setMul, METH_O, "Sets oscillator mul factor."},
 {"setAdd", (PyCFunction)Follower_setAdd, METH_O, "Sets oscillator add factor."},
@@ -902,6 +1035,7 @@ typedef struct {
     MYFLT lastValue;
     MYFLT lastSample;
     int modebuffer[2]; // need at least 2 slots for mul & add
+    pyo_hop_HEAD
 } ZCross;
 
 static void
@@ -927,6 +1061,29 @@ ZCross_process(ZCross *self) {
     self->lastValue = (MYFLT)count / self->bufsize;
 }
 
+static void
+ZCross_process_hop(ZCross *self) {
+    int i;
+    int count = 0;
+    MYFLT inval;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        inval = in[i];
+        if (self->lastSample >= 0.0) {
+            if (inval < 0.0 && (self->lastSample-inval) > self->thresh)
+                count++;
+        }
+        else {
+            if (inval >= 0.0 && (inval-self->lastSample) > self->thresh)
+                count++;
+        }
+        self->lastSample = inval;
+    }
+    self->lastValue = (MYFLT)count / self->bufsize;
+    analysis_hop_publish(&self->hopvalue, self->hopfunc, self->lastValue);
+}
+
 static void ZCross_postprocessing_ii(ZCross *self) { POST_PROCESSING_II };
 static void ZCross_postprocessing_ai(ZCross *self) { POST_PROCESSING_AI };
 static void ZCross_postprocessing_ia(ZCross *self) { POST_PROCESSING_IA };
@@ -974,6 +1131,11 @@ ZCross_setProcMode(ZCross *self)
             self->muladd_func_ptr = ZCross_postprocessing_revareva;
             break;
     }
+
+    if (self->hoprate) {
+        self->proc_func_ptr = ZCross_process_hop;
+        self->muladd_func_ptr = analysis_hop_postprocessing;
+    }
 }
 
 static void
@@ -987,6 +1149,7 @@ static int
 ZCross_traverse(ZCross *self, visitproc visit, void *arg)
 {
     pyo_VISIT
+    Py_VISIT(self->hopfunc);
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
     return 0;
@@ -996,6 +1159,7 @@ static int
 ZCross_clear(ZCross *self)
 {
     pyo_CLEAR
+    Py_CLEAR(self->hopfunc);
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
     return 0;
@@ -1021,6 +1185,8 @@ ZCross_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->lastValue = self->lastSample = 0.0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
+    self->hoprate = 0;
+    self->hopvalue = 0.0;
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, ZCross_compute_next_data_frame);
@@ -1058,6 +1224,10 @@ static PyObject * ZCross_setDiv(ZCross *self, PyObject *arg) { SET_DIV };
 static PyObject * ZCross_play(ZCross *self, PyObject *args, PyObject *kwds) { PLAY };
 static PyObject * ZCross_stop(ZCross *self) { STOP };
 
+static PyObject * ZCross_setHopRate(ZCross *self, PyObject *arg) { SET_HOP_RATE };
+static PyObject * ZCross_setHopFunction(ZCross *self, PyObject *arg) { SET_HOP_FUNCTION };
+static PyObject * ZCross_getHopValue(ZCross *self) { GET_HOP_VALUE };
+
 static PyObject * ZCross_multiply(ZCross *self, PyObject *arg) { MULTIPLY };
 static PyObject * ZCross_inplace_multiply(ZCross *self, PyObject *arg) { INPLACE_MULTIPLY };
 static PyObject * ZCross_add(ZCross *self, PyObject *arg) { ADD };
@@ -1099,6 +1269,7 @@ static PyMethodDef ZCross_methods[] = {
 {"_getStream", (PyCFunction)ZCross_getStream, METH_NOARGS, "Returns stream object."},
 {"play", (PyCFunction)ZCross_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
 {"stop", (PyCFunction)ZCross_stop, METH_NOARGS, "Stops computing."},
+HOP_METHODS(ZCross)
 {"setThresh", (PyCFunction)ZCross_setThresh, METH_O, "Sets the threshold factor."},
 {"setMul", (PyCFunction)ZCross_setMul, METH_O, "Sets oscillator mul factor."},
 {"setAdd", (PyCFunction)ZCross_setAdd, METH_O, "Sets oscillator add factor."},
@@ -1191,36 +1362,6 @@ ZCross_members,                                 /* tp_members */
 ZCross_new,                                     /* tp_new */
 };
 
-static int
-min_elem_pos(MYFLT *buf, int size ) {
-    int i;
-    int pos = 0;
-    for (i=1; i<size; i++) {
-        if (buf[i] < buf[pos])
-            pos = i;
-    }
-    return pos;
-}
-
-static MYFLT
-quadraticInterpolation(MYFLT *buf, int period, int size) {
-    int x0, x2;
-    MYFLT pitch, s0, s1, s2;
-    x0 = period < 1 ? period : period - 1;
-    x2 = period + 1 < size ? period + 1 : period;
-    if (x0 == period)
-        pitch = buf[period] <= buf[x2] ? period : x2;
-    else if (x2 == period)
-        pitch = buf[period] <= buf[x0] ? period : x0;
-    else {
-        s0 = buf[x0];
-        s1 = buf[period];
-        s2 = buf[x2];
-        pitch = period + 0.5 * (s2 - s0) / (s2 - 2.0 * s1 + s0);
-    }
-    return pitch;
-}
-
 /************/
 /* Yin */
 /************/
@@ -1242,13 +1383,12 @@ typedef struct {
     MYFLT y1;
     MYFLT c2;
     int modebuffer[2]; // need at least 2 slots for mul & add
+    pyo_hop_HEAD
 } Yin;
 
 static void
-Yin_process(Yin *self) {
-    int i, j, period, tau = 0;
-    MYFLT candidate, tmp = 0.0, tmp2 = 0.0, b = 0.0;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+Yin_update_cutoff(Yin *self) {
+    MYFLT b = 0.0;
 
     if (self->cutoff != self->last_cutoff) {
         if (self->cutoff <= 1.0)
@@ -1259,39 +1399,52 @@ Yin_process(Yin *self) {
         b = 2.0 - MYCOS(TWOPI * self->cutoff / self->sr);
         self->c2 = (b - MYSQRT(b * b - 1.0));
     }
+}
+
+static void
+Yin_analyze(Yin *self) {
+    MYFLT candidate = yin_period(self->input_buffer, self->yin_buffer, self->halfsize, self->tolerance);
+
+    if (candidate > 0.0) {
+        candidate = self->sr / candidate;
+        if (candidate > self->minfreq && candidate < self->maxfreq)
+            self->pitch = candidate;
+    }
+}
+
+static void
+Yin_process(Yin *self) {
+    int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+
+    Yin_update_cutoff(self);
 
     for (i=0; i<self->bufsize; i++) {
         self->y1 = in[i] + (self->y1 - in[i]) * self->c2;
         self->input_buffer[self->input_count] = self->y1;
         if (self->input_count++ == self->winsize) {
             self->input_count = 0;
+            Yin_analyze(self);
+        }
+        self->data[i] = self->pitch;
+    }
+}
 
-            self->yin_buffer[0] = 1.0;
-            for (tau = 1; tau < self->halfsize; tau++) {
-                self->yin_buffer[tau] = 0.0;
-                for (j = 0; j < self->halfsize; j++) {
-                    tmp = self->input_buffer[j] - self->input_buffer[j+tau];
-                    self->yin_buffer[tau] += tmp*tmp;
-                }
-                tmp2 += self->yin_buffer[tau];
-                self->yin_buffer[tau] *= tau / tmp2;
-                period = tau - 3;
-                if (tau > 4 && (self->yin_buffer[period] < self->tolerance) &&
-                    (self->yin_buffer[period] < self->yin_buffer[period+1])) {
-                    candidate = quadraticInterpolation(self->yin_buffer, period, self->halfsize);
-                    goto founded;
-                }
-            }
-            candidate = quadraticInterpolation(self->yin_buffer, min_elem_pos(self->yin_buffer, self->halfsize), self->halfsize);
-
-        founded:
+static void
+Yin_process_hop(Yin *self) {
+    int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
-            candidate = self->sr / candidate;
-            if (candidate > self->minfreq && candidate < self->maxfreq)
-                self->pitch = candidate;
+    Yin_update_cutoff(self);
 
+    for (i=0; i<self->bufsize; i++) {
+        self->y1 = in[i] + (self->y1 - in[i]) * self->c2;
+        self->input_buffer[self->input_count] = self->y1;
+        if (self->input_count++ == self->winsize) {
+            self->input_count = 0;
+            Yin_analyze(self);
+            analysis_hop_publish(&self->hopvalue, self->hopfunc, self->pitch);
         }
-        self->data[i] = self->pitch;
     }
 }
 
@@ -1342,6 +1495,11 @@ Yin_setProcMode(Yin *self)
             self->muladd_func_ptr = Yin_postprocessing_revareva;
             break;
     }
+
+    if (self->hoprate) {
+        self->proc_func_ptr = Yin_process_hop;
+        self->muladd_func_ptr = analysis_hop_postprocessing;
+    }
 }
 
 static void
@@ -1355,6 +1513,7 @@ static int
 Yin_traverse(Yin *self, visitproc visit, void *arg)
 {
     pyo_VISIT
+    Py_VISIT(self->hopfunc);
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
     return 0;
@@ -1364,6 +1523,7 @@ static int
 Yin_clear(Yin *self)
 {
     pyo_CLEAR
+    Py_CLEAR(self->hopfunc);
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
     return 0;
@@ -1399,6 +1559,8 @@ Yin_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->y1 = self->c2 = 0.0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
+    self->hoprate = 0;
+    self->hopvalue = 0.0;
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, Yin_compute_next_data_frame);
@@ -1448,6 +1610,10 @@ static PyObject * Yin_setDiv(Yin *self, PyObject *arg) { SET_DIV };
 static PyObject * Yin_play(Yin *self, PyObject *args, PyObject *kwds) { PLAY };
 static PyObject * Yin_stop(Yin *self) { STOP };
 
+static PyObject * Yin_setHopRate(Yin *self, PyObject *arg) { SET_HOP_RATE };
+static PyObject * Yin_setHopFunction(Yin *self, PyObject *arg) { SET_HOP_FUNCTION };
+static PyObject * Yin_getHopValue(Yin *self) { GET_HOP_VALUE };
+
 static PyObject * Yin_multiply(Yin *self, PyObject *arg) { MULTIPLY };
 static PyObject * Yin_inplace_multiply(Yin *self, PyObject *arg) { INPLACE_MULTIPLY };
 static PyObject * Yin_add(Yin *self, PyObject *arg) { ADD };
@@ -1539,6 +1705,7 @@ static PyMethodDef Yin_methods[] = {
 {"_getStream", (PyCFunction)Yin_getStream, METH_NOARGS, "Returns stream object."},
 {"play", (PyCFunction)Yin_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
 {"stop", (PyCFunction)Yin_stop, METH_NOARGS, "Stops computing."},
+HOP_METHODS(Yin)
 {"setTolerance", (PyCFunction)Yin_setTolerance, METH_O, "Sets the tolerance factor."},
 {"setMinfreq", (PyCFunction)Yin_setMinfreq, METH_O, "Sets the minimum frequency in output."},
 {"setMaxfreq", (PyCFunction)Yin_setMaxfreq, METH_O, "Sets the maximum frequency in output."},
@@ -1652,6 +1819,7 @@ typedef struct {
     MYFLT *input_buffer;
     MYFLT *window;
     int modebuffer[2];
+    pyo_hop_HEAD
 } Centroid;
 
 static void
@@ -1673,9 +1841,36 @@ Centroid_alloc_memories(Centroid *self) {
 }
 
 static void
-Centroid_process_i(Centroid *self) {
+Centroid_analyze(Centroid *self) {
     int i;
     MYFLT re, im, tmp, sum1, sum2;
+
+    for (i=0; i<self->size; i++) {
+        self->inframe[i] = self->input_buffer[i] * self->window[i];
+    }
+    realfft_split(self->inframe, self->outframe, self->size, self->twiddle);
+    sum1 = sum2 = 0.0;
+    for (i=1; i<self->hsize; i++) {
+        re = self->outframe[i];
+        im = self->outframe[self->size - i];
+        tmp = MYSQRT(re*re + im*im);
+        sum1 += tmp * i;
+        sum2 += tmp;
+    }
+    if (sum2 < 0.000000001)
+        tmp = 0.0;
+    else
+        tmp = sum1 / sum2;
+    self->centroid += tmp * self->sr / self->size;
+    self->centroid *= 0.5;
+    for (i=0; i<self->hsize; i++) {
+        self->input_buffer[i] = self->input_buffer[i + self->hsize];
+    }
+}
+
+static void
+Centroid_process_i(Centroid *self) {
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
     for (i=0; i<self->bufsize; i++) {
@@ -1685,28 +1880,24 @@ Centroid_process_i(Centroid *self) {
         self->incount++;
         if (self->incount == self->size) {
             self->incount = self->hsize;
+            Centroid_analyze(self);
+        }
+    }
+}
 
-            for (i=0; i<self->size; i++) {
-                self->inframe[i] = self->input_buffer[i] * self->window[i];
-            }
-            realfft_split(self->inframe, self->outframe, self->size, self->twiddle);
-            sum1 = sum2 = 0.0;
-            for (i=1; i<self->hsize; i++) {
-                re = self->outframe[i];
-                im = self->outframe[self->size - i];
-                tmp = MYSQRT(re*re + im*im);
-                sum1 += tmp * i;
-                sum2 += tmp;
-            }
-            if (sum2 < 0.000000001)
-                tmp = 0.0;
-            else
-                tmp = sum1 / sum2;
-            self->centroid += tmp * self->sr / self->size;
-            self->centroid *= 0.5;
-            for (i=0; i<self->hsize; i++) {
-                self->input_buffer[i] = self->input_buffer[i + self->hsize];
-            }
+static void
+Centroid_process_hop(Centroid *self) {
+    int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        self->input_buffer[self->incount] = in[i];
+
+        self->incount++;
+        if (self->incount == self->size) {
+            self->incount = self->hsize;
+            Centroid_analyze(self);
+            analysis_hop_publish(&self->hopvalue, self->hopfunc, self->centroid);
         }
     }
 }
@@ -1758,6 +1949,11 @@ Centroid_setProcMode(Centroid *self)
             self->muladd_func_ptr = Centroid_postprocessing_revareva;
             break;
     }
+
+    if (self->hoprate) {
+        self->proc_func_ptr = Centroid_process_hop;
+        self->muladd_func_ptr = analysis_hop_postprocessing;
+    }
 }
 
 static void
@@ -1771,6 +1967,7 @@ static int
 Centroid_traverse(Centroid *self, visitproc visit, void *arg)
 {
     pyo_VISIT
+    Py_VISIT(self->hopfunc);
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
     return 0;
@@ -1780,6 +1977,7 @@ static int
 Centroid_clear(Centroid *self)
 {
     pyo_CLEAR
+    Py_CLEAR(self->hopfunc);
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
     return 0;
@@ -1812,6 +2010,9 @@ Centroid_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     self->centroid = 0;
     self->size = 1024;
+    self->hoprate = 0;
+    self->hopvalue = 0.0;
+
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, Centroid_compute_next_data_frame);
     self->mode_func_ptr = Centroid_setProcMode;
@@ -1862,6 +2063,10 @@ static PyObject * Centroid_setDiv(Centroid *self, PyObject *arg) { SET_DIV };
 static PyObject * Centroid_play(Centroid *self, PyObject *args, PyObject *kwds) { PLAY };
 static PyObject * Centroid_stop(Centroid *self) { STOP };
 
+static PyObject * Centroid_setHopRate(Centroid *self, PyObject *arg) { SET_HOP_RATE };
+static PyObject * Centroid_setHopFunction(Centroid *self, PyObject *arg) { SET_HOP_FUNCTION };
+static PyObject * Centroid_getHopValue(Centroid *self) { GET_HOP_VALUE };
+
 static PyObject * Centroid_multiply(Centroid *self, PyObject *arg) { MULTIPLY };
 static PyObject * Centroid_inplace_multiply(Centroid *self, PyObject *arg) { INPLACE_MULTIPLY };
 static PyObject * Centroid_add(Centroid *self, PyObject *arg) { ADD };
@@ -1886,6 +2091,7 @@ static PyMethodDef Centroid_methods[] = {
 {"_getStream", (PyCFunction)Centroid_getStream, METH_NOARGS, "Returns stream object."},
 {"play", (PyCFunction)Centroid_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
 {"stop", (PyCFunction)Centroid_stop, METH_NOARGS, "Stops computing."},
+HOP_METHODS(Centroid)
 {"setMul", (PyCFunction)Centroid_setMul, METH_O, "Sets Centroid mul factor."},
 {"setAdd", (PyCFunction)Centroid_setAdd, METH_O, "Sets Centroid add factor."},
 {"setSub", (PyCFunction)Centroid_setSub, METH_O, "Sets Centroid add factor."},
@@ -2002,52 +2208,73 @@ typedef struct {
     long maxtime;
     long timer;
     int modebuffer[2]; // need at least 2 slots for mul & add
+    pyo_hop_HEAD
 } AttackDetector;
 
+static int
+AttackDetector_detect(AttackDetector *self, MYFLT absin) {
+    int ind, attack = 0;
+
+    // envelope follower
+    if (absin < 0.0)
+        absin = -absin;
+    self->follow = absin + self->folfactor * (self->follow - absin);
+    // follower in dB
+    if (self->follow <= 0.000001)
+        self->followdb = -120.0;
+    else
+        self->followdb = 20.0 * MYLOG10(self->follow);
+    // previous analysis
+    ind = self->incount - self->sampdel;
+    if (ind < 0)
+        ind += self->memsize;
+    self->previous = self->buffer[ind];
+    self->buffer[self->incount] = self->followdb;
+    self->incount++;
+    if (self->incount >= self->memsize)
+        self->incount = 0;
+    // if release time has past
+    if (self->timer >= self->maxtime) {
+        // if rms is over min threshold
+        if (self->overminok) {
+            // if rms is greater than previous + maxthresh
+            if (self->followdb > (self->previous + self->maxthresh)) {
+                attack = 1;
+                self->overminok = self->belowminok = 0;
+                self->timer = 0;
+            }
+        }
+    }
+    if (self->belowminok == 0 && self->followdb < self->minthresh)
+        self->belowminok = 1;
+    else if (self->belowminok == 1 && self->followdb > self->minthresh)
+        self->overminok = 1;
+    self->timer++;
+
+    return attack;
+}
+
 static void
 AttackDetector_process(AttackDetector *self) {
-    int i, ind;
-    MYFLT absin;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
     for (i=0; i<self->bufsize; i++) {
-        self->data[i] = 0.0;
-        absin = in[i];
-        // envelope follower
-        if (absin < 0.0)
-            absin = -absin;
-        self->follow = absin + self->folfactor * (self->follow - absin);
-        // follower in dB
-        if (self->follow <= 0.000001)
-            self->followdb = -120.0;
-        else
-            self->followdb = 20.0 * MYLOG10(self->follow);
-        // previous analysis
-        ind = self->incount - self->sampdel;
-        if (ind < 0)
-            ind += self->memsize;
-        self->previous = self->buffer[ind];
-        self->buffer[self->incount] = self->followdb;
-        self->incount++;
-        if (self->incount >= self->memsize)
-            self->incount = 0;
-        // if release time has past
-        if (self->timer >= self->maxtime) {
-            // if rms is over min threshold
-            if (self->overminok) {
-                // if rms is greater than previous + maxthresh
-                if (self->followdb > (self->previous + self->maxthresh)) {
-                    self->data[i] = 1.0;
-                    self->overminok = self->belowminok = 0;
-                    self->timer = 0;
-                }
-            }
-        }
-        if (self->belowminok == 0 && self->followdb < self->minthresh)
-            self->belowminok = 1;
-        else if (self->belowminok == 1 && self->followdb > self->minthresh)
-            self->overminok = 1;
-        self->timer++;
+        self->data[i] = (MYFLT)AttackDetector_detect(self, in[i]);
+    }
+}
+
+/* The hop value is 1 if an attack was detected during the last buffer, 0 otherwise.
+** The hop function, if any, is called once per detected attack. */
+static void
+AttackDetector_process_hop(AttackDetector *self) {
+    int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+
+    self->hopvalue = 0.0;
+    for (i=0; i<self->bufsize; i++) {
+        if (AttackDetector_detect(self, in[i]))
+            analysis_hop_publish(&self->hopvalue, self->hopfunc, 1.0);
     }
 }
 
@@ -2098,6 +2325,11 @@ AttackDetector_setProcMode(AttackDetector *self)
             self->muladd_func_ptr = AttackDetector_postprocessing_revareva;
             break;
     }
+
+    if (self->hoprate) {
+        self->proc_func_ptr = AttackDetector_process_hop;
+        self->muladd_func_ptr = analysis_hop_postprocessing;
+    }
 }
 
 static void
@@ -2111,6 +2343,7 @@ static int
 AttackDetector_traverse(AttackDetector *self, visitproc visit, void *arg)
 {
     pyo_VISIT
+    Py_VISIT(self->hopfunc);
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
     return 0;
@@ -2120,6 +2353,7 @@ static int
 AttackDetector_clear(AttackDetector *self)
 {
     pyo_CLEAR
+    Py_CLEAR(self->hopfunc);
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
     return 0;
@@ -2156,6 +2390,8 @@ AttackDetector_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->timer = 0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
+    self->hoprate = 0;
+    self->hopvalue = 0.0;
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, AttackDetector_compute_next_data_frame);
@@ -2219,6 +2455,10 @@ static PyObject * AttackDetector_setDiv(AttackDetector *self, PyObject *arg) { S
 static PyObject * AttackDetector_play(AttackDetector *self, PyObject *args, PyObject *kwds) { PLAY };
 static PyObject * AttackDetector_stop(AttackDetector *self) { STOP };
 
+static PyObject * AttackDetector_setHopRate(AttackDetector *self, PyObject *arg) { SET_HOP_RATE };
+static PyObject * AttackDetector_setHopFunction(AttackDetector *self, PyObject *arg) { SET_HOP_FUNCTION };
+static PyObject * AttackDetector_getHopValue(AttackDetector *self) { GET_HOP_VALUE };
+
 static PyObject * AttackDetector_multiply(AttackDetector *self, PyObject *arg) { MULTIPLY };
 static PyObject * AttackDetector_inplace_multiply(AttackDetector *self, PyObject *arg) { INPLACE_MULTIPLY };
 static PyObject * AttackDetector_add(AttackDetector *self, PyObject *arg) { ADD };
@@ -2339,6 +2579,7 @@ static PyMethodDef AttackDetector_methods[] = {
 {"_getStream", (PyCFunction)AttackDetector_getStream, METH_NOARGS, "Returns stream object."},
 {"play", (PyCFunction)AttackDetector_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
 {"stop", (PyCFunction)AttackDetector_stop, METH_NOARGS, "Stops computing."},
+HOP_METHODS(AttackDetector)
 {"setDeltime", (PyCFunction)AttackDetector_setDeltime, METH_O, "Sets the delay time between current and previous analysis."},
 {"setCutoff", (PyCFunction)AttackDetector_setCutoff, METH_O, "Sets the frequency of the internal lowpass filter."},
 {"setMaxthresh", (PyCFunction)AttackDetector_setMaxthresh, METH_O, "Sets the higher threshold."},
@@ -379,6 +379,11 @@ Chorus_compute_next_data_frame(Chorus *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+Chorus_memory(Chorus *self) {
+    return (self->size[0] + self->size[1] + self->size[2] + self->size[3] + self->size[4] + self->size[5] + self->size[6] + self->size[7] + 8) * sizeof(MYFLT);
+}
+
 static int
 Chorus_traverse(Chorus *self, visitproc visit, void *arg)
 {
@@ -444,6 +449,7 @@ Chorus_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, Chorus_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, Chorus_memory);
     self->mode_func_ptr = Chorus_setProcMode;
 
     srfac = self->sr / 44100.0;
@@ -729,4 +735,749 @@ Chorus_members,             /* tp_members */
 0,      /* tp_init */
 0,                         /* tp_alloc */
 Chorus_new,                 /* tp_new */
-};
\ No newline at end of file
+};
+/************************************************************************************************/
+/* MultiChorusMain object. Multichannel chorus sharing the delay line modulations. */
+/************************************************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream **input_streams;
+    int inputSize;
+    PyObject *feedback;
+    Stream *feedback_stream;
+    PyObject *depth;
+    Stream *depth_stream;
+    PyObject *mix;
+    Stream *mix_stream;
+    int modebuffer[3];
+    MYFLT delays[8];
+    MYFLT delay_devs[8];
+    long size[8];
+    long in_count[8];
+    MYFLT *buffer[8]; /* interleaved frames, one sample per channel */
+    MYFLT pointerPos[8];
+    MYFLT inc[8];
+    MYFLT *input_buffer; /* interleaved input block */
+    MYFLT *total_signal;
+    MYFLT *buffer_streams;
+    MYFLT *param_buffer; /* depth, feedback and mix values of the current block */
+} MultiChorusMain;
+
+static void
+MultiChorusMain_generate(MultiChorusMain *self) {
+    MYFLT lfo, pos, val, fpart, feed, mix;
+    MYFLT *in, *rd, *wr, *frame;
+    int i, j, k, ipart, nchnls = self->inputSize;
+    MYFLT *dpth = self->param_buffer;
+    MYFLT *fdb = self->param_buffer + self->bufsize;
+    MYFLT *mx = self->param_buffer + 2 * self->bufsize;
+
+    if (self->modebuffer[0] == 0) {
+        val = PyFloat_AS_DOUBLE(self->depth);
+        for (i=0; i<self->bufsize; i++)
+            dpth[i] = val;
+    }
+    else {
+        in = Stream_getData((Stream *)self->depth_stream);
+        for (i=0; i<self->bufsize; i++)
+            dpth[i] = in[i];
+    }
+    if (self->modebuffer[1] == 0) {
+        val = PyFloat_AS_DOUBLE(self->feedback);
+        for (i=0; i<self->bufsize; i++)
+            fdb[i] = val;
+    }
+    else {
+        in = Stream_getData((Stream *)self->feedback_stream);
+        for (i=0; i<self->bufsize; i++)
+            fdb[i] = in[i];
+    }
+    if (self->modebuffer[2] == 0) {
+        val = PyFloat_AS_DOUBLE(self->mix);
+        for (i=0; i<self->bufsize; i++)
+            mx[i] = val;
+    }
+    else {
+        in = Stream_getData((Stream *)self->mix_stream);
+        for (i=0; i<self->bufsize; i++)
+            mx[i] = in[i];
+    }
+
+    for (k=0; k<nchnls; k++) {
+        in = Stream_getData(self->input_streams[k]);
+        for (i=0; i<self->bufsize; i++) {
+            self->input_buffer[i*nchnls+k] = in[i];
+        }
+    }
+
+    for (i=0; i<self->bufsize; i++) {
+        frame = self->input_buffer + i * nchnls;
+        if (dpth[i] < 0)
+            dpth[i] = 0;
+        else if (dpth[i] > 5)
+            dpth[i] = 5;
+        feed = fdb[i];
+        if (feed < 0)
+            feed = 0;
+        else if (feed > 1)
+            feed = 1;
+
+        for (k=0; k<nchnls; k++)
+            self->total_signal[k] = 0.0;
+
+        for (j=0; j<8; j++) {
+            /* The lfo and the read position are computed once for all channels. */
+            if (self->pointerPos[j] < 0.0)
+                self->pointerPos[j] += 512.0;
+            else if (self->pointerPos[j] >= 512.0)
+                self->pointerPos[j] -= 512.0;
+            ipart = (int)self->pointerPos[j];
+            fpart = self->pointerPos[j] - ipart;
+            lfo = self->delay_devs[j] * dpth[i] * (LFO_ARRAY[ipart] * (1.0 - fpart) + LFO_ARRAY[ipart+1] * fpart) + self->delays[j];
+            self->pointerPos[j] += self->inc[j];
+
+            pos = self->in_count[j] - lfo;
+            if (pos < 0)
+                pos += self->size[j];
+            ipart = (int)pos;
+            fpart = pos - ipart;
+
+            rd = self->buffer[j] + ipart * nchnls;
+            wr = self->buffer[j] + self->in_count[j] * nchnls;
+            for (k=0; k<nchnls; k++) {
+                val = rd[k] * (1.0 - fpart) + rd[k+nchnls] * fpart;
+                self->total_signal[k] += val;
+                wr[k] = frame[k] + val * feed;
+            }
+            if (self->in_count[j] == 0) {
+                for (k=0; k<nchnls; k++)
+                    self->buffer[j][self->size[j]*nchnls+k] = wr[k];
+            }
+            self->in_count[j]++;
+            if (self->in_count[j] >= self->size[j])
+                self->in_count[j] = 0;
+        }
+
+        mix = mx[i];
+        if (mix < 0.0)
+            mix = 0.0;
+        else if (mix > 1.0)
+            mix = 1.0;
+        for (k=0; k<nchnls; k++) {
+            self->buffer_streams[i+k*self->bufsize] = frame[k] * (1.0 - mix) + self->total_signal[k] * 0.25 * mix;
+        }
+    }
+}
+
+MYFLT *
+MultiChorusMain_getSamplesBuffer(MultiChorusMain *self)
+{
+    return (MYFLT *)self->buffer_streams;
+}
+
+static void
+MultiChorusMain_setProcMode(MultiChorusMain *self)
+{
+    self->proc_func_ptr = MultiChorusMain_generate;
+}
+
+static void
+MultiChorusMain_compute_next_data_frame(MultiChorusMain *self)
+{
+    (*self->proc_func_ptr)(self);
+}
+
+static long
+MultiChorusMain_memory(MultiChorusMain *self) {
+    return ((self->size[0] + self->size[1] + self->size[2] + self->size[3] + self->size[4] + self->size[5] + self->size[6] + self->size[7]
+            + 8 + 2 * self->bufsize + 1) * self->inputSize + 3 * self->bufsize) * sizeof(MYFLT);
+}
+
+static int
+MultiChorusMain_traverse(MultiChorusMain *self, visitproc visit, void *arg)
+{
+    int i;
+    pyo_VISIT
+    Py_VISIT(self->input);
+    for (i=0; i<self->inputSize; i++) {
+        Py_VISIT(self->input_streams[i]);
+    }
+    Py_VISIT(self->feedback);
+    Py_VISIT(self->feedback_stream);
+    Py_VISIT(self->depth);
+    Py_VISIT(self->depth_stream);
+    Py_VISIT(self->mix);
+    Py_VISIT(self->mix_stream);
+    return 0;
+}
+
+static int
+MultiChorusMain_clear(MultiChorusMain *self)
+{
+    int i;
+    pyo_CLEAR
+    Py_CLEAR(self->input);
+    for (i=0; i<self->inputSize; i++) {
+        Py_CLEAR(self->input_streams[i]);
+    }
+    Py_CLEAR(self->feedback);
+    Py_CLEAR(self->feedback_stream);
+    Py_CLEAR(self->depth);
+    Py_CLEAR(self->depth_stream);
+    Py_CLEAR(self->mix);
+    Py_CLEAR(self->mix_stream);
+    return 0;
+}
+
+static void
+MultiChorusMain_dealloc(MultiChorusMain* self)
+{
+    int i;
+    pyo_DEALLOC
+    for (i=0; i<8; i++) {
+        free(self->buffer[i]);
+    }
+    free(self->input_buffer);
+    free(self->total_signal);
+    free(self->buffer_streams);
+    free(self->param_buffer);
+    MultiChorusMain_clear(self);
+    free(self->input_streams);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+MultiChorusMain_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    MYFLT srfac;
+    PyObject *inputtmp, *depthtmp=NULL, *feedbacktmp=NULL, *mixtmp=NULL;
+    MultiChorusMain *self;
+    self = (MultiChorusMain *)type->tp_alloc(type, 0);
+
+    self->feedback = PyFloat_FromDouble(0.5);
+    self->depth = PyFloat_FromDouble(1.0);
+    self->mix = PyFloat_FromDouble(0.5);
+    self->inputSize = 0;
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+	self->modebuffer[2] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, MultiChorusMain_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, MultiChorusMain_memory);
+    self->mode_func_ptr = MultiChorusMain_setProcMode;
+
+    srfac = self->sr / 44100.0;
+
+    for (i=0; i<8; i++) {
+        self->in_count[i] = 0;
+        self->delays[i] = chorusParams[i][0] * srfac;
+        self->delay_devs[i] = chorusParams[i][1] * srfac;
+        self->inc[i] = chorusParams[i][2] * 512 / self->sr;
+        self->size[i] = (long)(chorusParams[i][0] * srfac * 2 + 0.5);
+    }
+
+    self->param_buffer = (MYFLT *)realloc(self->param_buffer, 3 * self->bufsize * sizeof(MYFLT));
+
+    static char *kwlist[] = {"input", "depth", "feedback", "mix", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOO", kwlist, &inputtmp, &depthtmp, &feedbacktmp, &mixtmp))
+        Py_RETURN_NONE;
+
+    if (inputtmp) {
+        PyObject_CallMethod((PyObject *)self, "setInput", "O", inputtmp);
+    }
+
+    if (depthtmp) {
+        PyObject_CallMethod((PyObject *)self, "setDepth", "O", depthtmp);
+    }
+
+    if (feedbacktmp) {
+        PyObject_CallMethod((PyObject *)self, "setFeedback", "O", feedbacktmp);
+    }
+
+    if (mixtmp) {
+        PyObject_CallMethod((PyObject *)self, "setMix", "O", mixtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * MultiChorusMain_getServer(MultiChorusMain* self) { GET_SERVER };
+static PyObject * MultiChorusMain_getStream(MultiChorusMain* self) { GET_STREAM };
+
+static PyObject * MultiChorusMain_play(MultiChorusMain *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * MultiChorusMain_stop(MultiChorusMain *self) { STOP };
+
+static PyObject *
+MultiChorusMain_setInput(MultiChorusMain *self, PyObject *arg)
+{
+    int i, j, nchnls;
+    PyObject *tmp, *streamtmp;
+
+    if (! PyList_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "The inputs attribute must be a list.");
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    tmp = arg;
+    nchnls = PyList_Size(tmp);
+    Py_INCREF(tmp);
+    Py_XDECREF(self->input);
+    self->input = tmp;
+
+    for (i=0; i<self->inputSize; i++) {
+        Py_XDECREF(self->input_streams[i]);
+    }
+    self->input_streams = (Stream **)realloc(self->input_streams, nchnls * sizeof(Stream *));
+    for (i=0; i<nchnls; i++) {
+        streamtmp = PyObject_CallMethod((PyObject *)PyList_GET_ITEM(self->input, i), "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        self->input_streams[i] = (Stream *)streamtmp;
+    }
+
+    if (nchnls != self->inputSize) {
+        self->inputSize = nchnls;
+        for (i=0; i<8; i++) {
+            self->in_count[i] = 0;
+            self->buffer[i] = (MYFLT *)realloc(self->buffer[i], (self->size[i]+1) * nchnls * sizeof(MYFLT));
+            for (j=0; j<((self->size[i]+1)*nchnls); j++) {
+                self->buffer[i][j] = 0.;
+            }
+        }
+        self->input_buffer = (MYFLT *)realloc(self->input_buffer, self->bufsize * nchnls * sizeof(MYFLT));
+        self->total_signal = (MYFLT *)realloc(self->total_signal, nchnls * sizeof(MYFLT));
+        self->buffer_streams = (MYFLT *)realloc(self->buffer_streams, self->bufsize * nchnls * sizeof(MYFLT));
+        for (i=0; i<(self->bufsize*nchnls); i++) {
+            self->buffer_streams[i] = 0.0;
+        }
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+MultiChorusMain_setDepth(MultiChorusMain *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->depth);
+	if (isNumber == 1) {
+		self->depth = PyNumber_Float(tmp);
+        self->modebuffer[0] = 0;
+	}
+	else {
+		self->depth = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->depth, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->depth_stream);
+        self->depth_stream = (Stream *)streamtmp;
+		self->modebuffer[0] = 1;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+MultiChorusMain_setFeedback(MultiChorusMain *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->feedback);
+	if (isNumber == 1) {
+		self->feedback = PyNumber_Float(tmp);
+        self->modebuffer[1] = 0;
+	}
+	else {
+		self->feedback = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->feedback, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->feedback_stream);
+        self->feedback_stream = (Stream *)streamtmp;
+		self->modebuffer[1] = 1;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+MultiChorusMain_setMix(MultiChorusMain *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->mix);
+	if (isNumber == 1) {
+		self->mix = PyNumber_Float(tmp);
+        self->modebuffer[2] = 0;
+	}
+	else {
+		self->mix = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->mix, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->mix_stream);
+        self->mix_stream = (Stream *)streamtmp;
+		self->modebuffer[2] = 1;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyMemberDef MultiChorusMain_members[] = {
+{"server", T_OBJECT_EX, offsetof(MultiChorusMain, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(MultiChorusMain, stream), 0, "Stream object."},
+{"input", T_OBJECT_EX, offsetof(MultiChorusMain, input), 0, "List of input sound objects."},
+{"feedback", T_OBJECT_EX, offsetof(MultiChorusMain, feedback), 0, "Feedback value."},
+{"depth", T_OBJECT_EX, offsetof(MultiChorusMain, depth), 0, "Chorus depth."},
+{"mix", T_OBJECT_EX, offsetof(MultiChorusMain, mix), 0, "Balance between dry and wet signals."},
+{NULL}  /* Sentinel */
+};
+
+static PyMethodDef MultiChorusMain_methods[] = {
+{"getServer", (PyCFunction)MultiChorusMain_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)MultiChorusMain_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)MultiChorusMain_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"stop", (PyCFunction)MultiChorusMain_stop, METH_NOARGS, "Stops computing."},
+{"setInput", (PyCFunction)MultiChorusMain_setInput, METH_O, "Sets list of input streams."},
+{"setFeedback", (PyCFunction)MultiChorusMain_setFeedback, METH_O, "Sets feedback value between 0 -> 1."},
+{"setDepth", (PyCFunction)MultiChorusMain_setDepth, METH_O, "Sets chorus depth."},
+{"setMix", (PyCFunction)MultiChorusMain_setMix, METH_O, "Sets balance between dry and wet signals."},
+{NULL}  /* Sentinel */
+};
+
+PyTypeObject MultiChorusMainType = {
+PyObject_HEAD_INIT(NULL)
+0,                         /*ob_size*/
+"_pyo.MultiChorusMain_base",         /*tp_name*/
+sizeof(MultiChorusMain),         /*tp_basicsize*/
+0,                         /*tp_itemsize*/
+(destructor)MultiChorusMain_dealloc, /*tp_dealloc*/
+0,                         /*tp_print*/
+0,                         /*tp_getattr*/
+0,                         /*tp_setattr*/
+0,                         /*tp_compare*/
+0,                         /*tp_repr*/
+0,             /*tp_as_number*/
+0,                         /*tp_as_sequence*/
+0,                         /*tp_as_mapping*/
+0,                         /*tp_hash */
+0,                         /*tp_call*/
+0,                         /*tp_str*/
+0,                         /*tp_getattro*/
+0,                         /*tp_setattro*/
+0,                         /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"MultiChorusMain objects. 8 delay lines chorus over interleaved multichannel buffers.",           /* tp_doc */
+(traverseproc)MultiChorusMain_traverse,   /* tp_traverse */
+(inquiry)MultiChorusMain_clear,           /* tp_clear */
+0,		               /* tp_richcompare */
+0,		               /* tp_weaklistoffset */
+0,		               /* tp_iter */
+0,		               /* tp_iternext */
+MultiChorusMain_methods,             /* tp_methods */
+MultiChorusMain_members,             /* tp_members */
+0,                      /* tp_getset */
+0,                         /* tp_base */
+0,                         /* tp_dict */
+0,                         /* tp_descr_get */
+0,                         /* tp_descr_set */
+0,                         /* tp_dictoffset */
+0,      /* tp_init */
+0,                         /* tp_alloc */
+MultiChorusMain_new,                 /* tp_new */
+};
+
+/************************************************************************************************/
+/* MultiChorus streamer object */
+/************************************************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    MultiChorusMain *mainSplitter;
+    int modebuffer[2];
+    int chnl;
+} MultiChorus;
+
+static void MultiChorus_postprocessing_ii(MultiChorus *self) { POST_PROCESSING_II };
+static void MultiChorus_postprocessing_ai(MultiChorus *self) { POST_PROCESSING_AI };
+static void MultiChorus_postprocessing_ia(MultiChorus *self) { POST_PROCESSING_IA };
+static void MultiChorus_postprocessing_aa(MultiChorus *self) { POST_PROCESSING_AA };
+static void MultiChorus_postprocessing_ireva(MultiChorus *self) { POST_PROCESSING_IREVA };
+static void MultiChorus_postprocessing_areva(MultiChorus *self) { POST_PROCESSING_AREVA };
+static void MultiChorus_postprocessing_revai(MultiChorus *self) { POST_PROCESSING_REVAI };
+static void MultiChorus_postprocessing_revaa(MultiChorus *self) { POST_PROCESSING_REVAA };
+static void MultiChorus_postprocessing_revareva(MultiChorus *self) { POST_PROCESSING_REVAREVA };
+
+static void
+MultiChorus_setProcMode(MultiChorus *self)
+{
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+	switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = MultiChorus_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = MultiChorus_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = MultiChorus_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = MultiChorus_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = MultiChorus_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = MultiChorus_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = MultiChorus_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = MultiChorus_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = MultiChorus_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+MultiChorus_compute_next_data_frame(MultiChorus *self)
+{
+    int i;
+    MYFLT *tmp;
+    int offset = self->chnl * self->bufsize;
+    tmp = MultiChorusMain_getSamplesBuffer((MultiChorusMain *)self->mainSplitter);
+    for (i=0; i<self->bufsize; i++) {
+        self->data[i] = tmp[i + offset];
+    }
+    (*self->muladd_func_ptr)(self);
+}
+
+static int
+MultiChorus_traverse(MultiChorus *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->mainSplitter);
+    return 0;
+}
+
+static int
+MultiChorus_clear(MultiChorus *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->mainSplitter);
+    return 0;
+}
+
+static void
+MultiChorus_dealloc(MultiChorus* self)
+{
+    pyo_DEALLOC
+    MultiChorus_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+MultiChorus_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *maintmp=NULL, *multmp=NULL, *addtmp=NULL;
+    MultiChorus *self;
+    self = (MultiChorus *)type->tp_alloc(type, 0);
+
+    self->modebuffer[0] = 0;
+    self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, MultiChorus_compute_next_data_frame);
+    self->mode_func_ptr = MultiChorus_setProcMode;
+
+    static char *kwlist[] = {"mainSplitter", "chnl", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "Oi|OO", kwlist, &maintmp, &self->chnl, &multmp, &addtmp))
+        Py_RETURN_NONE;
+
+    Py_XDECREF(self->mainSplitter);
+    Py_INCREF(maintmp);
+    self->mainSplitter = (MultiChorusMain *)maintmp;
+
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
+
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * MultiChorus_getServer(MultiChorus* self) { GET_SERVER };
+static PyObject * MultiChorus_getStream(MultiChorus* self) { GET_STREAM };
+static PyObject * MultiChorus_setMul(MultiChorus *self, PyObject *arg) { SET_MUL };
+static PyObject * MultiChorus_setAdd(MultiChorus *self, PyObject *arg) { SET_ADD };
+static PyObject * MultiChorus_setSub(MultiChorus *self, PyObject *arg) { SET_SUB };
+static PyObject * MultiChorus_setDiv(MultiChorus *self, PyObject *arg) { SET_DIV };
+
+static PyObject * MultiChorus_play(MultiChorus *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * MultiChorus_out(MultiChorus *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * MultiChorus_stop(MultiChorus *self) { STOP };
+
+static PyObject * MultiChorus_multiply(MultiChorus *self, PyObject *arg) { MULTIPLY };
+static PyObject * MultiChorus_inplace_multiply(MultiChorus *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * MultiChorus_add(MultiChorus *self, PyObject *arg) { ADD };
+static PyObject * MultiChorus_inplace_add(MultiChorus *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * MultiChorus_sub(MultiChorus *self, PyObject *arg) { SUB };
+static PyObject * MultiChorus_inplace_sub(MultiChorus *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * MultiChorus_div(MultiChorus *self, PyObject *arg) { DIV };
+static PyObject * MultiChorus_inplace_div(MultiChorus *self, PyObject *arg) { INPLACE_DIV };
+
+static PyMemberDef MultiChorus_members[] = {
+{"server", T_OBJECT_EX, offsetof(MultiChorus, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(MultiChorus, stream), 0, "Stream object."},
+{"mul", T_OBJECT_EX, offsetof(MultiChorus, mul), 0, "Mul factor."},
+{"add", T_OBJECT_EX, offsetof(MultiChorus, add), 0, "Add factor."},
+{NULL}  /* Sentinel */
+};
+
+static PyMethodDef MultiChorus_methods[] = {
+{"getServer", (PyCFunction)MultiChorus_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)MultiChorus_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)MultiChorus_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"out", (PyCFunction)MultiChorus_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+{"stop", (PyCFunction)MultiChorus_stop, METH_NOARGS, "Stops computing."},
+{"setMul", (PyCFunction)MultiChorus_setMul, METH_O, "Sets MultiChorus mul factor."},
+{"setAdd", (PyCFunction)MultiChorus_setAdd, METH_O, "Sets MultiChorus add factor."},
+{"setSub", (PyCFunction)MultiChorus_setSub, METH_O, "Sets inverse add factor."},
+{"setDiv", (PyCFunction)MultiChorus_setDiv, METH_O, "Sets inverse mul factor."},
+{NULL}  /* Sentinel */
+};
+
+static PyNumberMethods MultiChorus_as_number = {
+(binaryfunc)MultiChorus_add,                      /*nb_add*/
+(binaryfunc)MultiChorus_sub,                 /*nb_subtract*/
+(binaryfunc)MultiChorus_multiply,                 /*nb_multiply*/
+(binaryfunc)MultiChorus_div,                   /*nb_divide*/
+0,                /*nb_remainder*/
+0,                   /*nb_divmod*/
+0,                   /*nb_power*/
+0,                  /*nb_neg*/
+0,                /*nb_pos*/
+0,                  /*(unaryfunc)array_abs,*/
+0,                    /*nb_nonzero*/
+0,                    /*nb_invert*/
+0,               /*nb_lshift*/
+0,              /*nb_rshift*/
+0,              /*nb_and*/
+0,              /*nb_xor*/
+0,               /*nb_or*/
+0,                                          /*nb_coerce*/
+0,                       /*nb_int*/
+0,                      /*nb_long*/
+0,                     /*nb_float*/
+0,                       /*nb_oct*/
+0,                       /*nb_hex*/
+(binaryfunc)MultiChorus_inplace_add,              /*inplace_add*/
+(binaryfunc)MultiChorus_inplace_sub,         /*inplace_subtract*/
+(binaryfunc)MultiChorus_inplace_multiply,         /*inplace_multiply*/
+(binaryfunc)MultiChorus_inplace_div,           /*inplace_divide*/
+0,        /*inplace_remainder*/
+0,           /*inplace_power*/
+0,       /*inplace_lshift*/
+0,      /*inplace_rshift*/
+0,      /*inplace_and*/
+0,      /*inplace_xor*/
+0,       /*inplace_or*/
+0,             /*nb_floor_divide*/
+0,              /*nb_true_divide*/
+0,     /*nb_inplace_floor_divide*/
+0,      /*nb_inplace_true_divide*/
+0,                     /* nb_index */
+};
+
+PyTypeObject MultiChorusType = {
+PyObject_HEAD_INIT(NULL)
+0,                         /*ob_size*/
+"_pyo.MultiChorus_base",         /*tp_name*/
+sizeof(MultiChorus),         /*tp_basicsize*/
+0,                         /*tp_itemsize*/
+(destructor)MultiChorus_dealloc, /*tp_dealloc*/
+0,                         /*tp_print*/
+0,                         /*tp_getattr*/
+0,                         /*tp_setattr*/
+0,                         /*tp_compare*/
+0,                         /*tp_repr*/
+&MultiChorus_as_number,             /*tp_as_number*/
+0,                         /*tp_as_sequence*/
+0,                         /*tp_as_mapping*/
+0,                         /*tp_hash */
+0,                         /*tp_call*/
+0,                         /*tp_str*/
+0,                         /*tp_getattro*/
+0,                         /*tp_setattro*/
+0,                         /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"MultiChorus objects. Reads one channel from a MultiChorusMain object.",           /* tp_doc */
+(traverseproc)MultiChorus_traverse,   /* tp_traverse */
+(inquiry)MultiChorus_clear,           /* tp_clear */
+0,		               /* tp_richcompare */
+0,		               /* tp_weaklistoffset */
+0,		               /* tp_iter */
+0,		               /* tp_iternext */
+MultiChorus_methods,             /* tp_methods */
+MultiChorus_members,             /* tp_members */
+0,                      /* tp_getset */
+0,                         /* tp_base */
+0,                         /* tp_dict */
+0,                         /* tp_descr_get */
+0,                         /* tp_descr_set */
+0,                         /* tp_dictoffset */
+0,      /* tp_init */
+0,                         /* tp_alloc */
+MultiChorus_new,                 /* tp_new */
+};
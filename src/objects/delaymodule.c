@@ -273,6 +273,11 @@ Delay_compute_next_data_frame(Delay *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+Delay_memory(Delay *self) {
+    return (self->size + 1) * sizeof(MYFLT);
+}
+
 static int
 Delay_traverse(Delay *self, visitproc visit, void *arg)
 {
@@ -330,6 +335,7 @@ Delay_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->oneOverSr = 1.0 / self->sr;
 
     Stream_setFunctionPtr(self->stream, Delay_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, Delay_memory);
     self->mode_func_ptr = Delay_setProcMode;
 
     static char *kwlist[] = {"input", "delay", "feedback", "maxdelay", "mul", "add", NULL};
@@ -724,6 +730,11 @@ SDelay_compute_next_data_frame(SDelay *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+SDelay_memory(SDelay *self) {
+    return (self->size + 1) * sizeof(MYFLT);
+}
+
 static int
 SDelay_traverse(SDelay *self, visitproc visit, void *arg)
 {
@@ -772,6 +783,7 @@ SDelay_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, SDelay_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, SDelay_memory);
     self->mode_func_ptr = SDelay_setProcMode;
 
     static char *kwlist[] = {"input", "delay", "maxdelay", "mul", "add", NULL};
@@ -1407,6 +1419,11 @@ Waveguide_compute_next_data_frame(Waveguide *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+Waveguide_memory(Waveguide *self) {
+    return (self->size + 1) * sizeof(MYFLT);
+}
+
 static int
 Waveguide_traverse(Waveguide *self, visitproc visit, void *arg)
 {
@@ -1474,6 +1491,7 @@ Waveguide_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->nyquist = (MYFLT)self->sr * 0.45;
 
     Stream_setFunctionPtr(self->stream, Waveguide_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, Waveguide_memory);
     self->mode_func_ptr = Waveguide_setProcMode;
 
     static char *kwlist[] = {"input", "freq", "dur", "minfreq", "mul", "add", NULL};
@@ -2416,6 +2434,11 @@ AllpassWG_compute_next_data_frame(AllpassWG *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+AllpassWG_memory(AllpassWG *self) {
+    return (self->size + 1 + 3 * (self->alpsize + 1)) * sizeof(MYFLT);
+}
+
 static int
 AllpassWG_traverse(AllpassWG *self, visitproc visit, void *arg)
 {
@@ -2485,6 +2508,7 @@ AllpassWG_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->nyquist = (MYFLT)self->sr * 0.45;
 
     Stream_setFunctionPtr(self->stream, AllpassWG_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, AllpassWG_memory);
     self->mode_func_ptr = AllpassWG_setProcMode;
 
     static char *kwlist[] = {"input", "freq", "feed", "detune", "minfreq", "mul", "add", NULL};
@@ -3419,6 +3443,11 @@ SmoothDelay_compute_next_data_frame(SmoothDelay *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+SmoothDelay_memory(SmoothDelay *self) {
+    return (self->size + 1) * sizeof(MYFLT);
+}
+
 static int
 SmoothDelay_traverse(SmoothDelay *self, visitproc visit, void *arg)
 {
@@ -3482,6 +3511,7 @@ SmoothDelay_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->oneOverSr = self->sampdel1 = self->sampdel2 = 1.0 / self->sr;
 
     Stream_setFunctionPtr(self->stream, SmoothDelay_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, SmoothDelay_memory);
     self->mode_func_ptr = SmoothDelay_setProcMode;
 
     static char *kwlist[] = {"input", "delay", "feedback", "crossfade", "maxdelay", "mul", "add", NULL};
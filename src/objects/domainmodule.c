@@ -0,0 +1,882 @@
+/**************************************************************************
+ * Copyright 2009-2015 Olivier Belanger                                   *
+ *                                                                        *
+ * This file is part of pyo, a python module to help digital signal       *
+ * processing script creation.                                            *
+ *                                                                        *
+ * pyo is free software: you can redistribute it and/or modify            *
+ * it under the terms of the GNU Lesser General Public License as         *
+ * published by the Free Software Foundation, either version 3 of the     *
+ * License, or (at your option) any later version.                        *
+ *                                                                        *
+ * pyo is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU Lesser General Public License for more details.                    *
+ *                                                                        *
+ * You should have received a copy of the GNU Lesser General Public       *
+ * License along with pyo.  If not, see <http://www.gnu.org/licenses/>.   *
+ *************************************************************************/
+
+#include <Python.h>
+#include "structmember.h"
+#include <math.h>
+#include "pyomodule.h"
+#include "streammodule.h"
+#include "servermodule.h"
+#include "dummymodule.h"
+
+/* Resampling filter, an 8th order butterworth lowpass made of 4 biquads.
+** The cutoff is set at 80% of the decimated nyquist frequency. */
+#define DOMAIN_SECTIONS 4
+#define DOMAIN_CUTOFF 0.4
+
+static const MYFLT domain_qs[DOMAIN_SECTIONS] = {0.50979558, 0.60134489, 0.89997622, 2.56291545};
+
+typedef struct {
+    MYFLT b0[DOMAIN_SECTIONS];
+    MYFLT b1[DOMAIN_SECTIONS];
+    MYFLT a1[DOMAIN_SECTIONS];
+    MYFLT a2[DOMAIN_SECTIONS];
+    MYFLT z1[DOMAIN_SECTIONS];
+    MYFLT z2[DOMAIN_SECTIONS];
+} DomainFilter;
+
+static void
+DomainFilter_init(DomainFilter *f, MYFLT freq, MYFLT sr)
+{
+    int j;
+    MYFLT w0, c, alpha, a0;
+
+    w0 = TWOPI * freq / sr;
+    c = MYCOS(w0);
+    for (j=0; j<DOMAIN_SECTIONS; j++) {
+        alpha = MYSIN(w0) / (2.0 * domain_qs[j]);
+        a0 = 1.0 / (1.0 + alpha);
+        f->b0[j] = (1.0 - c) * 0.5 * a0;
+        f->b1[j] = (1.0 - c) * a0;
+        f->a1[j] = -2.0 * c * a0;
+        f->a2[j] = (1.0 - alpha) * a0;
+        f->z1[j] = f->z2[j] = 0.0;
+    }
+}
+
+/* Transposed direct form II, b2 == b0 for a lowpass. */
+static inline MYFLT
+DomainFilter_tick(DomainFilter *f, MYFLT x)
+{
+    int j;
+    MYFLT y;
+
+    for (j=0; j<DOMAIN_SECTIONS; j++) {
+        y = f->b0[j] * x + f->z1[j];
+        f->z1[j] = f->b1[j] * x - f->a1[j] * y + f->z2[j];
+        f->z2[j] = f->b0[j] * x - f->a2[j] * y;
+        x = y;
+    }
+    return x;
+}
+
+/*****************************************************************/
+/* Domain - processes its own streams at a decimated rate        */
+/*****************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *streams;
+    int stream_count;
+    int factor;
+} Domain;
+
+void
+Domain_addStream(PyObject *domain, PyObject *stream)
+{
+    Domain *self = (Domain *)domain;
+    PyList_Append(self->streams, stream);
+    self->stream_count++;
+}
+
+int
+Domain_removeStream(PyObject *domain, int sid)
+{
+    int i;
+    Domain *self = (Domain *)domain;
+
+    for (i=0; i<self->stream_count; i++) {
+        if (Stream_getStreamId((Stream *)PyList_GET_ITEM(self->streams, i)) == sid) {
+            PySequence_DelItem(self->streams, i);
+            self->stream_count--;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+PyObject *
+Domain_getStreamList(PyObject *domain)
+{
+    return ((Domain *)domain)->streams;
+}
+
+int
+Domain_getFactor(PyObject *domain)
+{
+    return ((Domain *)domain)->factor;
+}
+
+/* Same loop as Server_process_buffers, minus the output to the dac.
+** Streams of the subgraph compute bufsize/factor samples per call. */
+static void
+Domain_compute_next_data_frame(Domain *self)
+{
+    int i;
+    Stream *stream_tmp;
+
+    for (i=0; i<self->stream_count; i++) {
+        stream_tmp = (Stream *)PyList_GET_ITEM(self->streams, i);
+        if (Stream_getStreamActive(stream_tmp) == 1) {
+            Server_traceStream((Server *)self->server, 'B', (PyObject *)stream_tmp);
+            Server_rtcheckEnter((Server *)self->server, (PyObject *)stream_tmp);
+            Stream_callFunction(stream_tmp);
+            Server_traceStream((Server *)self->server, 'E', (PyObject *)stream_tmp);
+            if (Stream_getDuration(stream_tmp) != 0) {
+                Stream_IncrementDurationCount(stream_tmp);
+            }
+        }
+        else if (Stream_getBufferCountWait(stream_tmp) != 0)
+            Stream_IncrementBufferCount(stream_tmp);
+    }
+    Server_rtcheckEnter((Server *)self->server, (PyObject *)self->stream);
+}
+
+static int
+Domain_traverse(Domain *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->streams);
+    return 0;
+}
+
+static int
+Domain_clear(Domain *self)
+{
+    if (self->server != NULL)
+        Server_unregisterDomain((Server *)self->server, (PyObject *)self);
+    pyo_CLEAR
+    Py_CLEAR(self->streams);
+    return 0;
+}
+
+static void
+Domain_dealloc(Domain* self)
+{
+    pyo_DEALLOC
+    Domain_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+Domain_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    Domain *self;
+    self = (Domain *)type->tp_alloc(type, 0);
+
+    self->factor = 2;
+    self->stream_count = 0;
+    self->streams = PyList_New(0);
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, Domain_compute_next_data_frame);
+
+    static char *kwlist[] = {"factor", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "|i", kwlist, &self->factor)) {
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    if (((Server *)self->server)->domain != NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "Domain objects can't be nested.");
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    if (self->factor < 1 || (self->bufsize % self->factor) != 0) {
+        PyErr_Format(PyExc_ValueError, "Domain factor must be a positive divisor of the buffer size (%d).", self->bufsize);
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    Server_registerDomain((Server *)self->server, (PyObject *)self);
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    return (PyObject *)self;
+}
+
+static PyObject * Domain_getServer(Domain* self) { GET_SERVER };
+static PyObject * Domain_getStream(Domain* self) { GET_STREAM };
+
+static PyObject * Domain_play(Domain *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * Domain_stop(Domain *self) { STOP };
+
+static PyObject *
+Domain_getFactor_py(Domain *self)
+{
+    return PyInt_FromLong(self->factor);
+}
+
+static PyObject *
+Domain_getStreams(Domain *self)
+{
+    Py_INCREF(self->streams);
+    return self->streams;
+}
+
+static PyMemberDef Domain_members[] = {
+{"server", T_OBJECT_EX, offsetof(Domain, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(Domain, stream), 0, "Stream object."},
+{NULL}  /* Sentinel */
+};
+
+static PyMethodDef Domain_methods[] = {
+{"getServer", (PyCFunction)Domain_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)Domain_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)Domain_play, METH_VARARGS|METH_KEYWORDS, "Starts computing the subgraph."},
+{"stop", (PyCFunction)Domain_stop, METH_NOARGS, "Stops computing the subgraph."},
+{"getFactor", (PyCFunction)Domain_getFactor_py, METH_NOARGS, "Returns the decimation factor."},
+{"getStreams", (PyCFunction)Domain_getStreams, METH_NOARGS, "Returns the list of streams computed at the decimated rate."},
+{NULL}  /* Sentinel */
+};
+
+PyTypeObject DomainType = {
+PyObject_HEAD_INIT(NULL)
+0,                                              /*ob_size*/
+"_pyo.Domain_base",                                   /*tp_name*/
+sizeof(Domain),                                 /*tp_basicsize*/
+0,                                              /*tp_itemsize*/
+(destructor)Domain_dealloc,                     /*tp_dealloc*/
+0,                                              /*tp_print*/
+0,                                              /*tp_getattr*/
+0,                                              /*tp_setattr*/
+0,                                              /*tp_compare*/
+0,                                              /*tp_repr*/
+0,                                              /*tp_as_number*/
+0,                                              /*tp_as_sequence*/
+0,                                              /*tp_as_mapping*/
+0,                                              /*tp_hash */
+0,                                              /*tp_call*/
+0,                                              /*tp_str*/
+0,                                              /*tp_getattro*/
+0,                                              /*tp_setattro*/
+0,                                              /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"Domain objects. Computes a subgraph at a decimated sampling rate.",           /* tp_doc */
+(traverseproc)Domain_traverse,                  /* tp_traverse */
+(inquiry)Domain_clear,                          /* tp_clear */
+0,                                              /* tp_richcompare */
+0,                                              /* tp_weaklistoffset */
+0,                                              /* tp_iter */
+0,                                              /* tp_iternext */
+Domain_methods,                                 /* tp_methods */
+Domain_members,                                 /* tp_members */
+0,                                              /* tp_getset */
+0,                                              /* tp_base */
+0,                                              /* tp_dict */
+0,                                              /* tp_descr_get */
+0,                                              /* tp_descr_set */
+0,                                              /* tp_dictoffset */
+0,                          /* tp_init */
+0,                                              /* tp_alloc */
+Domain_new,                                     /* tp_new */
+};
+
+/*****************************************************************/
+/* DomainIn - anti-aliased decimation into a Domain             */
+/*****************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream *input_stream;
+    PyObject *domain;
+    DomainFilter filter;
+    int factor;
+    int modebuffer[2]; // need at least 2 slots for mul & add
+} DomainIn;
+
+static void
+DomainIn_process(DomainIn *self) {
+    int i, k, factor = self->factor;
+    MYFLT y = 0.0;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        for (k=0; k<factor; k++) {
+            y = DomainFilter_tick(&self->filter, *in++);
+        }
+        self->data[i] = y;
+    }
+}
+
+static void DomainIn_postprocessing_ii(DomainIn *self) { POST_PROCESSING_II };
+static void DomainIn_postprocessing_ai(DomainIn *self) { POST_PROCESSING_AI };
+static void DomainIn_postprocessing_ia(DomainIn *self) { POST_PROCESSING_IA };
+static void DomainIn_postprocessing_aa(DomainIn *self) { POST_PROCESSING_AA };
+static void DomainIn_postprocessing_ireva(DomainIn *self) { POST_PROCESSING_IREVA };
+static void DomainIn_postprocessing_areva(DomainIn *self) { POST_PROCESSING_AREVA };
+static void DomainIn_postprocessing_revai(DomainIn *self) { POST_PROCESSING_REVAI };
+static void DomainIn_postprocessing_revaa(DomainIn *self) { POST_PROCESSING_REVAA };
+static void DomainIn_postprocessing_revareva(DomainIn *self) { POST_PROCESSING_REVAREVA };
+
+static void
+DomainIn_setProcMode(DomainIn *self)
+{
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+    self->proc_func_ptr = DomainIn_process;
+
+	switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = DomainIn_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = DomainIn_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = DomainIn_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = DomainIn_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = DomainIn_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = DomainIn_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = DomainIn_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = DomainIn_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = DomainIn_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+DomainIn_compute_next_data_frame(DomainIn *self)
+{
+    (*self->proc_func_ptr)(self);
+    (*self->muladd_func_ptr)(self);
+}
+
+static int
+DomainIn_traverse(DomainIn *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->input);
+    Py_VISIT(self->input_stream);
+    Py_VISIT(self->domain);
+    return 0;
+}
+
+static int
+DomainIn_clear(DomainIn *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->input);
+    Py_CLEAR(self->input_stream);
+    Py_CLEAR(self->domain);
+    return 0;
+}
+
+static void
+DomainIn_dealloc(DomainIn* self)
+{
+    pyo_DEALLOC
+    DomainIn_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+DomainIn_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *inputtmp, *input_streamtmp, *domaintmp, *multmp=NULL, *addtmp=NULL;
+    DomainIn *self;
+    self = (DomainIn *)type->tp_alloc(type, 0);
+
+    self->domain = NULL;
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, DomainIn_compute_next_data_frame);
+    self->mode_func_ptr = DomainIn_setProcMode;
+
+    static char *kwlist[] = {"input", "domain", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OO|OO", kwlist, &inputtmp, &domaintmp, &multmp, &addtmp))
+        Py_RETURN_NONE;
+
+    if (! PyObject_TypeCheck(domaintmp, &DomainType)) {
+        PyErr_SetString(PyExc_TypeError, "\"domain\" argument must be a Domain object.");
+        Py_DECREF(self);
+        return NULL;
+    }
+    if (((Server *)self->server)->domain != domaintmp) {
+        PyErr_SetString(PyExc_RuntimeError, "DomainIn must be created inside its Domain.");
+        Py_DECREF(self);
+        return NULL;
+    }
+    Py_INCREF(domaintmp);
+    self->domain = domaintmp;
+    self->factor = ((Domain *)domaintmp)->factor;
+    DomainFilter_init(&self->filter, self->sr * DOMAIN_CUTOFF, self->sr * self->factor);
+
+    INIT_INPUT_STREAM
+
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
+
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * DomainIn_getServer(DomainIn* self) { GET_SERVER };
+static PyObject * DomainIn_getStream(DomainIn* self) { GET_STREAM };
+static PyObject * DomainIn_setMul(DomainIn *self, PyObject *arg) { SET_MUL };
+static PyObject * DomainIn_setAdd(DomainIn *self, PyObject *arg) { SET_ADD };
+static PyObject * DomainIn_setSub(DomainIn *self, PyObject *arg) { SET_SUB };
+static PyObject * DomainIn_setDiv(DomainIn *self, PyObject *arg) { SET_DIV };
+
+static PyObject * DomainIn_play(DomainIn *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * DomainIn_out(DomainIn *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * DomainIn_stop(DomainIn *self) { STOP };
+
+static PyObject * DomainIn_multiply(DomainIn *self, PyObject *arg) { MULTIPLY };
+static PyObject * DomainIn_inplace_multiply(DomainIn *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * DomainIn_add(DomainIn *self, PyObject *arg) { ADD };
+static PyObject * DomainIn_inplace_add(DomainIn *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * DomainIn_sub(DomainIn *self, PyObject *arg) { SUB };
+static PyObject * DomainIn_inplace_sub(DomainIn *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * DomainIn_div(DomainIn *self, PyObject *arg) { DIV };
+static PyObject * DomainIn_inplace_div(DomainIn *self, PyObject *arg) { INPLACE_DIV };
+
+static PyMemberDef DomainIn_members[] = {
+    {"server", T_OBJECT_EX, offsetof(DomainIn, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(DomainIn, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(DomainIn, input), 0, "Input sound object."},
+    {"domain", T_OBJECT_EX, offsetof(DomainIn, domain), 0, "Domain object."},
+    {"mul", T_OBJECT_EX, offsetof(DomainIn, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(DomainIn, add), 0, "Add factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef DomainIn_methods[] = {
+    {"getServer", (PyCFunction)DomainIn_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)DomainIn_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)DomainIn_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"stop", (PyCFunction)DomainIn_stop, METH_NOARGS, "Stops computing."},
+    {"out", (PyCFunction)DomainIn_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"setMul", (PyCFunction)DomainIn_setMul, METH_O, "Sets oscillator mul factor."},
+    {"setAdd", (PyCFunction)DomainIn_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)DomainIn_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)DomainIn_setDiv, METH_O, "Sets inverse mul factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyNumberMethods DomainIn_as_number = {
+    (binaryfunc)DomainIn_add,                         /*nb_add*/
+    (binaryfunc)DomainIn_sub,                         /*nb_subtract*/
+    (binaryfunc)DomainIn_multiply,                    /*nb_multiply*/
+    (binaryfunc)DomainIn_div,                                              /*nb_divide*/
+    0,                                              /*nb_remainder*/
+    0,                                              /*nb_divmod*/
+    0,                                              /*nb_power*/
+    0,                                              /*nb_neg*/
+    0,                                              /*nb_pos*/
+    0,                                              /*(unaryfunc)array_abs,*/
+    0,                                              /*nb_nonzero*/
+    0,                                              /*nb_invert*/
+    0,                                              /*nb_lshift*/
+    0,                                              /*nb_rshift*/
+    0,                                              /*nb_and*/
+    0,                                              /*nb_xor*/
+    0,                                              /*nb_or*/
+    0,                                              /*nb_coerce*/
+    0,                                              /*nb_int*/
+    0,                                              /*nb_long*/
+    0,                                              /*nb_float*/
+    0,                                              /*nb_oct*/
+    0,                                              /*nb_hex*/
+    (binaryfunc)DomainIn_inplace_add,                 /*inplace_add*/
+    (binaryfunc)DomainIn_inplace_sub,                 /*inplace_subtract*/
+    (binaryfunc)DomainIn_inplace_multiply,            /*inplace_multiply*/
+    (binaryfunc)DomainIn_inplace_div,                                              /*inplace_divide*/
+    0,                                              /*inplace_remainder*/
+    0,                                              /*inplace_power*/
+    0,                                              /*inplace_lshift*/
+    0,                                              /*inplace_rshift*/
+    0,                                              /*inplace_and*/
+    0,                                              /*inplace_xor*/
+    0,                                              /*inplace_or*/
+    0,                                              /*nb_floor_divide*/
+    0,                                              /*nb_true_divide*/
+    0,                                              /*nb_inplace_floor_divide*/
+    0,                                              /*nb_inplace_true_divide*/
+    0,                                              /* nb_index */
+};
+
+PyTypeObject DomainInType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                                              /*ob_size*/
+    "_pyo.DomainIn_base",                                   /*tp_name*/
+    sizeof(DomainIn),                                 /*tp_basicsize*/
+    0,                                              /*tp_itemsize*/
+    (destructor)DomainIn_dealloc,                     /*tp_dealloc*/
+    0,                                              /*tp_print*/
+    0,                                              /*tp_getattr*/
+    0,                                              /*tp_setattr*/
+    0,                                              /*tp_compare*/
+    0,                                              /*tp_repr*/
+    &DomainIn_as_number,                              /*tp_as_number*/
+    0,                                              /*tp_as_sequence*/
+    0,                                              /*tp_as_mapping*/
+    0,                                              /*tp_hash */
+    0,                                              /*tp_call*/
+    0,                                              /*tp_str*/
+    0,                                              /*tp_getattro*/
+    0,                                              /*tp_setattro*/
+    0,                                              /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "DomainIn objects. Decimates a full rate signal into a Domain.",           /* tp_doc */
+    (traverseproc)DomainIn_traverse,                  /* tp_traverse */
+    (inquiry)DomainIn_clear,                          /* tp_clear */
+    0,                                              /* tp_richcompare */
+    0,                                              /* tp_weaklistoffset */
+    0,                                              /* tp_iter */
+    0,                                              /* tp_iternext */
+    DomainIn_methods,                                 /* tp_methods */
+    DomainIn_members,                                 /* tp_members */
+    0,                                              /* tp_getset */
+    0,                                              /* tp_base */
+    0,                                              /* tp_dict */
+    0,                                              /* tp_descr_get */
+    0,                                              /* tp_descr_set */
+    0,                                              /* tp_dictoffset */
+    0,                          /* tp_init */
+    0,                                              /* tp_alloc */
+    DomainIn_new,                                     /* tp_new */
+};
+
+/*****************************************************************/
+/* DomainOut - interpolation from a Domain to full rate         */
+/*****************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream *input_stream;
+    PyObject *domain;
+    DomainFilter filter;
+    int factor;
+    MYFLT last;
+    int modebuffer[2]; // need at least 2 slots for mul & add
+} DomainOut;
+
+static void
+DomainOut_process(DomainOut *self) {
+    int i, k, num, factor = self->factor;
+    MYFLT cur, inc, val;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *out = self->data;
+
+    num = self->bufsize / factor;
+    for (i=0; i<num; i++) {
+        cur = in[i];
+        inc = (cur - self->last) / factor;
+        val = self->last;
+        for (k=0; k<factor; k++) {
+            val += inc;
+            *out++ = DomainFilter_tick(&self->filter, val);
+        }
+        self->last = cur;
+    }
+}
+
+static void DomainOut_postprocessing_ii(DomainOut *self) { POST_PROCESSING_II };
+static void DomainOut_postprocessing_ai(DomainOut *self) { POST_PROCESSING_AI };
+static void DomainOut_postprocessing_ia(DomainOut *self) { POST_PROCESSING_IA };
+static void DomainOut_postprocessing_aa(DomainOut *self) { POST_PROCESSING_AA };
+static void DomainOut_postprocessing_ireva(DomainOut *self) { POST_PROCESSING_IREVA };
+static void DomainOut_postprocessing_areva(DomainOut *self) { POST_PROCESSING_AREVA };
+static void DomainOut_postprocessing_revai(DomainOut *self) { POST_PROCESSING_REVAI };
+static void DomainOut_postprocessing_revaa(DomainOut *self) { POST_PROCESSING_REVAA };
+static void DomainOut_postprocessing_revareva(DomainOut *self) { POST_PROCESSING_REVAREVA };
+
+static void
+DomainOut_setProcMode(DomainOut *self)
+{
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+    self->proc_func_ptr = DomainOut_process;
+
+	switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = DomainOut_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = DomainOut_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = DomainOut_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = DomainOut_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = DomainOut_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = DomainOut_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = DomainOut_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = DomainOut_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = DomainOut_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+DomainOut_compute_next_data_frame(DomainOut *self)
+{
+    (*self->proc_func_ptr)(self);
+    (*self->muladd_func_ptr)(self);
+}
+
+static int
+DomainOut_traverse(DomainOut *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->input);
+    Py_VISIT(self->input_stream);
+    Py_VISIT(self->domain);
+    return 0;
+}
+
+static int
+DomainOut_clear(DomainOut *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->input);
+    Py_CLEAR(self->input_stream);
+    Py_CLEAR(self->domain);
+    return 0;
+}
+
+static void
+DomainOut_dealloc(DomainOut* self)
+{
+    pyo_DEALLOC
+    DomainOut_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+DomainOut_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *inputtmp, *input_streamtmp, *domaintmp, *multmp=NULL, *addtmp=NULL;
+    DomainOut *self;
+    self = (DomainOut *)type->tp_alloc(type, 0);
+
+    self->domain = NULL;
+    self->last = 0.0;
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, DomainOut_compute_next_data_frame);
+    self->mode_func_ptr = DomainOut_setProcMode;
+
+    static char *kwlist[] = {"input", "domain", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OO|OO", kwlist, &inputtmp, &domaintmp, &multmp, &addtmp))
+        Py_RETURN_NONE;
+
+    if (! PyObject_TypeCheck(domaintmp, &DomainType)) {
+        PyErr_SetString(PyExc_TypeError, "\"domain\" argument must be a Domain object.");
+        Py_DECREF(self);
+        return NULL;
+    }
+    if (((Server *)self->server)->domain != NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "DomainOut must be created outside of any Domain.");
+        Py_DECREF(self);
+        return NULL;
+    }
+    Py_INCREF(domaintmp);
+    self->domain = domaintmp;
+    self->factor = ((Domain *)domaintmp)->factor;
+    DomainFilter_init(&self->filter, self->sr * DOMAIN_CUTOFF / self->factor, self->sr);
+
+    INIT_INPUT_STREAM
+
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
+
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * DomainOut_getServer(DomainOut* self) { GET_SERVER };
+static PyObject * DomainOut_getStream(DomainOut* self) { GET_STREAM };
+static PyObject * DomainOut_setMul(DomainOut *self, PyObject *arg) { SET_MUL };
+static PyObject * DomainOut_setAdd(DomainOut *self, PyObject *arg) { SET_ADD };
+static PyObject * DomainOut_setSub(DomainOut *self, PyObject *arg) { SET_SUB };
+static PyObject * DomainOut_setDiv(DomainOut *self, PyObject *arg) { SET_DIV };
+
+static PyObject * DomainOut_play(DomainOut *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * DomainOut_out(DomainOut *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * DomainOut_stop(DomainOut *self) { STOP };
+
+static PyObject * DomainOut_multiply(DomainOut *self, PyObject *arg) { MULTIPLY };
+static PyObject * DomainOut_inplace_multiply(DomainOut *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * DomainOut_add(DomainOut *self, PyObject *arg) { ADD };
+static PyObject * DomainOut_inplace_add(DomainOut *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * DomainOut_sub(DomainOut *self, PyObject *arg) { SUB };
+static PyObject * DomainOut_inplace_sub(DomainOut *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * DomainOut_div(DomainOut *self, PyObject *arg) { DIV };
+static PyObject * DomainOut_inplace_div(DomainOut *self, PyObject *arg) { INPLACE_DIV };
+
+static PyMemberDef DomainOut_members[] = {
+    {"server", T_OBJECT_EX, offsetof(DomainOut, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(DomainOut, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(DomainOut, input), 0, "Input sound object."},
+    {"domain", T_OBJECT_EX, offsetof(DomainOut, domain), 0, "Domain object."},
+    {"mul", T_OBJECT_EX, offsetof(DomainOut, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(DomainOut, add), 0, "Add factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef DomainOut_methods[] = {
+    {"getServer", (PyCFunction)DomainOut_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)DomainOut_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)DomainOut_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"stop", (PyCFunction)DomainOut_stop, METH_NOARGS, "Stops computing."},
+    {"out", (PyCFunction)DomainOut_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"setMul", (PyCFunction)DomainOut_setMul, METH_O, "Sets oscillator mul factor."},
+    {"setAdd", (PyCFunction)DomainOut_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)DomainOut_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)DomainOut_setDiv, METH_O, "Sets inverse mul factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyNumberMethods DomainOut_as_number = {
+    (binaryfunc)DomainOut_add,                         /*nb_add*/
+    (binaryfunc)DomainOut_sub,                         /*nb_subtract*/
+    (binaryfunc)DomainOut_multiply,                    /*nb_multiply*/
+    (binaryfunc)DomainOut_div,                                              /*nb_divide*/
+    0,                                              /*nb_remainder*/
+    0,                                              /*nb_divmod*/
+    0,                                              /*nb_power*/
+    0,                                              /*nb_neg*/
+    0,                                              /*nb_pos*/
+    0,                                              /*(unaryfunc)array_abs,*/
+    0,                                              /*nb_nonzero*/
+    0,                                              /*nb_invert*/
+    0,                                              /*nb_lshift*/
+    0,                                              /*nb_rshift*/
+    0,                                              /*nb_and*/
+    0,                                              /*nb_xor*/
+    0,                                              /*nb_or*/
+    0,                                              /*nb_coerce*/
+    0,                                              /*nb_int*/
+    0,                                              /*nb_long*/
+    0,                                              /*nb_float*/
+    0,                                              /*nb_oct*/
+    0,                                              /*nb_hex*/
+    (binaryfunc)DomainOut_inplace_add,                 /*inplace_add*/
+    (binaryfunc)DomainOut_inplace_sub,                 /*inplace_subtract*/
+    (binaryfunc)DomainOut_inplace_multiply,            /*inplace_multiply*/
+    (binaryfunc)DomainOut_inplace_div,                                              /*inplace_divide*/
+    0,                                              /*inplace_remainder*/
+    0,                                              /*inplace_power*/
+    0,                                              /*inplace_lshift*/
+    0,                                              /*inplace_rshift*/
+    0,                                              /*inplace_and*/
+    0,                                              /*inplace_xor*/
+    0,                                              /*inplace_or*/
+    0,                                              /*nb_floor_divide*/
+    0,                                              /*nb_true_divide*/
+    0,                                              /*nb_inplace_floor_divide*/
+    0,                                              /*nb_inplace_true_divide*/
+    0,                                              /* nb_index */
+};
+
+PyTypeObject DomainOutType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                                              /*ob_size*/
+    "_pyo.DomainOut_base",                                   /*tp_name*/
+    sizeof(DomainOut),                                 /*tp_basicsize*/
+    0,                                              /*tp_itemsize*/
+    (destructor)DomainOut_dealloc,                     /*tp_dealloc*/
+    0,                                              /*tp_print*/
+    0,                                              /*tp_getattr*/
+    0,                                              /*tp_setattr*/
+    0,                                              /*tp_compare*/
+    0,                                              /*tp_repr*/
+    &DomainOut_as_number,                              /*tp_as_number*/
+    0,                                              /*tp_as_sequence*/
+    0,                                              /*tp_as_mapping*/
+    0,                                              /*tp_hash */
+    0,                                              /*tp_call*/
+    0,                                              /*tp_str*/
+    0,                                              /*tp_getattro*/
+    0,                                              /*tp_setattro*/
+    0,                                              /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "DomainOut objects. Interpolates a Domain signal back to full rate.",           /* tp_doc */
+    (traverseproc)DomainOut_traverse,                  /* tp_traverse */
+    (inquiry)DomainOut_clear,                          /* tp_clear */
+    0,                                              /* tp_richcompare */
+    0,                                              /* tp_weaklistoffset */
+    0,                                              /* tp_iter */
+    0,                                              /* tp_iternext */
+    DomainOut_methods,                                 /* tp_methods */
+    DomainOut_members,                                 /* tp_members */
+    0,                                              /* tp_getset */
+    0,                                              /* tp_base */
+    0,                                              /* tp_dict */
+    0,                                              /* tp_descr_get */
+    0,                                              /* tp_descr_set */
+    0,                                              /* tp_dictoffset */
+    0,                          /* tp_init */
+    0,                                              /* tp_alloc */
+    DomainOut_new,                                     /* tp_new */
+};
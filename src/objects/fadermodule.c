@@ -1635,4 +1635,565 @@ PyTypeObject ExpsegType = {
     0,      /* tp_init */
     0,                         /* tp_alloc */
     Expseg_new,                 /* tp_new */
-};
\ No newline at end of file
+};
+
+/* Automation curve types */
+#define AUTOMATION_LINEAR 0
+#define AUTOMATION_EXP 1
+#define AUTOMATION_COS 2
+#define AUTOMATION_STEP 3
+
+typedef struct {
+    pyo_audio_HEAD
+    int modebuffer[2];
+    double *frames; /* break-points positions, in samples */
+    MYFLT *values;
+    MYFLT *shapes;
+    int *curves;
+    int listsize;
+    int maxsize;
+    int which;
+    double count;
+    int loop;
+} Automation;
+
+/* Grows the break-points arrays to hold at least `size` points. Returns -1 on failure. */
+static int
+Automation_reserve(Automation *self, int size) {
+    int maxsize;
+    double *frames;
+    MYFLT *values, *shapes;
+    int *curves;
+
+    if (size <= self->maxsize)
+        return 0;
+    maxsize = size < 2 * self->listsize ? 2 * self->listsize : size;
+
+    /* Each array is kept valid, even if a later one can't grow. */
+    frames = (double *)realloc(self->frames, maxsize * sizeof(double));
+    if (frames == NULL)
+        return -1;
+    self->frames = frames;
+    values = (MYFLT *)realloc(self->values, maxsize * sizeof(MYFLT));
+    if (values == NULL)
+        return -1;
+    self->values = values;
+    shapes = (MYFLT *)realloc(self->shapes, maxsize * sizeof(MYFLT));
+    if (shapes == NULL)
+        return -1;
+    self->shapes = shapes;
+    curves = (int *)realloc(self->curves, maxsize * sizeof(int));
+    if (curves == NULL)
+        return -1;
+    self->curves = curves;
+    self->maxsize = maxsize;
+    return 0;
+}
+
+/* Discards the break-points before the current segment. Positions are
+   absolute, the lane goes on unchanged. Returns the number of points removed. */
+static int
+Automation_trim(Automation *self) {
+    int n = self->which;
+
+    if (n <= 0)
+        return 0;
+    self->listsize -= n;
+    memmove(self->frames, self->frames + n, self->listsize * sizeof(double));
+    memmove(self->values, self->values + n, self->listsize * sizeof(MYFLT));
+    memmove(self->shapes, self->shapes + n, self->listsize * sizeof(MYFLT));
+    memmove(self->curves, self->curves + n, self->listsize * sizeof(int));
+    self->which = 0;
+    return n;
+}
+
+/* Adds a list of (time, value[, curve[, shape]]) tuples at the end of the lane.
+   Returns the number of points actually added, or -1 if out of memory. */
+static int
+Automation_append_pointslist(Automation *self, PyObject *pointslist) {
+    int i, size, tupsize, added = 0;
+    double frame;
+    PyObject *tup;
+
+    size = PyList_Size(pointslist);
+    if (Automation_reserve(self, self->listsize + size) < 0)
+        return -1;
+
+    for (i=0; i<size; i++) {
+        tup = PyList_GET_ITEM(pointslist, i);
+        if (! PyTuple_Check(tup) || PyTuple_Size(tup) < 2)
+            continue;
+        tupsize = PyTuple_Size(tup);
+        frame = PyFloat_AsDouble(PyNumber_Float(PyTuple_GET_ITEM(tup, 0))) * self->sr;
+        if (self->listsize > 0 && frame < self->frames[self->listsize-1]) {
+            printf("Automation: break-point times must be in increasing order, point ignored.\n");
+            continue;
+        }
+        self->frames[self->listsize] = frame;
+        self->values[self->listsize] = PyFloat_AsDouble(PyNumber_Float(PyTuple_GET_ITEM(tup, 1)));
+        self->curves[self->listsize] = AUTOMATION_LINEAR;
+        self->shapes[self->listsize] = 10.0;
+        if (tupsize > 2) {
+            self->curves[self->listsize] = PyInt_AsLong(PyNumber_Int(PyTuple_GET_ITEM(tup, 2)));
+            if (self->curves[self->listsize] < AUTOMATION_LINEAR || self->curves[self->listsize] > AUTOMATION_STEP)
+                self->curves[self->listsize] = AUTOMATION_LINEAR;
+        }
+        if (tupsize > 3)
+            self->shapes[self->listsize] = PyFloat_AsDouble(PyNumber_Float(PyTuple_GET_ITEM(tup, 3)));
+        self->listsize++;
+        added++;
+    }
+
+    return added;
+}
+
+/* Finds the segment containing the current position. */
+static void
+Automation_search(Automation *self) {
+    int lo = 0, hi = self->listsize - 1, mid;
+
+    if (self->listsize == 0 || self->count < self->frames[0]) {
+        self->which = 0;
+        return;
+    }
+    while (lo < hi) {
+        mid = (lo + hi + 1) / 2;
+        if (self->frames[mid] <= self->count)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    self->which = lo;
+}
+
+static void
+Automation_generate(Automation *self) {
+    int i, j, n, last;
+    double start, pos, inc, v0, range;
+
+    i = 0;
+    while (i < self->bufsize) {
+        if (self->listsize == 0) {
+            for (j=i; j<self->bufsize; j++)
+                self->data[j] = 0.0;
+            break;
+        }
+
+        last = self->listsize - 1;
+
+        /* Before the first break-point, holds the first value. */
+        if (self->count < self->frames[0]) {
+            n = (int)MYCEIL(self->frames[0] - self->count);
+            if (n > (self->bufsize - i))
+                n = self->bufsize - i;
+            for (j=0; j<n; j++)
+                self->data[i+j] = self->values[0];
+            i += n;
+            self->count += n;
+            continue;
+        }
+
+        while (self->which < last && self->count >= self->frames[self->which+1])
+            self->which++;
+
+        /* After the last break-point, loops or holds the last value. */
+        if (self->which == last) {
+            if (self->loop == 1 && self->frames[last] >= 1.0) {
+                self->count = 0.0;
+                self->which = 0;
+                continue;
+            }
+            for (j=i; j<self->bufsize; j++)
+                self->data[j] = self->values[last];
+            self->count += self->bufsize - i;
+            break;
+        }
+
+        /* Renders the run of samples of the current segment in one pass. */
+        start = self->frames[self->which];
+        n = (int)MYCEIL(self->frames[self->which+1] - self->count);
+        if (n > (self->bufsize - i))
+            n = self->bufsize - i;
+        inc = 1.0 / (self->frames[self->which+1] - start);
+        pos = (self->count - start) * inc;
+        v0 = self->values[self->which];
+        range = self->values[self->which+1] - v0;
+
+        switch (self->curves[self->which]) {
+            case AUTOMATION_LINEAR:
+                for (j=0; j<n; j++)
+                    self->data[i+j] = (MYFLT)(v0 + range * (pos + j * inc));
+                break;
+            case AUTOMATION_EXP:
+                for (j=0; j<n; j++)
+                    self->data[i+j] = (MYFLT)(v0 + range * pow(pos + j * inc, self->shapes[self->which]));
+                break;
+            case AUTOMATION_COS:
+                for (j=0; j<n; j++)
+                    self->data[i+j] = (MYFLT)(v0 + range * (0.5 - 0.5 * cos(PI * (pos + j * inc))));
+                break;
+            case AUTOMATION_STEP:
+                for (j=0; j<n; j++)
+                    self->data[i+j] = (MYFLT)v0;
+                break;
+        }
+        i += n;
+        self->count += n;
+    }
+}
+
+static void Automation_postprocessing_ii(Automation *self) { POST_PROCESSING_II };
+static void Automation_postprocessing_ai(Automation *self) { POST_PROCESSING_AI };
+static void Automation_postprocessing_ia(Automation *self) { POST_PROCESSING_IA };
+static void Automation_postprocessing_aa(Automation *self) { POST_PROCESSING_AA };
+static void Automation_postprocessing_ireva(Automation *self) { POST_PROCESSING_IREVA };
+static void Automation_postprocessing_areva(Automation *self) { POST_PROCESSING_AREVA };
+static void Automation_postprocessing_revai(Automation *self) { POST_PROCESSING_REVAI };
+static void Automation_postprocessing_revaa(Automation *self) { POST_PROCESSING_REVAA };
+static void Automation_postprocessing_revareva(Automation *self) { POST_PROCESSING_REVAREVA };
+
+static void
+Automation_setProcMode(Automation *self)
+{
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+    self->proc_func_ptr = Automation_generate;
+
+	switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = Automation_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = Automation_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = Automation_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = Automation_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = Automation_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = Automation_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = Automation_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = Automation_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = Automation_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+Automation_compute_next_data_frame(Automation *self)
+{
+    (*self->proc_func_ptr)(self);
+    (*self->muladd_func_ptr)(self);
+}
+
+static int
+Automation_traverse(Automation *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    return 0;
+}
+
+static int
+Automation_clear(Automation *self)
+{
+    pyo_CLEAR
+    return 0;
+}
+
+static void
+Automation_dealloc(Automation* self)
+{
+    pyo_DEALLOC
+    free(self->frames);
+    free(self->values);
+    free(self->shapes);
+    free(self->curves);
+    Automation_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+Automation_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i, initToFirstVal = 0;
+    PyObject *pointslist=NULL, *multmp=NULL, *addtmp=NULL;
+    Automation *self;
+    self = (Automation *)type->tp_alloc(type, 0);
+
+    self->loop = 0;
+    self->listsize = self->maxsize = 0;
+    self->which = 0;
+    self->count = 0.0;
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, Automation_compute_next_data_frame);
+    self->mode_func_ptr = Automation_setProcMode;
+
+    Stream_setStreamActive(self->stream, 0);
+
+    static char *kwlist[] = {"list", "loop", "initToFirstVal", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|iiOO", kwlist, &pointslist, &self->loop, &initToFirstVal, &multmp, &addtmp))
+        Py_RETURN_NONE;
+
+    if (PyList_Check(pointslist))
+        Automation_append_pointslist(self, pointslist);
+
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
+
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    if (initToFirstVal && self->listsize > 0) {
+        for (i=0; i<self->bufsize; i++) {
+            self->data[i] = self->values[0];
+        }
+    }
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * Automation_getServer(Automation* self) { GET_SERVER };
+static PyObject * Automation_getStream(Automation* self) { GET_STREAM };
+static PyObject * Automation_setMul(Automation *self, PyObject *arg) { SET_MUL };
+static PyObject * Automation_setAdd(Automation *self, PyObject *arg) { SET_ADD };
+static PyObject * Automation_setSub(Automation *self, PyObject *arg) { SET_SUB };
+static PyObject * Automation_setDiv(Automation *self, PyObject *arg) { SET_DIV };
+
+static PyObject * Automation_play(Automation *self, PyObject *args, PyObject *kwds)
+{
+    self->count = 0.0;
+    self->which = 0;
+    PLAY
+};
+
+static PyObject * Automation_stop(Automation *self) { STOP };
+
+static PyObject * Automation_multiply(Automation *self, PyObject *arg) { MULTIPLY };
+static PyObject * Automation_inplace_multiply(Automation *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * Automation_add(Automation *self, PyObject *arg) { ADD };
+static PyObject * Automation_inplace_add(Automation *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * Automation_sub(Automation *self, PyObject *arg) { SUB };
+static PyObject * Automation_inplace_sub(Automation *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * Automation_div(Automation *self, PyObject *arg) { DIV };
+static PyObject * Automation_inplace_div(Automation *self, PyObject *arg) { INPLACE_DIV };
+
+static PyObject *
+Automation_setList(Automation *self, PyObject *value)
+{
+    if (value == NULL) {
+        PyErr_SetString(PyExc_TypeError, "Cannot delete the list attribute.");
+        return PyInt_FromLong(-1);
+    }
+
+    if (! PyList_Check(value)) {
+        PyErr_SetString(PyExc_TypeError, "The points list attribute value must be a list of tuples.");
+        return PyInt_FromLong(-1);
+    }
+
+    self->listsize = 0;
+    if (Automation_append_pointslist(self, value) < 0)
+        return PyErr_NoMemory();
+    Automation_search(self);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+/* Without looping, the points already played are discarded first, so that
+   streaming a long lane in chunks uses a bounded amount of memory. Returns
+   the number of points discarded. */
+static PyObject *
+Automation_append(Automation *self, PyObject *value)
+{
+    int trimmed = 0;
+
+    if (! PyList_Check(value)) {
+        PyErr_SetString(PyExc_TypeError, "The points list to append must be a list of tuples.");
+        return PyInt_FromLong(-1);
+    }
+
+    if (self->loop == 0)
+        trimmed = Automation_trim(self);
+    if (Automation_append_pointslist(self, value) < 0)
+        return PyErr_NoMemory();
+
+    return PyInt_FromLong(trimmed);
+}
+
+static PyObject *
+Automation_setTime(Automation *self, PyObject *arg)
+{
+    double time;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+    time = PyFloat_AsDouble(PyNumber_Float(arg));
+    if (time < 0.0)
+        time = 0.0;
+    self->count = (double)((long)(time * self->sr + 0.5));
+    Automation_search(self);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Automation_getTime(Automation *self)
+{
+    return PyFloat_FromDouble(self->count / self->sr);
+}
+
+static PyObject *
+Automation_getSize(Automation *self)
+{
+    return PyInt_FromLong(self->listsize);
+}
+
+static PyObject *
+Automation_setLoop(Automation *self, PyObject *arg)
+{
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+    self->loop = PyInt_AsLong(arg);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyMemberDef Automation_members[] = {
+{"server", T_OBJECT_EX, offsetof(Automation, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(Automation, stream), 0, "Stream object."},
+{"mul", T_OBJECT_EX, offsetof(Automation, mul), 0, "Mul factor."},
+{"add", T_OBJECT_EX, offsetof(Automation, add), 0, "Add factor."},
+{NULL}  /* Sentinel */
+};
+
+static PyMethodDef Automation_methods[] = {
+{"getServer", (PyCFunction)Automation_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)Automation_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)Automation_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"stop", (PyCFunction)Automation_stop, METH_NOARGS, "Stops computing."},
+{"setList", (PyCFunction)Automation_setList, METH_O, "Replaces all the break-points."},
+{"append", (PyCFunction)Automation_append, METH_O, "Adds break-points at the end of the lane and discards the points already played."},
+{"setTime", (PyCFunction)Automation_setTime, METH_O, "Moves the playback position, in seconds."},
+{"getTime", (PyCFunction)Automation_getTime, METH_NOARGS, "Returns the playback position, in seconds."},
+{"getSize", (PyCFunction)Automation_getSize, METH_NOARGS, "Returns the number of break-points."},
+{"setLoop", (PyCFunction)Automation_setLoop, METH_O, "Sets looping mode."},
+{"setMul", (PyCFunction)Automation_setMul, METH_O, "Sets Automation mul factor."},
+{"setAdd", (PyCFunction)Automation_setAdd, METH_O, "Sets Automation add factor."},
+{"setSub", (PyCFunction)Automation_setSub, METH_O, "Sets inverse add factor."},
+{"setDiv", (PyCFunction)Automation_setDiv, METH_O, "Sets inverse mul factor."},
+{NULL}  /* Sentinel */
+};
+
+static PyNumberMethods Automation_as_number = {
+(binaryfunc)Automation_add,                      /*nb_add*/
+(binaryfunc)Automation_sub,                 /*nb_subtract*/
+(binaryfunc)Automation_multiply,                 /*nb_multiply*/
+(binaryfunc)Automation_div,                   /*nb_divide*/
+0,                /*nb_remainder*/
+0,                   /*nb_divmod*/
+0,                   /*nb_power*/
+0,                  /*nb_neg*/
+0,                /*nb_pos*/
+0,                  /*(unaryfunc)array_abs,*/
+0,                    /*nb_nonzero*/
+0,                    /*nb_invert*/
+0,               /*nb_lshift*/
+0,              /*nb_rshift*/
+0,              /*nb_and*/
+0,              /*nb_xor*/
+0,               /*nb_or*/
+0,                                          /*nb_coerce*/
+0,                       /*nb_int*/
+0,                      /*nb_long*/
+0,                     /*nb_float*/
+0,                       /*nb_oct*/
+0,                       /*nb_hex*/
+(binaryfunc)Automation_inplace_add,              /*inplace_add*/
+(binaryfunc)Automation_inplace_sub,         /*inplace_subtract*/
+(binaryfunc)Automation_inplace_multiply,         /*inplace_multiply*/
+(binaryfunc)Automation_inplace_div,           /*inplace_divide*/
+0,        /*inplace_remainder*/
+0,           /*inplace_power*/
+0,       /*inplace_lshift*/
+0,      /*inplace_rshift*/
+0,      /*inplace_and*/
+0,      /*inplace_xor*/
+0,       /*inplace_or*/
+0,             /*nb_floor_divide*/
+0,              /*nb_true_divide*/
+0,     /*nb_inplace_floor_divide*/
+0,      /*nb_inplace_true_divide*/
+0,                     /* nb_index */
+};
+
+PyTypeObject AutomationType = {
+PyObject_HEAD_INIT(NULL)
+0,                         /*ob_size*/
+"_pyo.Automation_base",         /*tp_name*/
+sizeof(Automation),         /*tp_basicsize*/
+0,                         /*tp_itemsize*/
+(destructor)Automation_dealloc, /*tp_dealloc*/
+0,                         /*tp_print*/
+0,                         /*tp_getattr*/
+0,                         /*tp_setattr*/
+0,                         /*tp_compare*/
+0,                         /*tp_repr*/
+&Automation_as_number,             /*tp_as_number*/
+0,                         /*tp_as_sequence*/
+0,                         /*tp_as_mapping*/
+0,                         /*tp_hash */
+0,                         /*tp_call*/
+0,                         /*tp_str*/
+0,                         /*tp_getattro*/
+0,                         /*tp_setattro*/
+0,                         /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"Automation objects. Sample accurate break-points automation lane.",           /* tp_doc */
+(traverseproc)Automation_traverse,   /* tp_traverse */
+(inquiry)Automation_clear,           /* tp_clear */
+0,		               /* tp_richcompare */
+0,		               /* tp_weaklistoffset */
+0,		               /* tp_iter */
+0,		               /* tp_iternext */
+Automation_methods,             /* tp_methods */
+Automation_members,             /* tp_members */
+0,                      /* tp_getset */
+0,                         /* tp_base */
+0,                         /* tp_dict */
+0,                         /* tp_descr_get */
+0,                         /* tp_descr_set */
+0,                         /* tp_dictoffset */
+0,      /* tp_init */
+0,                         /* tp_alloc */
+Automation_new,                 /* tp_new */
+};
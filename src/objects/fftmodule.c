@@ -144,6 +144,11 @@ FFTMain_compute_next_data_frame(FFTMain *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+FFTMain_memory(FFTMain *self) {
+    return (4 * self->size + 4 * (self->size >> 3) + 3 * self->bufsize) * sizeof(MYFLT);
+}
+
 static int
 FFTMain_traverse(FFTMain *self, visitproc visit, void *arg)
 {
@@ -192,6 +197,7 @@ FFTMain_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->wintype = 2;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, FFTMain_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, FFTMain_memory);
     self->mode_func_ptr = FFTMain_setProcMode;
 
     static char *kwlist[] = {"input", "size", "hopsize", "wintype", NULL};
@@ -706,6 +712,11 @@ IFFT_compute_next_data_frame(IFFT *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+IFFT_memory(IFFT *self) {
+    return (4 * self->size + 4 * (self->size >> 3)) * sizeof(MYFLT);
+}
+
 static int
 IFFT_traverse(IFFT *self, visitproc visit, void *arg)
 {
@@ -760,6 +771,7 @@ IFFT_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, IFFT_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, IFFT_memory);
     self->mode_func_ptr = IFFT_setProcMode;
 
     static char *kwlist[] = {"inreal", "inimag", "size", "hopsize", "wintype", "mul", "add", NULL};
@@ -1597,6 +1609,11 @@ FrameDeltaMain_compute_next_data_frame(FrameDeltaMain *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+FrameDeltaMain_memory(FrameDeltaMain *self) {
+    return (self->frameSize + self->bufsize) * self->overlaps * sizeof(MYFLT);
+}
+
 static int
 FrameDeltaMain_traverse(FrameDeltaMain *self, visitproc visit, void *arg)
 {
@@ -1639,6 +1656,7 @@ FrameDeltaMain_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, FrameDeltaMain_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, FrameDeltaMain_memory);
     self->mode_func_ptr = FrameDeltaMain_setProcMode;
 
     static char *kwlist[] = {"input", "frameSize", "overlaps", NULL};
@@ -2106,6 +2124,11 @@ FrameAccumMain_compute_next_data_frame(FrameAccumMain *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+FrameAccumMain_memory(FrameAccumMain *self) {
+    return (self->frameSize + self->bufsize) * self->overlaps * sizeof(MYFLT);
+}
+
 static int
 FrameAccumMain_traverse(FrameAccumMain *self, visitproc visit, void *arg)
 {
@@ -2148,6 +2171,7 @@ FrameAccumMain_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, FrameAccumMain_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, FrameAccumMain_memory);
     self->mode_func_ptr = FrameAccumMain_setProcMode;
 
     static char *kwlist[] = {"input", "framesize", "overlaps", NULL};
@@ -3561,6 +3585,11 @@ CvlVerb_compute_next_data_frame(CvlVerb *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+CvlVerb_memory(CvlVerb *self) {
+    return (4 * self->size + 3 * self->size2 + 4 * (self->size2 >> 3) + 4 * self->num_iter * self->size) * sizeof(MYFLT);
+}
+
 static int
 CvlVerb_traverse(CvlVerb *self, visitproc visit, void *arg)
 {
@@ -3628,6 +3657,7 @@ CvlVerb_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->current_iter = 0;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, CvlVerb_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, CvlVerb_memory);
     self->mode_func_ptr = CvlVerb_setProcMode;
 
     static char *kwlist[] = {"input", "impulse", "bal", "size", "chnl", "mul", "add", NULL};
@@ -3832,6 +3862,752 @@ CvlVerb_members,                                 /* tp_members */
 CvlVerb_new,                                     /* tp_new */
 };
 
+/*************************************************************************/
+/* CvlMatrixMain : multichannel convolution sharing the input spectra    */
+/*************************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *inputs;
+    Stream **input_streams;
+    MYFLT **in_data;
+    PyObject *bal;
+    Stream *bal_stream;
+    char *impulse_path;
+    int ins;
+    int outs;
+    int size;
+    int size2;
+    int incount;
+    int num_iter;
+    int current_iter;
+    MYFLT *inframe;
+    MYFLT *outframe;
+    MYFLT **twiddle;
+    MYFLT *real;
+    MYFLT *imag;
+    MYFLT *last_half_frames; /* ins * size */
+    MYFLT *input_buffers; /* ins * size */
+    MYFLT *output_buffers; /* outs * size */
+    MYFLT *impulse_real; /* ins * outs * num_iter * size */
+    MYFLT *impulse_imag;
+    MYFLT *accum_real; /* outs * num_iter * size */
+    MYFLT *accum_imag;
+    MYFLT *buffer_streams;
+    int modebuffer[1];
+} CvlMatrixMain;
+
+static void
+CvlMatrixMain_alloc_memories(CvlMatrixMain *self) {
+    int i, n8;
+    self->size2 = self->size * 2;
+    n8 = self->size2 >> 3;
+    self->real = (MYFLT *)realloc(self->real, self->size * sizeof(MYFLT));
+    self->imag = (MYFLT *)realloc(self->imag, self->size * sizeof(MYFLT));
+    self->inframe = (MYFLT *)realloc(self->inframe, self->size2 * sizeof(MYFLT));
+    self->outframe = (MYFLT *)realloc(self->outframe, self->size2 * sizeof(MYFLT));
+    self->last_half_frames = (MYFLT *)realloc(self->last_half_frames, self->ins * self->size * sizeof(MYFLT));
+    self->input_buffers = (MYFLT *)realloc(self->input_buffers, self->ins * self->size * sizeof(MYFLT));
+    self->output_buffers = (MYFLT *)realloc(self->output_buffers, self->outs * self->size * sizeof(MYFLT));
+    self->buffer_streams = (MYFLT *)realloc(self->buffer_streams, self->outs * self->bufsize * sizeof(MYFLT));
+    for (i=0; i<self->size2; i++)
+        self->inframe[i] = self->outframe[i] = 0.0;
+    for (i=0; i<(self->ins * self->size); i++)
+        self->last_half_frames[i] = self->input_buffers[i] = 0.0;
+    for (i=0; i<(self->outs * self->size); i++)
+        self->output_buffers[i] = 0.0;
+    for (i=0; i<(self->outs * self->bufsize); i++)
+        self->buffer_streams[i] = 0.0;
+    self->twiddle = (MYFLT **)realloc(self->twiddle, 4 * sizeof(MYFLT *));
+    for(i=0; i<4; i++)
+        self->twiddle[i] = (MYFLT *)malloc(n8 * sizeof(MYFLT));
+    fft_compute_split_twiddle(self->twiddle, self->size2);
+}
+
+/* Channel `n * outs + o` of the impulse file is the response from input n to
+** output o, wrapping around if the file has less channels than that. */
+static void
+CvlMatrixMain_analyse_impulse(CvlMatrixMain *self) {
+    SNDFILE *sf;
+    SF_INFO info;
+    int i, j, c, snd_size, snd_sr, snd_chnls, num_items, pairs, len;
+    MYFLT *tmp, *ir_real, *ir_imag;
+
+    info.format = 0;
+    sf = sf_open(self->impulse_path, SFM_READ, &info);
+    if (sf == NULL) {
+        printf("CvlMatrix failed to open the impulse file %s.\n", self->impulse_path);
+        return;
+    }
+    snd_size = info.frames;
+    snd_sr = info.samplerate;
+    snd_chnls = info.channels;
+    num_items = snd_size * snd_chnls;
+
+    if (snd_sr != self->sr) {
+        printf("CvlMatrix warning : Impulse sampling rate does't match the sampling rate of the server.\n");
+    }
+
+    self->num_iter = (int)MYCEIL((MYFLT)snd_size / self->size);
+    pairs = self->ins * self->outs;
+    len = self->num_iter * self->size;
+
+    tmp = (MYFLT *)malloc(num_items * sizeof(MYFLT));
+    sf_seek(sf, 0, SEEK_SET);
+    SF_READ(sf, tmp, num_items);
+    sf_close(sf);
+
+    self->impulse_real = (MYFLT *)realloc(self->impulse_real, pairs * len * sizeof(MYFLT));
+    self->impulse_imag = (MYFLT *)realloc(self->impulse_imag, pairs * len * sizeof(MYFLT));
+    self->accum_real = (MYFLT *)realloc(self->accum_real, self->outs * len * sizeof(MYFLT));
+    self->accum_imag = (MYFLT *)realloc(self->accum_imag, self->outs * len * sizeof(MYFLT));
+    for (i=0; i<(self->outs * len); i++)
+        self->accum_real[i] = self->accum_imag[i] = 0.0;
+
+    for (c=0; c<pairs; c++) {
+        for (j=0; j<self->num_iter; j++) {
+            for (i=0; i<self->size; i++) {
+                if ((j * self->size + i) < snd_size)
+                    self->inframe[i] = tmp[(j * self->size + i) * snd_chnls + (c % snd_chnls)];
+                else
+                    self->inframe[i] = 0.0;
+                self->inframe[i+self->size] = 0.0;
+            }
+            realfft_split(self->inframe, self->outframe, self->size2, self->twiddle);
+            ir_real = self->impulse_real + c * len + j * self->size;
+            ir_imag = self->impulse_imag + c * len + j * self->size;
+            ir_real[0] = self->outframe[0];
+            ir_imag[0] = 0.0;
+            for (i=1; i<self->size; i++) {
+                ir_real[i] = self->outframe[i];
+                ir_imag[i] = self->outframe[self->size2 - i];
+            }
+        }
+    }
+
+    for (i=0; i<self->size2; i++)
+        self->inframe[i] = self->outframe[i] = 0.0;
+
+    free(tmp);
+}
+
+/* Each input is transformed once and multiplied against the spectra of all
+** its impulse responses. Outputs are accumulated in the frequency domain and
+** need a single inverse transform each. */
+static void
+CvlMatrixMain_process_partition(CvlMatrixMain *self) {
+    int i, j, k, n, o;
+    int size = self->size;
+    int len = self->num_iter * size;
+    MYFLT *last_half, *input, *ir_real, *ir_imag, *acc_real, *acc_imag, *output;
+
+    k = self->current_iter - 1;
+    if (k < 0)
+        k += self->num_iter;
+    for (o=0; o<self->outs; o++) {
+        acc_real = self->accum_real + o * len + k * size;
+        acc_imag = self->accum_imag + o * len + k * size;
+        for (i=0; i<size; i++)
+            acc_real[i] = acc_imag[i] = 0.0;
+    }
+
+    for (n=0; n<self->ins; n++) {
+        last_half = self->last_half_frames + n * size;
+        input = self->input_buffers + n * size;
+        for (i=0; i<size; i++) {
+            self->inframe[i] = last_half[i];
+            self->inframe[i+size] = last_half[i] = input[i];
+        }
+        realfft_split(self->inframe, self->outframe, self->size2, self->twiddle);
+        self->real[0] = self->outframe[0];
+        self->imag[0] = 0.0;
+        for (i=1; i<size; i++) {
+            self->real[i] = self->outframe[i];
+            self->imag[i] = self->outframe[self->size2 - i];
+        }
+        for (o=0; o<self->outs; o++) {
+            for (j=0; j<self->num_iter; j++) {
+                k = self->current_iter + j;
+                if (k >= self->num_iter)
+                    k -= self->num_iter;
+                ir_real = self->impulse_real + (n * self->outs + o) * len + j * size;
+                ir_imag = self->impulse_imag + (n * self->outs + o) * len + j * size;
+                acc_real = self->accum_real + o * len + k * size;
+                acc_imag = self->accum_imag + o * len + k * size;
+                for (i=0; i<size; i++) {
+                    acc_real[i] += self->real[i] * ir_real[i] - self->imag[i] * ir_imag[i];
+                    acc_imag[i] += self->real[i] * ir_imag[i] + self->imag[i] * ir_real[i];
+                }
+            }
+        }
+    }
+
+    for (o=0; o<self->outs; o++) {
+        acc_real = self->accum_real + o * len + self->current_iter * size;
+        acc_imag = self->accum_imag + o * len + self->current_iter * size;
+        output = self->output_buffers + o * size;
+        self->inframe[0] = acc_real[0];
+        self->inframe[size] = 0.0;
+        for (i=1; i<size; i++) {
+            self->inframe[i] = acc_real[i];
+            self->inframe[self->size2 - i] = acc_imag[i];
+        }
+        irealfft_split(self->inframe, self->outframe, self->size2, self->twiddle);
+        for (i=0; i<size; i++) {
+            output[i] = self->outframe[i+size];
+        }
+    }
+
+    self->current_iter++;
+    if (self->current_iter == self->num_iter)
+        self->current_iter = 0;
+}
+
+static void
+CvlMatrixMain_process(CvlMatrixMain *self) {
+    int i, n, o;
+    MYFLT gwet = 0.0, gdry, *bal = NULL;
+
+    if (self->num_iter == 0) {
+        for (i=0; i<(self->outs * self->bufsize); i++)
+            self->buffer_streams[i] = 0.0;
+        return;
+    }
+
+    for (n=0; n<self->ins; n++)
+        self->in_data[n] = Stream_getData(self->input_streams[n]);
+
+    if (self->modebuffer[0] == 0)
+        gwet = PyFloat_AS_DOUBLE(self->bal);
+    else
+        bal = Stream_getData((Stream *)self->bal_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        if (self->modebuffer[0] == 1)
+            gwet = bal[i];
+        if (gwet < 0)
+            gwet = 0.0;
+        else if (gwet > 1)
+            gwet = 1.0;
+        gdry = 1.0 - gwet;
+
+        for (n=0; n<self->ins; n++)
+            self->input_buffers[n * self->size + self->incount] = self->in_data[n][i];
+        for (o=0; o<self->outs; o++) {
+            self->buffer_streams[o * self->bufsize + i] = self->output_buffers[o * self->size + self->incount] * 100 * gwet +
+                                                          self->in_data[o % self->ins][i] * gdry;
+        }
+
+        self->incount++;
+        if (self->incount == self->size) {
+            self->incount = 0;
+            CvlMatrixMain_process_partition(self);
+        }
+    }
+}
+
+static MYFLT *
+CvlMatrixMain_getSamplesBuffer(CvlMatrixMain *self)
+{
+    return (MYFLT *)self->buffer_streams;
+}
+
+static void
+CvlMatrixMain_setProcMode(CvlMatrixMain *self)
+{
+    self->proc_func_ptr = CvlMatrixMain_process;
+}
+
+static void
+CvlMatrixMain_compute_next_data_frame(CvlMatrixMain *self)
+{
+    (*self->proc_func_ptr)(self);
+}
+
+static long
+CvlMatrixMain_memory(CvlMatrixMain *self) {
+    return (2 * self->size + 2 * self->size2 + 4 * (self->size2 >> 3) + (2 * self->ins + self->outs) * self->size + self->outs * self->bufsize
+            + 2 * (self->ins + 1) * self->outs * self->num_iter * self->size) * sizeof(MYFLT);
+}
+
+static int
+CvlMatrixMain_traverse(CvlMatrixMain *self, visitproc visit, void *arg)
+{
+    int i;
+    pyo_VISIT
+    Py_VISIT(self->inputs);
+    for (i=0; i<self->ins; i++)
+        Py_VISIT(self->input_streams[i]);
+    Py_VISIT(self->bal);
+    Py_VISIT(self->bal_stream);
+    return 0;
+}
+
+static int
+CvlMatrixMain_clear(CvlMatrixMain *self)
+{
+    int i;
+    pyo_CLEAR
+    Py_CLEAR(self->inputs);
+    for (i=0; i<self->ins; i++)
+        Py_CLEAR(self->input_streams[i]);
+    Py_CLEAR(self->bal);
+    Py_CLEAR(self->bal_stream);
+    return 0;
+}
+
+static void
+CvlMatrixMain_dealloc(CvlMatrixMain* self)
+{
+    int i;
+    pyo_DEALLOC
+    CvlMatrixMain_clear(self);
+    free(self->input_streams);
+    free(self->in_data);
+    free(self->inframe);
+    free(self->outframe);
+    free(self->real);
+    free(self->imag);
+    free(self->last_half_frames);
+    free(self->input_buffers);
+    free(self->output_buffers);
+    free(self->impulse_real);
+    free(self->impulse_imag);
+    free(self->accum_real);
+    free(self->accum_imag);
+    free(self->buffer_streams);
+    if (self->twiddle != NULL) {
+        for(i=0; i<4; i++) {
+            free(self->twiddle[i]);
+        }
+        free(self->twiddle);
+    }
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+CvlMatrixMain_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i, k;
+    PyObject *inputstmp, *streamtmp, *baltmp=NULL;
+    CvlMatrixMain *self;
+    self = (CvlMatrixMain *)type->tp_alloc(type, 0);
+
+    self->bal = PyFloat_FromDouble(0.25);
+    self->size = 1024;
+    self->outs = 2;
+    self->incount = 0;
+    self->current_iter = 0;
+    self->modebuffer[0] = 0;
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, CvlMatrixMain_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, CvlMatrixMain_memory);
+    self->mode_func_ptr = CvlMatrixMain_setProcMode;
+
+    static char *kwlist[] = {"inputs", "impulse", "outs", "bal", "size", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "Os|iOi", kwlist, &inputstmp, &self->impulse_path, &self->outs, &baltmp, &self->size))
+        Py_RETURN_NONE;
+
+    if (! PyList_Check(inputstmp) || PyList_Size(inputstmp) < 1) {
+        PyErr_SetString(PyExc_TypeError, "CvlMatrix inputs must be a non-empty list of audio objects.");
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    Py_INCREF(inputstmp);
+    self->inputs = inputstmp;
+    self->ins = PyList_Size(inputstmp);
+    self->input_streams = (Stream **)malloc(self->ins * sizeof(Stream *));
+    self->in_data = (MYFLT **)malloc(self->ins * sizeof(MYFLT *));
+    for (i=0; i<self->ins; i++) {
+        streamtmp = PyObject_CallMethod(PyList_GET_ITEM(inputstmp, i), "_getStream", NULL);
+        self->input_streams[i] = (Stream *)streamtmp;
+    }
+
+    if (self->outs < 1)
+        self->outs = 1;
+
+    if (self->size < self->bufsize) {
+        printf("Warning : CvlMatrix size less than buffer size!\nCvlMatrix size set to buffersize: %d\n", self->bufsize);
+        self->size = self->bufsize;
+    }
+
+    k = 1;
+    while (k < self->size)
+        k <<= 1;
+    self->size = k;
+
+    if (baltmp) {
+        PyObject_CallMethod((PyObject *)self, "setBal", "O", baltmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    CvlMatrixMain_alloc_memories(self);
+    CvlMatrixMain_analyse_impulse(self);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * CvlMatrixMain_getServer(CvlMatrixMain* self) { GET_SERVER };
+static PyObject * CvlMatrixMain_getStream(CvlMatrixMain* self) { GET_STREAM };
+
+static PyObject * CvlMatrixMain_play(CvlMatrixMain *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * CvlMatrixMain_stop(CvlMatrixMain *self) { STOP };
+
+static PyObject *
+CvlMatrixMain_setBal(CvlMatrixMain *self, PyObject *arg)
+{
+    PyObject *tmp, *streamtmp;
+
+    if (arg == NULL) {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    int isNumber = PyNumber_Check(arg);
+
+    tmp = arg;
+    Py_INCREF(tmp);
+    Py_DECREF(self->bal);
+    if (isNumber == 1) {
+        self->bal = PyNumber_Float(tmp);
+        self->modebuffer[0] = 0;
+    }
+    else {
+        self->bal = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->bal, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->bal_stream);
+        self->bal_stream = (Stream *)streamtmp;
+        self->modebuffer[0] = 1;
+    }
+
+    (*self->mode_func_ptr)(self);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyMemberDef CvlMatrixMain_members[] = {
+{"server", T_OBJECT_EX, offsetof(CvlMatrixMain, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(CvlMatrixMain, stream), 0, "Stream object."},
+{"inputs", T_OBJECT_EX, offsetof(CvlMatrixMain, inputs), 0, "List of input sound objects."},
+{"bal", T_OBJECT_EX, offsetof(CvlMatrixMain, bal), 0, "Wet/dry balance."},
+{NULL}  /* Sentinel */
+};
+
+static PyMethodDef CvlMatrixMain_methods[] = {
+{"getServer", (PyCFunction)CvlMatrixMain_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)CvlMatrixMain_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)CvlMatrixMain_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"stop", (PyCFunction)CvlMatrixMain_stop, METH_NOARGS, "Stops computing."},
+{"setBal", (PyCFunction)CvlMatrixMain_setBal, METH_O, "Sets wet/dry balance."},
+{NULL}  /* Sentinel */
+};
+
+PyTypeObject CvlMatrixMainType = {
+PyObject_HEAD_INIT(NULL)
+0,                                              /*ob_size*/
+"_pyo.CvlMatrixMain_base",                                   /*tp_name*/
+sizeof(CvlMatrixMain),                                 /*tp_basicsize*/
+0,                                              /*tp_itemsize*/
+(destructor)CvlMatrixMain_dealloc,                     /*tp_dealloc*/
+0,                                              /*tp_print*/
+0,                                              /*tp_getattr*/
+0,                                              /*tp_setattr*/
+0,                                              /*tp_compare*/
+0,                                              /*tp_repr*/
+0,                              /*tp_as_number*/
+0,                                              /*tp_as_sequence*/
+0,                                              /*tp_as_mapping*/
+0,                                              /*tp_hash */
+0,                                              /*tp_call*/
+0,                                              /*tp_str*/
+0,                                              /*tp_getattro*/
+0,                                              /*tp_setattro*/
+0,                                              /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"CvlMatrixMain objects. Multichannel partitioned convolution.",           /* tp_doc */
+(traverseproc)CvlMatrixMain_traverse,                  /* tp_traverse */
+(inquiry)CvlMatrixMain_clear,                          /* tp_clear */
+0,                                              /* tp_richcompare */
+0,                                              /* tp_weaklistoffset */
+0,                                              /* tp_iter */
+0,                                              /* tp_iternext */
+CvlMatrixMain_methods,                                 /* tp_methods */
+CvlMatrixMain_members,                                 /* tp_members */
+0,                                              /* tp_getset */
+0,                                              /* tp_base */
+0,                                              /* tp_dict */
+0,                                              /* tp_descr_get */
+0,                                              /* tp_descr_set */
+0,                                              /* tp_dictoffset */
+0,                          /* tp_init */
+0,                                              /* tp_alloc */
+CvlMatrixMain_new,                                     /* tp_new */
+};
+
+/************************************************************************************************/
+/* CvlMatrix streamer object */
+/************************************************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    CvlMatrixMain *mainPlayer;
+    int modebuffer[2];
+    int chnl;
+} CvlMatrix;
+
+static void CvlMatrix_postprocessing_ii(CvlMatrix *self) { POST_PROCESSING_II };
+static void CvlMatrix_postprocessing_ai(CvlMatrix *self) { POST_PROCESSING_AI };
+static void CvlMatrix_postprocessing_ia(CvlMatrix *self) { POST_PROCESSING_IA };
+static void CvlMatrix_postprocessing_aa(CvlMatrix *self) { POST_PROCESSING_AA };
+static void CvlMatrix_postprocessing_ireva(CvlMatrix *self) { POST_PROCESSING_IREVA };
+static void CvlMatrix_postprocessing_areva(CvlMatrix *self) { POST_PROCESSING_AREVA };
+static void CvlMatrix_postprocessing_revai(CvlMatrix *self) { POST_PROCESSING_REVAI };
+static void CvlMatrix_postprocessing_revaa(CvlMatrix *self) { POST_PROCESSING_REVAA };
+static void CvlMatrix_postprocessing_revareva(CvlMatrix *self) { POST_PROCESSING_REVAREVA };
+
+static void
+CvlMatrix_setProcMode(CvlMatrix *self)
+{
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+    switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = CvlMatrix_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = CvlMatrix_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = CvlMatrix_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = CvlMatrix_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = CvlMatrix_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = CvlMatrix_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = CvlMatrix_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = CvlMatrix_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = CvlMatrix_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+CvlMatrix_compute_next_data_frame(CvlMatrix *self)
+{
+    int i;
+    MYFLT *tmp;
+    int offset = self->chnl * self->bufsize;
+    tmp = CvlMatrixMain_getSamplesBuffer((CvlMatrixMain *)self->mainPlayer);
+    for (i=0; i<self->bufsize; i++) {
+        self->data[i] = tmp[i + offset];
+    }
+    (*self->muladd_func_ptr)(self);
+}
+
+static int
+CvlMatrix_traverse(CvlMatrix *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->mainPlayer);
+    return 0;
+}
+
+static int
+CvlMatrix_clear(CvlMatrix *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->mainPlayer);
+    return 0;
+}
+
+static void
+CvlMatrix_dealloc(CvlMatrix* self)
+{
+    pyo_DEALLOC
+    CvlMatrix_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+CvlMatrix_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *maintmp=NULL, *multmp=NULL, *addtmp=NULL;
+    CvlMatrix *self;
+    self = (CvlMatrix *)type->tp_alloc(type, 0);
+
+    self->modebuffer[0] = 0;
+    self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, CvlMatrix_compute_next_data_frame);
+    self->mode_func_ptr = CvlMatrix_setProcMode;
+
+    static char *kwlist[] = {"mainPlayer", "chnl", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "Oi|OO", kwlist, &maintmp, &self->chnl, &multmp, &addtmp))
+        Py_RETURN_NONE;
+
+    Py_XDECREF(self->mainPlayer);
+    Py_INCREF(maintmp);
+    self->mainPlayer = (CvlMatrixMain *)maintmp;
+
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
+
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * CvlMatrix_getServer(CvlMatrix* self) { GET_SERVER };
+static PyObject * CvlMatrix_getStream(CvlMatrix* self) { GET_STREAM };
+static PyObject * CvlMatrix_setMul(CvlMatrix *self, PyObject *arg) { SET_MUL };
+static PyObject * CvlMatrix_setAdd(CvlMatrix *self, PyObject *arg) { SET_ADD };
+static PyObject * CvlMatrix_setSub(CvlMatrix *self, PyObject *arg) { SET_SUB };
+static PyObject * CvlMatrix_setDiv(CvlMatrix *self, PyObject *arg) { SET_DIV };
+
+static PyObject * CvlMatrix_play(CvlMatrix *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * CvlMatrix_out(CvlMatrix *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * CvlMatrix_stop(CvlMatrix *self) { STOP };
+
+static PyObject * CvlMatrix_multiply(CvlMatrix *self, PyObject *arg) { MULTIPLY };
+static PyObject * CvlMatrix_inplace_multiply(CvlMatrix *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * CvlMatrix_add(CvlMatrix *self, PyObject *arg) { ADD };
+static PyObject * CvlMatrix_inplace_add(CvlMatrix *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * CvlMatrix_sub(CvlMatrix *self, PyObject *arg) { SUB };
+static PyObject * CvlMatrix_inplace_sub(CvlMatrix *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * CvlMatrix_div(CvlMatrix *self, PyObject *arg) { DIV };
+static PyObject * CvlMatrix_inplace_div(CvlMatrix *self, PyObject *arg) { INPLACE_DIV };
+
+static PyMemberDef CvlMatrix_members[] = {
+{"server", T_OBJECT_EX, offsetof(CvlMatrix, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(CvlMatrix, stream), 0, "Stream object."},
+{"mul", T_OBJECT_EX, offsetof(CvlMatrix, mul), 0, "Mul factor."},
+{"add", T_OBJECT_EX, offsetof(CvlMatrix, add), 0, "Add factor."},
+{NULL}  /* Sentinel */
+};
+
+static PyMethodDef CvlMatrix_methods[] = {
+{"getServer", (PyCFunction)CvlMatrix_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)CvlMatrix_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)CvlMatrix_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"out", (PyCFunction)CvlMatrix_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+{"stop", (PyCFunction)CvlMatrix_stop, METH_NOARGS, "Stops computing."},
+{"setMul", (PyCFunction)CvlMatrix_setMul, METH_O, "Sets CvlMatrix mul factor."},
+{"setAdd", (PyCFunction)CvlMatrix_setAdd, METH_O, "Sets CvlMatrix add factor."},
+{"setSub", (PyCFunction)CvlMatrix_setSub, METH_O, "Sets inverse add factor."},
+{"setDiv", (PyCFunction)CvlMatrix_setDiv, METH_O, "Sets inverse mul factor."},
+{NULL}  /* Sentinel */
+};
+
+static PyNumberMethods CvlMatrix_as_number = {
+(binaryfunc)CvlMatrix_add,                      /*nb_add*/
+(binaryfunc)CvlMatrix_sub,                 /*nb_subtract*/
+(binaryfunc)CvlMatrix_multiply,                 /*nb_multiply*/
+(binaryfunc)CvlMatrix_div,                   /*nb_divide*/
+0,                /*nb_remainder*/
+0,                   /*nb_divmod*/
+0,                   /*nb_power*/
+0,                  /*nb_neg*/
+0,                /*nb_pos*/
+0,                  /*(unaryfunc)array_abs,*/
+0,                    /*nb_nonzero*/
+0,                    /*nb_invert*/
+0,               /*nb_lshift*/
+0,              /*nb_rshift*/
+0,              /*nb_and*/
+0,              /*nb_xor*/
+0,               /*nb_or*/
+0,                                          /*nb_coerce*/
+0,                       /*nb_int*/
+0,                      /*nb_long*/
+0,                     /*nb_float*/
+0,                       /*nb_oct*/
+0,                       /*nb_hex*/
+(binaryfunc)CvlMatrix_inplace_add,              /*inplace_add*/
+(binaryfunc)CvlMatrix_inplace_sub,         /*inplace_subtract*/
+(binaryfunc)CvlMatrix_inplace_multiply,         /*inplace_multiply*/
+(binaryfunc)CvlMatrix_inplace_div,           /*inplace_divide*/
+0,        /*inplace_remainder*/
+0,           /*inplace_power*/
+0,       /*inplace_lshift*/
+0,      /*inplace_rshift*/
+0,      /*inplace_and*/
+0,      /*inplace_xor*/
+0,       /*inplace_or*/
+0,             /*nb_floor_divide*/
+0,              /*nb_true_divide*/
+0,     /*nb_inplace_floor_divide*/
+0,      /*nb_inplace_true_divide*/
+0,                     /* nb_index */
+};
+
+PyTypeObject CvlMatrixType = {
+PyObject_HEAD_INIT(NULL)
+0,                         /*ob_size*/
+"_pyo.CvlMatrix_base",         /*tp_name*/
+sizeof(CvlMatrix),         /*tp_basicsize*/
+0,                         /*tp_itemsize*/
+(destructor)CvlMatrix_dealloc, /*tp_dealloc*/
+0,                         /*tp_print*/
+0,                         /*tp_getattr*/
+0,                         /*tp_setattr*/
+0,                         /*tp_compare*/
+0,                         /*tp_repr*/
+&CvlMatrix_as_number,             /*tp_as_number*/
+0,                         /*tp_as_sequence*/
+0,                         /*tp_as_mapping*/
+0,                         /*tp_hash */
+0,                         /*tp_call*/
+0,                         /*tp_str*/
+0,                         /*tp_getattro*/
+0,                         /*tp_setattro*/
+0,                         /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES,  /*tp_flags*/
+"CvlMatrix objects. Reads one output from a CvlMatrixMain.",           /* tp_doc */
+(traverseproc)CvlMatrix_traverse,   /* tp_traverse */
+(inquiry)CvlMatrix_clear,           /* tp_clear */
+0,		               /* tp_richcompare */
+0,		               /* tp_weaklistoffset */
+0,		               /* tp_iter */
+0,		               /* tp_iternext */
+CvlMatrix_methods,             /* tp_methods */
+CvlMatrix_members,             /* tp_members */
+0,                      /* tp_getset */
+0,                         /* tp_base */
+0,                         /* tp_dict */
+0,                         /* tp_descr_get */
+0,                         /* tp_descr_set */
+0,                         /* tp_dictoffset */
+0,      /* tp_init */
+0,                         /* tp_alloc */
+CvlMatrix_new,                 /* tp_new */
+};
+
 typedef struct {
     pyo_audio_HEAD
     PyObject *input;
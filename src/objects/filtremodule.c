@@ -25,6 +25,10 @@
 #include "streammodule.h"
 #include "servermodule.h"
 #include "dummymodule.h"
+#include "tablemodule.h"
+#include "taskpool.h"
+#include "fft.h"
+#include "wind.h"
 
 static MYFLT HALF_COS_ARRAY[513] = {1.0, 0.99998110153278696, 0.99992440684545181, 0.99982991808087995, 0.99969763881045715, 0.99952757403393411, 0.99931973017923825, 0.99907411510222999, 0.99879073808640628, 0.99846960984254973, 0.99811074250832332, 0.99771414964781235, 0.99727984625101107, 0.99680784873325645, 0.99629817493460782, 0.99575084411917214, 0.99516587697437664, 0.99454329561018584, 0.99388312355826691, 0.9931853857710996, 0.99245010862103322, 0.99167731989928998, 0.99086704881491472, 0.99001932599367026, 0.98913418347688054, 0.98821165472021921, 0.9872517745924454, 0.98625457937408512, 0.98522010675606064, 0.98414839583826585, 0.98303948712808786, 0.98189342253887657, 0.98071024538836005, 0.97949000039700762, 0.97823273368633901, 0.9769384927771817, 0.97560732658787452, 0.97423928543241856, 0.97283442101857576, 0.97139278644591409, 0.96991443620380113, 0.96839942616934394, 0.96684781360527761, 0.96525965715780015, 0.96363501685435693, 0.96197395410137099, 0.96027653168192206, 0.95854281375337425, 0.95677286584495025, 0.95496675485525528, 0.95312454904974775, 0.95124631805815985, 0.94933213287186513, 0.94738206584119555, 0.94539619067270686, 0.9433745824263926, 0.94131731751284708, 0.9392244736903772, 0.93709613006206383, 0.9349323670727715, 0.93273326650610799, 0.93049891148133324, 0.92822938645021758, 0.92592477719384991, 0.92358517081939495, 0.92121065575680161, 0.91880132175545981, 0.91635725988080907, 0.91387856251089561, 0.91136532333288145, 0.90881763733950294, 0.9062356008254806, 0.90361931138387919, 0.90096886790241915, 0.89828437055973898, 0.89556592082160869, 0.89281362143709486, 0.89002757643467667, 0.88720789111831455, 0.8843546720634694, 0.88146802711307481, 0.87854806537346075, 0.87559489721022943, 0.8726086342440843, 0.86958938934661101, 0.86653727663601088, 0.86345241147278784, 0.86033491045538835, 0.85718489141579368, 0.85400247341506719, 0.8507877767388532, 0.84754092289283123, 0.8442620345981231, 0.84095123578665476, 0.8376086515964718, 0.83423440836700968, 0.83082863363431847, 0.82739145612624232, 0.82392300575755428, 0.82042341362504534, 0.81689281200256991, 0.81333133433604599, 0.80973911523841147, 0.80611629048453592, 0.80246299700608914, 0.79877937288636502, 0.7950655573550629, 0.79132169078302494, 0.78754791467693042, 0.78374437167394739, 0.77991120553634141, 0.77604856114604148, 0.77215658449916424, 0.76823542270049605, 0.76428522395793219, 0.7603061375768756, 0.75629831395459302, 0.75226190457453135, 0.74819706200059122, 0.7441039398713607, 0.73998269289430851, 0.73583347683993672, 0.73165644853589207, 0.72745176586103977, 0.72321958773949491, 0.71896007413461649, 0.71467338604296105, 0.71035968548819706, 0.70601913551498185, 0.70165190018279788, 0.69725814455975277, 0.69283803471633953, 0.68839173771916018, 0.68391942162461061, 0.6794212554725293, 0.67489740927980701, 0.67034805403396192, 0.66577336168667567, 0.66117350514729512, 0.65654865827629605, 0.65189899587871258, 0.64722469369752944, 0.6425259284070397, 0.63780287760616672, 0.63305571981175202, 0.62828463445180749, 0.62348980185873359, 0.61867140326250347, 0.61382962078381298, 0.60896463742719675, 0.60407663707411186, 0.59916580447598711, 0.59423232524724023, 0.58927638585826192, 0.58429817362836856, 0.57929787671872113, 0.57427568412521424, 0.56923178567133192, 0.56416637200097319, 0.55907963457124654, 0.55397176564523298, 0.5488429582847193, 0.5436934063429012, 0.53852330445705543, 0.53333284804118442, 0.52812223327862839, 0.52289165711465235, 0.51764131724900009, 0.51237141212842374, 0.50708214093918114, 0.50177370359950879, 0.49644630075206486, 0.49110013375634509, 0.48573540468107329, 0.48035231629656205, 0.47495107206705045, 0.46953187614301212, 0.46409493335344021, 0.45864044919810504, 0.45316862983978612, 0.44767968209648135, 0.44217381343358825, 0.43665123195606403, 0.43111214640055828, 0.42555676612752463, 0.41998530111330729, 0.41439796194220363, 0.40879495979850627, 0.40317650645851943, 0.39754281428255606, 0.3918940962069094, 0.38623056573580644, 0.38055243693333718, 0.3748599244153632, 0.36915324334140731, 0.36343260940651945, 0.35769823883312568, 0.35195034836285416, 0.34618915524834432, 0.34041487724503472, 0.33462773260293199, 0.32882794005836308, 0.32301571882570607, 0.31719128858910622, 0.31135486949417079, 0.30550668213964982, 0.29964694756909749, 0.29377588726251663, 0.28789372312798917, 0.28200067749328667, 0.27609697309746906, 0.27018283308246382, 0.26425848098463345, 0.25832414072632598, 0.25238003660741054, 0.24642639329680122, 0.24046343582396335, 0.23449138957040974, 0.22851048026118126, 0.22252093395631445, 0.21652297704229864, 0.21051683622351761, 0.20450273851368242, 0.19848091122724945, 0.19245158197082995, 0.18641497863458675, 0.1803713293836198, 0.17432086264934399, 0.16826380712085329, 0.16220039173627876, 0.15613084567413366, 0.1500553983446527, 0.14397427938112045, 0.13788771863119115, 0.13179594614820278, 0.12569919218247999, 0.11959768717263308, 0.11349166173684638, 0.10738134666416307, 0.10126697290576155, 0.095148771566225324, 0.089026973894809708, 0.082901811276699419, 0.076773515224264705, 0.070642317368309157, 0.064508449449316344, 0.058372143308689985, 0.052233630879990445, 0.046093144180169916, 0.039950915300801082, 0.033807176399306589, 0.027662159690182372, 0.021516097436222258, 0.01536922193973846, 0.0092217655337806046, 0.0030739605733557966, -0.0030739605733554522, -0.0092217655337804832, -0.015369221939738116, -0.021516097436222133, -0.027662159690182025, -0.033807176399306464, -0.039950915300800735, -0.046093144180169791, -0.052233630879990098, -0.05837214330868986, -0.064508449449316232, -0.07064231736830906, -0.076773515224264371, -0.082901811276699308, -0.089026973894809375, -0.095148771566225213, -0.10126697290576121, -0.10738134666416296, -0.11349166173684605, -0.11959768717263299, -0.12569919218247966, -0.13179594614820267, -0.13788771863119104, -0.14397427938112034, -0.15005539834465259, -0.15613084567413354, -0.16220039173627843, -0.16826380712085318, -0.17432086264934366, -0.18037132938361969, -0.18641497863458642, -0.19245158197082984, -0.19848091122724912, -0.20450273851368231, -0.21051683622351727, -0.21652297704229853, -0.22252093395631434, -0.22851048026118118, -0.23449138957040966, -0.24046343582396323, -0.24642639329680088, -0.25238003660741043, -0.25832414072632565, -0.26425848098463334, -0.27018283308246349, -0.27609697309746895, -0.28200067749328633, -0.28789372312798905, -0.2937758872625163, -0.29964694756909738, -0.30550668213964971, -0.31135486949417068, -0.31719128858910589, -0.32301571882570601, -0.32882794005836274, -0.33462773260293188, -0.34041487724503444, -0.3461891552483442, -0.35195034836285388, -0.35769823883312557, -0.36343260940651911, -0.3691532433414072, -0.37485992441536287, -0.38055243693333707, -0.38623056573580633, -0.39189409620690935, -0.39754281428255578, -0.40317650645851938, -0.408794959798506, -0.41439796194220352, -0.41998530111330723, -0.42555676612752458, -0.43111214640055795, -0.43665123195606392, -0.44217381343358819, -0.44767968209648107, -0.45316862983978584, -0.45864044919810493, -0.46409493335344015, -0.46953187614301223, -0.47495107206704995, -0.48035231629656183, -0.4857354046810729, -0.49110013375634509, -0.4964463007520647, -0.50177370359950857, -0.5070821409391808, -0.51237141212842352, -0.51764131724899998, -0.52289165711465191, -0.52812223327862795, -0.53333284804118419, -0.53852330445705532, -0.5436934063429012, -0.54884295828471885, -0.55397176564523276, -0.55907963457124621, -0.56416637200097308, -0.5692317856713317, -0.57427568412521401, -0.57929787671872079, -0.58429817362836844, -0.5892763858582617, -0.5942323252472399, -0.59916580447598666, -0.60407663707411174, -0.60896463742719653, -0.61382962078381298, -0.61867140326250303, -0.62348980185873337, -0.62828463445180716, -0.6330557198117519, -0.6378028776061665, -0.64252592840703937, -0.64722469369752911, -0.65189899587871247, -0.65654865827629583, -0.66117350514729478, -0.66577336168667522, -0.67034805403396169, -0.67489740927980679, -0.6794212554725293, -0.68391942162461028, -0.68839173771915996, -0.6928380347163392, -0.69725814455975266, -0.70165190018279777, -0.70601913551498163, -0.71035968548819683, -0.71467338604296105, -0.71896007413461638, -0.72321958773949468, -0.72745176586103955, -0.73165644853589207, -0.73583347683993661, -0.73998269289430874, -0.74410393987136036, -0.74819706200059111, -0.75226190457453113, -0.75629831395459302, -0.76030613757687548, -0.76428522395793208, -0.76823542270049594, -0.77215658449916424, -0.77604856114604126, -0.77991120553634119, -0.78374437167394717, -0.78754791467693031, -0.79132169078302472, -0.7950655573550629, -0.79877937288636469, -0.80246299700608903, -0.80611629048453581, -0.80973911523841147, -0.81333133433604599, -0.8168928120025698, -0.82042341362504512, -0.82392300575755417, -0.82739145612624221, -0.83082863363431825, -0.83423440836700946, -0.8376086515964718, -0.84095123578665465, -0.8442620345981231, -0.84754092289283089, -0.85078777673885309, -0.85400247341506696, -0.85718489141579368, -0.86033491045538824, -0.86345241147278773, -0.86653727663601066, -0.86958938934661101, -0.87260863424408419, -0.87559489721022921, -0.87854806537346053, -0.88146802711307481, -0.88435467206346929, -0.88720789111831455, -0.89002757643467667, -0.89281362143709475, -0.89556592082160857, -0.89828437055973898, -0.90096886790241903, -0.90361931138387908, -0.90623560082548038, -0.90881763733950294, -0.91136532333288134, -0.9138785625108955, -0.91635725988080885, -0.91880132175545981, -0.92121065575680139, -0.92358517081939495, -0.9259247771938498, -0.92822938645021758, -0.93049891148133312, -0.93273326650610799, -0.9349323670727715, -0.93709613006206383, -0.93922447369037709, -0.94131731751284708, -0.9433745824263926, -0.94539619067270697, -0.94738206584119544, -0.94933213287186502, -0.95124631805815973, -0.95312454904974775, -0.95496675485525517, -0.95677286584495025, -0.95854281375337413, -0.96027653168192206, -0.96197395410137099, -0.96363501685435693, -0.96525965715780004, -0.9668478136052775, -0.96839942616934394, -0.96991443620380113, -0.97139278644591398, -0.97283442101857565, -0.97423928543241844, -0.97560732658787452, -0.9769384927771817, -0.9782327336863389, -0.97949000039700751, -0.98071024538836005, -0.98189342253887657, -0.98303948712808775, -0.98414839583826574, -0.98522010675606064, -0.98625457937408501, -0.9872517745924454, -0.98821165472021921, -0.98913418347688054, -0.99001932599367015, -0.99086704881491472, -0.99167731989928998, -0.99245010862103311, -0.99318538577109949, -0.99388312355826691, -0.99454329561018584, -0.99516587697437653, -0.99575084411917214, -0.99629817493460782, -0.99680784873325645, -0.99727984625101107, -0.99771414964781235, -0.99811074250832332, -0.99846960984254973, -0.99879073808640628, -0.99907411510222999, -0.99931973017923825, -0.99952757403393411, -0.99969763881045715, -0.99982991808087995, -0.99992440684545181, -0.99998110153278685, -1.0, -1.0};
 
@@ -40,23 +44,23 @@ typedef struct {
     int init;
     int modebuffer[4]; // need at least 2 slots for mul & add
     int filtertype;
-    MYFLT nyquist;
+    MYSTATE nyquist;
     // sample memories
-    MYFLT x1;
-    MYFLT x2;
-    MYFLT y1;
-    MYFLT y2;
+    MYSTATE x1;
+    MYSTATE x2;
+    MYSTATE y1;
+    MYSTATE y2;
     // variables
-    MYFLT c;
-    MYFLT w0;
-    MYFLT alpha;
+    MYSTATE c;
+    MYSTATE w0;
+    MYSTATE alpha;
     // coefficients
-    MYFLT b0;
-    MYFLT b1;
-    MYFLT b2;
-    MYFLT a0;
-    MYFLT a1;
-    MYFLT a2;
+    MYSTATE b0;
+    MYSTATE b1;
+    MYSTATE b2;
+    MYSTATE a0;
+    MYSTATE a1;
+    MYSTATE a2;
 } Biquad;
 
 static void
@@ -120,14 +124,14 @@ Biquad_compute_variables(Biquad *self, MYFLT freq, MYFLT q)
         q = 0.1;
 
     self->w0 = TWOPI * freq / self->sr;
-    self->c = MYCOS(self->w0);
-    self->alpha = MYSIN(self->w0) / (2 * q);
+    self->c = STCOS(self->w0);
+    self->alpha = STSIN(self->w0) / (2 * q);
     (*self->coeffs_func_ptr)(self);
 }
 
 static void
 Biquad_filters_ii(Biquad *self) {
-    MYFLT val;
+    MYSTATE val;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -148,7 +152,7 @@ Biquad_filters_ii(Biquad *self) {
 
 static void
 Biquad_filters_ai(Biquad *self) {
-    MYFLT val, q;
+    MYSTATE val, q;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -173,7 +177,7 @@ Biquad_filters_ai(Biquad *self) {
 
 static void
 Biquad_filters_ia(Biquad *self) {
-    MYFLT val, fr;
+    MYSTATE val, fr;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -198,7 +202,7 @@ Biquad_filters_ia(Biquad *self) {
 
 static void
 Biquad_filters_aa(Biquad *self) {
-    MYFLT val;
+    MYSTATE val;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -630,32 +634,32 @@ typedef struct {
     int modebuffer[4]; // need at least 2 slots for mul & add
     int filtertype;
     int stages;
-    MYFLT nyquist;
+    MYSTATE nyquist;
     // sample memories
-    MYFLT *x1;
-    MYFLT *x2;
-    MYFLT *y1;
-    MYFLT *y2;
+    MYSTATE *x1;
+    MYSTATE *x2;
+    MYSTATE *y1;
+    MYSTATE *y2;
     // variables
-    MYFLT c;
-    MYFLT w0;
-    MYFLT alpha;
+    MYSTATE c;
+    MYSTATE w0;
+    MYSTATE alpha;
     // coefficients
-    MYFLT b0;
-    MYFLT b1;
-    MYFLT b2;
-    MYFLT a0;
-    MYFLT a1;
-    MYFLT a2;
+    MYSTATE b0;
+    MYSTATE b1;
+    MYSTATE b2;
+    MYSTATE a0;
+    MYSTATE a1;
+    MYSTATE a2;
 } Biquadx;
 
 static void
 Biquadx_allocate_memories(Biquadx *self)
 {
-    self->x1 = (MYFLT *)realloc(self->x1, self->stages * sizeof(MYFLT));
-    self->x2 = (MYFLT *)realloc(self->x2, self->stages * sizeof(MYFLT));
-    self->y1 = (MYFLT *)realloc(self->y1, self->stages * sizeof(MYFLT));
-    self->y2 = (MYFLT *)realloc(self->y2, self->stages * sizeof(MYFLT));
+    self->x1 = (MYSTATE *)realloc(self->x1, self->stages * sizeof(MYSTATE));
+    self->x2 = (MYSTATE *)realloc(self->x2, self->stages * sizeof(MYSTATE));
+    self->y1 = (MYSTATE *)realloc(self->y1, self->stages * sizeof(MYSTATE));
+    self->y2 = (MYSTATE *)realloc(self->y2, self->stages * sizeof(MYSTATE));
     self->init = 1;
 }
 
@@ -720,14 +724,14 @@ Biquadx_compute_variables(Biquadx *self, MYFLT freq, MYFLT q)
         q = 0.1;
 
     self->w0 = TWOPI * freq / self->sr;
-    self->c = MYCOS(self->w0);
-    self->alpha = MYSIN(self->w0) / (2 * q);
+    self->c = STCOS(self->w0);
+    self->alpha = STSIN(self->w0) / (2 * q);
     (*self->coeffs_func_ptr)(self);
 }
 
 static void
 Biquadx_filters_ii(Biquadx *self) {
-    MYFLT vin, vout;
+    MYSTATE vin, vout;
     int i, j;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -754,7 +758,7 @@ Biquadx_filters_ii(Biquadx *self) {
 
 static void
 Biquadx_filters_ai(Biquadx *self) {
-    MYFLT vin, vout, q;
+    MYSTATE vin, vout, q;
     int i, j;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -785,7 +789,7 @@ Biquadx_filters_ai(Biquadx *self) {
 
 static void
 Biquadx_filters_ia(Biquadx *self) {
-    MYFLT vin, vout, fr;
+    MYSTATE vin, vout, fr;
     int i, j;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -816,7 +820,7 @@ Biquadx_filters_ia(Biquadx *self) {
 
 static void
 Biquadx_filters_aa(Biquadx *self) {
-    MYFLT vin, vout;
+    MYSTATE vin, vout;
     int i, j;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -1284,15 +1288,15 @@ typedef struct {
     int init;
     int modebuffer[2]; // need at least 2 slots for mul & add
     // sample memories
-    MYFLT x1;
-    MYFLT x2;
-    MYFLT y1;
-    MYFLT y2;
+    MYSTATE x1;
+    MYSTATE x2;
+    MYSTATE y1;
+    MYSTATE y2;
 } Biquada;
 
 static void
 Biquada_filters(Biquada *self) {
-    MYFLT val;
+    MYSTATE val;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *b0 = Stream_getData((Stream *)self->b0_stream);
@@ -1701,24 +1705,24 @@ typedef struct {
     int init;
     int modebuffer[5]; // need at least 2 slots for mul & add
     int filtertype;
-    MYFLT nyquist;
+    MYSTATE nyquist;
     // sample memories
-    MYFLT x1;
-    MYFLT x2;
-    MYFLT y1;
-    MYFLT y2;
+    MYSTATE x1;
+    MYSTATE x2;
+    MYSTATE y1;
+    MYSTATE y2;
     // variables
-    MYFLT A;
-    MYFLT c;
-    MYFLT w0;
-    MYFLT alpha;
+    MYSTATE A;
+    MYSTATE c;
+    MYSTATE w0;
+    MYSTATE alpha;
     // coefficients
-    MYFLT b0;
-    MYFLT b1;
-    MYFLT b2;
-    MYFLT a0;
-    MYFLT a1;
-    MYFLT a2;
+    MYSTATE b0;
+    MYSTATE b1;
+    MYSTATE b2;
+    MYSTATE a0;
+    MYSTATE a1;
+    MYSTATE a2;
 } EQ;
 
 static void
@@ -1737,7 +1741,7 @@ EQ_compute_coeffs_peak(EQ *self)
 static void
 EQ_compute_coeffs_lowshelf(EQ *self)
 {
-    MYFLT twoSqrtAAlpha = MYSQRT(self->A * 2.0)*self->alpha;
+    MYFLT twoSqrtAAlpha = STSQRT(self->A * 2.0)*self->alpha;
     MYFLT AminOneC = (self->A - 1.0) * self->c;
     MYFLT AAddOneC = (self->A + 1.0) * self->c;
 
@@ -1752,7 +1756,7 @@ EQ_compute_coeffs_lowshelf(EQ *self)
 static void
 EQ_compute_coeffs_highshelf(EQ *self)
 {
-    MYFLT twoSqrtAAlpha = MYSQRT(self->A * 2.0)*self->alpha;
+    MYFLT twoSqrtAAlpha = STSQRT(self->A * 2.0)*self->alpha;
     MYFLT AminOneC = (self->A - 1.0) * self->c;
     MYFLT AAddOneC = (self->A + 1.0) * self->c;
 
@@ -1772,16 +1776,16 @@ EQ_compute_variables(EQ *self, MYFLT freq, MYFLT q, MYFLT boost)
     else if (freq >= self->nyquist)
         freq = self->nyquist;
 
-    self->A = MYPOW(10.0, boost/40.0);
+    self->A = STPOW(10.0, boost/40.0);
     self->w0 = TWOPI * freq / self->sr;
-    self->c = MYCOS(self->w0);
-    self->alpha = MYSIN(self->w0) / (2 * q);
+    self->c = STCOS(self->w0);
+    self->alpha = STSIN(self->w0) / (2 * q);
     (*self->coeffs_func_ptr)(self);
 }
 
 static void
 EQ_filters_iii(EQ *self) {
-    MYFLT val;
+    MYSTATE val;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -1802,7 +1806,7 @@ EQ_filters_iii(EQ *self) {
 
 static void
 EQ_filters_aii(EQ *self) {
-    MYFLT val, q, boost;
+    MYSTATE val, q, boost;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -1828,7 +1832,7 @@ EQ_filters_aii(EQ *self) {
 
 static void
 EQ_filters_iai(EQ *self) {
-    MYFLT val, fr, boost;
+    MYSTATE val, fr, boost;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -1854,7 +1858,7 @@ EQ_filters_iai(EQ *self) {
 
 static void
 EQ_filters_aai(EQ *self) {
-    MYFLT val, boost;
+    MYSTATE val, boost;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -1880,7 +1884,7 @@ EQ_filters_aai(EQ *self) {
 
 static void
 EQ_filters_iia(EQ *self) {
-    MYFLT val, fr, q;
+    MYSTATE val, fr, q;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -1906,7 +1910,7 @@ EQ_filters_iia(EQ *self) {
 
 static void
 EQ_filters_aia(EQ *self) {
-    MYFLT val, q;
+    MYSTATE val, q;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -1932,7 +1936,7 @@ EQ_filters_aia(EQ *self) {
 
 static void
 EQ_filters_iaa(EQ *self) {
-    MYFLT val, fr;
+    MYSTATE val, fr;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -1958,7 +1962,7 @@ EQ_filters_iaa(EQ *self) {
 
 static void
 EQ_filters_aaa(EQ *self) {
-    MYFLT val;
+    MYSTATE val;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
@@ -2906,18 +2910,18 @@ typedef struct {
     PyObject *freq;
     Stream *freq_stream;
     int modebuffer[3]; // need at least 2 slots for mul & add
-    MYFLT lastFreq;
-    MYFLT nyquist;
+    MYSTATE lastFreq;
+    MYSTATE nyquist;
     // sample memories
-    MYFLT y1;
+    MYSTATE y1;
     // variables
-    MYFLT c1;
-    MYFLT c2;
+    MYSTATE c1;
+    MYSTATE c2;
 } Tone;
 
 static void
 Tone_filters_i(Tone *self) {
-    MYFLT val, b;
+    MYSTATE val, b;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT fr = PyFloat_AS_DOUBLE(self->freq);
@@ -2928,8 +2932,8 @@ Tone_filters_i(Tone *self) {
         else if (fr >= self->nyquist)
             fr = self->nyquist;
         self->lastFreq = fr;
-        b = 2.0 - MYCOS(TWOPI * fr / self->sr);
-        self->c2 = (b - MYSQRT(b * b - 1.0));
+        b = 2.0 - STCOS(TWOPI * fr / self->sr);
+        self->c2 = (b - STSQRT(b * b - 1.0));
         self->c1 = 1.0 - self->c2;
     }
 
@@ -2942,7 +2946,7 @@ Tone_filters_i(Tone *self) {
 
 static void
 Tone_filters_a(Tone *self) {
-    MYFLT val, freq, b;
+    MYSTATE val, freq, b;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
@@ -2955,8 +2959,8 @@ Tone_filters_a(Tone *self) {
             else if (freq >= self->nyquist)
                 freq = self->nyquist;
             self->lastFreq = freq;
-            b = 2.0 - MYCOS(TWOPI * freq / self->sr);
-            self->c2 = (b - MYSQRT(b * b - 1.0));
+            b = 2.0 - STCOS(TWOPI * freq / self->sr);
+            self->c2 = (b - STSQRT(b * b - 1.0));
             self->c1 = 1.0 - self->c2;
         }
         val = self->c1 * in[i] + self->c2 * self->y1;
@@ -3278,18 +3282,18 @@ typedef struct {
     PyObject *freq;
     Stream *freq_stream;
     int modebuffer[3]; // need at least 2 slots for mul & add
-    MYFLT lastFreq;
-    MYFLT nyquist;
+    MYSTATE lastFreq;
+    MYSTATE nyquist;
     // sample memories
-    MYFLT y1;
+    MYSTATE y1;
     // variables
-    MYFLT c1;
-    MYFLT c2;
+    MYSTATE c1;
+    MYSTATE c2;
 } Atone;
 
 static void
 Atone_filters_i(Atone *self) {
-    MYFLT val, b;
+    MYSTATE val, b;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT fr = PyFloat_AS_DOUBLE(self->freq);
@@ -3300,8 +3304,8 @@ Atone_filters_i(Atone *self) {
         else if (fr >= self->nyquist)
             fr = self->nyquist;
         self->lastFreq = fr;
-        b = 2.0 - MYCOS(TWOPI * fr / self->sr);
-        self->c2 = (b - MYSQRT(b * b - 1.0));
+        b = 2.0 - STCOS(TWOPI * fr / self->sr);
+        self->c2 = (b - STSQRT(b * b - 1.0));
         self->c1 = 1.0 - self->c2;
     }
 
@@ -3313,7 +3317,7 @@ Atone_filters_i(Atone *self) {
 
 static void
 Atone_filters_a(Atone *self) {
-    MYFLT val, freq, b;
+    MYSTATE val, freq, b;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
@@ -3326,8 +3330,8 @@ Atone_filters_a(Atone *self) {
             else if (freq >= self->nyquist)
                 freq = self->nyquist;
             self->lastFreq = freq;
-            b = 2.0 - MYCOS(TWOPI * freq / self->sr);
-            self->c2 = (b - MYSQRT(b * b - 1.0));
+            b = 2.0 - STCOS(TWOPI * freq / self->sr);
+            self->c2 = (b - STSQRT(b * b - 1.0));
             self->c1 = 1.0 - self->c2;
         }
         self->y1 = val = self->c1 * in[i] + self->c2 * self->y1;
@@ -4989,35 +4993,38 @@ Phaser_compute_variables(Phaser *self, MYFLT freq, MYFLT spread, MYFLT q)
     }
 }
 
+/* Runs one sample through the chain of second-order allpass stages. */
+static MYFLT
+Phaser_cascade(Phaser *self, MYFLT x) {
+    int j;
+    MYFLT val;
+    MYFLT *y1 = self->y1, *y2 = self->y2, *alpha = self->alpha, *beta = self->beta;
+
+    for (j=0; j<self->stages; j++) {
+        val = x - (y1[j] * beta[j]) - (y2[j] * alpha[j]);
+        x = (val * alpha[j]) + (y1[j] * beta[j]) + y2[j];
+        y2[j] = y1[j];
+        y1[j] = val;
+    }
+    return x;
+}
+
 static void
 Phaser_filters_iii(Phaser *self) {
-    MYFLT val;
-    int i, j;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
     if (self->modebuffer[5] == 0) {
         MYFLT feed = Phaser_clip(PyFloat_AS_DOUBLE(self->feedback));
         for (i=0; i<self->bufsize; i++) {
-            self->tmp = in[i] + self->tmp * feed;
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * feed);
             self->data[i] = self->tmp;
         }
     }
     else {
         MYFLT *feed = Stream_getData((Stream *)self->feedback_stream);
         for (i=0; i<self->bufsize; i++) {
-            self->tmp = in[i] + self->tmp * Phaser_clip(feed[i]);
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * Phaser_clip(feed[i]));
             self->data[i] = self->tmp;
         }
     }
@@ -5025,8 +5032,7 @@ Phaser_filters_iii(Phaser *self) {
 
 static void
 Phaser_filters_aii(Phaser *self) {
-    MYFLT val;
-    int i, j;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
     MYFLT spread = PyFloat_AS_DOUBLE(self->spread);
@@ -5036,13 +5042,7 @@ Phaser_filters_aii(Phaser *self) {
         MYFLT feed = Phaser_clip(PyFloat_AS_DOUBLE(self->feedback));
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq[i], spread, q);
-            self->tmp = in[i] + self->tmp * feed;
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * feed);
             self->data[i] = self->tmp;
         }
     }
@@ -5050,13 +5050,7 @@ Phaser_filters_aii(Phaser *self) {
         MYFLT *feed = Stream_getData((Stream *)self->feedback_stream);
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq[i], spread, q);
-            self->tmp = in[i] + self->tmp * Phaser_clip(feed[i]);
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * Phaser_clip(feed[i]));
             self->data[i] = self->tmp;
         }
     }
@@ -5064,8 +5058,7 @@ Phaser_filters_aii(Phaser *self) {
 
 static void
 Phaser_filters_iai(Phaser *self) {
-    MYFLT val;
-    int i, j;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT freq = PyFloat_AS_DOUBLE(self->freq);
     MYFLT *spread = Stream_getData((Stream *)self->spread_stream);
@@ -5075,13 +5068,7 @@ Phaser_filters_iai(Phaser *self) {
         MYFLT feed = Phaser_clip(PyFloat_AS_DOUBLE(self->feedback));
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq, spread[i], q);
-            self->tmp = in[i] + self->tmp * feed;
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * feed);
             self->data[i] = self->tmp;
         }
     }
@@ -5089,13 +5076,7 @@ Phaser_filters_iai(Phaser *self) {
         MYFLT *feed = Stream_getData((Stream *)self->feedback_stream);
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq, spread[i], q);
-            self->tmp = in[i] + self->tmp * Phaser_clip(feed[i]);
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * Phaser_clip(feed[i]));
             self->data[i] = self->tmp;
         }
     }
@@ -5103,8 +5084,7 @@ Phaser_filters_iai(Phaser *self) {
 
 static void
 Phaser_filters_aai(Phaser *self) {
-    MYFLT val;
-    int i, j;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
     MYFLT *spread = Stream_getData((Stream *)self->spread_stream);
@@ -5114,13 +5094,7 @@ Phaser_filters_aai(Phaser *self) {
         MYFLT feed = Phaser_clip(PyFloat_AS_DOUBLE(self->feedback));
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq[i], spread[i], q);
-            self->tmp = in[i] + self->tmp * feed;
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * feed);
             self->data[i] = self->tmp;
         }
     }
@@ -5128,13 +5102,7 @@ Phaser_filters_aai(Phaser *self) {
         MYFLT *feed = Stream_getData((Stream *)self->feedback_stream);
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq[i], spread[i], q);
-            self->tmp = in[i] + self->tmp * Phaser_clip(feed[i]);
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * Phaser_clip(feed[i]));
             self->data[i] = self->tmp;
         }
     }
@@ -5142,8 +5110,7 @@ Phaser_filters_aai(Phaser *self) {
 
 static void
 Phaser_filters_iia(Phaser *self) {
-    MYFLT val;
-    int i, j;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT freq = PyFloat_AS_DOUBLE(self->freq);
     MYFLT spread = PyFloat_AS_DOUBLE(self->spread);
@@ -5153,13 +5120,7 @@ Phaser_filters_iia(Phaser *self) {
         MYFLT feed = Phaser_clip(PyFloat_AS_DOUBLE(self->feedback));
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq, spread, q[i]);
-            self->tmp = in[i] + self->tmp * feed;
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * feed);
             self->data[i] = self->tmp;
         }
     }
@@ -5167,13 +5128,7 @@ Phaser_filters_iia(Phaser *self) {
         MYFLT *feed = Stream_getData((Stream *)self->feedback_stream);
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq, spread, q[i]);
-            self->tmp = in[i] + self->tmp * Phaser_clip(feed[i]);
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * Phaser_clip(feed[i]));
             self->data[i] = self->tmp;
         }
     }
@@ -5181,8 +5136,7 @@ Phaser_filters_iia(Phaser *self) {
 
 static void
 Phaser_filters_aia(Phaser *self) {
-    MYFLT val;
-    int i, j;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
     MYFLT spread = PyFloat_AS_DOUBLE(self->spread);
@@ -5192,13 +5146,7 @@ Phaser_filters_aia(Phaser *self) {
         MYFLT feed = Phaser_clip(PyFloat_AS_DOUBLE(self->feedback));
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq[i], spread, q[i]);
-            self->tmp = in[i] + self->tmp * feed;
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * feed);
             self->data[i] = self->tmp;
         }
     }
@@ -5206,13 +5154,7 @@ Phaser_filters_aia(Phaser *self) {
         MYFLT *feed = Stream_getData((Stream *)self->feedback_stream);
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq[i], spread, q[i]);
-            self->tmp = in[i] + self->tmp * Phaser_clip(feed[i]);
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * Phaser_clip(feed[i]));
             self->data[i] = self->tmp;
         }
     }
@@ -5220,8 +5162,7 @@ Phaser_filters_aia(Phaser *self) {
 
 static void
 Phaser_filters_iaa(Phaser *self) {
-    MYFLT val;
-    int i, j;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT freq = PyFloat_AS_DOUBLE(self->freq);
     MYFLT *spread = Stream_getData((Stream *)self->spread_stream);
@@ -5231,13 +5172,7 @@ Phaser_filters_iaa(Phaser *self) {
         MYFLT feed = Phaser_clip(PyFloat_AS_DOUBLE(self->feedback));
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq, spread[i], q[i]);
-            self->tmp = in[i] + self->tmp * feed;
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * feed);
             self->data[i] = self->tmp;
         }
     }
@@ -5245,13 +5180,7 @@ Phaser_filters_iaa(Phaser *self) {
         MYFLT *feed = Stream_getData((Stream *)self->feedback_stream);
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq, spread[i], q[i]);
-            self->tmp = in[i] + self->tmp * Phaser_clip(feed[i]);
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * Phaser_clip(feed[i]));
             self->data[i] = self->tmp;
         }
     }
@@ -5259,8 +5188,7 @@ Phaser_filters_iaa(Phaser *self) {
 
 static void
 Phaser_filters_aaa(Phaser *self) {
-    MYFLT val;
-    int i, j;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
     MYFLT *spread = Stream_getData((Stream *)self->spread_stream);
@@ -5270,13 +5198,7 @@ Phaser_filters_aaa(Phaser *self) {
         MYFLT feed = Phaser_clip(PyFloat_AS_DOUBLE(self->feedback));
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq[i], spread[i], q[i]);
-            self->tmp = in[i] + self->tmp * feed;
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * feed);
             self->data[i] = self->tmp;
         }
     }
@@ -5284,13 +5206,7 @@ Phaser_filters_aaa(Phaser *self) {
         MYFLT *feed = Stream_getData((Stream *)self->feedback_stream);
         for (i=0; i<self->bufsize; i++) {
             Phaser_compute_variables(self, freq[i], spread[i], q[i]);
-            self->tmp = in[i] + self->tmp * Phaser_clip(feed[i]);
-            for (j=0; j<self->stages; j++) {
-                val = self->tmp + (self->y1[j] * -self->beta[j]) + (self->y2[j] * -self->alpha[j]);
-                self->tmp = (val * self->alpha[j]) + (self->y1[j] * self->beta[j]) + self->y2[j];
-                self->y2[j] = self->y1[j];
-                self->y1[j] = val;
-            }
+            self->tmp = Phaser_cascade(self, in[i] + self->tmp * Phaser_clip(feed[i]));
             self->data[i] = self->tmp;
         }
     }
@@ -5771,967 +5687,679 @@ PyTypeObject PhaserType = {
     Phaser_new,                                     /* tp_new */
 };
 
+/************************************************************************************************/
+/* MultiPhaserMain object. Multichannel Phaser sharing the allpass coefficients. */
+/************************************************************************************************/
+
+/* The channel frames are padded to a multiple of MULTIPHASER_LANES (one vector register). */
+#define MULTIPHASER_LANES 4
+
 typedef struct {
     pyo_audio_HEAD
     PyObject *input;
-    Stream *input_stream;
-    PyObject *input2;
-    Stream *input2_stream;
+    Stream **input_streams;
+    int inputSize;
+    int width; /* inputSize rounded up to a multiple of MULTIPHASER_LANES */
     PyObject *freq;
     Stream *freq_stream;
     PyObject *spread;
     Stream *spread_stream;
     PyObject *q;
     Stream *q_stream;
-    PyObject *slope;
-    Stream *slope_stream;
-    MYFLT last_freq;
-    MYFLT last_spread;
-    MYFLT last_q;
-    MYFLT last_slope;
-    MYFLT factor;
+    PyObject *feedback;
+    Stream *feedback_stream;
     int stages;
-    int last_stages;
-    int flag;
-    MYFLT nyquist;
+    int modebuffer[4];
+    MYFLT halfSr;
+    MYFLT minusPiOnSr;
     MYFLT twoPiOnSr;
-    int modebuffer[6]; // need at least 2 slots for mul & add
-    // sample memories
+    MYFLT norm_arr_pos;
+    MYFLT lastFreq;
+    MYFLT lastSpread;
+    MYFLT lastQ;
+    // coefficients, shared by all channels
+    MYFLT *alpha;
+    MYFLT *beta;
+    // sample memories, one row of width channels per stage
     MYFLT *y1;
     MYFLT *y2;
-    MYFLT *yy1;
-    MYFLT *yy2;
-    // follower memories
-    MYFLT *follow;
-    // coefficients
-    MYFLT *b0;
-    MYFLT *b2;
-    MYFLT *a0;
-    MYFLT *a1;
-    MYFLT *a2;
-} Vocoder;
+    MYFLT *tmp;
+    MYFLT *param_buffer; /* freq, spread, q and feedback values of the current block */
+    MYFLT *input_buffer; /* interleaved block, one frame of width samples per sample */
+    MYFLT *buffer_streams;
+} MultiPhaserMain;
 
 static void
-Vocoder_allocate_memories(Vocoder *self)
+MultiPhaserMain_compute_variables(MultiPhaserMain *self, MYFLT freq, MYFLT spread, MYFLT q)
 {
-    int i, i2j, j;
-    self->y1 = (MYFLT *)realloc(self->y1, self->stages * 2 *  sizeof(MYFLT));
-    self->y2 = (MYFLT *)realloc(self->y2, self->stages * 2 *  sizeof(MYFLT));
-    self->yy1 = (MYFLT *)realloc(self->yy1, self->stages * 2 *  sizeof(MYFLT));
-    self->yy2 = (MYFLT *)realloc(self->yy2, self->stages * 2 *  sizeof(MYFLT));
-    self->b0 = (MYFLT *)realloc(self->b0, self->stages *  sizeof(MYFLT));
-    self->b2 = (MYFLT *)realloc(self->b2, self->stages *  sizeof(MYFLT));
-    self->a0 = (MYFLT *)realloc(self->a0, self->stages *  sizeof(MYFLT));
-    self->a1 = (MYFLT *)realloc(self->a1, self->stages *  sizeof(MYFLT));
-    self->a2 = (MYFLT *)realloc(self->a2, self->stages *  sizeof(MYFLT));
-    self->follow = (MYFLT *)realloc(self->follow, self->stages *  sizeof(MYFLT));
+    int i, ipart;
+    MYFLT radius, angle, fr, qfactor, pos, fpart;
+
+    qfactor = 1.0 / q * self->minusPiOnSr;
+    fr = freq;
     for (i=0; i<self->stages; i++) {
-        self->b0[i] = self->b2[i] = self->a0[i] = self->a1[i] = self->a2[i] = self->follow[i] = 0.0;
-        for (j=0; j<2; j++) {
-            i2j = i * 2 + j;
-            self->yy1[i2j] = self->yy2[i2j] = self->y1[i2j] = self->y2[i2j] = 0.0;
-        }
+        if (fr <= 20)
+            fr = 20;
+        else if (fr >= self->halfSr)
+            fr = self->halfSr;
+
+        radius = MYPOW(E, fr * qfactor);
+        angle = fr * self->twoPiOnSr;
+
+        self->alpha[i] = radius * radius;
+
+        pos = angle * self->norm_arr_pos;
+        ipart = (int)pos;
+        fpart = pos - ipart;
+        self->beta[i] = -2.0 * radius * (HALF_COS_ARRAY[i] * (1.0 - fpart) + HALF_COS_ARRAY[i+1] * fpart);
+        fr *= spread;
     }
-    self->flag = 1;
+    self->lastFreq = freq;
+    self->lastSpread = spread;
+    self->lastQ = q;
 }
 
 static void
-Vocoder_compute_variables(Vocoder *self, MYFLT base, MYFLT spread, MYFLT q)
+MultiPhaserMain_get_param(MultiPhaserMain *self, int which, PyObject *value, Stream *stream, MYFLT *out)
 {
     int i;
-    MYFLT w0, c, alpha, freq, invqfac;
-
-    invqfac = 1.0 / (2.0 * q);
-
-    for (i=0; i<self->stages; i++) {
-        freq = base * MYPOW(i+1, spread);
-        if (freq <= 10)
-            freq = 10.0;
-        else if (freq >= self->nyquist)
-            freq = self->nyquist;
+    MYFLT val, *in;
 
-        w0 = self->twoPiOnSr * freq;
-        c = MYCOS(w0);
-        alpha = MYSIN(w0) * invqfac;
-        self->b0[i] = alpha;
-        self->b2[i] = -alpha;
-        self->a0[i] = 1.0 / (1.0 + alpha); /* Inversed to multiply */
-        self->a1[i] = -2.0 * c;
-        self->a2[i] = 1.0 - alpha;
+    if (self->modebuffer[which] == 0) {
+        val = PyFloat_AS_DOUBLE(value);
+        for (i=0; i<self->bufsize; i++)
+            out[i] = val;
+    }
+    else {
+        in = Stream_getData(stream);
+        for (i=0; i<self->bufsize; i++)
+            out[i] = in[i];
     }
 }
 
 static void
-Vocoder_filters_iii(Vocoder *self) {
-    int i, j, j2;
-    MYFLT vin, vout, vin2, vout2, w, w2, freq, spread, q, slope, output, amp;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
-
-    freq = PyFloat_AS_DOUBLE(self->freq);
-    spread = PyFloat_AS_DOUBLE(self->spread);
-    q = PyFloat_AS_DOUBLE(self->q);
-    if (q < 0.1)
-        q = 0.1;
-    amp = q * 10.0;
+MultiPhaserMain_filters(MultiPhaserMain *self) {
+    MYFLT val, feed, a, b;
+    MYFLT *in, *x, *y1, *y2;
+    int i, j, k, width = self->width;
+    MYFLT *fr = self->param_buffer;
+    MYFLT *sp = self->param_buffer + self->bufsize;
+    MYFLT *qs = self->param_buffer + 2 * self->bufsize;
+    MYFLT *fd = self->param_buffer + 3 * self->bufsize;
 
-    if (self->modebuffer[5] == 0)
-        slope = PyFloat_AS_DOUBLE(self->slope);
-    else
-        slope = Stream_getData((Stream *)self->slope_stream)[0];
-    if (slope < 0.0)
-        slope = 0.0;
-    else if (slope > 1.0)
-        slope = 1.0;
-    if (slope != self->last_slope) {
-        self->last_slope = slope;
-        self->factor = MYEXP(-1.0 / (self->sr / ((slope * 48.0) + 2.0)));
-    }
+    MultiPhaserMain_get_param(self, 0, self->freq, self->freq_stream, fr);
+    MultiPhaserMain_get_param(self, 1, self->spread, self->spread_stream, sp);
+    MultiPhaserMain_get_param(self, 2, self->q, self->q_stream, qs);
+    MultiPhaserMain_get_param(self, 3, self->feedback, self->feedback_stream, fd);
 
-    if (freq != self->last_freq || spread != self->last_spread || q != self->last_q || self->stages != self->last_stages || self->flag) {
-        self->last_freq = freq;
-        self->last_spread = spread;
-        self->last_q = q;
-        self->last_stages = self->stages;
-        self->flag = 0;
-        Vocoder_compute_variables(self, freq, spread, q);
+    for (k=0; k<self->inputSize; k++) {
+        in = Stream_getData(self->input_streams[k]);
+        for (i=0; i<self->bufsize; i++) {
+            self->input_buffer[i*width+k] = in[i];
+        }
     }
 
     for (i=0; i<self->bufsize; i++) {
-        output = 0.0;
-        vin = in[i];
-        vin2 = in2[i];
+        /* Coefficients are computed once for all channels, and only when a
+           parameter has changed, so at most once per block with constant
+           parameters and at every sample with audio-rate ones. */
+        if (fr[i] != self->lastFreq || sp[i] != self->lastSpread || qs[i] != self->lastQ)
+            MultiPhaserMain_compute_variables(self, fr[i], sp[i], qs[i]);
+
+        feed = Phaser_clip(fd[i]);
+        x = self->input_buffer + i * width;
+        for (k=0; k<width; k++)
+            x[k] += self->tmp[k] * feed;
+
+        /* Each stage is applied to a whole frame of channels before moving to
+           the next one. The loops over the channels have a length multiple of
+           MULTIPHASER_LANES and are vectorized by the compiler. The output
+           replaces the input frame. */
         for (j=0; j<self->stages; j++) {
-            j2 = j * 2;
-            /* Analysis part filter 1 */
-            w = ( vin - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) )  * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
-
-            /* Exciter part filter 1 */
-            w2 = ( vin2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
-
-            j2++;
-            /* Analysis part filter 2 */
-            w = ( vout - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) ) * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+            a = self->alpha[j];
+            b = self->beta[j];
+            y1 = self->y1 + j * width;
+            y2 = self->y2 + j * width;
+            for (k=0; k<width; k++) {
+                val = x[k] - (y1[k] * b) - (y2[k] * a);
+                x[k] = (val * a) + (y1[k] * b) + y2[k];
+                y2[k] = y1[k];
+                y1[k] = val;
+            }
+        }
 
-            /* Exciter part filter 2 */
-            w2 = ( vout2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+        for (k=0; k<width; k++)
+            self->tmp[k] = x[k];
+    }
 
-            /* Follower */
-            if (vout < 0.0)
-                vout = -vout;
-            self->follow[j] = vout + self->factor * (self->follow[j] - vout);
-            output += vout2 * self->follow[j];
+    for (k=0; k<self->inputSize; k++) {
+        for (i=0; i<self->bufsize; i++) {
+            self->buffer_streams[i+k*self->bufsize] = self->input_buffer[i*width+k];
         }
-        self->data[i] = output * amp;
     }
 }
 
+MYFLT *
+MultiPhaserMain_getSamplesBuffer(MultiPhaserMain *self)
+{
+    return (MYFLT *)self->buffer_streams;
+}
+
 static void
-Vocoder_filters_aii(Vocoder *self) {
-    int i, j, j2;
-    int count = 0, maxcount = self->bufsize / 4;
-    MYFLT vin, vout, vin2, vout2, w, w2, spread, q, slope, output, amp;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
+MultiPhaserMain_setProcMode(MultiPhaserMain *self)
+{
+    self->proc_func_ptr = MultiPhaserMain_filters;
+}
 
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    MYFLT freq = fr[0];
-    spread = PyFloat_AS_DOUBLE(self->spread);
-    q = PyFloat_AS_DOUBLE(self->q);
-    if (q < 0.1)
-        q = 0.1;
-    amp = q * 10.0;
+static void
+MultiPhaserMain_compute_next_data_frame(MultiPhaserMain *self)
+{
+    (*self->proc_func_ptr)(self);
+}
 
-    if (self->modebuffer[5] == 0)
-        slope = PyFloat_AS_DOUBLE(self->slope);
-    else
-        slope = Stream_getData((Stream *)self->slope_stream)[0];
-    if (slope < 0.0)
-        slope = 0.0;
-    else if (slope > 1.0)
-        slope = 1.0;
-    if (slope != self->last_slope) {
-        self->last_slope = slope;
-        self->factor = MYEXP(-1.0 / (self->sr / ((slope * 48.0) + 2.0)));
-    }
-
-    for (i=0; i<self->bufsize; i++) {
-        if (count == 0)
-            freq = fr[i];
-        else if (count >= maxcount)
-            count = 0;
-        count++;
-        if (freq != self->last_freq || spread != self->last_spread || q != self->last_q || self->stages != self->last_stages || self->flag) {
-            self->last_freq = freq;
-            self->last_spread = spread;
-            self->last_q = q;
-            self->last_stages = self->stages;
-            self->flag = 0;
-            Vocoder_compute_variables(self, freq, spread, q);
-        }
-        output = 0.0;
-        vin = in[i];
-        vin2 = in2[i];
-        for (j=0; j<self->stages; j++) {
-            j2 = j * 2;
-            /* Analysis part filter 1 */
-            w = ( vin - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) )  * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
-
-            /* Exciter part filter 1 */
-            w2 = ( vin2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
-
-            j2++;
-            /* Analysis part filter 2 */
-            w = ( vout - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) ) * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+static long
+MultiPhaserMain_memory(MultiPhaserMain *self) {
+    return (2 * self->stages + 4 * self->bufsize + (2 * self->stages + 1 + self->bufsize) * self->width + self->bufsize * self->inputSize) * sizeof(MYFLT);
+}
 
-            /* Exciter part filter 2 */
-            w2 = ( vout2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+static int
+MultiPhaserMain_traverse(MultiPhaserMain *self, visitproc visit, void *arg)
+{
+    int i;
+    pyo_VISIT
+    Py_VISIT(self->input);
+    for (i=0; i<self->inputSize; i++) {
+        Py_VISIT(self->input_streams[i]);
+    }
+    Py_VISIT(self->freq);
+    Py_VISIT(self->freq_stream);
+    Py_VISIT(self->spread);
+    Py_VISIT(self->spread_stream);
+    Py_VISIT(self->q);
+    Py_VISIT(self->q_stream);
+    Py_VISIT(self->feedback);
+    Py_VISIT(self->feedback_stream);
+    return 0;
+}
 
-            /* Follower */
-            if (vout < 0.0)
-                vout = -vout;
-            self->follow[j] = vout + self->factor * (self->follow[j] - vout);
-            output += vout2 * self->follow[j];
-        }
-        self->data[i] = output * amp;
+static int
+MultiPhaserMain_clear(MultiPhaserMain *self)
+{
+    int i;
+    pyo_CLEAR
+    Py_CLEAR(self->input);
+    for (i=0; i<self->inputSize; i++) {
+        Py_CLEAR(self->input_streams[i]);
     }
+    Py_CLEAR(self->freq);
+    Py_CLEAR(self->freq_stream);
+    Py_CLEAR(self->spread);
+    Py_CLEAR(self->spread_stream);
+    Py_CLEAR(self->q);
+    Py_CLEAR(self->q_stream);
+    Py_CLEAR(self->feedback);
+    Py_CLEAR(self->feedback_stream);
+    return 0;
 }
 
 static void
-Vocoder_filters_iai(Vocoder *self) {
-    int i, j, j2;
-    int count = 0, maxcount = self->bufsize / 4;
-    MYFLT vin, vout, vin2, vout2, w, w2, freq, q, slope, output, amp;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
-
-    freq = PyFloat_AS_DOUBLE(self->freq);
-    MYFLT *sprd = Stream_getData((Stream *)self->spread_stream);
-    MYFLT spread = sprd[0];
-    q = PyFloat_AS_DOUBLE(self->q);
-    if (q < 0.1)
-        q = 0.1;
-    amp = q * 10.0;
+MultiPhaserMain_dealloc(MultiPhaserMain* self)
+{
+    pyo_DEALLOC
+    free(self->alpha);
+    free(self->beta);
+    free(self->y1);
+    free(self->y2);
+    free(self->tmp);
+    free(self->param_buffer);
+    free(self->input_buffer);
+    free(self->buffer_streams);
+    MultiPhaserMain_clear(self);
+    free(self->input_streams);
+    self->ob_type->tp_free((PyObject*)self);
+}
 
-    if (self->modebuffer[5] == 0)
-        slope = PyFloat_AS_DOUBLE(self->slope);
-    else
-        slope = Stream_getData((Stream *)self->slope_stream)[0];
-    if (slope < 0.0)
-        slope = 0.0;
-    else if (slope > 1.0)
-        slope = 1.0;
-    if (slope != self->last_slope) {
-        self->last_slope = slope;
-        self->factor = MYEXP(-1.0 / (self->sr / ((slope * 48.0) + 2.0)));
-    }
+static PyObject *
+MultiPhaserMain_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *inputtmp, *freqtmp=NULL, *spreadtmp=NULL, *qtmp=NULL, *feedbacktmp=NULL;
+    MultiPhaserMain *self;
+    self = (MultiPhaserMain *)type->tp_alloc(type, 0);
 
-    for (i=0; i<self->bufsize; i++) {
-        if (count == 0)
-            spread = sprd[i];
-        else if (count >= maxcount)
-            count = 0;
-        count++;
-        if (freq != self->last_freq || spread != self->last_spread || q != self->last_q || self->stages != self->last_stages || self->flag) {
-            self->last_freq = freq;
-            self->last_spread = spread;
-            self->last_q = q;
-            self->last_stages = self->stages;
-            self->flag = 0;
-            Vocoder_compute_variables(self, freq, spread, q);
-        }
-        output = 0.0;
-        vin = in[i];
-        vin2 = in2[i];
-        for (j=0; j<self->stages; j++) {
-            j2 = j * 2;
-            /* Analysis part filter 1 */
-            w = ( vin - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) )  * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+    self->freq = PyFloat_FromDouble(1000.0);
+    self->spread = PyFloat_FromDouble(1.0);
+    self->q = PyFloat_FromDouble(10.0);
+    self->feedback = PyFloat_FromDouble(0.0);
+    self->stages = 8;
+    self->inputSize = self->width = 0;
+    self->lastFreq = self->lastSpread = self->lastQ = -1.0;
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+	self->modebuffer[2] = 0;
+	self->modebuffer[3] = 0;
 
-            /* Exciter part filter 1 */
-            w2 = ( vin2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, MultiPhaserMain_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, MultiPhaserMain_memory);
+    self->mode_func_ptr = MultiPhaserMain_setProcMode;
 
-            j2++;
-            /* Analysis part filter 2 */
-            w = ( vout - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) ) * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+    self->halfSr = (MYFLT)self->sr * 0.49;
+    self->minusPiOnSr = -PI / self->sr;
+    self->twoPiOnSr = TWOPI / self->sr;
+    self->norm_arr_pos = 1.0 / PI * 512.0;
 
-            /* Exciter part filter 2 */
-            w2 = ( vout2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+    static char *kwlist[] = {"input", "freq", "spread", "q", "feedback", "num", NULL};
 
-            /* Follower */
-            if (vout < 0.0)
-                vout = -vout;
-            self->follow[j] = vout + self->factor * (self->follow[j] - vout);
-            output += vout2 * self->follow[j];
-        }
-        self->data[i] = output * amp;
-    }
-}
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOOi", kwlist, &inputtmp, &freqtmp, &spreadtmp, &qtmp, &feedbacktmp, &self->stages))
+        Py_RETURN_NONE;
 
-static void
-Vocoder_filters_aai(Vocoder *self) {
-    int i, j, j2;
-    int count = 0, maxcount = self->bufsize / 4;
-    MYFLT vin, vout, vin2, vout2, w, w2, q, slope, output, amp;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
+    if (self->stages < 1)
+        self->stages = 1;
 
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    MYFLT freq = fr[0];
-    MYFLT *sprd = Stream_getData((Stream *)self->spread_stream);
-    MYFLT spread = sprd[0];
-    q = PyFloat_AS_DOUBLE(self->q);
-    if (q < 0.1)
-        q = 0.1;
-    amp = q * 10.0;
+    self->alpha = (MYFLT *)realloc(self->alpha, self->stages * sizeof(MYFLT));
+    self->beta = (MYFLT *)realloc(self->beta, self->stages * sizeof(MYFLT));
+    self->param_buffer = (MYFLT *)realloc(self->param_buffer, 4 * self->bufsize * sizeof(MYFLT));
 
-    if (self->modebuffer[5] == 0)
-        slope = PyFloat_AS_DOUBLE(self->slope);
-    else
-        slope = Stream_getData((Stream *)self->slope_stream)[0];
-    if (slope < 0.0)
-        slope = 0.0;
-    else if (slope > 1.0)
-        slope = 1.0;
-    if (slope != self->last_slope) {
-        self->last_slope = slope;
-        self->factor = MYEXP(-1.0 / (self->sr / ((slope * 48.0) + 2.0)));
+    if (inputtmp) {
+        PyObject_CallMethod((PyObject *)self, "setInput", "O", inputtmp);
     }
 
-    for (i=0; i<self->bufsize; i++) {
-        if (count == 0) {
-            freq = fr[i];
-            spread = sprd[i];
-        }
-        else if (count >= maxcount)
-            count = 0;
-        count++;
-        if (freq != self->last_freq || spread != self->last_spread || q != self->last_q || self->stages != self->last_stages || self->flag) {
-            self->last_freq = freq;
-            self->last_spread = spread;
-            self->last_q = q;
-            self->last_stages = self->stages;
-            self->flag = 0;
-            Vocoder_compute_variables(self, freq, spread, q);
-        }
-        output = 0.0;
-        vin = in[i];
-        vin2 = in2[i];
-        for (j=0; j<self->stages; j++) {
-            j2 = j * 2;
-            /* Analysis part filter 1 */
-            w = ( vin - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) )  * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
-
-            /* Exciter part filter 1 */
-            w2 = ( vin2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+    if (freqtmp) {
+        PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
+    }
 
-            j2++;
-            /* Analysis part filter 2 */
-            w = ( vout - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) ) * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+    if (spreadtmp) {
+        PyObject_CallMethod((PyObject *)self, "setSpread", "O", spreadtmp);
+    }
 
-            /* Exciter part filter 2 */
-            w2 = ( vout2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+    if (qtmp) {
+        PyObject_CallMethod((PyObject *)self, "setQ", "O", qtmp);
+    }
 
-            /* Follower */
-            if (vout < 0.0)
-                vout = -vout;
-            self->follow[j] = vout + self->factor * (self->follow[j] - vout);
-            output += vout2 * self->follow[j];
-        }
-        self->data[i] = output * amp;
+    if (feedbacktmp) {
+        PyObject_CallMethod((PyObject *)self, "setFeedback", "O", feedbacktmp);
     }
-}
 
-static void
-Vocoder_filters_iia(Vocoder *self) {
-    int i, j, j2;
-    int count = 0, maxcount = self->bufsize / 4;
-    MYFLT vin, vout, vin2, vout2, w, w2, freq, spread, slope, output, amp = 1.0;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
 
-    freq = PyFloat_AS_DOUBLE(self->freq);
-    spread = PyFloat_AS_DOUBLE(self->spread);
-    MYFLT *qstr = Stream_getData((Stream *)self->q_stream);
-    MYFLT q = qstr[0];
-    if (self->modebuffer[5] == 0)
-        slope = PyFloat_AS_DOUBLE(self->slope);
-    else
-        slope = Stream_getData((Stream *)self->slope_stream)[0];
-    if (slope < 0.0)
-        slope = 0.0;
-    else if (slope > 1.0)
-        slope = 1.0;
-    if (slope != self->last_slope) {
-        self->last_slope = slope;
-        self->factor = MYEXP(-1.0 / (self->sr / ((slope * 48.0) + 2.0)));
-    }
+    (*self->mode_func_ptr)(self);
 
-    for (i=0; i<self->bufsize; i++) {
-        if (count == 0) {
-            q = qstr[i];
-            if (q < 0.1)
-                q = 0.1;
-            amp = q * 10.0;
-        }
-        else if (count >= maxcount)
-            count = 0;
-        count++;
-        if (freq != self->last_freq || spread != self->last_spread || q != self->last_q || self->stages != self->last_stages || self->flag) {
-            self->last_freq = freq;
-            self->last_spread = spread;
-            self->last_q = q;
-            self->last_stages = self->stages;
-            self->flag = 0;
-            Vocoder_compute_variables(self, freq, spread, q);
-        }
-        output = 0.0;
-        vin = in[i];
-        vin2 = in2[i];
-        for (j=0; j<self->stages; j++) {
-            j2 = j * 2;
-            /* Analysis part filter 1 */
-            w = ( vin - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) )  * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+    return (PyObject *)self;
+}
 
-            /* Exciter part filter 1 */
-            w2 = ( vin2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+static PyObject * MultiPhaserMain_getServer(MultiPhaserMain* self) { GET_SERVER };
+static PyObject * MultiPhaserMain_getStream(MultiPhaserMain* self) { GET_STREAM };
 
-            j2++;
-            /* Analysis part filter 2 */
-            w = ( vout - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) ) * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+static PyObject * MultiPhaserMain_play(MultiPhaserMain *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * MultiPhaserMain_stop(MultiPhaserMain *self) { STOP };
 
-            /* Exciter part filter 2 */
-            w2 = ( vout2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+static PyObject *
+MultiPhaserMain_setInput(MultiPhaserMain *self, PyObject *arg)
+{
+    int i, nchnls;
+    PyObject *tmp, *streamtmp;
 
-            /* Follower */
-            if (vout < 0.0)
-                vout = -vout;
-            self->follow[j] = vout + self->factor * (self->follow[j] - vout);
-            output += vout2 * self->follow[j];
-        }
-        self->data[i] = output * amp;
+    if (! PyList_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "The inputs attribute must be a list.");
+        Py_INCREF(Py_None);
+        return Py_None;
     }
-}
 
-static void
-Vocoder_filters_aia(Vocoder *self) {
-    int i, j, j2;
-    int count = 0, maxcount = self->bufsize / 4;
-    MYFLT vin, vout, vin2, vout2, w, w2, spread, slope, output, amp = 1.0;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
+    tmp = arg;
+    nchnls = PyList_Size(tmp);
+    Py_INCREF(tmp);
+    Py_XDECREF(self->input);
+    self->input = tmp;
 
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    MYFLT freq = fr[0];
-    spread = PyFloat_AS_DOUBLE(self->spread);
-    MYFLT *qstr = Stream_getData((Stream *)self->q_stream);
-    MYFLT q = qstr[0];
-    if (self->modebuffer[5] == 0)
-        slope = PyFloat_AS_DOUBLE(self->slope);
-    else
-        slope = Stream_getData((Stream *)self->slope_stream)[0];
-    if (slope < 0.0)
-        slope = 0.0;
-    else if (slope > 1.0)
-        slope = 1.0;
-    if (slope != self->last_slope) {
-        self->last_slope = slope;
-        self->factor = MYEXP(-1.0 / (self->sr / ((slope * 48.0) + 2.0)));
+    for (i=0; i<self->inputSize; i++) {
+        Py_XDECREF(self->input_streams[i]);
+    }
+    self->input_streams = (Stream **)realloc(self->input_streams, nchnls * sizeof(Stream *));
+    for (i=0; i<nchnls; i++) {
+        streamtmp = PyObject_CallMethod((PyObject *)PyList_GET_ITEM(self->input, i), "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        self->input_streams[i] = (Stream *)streamtmp;
     }
 
-    for (i=0; i<self->bufsize; i++) {
-        if (count == 0) {
-            freq = fr[i];
-            q = qstr[i];
-            if (q < 0.1)
-                q = 0.1;
-            amp = q * 10.0;
+    if (nchnls != self->inputSize) {
+        self->inputSize = nchnls;
+        self->width = (nchnls + MULTIPHASER_LANES - 1) / MULTIPHASER_LANES * MULTIPHASER_LANES;
+        self->y1 = (MYFLT *)realloc(self->y1, self->stages * self->width * sizeof(MYFLT));
+        self->y2 = (MYFLT *)realloc(self->y2, self->stages * self->width * sizeof(MYFLT));
+        for (i=0; i<(self->stages*self->width); i++) {
+            self->y1[i] = self->y2[i] = 0.0;
         }
-        else if (count >= maxcount)
-            count = 0;
-        count++;
-        if (freq != self->last_freq || spread != self->last_spread || q != self->last_q || self->stages != self->last_stages || self->flag) {
-            self->last_freq = freq;
-            self->last_spread = spread;
-            self->last_q = q;
-            self->last_stages = self->stages;
-            self->flag = 0;
-            Vocoder_compute_variables(self, freq, spread, q);
+        self->tmp = (MYFLT *)realloc(self->tmp, self->width * sizeof(MYFLT));
+        for (i=0; i<self->width; i++) {
+            self->tmp[i] = 0.0;
         }
-        output = 0.0;
-        vin = in[i];
-        vin2 = in2[i];
-        for (j=0; j<self->stages; j++) {
-            j2 = j * 2;
-            /* Analysis part filter 1 */
-            w = ( vin - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) )  * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+        /* Unused lanes stay at 0. */
+        self->input_buffer = (MYFLT *)realloc(self->input_buffer, self->bufsize * self->width * sizeof(MYFLT));
+        for (i=0; i<(self->bufsize*self->width); i++) {
+            self->input_buffer[i] = 0.0;
+        }
+        self->buffer_streams = (MYFLT *)realloc(self->buffer_streams, self->bufsize * nchnls * sizeof(MYFLT));
+        for (i=0; i<(self->bufsize*nchnls); i++) {
+            self->buffer_streams[i] = 0.0;
+        }
+    }
 
-            /* Exciter part filter 1 */
-            w2 = ( vin2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+    Py_INCREF(Py_None);
+    return Py_None;
+}
 
-            j2++;
-            /* Analysis part filter 2 */
-            w = ( vout - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) ) * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+static PyObject *
+MultiPhaserMain_setFreq(MultiPhaserMain *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
 
-            /* Exciter part filter 2 */
-            w2 = ( vout2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
 
-            /* Follower */
-            if (vout < 0.0)
-                vout = -vout;
-            self->follow[j] = vout + self->factor * (self->follow[j] - vout);
-            output += vout2 * self->follow[j];
-        }
-        self->data[i] = output * amp;
-    }
-}
+	int isNumber = PyNumber_Check(arg);
 
-static void
-Vocoder_filters_iaa(Vocoder *self) {
-    int i, j, j2;
-    int count = 0, maxcount = self->bufsize / 4;
-    MYFLT vin, vout, vin2, vout2, w, w2, freq, slope, output, amp = 1.0;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->freq);
+	if (isNumber == 1) {
+		self->freq = PyNumber_Float(tmp);
+        self->modebuffer[0] = 0;
+	}
+	else {
+		self->freq = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->freq, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->freq_stream);
+        self->freq_stream = (Stream *)streamtmp;
+		self->modebuffer[0] = 1;
+	}
 
-    freq = PyFloat_AS_DOUBLE(self->freq);
-    MYFLT *sprd = Stream_getData((Stream *)self->spread_stream);
-    MYFLT spread = sprd[0];
-    MYFLT *qstr = Stream_getData((Stream *)self->q_stream);
-    MYFLT q = qstr[0];
-    if (self->modebuffer[5] == 0)
-        slope = PyFloat_AS_DOUBLE(self->slope);
-    else
-        slope = Stream_getData((Stream *)self->slope_stream)[0];
-    if (slope < 0.0)
-        slope = 0.0;
-    else if (slope > 1.0)
-        slope = 1.0;
-    if (slope != self->last_slope) {
-        self->last_slope = slope;
-        self->factor = MYEXP(-1.0 / (self->sr / ((slope * 48.0) + 2.0)));
-    }
+	Py_INCREF(Py_None);
+	return Py_None;
+}
 
-    for (i=0; i<self->bufsize; i++) {
-        if (count == 0) {
-            spread = sprd[i];
-            q = qstr[i];
-            if (q < 0.1)
-                q = 0.1;
-            amp = q * 10.0;
-        }
-        else if (count >= maxcount)
-            count = 0;
-        count++;
-        if (freq != self->last_freq || spread != self->last_spread || q != self->last_q || self->stages != self->last_stages || self->flag) {
-            self->last_freq = freq;
-            self->last_spread = spread;
-            self->last_q = q;
-            self->last_stages = self->stages;
-            self->flag = 0;
-            Vocoder_compute_variables(self, freq, spread, q);
-        }
-        output = 0.0;
-        vin = in[i];
-        vin2 = in2[i];
-        for (j=0; j<self->stages; j++) {
-            j2 = j * 2;
-            /* Analysis part filter 1 */
-            w = ( vin - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) )  * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+static PyObject *
+MultiPhaserMain_setSpread(MultiPhaserMain *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
 
-            /* Exciter part filter 1 */
-            w2 = ( vin2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
 
-            j2++;
-            /* Analysis part filter 2 */
-            w = ( vout - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) ) * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+	int isNumber = PyNumber_Check(arg);
 
-            /* Exciter part filter 2 */
-            w2 = ( vout2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->spread);
+	if (isNumber == 1) {
+		self->spread = PyNumber_Float(tmp);
+        self->modebuffer[1] = 0;
+	}
+	else {
+		self->spread = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->spread, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->spread_stream);
+        self->spread_stream = (Stream *)streamtmp;
+		self->modebuffer[1] = 1;
+	}
 
-            /* Follower */
-            if (vout < 0.0)
-                vout = -vout;
-            self->follow[j] = vout + self->factor * (self->follow[j] - vout);
-            output += vout2 * self->follow[j];
-        }
-        self->data[i] = output * amp;
-    }
+	Py_INCREF(Py_None);
+	return Py_None;
 }
 
-static void
-Vocoder_filters_aaa(Vocoder *self) {
-    int i, j, j2;
-    int count = 0, maxcount = self->bufsize / 4;
-    MYFLT vin, vout, vin2, vout2, w, w2, slope, output, amp = 1.0;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
+static PyObject *
+MultiPhaserMain_setQ(MultiPhaserMain *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
 
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    MYFLT freq = fr[0];
-    MYFLT *sprd = Stream_getData((Stream *)self->spread_stream);
-    MYFLT spread = sprd[0];
-    MYFLT *qstr = Stream_getData((Stream *)self->q_stream);
-    MYFLT q = qstr[0];
-    if (self->modebuffer[5] == 0)
-        slope = PyFloat_AS_DOUBLE(self->slope);
-    else
-        slope = Stream_getData((Stream *)self->slope_stream)[0];
-    if (slope < 0.0)
-        slope = 0.0;
-    else if (slope > 1.0)
-        slope = 1.0;
-    if (slope != self->last_slope) {
-        self->last_slope = slope;
-        self->factor = MYEXP(-1.0 / (self->sr / ((slope * 99.0) + 1.0)));
-    }
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
 
-    for (i=0; i<self->bufsize; i++) {
-        if (count == 0) {
-            freq = fr[i];
-            spread = sprd[i];
-            q = qstr[i];
-            if (q < 0.1)
-                q = 0.1;
-            amp = q * 10.0;
-        }
-        else if (count >= maxcount)
-            count = 0;
-        count++;
-        if (freq != self->last_freq || spread != self->last_spread || q != self->last_q || self->stages != self->last_stages || self->flag) {
-            self->last_freq = freq;
-            self->last_spread = spread;
-            self->last_q = q;
-            self->last_stages = self->stages;
-            self->flag = 0;
-            Vocoder_compute_variables(self, freq, spread, q);
-        }
-        output = 0.0;
-        vin = in[i];
-        vin2 = in2[i];
-        for (j=0; j<self->stages; j++) {
-            j2 = j * 2;
-            /* Analysis part filter 1 */
-            w = ( vin - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) )  * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+	int isNumber = PyNumber_Check(arg);
 
-            /* Exciter part filter 1 */
-            w2 = ( vin2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->q);
+	if (isNumber == 1) {
+		self->q = PyNumber_Float(tmp);
+        self->modebuffer[2] = 0;
+	}
+	else {
+		self->q = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->q, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->q_stream);
+        self->q_stream = (Stream *)streamtmp;
+		self->modebuffer[2] = 1;
+	}
 
-            j2++;
-            /* Analysis part filter 2 */
-            w = ( vout - (self->a1[j] * self->y1[j2]) - (self->a2[j] * self->y2[j2]) ) * self->a0[j];
-            vout = (self->b0[j] * w) + (self->b2[j] * self->y2[j2]);
-            self->y2[j2] = self->y1[j2];
-            self->y1[j2] = w;
+	Py_INCREF(Py_None);
+	return Py_None;
+}
 
-            /* Exciter part filter 2 */
-            w2 = ( vout2 - (self->a1[j] * self->yy1[j2]) - (self->a2[j] * self->yy2[j2]) ) * self->a0[j];
-            vout2 = (self->b0[j] * w2) + (self->b2[j] * self->yy2[j2]);
-            self->yy2[j2] = self->yy1[j2];
-            self->yy1[j2] = w2;
+static PyObject *
+MultiPhaserMain_setFeedback(MultiPhaserMain *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
 
-            /* Follower */
-            if (vout < 0.0)
-                vout = -vout;
-            self->follow[j] = vout + self->factor * (self->follow[j] - vout);
-            output += vout2 * self->follow[j];
-        }
-        self->data[i] = output * amp;
-    }
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->feedback);
+	if (isNumber == 1) {
+		self->feedback = PyNumber_Float(tmp);
+        self->modebuffer[3] = 0;
+	}
+	else {
+		self->feedback = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->feedback, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->feedback_stream);
+        self->feedback_stream = (Stream *)streamtmp;
+		self->modebuffer[3] = 1;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
 }
 
-static void Vocoder_postprocessing_ii(Vocoder *self) { POST_PROCESSING_II };
-static void Vocoder_postprocessing_ai(Vocoder *self) { POST_PROCESSING_AI };
-static void Vocoder_postprocessing_ia(Vocoder *self) { POST_PROCESSING_IA };
-static void Vocoder_postprocessing_aa(Vocoder *self) { POST_PROCESSING_AA };
-static void Vocoder_postprocessing_ireva(Vocoder *self) { POST_PROCESSING_IREVA };
-static void Vocoder_postprocessing_areva(Vocoder *self) { POST_PROCESSING_AREVA };
-static void Vocoder_postprocessing_revai(Vocoder *self) { POST_PROCESSING_REVAI };
-static void Vocoder_postprocessing_revaa(Vocoder *self) { POST_PROCESSING_REVAA };
-static void Vocoder_postprocessing_revareva(Vocoder *self) { POST_PROCESSING_REVAREVA };
+static PyMemberDef MultiPhaserMain_members[] = {
+{"server", T_OBJECT_EX, offsetof(MultiPhaserMain, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(MultiPhaserMain, stream), 0, "Stream object."},
+{"input", T_OBJECT_EX, offsetof(MultiPhaserMain, input), 0, "List of input sound objects."},
+{"freq", T_OBJECT_EX, offsetof(MultiPhaserMain, freq), 0, "Base frequency in Hertz."},
+{"spread", T_OBJECT_EX, offsetof(MultiPhaserMain, spread), 0, "Frequencies spreading factor."},
+{"q", T_OBJECT_EX, offsetof(MultiPhaserMain, q), 0, "Q factor."},
+{"feedback", T_OBJECT_EX, offsetof(MultiPhaserMain, feedback), 0, "Feedback factor."},
+{NULL}  /* Sentinel */
+};
+
+static PyMethodDef MultiPhaserMain_methods[] = {
+{"getServer", (PyCFunction)MultiPhaserMain_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)MultiPhaserMain_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)MultiPhaserMain_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"stop", (PyCFunction)MultiPhaserMain_stop, METH_NOARGS, "Stops computing."},
+{"setInput", (PyCFunction)MultiPhaserMain_setInput, METH_O, "Sets list of input streams."},
+{"setFreq", (PyCFunction)MultiPhaserMain_setFreq, METH_O, "Sets base frequency in Hertz."},
+{"setSpread", (PyCFunction)MultiPhaserMain_setSpread, METH_O, "Sets spreading factor."},
+{"setQ", (PyCFunction)MultiPhaserMain_setQ, METH_O, "Sets filter Q factor."},
+{"setFeedback", (PyCFunction)MultiPhaserMain_setFeedback, METH_O, "Sets filter Feedback factor."},
+{NULL}  /* Sentinel */
+};
+
+PyTypeObject MultiPhaserMainType = {
+PyObject_HEAD_INIT(NULL)
+0,                         /*ob_size*/
+"_pyo.MultiPhaserMain_base",         /*tp_name*/
+sizeof(MultiPhaserMain),         /*tp_basicsize*/
+0,                         /*tp_itemsize*/
+(destructor)MultiPhaserMain_dealloc, /*tp_dealloc*/
+0,                         /*tp_print*/
+0,                         /*tp_getattr*/
+0,                         /*tp_setattr*/
+0,                         /*tp_compare*/
+0,                         /*tp_repr*/
+0,                         /*tp_as_number*/
+0,                         /*tp_as_sequence*/
+0,                         /*tp_as_mapping*/
+0,                         /*tp_hash */
+0,                         /*tp_call*/
+0,                         /*tp_str*/
+0,                         /*tp_getattro*/
+0,                         /*tp_setattro*/
+0,                         /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"MultiPhaserMain objects. Multi-stages second order allpass filters over interleaved multichannel buffers.",           /* tp_doc */
+(traverseproc)MultiPhaserMain_traverse,   /* tp_traverse */
+(inquiry)MultiPhaserMain_clear,           /* tp_clear */
+0,		               /* tp_richcompare */
+0,		               /* tp_weaklistoffset */
+0,		               /* tp_iter */
+0,		               /* tp_iternext */
+MultiPhaserMain_methods,             /* tp_methods */
+MultiPhaserMain_members,             /* tp_members */
+0,                      /* tp_getset */
+0,                         /* tp_base */
+0,                         /* tp_dict */
+0,                         /* tp_descr_get */
+0,                         /* tp_descr_set */
+0,                         /* tp_dictoffset */
+0,      /* tp_init */
+0,                         /* tp_alloc */
+MultiPhaserMain_new,                 /* tp_new */
+};
+
+/************************************************************************************************/
+/* MultiPhaser streamer object */
+/************************************************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    MultiPhaserMain *mainSplitter;
+    int modebuffer[2];
+    int chnl;
+} MultiPhaser;
+
+static void MultiPhaser_postprocessing_ii(MultiPhaser *self) { POST_PROCESSING_II };
+static void MultiPhaser_postprocessing_ai(MultiPhaser *self) { POST_PROCESSING_AI };
+static void MultiPhaser_postprocessing_ia(MultiPhaser *self) { POST_PROCESSING_IA };
+static void MultiPhaser_postprocessing_aa(MultiPhaser *self) { POST_PROCESSING_AA };
+static void MultiPhaser_postprocessing_ireva(MultiPhaser *self) { POST_PROCESSING_IREVA };
+static void MultiPhaser_postprocessing_areva(MultiPhaser *self) { POST_PROCESSING_AREVA };
+static void MultiPhaser_postprocessing_revai(MultiPhaser *self) { POST_PROCESSING_REVAI };
+static void MultiPhaser_postprocessing_revaa(MultiPhaser *self) { POST_PROCESSING_REVAA };
+static void MultiPhaser_postprocessing_revareva(MultiPhaser *self) { POST_PROCESSING_REVAREVA };
 
 static void
-Vocoder_setProcMode(Vocoder *self)
+MultiPhaser_setProcMode(MultiPhaser *self)
 {
-    int procmode, muladdmode;
-    procmode = self->modebuffer[2] + self->modebuffer[3] * 10 + self->modebuffer[4] * 100;
+    int muladdmode;
     muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
 
-	switch (procmode) {
-        case 0:
-            self->proc_func_ptr = Vocoder_filters_iii;
-            break;
-        case 1:
-            self->proc_func_ptr = Vocoder_filters_aii;
-            break;
-        case 10:
-            self->proc_func_ptr = Vocoder_filters_iai;
-            break;
-        case 11:
-            self->proc_func_ptr = Vocoder_filters_aai;
-            break;
-        case 100:
-            self->proc_func_ptr = Vocoder_filters_iia;
-            break;
-        case 101:
-            self->proc_func_ptr = Vocoder_filters_aia;
-            break;
-        case 110:
-            self->proc_func_ptr = Vocoder_filters_iaa;
-            break;
-        case 111:
-            self->proc_func_ptr = Vocoder_filters_aaa;
-            break;
-    }
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = Vocoder_postprocessing_ii;
+            self->muladd_func_ptr = MultiPhaser_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = Vocoder_postprocessing_ai;
+            self->muladd_func_ptr = MultiPhaser_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = Vocoder_postprocessing_revai;
+            self->muladd_func_ptr = MultiPhaser_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = Vocoder_postprocessing_ia;
+            self->muladd_func_ptr = MultiPhaser_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = Vocoder_postprocessing_aa;
+            self->muladd_func_ptr = MultiPhaser_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = Vocoder_postprocessing_revaa;
+            self->muladd_func_ptr = MultiPhaser_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = Vocoder_postprocessing_ireva;
+            self->muladd_func_ptr = MultiPhaser_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = Vocoder_postprocessing_areva;
+            self->muladd_func_ptr = MultiPhaser_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = Vocoder_postprocessing_revareva;
+            self->muladd_func_ptr = MultiPhaser_postprocessing_revareva;
             break;
     }
 }
 
 static void
-Vocoder_compute_next_data_frame(Vocoder *self)
+MultiPhaser_compute_next_data_frame(MultiPhaser *self)
 {
-    (*self->proc_func_ptr)(self);
+    int i;
+    MYFLT *tmp;
+    int offset = self->chnl * self->bufsize;
+    tmp = MultiPhaserMain_getSamplesBuffer((MultiPhaserMain *)self->mainSplitter);
+    for (i=0; i<self->bufsize; i++) {
+        self->data[i] = tmp[i + offset];
+    }
     (*self->muladd_func_ptr)(self);
 }
 
 static int
-Vocoder_traverse(Vocoder *self, visitproc visit, void *arg)
+MultiPhaser_traverse(MultiPhaser *self, visitproc visit, void *arg)
 {
     pyo_VISIT
-    Py_VISIT(self->input);
-    Py_VISIT(self->input_stream);
-    Py_VISIT(self->input2);
-    Py_VISIT(self->input2_stream);
-    Py_VISIT(self->freq);
-    Py_VISIT(self->freq_stream);
-    Py_VISIT(self->spread);
-    Py_VISIT(self->spread_stream);
-    Py_VISIT(self->q);
-    Py_VISIT(self->q_stream);
-    Py_VISIT(self->slope);
-    Py_VISIT(self->slope_stream);
+    Py_VISIT(self->mainSplitter);
     return 0;
 }
 
 static int
-Vocoder_clear(Vocoder *self)
+MultiPhaser_clear(MultiPhaser *self)
 {
     pyo_CLEAR
-    Py_CLEAR(self->input);
-    Py_CLEAR(self->input_stream);
-    Py_CLEAR(self->input2);
-    Py_CLEAR(self->input2_stream);
-    Py_CLEAR(self->freq);
-    Py_CLEAR(self->freq_stream);
-    Py_CLEAR(self->spread);
-    Py_CLEAR(self->spread_stream);
-    Py_CLEAR(self->q);
-    Py_CLEAR(self->q_stream);
-    Py_CLEAR(self->slope);
-    Py_CLEAR(self->slope_stream);
+    Py_CLEAR(self->mainSplitter);
     return 0;
 }
 
 static void
-Vocoder_dealloc(Vocoder* self)
+MultiPhaser_dealloc(MultiPhaser* self)
 {
     pyo_DEALLOC
-    free(self->y1);
-    free(self->y2);
-    free(self->yy1);
-    free(self->yy2);
-    free(self->b0);
-    free(self->b2);
-    free(self->a0);
-    free(self->a1);
-    free(self->a2);
-    free(self->follow);
-    Vocoder_clear(self);
+    MultiPhaser_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
 static PyObject *
-Vocoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+MultiPhaser_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
-    PyObject *inputtmp, *input_streamtmp, *input2tmp, *input2_streamtmp, *freqtmp=NULL, *spreadtmp=NULL, *qtmp=NULL, *slopetmp=NULL, *multmp=NULL, *addtmp=NULL;
-    Vocoder *self;
-    self = (Vocoder *)type->tp_alloc(type, 0);
+    PyObject *maintmp=NULL, *multmp=NULL, *addtmp=NULL;
+    MultiPhaser *self;
+    self = (MultiPhaser *)type->tp_alloc(type, 0);
 
-    self->freq = PyFloat_FromDouble(60);
-    self->spread = PyFloat_FromDouble(1.25);
-    self->q = PyFloat_FromDouble(20);
-    self->slope = PyFloat_FromDouble(0.5);
-    self->last_freq = self->last_spread = self->last_q = self->last_slope = -1.0;
-    self->factor = 0.99;
-    self->stages = 24;
-    self->last_stages = -1;
-    self->flag = 0;
-	self->modebuffer[0] = 0;
-	self->modebuffer[1] = 0;
-	self->modebuffer[2] = 0;
-	self->modebuffer[3] = 0;
-	self->modebuffer[4] = 0;
-	self->modebuffer[5] = 0;
+    self->modebuffer[0] = 0;
+    self->modebuffer[1] = 0;
 
     INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, MultiPhaser_compute_next_data_frame);
+    self->mode_func_ptr = MultiPhaser_setProcMode;
 
-    self->nyquist = (MYFLT)self->sr * 0.49;
-    self->twoPiOnSr = (MYFLT)(TWOPI / self->sr);
-
-    Stream_setFunctionPtr(self->stream, Vocoder_compute_next_data_frame);
-    self->mode_func_ptr = Vocoder_setProcMode;
-
-    static char *kwlist[] = {"input", "input2", "freq", "spread", "q", "slope", "stages", "mul", "add", NULL};
-
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OO|OOOOiOO", kwlist, &inputtmp, &input2tmp, &freqtmp, &spreadtmp, &qtmp, &slopetmp, &self->stages, &multmp, &addtmp))
-        Py_RETURN_NONE;
-
-    INIT_INPUT_STREAM
+    static char *kwlist[] = {"mainSplitter", "chnl", "mul", "add", NULL};
 
-    if ( PyObject_HasAttrString((PyObject *)input2tmp, "server") == 0 ) {
-        PyErr_SetString(PyExc_TypeError, "\"input2\" argument of Vocoder must be a PyoObject.\n");
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "Oi|OO", kwlist, &maintmp, &self->chnl, &multmp, &addtmp))
         Py_RETURN_NONE;
-    }
-    Py_XDECREF(self->input2);
-    self->input2 = input2tmp;
-    input2_streamtmp = PyObject_CallMethod((PyObject *)self->input2, "_getStream", NULL);
-    Py_INCREF(input2_streamtmp);
-    Py_XDECREF(self->input2_stream);
-    self->input2_stream = (Stream *)input2_streamtmp;
-
-    if (freqtmp) {
-        PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
-    }
-
-    if (spreadtmp) {
-        PyObject_CallMethod((PyObject *)self, "setSpread", "O", spreadtmp);
-    }
-
-    if (qtmp) {
-        PyObject_CallMethod((PyObject *)self, "setQ", "O", qtmp);
-    }
 
-    if (slopetmp) {
-        PyObject_CallMethod((PyObject *)self, "setSlope", "O", slopetmp);
-    }
+    Py_XDECREF(self->mainSplitter);
+    Py_INCREF(maintmp);
+    self->mainSplitter = (MultiPhaserMain *)maintmp;
 
     if (multmp) {
         PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
@@ -6743,869 +6371,2110 @@ Vocoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     PyObject_CallMethod(self->server, "addStream", "O", self->stream);
 
-    Vocoder_allocate_memories(self);
-
     (*self->mode_func_ptr)(self);
 
     return (PyObject *)self;
 }
 
-static PyObject * Vocoder_getServer(Vocoder* self) { GET_SERVER };
-static PyObject * Vocoder_getStream(Vocoder* self) { GET_STREAM };
-static PyObject * Vocoder_setMul(Vocoder *self, PyObject *arg) { SET_MUL };
-static PyObject * Vocoder_setAdd(Vocoder *self, PyObject *arg) { SET_ADD };
-static PyObject * Vocoder_setSub(Vocoder *self, PyObject *arg) { SET_SUB };
-static PyObject * Vocoder_setDiv(Vocoder *self, PyObject *arg) { SET_DIV };
+static PyObject * MultiPhaser_getServer(MultiPhaser* self) { GET_SERVER };
+static PyObject * MultiPhaser_getStream(MultiPhaser* self) { GET_STREAM };
+static PyObject * MultiPhaser_setMul(MultiPhaser *self, PyObject *arg) { SET_MUL };
+static PyObject * MultiPhaser_setAdd(MultiPhaser *self, PyObject *arg) { SET_ADD };
+static PyObject * MultiPhaser_setSub(MultiPhaser *self, PyObject *arg) { SET_SUB };
+static PyObject * MultiPhaser_setDiv(MultiPhaser *self, PyObject *arg) { SET_DIV };
+
+static PyObject * MultiPhaser_play(MultiPhaser *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * MultiPhaser_out(MultiPhaser *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * MultiPhaser_stop(MultiPhaser *self) { STOP };
+
+static PyObject * MultiPhaser_multiply(MultiPhaser *self, PyObject *arg) { MULTIPLY };
+static PyObject * MultiPhaser_inplace_multiply(MultiPhaser *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * MultiPhaser_add(MultiPhaser *self, PyObject *arg) { ADD };
+static PyObject * MultiPhaser_inplace_add(MultiPhaser *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * MultiPhaser_sub(MultiPhaser *self, PyObject *arg) { SUB };
+static PyObject * MultiPhaser_inplace_sub(MultiPhaser *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * MultiPhaser_div(MultiPhaser *self, PyObject *arg) { DIV };
+static PyObject * MultiPhaser_inplace_div(MultiPhaser *self, PyObject *arg) { INPLACE_DIV };
+
+static PyMemberDef MultiPhaser_members[] = {
+{"server", T_OBJECT_EX, offsetof(MultiPhaser, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(MultiPhaser, stream), 0, "Stream object."},
+{"mul", T_OBJECT_EX, offsetof(MultiPhaser, mul), 0, "Mul factor."},
+{"add", T_OBJECT_EX, offsetof(MultiPhaser, add), 0, "Add factor."},
+{NULL}  /* Sentinel */
+};
 
-static PyObject * Vocoder_play(Vocoder *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * Vocoder_out(Vocoder *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * Vocoder_stop(Vocoder *self) { STOP };
+static PyMethodDef MultiPhaser_methods[] = {
+{"getServer", (PyCFunction)MultiPhaser_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)MultiPhaser_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)MultiPhaser_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"out", (PyCFunction)MultiPhaser_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+{"stop", (PyCFunction)MultiPhaser_stop, METH_NOARGS, "Stops computing."},
+{"setMul", (PyCFunction)MultiPhaser_setMul, METH_O, "Sets MultiPhaser mul factor."},
+{"setAdd", (PyCFunction)MultiPhaser_setAdd, METH_O, "Sets MultiPhaser add factor."},
+{"setSub", (PyCFunction)MultiPhaser_setSub, METH_O, "Sets inverse add factor."},
+{"setDiv", (PyCFunction)MultiPhaser_setDiv, METH_O, "Sets inverse mul factor."},
+{NULL}  /* Sentinel */
+};
 
-static PyObject * Vocoder_multiply(Vocoder *self, PyObject *arg) { MULTIPLY };
-static PyObject * Vocoder_inplace_multiply(Vocoder *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * Vocoder_add(Vocoder *self, PyObject *arg) { ADD };
-static PyObject * Vocoder_inplace_add(Vocoder *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * Vocoder_sub(Vocoder *self, PyObject *arg) { SUB };
-static PyObject * Vocoder_inplace_sub(Vocoder *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * Vocoder_div(Vocoder *self, PyObject *arg) { DIV };
-static PyObject * Vocoder_inplace_div(Vocoder *self, PyObject *arg) { INPLACE_DIV };
+static PyNumberMethods MultiPhaser_as_number = {
+(binaryfunc)MultiPhaser_add,                      /*nb_add*/
+(binaryfunc)MultiPhaser_sub,                 /*nb_subtract*/
+(binaryfunc)MultiPhaser_multiply,                 /*nb_multiply*/
+(binaryfunc)MultiPhaser_div,                   /*nb_divide*/
+0,                /*nb_remainder*/
+0,                   /*nb_divmod*/
+0,                   /*nb_power*/
+0,                  /*nb_neg*/
+0,                /*nb_pos*/
+0,                  /*(unaryfunc)array_abs,*/
+0,                    /*nb_nonzero*/
+0,                    /*nb_invert*/
+0,               /*nb_lshift*/
+0,              /*nb_rshift*/
+0,              /*nb_and*/
+0,              /*nb_xor*/
+0,               /*nb_or*/
+0,                                          /*nb_coerce*/
+0,                       /*nb_int*/
+0,                      /*nb_long*/
+0,                     /*nb_float*/
+0,                       /*nb_oct*/
+0,                       /*nb_hex*/
+(binaryfunc)MultiPhaser_inplace_add,              /*inplace_add*/
+(binaryfunc)MultiPhaser_inplace_sub,         /*inplace_subtract*/
+(binaryfunc)MultiPhaser_inplace_multiply,         /*inplace_multiply*/
+(binaryfunc)MultiPhaser_inplace_div,           /*inplace_divide*/
+0,        /*inplace_remainder*/
+0,           /*inplace_power*/
+0,       /*inplace_lshift*/
+0,      /*inplace_rshift*/
+0,      /*inplace_and*/
+0,      /*inplace_xor*/
+0,       /*inplace_or*/
+0,             /*nb_floor_divide*/
+0,              /*nb_true_divide*/
+0,     /*nb_inplace_floor_divide*/
+0,      /*nb_inplace_true_divide*/
+0,                     /* nb_index */
+};
 
-static PyObject *
-Vocoder_setFreq(Vocoder *self, PyObject *arg)
+PyTypeObject MultiPhaserType = {
+PyObject_HEAD_INIT(NULL)
+0,                         /*ob_size*/
+"_pyo.MultiPhaser_base",         /*tp_name*/
+sizeof(MultiPhaser),         /*tp_basicsize*/
+0,                         /*tp_itemsize*/
+(destructor)MultiPhaser_dealloc, /*tp_dealloc*/
+0,                         /*tp_print*/
+0,                         /*tp_getattr*/
+0,                         /*tp_setattr*/
+0,                         /*tp_compare*/
+0,                         /*tp_repr*/
+&MultiPhaser_as_number,             /*tp_as_number*/
+0,                         /*tp_as_sequence*/
+0,                         /*tp_as_mapping*/
+0,                         /*tp_hash */
+0,                         /*tp_call*/
+0,                         /*tp_str*/
+0,                         /*tp_getattro*/
+0,                         /*tp_setattro*/
+0,                         /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"MultiPhaser objects. Reads one channel from a MultiPhaserMain object.",           /* tp_doc */
+(traverseproc)MultiPhaser_traverse,   /* tp_traverse */
+(inquiry)MultiPhaser_clear,           /* tp_clear */
+0,		               /* tp_richcompare */
+0,		               /* tp_weaklistoffset */
+0,		               /* tp_iter */
+0,		               /* tp_iternext */
+MultiPhaser_methods,             /* tp_methods */
+MultiPhaser_members,             /* tp_members */
+0,                      /* tp_getset */
+0,                         /* tp_base */
+0,                         /* tp_dict */
+0,                         /* tp_descr_get */
+0,                         /* tp_descr_set */
+0,                         /* tp_dictoffset */
+0,      /* tp_init */
+0,                         /* tp_alloc */
+MultiPhaser_new,                 /* tp_new */
+};
+
+/* Bands are filtered by tasks of VOCODER_TASK_BANDS bands, spread over the
+** server's worker threads. */
+#define VOCODER_TASK_BANDS 8
+
+/* Number of overlaps of the fft mode, with an Hanning window. */
+#define VOCODER_FFT_OLAPS 4
+
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream *input_stream;
+    PyObject *input2;
+    Stream *input2_stream;
+    PyObject *freq;
+    Stream *freq_stream;
+    PyObject *spread;
+    Stream *spread_stream;
+    PyObject *q;
+    Stream *q_stream;
+    PyObject *slope;
+    Stream *slope_stream;
+    MYFLT last_freq;
+    MYFLT last_spread;
+    MYFLT last_q;
+    MYFLT last_slope;
+    MYFLT factor;
+    int stages;
+    int last_stages;
+    int flag;
+    MYFLT nyquist;
+    MYFLT twoPiOnSr;
+    int modebuffer[6]; // need at least 2 slots for mul & add
+    // sample memories
+    MYFLT *y1;
+    MYFLT *y2;
+    MYFLT *yy1;
+    MYFLT *yy2;
+    // follower memories
+    MYFLT *follow;
+    // coefficients
+    MYFLT *b0;
+    MYFLT *b2;
+    MYFLT *a0;
+    MYFLT *a1;
+    MYFLT *a2;
+    MYFLT *taskbuffers; /* outputs of the tasks 1 to ntasks - 1 */
+    /* fft mode */
+    int mode; /* 0 = filters, 1 = fft */
+    int size;
+    int hsize;
+    int hopsize;
+    int incount;
+    int inputLatency;
+    MYFLT hopfactor; /* follower coefficient, per hop */
+    MYFLT envscl;
+    MYFLT olascl;
+    MYFLT *inbuf;
+    MYFLT *inbuf2;
+    MYFLT *frame;
+    MYFLT *spec;
+    MYFLT *outbuf;
+    MYFLT *outaccum;
+    MYFLT *window;
+    MYFLT **twiddle;
+    int *binband; /* band of each bin */
+    MYFLT *binweight; /* response of its band at each bin */
+    MYFLT *bandcenter;
+    MYFLT *bandenv;
+    MYFLT *bandsum;
+} Vocoder;
+
+static void
+Vocoder_allocate_memories(Vocoder *self)
 {
-	PyObject *tmp, *streamtmp;
+    int i, i2j, j;
+    self->y1 = (MYFLT *)realloc(self->y1, self->stages * 2 *  sizeof(MYFLT));
+    self->y2 = (MYFLT *)realloc(self->y2, self->stages * 2 *  sizeof(MYFLT));
+    self->yy1 = (MYFLT *)realloc(self->yy1, self->stages * 2 *  sizeof(MYFLT));
+    self->yy2 = (MYFLT *)realloc(self->yy2, self->stages * 2 *  sizeof(MYFLT));
+    self->b0 = (MYFLT *)realloc(self->b0, self->stages *  sizeof(MYFLT));
+    self->b2 = (MYFLT *)realloc(self->b2, self->stages *  sizeof(MYFLT));
+    self->a0 = (MYFLT *)realloc(self->a0, self->stages *  sizeof(MYFLT));
+    self->a1 = (MYFLT *)realloc(self->a1, self->stages *  sizeof(MYFLT));
+    self->a2 = (MYFLT *)realloc(self->a2, self->stages *  sizeof(MYFLT));
+    self->follow = (MYFLT *)realloc(self->follow, self->stages *  sizeof(MYFLT));
+    self->bandcenter = (MYFLT *)realloc(self->bandcenter, self->stages *  sizeof(MYFLT));
+    self->bandenv = (MYFLT *)realloc(self->bandenv, self->stages *  sizeof(MYFLT));
+    self->bandsum = (MYFLT *)realloc(self->bandsum, self->stages *  sizeof(MYFLT));
+    self->taskbuffers = (MYFLT *)realloc(self->taskbuffers, ((self->stages - 1) / VOCODER_TASK_BANDS * self->bufsize + 1) * sizeof(MYFLT));
+    Server_prefaultMemory((Server *)self->server, self->taskbuffers, ((self->stages - 1) / VOCODER_TASK_BANDS * self->bufsize + 1) * sizeof(MYFLT));
+    for (i=0; i<self->stages; i++) {
+        self->b0[i] = self->b2[i] = self->a0[i] = self->a1[i] = self->a2[i] = self->follow[i] = 0.0;
+        self->bandcenter[i] = self->bandenv[i] = self->bandsum[i] = 0.0;
+        for (j=0; j<2; j++) {
+            i2j = i * 2 + j;
+            self->yy1[i2j] = self->yy2[i2j] = self->y1[i2j] = self->y2[i2j] = 0.0;
+        }
+    }
+    self->flag = 1;
+}
 
-	if (arg == NULL) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
+/* Buffers of the fft mode, allocated when the mode is first used. */
+static void
+Vocoder_allocate_fft_memories(Vocoder *self)
+{
+    int i, n8;
+    MYFLT sumsq = 0.0;
+
+    if (self->twiddle != NULL) {
+        for (i=0; i<4; i++)
+            free(self->twiddle[i]);
+    }
+    self->hsize = self->size / 2;
+    self->hopsize = self->size / VOCODER_FFT_OLAPS;
+    self->inputLatency = self->size - self->hopsize;
+    self->incount = self->inputLatency;
+    n8 = self->size >> 3;
+    self->inbuf = (MYFLT *)realloc(self->inbuf, self->size * sizeof(MYFLT));
+    self->inbuf2 = (MYFLT *)realloc(self->inbuf2, self->size * sizeof(MYFLT));
+    self->frame = (MYFLT *)realloc(self->frame, self->size * sizeof(MYFLT));
+    self->spec = (MYFLT *)realloc(self->spec, self->size * sizeof(MYFLT));
+    self->outbuf = (MYFLT *)realloc(self->outbuf, self->hopsize * sizeof(MYFLT));
+    self->outaccum = (MYFLT *)realloc(self->outaccum, (self->size + self->hopsize) * sizeof(MYFLT));
+    self->binband = (int *)realloc(self->binband, self->hsize * sizeof(int));
+    self->binweight = (MYFLT *)realloc(self->binweight, self->hsize * sizeof(MYFLT));
+    for (i=0; i<self->size; i++)
+        self->inbuf[i] = self->inbuf2[i] = self->frame[i] = self->spec[i] = 0.0;
+    for (i=0; i<self->hopsize; i++)
+        self->outbuf[i] = 0.0;
+    for (i=0; i<(self->size + self->hopsize); i++)
+        self->outaccum[i] = 0.0;
+    for (i=0; i<self->hsize; i++) {
+        self->binband[i] = 0;
+        self->binweight[i] = 0.0;
+    }
+    for (i=0; i<self->stages; i++)
+        self->bandenv[i] = 0.0;
+    self->twiddle = (MYFLT **)realloc(self->twiddle, 4 * sizeof(MYFLT *));
+    for (i=0; i<4; i++)
+        self->twiddle[i] = (MYFLT *)malloc(n8 * sizeof(MYFLT));
+    fft_compute_split_twiddle(self->twiddle, self->size);
+    self->window = (MYFLT *)realloc(self->window, self->size * sizeof(MYFLT));
+    gen_window(self->window, self->size, 2);
+    for (i=0; i<self->size; i++)
+        sumsq += self->window[i] * self->window[i];
+    /* A sine of amplitude A centered in a band gives an envelope of A. */
+    self->envscl = 2.0 * MYSQRT(self->size / sumsq);
+    /* Unity gain of the windowed overlap-add. */
+    self->olascl = self->hopsize / sumsq;
+    self->last_slope = -1.0;
+    self->flag = 1;
+}
 
-	int isNumber = PyNumber_Check(arg);
+static void
+Vocoder_compute_variables(Vocoder *self, MYFLT base, MYFLT spread, MYFLT q)
+{
+    int i;
+    MYFLT w0, c, alpha, freq, invqfac;
 
-	tmp = arg;
-	Py_INCREF(tmp);
-	Py_DECREF(self->freq);
-	if (isNumber == 1) {
-		self->freq = PyNumber_Float(tmp);
-        self->modebuffer[2] = 0;
-	}
-	else {
-		self->freq = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->freq, "_getStream", NULL);
-        Py_INCREF(streamtmp);
-        Py_XDECREF(self->freq_stream);
-        self->freq_stream = (Stream *)streamtmp;
-		self->modebuffer[2] = 1;
-	}
+    invqfac = 1.0 / (2.0 * q);
 
-    (*self->mode_func_ptr)(self);
+    for (i=0; i<self->stages; i++) {
+        freq = base * MYPOW(i+1, spread);
+        if (freq <= 10)
+            freq = 10.0;
+        else if (freq >= self->nyquist)
+            freq = self->nyquist;
 
-	Py_INCREF(Py_None);
-	return Py_None;
+        w0 = self->twoPiOnSr * freq;
+        c = MYCOS(w0);
+        alpha = MYSIN(w0) * invqfac;
+        self->b0[i] = alpha;
+        self->b2[i] = -alpha;
+        self->a0[i] = 1.0 / (1.0 + alpha); /* Inversed to multiply */
+        self->a1[i] = -2.0 * c;
+        self->a2[i] = 1.0 - alpha;
+    }
 }
 
-static PyObject *
-Vocoder_setSpread(Vocoder *self, PyObject *arg)
+/* fft mode. Each bin belongs to the band with the nearest center, in log
+** frequency, and is weighted by the response of the band's two filters. The
+** cost of a frame is proportional to the number of bins, not of bands. */
+static void
+Vocoder_compute_bins(Vocoder *self, MYFLT base, MYFLT spread, MYFLT q)
 {
-	PyObject *tmp, *streamtmp;
+    int j, k, p, step, last;
+    MYFLT f, fc, x, freq, binfreq = self->sr / self->size;
 
-	if (arg == NULL) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
+    for (j=0; j<self->stages; j++) {
+        freq = base * MYPOW(j+1, spread);
+        if (freq <= 10)
+            freq = 10.0;
+        else if (freq >= self->nyquist)
+            freq = self->nyquist;
+        self->bandcenter[j] = freq;
+    }
 
-	int isNumber = PyNumber_Check(arg);
+    /* Centers are monotonic, they are walked in increasing order. */
+    if (self->bandcenter[self->stages-1] < self->bandcenter[0]) {
+        p = self->stages - 1;
+        step = -1;
+        last = 0;
+    }
+    else {
+        p = 0;
+        step = 1;
+        last = self->stages - 1;
+    }
 
-	tmp = arg;
-	Py_INCREF(tmp);
-	Py_DECREF(self->spread);
-	if (isNumber == 1) {
-		self->spread = PyNumber_Float(tmp);
-        self->modebuffer[3] = 0;
-	}
-	else {
-		self->spread = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->spread, "_getStream", NULL);
-        Py_INCREF(streamtmp);
-        Py_XDECREF(self->spread_stream);
-        self->spread_stream = (Stream *)streamtmp;
-		self->modebuffer[3] = 1;
-	}
+    self->binband[0] = p;
+    self->binweight[0] = 0.0;
+    for (k=1; k<self->hsize; k++) {
+        f = k * binfreq;
+        while (p != last && f * f >= self->bandcenter[p] * self->bandcenter[p+step])
+            p += step;
+        fc = self->bandcenter[p];
+        x = q * (f / fc - fc / f);
+        self->binband[k] = p;
+        self->binweight[k] = 1.0 / (1.0 + x * x);
+    }
+}
 
-    (*self->mode_func_ptr)(self);
+/* Filters the bands [task * VOCODER_TASK_BANDS, ...] in the task's own buffer.
+** The bands are independent, each one is run over the whole buffer. */
+static void
+Vocoder_task(void *data, int task) {
+    Vocoder *self = (Vocoder *)data;
+    int i, j, j2, start, end;
+    MYFLT vout, vout2, w, w2, b0, b2, a0, a1, a2, follow, *out;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
 
-	Py_INCREF(Py_None);
-	return Py_None;
-}
+    start = task * VOCODER_TASK_BANDS;
+    end = start + VOCODER_TASK_BANDS;
+    if (end > self->stages)
+        end = self->stages;
+    out = task == 0 ? self->data : &self->taskbuffers[(task - 1) * self->bufsize];
 
-static PyObject *
-Vocoder_setQ(Vocoder *self, PyObject *arg)
-{
-	PyObject *tmp, *streamtmp;
+    for (i=0; i<self->bufsize; i++) {
+        out[i] = 0.0;
+    }
 
-	if (arg == NULL) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
+    for (j=start; j<end; j++) {
+        j2 = j * 2;
+        b0 = self->b0[j]; b2 = self->b2[j]; a0 = self->a0[j]; a1 = self->a1[j]; a2 = self->a2[j];
+        follow = self->follow[j];
+        for (i=0; i<self->bufsize; i++) {
+            /* Analysis part filter 1 */
+            w = ( in[i] - (a1 * self->y1[j2]) - (a2 * self->y2[j2]) )  * a0;
+            vout = (b0 * w) + (b2 * self->y2[j2]);
+            self->y2[j2] = self->y1[j2];
+            self->y1[j2] = w;
 
-	int isNumber = PyNumber_Check(arg);
+            /* Exciter part filter 1 */
+            w2 = ( in2[i] - (a1 * self->yy1[j2]) - (a2 * self->yy2[j2]) ) * a0;
+            vout2 = (b0 * w2) + (b2 * self->yy2[j2]);
+            self->yy2[j2] = self->yy1[j2];
+            self->yy1[j2] = w2;
 
-	tmp = arg;
-	Py_INCREF(tmp);
-	Py_DECREF(self->q);
-	if (isNumber == 1) {
-		self->q = PyNumber_Float(tmp);
-        self->modebuffer[4] = 0;
-	}
-	else {
-		self->q = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->q, "_getStream", NULL);
-        Py_INCREF(streamtmp);
-        Py_XDECREF(self->q_stream);
-        self->q_stream = (Stream *)streamtmp;
-		self->modebuffer[4] = 1;
-	}
+            /* Analysis part filter 2 */
+            w = ( vout - (a1 * self->y1[j2+1]) - (a2 * self->y2[j2+1]) ) * a0;
+            vout = (b0 * w) + (b2 * self->y2[j2+1]);
+            self->y2[j2+1] = self->y1[j2+1];
+            self->y1[j2+1] = w;
 
-    (*self->mode_func_ptr)(self);
+            /* Exciter part filter 2 */
+            w2 = ( vout2 - (a1 * self->yy1[j2+1]) - (a2 * self->yy2[j2+1]) ) * a0;
+            vout2 = (b0 * w2) + (b2 * self->yy2[j2+1]);
+            self->yy2[j2+1] = self->yy1[j2+1];
+            self->yy1[j2+1] = w2;
 
-	Py_INCREF(Py_None);
-	return Py_None;
+            /* Follower */
+            if (vout < 0.0)
+                vout = -vout;
+            follow = vout + self->factor * (follow - vout);
+            out[i] += vout2 * follow;
+        }
+        self->follow[j] = follow;
+    }
 }
 
-static PyObject *
-Vocoder_setSlope(Vocoder *self, PyObject *arg)
-{
-	PyObject *tmp, *streamtmp;
+/* Audio rate parameters are sampled once per buffer, at the first sample.
+** Updates the filters (or the bins, in fft mode) if needed and returns q. */
+static MYFLT
+Vocoder_update(Vocoder *self) {
+    MYFLT freq, spread, q, slope;
 
-	if (arg == NULL) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
+    if (self->modebuffer[2] == 0)
+        freq = PyFloat_AS_DOUBLE(self->freq);
+    else
+        freq = Stream_getData((Stream *)self->freq_stream)[0];
+    if (self->modebuffer[3] == 0)
+        spread = PyFloat_AS_DOUBLE(self->spread);
+    else
+        spread = Stream_getData((Stream *)self->spread_stream)[0];
+    if (self->modebuffer[4] == 0)
+        q = PyFloat_AS_DOUBLE(self->q);
+    else
+        q = Stream_getData((Stream *)self->q_stream)[0];
+    if (q < 0.1)
+        q = 0.1;
 
-	int isNumber = PyNumber_Check(arg);
+    if (self->modebuffer[5] == 0)
+        slope = PyFloat_AS_DOUBLE(self->slope);
+    else
+        slope = Stream_getData((Stream *)self->slope_stream)[0];
+    if (slope < 0.0)
+        slope = 0.0;
+    else if (slope > 1.0)
+        slope = 1.0;
+    if (slope != self->last_slope) {
+        self->last_slope = slope;
+        /* Historical follower cutoffs: 1 to 100 Hz when freq, spread and q
+        ** are all audio rate, 2 to 50 Hz otherwise. */
+        if (self->modebuffer[2] && self->modebuffer[3] && self->modebuffer[4])
+            self->factor = MYEXP(-1.0 / (self->sr / ((slope * 99.0) + 1.0)));
+        else
+            self->factor = MYEXP(-1.0 / (self->sr / ((slope * 48.0) + 2.0)));
+        self->hopfactor = MYPOW(self->factor, self->hopsize);
+    }
 
-	tmp = arg;
-	Py_INCREF(tmp);
-	Py_DECREF(self->slope);
-	if (isNumber == 1) {
-		self->slope = PyNumber_Float(tmp);
-        self->modebuffer[5] = 0;
-	}
-	else {
-		self->slope = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->slope, "_getStream", NULL);
-        Py_INCREF(streamtmp);
-        Py_XDECREF(self->slope_stream);
-        self->slope_stream = (Stream *)streamtmp;
-		self->modebuffer[5] = 1;
-	}
+    if (freq != self->last_freq || spread != self->last_spread || q != self->last_q || self->stages != self->last_stages || self->flag) {
+        self->last_freq = freq;
+        self->last_spread = spread;
+        self->last_q = q;
+        self->last_stages = self->stages;
+        self->flag = 0;
+        if (self->mode == 0)
+            Vocoder_compute_variables(self, freq, spread, q);
+        else
+            Vocoder_compute_bins(self, freq, spread, q);
+    }
 
-    (*self->mode_func_ptr)(self);
+    return q;
+}
 
-	Py_INCREF(Py_None);
-	return Py_None;
+static void
+Vocoder_filters(Vocoder *self) {
+    int i, j, ntasks;
+    MYFLT amp, *buf;
+
+    amp = Vocoder_update(self) * 10.0;
+
+    ntasks = (self->stages + VOCODER_TASK_BANDS - 1) / VOCODER_TASK_BANDS;
+    TaskPool_run(Server_getTaskPool((Server *)self->server), Vocoder_task, self, ntasks);
+
+    /* Reduction in task order, the result doesn't depend on the threads. */
+    for (j=1; j<ntasks; j++) {
+        buf = &self->taskbuffers[(j - 1) * self->bufsize];
+        for (i=0; i<self->bufsize; i++) {
+            self->data[i] += buf[i];
+        }
+    }
+    for (i=0; i<self->bufsize; i++) {
+        self->data[i] *= amp;
+    }
 }
 
-static PyObject *
-Vocoder_setStages(Vocoder *self, PyObject *arg)
-{
+/* Computes one frame: band envelopes from the modulator's spectrum, smoothed
+** like the followers, applied to the exciter's spectrum, then overlap-add. */
+static void
+Vocoder_fft_frame(Vocoder *self) {
+    int j, k, size = self->size, hsize = self->hsize, hopsize = self->hopsize;
+    MYFLT re, im, w, e, g;
 
-	if (arg == NULL) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
+    for (k=0; k<size; k++)
+        self->frame[k] = self->inbuf[k] * self->window[k];
+    realfft_split(self->frame, self->spec, size, self->twiddle);
+    for (j=0; j<self->stages; j++)
+        self->bandsum[j] = 0.0;
+    for (k=1; k<hsize; k++) {
+        re = self->spec[k];
+        im = self->spec[size - k];
+        w = self->binweight[k];
+        self->bandsum[self->binband[k]] += w * w * (re * re + im * im);
+    }
+    for (j=0; j<self->stages; j++) {
+        e = MYSQRT(self->bandsum[j]) * self->envscl;
+        self->bandenv[j] = e + self->hopfactor * (self->bandenv[j] - e);
+    }
 
-	int isInt = PyInt_Check(arg);
+    for (k=0; k<size; k++)
+        self->frame[k] = self->inbuf2[k] * self->window[k];
+    realfft_split(self->frame, self->spec, size, self->twiddle);
+    self->spec[0] = self->spec[hsize] = 0.0;
+    for (k=1; k<hsize; k++) {
+        g = self->binweight[k] * self->bandenv[self->binband[k]];
+        self->spec[k] *= g;
+        self->spec[size - k] *= g;
+    }
+    irealfft_split(self->spec, self->frame, size, self->twiddle);
 
-	if (isInt == 1) {
-		self->stages = PyInt_AsLong(arg);
-        Vocoder_allocate_memories(self);
-	}
+    for (k=0; k<size; k++)
+        self->outaccum[k] += self->frame[k] * self->window[k] * self->olascl;
+    for (k=0; k<hopsize; k++)
+        self->outbuf[k] = self->outaccum[k];
+    for (k=0; k<size; k++)
+        self->outaccum[k] = self->outaccum[k + hopsize];
+    for (k=0; k<self->inputLatency; k++) {
+        self->inbuf[k] = self->inbuf[k + hopsize];
+        self->inbuf2[k] = self->inbuf2[k + hopsize];
+    }
+}
 
-	Py_INCREF(Py_None);
-	return Py_None;
+/* The output is delayed by size - size / VOCODER_FFT_OLAPS samples. */
+static void
+Vocoder_fft(Vocoder *self) {
+    int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *in2 = Stream_getData((Stream *)self->input2_stream);
+
+    Vocoder_update(self);
+
+    for (i=0; i<self->bufsize; i++) {
+        self->inbuf[self->incount] = in[i];
+        self->inbuf2[self->incount] = in2[i];
+        self->data[i] = self->outbuf[self->incount - self->inputLatency];
+        self->incount++;
+        if (self->incount >= self->size) {
+            self->incount = self->inputLatency;
+            Vocoder_fft_frame(self);
+        }
+    }
 }
 
-static PyMemberDef Vocoder_members[] = {
-    {"server", T_OBJECT_EX, offsetof(Vocoder, server), 0, "Pyo server."},
-    {"stream", T_OBJECT_EX, offsetof(Vocoder, stream), 0, "Stream object."},
-    {"input", T_OBJECT_EX, offsetof(Vocoder, input), 0, "Spectral envelope signal."},
-    {"input2", T_OBJECT_EX, offsetof(Vocoder, input2), 0, "Exciter signal."},
-    {"freq", T_OBJECT_EX, offsetof(Vocoder, freq), 0, "Base frequency in cycle per second."},
-    {"spread", T_OBJECT_EX, offsetof(Vocoder, spread), 0, "Frequency expansion factor."},
-    {"q", T_OBJECT_EX, offsetof(Vocoder, q), 0, "Q factor."},
-    {"slope", T_OBJECT_EX, offsetof(Vocoder, slope), 0, "Responsiveness of the follower lowpass filter."},
-    {"mul", T_OBJECT_EX, offsetof(Vocoder, mul), 0, "Mul factor."},
-    {"add", T_OBJECT_EX, offsetof(Vocoder, add), 0, "Add factor."},
-    {NULL}  /* Sentinel */
-};
+static void Vocoder_postprocessing_ii(Vocoder *self) { POST_PROCESSING_II };
+static void Vocoder_postprocessing_ai(Vocoder *self) { POST_PROCESSING_AI };
+static void Vocoder_postprocessing_ia(Vocoder *self) { POST_PROCESSING_IA };
+static void Vocoder_postprocessing_aa(Vocoder *self) { POST_PROCESSING_AA };
+static void Vocoder_postprocessing_ireva(Vocoder *self) { POST_PROCESSING_IREVA };
+static void Vocoder_postprocessing_areva(Vocoder *self) { POST_PROCESSING_AREVA };
+static void Vocoder_postprocessing_revai(Vocoder *self) { POST_PROCESSING_REVAI };
+static void Vocoder_postprocessing_revaa(Vocoder *self) { POST_PROCESSING_REVAA };
+static void Vocoder_postprocessing_revareva(Vocoder *self) { POST_PROCESSING_REVAREVA };
 
-static PyMethodDef Vocoder_methods[] = {
-    {"getServer", (PyCFunction)Vocoder_getServer, METH_NOARGS, "Returns server object."},
-    {"_getStream", (PyCFunction)Vocoder_getStream, METH_NOARGS, "Returns stream object."},
-    {"play", (PyCFunction)Vocoder_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-    {"out", (PyCFunction)Vocoder_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-    {"stop", (PyCFunction)Vocoder_stop, METH_NOARGS, "Stops computing."},
-	{"setFreq", (PyCFunction)Vocoder_setFreq, METH_O, "Sets filter base frequency in cycle per second."},
-	{"setSpread", (PyCFunction)Vocoder_setSpread, METH_O, "Sets frequency expansion factor."},
-    {"setQ", (PyCFunction)Vocoder_setQ, METH_O, "Sets filter Q factor."},
-    {"setSlope", (PyCFunction)Vocoder_setSlope, METH_O, "Sets responsiveness of the follower."},
-    {"setStages", (PyCFunction)Vocoder_setStages, METH_O, "Sets the number of filtering stages."},
-	{"setMul", (PyCFunction)Vocoder_setMul, METH_O, "Sets oscillator mul factor."},
-	{"setAdd", (PyCFunction)Vocoder_setAdd, METH_O, "Sets oscillator add factor."},
-    {"setSub", (PyCFunction)Vocoder_setSub, METH_O, "Sets inverse add factor."},
-    {"setDiv", (PyCFunction)Vocoder_setDiv, METH_O, "Sets inverse mul factor."},
-    {NULL}  /* Sentinel */
-};
+static void
+Vocoder_setProcMode(Vocoder *self)
+{
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
 
-static PyNumberMethods Vocoder_as_number = {
-    (binaryfunc)Vocoder_add,                         /*nb_add*/
-    (binaryfunc)Vocoder_sub,                         /*nb_subtract*/
-    (binaryfunc)Vocoder_multiply,                    /*nb_multiply*/
-    (binaryfunc)Vocoder_div,                                              /*nb_divide*/
-    0,                                              /*nb_remainder*/
-    0,                                              /*nb_divmod*/
-    0,                                              /*nb_power*/
-    0,                                              /*nb_neg*/
-    0,                                              /*nb_pos*/
-    0,                                              /*(unaryfunc)array_abs,*/
-    0,                                              /*nb_nonzero*/
-    0,                                              /*nb_invert*/
-    0,                                              /*nb_lshift*/
-    0,                                              /*nb_rshift*/
-    0,                                              /*nb_and*/
-    0,                                              /*nb_xor*/
-    0,                                              /*nb_or*/
-    0,                                              /*nb_coerce*/
-    0,                                              /*nb_int*/
-    0,                                              /*nb_long*/
-    0,                                              /*nb_float*/
-    0,                                              /*nb_oct*/
-    0,                                              /*nb_hex*/
-    (binaryfunc)Vocoder_inplace_add,                 /*inplace_add*/
-    (binaryfunc)Vocoder_inplace_sub,                 /*inplace_subtract*/
-    (binaryfunc)Vocoder_inplace_multiply,            /*inplace_multiply*/
-    (binaryfunc)Vocoder_inplace_div,                                              /*inplace_divide*/
-    0,                                              /*inplace_remainder*/
-    0,                                              /*inplace_power*/
-    0,                                              /*inplace_lshift*/
-    0,                                              /*inplace_rshift*/
-    0,                                              /*inplace_and*/
-    0,                                              /*inplace_xor*/
-    0,                                              /*inplace_or*/
-    0,                                              /*nb_floor_divide*/
-    0,                                              /*nb_true_divide*/
-    0,                                              /*nb_inplace_floor_divide*/
-    0,                                              /*nb_inplace_true_divide*/
-    0,                                              /* nb_index */
-};
+    if (self->mode == 0)
+        self->proc_func_ptr = Vocoder_filters;
+    else
+        self->proc_func_ptr = Vocoder_fft;
 
-PyTypeObject VocoderType = {
-    PyObject_HEAD_INIT(NULL)
-    0,                                              /*ob_size*/
-    "_pyo.Vocoder_base",                                   /*tp_name*/
-    sizeof(Vocoder),                                 /*tp_basicsize*/
-    0,                                              /*tp_itemsize*/
-    (destructor)Vocoder_dealloc,                     /*tp_dealloc*/
-    0,                                              /*tp_print*/
-    0,                                              /*tp_getattr*/
-    0,                                              /*tp_setattr*/
-    0,                                              /*tp_compare*/
-    0,                                              /*tp_repr*/
-    &Vocoder_as_number,                              /*tp_as_number*/
-    0,                                              /*tp_as_sequence*/
-    0,                                              /*tp_as_mapping*/
-    0,                                              /*tp_hash */
-    0,                                              /*tp_call*/
-    0,                                              /*tp_str*/
-    0,                                              /*tp_getattro*/
-    0,                                              /*tp_setattro*/
-    0,                                              /*tp_as_buffer*/
-    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-    "Vocoder objects. Bank of bandpass filters implementing the vocoder effect.",           /* tp_doc */
-    (traverseproc)Vocoder_traverse,                  /* tp_traverse */
-    (inquiry)Vocoder_clear,                          /* tp_clear */
-    0,                                              /* tp_richcompare */
-    0,                                              /* tp_weaklistoffset */
-    0,                                              /* tp_iter */
-    0,                                              /* tp_iternext */
-    Vocoder_methods,                                 /* tp_methods */
-    Vocoder_members,                                 /* tp_members */
-    0,                                              /* tp_getset */
-    0,                                              /* tp_base */
-    0,                                              /* tp_dict */
-    0,                                              /* tp_descr_get */
-    0,                                              /* tp_descr_set */
-    0,                                              /* tp_dictoffset */
-    0,                          /* tp_init */
-    0,                                              /* tp_alloc */
-    Vocoder_new,                                     /* tp_new */
-};
-
-typedef struct {
-    pyo_audio_HEAD
-    PyObject *input;
-    Stream *input_stream;
-    PyObject *freq;
-    Stream *freq_stream;
-    PyObject *q;
-    Stream *q_stream;
-    PyObject *type;
-    Stream *type_stream;
-    int modebuffer[5]; // need at least 2 slots for mul & add
-    MYFLT srOverSix;
-    MYFLT last_freq;
-    MYFLT piOverSr;
-    // sample memories
-    MYFLT y1;
-    MYFLT y2;
-    MYFLT y3;
-    MYFLT y4;
-    // variables
-    MYFLT w;
-} SVF;
-
-static void
-SVF_filters_iii(SVF *self) {
-    int i;
-    MYFLT val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    freq = PyFloat_AS_DOUBLE(self->freq);
-    q = PyFloat_AS_DOUBLE(self->q);
-    type = PyFloat_AS_DOUBLE(self->type);
-
-    if (freq < 0.1)
-        freq = 0.1;
-    else if (freq > self->srOverSix)
-        freq = self->srOverSix;
+    /* The follower's cutoff depends on the rate of freq, spread and q. */
+    self->last_slope = -1.0;
 
-    if (freq != self->last_freq) {
-        self->last_freq = freq;
-        self->w = 2.0 * MYSIN(freq * self->piOverSr);
+    switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = Vocoder_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = Vocoder_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = Vocoder_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = Vocoder_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = Vocoder_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = Vocoder_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = Vocoder_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = Vocoder_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = Vocoder_postprocessing_revareva;
+            break;
     }
+}
 
-    if (q < 0.5)
-        q = 0.5;
-    q1 = 1.0 / q;
+static void
+Vocoder_compute_next_data_frame(Vocoder *self)
+{
+    (*self->proc_func_ptr)(self);
+    (*self->muladd_func_ptr)(self);
+}
 
-    if (type < 0.0)
-        type = 0.0;
-    else if (type > 1.0)
-        type = 1.0;
+static int
+Vocoder_traverse(Vocoder *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->input);
+    Py_VISIT(self->input_stream);
+    Py_VISIT(self->input2);
+    Py_VISIT(self->input2_stream);
+    Py_VISIT(self->freq);
+    Py_VISIT(self->freq_stream);
+    Py_VISIT(self->spread);
+    Py_VISIT(self->spread_stream);
+    Py_VISIT(self->q);
+    Py_VISIT(self->q_stream);
+    Py_VISIT(self->slope);
+    Py_VISIT(self->slope_stream);
+    return 0;
+}
 
-    lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
-    highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
-    bandgain = (type <= 0.5) ? type : (1.0 - type);
-    for (i=0; i<self->bufsize; i++) {
-        low = self->y2 + self->w * self->y1;
-        high = in[i] - low - q1 * self->y1;
-        band = self->w * high + self->y1;
-        self->y1 = band;
-        self->y2 = low;
-        val = low * lowgain + high * highgain + band * bandgain;
-        low = self->y4 + self->w * self->y3;
-        high = val - low - q1 * self->y3;
-        band = self->w * high + self->y3;
-        self->y3 = band;
-        self->y4 = low;
-        self->data[i] = low * lowgain + high * highgain + band * bandgain;
-    }
+static int
+Vocoder_clear(Vocoder *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->input);
+    Py_CLEAR(self->input_stream);
+    Py_CLEAR(self->input2);
+    Py_CLEAR(self->input2_stream);
+    Py_CLEAR(self->freq);
+    Py_CLEAR(self->freq_stream);
+    Py_CLEAR(self->spread);
+    Py_CLEAR(self->spread_stream);
+    Py_CLEAR(self->q);
+    Py_CLEAR(self->q_stream);
+    Py_CLEAR(self->slope);
+    Py_CLEAR(self->slope_stream);
+    return 0;
 }
 
 static void
-SVF_filters_aii(SVF *self) {
+Vocoder_dealloc(Vocoder* self)
+{
     int i;
-    MYFLT val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    q = PyFloat_AS_DOUBLE(self->q);
-    type = PyFloat_AS_DOUBLE(self->type);
+    pyo_DEALLOC
+    free(self->y1);
+    free(self->y2);
+    free(self->yy1);
+    free(self->yy2);
+    free(self->b0);
+    free(self->b2);
+    free(self->a0);
+    free(self->a1);
+    free(self->a2);
+    free(self->follow);
+    free(self->taskbuffers);
+    free(self->bandcenter);
+    free(self->bandenv);
+    free(self->bandsum);
+    free(self->inbuf);
+    free(self->inbuf2);
+    free(self->frame);
+    free(self->spec);
+    free(self->outbuf);
+    free(self->outaccum);
+    free(self->window);
+    free(self->binband);
+    free(self->binweight);
+    if (self->twiddle != NULL) {
+        for (i=0; i<4; i++)
+            free(self->twiddle[i]);
+        free(self->twiddle);
+    }
+    Vocoder_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
 
-    if (q < 0.5)
-        q = 0.5;
-    q1 = 1.0 / q;
+/* FFT sizes are powers-of-two between 64 and 16384. */
+static int
+Vocoder_check_size(int size)
+{
+    int k = 64;
+    while (k < size && k < 16384)
+        k *= 2;
+    return k;
+}
 
-    if (type < 0.0)
-        type = 0.0;
-    else if (type > 1.0)
-        type = 1.0;
+static PyObject *
+Vocoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *inputtmp, *input_streamtmp, *input2tmp, *input2_streamtmp, *freqtmp=NULL, *spreadtmp=NULL, *qtmp=NULL, *slopetmp=NULL, *multmp=NULL, *addtmp=NULL;
+    Vocoder *self;
+    self = (Vocoder *)type->tp_alloc(type, 0);
 
-    lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
-    highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
-    bandgain = (type <= 0.5) ? type : (1.0 - type);
-    for (i=0; i<self->bufsize; i++) {
-        freq = fr[i];
-        if (freq < 0.1)
-            freq = 0.1;
-        else if (freq > self->srOverSix)
-            freq = self->srOverSix;
+    self->freq = PyFloat_FromDouble(60);
+    self->spread = PyFloat_FromDouble(1.25);
+    self->q = PyFloat_FromDouble(20);
+    self->slope = PyFloat_FromDouble(0.5);
+    self->last_freq = self->last_spread = self->last_q = self->last_slope = -1.0;
+    self->factor = 0.99;
+    self->stages = 24;
+    self->last_stages = -1;
+    self->flag = 0;
+    self->mode = 0;
+    self->size = 1024;
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+	self->modebuffer[2] = 0;
+	self->modebuffer[3] = 0;
+	self->modebuffer[4] = 0;
+	self->modebuffer[5] = 0;
 
-        if (freq != self->last_freq) {
-            self->last_freq = freq;
-            self->w = 2.0 * MYSIN(freq * self->piOverSr);
-        }
-        low = self->y2 + self->w * self->y1;
-        high = in[i] - low - q1 * self->y1;
-        band = self->w * high + self->y1;
-        self->y1 = band;
-        self->y2 = low;
-        val = low * lowgain + high * highgain + band * bandgain;
-        low = self->y4 + self->w * self->y3;
-        high = val - low - q1 * self->y3;
-        band = self->w * high + self->y3;
-        self->y3 = band;
-        self->y4 = low;
-        self->data[i] = low * lowgain + high * highgain + band * bandgain;
-    }
-}
+    INIT_OBJECT_COMMON
 
-static void
-SVF_filters_iai(SVF *self) {
-    int i;
-    MYFLT val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    freq = PyFloat_AS_DOUBLE(self->freq);
-    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
-    type = PyFloat_AS_DOUBLE(self->type);
+    self->nyquist = (MYFLT)self->sr * 0.49;
+    self->twoPiOnSr = (MYFLT)(TWOPI / self->sr);
 
-    if (freq < 0.1)
-        freq = 0.1;
-    else if (freq > self->srOverSix)
-        freq = self->srOverSix;
+    Stream_setFunctionPtr(self->stream, Vocoder_compute_next_data_frame);
+    self->mode_func_ptr = Vocoder_setProcMode;
 
-    if (freq != self->last_freq) {
-        self->last_freq = freq;
-        self->w = 2.0 * MYSIN(freq * self->piOverSr);
-    }
+    static char *kwlist[] = {"input", "input2", "freq", "spread", "q", "slope", "stages", "mode", "size", "mul", "add", NULL};
 
-    if (type < 0.0)
-        type = 0.0;
-    else if (type > 1.0)
-        type = 1.0;
-
-    lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
-    highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
-    bandgain = (type <= 0.5) ? type : (1.0 - type);
-    for (i=0; i<self->bufsize; i++) {
-        q = qst[i];
-        if (q < 0.5)
-            q = 0.5;
-        q1 = 1.0 / q;
-        low = self->y2 + self->w * self->y1;
-        high = in[i] - low - q1 * self->y1;
-        band = self->w * high + self->y1;
-        self->y1 = band;
-        self->y2 = low;
-        val = low * lowgain + high * highgain + band * bandgain;
-        low = self->y4 + self->w * self->y3;
-        high = val - low - q1 * self->y3;
-        band = self->w * high + self->y3;
-        self->y3 = band;
-        self->y4 = low;
-        self->data[i] = low * lowgain + high * highgain + band * bandgain;
-    }
-}
-
-static void
-SVF_filters_aai(SVF *self) {
-    int i;
-    MYFLT val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
-    type = PyFloat_AS_DOUBLE(self->type);
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OO|OOOOiiiOO", kwlist, &inputtmp, &input2tmp, &freqtmp, &spreadtmp, &qtmp, &slopetmp, &self->stages, &self->mode, &self->size, &multmp, &addtmp))
+        Py_RETURN_NONE;
 
-    if (type < 0.0)
-        type = 0.0;
-    else if (type > 1.0)
-        type = 1.0;
+    INIT_INPUT_STREAM
 
-    lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
-    highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
-    bandgain = (type <= 0.5) ? type : (1.0 - type);
-    for (i=0; i<self->bufsize; i++) {
-        freq = fr[i];
-        q = qst[i];
-        if (freq < 0.1)
-            freq = 0.1;
-        else if (freq > self->srOverSix)
-            freq = self->srOverSix;
+    if ( PyObject_HasAttrString((PyObject *)input2tmp, "server") == 0 ) {
+        PyErr_SetString(PyExc_TypeError, "\"input2\" argument of Vocoder must be a PyoObject.\n");
+        Py_RETURN_NONE;
+    }
+    Py_XDECREF(self->input2);
+    self->input2 = input2tmp;
+    input2_streamtmp = PyObject_CallMethod((PyObject *)self->input2, "_getStream", NULL);
+    Py_INCREF(input2_streamtmp);
+    Py_XDECREF(self->input2_stream);
+    self->input2_stream = (Stream *)input2_streamtmp;
 
-        if (freq != self->last_freq) {
-            self->last_freq = freq;
-            self->w = 2.0 * MYSIN(freq * self->piOverSr);
-        }
-        if (q < 0.5)
-            q = 0.5;
-        q1 = 1.0 / q;
-        low = self->y2 + self->w * self->y1;
-        high = in[i] - low - q1 * self->y1;
-        band = self->w * high + self->y1;
-        self->y1 = band;
-        self->y2 = low;
-        val = low * lowgain + high * highgain + band * bandgain;
-        low = self->y4 + self->w * self->y3;
-        high = val - low - q1 * self->y3;
-        band = self->w * high + self->y3;
-        self->y3 = band;
-        self->y4 = low;
-        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    if (freqtmp) {
+        PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
     }
-}
 
-static void
-SVF_filters_iia(SVF *self) {
-    int i;
-    MYFLT val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    freq = PyFloat_AS_DOUBLE(self->freq);
-    q = PyFloat_AS_DOUBLE(self->q);
-    MYFLT *tp = Stream_getData((Stream *)self->type_stream);
+    if (spreadtmp) {
+        PyObject_CallMethod((PyObject *)self, "setSpread", "O", spreadtmp);
+    }
 
-    if (freq < 0.1)
-        freq = 0.1;
-    else if (freq > self->srOverSix)
-        freq = self->srOverSix;
+    if (qtmp) {
+        PyObject_CallMethod((PyObject *)self, "setQ", "O", qtmp);
+    }
 
-    if (freq != self->last_freq) {
-        self->last_freq = freq;
-        self->w = 2.0 * MYSIN(freq * self->piOverSr);
+    if (slopetmp) {
+        PyObject_CallMethod((PyObject *)self, "setSlope", "O", slopetmp);
     }
 
-    if (q < 0.5)
-        q = 0.5;
-    q1 = 1.0 / q;
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
 
-    for (i=0; i<self->bufsize; i++) {
-        type = tp[i];
-        if (type < 0.0)
-            type = 0.0;
-        else if (type > 1.0)
-            type = 1.0;
-        lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
-        highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
-        bandgain = (type <= 0.5) ? type : (1.0 - type);
-        low = self->y2 + self->w * self->y1;
-        high = in[i] - low - q1 * self->y1;
-        band = self->w * high + self->y1;
-        self->y1 = band;
-        self->y2 = low;
-        val = low * lowgain + high * highgain + band * bandgain;
-        low = self->y4 + self->w * self->y3;
-        high = val - low - q1 * self->y3;
-        band = self->w * high + self->y3;
-        self->y3 = band;
-        self->y4 = low;
-        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
     }
-}
 
-static void
-SVF_filters_aia(SVF *self) {
-    int i;
-    MYFLT val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    q = PyFloat_AS_DOUBLE(self->q);
-    MYFLT *tp = Stream_getData((Stream *)self->type_stream);
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
 
-    if (q < 0.5)
-        q = 0.5;
-    q1 = 1.0 / q;
+    if (self->stages < 1)
+        self->stages = 1;
+    Vocoder_allocate_memories(self);
 
-    for (i=0; i<self->bufsize; i++) {
-        freq = fr[i];
-        type = tp[i];
-        if (freq < 0.1)
-            freq = 0.1;
-        else if (freq > self->srOverSix)
-            freq = self->srOverSix;
+    self->mode = self->mode != 0;
+    self->size = Vocoder_check_size(self->size);
+    if (self->mode == 1)
+        Vocoder_allocate_fft_memories(self);
 
-        if (freq != self->last_freq) {
-            self->last_freq = freq;
-            self->w = 2.0 * MYSIN(freq * self->piOverSr);
-        }
-        if (type < 0.0)
-            type = 0.0;
-        else if (type > 1.0)
-            type = 1.0;
-        lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
-        highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
-        bandgain = (type <= 0.5) ? type : (1.0 - type);
-        low = self->y2 + self->w * self->y1;
-        high = in[i] - low - q1 * self->y1;
-        band = self->w * high + self->y1;
-        self->y1 = band;
-        self->y2 = low;
-        val = low * lowgain + high * highgain + band * bandgain;
-        low = self->y4 + self->w * self->y3;
-        high = val - low - q1 * self->y3;
-        band = self->w * high + self->y3;
-        self->y3 = band;
-        self->y4 = low;
-        self->data[i] = low * lowgain + high * highgain + band * bandgain;
-    }
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
 }
 
-static void
-SVF_filters_iaa(SVF *self) {
-    int i;
-    MYFLT val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    freq = PyFloat_AS_DOUBLE(self->freq);
-    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
-    MYFLT *tp = Stream_getData((Stream *)self->type_stream);
+static PyObject * Vocoder_getServer(Vocoder* self) { GET_SERVER };
+static PyObject * Vocoder_getStream(Vocoder* self) { GET_STREAM };
+static PyObject * Vocoder_setMul(Vocoder *self, PyObject *arg) { SET_MUL };
+static PyObject * Vocoder_setAdd(Vocoder *self, PyObject *arg) { SET_ADD };
+static PyObject * Vocoder_setSub(Vocoder *self, PyObject *arg) { SET_SUB };
+static PyObject * Vocoder_setDiv(Vocoder *self, PyObject *arg) { SET_DIV };
 
-    if (freq < 0.1)
-        freq = 0.1;
-    else if (freq > self->srOverSix)
-        freq = self->srOverSix;
+static PyObject * Vocoder_play(Vocoder *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * Vocoder_out(Vocoder *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * Vocoder_stop(Vocoder *self) { STOP };
 
-    if (freq != self->last_freq) {
-        self->last_freq = freq;
-        self->w = 2.0 * MYSIN(freq * self->piOverSr);
-    }
+static PyObject * Vocoder_multiply(Vocoder *self, PyObject *arg) { MULTIPLY };
+static PyObject * Vocoder_inplace_multiply(Vocoder *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * Vocoder_add(Vocoder *self, PyObject *arg) { ADD };
+static PyObject * Vocoder_inplace_add(Vocoder *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * Vocoder_sub(Vocoder *self, PyObject *arg) { SUB };
+static PyObject * Vocoder_inplace_sub(Vocoder *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * Vocoder_div(Vocoder *self, PyObject *arg) { DIV };
+static PyObject * Vocoder_inplace_div(Vocoder *self, PyObject *arg) { INPLACE_DIV };
 
-    for (i=0; i<self->bufsize; i++) {
-        q = qst[i];
-        type = tp[i];
-        if (q < 0.5)
-            q = 0.5;
-        q1 = 1.0 / q;
-        if (type < 0.0)
-            type = 0.0;
-        else if (type > 1.0)
-            type = 1.0;
-        lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
-        highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
-        bandgain = (type <= 0.5) ? type : (1.0 - type);
-        low = self->y2 + self->w * self->y1;
-        high = in[i] - low - q1 * self->y1;
-        band = self->w * high + self->y1;
-        self->y1 = band;
-        self->y2 = low;
-        val = low * lowgain + high * highgain + band * bandgain;
-        low = self->y4 + self->w * self->y3;
-        high = val - low - q1 * self->y3;
-        band = self->w * high + self->y3;
-        self->y3 = band;
-        self->y4 = low;
-        self->data[i] = low * lowgain + high * highgain + band * bandgain;
-    }
-}
+static PyObject *
+Vocoder_setFreq(Vocoder *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
 
-static void
-SVF_filters_aaa(SVF *self) {
-    int i;
-    MYFLT val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
-    MYFLT *tp = Stream_getData((Stream *)self->type_stream);
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
 
-    for (i=0; i<self->bufsize; i++) {
-        freq = fr[i];
-        q = qst[i];
-        type = tp[i];
-        if (freq < 0.1)
-            freq = 0.1;
-        else if (freq > self->srOverSix)
-            freq = self->srOverSix;
+	int isNumber = PyNumber_Check(arg);
 
-        if (freq != self->last_freq) {
-            self->last_freq = freq;
-            self->w = 2.0 * MYSIN(freq * self->piOverSr);
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->freq);
+	if (isNumber == 1) {
+		self->freq = PyNumber_Float(tmp);
+        self->modebuffer[2] = 0;
+	}
+	else {
+		self->freq = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->freq, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->freq_stream);
+        self->freq_stream = (Stream *)streamtmp;
+		self->modebuffer[2] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+Vocoder_setSpread(Vocoder *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->spread);
+	if (isNumber == 1) {
+		self->spread = PyNumber_Float(tmp);
+        self->modebuffer[3] = 0;
+	}
+	else {
+		self->spread = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->spread, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->spread_stream);
+        self->spread_stream = (Stream *)streamtmp;
+		self->modebuffer[3] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+Vocoder_setQ(Vocoder *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->q);
+	if (isNumber == 1) {
+		self->q = PyNumber_Float(tmp);
+        self->modebuffer[4] = 0;
+	}
+	else {
+		self->q = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->q, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->q_stream);
+        self->q_stream = (Stream *)streamtmp;
+		self->modebuffer[4] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+Vocoder_setSlope(Vocoder *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->slope);
+	if (isNumber == 1) {
+		self->slope = PyNumber_Float(tmp);
+        self->modebuffer[5] = 0;
+	}
+	else {
+		self->slope = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->slope, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->slope_stream);
+        self->slope_stream = (Stream *)streamtmp;
+		self->modebuffer[5] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+Vocoder_setStages(Vocoder *self, PyObject *arg)
+{
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isInt = PyInt_Check(arg);
+
+	if (isInt == 1) {
+		self->stages = PyInt_AsLong(arg);
+        if (self->stages < 1)
+            self->stages = 1;
+        Vocoder_allocate_memories(self);
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+Vocoder_setMode(Vocoder *self, PyObject *arg)
+{
+    int mode;
+
+    if (PyInt_Check(arg) || PyLong_Check(arg)) {
+        mode = PyInt_AsLong(arg) != 0;
+        if (mode != self->mode) {
+            self->mode = mode;
+            if (mode == 1)
+                Vocoder_allocate_fft_memories(self);
+            Vocoder_allocate_memories(self);
+            (*self->mode_func_ptr)(self);
+        }
+    }
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+Vocoder_setSize(Vocoder *self, PyObject *arg)
+{
+    if (PyInt_Check(arg) || PyLong_Check(arg)) {
+        self->size = Vocoder_check_size(PyInt_AsLong(arg));
+        if (self->mode == 1)
+            Vocoder_allocate_fft_memories(self);
+    }
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyMemberDef Vocoder_members[] = {
+    {"server", T_OBJECT_EX, offsetof(Vocoder, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(Vocoder, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(Vocoder, input), 0, "Spectral envelope signal."},
+    {"input2", T_OBJECT_EX, offsetof(Vocoder, input2), 0, "Exciter signal."},
+    {"freq", T_OBJECT_EX, offsetof(Vocoder, freq), 0, "Base frequency in cycle per second."},
+    {"spread", T_OBJECT_EX, offsetof(Vocoder, spread), 0, "Frequency expansion factor."},
+    {"q", T_OBJECT_EX, offsetof(Vocoder, q), 0, "Q factor."},
+    {"slope", T_OBJECT_EX, offsetof(Vocoder, slope), 0, "Responsiveness of the follower lowpass filter."},
+    {"mul", T_OBJECT_EX, offsetof(Vocoder, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(Vocoder, add), 0, "Add factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef Vocoder_methods[] = {
+    {"getServer", (PyCFunction)Vocoder_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)Vocoder_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)Vocoder_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)Vocoder_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)Vocoder_stop, METH_NOARGS, "Stops computing."},
+	{"setFreq", (PyCFunction)Vocoder_setFreq, METH_O, "Sets filter base frequency in cycle per second."},
+	{"setSpread", (PyCFunction)Vocoder_setSpread, METH_O, "Sets frequency expansion factor."},
+    {"setQ", (PyCFunction)Vocoder_setQ, METH_O, "Sets filter Q factor."},
+    {"setSlope", (PyCFunction)Vocoder_setSlope, METH_O, "Sets responsiveness of the follower."},
+    {"setStages", (PyCFunction)Vocoder_setStages, METH_O, "Sets the number of filtering stages."},
+    {"setMode", (PyCFunction)Vocoder_setMode, METH_O, "Sets the filters (0) or fft (1) mode."},
+    {"setSize", (PyCFunction)Vocoder_setSize, METH_O, "Sets the fft size of the fft mode."},
+	{"setMul", (PyCFunction)Vocoder_setMul, METH_O, "Sets oscillator mul factor."},
+	{"setAdd", (PyCFunction)Vocoder_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)Vocoder_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)Vocoder_setDiv, METH_O, "Sets inverse mul factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyNumberMethods Vocoder_as_number = {
+    (binaryfunc)Vocoder_add,                         /*nb_add*/
+    (binaryfunc)Vocoder_sub,                         /*nb_subtract*/
+    (binaryfunc)Vocoder_multiply,                    /*nb_multiply*/
+    (binaryfunc)Vocoder_div,                                              /*nb_divide*/
+    0,                                              /*nb_remainder*/
+    0,                                              /*nb_divmod*/
+    0,                                              /*nb_power*/
+    0,                                              /*nb_neg*/
+    0,                                              /*nb_pos*/
+    0,                                              /*(unaryfunc)array_abs,*/
+    0,                                              /*nb_nonzero*/
+    0,                                              /*nb_invert*/
+    0,                                              /*nb_lshift*/
+    0,                                              /*nb_rshift*/
+    0,                                              /*nb_and*/
+    0,                                              /*nb_xor*/
+    0,                                              /*nb_or*/
+    0,                                              /*nb_coerce*/
+    0,                                              /*nb_int*/
+    0,                                              /*nb_long*/
+    0,                                              /*nb_float*/
+    0,                                              /*nb_oct*/
+    0,                                              /*nb_hex*/
+    (binaryfunc)Vocoder_inplace_add,                 /*inplace_add*/
+    (binaryfunc)Vocoder_inplace_sub,                 /*inplace_subtract*/
+    (binaryfunc)Vocoder_inplace_multiply,            /*inplace_multiply*/
+    (binaryfunc)Vocoder_inplace_div,                                              /*inplace_divide*/
+    0,                                              /*inplace_remainder*/
+    0,                                              /*inplace_power*/
+    0,                                              /*inplace_lshift*/
+    0,                                              /*inplace_rshift*/
+    0,                                              /*inplace_and*/
+    0,                                              /*inplace_xor*/
+    0,                                              /*inplace_or*/
+    0,                                              /*nb_floor_divide*/
+    0,                                              /*nb_true_divide*/
+    0,                                              /*nb_inplace_floor_divide*/
+    0,                                              /*nb_inplace_true_divide*/
+    0,                                              /* nb_index */
+};
+
+PyTypeObject VocoderType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                                              /*ob_size*/
+    "_pyo.Vocoder_base",                                   /*tp_name*/
+    sizeof(Vocoder),                                 /*tp_basicsize*/
+    0,                                              /*tp_itemsize*/
+    (destructor)Vocoder_dealloc,                     /*tp_dealloc*/
+    0,                                              /*tp_print*/
+    0,                                              /*tp_getattr*/
+    0,                                              /*tp_setattr*/
+    0,                                              /*tp_compare*/
+    0,                                              /*tp_repr*/
+    &Vocoder_as_number,                              /*tp_as_number*/
+    0,                                              /*tp_as_sequence*/
+    0,                                              /*tp_as_mapping*/
+    0,                                              /*tp_hash */
+    0,                                              /*tp_call*/
+    0,                                              /*tp_str*/
+    0,                                              /*tp_getattro*/
+    0,                                              /*tp_setattro*/
+    0,                                              /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "Vocoder objects. Bank of bandpass filters implementing the vocoder effect.",           /* tp_doc */
+    (traverseproc)Vocoder_traverse,                  /* tp_traverse */
+    (inquiry)Vocoder_clear,                          /* tp_clear */
+    0,                                              /* tp_richcompare */
+    0,                                              /* tp_weaklistoffset */
+    0,                                              /* tp_iter */
+    0,                                              /* tp_iternext */
+    Vocoder_methods,                                 /* tp_methods */
+    Vocoder_members,                                 /* tp_members */
+    0,                                              /* tp_getset */
+    0,                                              /* tp_base */
+    0,                                              /* tp_dict */
+    0,                                              /* tp_descr_get */
+    0,                                              /* tp_descr_set */
+    0,                                              /* tp_dictoffset */
+    0,                          /* tp_init */
+    0,                                              /* tp_alloc */
+    Vocoder_new,                                     /* tp_new */
+};
+
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream *input_stream;
+    PyObject *freq;
+    Stream *freq_stream;
+    PyObject *q;
+    Stream *q_stream;
+    PyObject *type;
+    Stream *type_stream;
+    int modebuffer[5]; // need at least 2 slots for mul & add
+    MYSTATE srOverSix;
+    MYSTATE last_freq;
+    MYSTATE piOverSr;
+    // sample memories
+    MYSTATE y1;
+    MYSTATE y2;
+    MYSTATE y3;
+    MYSTATE y4;
+    // variables
+    MYSTATE w;
+} SVF;
+
+static void
+SVF_filters_iii(SVF *self) {
+    int i;
+    MYSTATE val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    freq = PyFloat_AS_DOUBLE(self->freq);
+    q = PyFloat_AS_DOUBLE(self->q);
+    type = PyFloat_AS_DOUBLE(self->type);
+
+    if (freq < 0.1)
+        freq = 0.1;
+    else if (freq > self->srOverSix)
+        freq = self->srOverSix;
+
+    if (freq != self->last_freq) {
+        self->last_freq = freq;
+        self->w = 2.0 * STSIN(freq * self->piOverSr);
+    }
+
+    if (q < 0.5)
+        q = 0.5;
+    q1 = 1.0 / q;
+
+    if (type < 0.0)
+        type = 0.0;
+    else if (type > 1.0)
+        type = 1.0;
+
+    lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
+    highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
+    bandgain = (type <= 0.5) ? type : (1.0 - type);
+    for (i=0; i<self->bufsize; i++) {
+        low = self->y2 + self->w * self->y1;
+        high = in[i] - low - q1 * self->y1;
+        band = self->w * high + self->y1;
+        self->y1 = band;
+        self->y2 = low;
+        val = low * lowgain + high * highgain + band * bandgain;
+        low = self->y4 + self->w * self->y3;
+        high = val - low - q1 * self->y3;
+        band = self->w * high + self->y3;
+        self->y3 = band;
+        self->y4 = low;
+        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    }
+}
+
+static void
+SVF_filters_aii(SVF *self) {
+    int i;
+    MYSTATE val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
+    q = PyFloat_AS_DOUBLE(self->q);
+    type = PyFloat_AS_DOUBLE(self->type);
+
+    if (q < 0.5)
+        q = 0.5;
+    q1 = 1.0 / q;
+
+    if (type < 0.0)
+        type = 0.0;
+    else if (type > 1.0)
+        type = 1.0;
+
+    lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
+    highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
+    bandgain = (type <= 0.5) ? type : (1.0 - type);
+    for (i=0; i<self->bufsize; i++) {
+        freq = fr[i];
+        if (freq < 0.1)
+            freq = 0.1;
+        else if (freq > self->srOverSix)
+            freq = self->srOverSix;
+
+        if (freq != self->last_freq) {
+            self->last_freq = freq;
+            self->w = 2.0 * STSIN(freq * self->piOverSr);
+        }
+        low = self->y2 + self->w * self->y1;
+        high = in[i] - low - q1 * self->y1;
+        band = self->w * high + self->y1;
+        self->y1 = band;
+        self->y2 = low;
+        val = low * lowgain + high * highgain + band * bandgain;
+        low = self->y4 + self->w * self->y3;
+        high = val - low - q1 * self->y3;
+        band = self->w * high + self->y3;
+        self->y3 = band;
+        self->y4 = low;
+        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    }
+}
+
+static void
+SVF_filters_iai(SVF *self) {
+    int i;
+    MYSTATE val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    freq = PyFloat_AS_DOUBLE(self->freq);
+    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
+    type = PyFloat_AS_DOUBLE(self->type);
+
+    if (freq < 0.1)
+        freq = 0.1;
+    else if (freq > self->srOverSix)
+        freq = self->srOverSix;
+
+    if (freq != self->last_freq) {
+        self->last_freq = freq;
+        self->w = 2.0 * STSIN(freq * self->piOverSr);
+    }
+
+    if (type < 0.0)
+        type = 0.0;
+    else if (type > 1.0)
+        type = 1.0;
+
+    lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
+    highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
+    bandgain = (type <= 0.5) ? type : (1.0 - type);
+    for (i=0; i<self->bufsize; i++) {
+        q = qst[i];
+        if (q < 0.5)
+            q = 0.5;
+        q1 = 1.0 / q;
+        low = self->y2 + self->w * self->y1;
+        high = in[i] - low - q1 * self->y1;
+        band = self->w * high + self->y1;
+        self->y1 = band;
+        self->y2 = low;
+        val = low * lowgain + high * highgain + band * bandgain;
+        low = self->y4 + self->w * self->y3;
+        high = val - low - q1 * self->y3;
+        band = self->w * high + self->y3;
+        self->y3 = band;
+        self->y4 = low;
+        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    }
+}
+
+static void
+SVF_filters_aai(SVF *self) {
+    int i;
+    MYSTATE val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
+    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
+    type = PyFloat_AS_DOUBLE(self->type);
+
+    if (type < 0.0)
+        type = 0.0;
+    else if (type > 1.0)
+        type = 1.0;
+
+    lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
+    highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
+    bandgain = (type <= 0.5) ? type : (1.0 - type);
+    for (i=0; i<self->bufsize; i++) {
+        freq = fr[i];
+        q = qst[i];
+        if (freq < 0.1)
+            freq = 0.1;
+        else if (freq > self->srOverSix)
+            freq = self->srOverSix;
+
+        if (freq != self->last_freq) {
+            self->last_freq = freq;
+            self->w = 2.0 * STSIN(freq * self->piOverSr);
+        }
+        if (q < 0.5)
+            q = 0.5;
+        q1 = 1.0 / q;
+        low = self->y2 + self->w * self->y1;
+        high = in[i] - low - q1 * self->y1;
+        band = self->w * high + self->y1;
+        self->y1 = band;
+        self->y2 = low;
+        val = low * lowgain + high * highgain + band * bandgain;
+        low = self->y4 + self->w * self->y3;
+        high = val - low - q1 * self->y3;
+        band = self->w * high + self->y3;
+        self->y3 = band;
+        self->y4 = low;
+        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    }
+}
+
+static void
+SVF_filters_iia(SVF *self) {
+    int i;
+    MYSTATE val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    freq = PyFloat_AS_DOUBLE(self->freq);
+    q = PyFloat_AS_DOUBLE(self->q);
+    MYFLT *tp = Stream_getData((Stream *)self->type_stream);
+
+    if (freq < 0.1)
+        freq = 0.1;
+    else if (freq > self->srOverSix)
+        freq = self->srOverSix;
+
+    if (freq != self->last_freq) {
+        self->last_freq = freq;
+        self->w = 2.0 * STSIN(freq * self->piOverSr);
+    }
+
+    if (q < 0.5)
+        q = 0.5;
+    q1 = 1.0 / q;
+
+    for (i=0; i<self->bufsize; i++) {
+        type = tp[i];
+        if (type < 0.0)
+            type = 0.0;
+        else if (type > 1.0)
+            type = 1.0;
+        lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
+        highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
+        bandgain = (type <= 0.5) ? type : (1.0 - type);
+        low = self->y2 + self->w * self->y1;
+        high = in[i] - low - q1 * self->y1;
+        band = self->w * high + self->y1;
+        self->y1 = band;
+        self->y2 = low;
+        val = low * lowgain + high * highgain + band * bandgain;
+        low = self->y4 + self->w * self->y3;
+        high = val - low - q1 * self->y3;
+        band = self->w * high + self->y3;
+        self->y3 = band;
+        self->y4 = low;
+        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    }
+}
+
+static void
+SVF_filters_aia(SVF *self) {
+    int i;
+    MYSTATE val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
+    q = PyFloat_AS_DOUBLE(self->q);
+    MYFLT *tp = Stream_getData((Stream *)self->type_stream);
+
+    if (q < 0.5)
+        q = 0.5;
+    q1 = 1.0 / q;
+
+    for (i=0; i<self->bufsize; i++) {
+        freq = fr[i];
+        type = tp[i];
+        if (freq < 0.1)
+            freq = 0.1;
+        else if (freq > self->srOverSix)
+            freq = self->srOverSix;
+
+        if (freq != self->last_freq) {
+            self->last_freq = freq;
+            self->w = 2.0 * STSIN(freq * self->piOverSr);
+        }
+        if (type < 0.0)
+            type = 0.0;
+        else if (type > 1.0)
+            type = 1.0;
+        lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
+        highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
+        bandgain = (type <= 0.5) ? type : (1.0 - type);
+        low = self->y2 + self->w * self->y1;
+        high = in[i] - low - q1 * self->y1;
+        band = self->w * high + self->y1;
+        self->y1 = band;
+        self->y2 = low;
+        val = low * lowgain + high * highgain + band * bandgain;
+        low = self->y4 + self->w * self->y3;
+        high = val - low - q1 * self->y3;
+        band = self->w * high + self->y3;
+        self->y3 = band;
+        self->y4 = low;
+        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    }
+}
+
+static void
+SVF_filters_iaa(SVF *self) {
+    int i;
+    MYSTATE val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    freq = PyFloat_AS_DOUBLE(self->freq);
+    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
+    MYFLT *tp = Stream_getData((Stream *)self->type_stream);
+
+    if (freq < 0.1)
+        freq = 0.1;
+    else if (freq > self->srOverSix)
+        freq = self->srOverSix;
+
+    if (freq != self->last_freq) {
+        self->last_freq = freq;
+        self->w = 2.0 * STSIN(freq * self->piOverSr);
+    }
+
+    for (i=0; i<self->bufsize; i++) {
+        q = qst[i];
+        type = tp[i];
+        if (q < 0.5)
+            q = 0.5;
+        q1 = 1.0 / q;
+        if (type < 0.0)
+            type = 0.0;
+        else if (type > 1.0)
+            type = 1.0;
+        lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
+        highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
+        bandgain = (type <= 0.5) ? type : (1.0 - type);
+        low = self->y2 + self->w * self->y1;
+        high = in[i] - low - q1 * self->y1;
+        band = self->w * high + self->y1;
+        self->y1 = band;
+        self->y2 = low;
+        val = low * lowgain + high * highgain + band * bandgain;
+        low = self->y4 + self->w * self->y3;
+        high = val - low - q1 * self->y3;
+        band = self->w * high + self->y3;
+        self->y3 = band;
+        self->y4 = low;
+        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    }
+}
+
+static void
+SVF_filters_aaa(SVF *self) {
+    int i;
+    MYSTATE val, freq, q, type, q1, low, high, band, lowgain, highgain, bandgain;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
+    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
+    MYFLT *tp = Stream_getData((Stream *)self->type_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        freq = fr[i];
+        q = qst[i];
+        type = tp[i];
+        if (freq < 0.1)
+            freq = 0.1;
+        else if (freq > self->srOverSix)
+            freq = self->srOverSix;
+
+        if (freq != self->last_freq) {
+            self->last_freq = freq;
+            self->w = 2.0 * STSIN(freq * self->piOverSr);
+        }
+        if (q < 0.5)
+            q = 0.5;
+        q1 = 1.0 / q;
+        if (type < 0.0)
+            type = 0.0;
+        else if (type > 1.0)
+            type = 1.0;
+        lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
+        highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
+        bandgain = (type <= 0.5) ? type : (1.0 - type);
+        low = self->y2 + self->w * self->y1;
+        high = in[i] - low - q1 * self->y1;
+        band = self->w * high + self->y1;
+        self->y1 = band;
+        self->y2 = low;
+        val = low * lowgain + high * highgain + band * bandgain;
+        low = self->y4 + self->w * self->y3;
+        high = val - low - q1 * self->y3;
+        band = self->w * high + self->y3;
+        self->y3 = band;
+        self->y4 = low;
+        self->data[i] = low * lowgain + high * highgain + band * bandgain;
+    }
+}
+
+static void SVF_postprocessing_ii(SVF *self) { POST_PROCESSING_II };
+static void SVF_postprocessing_ai(SVF *self) { POST_PROCESSING_AI };
+static void SVF_postprocessing_ia(SVF *self) { POST_PROCESSING_IA };
+static void SVF_postprocessing_aa(SVF *self) { POST_PROCESSING_AA };
+static void SVF_postprocessing_ireva(SVF *self) { POST_PROCESSING_IREVA };
+static void SVF_postprocessing_areva(SVF *self) { POST_PROCESSING_AREVA };
+static void SVF_postprocessing_revai(SVF *self) { POST_PROCESSING_REVAI };
+static void SVF_postprocessing_revaa(SVF *self) { POST_PROCESSING_REVAA };
+static void SVF_postprocessing_revareva(SVF *self) { POST_PROCESSING_REVAREVA };
+
+static void
+SVF_setProcMode(SVF *self)
+{
+    int procmode, muladdmode;
+    procmode = self->modebuffer[2] + self->modebuffer[3] * 10 + self->modebuffer[4] * 100;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+	switch (procmode) {
+        case 0:
+            self->proc_func_ptr = SVF_filters_iii;
+            break;
+        case 1:
+            self->proc_func_ptr = SVF_filters_aii;
+            break;
+        case 10:
+            self->proc_func_ptr = SVF_filters_iai;
+            break;
+        case 11:
+            self->proc_func_ptr = SVF_filters_aai;
+            break;
+        case 100:
+            self->proc_func_ptr = SVF_filters_iia;
+            break;
+        case 101:
+            self->proc_func_ptr = SVF_filters_aia;
+            break;
+        case 110:
+            self->proc_func_ptr = SVF_filters_iaa;
+            break;
+        case 111:
+            self->proc_func_ptr = SVF_filters_aaa;
+            break;
+    }
+	switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = SVF_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = SVF_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = SVF_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = SVF_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = SVF_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = SVF_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = SVF_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = SVF_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = SVF_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+SVF_compute_next_data_frame(SVF *self)
+{
+    (*self->proc_func_ptr)(self);
+    (*self->muladd_func_ptr)(self);
+}
+
+static int
+SVF_traverse(SVF *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->input);
+    Py_VISIT(self->input_stream);
+    Py_VISIT(self->freq);
+    Py_VISIT(self->freq_stream);
+    Py_VISIT(self->q);
+    Py_VISIT(self->q_stream);
+    Py_VISIT(self->type);
+    Py_VISIT(self->type_stream);
+    return 0;
+}
+
+static int
+SVF_clear(SVF *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->input);
+    Py_CLEAR(self->input_stream);
+    Py_CLEAR(self->freq);
+    Py_CLEAR(self->freq_stream);
+    Py_CLEAR(self->q);
+    Py_CLEAR(self->q_stream);
+    Py_CLEAR(self->type);
+    Py_CLEAR(self->type_stream);
+    return 0;
+}
+
+static void
+SVF_dealloc(SVF* self)
+{
+    pyo_DEALLOC
+    SVF_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+SVF_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *qtmp=NULL, *typetmp=NULL, *multmp=NULL, *addtmp=NULL;
+    SVF *self;
+    self = (SVF *)type->tp_alloc(type, 0);
+
+    self->freq = PyFloat_FromDouble(1000);
+    self->q = PyFloat_FromDouble(1);
+    self->type = PyFloat_FromDouble(0);
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+	self->modebuffer[2] = 0;
+	self->modebuffer[3] = 0;
+	self->modebuffer[4] = 0;
+    self->y1 = self->y2 = self->y3 = self->y4 = self->w = 0.0;
+    self->last_freq = -1.0;
+
+    INIT_OBJECT_COMMON
+
+    self->srOverSix = (MYFLT)self->sr / 6.0;
+    self->piOverSr = PI / self->sr;
+
+    Stream_setFunctionPtr(self->stream, SVF_compute_next_data_frame);
+    self->mode_func_ptr = SVF_setProcMode;
+
+    static char *kwlist[] = {"input", "freq", "q", "type", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOOO", kwlist, &inputtmp, &freqtmp, &qtmp, &typetmp, &multmp, &addtmp))
+        Py_RETURN_NONE;
+
+    INIT_INPUT_STREAM
+
+    if (freqtmp) {
+        PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
+    }
+
+    if (qtmp) {
+        PyObject_CallMethod((PyObject *)self, "setQ", "O", qtmp);
+    }
+
+    if (typetmp) {
+        PyObject_CallMethod((PyObject *)self, "setType", "O", typetmp);
+    }
+
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
+
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * SVF_getServer(SVF* self) { GET_SERVER };
+static PyObject * SVF_getStream(SVF* self) { GET_STREAM };
+static PyObject * SVF_setMul(SVF *self, PyObject *arg) { SET_MUL };
+static PyObject * SVF_setAdd(SVF *self, PyObject *arg) { SET_ADD };
+static PyObject * SVF_setSub(SVF *self, PyObject *arg) { SET_SUB };
+static PyObject * SVF_setDiv(SVF *self, PyObject *arg) { SET_DIV };
+
+static PyObject * SVF_play(SVF *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * SVF_out(SVF *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * SVF_stop(SVF *self) { STOP };
+
+static PyObject * SVF_multiply(SVF *self, PyObject *arg) { MULTIPLY };
+static PyObject * SVF_inplace_multiply(SVF *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * SVF_add(SVF *self, PyObject *arg) { ADD };
+static PyObject * SVF_inplace_add(SVF *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * SVF_sub(SVF *self, PyObject *arg) { SUB };
+static PyObject * SVF_inplace_sub(SVF *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * SVF_div(SVF *self, PyObject *arg) { DIV };
+static PyObject * SVF_inplace_div(SVF *self, PyObject *arg) { INPLACE_DIV };
+
+static PyObject *
+SVF_setFreq(SVF *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->freq);
+	if (isNumber == 1) {
+		self->freq = PyNumber_Float(tmp);
+        self->modebuffer[2] = 0;
+	}
+	else {
+		self->freq = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->freq, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->freq_stream);
+        self->freq_stream = (Stream *)streamtmp;
+		self->modebuffer[2] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+SVF_setQ(SVF *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->q);
+	if (isNumber == 1) {
+		self->q = PyNumber_Float(tmp);
+        self->modebuffer[3] = 0;
+	}
+	else {
+		self->q = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->q, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->q_stream);
+        self->q_stream = (Stream *)streamtmp;
+		self->modebuffer[3] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+SVF_setType(SVF *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->type);
+	if (isNumber == 1) {
+		self->type = PyNumber_Float(tmp);
+        self->modebuffer[4] = 0;
+	}
+	else {
+		self->type = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->type, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->type_stream);
+        self->type_stream = (Stream *)streamtmp;
+		self->modebuffer[4] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyMemberDef SVF_members[] = {
+    {"server", T_OBJECT_EX, offsetof(SVF, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(SVF, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(SVF, input), 0, "Input sound object."},
+    {"freq", T_OBJECT_EX, offsetof(SVF, freq), 0, "Cutoff frequency in cycle per second."},
+    {"q", T_OBJECT_EX, offsetof(SVF, q), 0, "Q factor."},
+    {"type", T_OBJECT_EX, offsetof(SVF, type), 0, "Filter type."},
+    {"mul", T_OBJECT_EX, offsetof(SVF, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(SVF, add), 0, "Add factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef SVF_methods[] = {
+    {"getServer", (PyCFunction)SVF_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)SVF_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)SVF_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)SVF_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)SVF_stop, METH_NOARGS, "Stops computing."},
+	{"setFreq", (PyCFunction)SVF_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
+    {"setQ", (PyCFunction)SVF_setQ, METH_O, "Sets filter Q factor."},
+    {"setType", (PyCFunction)SVF_setType, METH_O, "Sets filter type factor."},
+	{"setMul", (PyCFunction)SVF_setMul, METH_O, "Sets mul factor."},
+	{"setAdd", (PyCFunction)SVF_setAdd, METH_O, "Sets add factor."},
+    {"setSub", (PyCFunction)SVF_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)SVF_setDiv, METH_O, "Sets inverse mul factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyNumberMethods SVF_as_number = {
+    (binaryfunc)SVF_add,                         /*nb_add*/
+    (binaryfunc)SVF_sub,                         /*nb_subtract*/
+    (binaryfunc)SVF_multiply,                    /*nb_multiply*/
+    (binaryfunc)SVF_div,                                              /*nb_divide*/
+    0,                                              /*nb_remainder*/
+    0,                                              /*nb_divmod*/
+    0,                                              /*nb_power*/
+    0,                                              /*nb_neg*/
+    0,                                              /*nb_pos*/
+    0,                                              /*(unaryfunc)array_abs,*/
+    0,                                              /*nb_nonzero*/
+    0,                                              /*nb_invert*/
+    0,                                              /*nb_lshift*/
+    0,                                              /*nb_rshift*/
+    0,                                              /*nb_and*/
+    0,                                              /*nb_xor*/
+    0,                                              /*nb_or*/
+    0,                                              /*nb_coerce*/
+    0,                                              /*nb_int*/
+    0,                                              /*nb_long*/
+    0,                                              /*nb_float*/
+    0,                                              /*nb_oct*/
+    0,                                              /*nb_hex*/
+    (binaryfunc)SVF_inplace_add,                 /*inplace_add*/
+    (binaryfunc)SVF_inplace_sub,                 /*inplace_subtract*/
+    (binaryfunc)SVF_inplace_multiply,            /*inplace_multiply*/
+    (binaryfunc)SVF_inplace_div,                                              /*inplace_divide*/
+    0,                                              /*inplace_remainder*/
+    0,                                              /*inplace_power*/
+    0,                                              /*inplace_lshift*/
+    0,                                              /*inplace_rshift*/
+    0,                                              /*inplace_and*/
+    0,                                              /*inplace_xor*/
+    0,                                              /*inplace_or*/
+    0,                                              /*nb_floor_divide*/
+    0,                                              /*nb_true_divide*/
+    0,                                              /*nb_inplace_floor_divide*/
+    0,                                              /*nb_inplace_true_divide*/
+    0,                                              /* nb_index */
+};
+
+PyTypeObject SVFType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                                              /*ob_size*/
+    "_pyo.SVF_base",                                   /*tp_name*/
+    sizeof(SVF),                                 /*tp_basicsize*/
+    0,                                              /*tp_itemsize*/
+    (destructor)SVF_dealloc,                     /*tp_dealloc*/
+    0,                                              /*tp_print*/
+    0,                                              /*tp_getattr*/
+    0,                                              /*tp_setattr*/
+    0,                                              /*tp_compare*/
+    0,                                              /*tp_repr*/
+    &SVF_as_number,                              /*tp_as_number*/
+    0,                                              /*tp_as_sequence*/
+    0,                                              /*tp_as_mapping*/
+    0,                                              /*tp_hash */
+    0,                                              /*tp_call*/
+    0,                                              /*tp_str*/
+    0,                                              /*tp_getattro*/
+    0,                                              /*tp_setattro*/
+    0,                                              /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "SVF objects. Generates a state variable filter.",           /* tp_doc */
+    (traverseproc)SVF_traverse,                  /* tp_traverse */
+    (inquiry)SVF_clear,                          /* tp_clear */
+    0,                                              /* tp_richcompare */
+    0,                                              /* tp_weaklistoffset */
+    0,                                              /* tp_iter */
+    0,                                              /* tp_iternext */
+    SVF_methods,                                 /* tp_methods */
+    SVF_members,                                 /* tp_members */
+    0,                                              /* tp_getset */
+    0,                                              /* tp_base */
+    0,                                              /* tp_dict */
+    0,                                              /* tp_descr_get */
+    0,                                              /* tp_descr_set */
+    0,                                              /* tp_dictoffset */
+    0,                          /* tp_init */
+    0,                                              /* tp_alloc */
+    SVF_new,                                     /* tp_new */
+};
+
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream *input_stream;
+    int size;
+    int halfSize;
+    int in_count;
+    int init;
+    double currentValue;
+    double oneOnSize;
+    int modebuffer[2];
+    MYFLT *buffer; // samples memory
+} Average;
+
+static void
+Average_process_i(Average *self) {
+    int i;
+
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+
+    if (self->init) {
+        for (i=0; i<self->bufsize; i++) {
+            if (self->init) {
+                self->buffer[self->in_count] = in[i];
+                self->currentValue += (double)in[i];
+                self->in_count++;
+                if (self->in_count < self->halfSize)
+                    self->data[i] = 0.0;
+                else
+                    self->data[i] = (MYFLT)(self->currentValue * self->oneOnSize);
+                if (self->in_count >= self->size) {
+                    self->in_count = 0;
+                    self->init = 0;
+                }
+            }
+            else {
+                self->buffer[self->in_count] = in[i];
+                self->currentValue += (double)in[i];
+                self->in_count++;
+                if (self->in_count >= self->size)
+                    self->in_count = 0;
+                self->currentValue -= (double)self->buffer[self->in_count];
+                self->data[i] = (MYFLT)(self->currentValue * self->oneOnSize);
+            }
+        }
+    }
+    else {
+        for (i=0; i<self->bufsize; i++) {
+            self->buffer[self->in_count] = in[i];
+            self->currentValue += (double)in[i];
+            self->in_count++;
+            if (self->in_count >= self->size)
+                self->in_count = 0;
+            self->currentValue -= (double)self->buffer[self->in_count];
+            self->data[i] = (MYFLT)(self->currentValue * self->oneOnSize);
         }
-        if (q < 0.5)
-            q = 0.5;
-        q1 = 1.0 / q;
-        if (type < 0.0)
-            type = 0.0;
-        else if (type > 1.0)
-            type = 1.0;
-        lowgain = (type <= 0.5) ? (0.5 - type) : 0.0;
-        highgain = (type >= 0.5) ? (type - 0.5) : 0.0;
-        bandgain = (type <= 0.5) ? type : (1.0 - type);
-        low = self->y2 + self->w * self->y1;
-        high = in[i] - low - q1 * self->y1;
-        band = self->w * high + self->y1;
-        self->y1 = band;
-        self->y2 = low;
-        val = low * lowgain + high * highgain + band * bandgain;
-        low = self->y4 + self->w * self->y3;
-        high = val - low - q1 * self->y3;
-        band = self->w * high + self->y3;
-        self->y3 = band;
-        self->y4 = low;
-        self->data[i] = low * lowgain + high * highgain + band * bandgain;
     }
 }
 
-static void SVF_postprocessing_ii(SVF *self) { POST_PROCESSING_II };
-static void SVF_postprocessing_ai(SVF *self) { POST_PROCESSING_AI };
-static void SVF_postprocessing_ia(SVF *self) { POST_PROCESSING_IA };
-static void SVF_postprocessing_aa(SVF *self) { POST_PROCESSING_AA };
-static void SVF_postprocessing_ireva(SVF *self) { POST_PROCESSING_IREVA };
-static void SVF_postprocessing_areva(SVF *self) { POST_PROCESSING_AREVA };
-static void SVF_postprocessing_revai(SVF *self) { POST_PROCESSING_REVAI };
-static void SVF_postprocessing_revaa(SVF *self) { POST_PROCESSING_REVAA };
-static void SVF_postprocessing_revareva(SVF *self) { POST_PROCESSING_REVAREVA };
+static void Average_postprocessing_ii(Average *self) { POST_PROCESSING_II };
+static void Average_postprocessing_ai(Average *self) { POST_PROCESSING_AI };
+static void Average_postprocessing_ia(Average *self) { POST_PROCESSING_IA };
+static void Average_postprocessing_aa(Average *self) { POST_PROCESSING_AA };
+static void Average_postprocessing_ireva(Average *self) { POST_PROCESSING_IREVA };
+static void Average_postprocessing_areva(Average *self) { POST_PROCESSING_AREVA };
+static void Average_postprocessing_revai(Average *self) { POST_PROCESSING_REVAI };
+static void Average_postprocessing_revaa(Average *self) { POST_PROCESSING_REVAA };
+static void Average_postprocessing_revareva(Average *self) { POST_PROCESSING_REVAREVA };
 
 static void
-SVF_setProcMode(SVF *self)
+Average_setProcMode(Average *self)
 {
-    int procmode, muladdmode;
-    procmode = self->modebuffer[2] + self->modebuffer[3] * 10 + self->modebuffer[4] * 100;
+    int muladdmode;
     muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
 
-	switch (procmode) {
-        case 0:
-            self->proc_func_ptr = SVF_filters_iii;
-            break;
-        case 1:
-            self->proc_func_ptr = SVF_filters_aii;
-            break;
-        case 10:
-            self->proc_func_ptr = SVF_filters_iai;
-            break;
-        case 11:
-            self->proc_func_ptr = SVF_filters_aai;
-            break;
-        case 100:
-            self->proc_func_ptr = SVF_filters_iia;
-            break;
-        case 101:
-            self->proc_func_ptr = SVF_filters_aia;
-            break;
-        case 110:
-            self->proc_func_ptr = SVF_filters_iaa;
-            break;
-        case 111:
-            self->proc_func_ptr = SVF_filters_aaa;
-            break;
-    }
+    self->proc_func_ptr = Average_process_i;
+
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = SVF_postprocessing_ii;
+            self->muladd_func_ptr = Average_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = SVF_postprocessing_ai;
+            self->muladd_func_ptr = Average_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = SVF_postprocessing_revai;
+            self->muladd_func_ptr = Average_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = SVF_postprocessing_ia;
+            self->muladd_func_ptr = Average_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = SVF_postprocessing_aa;
+            self->muladd_func_ptr = Average_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = SVF_postprocessing_revaa;
+            self->muladd_func_ptr = Average_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = SVF_postprocessing_ireva;
+            self->muladd_func_ptr = Average_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = SVF_postprocessing_areva;
+            self->muladd_func_ptr = Average_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = SVF_postprocessing_revareva;
+            self->muladd_func_ptr = Average_postprocessing_revareva;
             break;
     }
 }
 
 static void
-SVF_compute_next_data_frame(SVF *self)
+Average_compute_next_data_frame(Average *self)
 {
     (*self->proc_func_ptr)(self);
     (*self->muladd_func_ptr)(self);
 }
 
 static int
-SVF_traverse(SVF *self, visitproc visit, void *arg)
+Average_traverse(Average *self, visitproc visit, void *arg)
 {
     pyo_VISIT
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
-    Py_VISIT(self->freq);
-    Py_VISIT(self->freq_stream);
-    Py_VISIT(self->q);
-    Py_VISIT(self->q_stream);
-    Py_VISIT(self->type);
-    Py_VISIT(self->type_stream);
     return 0;
 }
 
 static int
-SVF_clear(SVF *self)
+Average_clear(Average *self)
 {
     pyo_CLEAR
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
-    Py_CLEAR(self->freq);
-    Py_CLEAR(self->freq_stream);
-    Py_CLEAR(self->q);
-    Py_CLEAR(self->q_stream);
-    Py_CLEAR(self->type);
-    Py_CLEAR(self->type_stream);
     return 0;
 }
 
 static void
-SVF_dealloc(SVF* self)
+Average_dealloc(Average* self)
 {
     pyo_DEALLOC
-    SVF_clear(self);
+    free(self->buffer);
+    Average_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
 static PyObject *
-SVF_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+Average_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
-    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *qtmp=NULL, *typetmp=NULL, *multmp=NULL, *addtmp=NULL;
-    SVF *self;
-    self = (SVF *)type->tp_alloc(type, 0);
+    PyObject *inputtmp, *input_streamtmp, *multmp=NULL, *addtmp=NULL;
+    Average *self;
+    self = (Average *)type->tp_alloc(type, 0);
 
-    self->freq = PyFloat_FromDouble(1000);
-    self->q = PyFloat_FromDouble(1);
-    self->type = PyFloat_FromDouble(0);
+    self->size = 10;
+    self->init = 1;
+    self->in_count = 0;
+    self->currentValue = 0.0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
-	self->modebuffer[2] = 0;
-	self->modebuffer[3] = 0;
-	self->modebuffer[4] = 0;
-    self->y1 = self->y2 = self->y3 = self->y4 = self->w = 0.0;
-    self->last_freq = -1.0;
 
     INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, Average_compute_next_data_frame);
+    self->mode_func_ptr = Average_setProcMode;
 
-    self->srOverSix = (MYFLT)self->sr / 6.0;
-    self->piOverSr = PI / self->sr;
-
-    Stream_setFunctionPtr(self->stream, SVF_compute_next_data_frame);
-    self->mode_func_ptr = SVF_setProcMode;
-
-    static char *kwlist[] = {"input", "freq", "q", "type", "mul", "add", NULL};
+    static char *kwlist[] = {"input", "size", "mul", "add", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOOO", kwlist, &inputtmp, &freqtmp, &qtmp, &typetmp, &multmp, &addtmp))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|iOO", kwlist, &inputtmp, &self->size, &multmp, &addtmp))
         Py_RETURN_NONE;
 
     INIT_INPUT_STREAM
 
-    if (freqtmp) {
-        PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
-    }
-
-    if (qtmp) {
-        PyObject_CallMethod((PyObject *)self, "setQ", "O", qtmp);
-    }
-
-    if (typetmp) {
-        PyObject_CallMethod((PyObject *)self, "setType", "O", typetmp);
-    }
-
     if (multmp) {
         PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
     }
@@ -7616,412 +8485,453 @@ SVF_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     PyObject_CallMethod(self->server, "addStream", "O", self->stream);
 
-    (*self->mode_func_ptr)(self);
-
-    return (PyObject *)self;
-}
-
-static PyObject * SVF_getServer(SVF* self) { GET_SERVER };
-static PyObject * SVF_getStream(SVF* self) { GET_STREAM };
-static PyObject * SVF_setMul(SVF *self, PyObject *arg) { SET_MUL };
-static PyObject * SVF_setAdd(SVF *self, PyObject *arg) { SET_ADD };
-static PyObject * SVF_setSub(SVF *self, PyObject *arg) { SET_SUB };
-static PyObject * SVF_setDiv(SVF *self, PyObject *arg) { SET_DIV };
-
-static PyObject * SVF_play(SVF *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * SVF_out(SVF *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * SVF_stop(SVF *self) { STOP };
-
-static PyObject * SVF_multiply(SVF *self, PyObject *arg) { MULTIPLY };
-static PyObject * SVF_inplace_multiply(SVF *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * SVF_add(SVF *self, PyObject *arg) { ADD };
-static PyObject * SVF_inplace_add(SVF *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * SVF_sub(SVF *self, PyObject *arg) { SUB };
-static PyObject * SVF_inplace_sub(SVF *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * SVF_div(SVF *self, PyObject *arg) { DIV };
-static PyObject * SVF_inplace_div(SVF *self, PyObject *arg) { INPLACE_DIV };
-
-static PyObject *
-SVF_setFreq(SVF *self, PyObject *arg)
-{
-	PyObject *tmp, *streamtmp;
-
-	if (arg == NULL) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	int isNumber = PyNumber_Check(arg);
+    self->halfSize = (int)(self->size / 2);
+    self->oneOnSize = 1.0 / (double)self->size;
 
-	tmp = arg;
-	Py_INCREF(tmp);
-	Py_DECREF(self->freq);
-	if (isNumber == 1) {
-		self->freq = PyNumber_Float(tmp);
-        self->modebuffer[2] = 0;
-	}
-	else {
-		self->freq = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->freq, "_getStream", NULL);
-        Py_INCREF(streamtmp);
-        Py_XDECREF(self->freq_stream);
-        self->freq_stream = (Stream *)streamtmp;
-		self->modebuffer[2] = 1;
-	}
+    self->buffer = (MYFLT *)realloc(self->buffer, (self->size) * sizeof(MYFLT));
+    for (i=0; i<(self->size); i++) {
+        self->buffer[i] = 0.;
+    }
 
     (*self->mode_func_ptr)(self);
 
-	Py_INCREF(Py_None);
-	return Py_None;
+    return (PyObject *)self;
 }
 
-static PyObject *
-SVF_setQ(SVF *self, PyObject *arg)
-{
-	PyObject *tmp, *streamtmp;
-
-	if (arg == NULL) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	int isNumber = PyNumber_Check(arg);
-
-	tmp = arg;
-	Py_INCREF(tmp);
-	Py_DECREF(self->q);
-	if (isNumber == 1) {
-		self->q = PyNumber_Float(tmp);
-        self->modebuffer[3] = 0;
-	}
-	else {
-		self->q = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->q, "_getStream", NULL);
-        Py_INCREF(streamtmp);
-        Py_XDECREF(self->q_stream);
-        self->q_stream = (Stream *)streamtmp;
-		self->modebuffer[3] = 1;
-	}
+static PyObject * Average_getServer(Average* self) { GET_SERVER };
+static PyObject * Average_getStream(Average* self) { GET_STREAM };
+static PyObject * Average_setMul(Average *self, PyObject *arg) { SET_MUL };
+static PyObject * Average_setAdd(Average *self, PyObject *arg) { SET_ADD };
+static PyObject * Average_setSub(Average *self, PyObject *arg) { SET_SUB };
+static PyObject * Average_setDiv(Average *self, PyObject *arg) { SET_DIV };
 
-    (*self->mode_func_ptr)(self);
+static PyObject * Average_play(Average *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * Average_out(Average *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * Average_stop(Average *self) { STOP };
 
-	Py_INCREF(Py_None);
-	return Py_None;
-}
+static PyObject * Average_multiply(Average *self, PyObject *arg) { MULTIPLY };
+static PyObject * Average_inplace_multiply(Average *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * Average_add(Average *self, PyObject *arg) { ADD };
+static PyObject * Average_inplace_add(Average *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * Average_sub(Average *self, PyObject *arg) { SUB };
+static PyObject * Average_inplace_sub(Average *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * Average_div(Average *self, PyObject *arg) { DIV };
+static PyObject * Average_inplace_div(Average *self, PyObject *arg) { INPLACE_DIV };
 
 static PyObject *
-SVF_setType(SVF *self, PyObject *arg)
+Average_setSize(Average *self, PyObject *arg)
 {
-	PyObject *tmp, *streamtmp;
-
+	int i;
 	if (arg == NULL) {
 		Py_INCREF(Py_None);
 		return Py_None;
 	}
 
-	int isNumber = PyNumber_Check(arg);
+	int isInt = PyInt_Check(arg);
 
-	tmp = arg;
-	Py_INCREF(tmp);
-	Py_DECREF(self->type);
-	if (isNumber == 1) {
-		self->type = PyNumber_Float(tmp);
-        self->modebuffer[4] = 0;
-	}
-	else {
-		self->type = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->type, "_getStream", NULL);
-        Py_INCREF(streamtmp);
-        Py_XDECREF(self->type_stream);
-        self->type_stream = (Stream *)streamtmp;
-		self->modebuffer[4] = 1;
+	if (isInt == 1) {
+		self->size = PyInt_AsLong(arg);
+        self->halfSize = (int)(self->size / 2);
+        self->oneOnSize = 1.0 / (double)self->size;
+        self->init = 1;
+        self->in_count = 0;
+        self->currentValue = 0.0;
+        self->buffer = (MYFLT *)realloc(self->buffer, (self->size) * sizeof(MYFLT));
+        for (i=0; i<(self->size); i++) {
+            self->buffer[i] = 0.;
+        }
 	}
 
-    (*self->mode_func_ptr)(self);
-
 	Py_INCREF(Py_None);
 	return Py_None;
 }
 
-static PyMemberDef SVF_members[] = {
-    {"server", T_OBJECT_EX, offsetof(SVF, server), 0, "Pyo server."},
-    {"stream", T_OBJECT_EX, offsetof(SVF, stream), 0, "Stream object."},
-    {"input", T_OBJECT_EX, offsetof(SVF, input), 0, "Input sound object."},
-    {"freq", T_OBJECT_EX, offsetof(SVF, freq), 0, "Cutoff frequency in cycle per second."},
-    {"q", T_OBJECT_EX, offsetof(SVF, q), 0, "Q factor."},
-    {"type", T_OBJECT_EX, offsetof(SVF, type), 0, "Filter type."},
-    {"mul", T_OBJECT_EX, offsetof(SVF, mul), 0, "Mul factor."},
-    {"add", T_OBJECT_EX, offsetof(SVF, add), 0, "Add factor."},
+static PyMemberDef Average_members[] = {
+    {"server", T_OBJECT_EX, offsetof(Average, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(Average, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(Average, input), 0, "Input sound object."},
+    {"mul", T_OBJECT_EX, offsetof(Average, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(Average, add), 0, "Add factor."},
     {NULL}  /* Sentinel */
 };
 
-static PyMethodDef SVF_methods[] = {
-    {"getServer", (PyCFunction)SVF_getServer, METH_NOARGS, "Returns server object."},
-    {"_getStream", (PyCFunction)SVF_getStream, METH_NOARGS, "Returns stream object."},
-    {"play", (PyCFunction)SVF_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-    {"out", (PyCFunction)SVF_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-    {"stop", (PyCFunction)SVF_stop, METH_NOARGS, "Stops computing."},
-	{"setFreq", (PyCFunction)SVF_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
-    {"setQ", (PyCFunction)SVF_setQ, METH_O, "Sets filter Q factor."},
-    {"setType", (PyCFunction)SVF_setType, METH_O, "Sets filter type factor."},
-	{"setMul", (PyCFunction)SVF_setMul, METH_O, "Sets mul factor."},
-	{"setAdd", (PyCFunction)SVF_setAdd, METH_O, "Sets add factor."},
-    {"setSub", (PyCFunction)SVF_setSub, METH_O, "Sets inverse add factor."},
-    {"setDiv", (PyCFunction)SVF_setDiv, METH_O, "Sets inverse mul factor."},
+static PyMethodDef Average_methods[] = {
+    {"getServer", (PyCFunction)Average_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)Average_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)Average_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)Average_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)Average_stop, METH_NOARGS, "Stops computing."},
+	{"setSize", (PyCFunction)Average_setSize, METH_O, "Sets filter kernel size."},
+	{"setMul", (PyCFunction)Average_setMul, METH_O, "Sets oscillator mul factor."},
+	{"setAdd", (PyCFunction)Average_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)Average_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)Average_setDiv, METH_O, "Sets inverse mul factor."},
     {NULL}  /* Sentinel */
 };
 
-static PyNumberMethods SVF_as_number = {
-    (binaryfunc)SVF_add,                         /*nb_add*/
-    (binaryfunc)SVF_sub,                         /*nb_subtract*/
-    (binaryfunc)SVF_multiply,                    /*nb_multiply*/
-    (binaryfunc)SVF_div,                                              /*nb_divide*/
-    0,                                              /*nb_remainder*/
-    0,                                              /*nb_divmod*/
-    0,                                              /*nb_power*/
-    0,                                              /*nb_neg*/
-    0,                                              /*nb_pos*/
-    0,                                              /*(unaryfunc)array_abs,*/
-    0,                                              /*nb_nonzero*/
-    0,                                              /*nb_invert*/
-    0,                                              /*nb_lshift*/
-    0,                                              /*nb_rshift*/
-    0,                                              /*nb_and*/
-    0,                                              /*nb_xor*/
-    0,                                              /*nb_or*/
-    0,                                              /*nb_coerce*/
-    0,                                              /*nb_int*/
-    0,                                              /*nb_long*/
-    0,                                              /*nb_float*/
-    0,                                              /*nb_oct*/
-    0,                                              /*nb_hex*/
-    (binaryfunc)SVF_inplace_add,                 /*inplace_add*/
-    (binaryfunc)SVF_inplace_sub,                 /*inplace_subtract*/
-    (binaryfunc)SVF_inplace_multiply,            /*inplace_multiply*/
-    (binaryfunc)SVF_inplace_div,                                              /*inplace_divide*/
-    0,                                              /*inplace_remainder*/
-    0,                                              /*inplace_power*/
-    0,                                              /*inplace_lshift*/
-    0,                                              /*inplace_rshift*/
-    0,                                              /*inplace_and*/
-    0,                                              /*inplace_xor*/
-    0,                                              /*inplace_or*/
-    0,                                              /*nb_floor_divide*/
-    0,                                              /*nb_true_divide*/
-    0,                                              /*nb_inplace_floor_divide*/
-    0,                                              /*nb_inplace_true_divide*/
-    0,                                              /* nb_index */
+static PyNumberMethods Average_as_number = {
+    (binaryfunc)Average_add,                      /*nb_add*/
+    (binaryfunc)Average_sub,                 /*nb_subtract*/
+    (binaryfunc)Average_multiply,                 /*nb_multiply*/
+    (binaryfunc)Average_div,                   /*nb_divide*/
+    0,                /*nb_remainder*/
+    0,                   /*nb_divmod*/
+    0,                   /*nb_power*/
+    0,                  /*nb_neg*/
+    0,                /*nb_pos*/
+    0,                  /*(unaryfunc)array_abs,*/
+    0,                    /*nb_nonzero*/
+    0,                    /*nb_invert*/
+    0,               /*nb_lshift*/
+    0,              /*nb_rshift*/
+    0,              /*nb_and*/
+    0,              /*nb_xor*/
+    0,               /*nb_or*/
+    0,                                          /*nb_coerce*/
+    0,                       /*nb_int*/
+    0,                      /*nb_long*/
+    0,                     /*nb_float*/
+    0,                       /*nb_oct*/
+    0,                       /*nb_hex*/
+    (binaryfunc)Average_inplace_add,              /*inplace_add*/
+    (binaryfunc)Average_inplace_sub,         /*inplace_subtract*/
+    (binaryfunc)Average_inplace_multiply,         /*inplace_multiply*/
+    (binaryfunc)Average_inplace_div,           /*inplace_divide*/
+    0,        /*inplace_remainder*/
+    0,           /*inplace_power*/
+    0,       /*inplace_lshift*/
+    0,      /*inplace_rshift*/
+    0,      /*inplace_and*/
+    0,      /*inplace_xor*/
+    0,       /*inplace_or*/
+    0,             /*nb_floor_divide*/
+    0,              /*nb_true_divide*/
+    0,     /*nb_inplace_floor_divide*/
+    0,      /*nb_inplace_true_divide*/
+    0,                     /* nb_index */
 };
 
-PyTypeObject SVFType = {
+PyTypeObject AverageType = {
     PyObject_HEAD_INIT(NULL)
-    0,                                              /*ob_size*/
-    "_pyo.SVF_base",                                   /*tp_name*/
-    sizeof(SVF),                                 /*tp_basicsize*/
-    0,                                              /*tp_itemsize*/
-    (destructor)SVF_dealloc,                     /*tp_dealloc*/
-    0,                                              /*tp_print*/
-    0,                                              /*tp_getattr*/
-    0,                                              /*tp_setattr*/
-    0,                                              /*tp_compare*/
-    0,                                              /*tp_repr*/
-    &SVF_as_number,                              /*tp_as_number*/
-    0,                                              /*tp_as_sequence*/
-    0,                                              /*tp_as_mapping*/
-    0,                                              /*tp_hash */
-    0,                                              /*tp_call*/
-    0,                                              /*tp_str*/
-    0,                                              /*tp_getattro*/
-    0,                                              /*tp_setattro*/
-    0,                                              /*tp_as_buffer*/
+    0,                         /*ob_size*/
+    "_pyo.Average_base",         /*tp_name*/
+    sizeof(Average),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)Average_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    &Average_as_number,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
     Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-    "SVF objects. Generates a state variable filter.",           /* tp_doc */
-    (traverseproc)SVF_traverse,                  /* tp_traverse */
-    (inquiry)SVF_clear,                          /* tp_clear */
-    0,                                              /* tp_richcompare */
-    0,                                              /* tp_weaklistoffset */
-    0,                                              /* tp_iter */
-    0,                                              /* tp_iternext */
-    SVF_methods,                                 /* tp_methods */
-    SVF_members,                                 /* tp_members */
-    0,                                              /* tp_getset */
-    0,                                              /* tp_base */
-    0,                                              /* tp_dict */
-    0,                                              /* tp_descr_get */
-    0,                                              /* tp_descr_set */
-    0,                                              /* tp_dictoffset */
-    0,                          /* tp_init */
-    0,                                              /* tp_alloc */
-    SVF_new,                                     /* tp_new */
+    "Average objects. Moving average filter.",           /* tp_doc */
+    (traverseproc)Average_traverse,   /* tp_traverse */
+    (inquiry)Average_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    Average_methods,             /* tp_methods */
+    Average_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    Average_new,                 /* tp_new */
 };
 
-typedef struct {
-    pyo_audio_HEAD
-    PyObject *input;
-    Stream *input_stream;
-    int size;
-    int halfSize;
-    int in_count;
-    int init;
-    double currentValue;
-    double oneOnSize;
-    int modebuffer[2];
-    MYFLT *buffer; // samples memory
-} Average;
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream *input_stream;
+    PyObject *freq;
+    Stream *freq_stream;
+    PyObject *q;
+    Stream *q_stream;
+    int modebuffer[4]; // need at least 2 slots for mul & add
+    MYFLT nyquist;
+    MYFLT last_freq;
+    MYFLT last_q;
+    MYFLT twopiOverSr;
+    // sample memories
+    MYFLT x1;
+    MYFLT x2;
+    MYFLT y1;
+    MYFLT y2;
+    // coefficients
+    MYFLT b1;
+    MYFLT b2;
+    MYFLT a;
+} Reson;
+
+static void
+Reson_compute_coeffs(Reson *self, MYFLT freq, MYFLT q)
+{
+    MYFLT bw;
+
+    if (freq < 0.1)
+        freq = 0.1;
+    else if (freq > self->nyquist)
+        freq = self->nyquist;
+    if (q < 0.1)
+        q = 0.1;
+
+    bw = freq / q;
+
+    self->b2 = MYEXP(-self->twopiOverSr * bw);
+    self->b1 = (-4.0 * self->b2) / (1.0 + self->b2) * MYCOS(freq * self->twopiOverSr);
+    self->a = 1.0 - MYSQRT(self->b2);
+}
 
 static void
-Average_process_i(Average *self) {
+Reson_filters_ii(Reson *self) {
+    MYFLT val, fr, q;
     int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    fr = PyFloat_AS_DOUBLE(self->freq);
+    q = PyFloat_AS_DOUBLE(self->q);
+
+    if (fr != self->last_freq || q != self->last_q) {
+        self->last_freq = fr;
+        self->last_q = q;
+        Reson_compute_coeffs(self, fr, q);
+    }
+
+    for (i=0; i<self->bufsize; i++) {
+        val = (self->a * in[i]) - (self->a * self->x2) - (self->b1 * self->y1) - (self->b2 * self->y2);
+        self->y2 = self->y1;
+        self->data[i] = self->y1 = val;
+        self->x2 = self->x1;
+        self->x1 = in[i];
+    }
+}
 
+static void
+Reson_filters_ai(Reson *self) {
+    MYFLT val, fr, q;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
+    q = PyFloat_AS_DOUBLE(self->q);
 
-    if (self->init) {
-        for (i=0; i<self->bufsize; i++) {
-            if (self->init) {
-                self->buffer[self->in_count] = in[i];
-                self->currentValue += (double)in[i];
-                self->in_count++;
-                if (self->in_count < self->halfSize)
-                    self->data[i] = 0.0;
-                else
-                    self->data[i] = (MYFLT)(self->currentValue * self->oneOnSize);
-                if (self->in_count >= self->size) {
-                    self->in_count = 0;
-                    self->init = 0;
-                }
-            }
-            else {
-                self->buffer[self->in_count] = in[i];
-                self->currentValue += (double)in[i];
-                self->in_count++;
-                if (self->in_count >= self->size)
-                    self->in_count = 0;
-                self->currentValue -= (double)self->buffer[self->in_count];
-                self->data[i] = (MYFLT)(self->currentValue * self->oneOnSize);
-            }
+    for (i=0; i<self->bufsize; i++) {
+        fr = freq[i];
+        if (fr != self->last_freq || q != self->last_q) {
+            self->last_freq = fr;
+            self->last_q = q;
+            Reson_compute_coeffs(self, fr, q);
         }
+        val = (self->a * in[i]) - (self->a * self->x2) - (self->b1 * self->y1) - (self->b2 * self->y2);
+        self->y2 = self->y1;
+        self->data[i] = self->y1 = val;
+        self->x2 = self->x1;
+        self->x1 = in[i];
     }
-    else {
-        for (i=0; i<self->bufsize; i++) {
-            self->buffer[self->in_count] = in[i];
-            self->currentValue += (double)in[i];
-            self->in_count++;
-            if (self->in_count >= self->size)
-                self->in_count = 0;
-            self->currentValue -= (double)self->buffer[self->in_count];
-            self->data[i] = (MYFLT)(self->currentValue * self->oneOnSize);
+}
+
+static void
+Reson_filters_ia(Reson *self) {
+    MYFLT val, fr, q;
+    int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    fr = PyFloat_AS_DOUBLE(self->freq);
+    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        q = qst[i];
+        if (fr != self->last_freq || q != self->last_q) {
+            self->last_freq = fr;
+            self->last_q = q;
+            Reson_compute_coeffs(self, fr, q);
         }
+        val = (self->a * in[i]) - (self->a * self->x2) - (self->b1 * self->y1) - (self->b2 * self->y2);
+        self->y2 = self->y1;
+        self->data[i] = self->y1 = val;
+        self->x2 = self->x1;
+        self->x1 = in[i];
     }
 }
 
-static void Average_postprocessing_ii(Average *self) { POST_PROCESSING_II };
-static void Average_postprocessing_ai(Average *self) { POST_PROCESSING_AI };
-static void Average_postprocessing_ia(Average *self) { POST_PROCESSING_IA };
-static void Average_postprocessing_aa(Average *self) { POST_PROCESSING_AA };
-static void Average_postprocessing_ireva(Average *self) { POST_PROCESSING_IREVA };
-static void Average_postprocessing_areva(Average *self) { POST_PROCESSING_AREVA };
-static void Average_postprocessing_revai(Average *self) { POST_PROCESSING_REVAI };
-static void Average_postprocessing_revaa(Average *self) { POST_PROCESSING_REVAA };
-static void Average_postprocessing_revareva(Average *self) { POST_PROCESSING_REVAREVA };
+static void
+Reson_filters_aa(Reson *self) {
+    MYFLT val, fr, q;
+    int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
+    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        fr = freq[i];
+        q = qst[i];
+        if (fr != self->last_freq || q != self->last_q) {
+            self->last_freq = fr;
+            self->last_q = q;
+            Reson_compute_coeffs(self, fr, q);
+        }
+        val = (self->a * in[i]) - (self->a * self->x2) - (self->b1 * self->y1) - (self->b2 * self->y2);
+        self->y2 = self->y1;
+        self->data[i] = self->y1 = val;
+        self->x2 = self->x1;
+        self->x1 = in[i];
+    }
+}
+
+static void Reson_postprocessing_ii(Reson *self) { POST_PROCESSING_II };
+static void Reson_postprocessing_ai(Reson *self) { POST_PROCESSING_AI };
+static void Reson_postprocessing_ia(Reson *self) { POST_PROCESSING_IA };
+static void Reson_postprocessing_aa(Reson *self) { POST_PROCESSING_AA };
+static void Reson_postprocessing_ireva(Reson *self) { POST_PROCESSING_IREVA };
+static void Reson_postprocessing_areva(Reson *self) { POST_PROCESSING_AREVA };
+static void Reson_postprocessing_revai(Reson *self) { POST_PROCESSING_REVAI };
+static void Reson_postprocessing_revaa(Reson *self) { POST_PROCESSING_REVAA };
+static void Reson_postprocessing_revareva(Reson *self) { POST_PROCESSING_REVAREVA };
 
 static void
-Average_setProcMode(Average *self)
+Reson_setProcMode(Reson *self)
 {
-    int muladdmode;
+    int procmode, muladdmode;
+    procmode = self->modebuffer[2] + self->modebuffer[3] * 10;
     muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
 
-    self->proc_func_ptr = Average_process_i;
-
+	switch (procmode) {
+        case 0:
+            self->proc_func_ptr = Reson_filters_ii;
+            break;
+        case 1:
+            self->proc_func_ptr = Reson_filters_ai;
+            break;
+        case 10:
+            self->proc_func_ptr = Reson_filters_ia;
+            break;
+        case 11:
+            self->proc_func_ptr = Reson_filters_aa;
+            break;
+    }
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = Average_postprocessing_ii;
+            self->muladd_func_ptr = Reson_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = Average_postprocessing_ai;
+            self->muladd_func_ptr = Reson_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = Average_postprocessing_revai;
+            self->muladd_func_ptr = Reson_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = Average_postprocessing_ia;
+            self->muladd_func_ptr = Reson_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = Average_postprocessing_aa;
+            self->muladd_func_ptr = Reson_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = Average_postprocessing_revaa;
+            self->muladd_func_ptr = Reson_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = Average_postprocessing_ireva;
+            self->muladd_func_ptr = Reson_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = Average_postprocessing_areva;
+            self->muladd_func_ptr = Reson_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = Average_postprocessing_revareva;
+            self->muladd_func_ptr = Reson_postprocessing_revareva;
             break;
     }
 }
 
 static void
-Average_compute_next_data_frame(Average *self)
+Reson_compute_next_data_frame(Reson *self)
 {
     (*self->proc_func_ptr)(self);
     (*self->muladd_func_ptr)(self);
 }
 
 static int
-Average_traverse(Average *self, visitproc visit, void *arg)
+Reson_traverse(Reson *self, visitproc visit, void *arg)
 {
     pyo_VISIT
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
+    Py_VISIT(self->freq);
+    Py_VISIT(self->freq_stream);
+    Py_VISIT(self->q);
+    Py_VISIT(self->q_stream);
     return 0;
 }
 
 static int
-Average_clear(Average *self)
+Reson_clear(Reson *self)
 {
     pyo_CLEAR
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
+    Py_CLEAR(self->freq);
+    Py_CLEAR(self->freq_stream);
+    Py_CLEAR(self->q);
+    Py_CLEAR(self->q_stream);
     return 0;
 }
 
 static void
-Average_dealloc(Average* self)
+Reson_dealloc(Reson* self)
 {
     pyo_DEALLOC
-    free(self->buffer);
-    Average_clear(self);
+    Reson_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
 static PyObject *
-Average_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+Reson_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
-    PyObject *inputtmp, *input_streamtmp, *multmp=NULL, *addtmp=NULL;
-    Average *self;
-    self = (Average *)type->tp_alloc(type, 0);
+    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *qtmp=NULL, *multmp=NULL, *addtmp=NULL;
+    Reson *self;
+    self = (Reson *)type->tp_alloc(type, 0);
 
-    self->size = 10;
-    self->init = 1;
-    self->in_count = 0;
-    self->currentValue = 0.0;
+    self->freq = PyFloat_FromDouble(1000);
+    self->q = PyFloat_FromDouble(1);
+    self->last_freq = self->last_q = -1.0;
+    self->x1 = self->x2 = self->y1 = self->y2 = 0.0;
+    self->a = self->b1 = self->b2 = 0.0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
+	self->modebuffer[2] = 0;
+	self->modebuffer[3] = 0;
 
     INIT_OBJECT_COMMON
-    Stream_setFunctionPtr(self->stream, Average_compute_next_data_frame);
-    self->mode_func_ptr = Average_setProcMode;
 
-    static char *kwlist[] = {"input", "size", "mul", "add", NULL};
+    self->nyquist = (MYFLT)self->sr * 0.49;
+    self->twopiOverSr = TWOPI / (MYFLT)self->sr;
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|iOO", kwlist, &inputtmp, &self->size, &multmp, &addtmp))
+    Stream_setFunctionPtr(self->stream, Reson_compute_next_data_frame);
+    self->mode_func_ptr = Reson_setProcMode;
+
+    static char *kwlist[] = {"input", "freq", "q", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOO", kwlist, &inputtmp, &freqtmp, &qtmp, &multmp, &addtmp))
         Py_RETURN_NONE;
 
-    INIT_INPUT_STREAM
+    INIT_INPUT_STREAM
+
+    if (freqtmp) {
+        PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
+    }
+
+    if (qtmp) {
+        PyObject_CallMethod((PyObject *)self, "setQ", "O", qtmp);
+    }
 
     if (multmp) {
         PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
@@ -8033,172 +8943,207 @@ Average_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     PyObject_CallMethod(self->server, "addStream", "O", self->stream);
 
-    self->halfSize = (int)(self->size / 2);
-    self->oneOnSize = 1.0 / (double)self->size;
-
-    self->buffer = (MYFLT *)realloc(self->buffer, (self->size) * sizeof(MYFLT));
-    for (i=0; i<(self->size); i++) {
-        self->buffer[i] = 0.;
-    }
-
     (*self->mode_func_ptr)(self);
 
     return (PyObject *)self;
 }
 
-static PyObject * Average_getServer(Average* self) { GET_SERVER };
-static PyObject * Average_getStream(Average* self) { GET_STREAM };
-static PyObject * Average_setMul(Average *self, PyObject *arg) { SET_MUL };
-static PyObject * Average_setAdd(Average *self, PyObject *arg) { SET_ADD };
-static PyObject * Average_setSub(Average *self, PyObject *arg) { SET_SUB };
-static PyObject * Average_setDiv(Average *self, PyObject *arg) { SET_DIV };
+static PyObject * Reson_getServer(Reson* self) { GET_SERVER };
+static PyObject * Reson_getStream(Reson* self) { GET_STREAM };
+static PyObject * Reson_setMul(Reson *self, PyObject *arg) { SET_MUL };
+static PyObject * Reson_setAdd(Reson *self, PyObject *arg) { SET_ADD };
+static PyObject * Reson_setSub(Reson *self, PyObject *arg) { SET_SUB };
+static PyObject * Reson_setDiv(Reson *self, PyObject *arg) { SET_DIV };
 
-static PyObject * Average_play(Average *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * Average_out(Average *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * Average_stop(Average *self) { STOP };
+static PyObject * Reson_play(Reson *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * Reson_out(Reson *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * Reson_stop(Reson *self) { STOP };
 
-static PyObject * Average_multiply(Average *self, PyObject *arg) { MULTIPLY };
-static PyObject * Average_inplace_multiply(Average *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * Average_add(Average *self, PyObject *arg) { ADD };
-static PyObject * Average_inplace_add(Average *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * Average_sub(Average *self, PyObject *arg) { SUB };
-static PyObject * Average_inplace_sub(Average *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * Average_div(Average *self, PyObject *arg) { DIV };
-static PyObject * Average_inplace_div(Average *self, PyObject *arg) { INPLACE_DIV };
+static PyObject * Reson_multiply(Reson *self, PyObject *arg) { MULTIPLY };
+static PyObject * Reson_inplace_multiply(Reson *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * Reson_add(Reson *self, PyObject *arg) { ADD };
+static PyObject * Reson_inplace_add(Reson *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * Reson_sub(Reson *self, PyObject *arg) { SUB };
+static PyObject * Reson_inplace_sub(Reson *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * Reson_div(Reson *self, PyObject *arg) { DIV };
+static PyObject * Reson_inplace_div(Reson *self, PyObject *arg) { INPLACE_DIV };
 
 static PyObject *
-Average_setSize(Average *self, PyObject *arg)
+Reson_setFreq(Reson *self, PyObject *arg)
 {
-	int i;
+	PyObject *tmp, *streamtmp;
+
 	if (arg == NULL) {
 		Py_INCREF(Py_None);
 		return Py_None;
 	}
 
-	int isInt = PyInt_Check(arg);
+	int isNumber = PyNumber_Check(arg);
 
-	if (isInt == 1) {
-		self->size = PyInt_AsLong(arg);
-        self->halfSize = (int)(self->size / 2);
-        self->oneOnSize = 1.0 / (double)self->size;
-        self->init = 1;
-        self->in_count = 0;
-        self->currentValue = 0.0;
-        self->buffer = (MYFLT *)realloc(self->buffer, (self->size) * sizeof(MYFLT));
-        for (i=0; i<(self->size); i++) {
-            self->buffer[i] = 0.;
-        }
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->freq);
+	if (isNumber == 1) {
+		self->freq = PyNumber_Float(tmp);
+        self->modebuffer[2] = 0;
+	}
+	else {
+		self->freq = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->freq, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->freq_stream);
+        self->freq_stream = (Stream *)streamtmp;
+		self->modebuffer[2] = 1;
 	}
 
+    (*self->mode_func_ptr)(self);
+
 	Py_INCREF(Py_None);
 	return Py_None;
 }
 
-static PyMemberDef Average_members[] = {
-    {"server", T_OBJECT_EX, offsetof(Average, server), 0, "Pyo server."},
-    {"stream", T_OBJECT_EX, offsetof(Average, stream), 0, "Stream object."},
-    {"input", T_OBJECT_EX, offsetof(Average, input), 0, "Input sound object."},
-    {"mul", T_OBJECT_EX, offsetof(Average, mul), 0, "Mul factor."},
-    {"add", T_OBJECT_EX, offsetof(Average, add), 0, "Add factor."},
+static PyObject *
+Reson_setQ(Reson *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->q);
+	if (isNumber == 1) {
+		self->q = PyNumber_Float(tmp);
+        self->modebuffer[3] = 0;
+	}
+	else {
+		self->q = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->q, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->q_stream);
+        self->q_stream = (Stream *)streamtmp;
+		self->modebuffer[3] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyMemberDef Reson_members[] = {
+    {"server", T_OBJECT_EX, offsetof(Reson, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(Reson, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(Reson, input), 0, "Input sound object."},
+    {"freq", T_OBJECT_EX, offsetof(Reson, freq), 0, "Cutoff frequency in cycle per second."},
+    {"q", T_OBJECT_EX, offsetof(Reson, q), 0, "Q factor."},
+    {"mul", T_OBJECT_EX, offsetof(Reson, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(Reson, add), 0, "Add factor."},
     {NULL}  /* Sentinel */
 };
 
-static PyMethodDef Average_methods[] = {
-    {"getServer", (PyCFunction)Average_getServer, METH_NOARGS, "Returns server object."},
-    {"_getStream", (PyCFunction)Average_getStream, METH_NOARGS, "Returns stream object."},
-    {"play", (PyCFunction)Average_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-    {"out", (PyCFunction)Average_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-    {"stop", (PyCFunction)Average_stop, METH_NOARGS, "Stops computing."},
-	{"setSize", (PyCFunction)Average_setSize, METH_O, "Sets filter kernel size."},
-	{"setMul", (PyCFunction)Average_setMul, METH_O, "Sets oscillator mul factor."},
-	{"setAdd", (PyCFunction)Average_setAdd, METH_O, "Sets oscillator add factor."},
-    {"setSub", (PyCFunction)Average_setSub, METH_O, "Sets inverse add factor."},
-    {"setDiv", (PyCFunction)Average_setDiv, METH_O, "Sets inverse mul factor."},
+static PyMethodDef Reson_methods[] = {
+    {"getServer", (PyCFunction)Reson_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)Reson_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)Reson_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)Reson_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)Reson_stop, METH_NOARGS, "Stops computing."},
+	{"setFreq", (PyCFunction)Reson_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
+    {"setQ", (PyCFunction)Reson_setQ, METH_O, "Sets filter Q factor."},
+	{"setMul", (PyCFunction)Reson_setMul, METH_O, "Sets oscillator mul factor."},
+	{"setAdd", (PyCFunction)Reson_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)Reson_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)Reson_setDiv, METH_O, "Sets inverse mul factor."},
     {NULL}  /* Sentinel */
 };
 
-static PyNumberMethods Average_as_number = {
-    (binaryfunc)Average_add,                      /*nb_add*/
-    (binaryfunc)Average_sub,                 /*nb_subtract*/
-    (binaryfunc)Average_multiply,                 /*nb_multiply*/
-    (binaryfunc)Average_div,                   /*nb_divide*/
-    0,                /*nb_remainder*/
-    0,                   /*nb_divmod*/
-    0,                   /*nb_power*/
-    0,                  /*nb_neg*/
-    0,                /*nb_pos*/
-    0,                  /*(unaryfunc)array_abs,*/
-    0,                    /*nb_nonzero*/
-    0,                    /*nb_invert*/
-    0,               /*nb_lshift*/
-    0,              /*nb_rshift*/
-    0,              /*nb_and*/
-    0,              /*nb_xor*/
-    0,               /*nb_or*/
-    0,                                          /*nb_coerce*/
-    0,                       /*nb_int*/
-    0,                      /*nb_long*/
-    0,                     /*nb_float*/
-    0,                       /*nb_oct*/
-    0,                       /*nb_hex*/
-    (binaryfunc)Average_inplace_add,              /*inplace_add*/
-    (binaryfunc)Average_inplace_sub,         /*inplace_subtract*/
-    (binaryfunc)Average_inplace_multiply,         /*inplace_multiply*/
-    (binaryfunc)Average_inplace_div,           /*inplace_divide*/
-    0,        /*inplace_remainder*/
-    0,           /*inplace_power*/
-    0,       /*inplace_lshift*/
-    0,      /*inplace_rshift*/
-    0,      /*inplace_and*/
-    0,      /*inplace_xor*/
-    0,       /*inplace_or*/
-    0,             /*nb_floor_divide*/
-    0,              /*nb_true_divide*/
-    0,     /*nb_inplace_floor_divide*/
-    0,      /*nb_inplace_true_divide*/
-    0,                     /* nb_index */
+static PyNumberMethods Reson_as_number = {
+    (binaryfunc)Reson_add,                         /*nb_add*/
+    (binaryfunc)Reson_sub,                         /*nb_subtract*/
+    (binaryfunc)Reson_multiply,                    /*nb_multiply*/
+    (binaryfunc)Reson_div,                                              /*nb_divide*/
+    0,                                              /*nb_remainder*/
+    0,                                              /*nb_divmod*/
+    0,                                              /*nb_power*/
+    0,                                              /*nb_neg*/
+    0,                                              /*nb_pos*/
+    0,                                              /*(unaryfunc)array_abs,*/
+    0,                                              /*nb_nonzero*/
+    0,                                              /*nb_invert*/
+    0,                                              /*nb_lshift*/
+    0,                                              /*nb_rshift*/
+    0,                                              /*nb_and*/
+    0,                                              /*nb_xor*/
+    0,                                              /*nb_or*/
+    0,                                              /*nb_coerce*/
+    0,                                              /*nb_int*/
+    0,                                              /*nb_long*/
+    0,                                              /*nb_float*/
+    0,                                              /*nb_oct*/
+    0,                                              /*nb_hex*/
+    (binaryfunc)Reson_inplace_add,                 /*inplace_add*/
+    (binaryfunc)Reson_inplace_sub,                 /*inplace_subtract*/
+    (binaryfunc)Reson_inplace_multiply,            /*inplace_multiply*/
+    (binaryfunc)Reson_inplace_div,                                              /*inplace_divide*/
+    0,                                              /*inplace_remainder*/
+    0,                                              /*inplace_power*/
+    0,                                              /*inplace_lshift*/
+    0,                                              /*inplace_rshift*/
+    0,                                              /*inplace_and*/
+    0,                                              /*inplace_xor*/
+    0,                                              /*inplace_or*/
+    0,                                              /*nb_floor_divide*/
+    0,                                              /*nb_true_divide*/
+    0,                                              /*nb_inplace_floor_divide*/
+    0,                                              /*nb_inplace_true_divide*/
+    0,                                              /* nb_index */
 };
 
-PyTypeObject AverageType = {
+PyTypeObject ResonType = {
     PyObject_HEAD_INIT(NULL)
-    0,                         /*ob_size*/
-    "_pyo.Average_base",         /*tp_name*/
-    sizeof(Average),         /*tp_basicsize*/
-    0,                         /*tp_itemsize*/
-    (destructor)Average_dealloc, /*tp_dealloc*/
-    0,                         /*tp_print*/
-    0,                         /*tp_getattr*/
-    0,                         /*tp_setattr*/
-    0,                         /*tp_compare*/
-    0,                         /*tp_repr*/
-    &Average_as_number,             /*tp_as_number*/
-    0,                         /*tp_as_sequence*/
-    0,                         /*tp_as_mapping*/
-    0,                         /*tp_hash */
-    0,                         /*tp_call*/
-    0,                         /*tp_str*/
-    0,                         /*tp_getattro*/
-    0,                         /*tp_setattro*/
-    0,                         /*tp_as_buffer*/
+    0,                                              /*ob_size*/
+    "_pyo.Reson_base",                                   /*tp_name*/
+    sizeof(Reson),                                 /*tp_basicsize*/
+    0,                                              /*tp_itemsize*/
+    (destructor)Reson_dealloc,                     /*tp_dealloc*/
+    0,                                              /*tp_print*/
+    0,                                              /*tp_getattr*/
+    0,                                              /*tp_setattr*/
+    0,                                              /*tp_compare*/
+    0,                                              /*tp_repr*/
+    &Reson_as_number,                              /*tp_as_number*/
+    0,                                              /*tp_as_sequence*/
+    0,                                              /*tp_as_mapping*/
+    0,                                              /*tp_hash */
+    0,                                              /*tp_call*/
+    0,                                              /*tp_str*/
+    0,                                              /*tp_getattro*/
+    0,                                              /*tp_setattro*/
+    0,                                              /*tp_as_buffer*/
     Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-    "Average objects. Moving average filter.",           /* tp_doc */
-    (traverseproc)Average_traverse,   /* tp_traverse */
-    (inquiry)Average_clear,           /* tp_clear */
-    0,		               /* tp_richcompare */
-    0,		               /* tp_weaklistoffset */
-    0,		               /* tp_iter */
-    0,		               /* tp_iternext */
-    Average_methods,             /* tp_methods */
-    Average_members,             /* tp_members */
-    0,                      /* tp_getset */
-    0,                         /* tp_base */
-    0,                         /* tp_dict */
-    0,                         /* tp_descr_get */
-    0,                         /* tp_descr_set */
-    0,                         /* tp_dictoffset */
-    0,      /* tp_init */
-    0,                         /* tp_alloc */
-    Average_new,                 /* tp_new */
+    "Reson objects. Second-order resonant bandpass filter.",           /* tp_doc */
+    (traverseproc)Reson_traverse,                  /* tp_traverse */
+    (inquiry)Reson_clear,                          /* tp_clear */
+    0,                                              /* tp_richcompare */
+    0,                                              /* tp_weaklistoffset */
+    0,                                              /* tp_iter */
+    0,                                              /* tp_iternext */
+    Reson_methods,                                 /* tp_methods */
+    Reson_members,                                 /* tp_members */
+    0,                                              /* tp_getset */
+    0,                                              /* tp_base */
+    0,                                              /* tp_dict */
+    0,                                              /* tp_descr_get */
+    0,                                              /* tp_descr_set */
+    0,                                              /* tp_dictoffset */
+    0,                          /* tp_init */
+    0,                                              /* tp_alloc */
+    Reson_new,                                     /* tp_new */
 };
 
 typedef struct {
@@ -8210,23 +9155,37 @@ typedef struct {
     PyObject *q;
     Stream *q_stream;
     int modebuffer[4]; // need at least 2 slots for mul & add
+    int stages;
     MYFLT nyquist;
     MYFLT last_freq;
     MYFLT last_q;
     MYFLT twopiOverSr;
     // sample memories
-    MYFLT x1;
-    MYFLT x2;
-    MYFLT y1;
-    MYFLT y2;
+    MYFLT *x1;
+    MYFLT *x2;
+    MYFLT *y1;
+    MYFLT *y2;
     // coefficients
     MYFLT b1;
     MYFLT b2;
     MYFLT a;
-} Reson;
+} Resonx;
 
 static void
-Reson_compute_coeffs(Reson *self, MYFLT freq, MYFLT q)
+Resonx_allocate_memories(Resonx *self)
+{
+    int i;
+    self->x1 = (MYFLT *)realloc(self->x1, self->stages * sizeof(MYFLT));
+    self->x2 = (MYFLT *)realloc(self->x2, self->stages * sizeof(MYFLT));
+    self->y1 = (MYFLT *)realloc(self->y1, self->stages * sizeof(MYFLT));
+    self->y2 = (MYFLT *)realloc(self->y2, self->stages * sizeof(MYFLT));
+    for (i=0; i < self->stages; i++) {
+        self->x1[i] = self->x2[i] = self->y1[i] = self->y2[i] = 0.0;
+    }
+}
+
+static void
+Resonx_compute_coeffs(Resonx *self, MYFLT freq, MYFLT q)
 {
     MYFLT bw;
 
@@ -8245,9 +9204,9 @@ Reson_compute_coeffs(Reson *self, MYFLT freq, MYFLT q)
 }
 
 static void
-Reson_filters_ii(Reson *self) {
-    MYFLT val, fr, q;
-    int i;
+Resonx_filters_ii(Resonx *self) {
+    MYFLT vin, vout, fr, q;
+    int i, j;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     fr = PyFloat_AS_DOUBLE(self->freq);
     q = PyFloat_AS_DOUBLE(self->q);
@@ -8255,100 +9214,120 @@ Reson_filters_ii(Reson *self) {
     if (fr != self->last_freq || q != self->last_q) {
         self->last_freq = fr;
         self->last_q = q;
-        Reson_compute_coeffs(self, fr, q);
+        Resonx_compute_coeffs(self, fr, q);
     }
 
+    vout = 0.0;
     for (i=0; i<self->bufsize; i++) {
-        val = (self->a * in[i]) - (self->a * self->x2) - (self->b1 * self->y1) - (self->b2 * self->y2);
-        self->y2 = self->y1;
-        self->data[i] = self->y1 = val;
-        self->x2 = self->x1;
-        self->x1 = in[i];
+        vin = in[i];
+        for (j=0; j<self->stages; j++) {
+            vout = (self->a * vin) - (self->a * self->x2[j]) - (self->b1 * self->y1[j]) - (self->b2 * self->y2[j]);
+            self->x2[j] = self->x1[j];
+            self->x1[j] = vin;
+            self->y2[j] = self->y1[j];
+            self->y1[j] = vin = vout;
+        }
+        self->data[i] = vout;
     }
 }
 
 static void
-Reson_filters_ai(Reson *self) {
-    MYFLT val, fr, q;
-    int i;
+Resonx_filters_ai(Resonx *self) {
+    MYFLT vin, vout, fr, q;
+    int i, j;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
     q = PyFloat_AS_DOUBLE(self->q);
 
+    vout = 0.0;
     for (i=0; i<self->bufsize; i++) {
+        vin = in[i];
         fr = freq[i];
         if (fr != self->last_freq || q != self->last_q) {
             self->last_freq = fr;
             self->last_q = q;
-            Reson_compute_coeffs(self, fr, q);
+            Resonx_compute_coeffs(self, fr, q);
         }
-        val = (self->a * in[i]) - (self->a * self->x2) - (self->b1 * self->y1) - (self->b2 * self->y2);
-        self->y2 = self->y1;
-        self->data[i] = self->y1 = val;
-        self->x2 = self->x1;
-        self->x1 = in[i];
+        for (j=0; j<self->stages; j++) {
+            vout = (self->a * vin) - (self->a * self->x2[j]) - (self->b1 * self->y1[j]) - (self->b2 * self->y2[j]);
+            self->x2[j] = self->x1[j];
+            self->x1[j] = vin;
+            self->y2[j] = self->y1[j];
+            self->y1[j] = vin = vout;
+        }
+        self->data[i] = vout;
     }
 }
 
 static void
-Reson_filters_ia(Reson *self) {
-    MYFLT val, fr, q;
-    int i;
+Resonx_filters_ia(Resonx *self) {
+    MYFLT vin, vout, fr, q;
+    int i, j;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     fr = PyFloat_AS_DOUBLE(self->freq);
     MYFLT *qst = Stream_getData((Stream *)self->q_stream);
 
+    vout = 0.0;
     for (i=0; i<self->bufsize; i++) {
+        vin = in[i];
         q = qst[i];
         if (fr != self->last_freq || q != self->last_q) {
             self->last_freq = fr;
             self->last_q = q;
-            Reson_compute_coeffs(self, fr, q);
+            Resonx_compute_coeffs(self, fr, q);
         }
-        val = (self->a * in[i]) - (self->a * self->x2) - (self->b1 * self->y1) - (self->b2 * self->y2);
-        self->y2 = self->y1;
-        self->data[i] = self->y1 = val;
-        self->x2 = self->x1;
-        self->x1 = in[i];
+        for (j=0; j<self->stages; j++) {
+            vout = (self->a * vin) - (self->a * self->x2[j]) - (self->b1 * self->y1[j]) - (self->b2 * self->y2[j]);
+            self->x2[j] = self->x1[j];
+            self->x1[j] = vin;
+            self->y2[j] = self->y1[j];
+            self->y1[j] = vin = vout;
+        }
+        self->data[i] = vout;
     }
 }
 
 static void
-Reson_filters_aa(Reson *self) {
-    MYFLT val, fr, q;
-    int i;
+Resonx_filters_aa(Resonx *self) {
+    MYFLT vin, vout, fr, q;
+    int i, j;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
     MYFLT *qst = Stream_getData((Stream *)self->q_stream);
 
+    vout = 0.0;
     for (i=0; i<self->bufsize; i++) {
+        vin = in[i];
         fr = freq[i];
         q = qst[i];
         if (fr != self->last_freq || q != self->last_q) {
             self->last_freq = fr;
             self->last_q = q;
-            Reson_compute_coeffs(self, fr, q);
+            Resonx_compute_coeffs(self, fr, q);
         }
-        val = (self->a * in[i]) - (self->a * self->x2) - (self->b1 * self->y1) - (self->b2 * self->y2);
-        self->y2 = self->y1;
-        self->data[i] = self->y1 = val;
-        self->x2 = self->x1;
-        self->x1 = in[i];
+        for (j=0; j<self->stages; j++) {
+            vout = (self->a * vin) - (self->a * self->x2[j]) - (self->b1 * self->y1[j]) - (self->b2 * self->y2[j]);
+            self->x2[j] = self->x1[j];
+            self->x1[j] = vin;
+            self->y2[j] = self->y1[j];
+            self->y1[j] = vin = vout;
+        }
+        self->data[i] = vout;
     }
 }
 
-static void Reson_postprocessing_ii(Reson *self) { POST_PROCESSING_II };
-static void Reson_postprocessing_ai(Reson *self) { POST_PROCESSING_AI };
-static void Reson_postprocessing_ia(Reson *self) { POST_PROCESSING_IA };
-static void Reson_postprocessing_aa(Reson *self) { POST_PROCESSING_AA };
-static void Reson_postprocessing_ireva(Reson *self) { POST_PROCESSING_IREVA };
-static void Reson_postprocessing_areva(Reson *self) { POST_PROCESSING_AREVA };
-static void Reson_postprocessing_revai(Reson *self) { POST_PROCESSING_REVAI };
-static void Reson_postprocessing_revaa(Reson *self) { POST_PROCESSING_REVAA };
-static void Reson_postprocessing_revareva(Reson *self) { POST_PROCESSING_REVAREVA };
+static void Resonx_postprocessing_ii(Resonx *self) { POST_PROCESSING_II };
+static void Resonx_postprocessing_ai(Resonx *self) { POST_PROCESSING_AI };
+static void Resonx_postprocessing_ia(Resonx *self) { POST_PROCESSING_IA };
+static void Resonx_postprocessing_aa(Resonx *self) { POST_PROCESSING_AA };
+static void Resonx_postprocessing_ireva(Resonx *self) { POST_PROCESSING_IREVA };
+static void Resonx_postprocessing_areva(Resonx *self) { POST_PROCESSING_AREVA };
+static void Resonx_postprocessing_revai(Resonx *self) { POST_PROCESSING_REVAI };
+static void Resonx_postprocessing_revaa(Resonx *self) { POST_PROCESSING_REVAA };
+static void Resonx_postprocessing_revareva(Resonx *self) { POST_PROCESSING_REVAREVA };
 
 static void
-Reson_setProcMode(Reson *self)
+Resonx_setProcMode(Resonx *self)
 {
     int procmode, muladdmode;
     procmode = self->modebuffer[2] + self->modebuffer[3] * 10;
@@ -8356,58 +9335,58 @@ Reson_setProcMode(Reson *self)
 
 	switch (procmode) {
         case 0:
-            self->proc_func_ptr = Reson_filters_ii;
+            self->proc_func_ptr = Resonx_filters_ii;
             break;
         case 1:
-            self->proc_func_ptr = Reson_filters_ai;
+            self->proc_func_ptr = Resonx_filters_ai;
             break;
         case 10:
-            self->proc_func_ptr = Reson_filters_ia;
+            self->proc_func_ptr = Resonx_filters_ia;
             break;
         case 11:
-            self->proc_func_ptr = Reson_filters_aa;
+            self->proc_func_ptr = Resonx_filters_aa;
             break;
     }
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = Reson_postprocessing_ii;
+            self->muladd_func_ptr = Resonx_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = Reson_postprocessing_ai;
+            self->muladd_func_ptr = Resonx_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = Reson_postprocessing_revai;
+            self->muladd_func_ptr = Resonx_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = Reson_postprocessing_ia;
+            self->muladd_func_ptr = Resonx_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = Reson_postprocessing_aa;
+            self->muladd_func_ptr = Resonx_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = Reson_postprocessing_revaa;
+            self->muladd_func_ptr = Resonx_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = Reson_postprocessing_ireva;
+            self->muladd_func_ptr = Resonx_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = Reson_postprocessing_areva;
+            self->muladd_func_ptr = Resonx_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = Reson_postprocessing_revareva;
+            self->muladd_func_ptr = Resonx_postprocessing_revareva;
             break;
     }
 }
 
 static void
-Reson_compute_next_data_frame(Reson *self)
+Resonx_compute_next_data_frame(Resonx *self)
 {
     (*self->proc_func_ptr)(self);
     (*self->muladd_func_ptr)(self);
 }
 
 static int
-Reson_traverse(Reson *self, visitproc visit, void *arg)
+Resonx_traverse(Resonx *self, visitproc visit, void *arg)
 {
     pyo_VISIT
     Py_VISIT(self->input);
@@ -8420,7 +9399,7 @@ Reson_traverse(Reson *self, visitproc visit, void *arg)
 }
 
 static int
-Reson_clear(Reson *self)
+Resonx_clear(Resonx *self)
 {
     pyo_CLEAR
     Py_CLEAR(self->input);
@@ -8433,25 +9412,29 @@ Reson_clear(Reson *self)
 }
 
 static void
-Reson_dealloc(Reson* self)
+Resonx_dealloc(Resonx* self)
 {
     pyo_DEALLOC
-    Reson_clear(self);
+    free(self->x1);
+    free(self->x2);
+    free(self->y1);
+    free(self->y2);
+    Resonx_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
 static PyObject *
-Reson_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+Resonx_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
     PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *qtmp=NULL, *multmp=NULL, *addtmp=NULL;
-    Reson *self;
-    self = (Reson *)type->tp_alloc(type, 0);
+    Resonx *self;
+    self = (Resonx *)type->tp_alloc(type, 0);
 
     self->freq = PyFloat_FromDouble(1000);
     self->q = PyFloat_FromDouble(1);
     self->last_freq = self->last_q = -1.0;
-    self->x1 = self->x2 = self->y1 = self->y2 = 0.0;
+    self->stages = 4;
     self->a = self->b1 = self->b2 = 0.0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
@@ -8463,12 +9446,12 @@ Reson_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->nyquist = (MYFLT)self->sr * 0.49;
     self->twopiOverSr = TWOPI / (MYFLT)self->sr;
 
-    Stream_setFunctionPtr(self->stream, Reson_compute_next_data_frame);
-    self->mode_func_ptr = Reson_setProcMode;
+    Stream_setFunctionPtr(self->stream, Resonx_compute_next_data_frame);
+    self->mode_func_ptr = Resonx_setProcMode;
 
-    static char *kwlist[] = {"input", "freq", "q", "mul", "add", NULL};
+    static char *kwlist[] = {"input", "freq", "q", "stages", "mul", "add", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOO", kwlist, &inputtmp, &freqtmp, &qtmp, &multmp, &addtmp))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOiOO", kwlist, &inputtmp, &freqtmp, &qtmp, &self->stages, &multmp, &addtmp))
         Py_RETURN_NONE;
 
     INIT_INPUT_STREAM
@@ -8491,33 +9474,35 @@ Reson_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     PyObject_CallMethod(self->server, "addStream", "O", self->stream);
 
+    Resonx_allocate_memories(self);
+
     (*self->mode_func_ptr)(self);
 
     return (PyObject *)self;
 }
 
-static PyObject * Reson_getServer(Reson* self) { GET_SERVER };
-static PyObject * Reson_getStream(Reson* self) { GET_STREAM };
-static PyObject * Reson_setMul(Reson *self, PyObject *arg) { SET_MUL };
-static PyObject * Reson_setAdd(Reson *self, PyObject *arg) { SET_ADD };
-static PyObject * Reson_setSub(Reson *self, PyObject *arg) { SET_SUB };
-static PyObject * Reson_setDiv(Reson *self, PyObject *arg) { SET_DIV };
+static PyObject * Resonx_getServer(Resonx* self) { GET_SERVER };
+static PyObject * Resonx_getStream(Resonx* self) { GET_STREAM };
+static PyObject * Resonx_setMul(Resonx *self, PyObject *arg) { SET_MUL };
+static PyObject * Resonx_setAdd(Resonx *self, PyObject *arg) { SET_ADD };
+static PyObject * Resonx_setSub(Resonx *self, PyObject *arg) { SET_SUB };
+static PyObject * Resonx_setDiv(Resonx *self, PyObject *arg) { SET_DIV };
 
-static PyObject * Reson_play(Reson *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * Reson_out(Reson *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * Reson_stop(Reson *self) { STOP };
+static PyObject * Resonx_play(Resonx *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * Resonx_out(Resonx *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * Resonx_stop(Resonx *self) { STOP };
 
-static PyObject * Reson_multiply(Reson *self, PyObject *arg) { MULTIPLY };
-static PyObject * Reson_inplace_multiply(Reson *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * Reson_add(Reson *self, PyObject *arg) { ADD };
-static PyObject * Reson_inplace_add(Reson *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * Reson_sub(Reson *self, PyObject *arg) { SUB };
-static PyObject * Reson_inplace_sub(Reson *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * Reson_div(Reson *self, PyObject *arg) { DIV };
-static PyObject * Reson_inplace_div(Reson *self, PyObject *arg) { INPLACE_DIV };
+static PyObject * Resonx_multiply(Resonx *self, PyObject *arg) { MULTIPLY };
+static PyObject * Resonx_inplace_multiply(Resonx *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * Resonx_add(Resonx *self, PyObject *arg) { ADD };
+static PyObject * Resonx_inplace_add(Resonx *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * Resonx_sub(Resonx *self, PyObject *arg) { SUB };
+static PyObject * Resonx_inplace_sub(Resonx *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * Resonx_div(Resonx *self, PyObject *arg) { DIV };
+static PyObject * Resonx_inplace_div(Resonx *self, PyObject *arg) { INPLACE_DIV };
 
 static PyObject *
-Reson_setFreq(Reson *self, PyObject *arg)
+Resonx_setFreq(Resonx *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -8551,7 +9536,7 @@ Reson_setFreq(Reson *self, PyObject *arg)
 }
 
 static PyObject *
-Reson_setQ(Reson *self, PyObject *arg)
+Resonx_setQ(Resonx *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -8584,37 +9569,58 @@ Reson_setQ(Reson *self, PyObject *arg)
 	return Py_None;
 }
 
-static PyMemberDef Reson_members[] = {
-    {"server", T_OBJECT_EX, offsetof(Reson, server), 0, "Pyo server."},
-    {"stream", T_OBJECT_EX, offsetof(Reson, stream), 0, "Stream object."},
-    {"input", T_OBJECT_EX, offsetof(Reson, input), 0, "Input sound object."},
-    {"freq", T_OBJECT_EX, offsetof(Reson, freq), 0, "Cutoff frequency in cycle per second."},
-    {"q", T_OBJECT_EX, offsetof(Reson, q), 0, "Q factor."},
-    {"mul", T_OBJECT_EX, offsetof(Reson, mul), 0, "Mul factor."},
-    {"add", T_OBJECT_EX, offsetof(Reson, add), 0, "Add factor."},
+static PyObject *
+Resonx_setStages(Resonx *self, PyObject *arg)
+{
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isInt = PyInt_Check(arg);
+
+	if (isInt == 1) {
+		self->stages = PyInt_AsLong(arg);
+        Resonx_allocate_memories(self);
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyMemberDef Resonx_members[] = {
+    {"server", T_OBJECT_EX, offsetof(Resonx, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(Resonx, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(Resonx, input), 0, "Input sound object."},
+    {"freq", T_OBJECT_EX, offsetof(Resonx, freq), 0, "Cutoff frequency in cycle per second."},
+    {"q", T_OBJECT_EX, offsetof(Resonx, q), 0, "Q factor."},
+    {"mul", T_OBJECT_EX, offsetof(Resonx, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(Resonx, add), 0, "Add factor."},
     {NULL}  /* Sentinel */
 };
 
-static PyMethodDef Reson_methods[] = {
-    {"getServer", (PyCFunction)Reson_getServer, METH_NOARGS, "Returns server object."},
-    {"_getStream", (PyCFunction)Reson_getStream, METH_NOARGS, "Returns stream object."},
-    {"play", (PyCFunction)Reson_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-    {"out", (PyCFunction)Reson_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-    {"stop", (PyCFunction)Reson_stop, METH_NOARGS, "Stops computing."},
-	{"setFreq", (PyCFunction)Reson_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
-    {"setQ", (PyCFunction)Reson_setQ, METH_O, "Sets filter Q factor."},
-	{"setMul", (PyCFunction)Reson_setMul, METH_O, "Sets oscillator mul factor."},
-	{"setAdd", (PyCFunction)Reson_setAdd, METH_O, "Sets oscillator add factor."},
-    {"setSub", (PyCFunction)Reson_setSub, METH_O, "Sets inverse add factor."},
-    {"setDiv", (PyCFunction)Reson_setDiv, METH_O, "Sets inverse mul factor."},
+static PyMethodDef Resonx_methods[] = {
+    {"getServer", (PyCFunction)Resonx_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)Resonx_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)Resonx_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)Resonx_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)Resonx_stop, METH_NOARGS, "Stops computing."},
+	{"setFreq", (PyCFunction)Resonx_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
+    {"setQ", (PyCFunction)Resonx_setQ, METH_O, "Sets filter Q factor."},
+    {"setStages", (PyCFunction)Resonx_setStages, METH_O, "Sets the number of stages of the filter."},
+	{"setMul", (PyCFunction)Resonx_setMul, METH_O, "Sets oscillator mul factor."},
+	{"setAdd", (PyCFunction)Resonx_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)Resonx_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)Resonx_setDiv, METH_O, "Sets inverse mul factor."},
     {NULL}  /* Sentinel */
 };
 
-static PyNumberMethods Reson_as_number = {
-    (binaryfunc)Reson_add,                         /*nb_add*/
-    (binaryfunc)Reson_sub,                         /*nb_subtract*/
-    (binaryfunc)Reson_multiply,                    /*nb_multiply*/
-    (binaryfunc)Reson_div,                                              /*nb_divide*/
+static PyNumberMethods Resonx_as_number = {
+    (binaryfunc)Resonx_add,                         /*nb_add*/
+    (binaryfunc)Resonx_sub,                         /*nb_subtract*/
+    (binaryfunc)Resonx_multiply,                    /*nb_multiply*/
+    (binaryfunc)Resonx_div,                                              /*nb_divide*/
     0,                                              /*nb_remainder*/
     0,                                              /*nb_divmod*/
     0,                                              /*nb_power*/
@@ -8634,10 +9640,10 @@ static PyNumberMethods Reson_as_number = {
     0,                                              /*nb_float*/
     0,                                              /*nb_oct*/
     0,                                              /*nb_hex*/
-    (binaryfunc)Reson_inplace_add,                 /*inplace_add*/
-    (binaryfunc)Reson_inplace_sub,                 /*inplace_subtract*/
-    (binaryfunc)Reson_inplace_multiply,            /*inplace_multiply*/
-    (binaryfunc)Reson_inplace_div,                                              /*inplace_divide*/
+    (binaryfunc)Resonx_inplace_add,                 /*inplace_add*/
+    (binaryfunc)Resonx_inplace_sub,                 /*inplace_subtract*/
+    (binaryfunc)Resonx_inplace_multiply,            /*inplace_multiply*/
+    (binaryfunc)Resonx_inplace_div,                                              /*inplace_divide*/
     0,                                              /*inplace_remainder*/
     0,                                              /*inplace_power*/
     0,                                              /*inplace_lshift*/
@@ -8652,19 +9658,19 @@ static PyNumberMethods Reson_as_number = {
     0,                                              /* nb_index */
 };
 
-PyTypeObject ResonType = {
+PyTypeObject ResonxType = {
     PyObject_HEAD_INIT(NULL)
     0,                                              /*ob_size*/
-    "_pyo.Reson_base",                                   /*tp_name*/
-    sizeof(Reson),                                 /*tp_basicsize*/
+    "_pyo.Resonx_base",                                   /*tp_name*/
+    sizeof(Resonx),                                 /*tp_basicsize*/
     0,                                              /*tp_itemsize*/
-    (destructor)Reson_dealloc,                     /*tp_dealloc*/
+    (destructor)Resonx_dealloc,                     /*tp_dealloc*/
     0,                                              /*tp_print*/
     0,                                              /*tp_getattr*/
     0,                                              /*tp_setattr*/
     0,                                              /*tp_compare*/
     0,                                              /*tp_repr*/
-    &Reson_as_number,                              /*tp_as_number*/
+    &Resonx_as_number,                              /*tp_as_number*/
     0,                                              /*tp_as_sequence*/
     0,                                              /*tp_as_mapping*/
     0,                                              /*tp_hash */
@@ -8674,15 +9680,15 @@ PyTypeObject ResonType = {
     0,                                              /*tp_setattro*/
     0,                                              /*tp_as_buffer*/
     Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-    "Reson objects. Second-order resonant bandpass filter.",           /* tp_doc */
-    (traverseproc)Reson_traverse,                  /* tp_traverse */
-    (inquiry)Reson_clear,                          /* tp_clear */
+    "Resonx objects. Cascade of second-order Resonant bandpass filter.",           /* tp_doc */
+    (traverseproc)Resonx_traverse,                  /* tp_traverse */
+    (inquiry)Resonx_clear,                          /* tp_clear */
     0,                                              /* tp_richcompare */
     0,                                              /* tp_weaklistoffset */
     0,                                              /* tp_iter */
     0,                                              /* tp_iternext */
-    Reson_methods,                                 /* tp_methods */
-    Reson_members,                                 /* tp_members */
+    Resonx_methods,                                 /* tp_methods */
+    Resonx_members,                                 /* tp_members */
     0,                                              /* tp_getset */
     0,                                              /* tp_base */
     0,                                              /* tp_dict */
@@ -8691,315 +9697,216 @@ PyTypeObject ResonType = {
     0,                                              /* tp_dictoffset */
     0,                          /* tp_init */
     0,                                              /* tp_alloc */
-    Reson_new,                                     /* tp_new */
+    Resonx_new,                                     /* tp_new */
 };
 
+/************/
+/* ButLP */
+/************/
 typedef struct {
     pyo_audio_HEAD
     PyObject *input;
     Stream *input_stream;
     PyObject *freq;
     Stream *freq_stream;
-    PyObject *q;
-    Stream *q_stream;
-    int modebuffer[4]; // need at least 2 slots for mul & add
-    int stages;
-    MYFLT nyquist;
-    MYFLT last_freq;
-    MYFLT last_q;
-    MYFLT twopiOverSr;
+    int modebuffer[3]; // need at least 2 slots for mul & add
+    MYSTATE lastFreq;
+    MYSTATE nyquist;
+    MYSTATE piOnSr;
+    MYSTATE sqrt2;
     // sample memories
-    MYFLT *x1;
-    MYFLT *x2;
-    MYFLT *y1;
-    MYFLT *y2;
-    // coefficients
-    MYFLT b1;
-    MYFLT b2;
-    MYFLT a;
-} Resonx;
+    MYSTATE x1;
+    MYSTATE x2;
+    MYSTATE y1;
+    MYSTATE y2;
+    // variables
+    MYSTATE a0;
+    MYSTATE a1;
+    MYSTATE a2;
+    MYSTATE b1;
+    MYSTATE b2;
+} ButLP;
 
 static void
-Resonx_allocate_memories(Resonx *self)
-{
+ButLP_filters_i(ButLP *self) {
+    MYSTATE val, c, c2;
     int i;
-    self->x1 = (MYFLT *)realloc(self->x1, self->stages * sizeof(MYFLT));
-    self->x2 = (MYFLT *)realloc(self->x2, self->stages * sizeof(MYFLT));
-    self->y1 = (MYFLT *)realloc(self->y1, self->stages * sizeof(MYFLT));
-    self->y2 = (MYFLT *)realloc(self->y2, self->stages * sizeof(MYFLT));
-    for (i=0; i < self->stages; i++) {
-        self->x1[i] = self->x2[i] = self->y1[i] = self->y2[i] = 0.0;
-    }
-}
-
-static void
-Resonx_compute_coeffs(Resonx *self, MYFLT freq, MYFLT q)
-{
-    MYFLT bw;
-
-    if (freq < 0.1)
-        freq = 0.1;
-    else if (freq > self->nyquist)
-        freq = self->nyquist;
-    if (q < 0.1)
-        q = 0.1;
-
-    bw = freq / q;
-
-    self->b2 = MYEXP(-self->twopiOverSr * bw);
-    self->b1 = (-4.0 * self->b2) / (1.0 + self->b2) * MYCOS(freq * self->twopiOverSr);
-    self->a = 1.0 - MYSQRT(self->b2);
-}
-
-static void
-Resonx_filters_ii(Resonx *self) {
-    MYFLT vin, vout, fr, q;
-    int i, j;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    fr = PyFloat_AS_DOUBLE(self->freq);
-    q = PyFloat_AS_DOUBLE(self->q);
-
-    if (fr != self->last_freq || q != self->last_q) {
-        self->last_freq = fr;
-        self->last_q = q;
-        Resonx_compute_coeffs(self, fr, q);
-    }
-
-    vout = 0.0;
-    for (i=0; i<self->bufsize; i++) {
-        vin = in[i];
-        for (j=0; j<self->stages; j++) {
-            vout = (self->a * vin) - (self->a * self->x2[j]) - (self->b1 * self->y1[j]) - (self->b2 * self->y2[j]);
-            self->x2[j] = self->x1[j];
-            self->x1[j] = vin;
-            self->y2[j] = self->y1[j];
-            self->y1[j] = vin = vout;
-        }
-        self->data[i] = vout;
-    }
-}
-
-static void
-Resonx_filters_ai(Resonx *self) {
-    MYFLT vin, vout, fr, q;
-    int i, j;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
-    q = PyFloat_AS_DOUBLE(self->q);
-
-    vout = 0.0;
-    for (i=0; i<self->bufsize; i++) {
-        vin = in[i];
-        fr = freq[i];
-        if (fr != self->last_freq || q != self->last_q) {
-            self->last_freq = fr;
-            self->last_q = q;
-            Resonx_compute_coeffs(self, fr, q);
-        }
-        for (j=0; j<self->stages; j++) {
-            vout = (self->a * vin) - (self->a * self->x2[j]) - (self->b1 * self->y1[j]) - (self->b2 * self->y2[j]);
-            self->x2[j] = self->x1[j];
-            self->x1[j] = vin;
-            self->y2[j] = self->y1[j];
-            self->y1[j] = vin = vout;
-        }
-        self->data[i] = vout;
-    }
-}
+    MYFLT fr = PyFloat_AS_DOUBLE(self->freq);
 
-static void
-Resonx_filters_ia(Resonx *self) {
-    MYFLT vin, vout, fr, q;
-    int i, j;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    fr = PyFloat_AS_DOUBLE(self->freq);
-    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
+    if (fr != self->lastFreq) {
+        if (fr <= 1.0)
+            fr = 1.0;
+        else if (fr >= self->nyquist)
+            fr = self->nyquist;
+        self->lastFreq = fr;
+        c = 1.0 / STTAN(self->piOnSr * fr);
+        c2 = c * c;
+        self->a0 = self->a2 = 1.0 / (1.0 + self->sqrt2 * c + c2);
+        self->a1 = 2.0 * self->a0;
+        self->b1 = self->a1 * (1.0 - c2);
+        self->b2 = self->a0 * (1.0 - self->sqrt2 * c + c2);
+    }
 
-    vout = 0.0;
     for (i=0; i<self->bufsize; i++) {
-        vin = in[i];
-        q = qst[i];
-        if (fr != self->last_freq || q != self->last_q) {
-            self->last_freq = fr;
-            self->last_q = q;
-            Resonx_compute_coeffs(self, fr, q);
-        }
-        for (j=0; j<self->stages; j++) {
-            vout = (self->a * vin) - (self->a * self->x2[j]) - (self->b1 * self->y1[j]) - (self->b2 * self->y2[j]);
-            self->x2[j] = self->x1[j];
-            self->x1[j] = vin;
-            self->y2[j] = self->y1[j];
-            self->y1[j] = vin = vout;
-        }
-        self->data[i] = vout;
+        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        self->x2 = self->x1;
+        self->x1 = in[i];
+        self->y2 = self->y1;
+        self->data[i] = self->y1 = val;
     }
 }
 
 static void
-Resonx_filters_aa(Resonx *self) {
-    MYFLT vin, vout, fr, q;
-    int i, j;
+ButLP_filters_a(ButLP *self) {
+    MYSTATE val, fr, c, c2;
+    int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
-    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
 
-    vout = 0.0;
     for (i=0; i<self->bufsize; i++) {
-        vin = in[i];
         fr = freq[i];
-        q = qst[i];
-        if (fr != self->last_freq || q != self->last_q) {
-            self->last_freq = fr;
-            self->last_q = q;
-            Resonx_compute_coeffs(self, fr, q);
-        }
-        for (j=0; j<self->stages; j++) {
-            vout = (self->a * vin) - (self->a * self->x2[j]) - (self->b1 * self->y1[j]) - (self->b2 * self->y2[j]);
-            self->x2[j] = self->x1[j];
-            self->x1[j] = vin;
-            self->y2[j] = self->y1[j];
-            self->y1[j] = vin = vout;
+        if (fr != self->lastFreq) {
+            if (fr <= 1.0)
+                fr = 1.0;
+            else if (fr >= self->nyquist)
+                fr = self->nyquist;
+            self->lastFreq = fr;
+            c = 1.0 / STTAN(self->piOnSr * fr);
+            c2 = c * c;
+            self->a0 = self->a2 = 1.0 / (1.0 + self->sqrt2 * c + c2);
+            self->a1 = 2.0 * self->a0;
+            self->b1 = self->a1 * (1.0 - c2);
+            self->b2 = self->a0 * (1.0 - self->sqrt2 * c + c2);
         }
-        self->data[i] = vout;
+        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        self->x2 = self->x1;
+        self->x1 = in[i];
+        self->y2 = self->y1;
+        self->data[i] = self->y1 = val;
     }
 }
 
-static void Resonx_postprocessing_ii(Resonx *self) { POST_PROCESSING_II };
-static void Resonx_postprocessing_ai(Resonx *self) { POST_PROCESSING_AI };
-static void Resonx_postprocessing_ia(Resonx *self) { POST_PROCESSING_IA };
-static void Resonx_postprocessing_aa(Resonx *self) { POST_PROCESSING_AA };
-static void Resonx_postprocessing_ireva(Resonx *self) { POST_PROCESSING_IREVA };
-static void Resonx_postprocessing_areva(Resonx *self) { POST_PROCESSING_AREVA };
-static void Resonx_postprocessing_revai(Resonx *self) { POST_PROCESSING_REVAI };
-static void Resonx_postprocessing_revaa(Resonx *self) { POST_PROCESSING_REVAA };
-static void Resonx_postprocessing_revareva(Resonx *self) { POST_PROCESSING_REVAREVA };
+static void ButLP_postprocessing_ii(ButLP *self) { POST_PROCESSING_II };
+static void ButLP_postprocessing_ai(ButLP *self) { POST_PROCESSING_AI };
+static void ButLP_postprocessing_ia(ButLP *self) { POST_PROCESSING_IA };
+static void ButLP_postprocessing_aa(ButLP *self) { POST_PROCESSING_AA };
+static void ButLP_postprocessing_ireva(ButLP *self) { POST_PROCESSING_IREVA };
+static void ButLP_postprocessing_areva(ButLP *self) { POST_PROCESSING_AREVA };
+static void ButLP_postprocessing_revai(ButLP *self) { POST_PROCESSING_REVAI };
+static void ButLP_postprocessing_revaa(ButLP *self) { POST_PROCESSING_REVAA };
+static void ButLP_postprocessing_revareva(ButLP *self) { POST_PROCESSING_REVAREVA };
 
 static void
-Resonx_setProcMode(Resonx *self)
+ButLP_setProcMode(ButLP *self)
 {
     int procmode, muladdmode;
-    procmode = self->modebuffer[2] + self->modebuffer[3] * 10;
+    procmode = self->modebuffer[2];
     muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
 
 	switch (procmode) {
         case 0:
-            self->proc_func_ptr = Resonx_filters_ii;
+            self->proc_func_ptr = ButLP_filters_i;
             break;
         case 1:
-            self->proc_func_ptr = Resonx_filters_ai;
-            break;
-        case 10:
-            self->proc_func_ptr = Resonx_filters_ia;
-            break;
-        case 11:
-            self->proc_func_ptr = Resonx_filters_aa;
+            self->proc_func_ptr = ButLP_filters_a;
             break;
     }
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = Resonx_postprocessing_ii;
+            self->muladd_func_ptr = ButLP_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = Resonx_postprocessing_ai;
+            self->muladd_func_ptr = ButLP_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = Resonx_postprocessing_revai;
+            self->muladd_func_ptr = ButLP_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = Resonx_postprocessing_ia;
+            self->muladd_func_ptr = ButLP_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = Resonx_postprocessing_aa;
+            self->muladd_func_ptr = ButLP_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = Resonx_postprocessing_revaa;
+            self->muladd_func_ptr = ButLP_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = Resonx_postprocessing_ireva;
+            self->muladd_func_ptr = ButLP_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = Resonx_postprocessing_areva;
+            self->muladd_func_ptr = ButLP_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = Resonx_postprocessing_revareva;
+            self->muladd_func_ptr = ButLP_postprocessing_revareva;
             break;
     }
 }
 
 static void
-Resonx_compute_next_data_frame(Resonx *self)
+ButLP_compute_next_data_frame(ButLP *self)
 {
     (*self->proc_func_ptr)(self);
     (*self->muladd_func_ptr)(self);
 }
 
 static int
-Resonx_traverse(Resonx *self, visitproc visit, void *arg)
+ButLP_traverse(ButLP *self, visitproc visit, void *arg)
 {
     pyo_VISIT
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
     Py_VISIT(self->freq);
     Py_VISIT(self->freq_stream);
-    Py_VISIT(self->q);
-    Py_VISIT(self->q_stream);
     return 0;
 }
 
 static int
-Resonx_clear(Resonx *self)
+ButLP_clear(ButLP *self)
 {
     pyo_CLEAR
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
     Py_CLEAR(self->freq);
     Py_CLEAR(self->freq_stream);
-    Py_CLEAR(self->q);
-    Py_CLEAR(self->q_stream);
     return 0;
 }
 
 static void
-Resonx_dealloc(Resonx* self)
+ButLP_dealloc(ButLP* self)
 {
     pyo_DEALLOC
-    free(self->x1);
-    free(self->x2);
-    free(self->y1);
-    free(self->y2);
-    Resonx_clear(self);
+    ButLP_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
 static PyObject *
-Resonx_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+ButLP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
-    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *qtmp=NULL, *multmp=NULL, *addtmp=NULL;
-    Resonx *self;
-    self = (Resonx *)type->tp_alloc(type, 0);
+    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *multmp=NULL, *addtmp=NULL;
+    ButLP *self;
+    self = (ButLP *)type->tp_alloc(type, 0);
 
     self->freq = PyFloat_FromDouble(1000);
-    self->q = PyFloat_FromDouble(1);
-    self->last_freq = self->last_q = -1.0;
-    self->stages = 4;
-    self->a = self->b1 = self->b2 = 0.0;
+    self->lastFreq = -1.0;
+    self->x1 = self->x2 = self->y1 = self->y2 = self->a0 = self->a1 = self->a2 = self->b1 = self->b2 = 0.0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
 	self->modebuffer[2] = 0;
-	self->modebuffer[3] = 0;
 
     INIT_OBJECT_COMMON
 
     self->nyquist = (MYFLT)self->sr * 0.49;
-    self->twopiOverSr = TWOPI / (MYFLT)self->sr;
+    self->piOnSr = PI / (MYFLT)self->sr;
+    self->sqrt2 = STSQRT(2.0);
 
-    Stream_setFunctionPtr(self->stream, Resonx_compute_next_data_frame);
-    self->mode_func_ptr = Resonx_setProcMode;
+    Stream_setFunctionPtr(self->stream, ButLP_compute_next_data_frame);
+    self->mode_func_ptr = ButLP_setProcMode;
 
-    static char *kwlist[] = {"input", "freq", "q", "stages", "mul", "add", NULL};
+    static char *kwlist[] = {"input", "freq", "mul", "add", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOiOO", kwlist, &inputtmp, &freqtmp, &qtmp, &self->stages, &multmp, &addtmp))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOO", kwlist, &inputtmp, &freqtmp, &multmp, &addtmp))
         Py_RETURN_NONE;
 
     INIT_INPUT_STREAM
@@ -9008,10 +9915,6 @@ Resonx_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
     }
 
-    if (qtmp) {
-        PyObject_CallMethod((PyObject *)self, "setQ", "O", qtmp);
-    }
-
     if (multmp) {
         PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
     }
@@ -9022,234 +9925,175 @@ Resonx_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     PyObject_CallMethod(self->server, "addStream", "O", self->stream);
 
-    Resonx_allocate_memories(self);
-
     (*self->mode_func_ptr)(self);
 
     return (PyObject *)self;
 }
 
-static PyObject * Resonx_getServer(Resonx* self) { GET_SERVER };
-static PyObject * Resonx_getStream(Resonx* self) { GET_STREAM };
-static PyObject * Resonx_setMul(Resonx *self, PyObject *arg) { SET_MUL };
-static PyObject * Resonx_setAdd(Resonx *self, PyObject *arg) { SET_ADD };
-static PyObject * Resonx_setSub(Resonx *self, PyObject *arg) { SET_SUB };
-static PyObject * Resonx_setDiv(Resonx *self, PyObject *arg) { SET_DIV };
-
-static PyObject * Resonx_play(Resonx *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * Resonx_out(Resonx *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * Resonx_stop(Resonx *self) { STOP };
-
-static PyObject * Resonx_multiply(Resonx *self, PyObject *arg) { MULTIPLY };
-static PyObject * Resonx_inplace_multiply(Resonx *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * Resonx_add(Resonx *self, PyObject *arg) { ADD };
-static PyObject * Resonx_inplace_add(Resonx *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * Resonx_sub(Resonx *self, PyObject *arg) { SUB };
-static PyObject * Resonx_inplace_sub(Resonx *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * Resonx_div(Resonx *self, PyObject *arg) { DIV };
-static PyObject * Resonx_inplace_div(Resonx *self, PyObject *arg) { INPLACE_DIV };
-
-static PyObject *
-Resonx_setFreq(Resonx *self, PyObject *arg)
-{
-	PyObject *tmp, *streamtmp;
-
-	if (arg == NULL) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	int isNumber = PyNumber_Check(arg);
-
-	tmp = arg;
-	Py_INCREF(tmp);
-	Py_DECREF(self->freq);
-	if (isNumber == 1) {
-		self->freq = PyNumber_Float(tmp);
-        self->modebuffer[2] = 0;
-	}
-	else {
-		self->freq = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->freq, "_getStream", NULL);
-        Py_INCREF(streamtmp);
-        Py_XDECREF(self->freq_stream);
-        self->freq_stream = (Stream *)streamtmp;
-		self->modebuffer[2] = 1;
-	}
-
-    (*self->mode_func_ptr)(self);
-
-	Py_INCREF(Py_None);
-	return Py_None;
-}
-
-static PyObject *
-Resonx_setQ(Resonx *self, PyObject *arg)
-{
-	PyObject *tmp, *streamtmp;
-
-	if (arg == NULL) {
-		Py_INCREF(Py_None);
-		return Py_None;
-	}
-
-	int isNumber = PyNumber_Check(arg);
-
-	tmp = arg;
-	Py_INCREF(tmp);
-	Py_DECREF(self->q);
-	if (isNumber == 1) {
-		self->q = PyNumber_Float(tmp);
-        self->modebuffer[3] = 0;
-	}
-	else {
-		self->q = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->q, "_getStream", NULL);
-        Py_INCREF(streamtmp);
-        Py_XDECREF(self->q_stream);
-        self->q_stream = (Stream *)streamtmp;
-		self->modebuffer[3] = 1;
-	}
+static PyObject * ButLP_getServer(ButLP* self) { GET_SERVER };
+static PyObject * ButLP_getStream(ButLP* self) { GET_STREAM };
+static PyObject * ButLP_setMul(ButLP *self, PyObject *arg) { SET_MUL };
+static PyObject * ButLP_setAdd(ButLP *self, PyObject *arg) { SET_ADD };
+static PyObject * ButLP_setSub(ButLP *self, PyObject *arg) { SET_SUB };
+static PyObject * ButLP_setDiv(ButLP *self, PyObject *arg) { SET_DIV };
 
-    (*self->mode_func_ptr)(self);
+static PyObject * ButLP_play(ButLP *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * ButLP_out(ButLP *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * ButLP_stop(ButLP *self) { STOP };
 
-	Py_INCREF(Py_None);
-	return Py_None;
-}
+static PyObject * ButLP_multiply(ButLP *self, PyObject *arg) { MULTIPLY };
+static PyObject * ButLP_inplace_multiply(ButLP *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * ButLP_add(ButLP *self, PyObject *arg) { ADD };
+static PyObject * ButLP_inplace_add(ButLP *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * ButLP_sub(ButLP *self, PyObject *arg) { SUB };
+static PyObject * ButLP_inplace_sub(ButLP *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * ButLP_div(ButLP *self, PyObject *arg) { DIV };
+static PyObject * ButLP_inplace_div(ButLP *self, PyObject *arg) { INPLACE_DIV };
 
 static PyObject *
-Resonx_setStages(Resonx *self, PyObject *arg)
+ButLP_setFreq(ButLP *self, PyObject *arg)
 {
+	PyObject *tmp, *streamtmp;
 
 	if (arg == NULL) {
 		Py_INCREF(Py_None);
 		return Py_None;
 	}
 
-	int isInt = PyInt_Check(arg);
+	int isNumber = PyNumber_Check(arg);
 
-	if (isInt == 1) {
-		self->stages = PyInt_AsLong(arg);
-        Resonx_allocate_memories(self);
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->freq);
+	if (isNumber == 1) {
+		self->freq = PyNumber_Float(tmp);
+        self->modebuffer[2] = 0;
+	}
+	else {
+		self->freq = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->freq, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->freq_stream);
+        self->freq_stream = (Stream *)streamtmp;
+		self->modebuffer[2] = 1;
 	}
 
+    (*self->mode_func_ptr)(self);
+
 	Py_INCREF(Py_None);
 	return Py_None;
 }
 
-static PyMemberDef Resonx_members[] = {
-    {"server", T_OBJECT_EX, offsetof(Resonx, server), 0, "Pyo server."},
-    {"stream", T_OBJECT_EX, offsetof(Resonx, stream), 0, "Stream object."},
-    {"input", T_OBJECT_EX, offsetof(Resonx, input), 0, "Input sound object."},
-    {"freq", T_OBJECT_EX, offsetof(Resonx, freq), 0, "Cutoff frequency in cycle per second."},
-    {"q", T_OBJECT_EX, offsetof(Resonx, q), 0, "Q factor."},
-    {"mul", T_OBJECT_EX, offsetof(Resonx, mul), 0, "Mul factor."},
-    {"add", T_OBJECT_EX, offsetof(Resonx, add), 0, "Add factor."},
-    {NULL}  /* Sentinel */
+static PyMemberDef ButLP_members[] = {
+{"server", T_OBJECT_EX, offsetof(ButLP, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(ButLP, stream), 0, "Stream object."},
+{"input", T_OBJECT_EX, offsetof(ButLP, input), 0, "Input sound object."},
+{"freq", T_OBJECT_EX, offsetof(ButLP, freq), 0, "Cutoff frequency in cycle per second."},
+{"mul", T_OBJECT_EX, offsetof(ButLP, mul), 0, "Mul factor."},
+{"add", T_OBJECT_EX, offsetof(ButLP, add), 0, "Add factor."},
+{NULL}  /* Sentinel */
 };
 
-static PyMethodDef Resonx_methods[] = {
-    {"getServer", (PyCFunction)Resonx_getServer, METH_NOARGS, "Returns server object."},
-    {"_getStream", (PyCFunction)Resonx_getStream, METH_NOARGS, "Returns stream object."},
-    {"play", (PyCFunction)Resonx_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-    {"out", (PyCFunction)Resonx_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-    {"stop", (PyCFunction)Resonx_stop, METH_NOARGS, "Stops computing."},
-	{"setFreq", (PyCFunction)Resonx_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
-    {"setQ", (PyCFunction)Resonx_setQ, METH_O, "Sets filter Q factor."},
-    {"setStages", (PyCFunction)Resonx_setStages, METH_O, "Sets the number of stages of the filter."},
-	{"setMul", (PyCFunction)Resonx_setMul, METH_O, "Sets oscillator mul factor."},
-	{"setAdd", (PyCFunction)Resonx_setAdd, METH_O, "Sets oscillator add factor."},
-    {"setSub", (PyCFunction)Resonx_setSub, METH_O, "Sets inverse add factor."},
-    {"setDiv", (PyCFunction)Resonx_setDiv, METH_O, "Sets inverse mul factor."},
-    {NULL}  /* Sentinel */
+static PyMethodDef ButLP_methods[] = {
+{"getServer", (PyCFunction)ButLP_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)ButLP_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)ButLP_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"out", (PyCFunction)ButLP_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+{"stop", (PyCFunction)ButLP_stop, METH_NOARGS, "Stops computing."},
+{"setFreq", (PyCFunction)ButLP_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
+{"setMul", (PyCFunction)ButLP_setMul, METH_O, "Sets oscillator mul factor."},
+{"setAdd", (PyCFunction)ButLP_setAdd, METH_O, "Sets oscillator add factor."},
+{"setSub", (PyCFunction)ButLP_setSub, METH_O, "Sets inverse add factor."},
+{"setDiv", (PyCFunction)ButLP_setDiv, METH_O, "Sets inverse mul factor."},
+{NULL}  /* Sentinel */
 };
 
-static PyNumberMethods Resonx_as_number = {
-    (binaryfunc)Resonx_add,                         /*nb_add*/
-    (binaryfunc)Resonx_sub,                         /*nb_subtract*/
-    (binaryfunc)Resonx_multiply,                    /*nb_multiply*/
-    (binaryfunc)Resonx_div,                                              /*nb_divide*/
-    0,                                              /*nb_remainder*/
-    0,                                              /*nb_divmod*/
-    0,                                              /*nb_power*/
-    0,                                              /*nb_neg*/
-    0,                                              /*nb_pos*/
-    0,                                              /*(unaryfunc)array_abs,*/
-    0,                                              /*nb_nonzero*/
-    0,                                              /*nb_invert*/
-    0,                                              /*nb_lshift*/
-    0,                                              /*nb_rshift*/
-    0,                                              /*nb_and*/
-    0,                                              /*nb_xor*/
-    0,                                              /*nb_or*/
-    0,                                              /*nb_coerce*/
-    0,                                              /*nb_int*/
-    0,                                              /*nb_long*/
-    0,                                              /*nb_float*/
-    0,                                              /*nb_oct*/
-    0,                                              /*nb_hex*/
-    (binaryfunc)Resonx_inplace_add,                 /*inplace_add*/
-    (binaryfunc)Resonx_inplace_sub,                 /*inplace_subtract*/
-    (binaryfunc)Resonx_inplace_multiply,            /*inplace_multiply*/
-    (binaryfunc)Resonx_inplace_div,                                              /*inplace_divide*/
-    0,                                              /*inplace_remainder*/
-    0,                                              /*inplace_power*/
-    0,                                              /*inplace_lshift*/
-    0,                                              /*inplace_rshift*/
-    0,                                              /*inplace_and*/
-    0,                                              /*inplace_xor*/
-    0,                                              /*inplace_or*/
-    0,                                              /*nb_floor_divide*/
-    0,                                              /*nb_true_divide*/
-    0,                                              /*nb_inplace_floor_divide*/
-    0,                                              /*nb_inplace_true_divide*/
-    0,                                              /* nb_index */
+static PyNumberMethods ButLP_as_number = {
+(binaryfunc)ButLP_add,                         /*nb_add*/
+(binaryfunc)ButLP_sub,                         /*nb_subtract*/
+(binaryfunc)ButLP_multiply,                    /*nb_multiply*/
+(binaryfunc)ButLP_div,                                              /*nb_divide*/
+0,                                              /*nb_remainder*/
+0,                                              /*nb_divmod*/
+0,                                              /*nb_power*/
+0,                                              /*nb_neg*/
+0,                                              /*nb_pos*/
+0,                                              /*(unaryfunc)array_abs,*/
+0,                                              /*nb_nonzero*/
+0,                                              /*nb_invert*/
+0,                                              /*nb_lshift*/
+0,                                              /*nb_rshift*/
+0,                                              /*nb_and*/
+0,                                              /*nb_xor*/
+0,                                              /*nb_or*/
+0,                                              /*nb_coerce*/
+0,                                              /*nb_int*/
+0,                                              /*nb_long*/
+0,                                              /*nb_float*/
+0,                                              /*nb_oct*/
+0,                                              /*nb_hex*/
+(binaryfunc)ButLP_inplace_add,                 /*inplace_add*/
+(binaryfunc)ButLP_inplace_sub,                 /*inplace_subtract*/
+(binaryfunc)ButLP_inplace_multiply,            /*inplace_multiply*/
+(binaryfunc)ButLP_inplace_div,                                              /*inplace_divide*/
+0,                                              /*inplace_remainder*/
+0,                                              /*inplace_power*/
+0,                                              /*inplace_lshift*/
+0,                                              /*inplace_rshift*/
+0,                                              /*inplace_and*/
+0,                                              /*inplace_xor*/
+0,                                              /*inplace_or*/
+0,                                              /*nb_floor_divide*/
+0,                                              /*nb_true_divide*/
+0,                                              /*nb_inplace_floor_divide*/
+0,                                              /*nb_inplace_true_divide*/
+0,                                              /* nb_index */
 };
 
-PyTypeObject ResonxType = {
-    PyObject_HEAD_INIT(NULL)
-    0,                                              /*ob_size*/
-    "_pyo.Resonx_base",                                   /*tp_name*/
-    sizeof(Resonx),                                 /*tp_basicsize*/
-    0,                                              /*tp_itemsize*/
-    (destructor)Resonx_dealloc,                     /*tp_dealloc*/
-    0,                                              /*tp_print*/
-    0,                                              /*tp_getattr*/
-    0,                                              /*tp_setattr*/
-    0,                                              /*tp_compare*/
-    0,                                              /*tp_repr*/
-    &Resonx_as_number,                              /*tp_as_number*/
-    0,                                              /*tp_as_sequence*/
-    0,                                              /*tp_as_mapping*/
-    0,                                              /*tp_hash */
-    0,                                              /*tp_call*/
-    0,                                              /*tp_str*/
-    0,                                              /*tp_getattro*/
-    0,                                              /*tp_setattro*/
-    0,                                              /*tp_as_buffer*/
-    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-    "Resonx objects. Cascade of second-order Resonant bandpass filter.",           /* tp_doc */
-    (traverseproc)Resonx_traverse,                  /* tp_traverse */
-    (inquiry)Resonx_clear,                          /* tp_clear */
-    0,                                              /* tp_richcompare */
-    0,                                              /* tp_weaklistoffset */
-    0,                                              /* tp_iter */
-    0,                                              /* tp_iternext */
-    Resonx_methods,                                 /* tp_methods */
-    Resonx_members,                                 /* tp_members */
-    0,                                              /* tp_getset */
-    0,                                              /* tp_base */
-    0,                                              /* tp_dict */
-    0,                                              /* tp_descr_get */
-    0,                                              /* tp_descr_set */
-    0,                                              /* tp_dictoffset */
-    0,                          /* tp_init */
-    0,                                              /* tp_alloc */
-    Resonx_new,                                     /* tp_new */
+PyTypeObject ButLPType = {
+PyObject_HEAD_INIT(NULL)
+0,                                              /*ob_size*/
+"_pyo.ButLP_base",                                   /*tp_name*/
+sizeof(ButLP),                                 /*tp_basicsize*/
+0,                                              /*tp_itemsize*/
+(destructor)ButLP_dealloc,                     /*tp_dealloc*/
+0,                                              /*tp_print*/
+0,                                              /*tp_getattr*/
+0,                                              /*tp_setattr*/
+0,                                              /*tp_compare*/
+0,                                              /*tp_repr*/
+&ButLP_as_number,                              /*tp_as_number*/
+0,                                              /*tp_as_sequence*/
+0,                                              /*tp_as_mapping*/
+0,                                              /*tp_hash */
+0,                                              /*tp_call*/
+0,                                              /*tp_str*/
+0,                                              /*tp_getattro*/
+0,                                              /*tp_setattro*/
+0,                                              /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"ButLP objects. Second-order Butterworth lowpass filter.",           /* tp_doc */
+(traverseproc)ButLP_traverse,                  /* tp_traverse */
+(inquiry)ButLP_clear,                          /* tp_clear */
+0,                                              /* tp_richcompare */
+0,                                              /* tp_weaklistoffset */
+0,                                              /* tp_iter */
+0,                                              /* tp_iternext */
+ButLP_methods,                                 /* tp_methods */
+ButLP_members,                                 /* tp_members */
+0,                                              /* tp_getset */
+0,                                              /* tp_base */
+0,                                              /* tp_dict */
+0,                                              /* tp_descr_get */
+0,                                              /* tp_descr_set */
+0,                                              /* tp_dictoffset */
+0,                          /* tp_init */
+0,                                              /* tp_alloc */
+ButLP_new,                                     /* tp_new */
 };
 
 /************/
-/* ButLP */
+/* ButHP */
 /************/
 typedef struct {
     pyo_audio_HEAD
@@ -9258,26 +10102,26 @@ typedef struct {
     PyObject *freq;
     Stream *freq_stream;
     int modebuffer[3]; // need at least 2 slots for mul & add
-    MYFLT lastFreq;
-    MYFLT nyquist;
-    MYFLT piOnSr;
-    MYFLT sqrt2;
+    MYSTATE lastFreq;
+    MYSTATE nyquist;
+    MYSTATE piOnSr;
+    MYSTATE sqrt2;
     // sample memories
-    MYFLT x1;
-    MYFLT x2;
-    MYFLT y1;
-    MYFLT y2;
+    MYSTATE x1;
+    MYSTATE x2;
+    MYSTATE y1;
+    MYSTATE y2;
     // variables
-    MYFLT a0;
-    MYFLT a1;
-    MYFLT a2;
-    MYFLT b1;
-    MYFLT b2;
-} ButLP;
+    MYSTATE a0;
+    MYSTATE a1;
+    MYSTATE a2;
+    MYSTATE b1;
+    MYSTATE b2;
+} ButHP;
 
 static void
-ButLP_filters_i(ButLP *self) {
-    MYFLT val, c, c2;
+ButHP_filters_i(ButHP *self) {
+    MYSTATE val, c, c2;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT fr = PyFloat_AS_DOUBLE(self->freq);
@@ -9288,11 +10132,11 @@ ButLP_filters_i(ButLP *self) {
         else if (fr >= self->nyquist)
             fr = self->nyquist;
         self->lastFreq = fr;
-        c = 1.0 / MYTAN(self->piOnSr * fr);
+        c = STTAN(self->piOnSr * fr);
         c2 = c * c;
         self->a0 = self->a2 = 1.0 / (1.0 + self->sqrt2 * c + c2);
-        self->a1 = 2.0 * self->a0;
-        self->b1 = self->a1 * (1.0 - c2);
+        self->a1 = -2.0 * self->a0;
+        self->b1 = 2.0 * self->a0 * (c2 - 1.0);
         self->b2 = self->a0 * (1.0 - self->sqrt2 * c + c2);
     }
 
@@ -9306,8 +10150,8 @@ ButLP_filters_i(ButLP *self) {
 }
 
 static void
-ButLP_filters_a(ButLP *self) {
-    MYFLT val, fr, c, c2;
+ButHP_filters_a(ButHP *self) {
+    MYSTATE val, fr, c, c2;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
@@ -9320,11 +10164,11 @@ ButLP_filters_a(ButLP *self) {
             else if (fr >= self->nyquist)
                 fr = self->nyquist;
             self->lastFreq = fr;
-            c = 1.0 / MYTAN(self->piOnSr * fr);
+            c = STTAN(self->piOnSr * fr);
             c2 = c * c;
             self->a0 = self->a2 = 1.0 / (1.0 + self->sqrt2 * c + c2);
-            self->a1 = 2.0 * self->a0;
-            self->b1 = self->a1 * (1.0 - c2);
+            self->a1 = -2.0 * self->a0;
+            self->b1 = 2.0 * self->a0 * (c2 - 1.0);
             self->b2 = self->a0 * (1.0 - self->sqrt2 * c + c2);
         }
         val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
@@ -9335,18 +10179,18 @@ ButLP_filters_a(ButLP *self) {
     }
 }
 
-static void ButLP_postprocessing_ii(ButLP *self) { POST_PROCESSING_II };
-static void ButLP_postprocessing_ai(ButLP *self) { POST_PROCESSING_AI };
-static void ButLP_postprocessing_ia(ButLP *self) { POST_PROCESSING_IA };
-static void ButLP_postprocessing_aa(ButLP *self) { POST_PROCESSING_AA };
-static void ButLP_postprocessing_ireva(ButLP *self) { POST_PROCESSING_IREVA };
-static void ButLP_postprocessing_areva(ButLP *self) { POST_PROCESSING_AREVA };
-static void ButLP_postprocessing_revai(ButLP *self) { POST_PROCESSING_REVAI };
-static void ButLP_postprocessing_revaa(ButLP *self) { POST_PROCESSING_REVAA };
-static void ButLP_postprocessing_revareva(ButLP *self) { POST_PROCESSING_REVAREVA };
+static void ButHP_postprocessing_ii(ButHP *self) { POST_PROCESSING_II };
+static void ButHP_postprocessing_ai(ButHP *self) { POST_PROCESSING_AI };
+static void ButHP_postprocessing_ia(ButHP *self) { POST_PROCESSING_IA };
+static void ButHP_postprocessing_aa(ButHP *self) { POST_PROCESSING_AA };
+static void ButHP_postprocessing_ireva(ButHP *self) { POST_PROCESSING_IREVA };
+static void ButHP_postprocessing_areva(ButHP *self) { POST_PROCESSING_AREVA };
+static void ButHP_postprocessing_revai(ButHP *self) { POST_PROCESSING_REVAI };
+static void ButHP_postprocessing_revaa(ButHP *self) { POST_PROCESSING_REVAA };
+static void ButHP_postprocessing_revareva(ButHP *self) { POST_PROCESSING_REVAREVA };
 
 static void
-ButLP_setProcMode(ButLP *self)
+ButHP_setProcMode(ButHP *self)
 {
     int procmode, muladdmode;
     procmode = self->modebuffer[2];
@@ -9354,52 +10198,52 @@ ButLP_setProcMode(ButLP *self)
 
 	switch (procmode) {
         case 0:
-            self->proc_func_ptr = ButLP_filters_i;
+            self->proc_func_ptr = ButHP_filters_i;
             break;
         case 1:
-            self->proc_func_ptr = ButLP_filters_a;
+            self->proc_func_ptr = ButHP_filters_a;
             break;
     }
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = ButLP_postprocessing_ii;
+            self->muladd_func_ptr = ButHP_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = ButLP_postprocessing_ai;
+            self->muladd_func_ptr = ButHP_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = ButLP_postprocessing_revai;
+            self->muladd_func_ptr = ButHP_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = ButLP_postprocessing_ia;
+            self->muladd_func_ptr = ButHP_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = ButLP_postprocessing_aa;
+            self->muladd_func_ptr = ButHP_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = ButLP_postprocessing_revaa;
+            self->muladd_func_ptr = ButHP_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = ButLP_postprocessing_ireva;
+            self->muladd_func_ptr = ButHP_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = ButLP_postprocessing_areva;
+            self->muladd_func_ptr = ButHP_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = ButLP_postprocessing_revareva;
+            self->muladd_func_ptr = ButHP_postprocessing_revareva;
             break;
     }
 }
 
 static void
-ButLP_compute_next_data_frame(ButLP *self)
+ButHP_compute_next_data_frame(ButHP *self)
 {
     (*self->proc_func_ptr)(self);
     (*self->muladd_func_ptr)(self);
 }
 
 static int
-ButLP_traverse(ButLP *self, visitproc visit, void *arg)
+ButHP_traverse(ButHP *self, visitproc visit, void *arg)
 {
     pyo_VISIT
     Py_VISIT(self->input);
@@ -9410,7 +10254,7 @@ ButLP_traverse(ButLP *self, visitproc visit, void *arg)
 }
 
 static int
-ButLP_clear(ButLP *self)
+ButHP_clear(ButHP *self)
 {
     pyo_CLEAR
     Py_CLEAR(self->input);
@@ -9421,20 +10265,20 @@ ButLP_clear(ButLP *self)
 }
 
 static void
-ButLP_dealloc(ButLP* self)
+ButHP_dealloc(ButHP* self)
 {
     pyo_DEALLOC
-    ButLP_clear(self);
+    ButHP_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
 static PyObject *
-ButLP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+ButHP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
     PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *multmp=NULL, *addtmp=NULL;
-    ButLP *self;
-    self = (ButLP *)type->tp_alloc(type, 0);
+    ButHP *self;
+    self = (ButHP *)type->tp_alloc(type, 0);
 
     self->freq = PyFloat_FromDouble(1000);
     self->lastFreq = -1.0;
@@ -9447,10 +10291,10 @@ ButLP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     self->nyquist = (MYFLT)self->sr * 0.49;
     self->piOnSr = PI / (MYFLT)self->sr;
-    self->sqrt2 = MYSQRT(2.0);
+    self->sqrt2 = STSQRT(2.0);
 
-    Stream_setFunctionPtr(self->stream, ButLP_compute_next_data_frame);
-    self->mode_func_ptr = ButLP_setProcMode;
+    Stream_setFunctionPtr(self->stream, ButHP_compute_next_data_frame);
+    self->mode_func_ptr = ButHP_setProcMode;
 
     static char *kwlist[] = {"input", "freq", "mul", "add", NULL};
 
@@ -9478,28 +10322,28 @@ ButLP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     return (PyObject *)self;
 }
 
-static PyObject * ButLP_getServer(ButLP* self) { GET_SERVER };
-static PyObject * ButLP_getStream(ButLP* self) { GET_STREAM };
-static PyObject * ButLP_setMul(ButLP *self, PyObject *arg) { SET_MUL };
-static PyObject * ButLP_setAdd(ButLP *self, PyObject *arg) { SET_ADD };
-static PyObject * ButLP_setSub(ButLP *self, PyObject *arg) { SET_SUB };
-static PyObject * ButLP_setDiv(ButLP *self, PyObject *arg) { SET_DIV };
+static PyObject * ButHP_getServer(ButHP* self) { GET_SERVER };
+static PyObject * ButHP_getStream(ButHP* self) { GET_STREAM };
+static PyObject * ButHP_setMul(ButHP *self, PyObject *arg) { SET_MUL };
+static PyObject * ButHP_setAdd(ButHP *self, PyObject *arg) { SET_ADD };
+static PyObject * ButHP_setSub(ButHP *self, PyObject *arg) { SET_SUB };
+static PyObject * ButHP_setDiv(ButHP *self, PyObject *arg) { SET_DIV };
 
-static PyObject * ButLP_play(ButLP *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * ButLP_out(ButLP *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * ButLP_stop(ButLP *self) { STOP };
+static PyObject * ButHP_play(ButHP *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * ButHP_out(ButHP *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * ButHP_stop(ButHP *self) { STOP };
 
-static PyObject * ButLP_multiply(ButLP *self, PyObject *arg) { MULTIPLY };
-static PyObject * ButLP_inplace_multiply(ButLP *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * ButLP_add(ButLP *self, PyObject *arg) { ADD };
-static PyObject * ButLP_inplace_add(ButLP *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * ButLP_sub(ButLP *self, PyObject *arg) { SUB };
-static PyObject * ButLP_inplace_sub(ButLP *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * ButLP_div(ButLP *self, PyObject *arg) { DIV };
-static PyObject * ButLP_inplace_div(ButLP *self, PyObject *arg) { INPLACE_DIV };
+static PyObject * ButHP_multiply(ButHP *self, PyObject *arg) { MULTIPLY };
+static PyObject * ButHP_inplace_multiply(ButHP *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * ButHP_add(ButHP *self, PyObject *arg) { ADD };
+static PyObject * ButHP_inplace_add(ButHP *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * ButHP_sub(ButHP *self, PyObject *arg) { SUB };
+static PyObject * ButHP_inplace_sub(ButHP *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * ButHP_div(ButHP *self, PyObject *arg) { DIV };
+static PyObject * ButHP_inplace_div(ButHP *self, PyObject *arg) { INPLACE_DIV };
 
 static PyObject *
-ButLP_setFreq(ButLP *self, PyObject *arg)
+ButHP_setFreq(ButHP *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -9532,35 +10376,35 @@ ButLP_setFreq(ButLP *self, PyObject *arg)
 	return Py_None;
 }
 
-static PyMemberDef ButLP_members[] = {
-{"server", T_OBJECT_EX, offsetof(ButLP, server), 0, "Pyo server."},
-{"stream", T_OBJECT_EX, offsetof(ButLP, stream), 0, "Stream object."},
-{"input", T_OBJECT_EX, offsetof(ButLP, input), 0, "Input sound object."},
-{"freq", T_OBJECT_EX, offsetof(ButLP, freq), 0, "Cutoff frequency in cycle per second."},
-{"mul", T_OBJECT_EX, offsetof(ButLP, mul), 0, "Mul factor."},
-{"add", T_OBJECT_EX, offsetof(ButLP, add), 0, "Add factor."},
+static PyMemberDef ButHP_members[] = {
+{"server", T_OBJECT_EX, offsetof(ButHP, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(ButHP, stream), 0, "Stream object."},
+{"input", T_OBJECT_EX, offsetof(ButHP, input), 0, "Input sound object."},
+{"freq", T_OBJECT_EX, offsetof(ButHP, freq), 0, "Cutoff frequency in cycle per second."},
+{"mul", T_OBJECT_EX, offsetof(ButHP, mul), 0, "Mul factor."},
+{"add", T_OBJECT_EX, offsetof(ButHP, add), 0, "Add factor."},
 {NULL}  /* Sentinel */
 };
 
-static PyMethodDef ButLP_methods[] = {
-{"getServer", (PyCFunction)ButLP_getServer, METH_NOARGS, "Returns server object."},
-{"_getStream", (PyCFunction)ButLP_getStream, METH_NOARGS, "Returns stream object."},
-{"play", (PyCFunction)ButLP_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-{"out", (PyCFunction)ButLP_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-{"stop", (PyCFunction)ButLP_stop, METH_NOARGS, "Stops computing."},
-{"setFreq", (PyCFunction)ButLP_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
-{"setMul", (PyCFunction)ButLP_setMul, METH_O, "Sets oscillator mul factor."},
-{"setAdd", (PyCFunction)ButLP_setAdd, METH_O, "Sets oscillator add factor."},
-{"setSub", (PyCFunction)ButLP_setSub, METH_O, "Sets inverse add factor."},
-{"setDiv", (PyCFunction)ButLP_setDiv, METH_O, "Sets inverse mul factor."},
+static PyMethodDef ButHP_methods[] = {
+{"getServer", (PyCFunction)ButHP_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)ButHP_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)ButHP_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"out", (PyCFunction)ButHP_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+{"stop", (PyCFunction)ButHP_stop, METH_NOARGS, "Stops computing."},
+{"setFreq", (PyCFunction)ButHP_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
+{"setMul", (PyCFunction)ButHP_setMul, METH_O, "Sets oscillator mul factor."},
+{"setAdd", (PyCFunction)ButHP_setAdd, METH_O, "Sets oscillator add factor."},
+{"setSub", (PyCFunction)ButHP_setSub, METH_O, "Sets inverse add factor."},
+{"setDiv", (PyCFunction)ButHP_setDiv, METH_O, "Sets inverse mul factor."},
 {NULL}  /* Sentinel */
 };
 
-static PyNumberMethods ButLP_as_number = {
-(binaryfunc)ButLP_add,                         /*nb_add*/
-(binaryfunc)ButLP_sub,                         /*nb_subtract*/
-(binaryfunc)ButLP_multiply,                    /*nb_multiply*/
-(binaryfunc)ButLP_div,                                              /*nb_divide*/
+static PyNumberMethods ButHP_as_number = {
+(binaryfunc)ButHP_add,                         /*nb_add*/
+(binaryfunc)ButHP_sub,                         /*nb_subtract*/
+(binaryfunc)ButHP_multiply,                    /*nb_multiply*/
+(binaryfunc)ButHP_div,                                              /*nb_divide*/
 0,                                              /*nb_remainder*/
 0,                                              /*nb_divmod*/
 0,                                              /*nb_power*/
@@ -9580,10 +10424,10 @@ static PyNumberMethods ButLP_as_number = {
 0,                                              /*nb_float*/
 0,                                              /*nb_oct*/
 0,                                              /*nb_hex*/
-(binaryfunc)ButLP_inplace_add,                 /*inplace_add*/
-(binaryfunc)ButLP_inplace_sub,                 /*inplace_subtract*/
-(binaryfunc)ButLP_inplace_multiply,            /*inplace_multiply*/
-(binaryfunc)ButLP_inplace_div,                                              /*inplace_divide*/
+(binaryfunc)ButHP_inplace_add,                 /*inplace_add*/
+(binaryfunc)ButHP_inplace_sub,                 /*inplace_subtract*/
+(binaryfunc)ButHP_inplace_multiply,            /*inplace_multiply*/
+(binaryfunc)ButHP_inplace_div,                                              /*inplace_divide*/
 0,                                              /*inplace_remainder*/
 0,                                              /*inplace_power*/
 0,                                              /*inplace_lshift*/
@@ -9598,19 +10442,19 @@ static PyNumberMethods ButLP_as_number = {
 0,                                              /* nb_index */
 };
 
-PyTypeObject ButLPType = {
+PyTypeObject ButHPType = {
 PyObject_HEAD_INIT(NULL)
 0,                                              /*ob_size*/
-"_pyo.ButLP_base",                                   /*tp_name*/
-sizeof(ButLP),                                 /*tp_basicsize*/
+"_pyo.ButHP_base",                                   /*tp_name*/
+sizeof(ButHP),                                 /*tp_basicsize*/
 0,                                              /*tp_itemsize*/
-(destructor)ButLP_dealloc,                     /*tp_dealloc*/
+(destructor)ButHP_dealloc,                     /*tp_dealloc*/
 0,                                              /*tp_print*/
 0,                                              /*tp_getattr*/
 0,                                              /*tp_setattr*/
 0,                                              /*tp_compare*/
 0,                                              /*tp_repr*/
-&ButLP_as_number,                              /*tp_as_number*/
+&ButHP_as_number,                              /*tp_as_number*/
 0,                                              /*tp_as_sequence*/
 0,                                              /*tp_as_mapping*/
 0,                                              /*tp_hash */
@@ -9620,15 +10464,15 @@ sizeof(ButLP),                                 /*tp_basicsize*/
 0,                                              /*tp_setattro*/
 0,                                              /*tp_as_buffer*/
 Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-"ButLP objects. Second-order Butterworth lowpass filter.",           /* tp_doc */
-(traverseproc)ButLP_traverse,                  /* tp_traverse */
-(inquiry)ButLP_clear,                          /* tp_clear */
+"ButHP objects. Second-order Butterworth highpass filter.",           /* tp_doc */
+(traverseproc)ButHP_traverse,                  /* tp_traverse */
+(inquiry)ButHP_clear,                          /* tp_clear */
 0,                                              /* tp_richcompare */
 0,                                              /* tp_weaklistoffset */
 0,                                              /* tp_iter */
 0,                                              /* tp_iternext */
-ButLP_methods,                                 /* tp_methods */
-ButLP_members,                                 /* tp_members */
+ButHP_methods,                                 /* tp_methods */
+ButHP_members,                                 /* tp_members */
 0,                                              /* tp_getset */
 0,                                              /* tp_base */
 0,                                              /* tp_dict */
@@ -9637,11 +10481,11 @@ ButLP_members,                                 /* tp_members */
 0,                                              /* tp_dictoffset */
 0,                          /* tp_init */
 0,                                              /* tp_alloc */
-ButLP_new,                                     /* tp_new */
+ButHP_new,                                     /* tp_new */
 };
 
 /************/
-/* ButHP */
+/* ButBP */
 /************/
 typedef struct {
     pyo_audio_HEAD
@@ -9649,47 +10493,109 @@ typedef struct {
     Stream *input_stream;
     PyObject *freq;
     Stream *freq_stream;
-    int modebuffer[3]; // need at least 2 slots for mul & add
-    MYFLT lastFreq;
-    MYFLT nyquist;
-    MYFLT piOnSr;
-    MYFLT sqrt2;
+    PyObject *q;
+    Stream *q_stream;
+    int modebuffer[4]; // need at least 2 slots for mul & add
+    MYSTATE nyquist;
+    MYSTATE last_freq;
+    MYSTATE last_q;
+    MYSTATE piOnSr;
     // sample memories
-    MYFLT x1;
-    MYFLT x2;
-    MYFLT y1;
-    MYFLT y2;
-    // variables
-    MYFLT a0;
-    MYFLT a1;
-    MYFLT a2;
-    MYFLT b1;
-    MYFLT b2;
-} ButHP;
+    MYSTATE x1;
+    MYSTATE x2;
+    MYSTATE y1;
+    MYSTATE y2;
+    // coefficients
+    MYSTATE a0;
+    MYSTATE a2;
+    MYSTATE b1;
+    MYSTATE b2;
+} ButBP;
+
+static void
+ButBP_compute_coeffs(ButBP *self, MYFLT freq, MYFLT q)
+{
+    MYSTATE bw, c, d;
+
+    if (freq < 1.0)
+        freq = 1.0;
+    else if (freq > self->nyquist)
+        freq = self->nyquist;
+    if (q < 1.0)
+        q = 1.0;
+
+    bw = freq / q;
+    c = 1.0 / STTAN(self->piOnSr * bw);
+    d = 2.0 * STCOS(2.0 * self->piOnSr * freq);
+
+    self->a0 = 1.0 / (1.0 + c);
+    self->a2 = -self->a0;
+    self->b1 = self->a2 * c * d;
+    self->b2 = self->a0 * (c - 1.0);
+}
+
+static void
+ButBP_filters_ii(ButBP *self) {
+    MYSTATE val, fr, q;
+    int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    fr = PyFloat_AS_DOUBLE(self->freq);
+    q = PyFloat_AS_DOUBLE(self->q);
+
+    if (fr != self->last_freq || q != self->last_q) {
+        self->last_freq = fr;
+        self->last_q = q;
+        ButBP_compute_coeffs(self, fr, q);
+    }
+
+    for (i=0; i<self->bufsize; i++) {
+        val = self->a0 * in[i] + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        self->x2 = self->x1;
+        self->x1 = in[i];
+        self->y2 = self->y1;
+        self->data[i] = self->y1 = val;
+    }
+}
+
+static void
+ButBP_filters_ai(ButBP *self) {
+    MYSTATE val, fr, q;
+    int i;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+    MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
+    q = PyFloat_AS_DOUBLE(self->q);
+
+    for (i=0; i<self->bufsize; i++) {
+        fr = freq[i];
+        if (fr != self->last_freq || q != self->last_q) {
+            self->last_freq = fr;
+            self->last_q = q;
+            ButBP_compute_coeffs(self, fr, q);
+        }
+        val = self->a0 * in[i] + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        self->x2 = self->x1;
+        self->x1 = in[i];
+        self->y2 = self->y1;
+        self->data[i] = self->y1 = val;
+    }
+}
 
 static void
-ButHP_filters_i(ButHP *self) {
-    MYFLT val, c, c2;
+ButBP_filters_ia(ButBP *self) {
+    MYSTATE val, fr, q;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT fr = PyFloat_AS_DOUBLE(self->freq);
-
-    if (fr != self->lastFreq) {
-        if (fr <= 1.0)
-            fr = 1.0;
-        else if (fr >= self->nyquist)
-            fr = self->nyquist;
-        self->lastFreq = fr;
-        c = MYTAN(self->piOnSr * fr);
-        c2 = c * c;
-        self->a0 = self->a2 = 1.0 / (1.0 + self->sqrt2 * c + c2);
-        self->a1 = -2.0 * self->a0;
-        self->b1 = 2.0 * self->a0 * (c2 - 1.0);
-        self->b2 = self->a0 * (1.0 - self->sqrt2 * c + c2);
-    }
+    fr = PyFloat_AS_DOUBLE(self->freq);
+    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
 
     for (i=0; i<self->bufsize; i++) {
-        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        q = qst[i];
+        if (fr != self->last_freq || q != self->last_q) {
+            self->last_freq = fr;
+            self->last_q = q;
+            ButBP_compute_coeffs(self, fr, q);
+        }
+        val = self->a0 * in[i] + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
         self->x2 = self->x1;
         self->x1 = in[i];
         self->y2 = self->y1;
@@ -9698,28 +10604,22 @@ ButHP_filters_i(ButHP *self) {
 }
 
 static void
-ButHP_filters_a(ButHP *self) {
-    MYFLT val, fr, c, c2;
+ButBP_filters_aa(ButBP *self) {
+    MYSTATE val, fr, q;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
+    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
 
     for (i=0; i<self->bufsize; i++) {
         fr = freq[i];
-        if (fr != self->lastFreq) {
-            if (fr <= 1.0)
-                fr = 1.0;
-            else if (fr >= self->nyquist)
-                fr = self->nyquist;
-            self->lastFreq = fr;
-            c = MYTAN(self->piOnSr * fr);
-            c2 = c * c;
-            self->a0 = self->a2 = 1.0 / (1.0 + self->sqrt2 * c + c2);
-            self->a1 = -2.0 * self->a0;
-            self->b1 = 2.0 * self->a0 * (c2 - 1.0);
-            self->b2 = self->a0 * (1.0 - self->sqrt2 * c + c2);
+        q = qst[i];
+        if (fr != self->last_freq || q != self->last_q) {
+            self->last_freq = fr;
+            self->last_q = q;
+            ButBP_compute_coeffs(self, fr, q);
         }
-        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        val = self->a0 * in[i] + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
         self->x2 = self->x1;
         self->x1 = in[i];
         self->y2 = self->y1;
@@ -9727,126 +10627,138 @@ ButHP_filters_a(ButHP *self) {
     }
 }
 
-static void ButHP_postprocessing_ii(ButHP *self) { POST_PROCESSING_II };
-static void ButHP_postprocessing_ai(ButHP *self) { POST_PROCESSING_AI };
-static void ButHP_postprocessing_ia(ButHP *self) { POST_PROCESSING_IA };
-static void ButHP_postprocessing_aa(ButHP *self) { POST_PROCESSING_AA };
-static void ButHP_postprocessing_ireva(ButHP *self) { POST_PROCESSING_IREVA };
-static void ButHP_postprocessing_areva(ButHP *self) { POST_PROCESSING_AREVA };
-static void ButHP_postprocessing_revai(ButHP *self) { POST_PROCESSING_REVAI };
-static void ButHP_postprocessing_revaa(ButHP *self) { POST_PROCESSING_REVAA };
-static void ButHP_postprocessing_revareva(ButHP *self) { POST_PROCESSING_REVAREVA };
+static void ButBP_postprocessing_ii(ButBP *self) { POST_PROCESSING_II };
+static void ButBP_postprocessing_ai(ButBP *self) { POST_PROCESSING_AI };
+static void ButBP_postprocessing_ia(ButBP *self) { POST_PROCESSING_IA };
+static void ButBP_postprocessing_aa(ButBP *self) { POST_PROCESSING_AA };
+static void ButBP_postprocessing_ireva(ButBP *self) { POST_PROCESSING_IREVA };
+static void ButBP_postprocessing_areva(ButBP *self) { POST_PROCESSING_AREVA };
+static void ButBP_postprocessing_revai(ButBP *self) { POST_PROCESSING_REVAI };
+static void ButBP_postprocessing_revaa(ButBP *self) { POST_PROCESSING_REVAA };
+static void ButBP_postprocessing_revareva(ButBP *self) { POST_PROCESSING_REVAREVA };
 
 static void
-ButHP_setProcMode(ButHP *self)
+ButBP_setProcMode(ButBP *self)
 {
     int procmode, muladdmode;
-    procmode = self->modebuffer[2];
+    procmode = self->modebuffer[2] + self->modebuffer[3] * 10;
     muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
 
 	switch (procmode) {
         case 0:
-            self->proc_func_ptr = ButHP_filters_i;
+            self->proc_func_ptr = ButBP_filters_ii;
             break;
         case 1:
-            self->proc_func_ptr = ButHP_filters_a;
+            self->proc_func_ptr = ButBP_filters_ai;
+            break;
+        case 10:
+            self->proc_func_ptr = ButBP_filters_ia;
+            break;
+        case 11:
+            self->proc_func_ptr = ButBP_filters_aa;
             break;
     }
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = ButHP_postprocessing_ii;
+            self->muladd_func_ptr = ButBP_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = ButHP_postprocessing_ai;
+            self->muladd_func_ptr = ButBP_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = ButHP_postprocessing_revai;
+            self->muladd_func_ptr = ButBP_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = ButHP_postprocessing_ia;
+            self->muladd_func_ptr = ButBP_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = ButHP_postprocessing_aa;
+            self->muladd_func_ptr = ButBP_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = ButHP_postprocessing_revaa;
+            self->muladd_func_ptr = ButBP_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = ButHP_postprocessing_ireva;
+            self->muladd_func_ptr = ButBP_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = ButHP_postprocessing_areva;
+            self->muladd_func_ptr = ButBP_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = ButHP_postprocessing_revareva;
+            self->muladd_func_ptr = ButBP_postprocessing_revareva;
             break;
     }
 }
 
 static void
-ButHP_compute_next_data_frame(ButHP *self)
+ButBP_compute_next_data_frame(ButBP *self)
 {
     (*self->proc_func_ptr)(self);
     (*self->muladd_func_ptr)(self);
 }
 
 static int
-ButHP_traverse(ButHP *self, visitproc visit, void *arg)
+ButBP_traverse(ButBP *self, visitproc visit, void *arg)
 {
     pyo_VISIT
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
     Py_VISIT(self->freq);
     Py_VISIT(self->freq_stream);
+    Py_VISIT(self->q);
+    Py_VISIT(self->q_stream);
     return 0;
 }
 
 static int
-ButHP_clear(ButHP *self)
+ButBP_clear(ButBP *self)
 {
     pyo_CLEAR
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
     Py_CLEAR(self->freq);
     Py_CLEAR(self->freq_stream);
+    Py_CLEAR(self->q);
+    Py_CLEAR(self->q_stream);
     return 0;
 }
 
 static void
-ButHP_dealloc(ButHP* self)
+ButBP_dealloc(ButBP* self)
 {
     pyo_DEALLOC
-    ButHP_clear(self);
+    ButBP_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
 static PyObject *
-ButHP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+ButBP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
-    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *multmp=NULL, *addtmp=NULL;
-    ButHP *self;
-    self = (ButHP *)type->tp_alloc(type, 0);
+    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *qtmp=NULL, *multmp=NULL, *addtmp=NULL;
+    ButBP *self;
+    self = (ButBP *)type->tp_alloc(type, 0);
 
     self->freq = PyFloat_FromDouble(1000);
-    self->lastFreq = -1.0;
-    self->x1 = self->x2 = self->y1 = self->y2 = self->a0 = self->a1 = self->a2 = self->b1 = self->b2 = 0.0;
+    self->q = PyFloat_FromDouble(1);
+    self->last_freq = self->last_q = -1.0;
+    self->x1 = self->x2 = self->y1 = self->y2 = 0.0;
+    self->a0 = self->a2 = self->b1 = self->b2 = 0.0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
 	self->modebuffer[2] = 0;
+	self->modebuffer[3] = 0;
 
     INIT_OBJECT_COMMON
 
     self->nyquist = (MYFLT)self->sr * 0.49;
     self->piOnSr = PI / (MYFLT)self->sr;
-    self->sqrt2 = MYSQRT(2.0);
 
-    Stream_setFunctionPtr(self->stream, ButHP_compute_next_data_frame);
-    self->mode_func_ptr = ButHP_setProcMode;
+    Stream_setFunctionPtr(self->stream, ButBP_compute_next_data_frame);
+    self->mode_func_ptr = ButBP_setProcMode;
 
-    static char *kwlist[] = {"input", "freq", "mul", "add", NULL};
+    static char *kwlist[] = {"input", "freq", "q", "mul", "add", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOO", kwlist, &inputtmp, &freqtmp, &multmp, &addtmp))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOO", kwlist, &inputtmp, &freqtmp, &qtmp, &multmp, &addtmp))
         Py_RETURN_NONE;
 
     INIT_INPUT_STREAM
@@ -9855,6 +10767,10 @@ ButHP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
     }
 
+    if (qtmp) {
+        PyObject_CallMethod((PyObject *)self, "setQ", "O", qtmp);
+    }
+
     if (multmp) {
         PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
     }
@@ -9870,28 +10786,28 @@ ButHP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     return (PyObject *)self;
 }
 
-static PyObject * ButHP_getServer(ButHP* self) { GET_SERVER };
-static PyObject * ButHP_getStream(ButHP* self) { GET_STREAM };
-static PyObject * ButHP_setMul(ButHP *self, PyObject *arg) { SET_MUL };
-static PyObject * ButHP_setAdd(ButHP *self, PyObject *arg) { SET_ADD };
-static PyObject * ButHP_setSub(ButHP *self, PyObject *arg) { SET_SUB };
-static PyObject * ButHP_setDiv(ButHP *self, PyObject *arg) { SET_DIV };
+static PyObject * ButBP_getServer(ButBP* self) { GET_SERVER };
+static PyObject * ButBP_getStream(ButBP* self) { GET_STREAM };
+static PyObject * ButBP_setMul(ButBP *self, PyObject *arg) { SET_MUL };
+static PyObject * ButBP_setAdd(ButBP *self, PyObject *arg) { SET_ADD };
+static PyObject * ButBP_setSub(ButBP *self, PyObject *arg) { SET_SUB };
+static PyObject * ButBP_setDiv(ButBP *self, PyObject *arg) { SET_DIV };
 
-static PyObject * ButHP_play(ButHP *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * ButHP_out(ButHP *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * ButHP_stop(ButHP *self) { STOP };
+static PyObject * ButBP_play(ButBP *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * ButBP_out(ButBP *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * ButBP_stop(ButBP *self) { STOP };
 
-static PyObject * ButHP_multiply(ButHP *self, PyObject *arg) { MULTIPLY };
-static PyObject * ButHP_inplace_multiply(ButHP *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * ButHP_add(ButHP *self, PyObject *arg) { ADD };
-static PyObject * ButHP_inplace_add(ButHP *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * ButHP_sub(ButHP *self, PyObject *arg) { SUB };
-static PyObject * ButHP_inplace_sub(ButHP *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * ButHP_div(ButHP *self, PyObject *arg) { DIV };
-static PyObject * ButHP_inplace_div(ButHP *self, PyObject *arg) { INPLACE_DIV };
+static PyObject * ButBP_multiply(ButBP *self, PyObject *arg) { MULTIPLY };
+static PyObject * ButBP_inplace_multiply(ButBP *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * ButBP_add(ButBP *self, PyObject *arg) { ADD };
+static PyObject * ButBP_inplace_add(ButBP *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * ButBP_sub(ButBP *self, PyObject *arg) { SUB };
+static PyObject * ButBP_inplace_sub(ButBP *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * ButBP_div(ButBP *self, PyObject *arg) { DIV };
+static PyObject * ButBP_inplace_div(ButBP *self, PyObject *arg) { INPLACE_DIV };
 
 static PyObject *
-ButHP_setFreq(ButHP *self, PyObject *arg)
+ButBP_setFreq(ButBP *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -9924,116 +10840,152 @@ ButHP_setFreq(ButHP *self, PyObject *arg)
 	return Py_None;
 }
 
-static PyMemberDef ButHP_members[] = {
-{"server", T_OBJECT_EX, offsetof(ButHP, server), 0, "Pyo server."},
-{"stream", T_OBJECT_EX, offsetof(ButHP, stream), 0, "Stream object."},
-{"input", T_OBJECT_EX, offsetof(ButHP, input), 0, "Input sound object."},
-{"freq", T_OBJECT_EX, offsetof(ButHP, freq), 0, "Cutoff frequency in cycle per second."},
-{"mul", T_OBJECT_EX, offsetof(ButHP, mul), 0, "Mul factor."},
-{"add", T_OBJECT_EX, offsetof(ButHP, add), 0, "Add factor."},
-{NULL}  /* Sentinel */
-};
+static PyObject *
+ButBP_setQ(ButBP *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
 
-static PyMethodDef ButHP_methods[] = {
-{"getServer", (PyCFunction)ButHP_getServer, METH_NOARGS, "Returns server object."},
-{"_getStream", (PyCFunction)ButHP_getStream, METH_NOARGS, "Returns stream object."},
-{"play", (PyCFunction)ButHP_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-{"out", (PyCFunction)ButHP_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-{"stop", (PyCFunction)ButHP_stop, METH_NOARGS, "Stops computing."},
-{"setFreq", (PyCFunction)ButHP_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
-{"setMul", (PyCFunction)ButHP_setMul, METH_O, "Sets oscillator mul factor."},
-{"setAdd", (PyCFunction)ButHP_setAdd, METH_O, "Sets oscillator add factor."},
-{"setSub", (PyCFunction)ButHP_setSub, METH_O, "Sets inverse add factor."},
-{"setDiv", (PyCFunction)ButHP_setDiv, METH_O, "Sets inverse mul factor."},
-{NULL}  /* Sentinel */
-};
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
 
-static PyNumberMethods ButHP_as_number = {
-(binaryfunc)ButHP_add,                         /*nb_add*/
-(binaryfunc)ButHP_sub,                         /*nb_subtract*/
-(binaryfunc)ButHP_multiply,                    /*nb_multiply*/
-(binaryfunc)ButHP_div,                                              /*nb_divide*/
-0,                                              /*nb_remainder*/
-0,                                              /*nb_divmod*/
-0,                                              /*nb_power*/
-0,                                              /*nb_neg*/
-0,                                              /*nb_pos*/
-0,                                              /*(unaryfunc)array_abs,*/
-0,                                              /*nb_nonzero*/
-0,                                              /*nb_invert*/
-0,                                              /*nb_lshift*/
-0,                                              /*nb_rshift*/
-0,                                              /*nb_and*/
-0,                                              /*nb_xor*/
-0,                                              /*nb_or*/
-0,                                              /*nb_coerce*/
-0,                                              /*nb_int*/
-0,                                              /*nb_long*/
-0,                                              /*nb_float*/
-0,                                              /*nb_oct*/
-0,                                              /*nb_hex*/
-(binaryfunc)ButHP_inplace_add,                 /*inplace_add*/
-(binaryfunc)ButHP_inplace_sub,                 /*inplace_subtract*/
-(binaryfunc)ButHP_inplace_multiply,            /*inplace_multiply*/
-(binaryfunc)ButHP_inplace_div,                                              /*inplace_divide*/
-0,                                              /*inplace_remainder*/
-0,                                              /*inplace_power*/
-0,                                              /*inplace_lshift*/
-0,                                              /*inplace_rshift*/
-0,                                              /*inplace_and*/
-0,                                              /*inplace_xor*/
-0,                                              /*inplace_or*/
-0,                                              /*nb_floor_divide*/
-0,                                              /*nb_true_divide*/
-0,                                              /*nb_inplace_floor_divide*/
-0,                                              /*nb_inplace_true_divide*/
-0,                                              /* nb_index */
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->q);
+	if (isNumber == 1) {
+		self->q = PyNumber_Float(tmp);
+        self->modebuffer[3] = 0;
+	}
+	else {
+		self->q = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->q, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->q_stream);
+        self->q_stream = (Stream *)streamtmp;
+		self->modebuffer[3] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyMemberDef ButBP_members[] = {
+    {"server", T_OBJECT_EX, offsetof(ButBP, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(ButBP, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(ButBP, input), 0, "Input sound object."},
+    {"freq", T_OBJECT_EX, offsetof(ButBP, freq), 0, "Cutoff frequency in cycle per second."},
+    {"q", T_OBJECT_EX, offsetof(ButBP, q), 0, "Q factor."},
+    {"mul", T_OBJECT_EX, offsetof(ButBP, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(ButBP, add), 0, "Add factor."},
+    {NULL}  /* Sentinel */
 };
 
-PyTypeObject ButHPType = {
-PyObject_HEAD_INIT(NULL)
-0,                                              /*ob_size*/
-"_pyo.ButHP_base",                                   /*tp_name*/
-sizeof(ButHP),                                 /*tp_basicsize*/
-0,                                              /*tp_itemsize*/
-(destructor)ButHP_dealloc,                     /*tp_dealloc*/
-0,                                              /*tp_print*/
-0,                                              /*tp_getattr*/
-0,                                              /*tp_setattr*/
-0,                                              /*tp_compare*/
-0,                                              /*tp_repr*/
-&ButHP_as_number,                              /*tp_as_number*/
-0,                                              /*tp_as_sequence*/
-0,                                              /*tp_as_mapping*/
-0,                                              /*tp_hash */
-0,                                              /*tp_call*/
-0,                                              /*tp_str*/
-0,                                              /*tp_getattro*/
-0,                                              /*tp_setattro*/
-0,                                              /*tp_as_buffer*/
-Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-"ButHP objects. Second-order Butterworth highpass filter.",           /* tp_doc */
-(traverseproc)ButHP_traverse,                  /* tp_traverse */
-(inquiry)ButHP_clear,                          /* tp_clear */
-0,                                              /* tp_richcompare */
-0,                                              /* tp_weaklistoffset */
-0,                                              /* tp_iter */
-0,                                              /* tp_iternext */
-ButHP_methods,                                 /* tp_methods */
-ButHP_members,                                 /* tp_members */
-0,                                              /* tp_getset */
-0,                                              /* tp_base */
-0,                                              /* tp_dict */
-0,                                              /* tp_descr_get */
-0,                                              /* tp_descr_set */
-0,                                              /* tp_dictoffset */
-0,                          /* tp_init */
-0,                                              /* tp_alloc */
-ButHP_new,                                     /* tp_new */
+static PyMethodDef ButBP_methods[] = {
+    {"getServer", (PyCFunction)ButBP_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)ButBP_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)ButBP_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)ButBP_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)ButBP_stop, METH_NOARGS, "Stops computing."},
+	{"setFreq", (PyCFunction)ButBP_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
+    {"setQ", (PyCFunction)ButBP_setQ, METH_O, "Sets filter Q factor."},
+	{"setMul", (PyCFunction)ButBP_setMul, METH_O, "Sets oscillator mul factor."},
+	{"setAdd", (PyCFunction)ButBP_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)ButBP_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)ButBP_setDiv, METH_O, "Sets inverse mul factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyNumberMethods ButBP_as_number = {
+    (binaryfunc)ButBP_add,                         /*nb_add*/
+    (binaryfunc)ButBP_sub,                         /*nb_subtract*/
+    (binaryfunc)ButBP_multiply,                    /*nb_multiply*/
+    (binaryfunc)ButBP_div,                                              /*nb_divide*/
+    0,                                              /*nb_remainder*/
+    0,                                              /*nb_divmod*/
+    0,                                              /*nb_power*/
+    0,                                              /*nb_neg*/
+    0,                                              /*nb_pos*/
+    0,                                              /*(unaryfunc)array_abs,*/
+    0,                                              /*nb_nonzero*/
+    0,                                              /*nb_invert*/
+    0,                                              /*nb_lshift*/
+    0,                                              /*nb_rshift*/
+    0,                                              /*nb_and*/
+    0,                                              /*nb_xor*/
+    0,                                              /*nb_or*/
+    0,                                              /*nb_coerce*/
+    0,                                              /*nb_int*/
+    0,                                              /*nb_long*/
+    0,                                              /*nb_float*/
+    0,                                              /*nb_oct*/
+    0,                                              /*nb_hex*/
+    (binaryfunc)ButBP_inplace_add,                 /*inplace_add*/
+    (binaryfunc)ButBP_inplace_sub,                 /*inplace_subtract*/
+    (binaryfunc)ButBP_inplace_multiply,            /*inplace_multiply*/
+    (binaryfunc)ButBP_inplace_div,                                              /*inplace_divide*/
+    0,                                              /*inplace_remainder*/
+    0,                                              /*inplace_power*/
+    0,                                              /*inplace_lshift*/
+    0,                                              /*inplace_rshift*/
+    0,                                              /*inplace_and*/
+    0,                                              /*inplace_xor*/
+    0,                                              /*inplace_or*/
+    0,                                              /*nb_floor_divide*/
+    0,                                              /*nb_true_divide*/
+    0,                                              /*nb_inplace_floor_divide*/
+    0,                                              /*nb_inplace_true_divide*/
+    0,                                              /* nb_index */
+};
+
+PyTypeObject ButBPType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                                              /*ob_size*/
+    "_pyo.ButBP_base",                                   /*tp_name*/
+    sizeof(ButBP),                                 /*tp_basicsize*/
+    0,                                              /*tp_itemsize*/
+    (destructor)ButBP_dealloc,                     /*tp_dealloc*/
+    0,                                              /*tp_print*/
+    0,                                              /*tp_getattr*/
+    0,                                              /*tp_setattr*/
+    0,                                              /*tp_compare*/
+    0,                                              /*tp_repr*/
+    &ButBP_as_number,                              /*tp_as_number*/
+    0,                                              /*tp_as_sequence*/
+    0,                                              /*tp_as_mapping*/
+    0,                                              /*tp_hash */
+    0,                                              /*tp_call*/
+    0,                                              /*tp_str*/
+    0,                                              /*tp_getattro*/
+    0,                                              /*tp_setattro*/
+    0,                                              /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "ButBP objects. Second-order Butterworth bandpass filter.",           /* tp_doc */
+    (traverseproc)ButBP_traverse,                  /* tp_traverse */
+    (inquiry)ButBP_clear,                          /* tp_clear */
+    0,                                              /* tp_richcompare */
+    0,                                              /* tp_weaklistoffset */
+    0,                                              /* tp_iter */
+    0,                                              /* tp_iternext */
+    ButBP_methods,                                 /* tp_methods */
+    ButBP_members,                                 /* tp_members */
+    0,                                              /* tp_getset */
+    0,                                              /* tp_base */
+    0,                                              /* tp_dict */
+    0,                                              /* tp_descr_get */
+    0,                                              /* tp_descr_set */
+    0,                                              /* tp_dictoffset */
+    0,                          /* tp_init */
+    0,                                              /* tp_alloc */
+    ButBP_new,                                     /* tp_new */
 };
 
 /************/
-/* ButBP */
+/* ButBR */
 /************/
 typedef struct {
     pyo_audio_HEAD
@@ -10044,26 +10996,27 @@ typedef struct {
     PyObject *q;
     Stream *q_stream;
     int modebuffer[4]; // need at least 2 slots for mul & add
-    MYFLT nyquist;
-    MYFLT last_freq;
-    MYFLT last_q;
-    MYFLT piOnSr;
+    MYSTATE nyquist;
+    MYSTATE last_freq;
+    MYSTATE last_q;
+    MYSTATE piOnSr;
     // sample memories
-    MYFLT x1;
-    MYFLT x2;
-    MYFLT y1;
-    MYFLT y2;
+    MYSTATE x1;
+    MYSTATE x2;
+    MYSTATE y1;
+    MYSTATE y2;
     // coefficients
-    MYFLT a0;
-    MYFLT a2;
-    MYFLT b1;
-    MYFLT b2;
-} ButBP;
+    MYSTATE a0;
+    MYSTATE a1;
+    MYSTATE a2;
+    MYSTATE b1;
+    MYSTATE b2;
+} ButBR;
 
 static void
-ButBP_compute_coeffs(ButBP *self, MYFLT freq, MYFLT q)
+ButBR_compute_coeffs(ButBR *self, MYFLT freq, MYFLT q)
 {
-    MYFLT bw, c, d;
+    MYSTATE bw, c, d;
 
     if (freq < 1.0)
         freq = 1.0;
@@ -10073,18 +11026,17 @@ ButBP_compute_coeffs(ButBP *self, MYFLT freq, MYFLT q)
         q = 1.0;
 
     bw = freq / q;
-    c = 1.0 / MYTAN(self->piOnSr * bw);
-    d = 2.0 * MYCOS(2.0 * self->piOnSr * freq);
+    c = STTAN(self->piOnSr * bw);
+    d = 2.0 * STCOS(2.0 * self->piOnSr * freq);
 
-    self->a0 = 1.0 / (1.0 + c);
-    self->a2 = -self->a0;
-    self->b1 = self->a2 * c * d;
-    self->b2 = self->a0 * (c - 1.0);
+    self->a0 = self->a2 = 1.0 / (1.0 + c);
+    self->a1 = self->b1 = -self->a0 * d;
+    self->b2 = self->a0 * (1.0 - c);
 }
 
 static void
-ButBP_filters_ii(ButBP *self) {
-    MYFLT val, fr, q;
+ButBR_filters_ii(ButBR *self) {
+    MYSTATE val, fr, q;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     fr = PyFloat_AS_DOUBLE(self->freq);
@@ -10093,11 +11045,11 @@ ButBP_filters_ii(ButBP *self) {
     if (fr != self->last_freq || q != self->last_q) {
         self->last_freq = fr;
         self->last_q = q;
-        ButBP_compute_coeffs(self, fr, q);
+        ButBR_compute_coeffs(self, fr, q);
     }
 
     for (i=0; i<self->bufsize; i++) {
-        val = self->a0 * in[i] + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
         self->x2 = self->x1;
         self->x1 = in[i];
         self->y2 = self->y1;
@@ -10106,8 +11058,8 @@ ButBP_filters_ii(ButBP *self) {
 }
 
 static void
-ButBP_filters_ai(ButBP *self) {
-    MYFLT val, fr, q;
+ButBR_filters_ai(ButBR *self) {
+    MYSTATE val, fr, q;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
@@ -10118,9 +11070,9 @@ ButBP_filters_ai(ButBP *self) {
         if (fr != self->last_freq || q != self->last_q) {
             self->last_freq = fr;
             self->last_q = q;
-            ButBP_compute_coeffs(self, fr, q);
+            ButBR_compute_coeffs(self, fr, q);
         }
-        val = self->a0 * in[i] + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
         self->x2 = self->x1;
         self->x1 = in[i];
         self->y2 = self->y1;
@@ -10129,8 +11081,8 @@ ButBP_filters_ai(ButBP *self) {
 }
 
 static void
-ButBP_filters_ia(ButBP *self) {
-    MYFLT val, fr, q;
+ButBR_filters_ia(ButBR *self) {
+    MYSTATE val, fr, q;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     fr = PyFloat_AS_DOUBLE(self->freq);
@@ -10141,9 +11093,9 @@ ButBP_filters_ia(ButBP *self) {
         if (fr != self->last_freq || q != self->last_q) {
             self->last_freq = fr;
             self->last_q = q;
-            ButBP_compute_coeffs(self, fr, q);
+            ButBR_compute_coeffs(self, fr, q);
         }
-        val = self->a0 * in[i] + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
         self->x2 = self->x1;
         self->x1 = in[i];
         self->y2 = self->y1;
@@ -10152,8 +11104,8 @@ ButBP_filters_ia(ButBP *self) {
 }
 
 static void
-ButBP_filters_aa(ButBP *self) {
-    MYFLT val, fr, q;
+ButBR_filters_aa(ButBR *self) {
+    MYSTATE val, fr, q;
     int i;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
     MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
@@ -10165,9 +11117,9 @@ ButBP_filters_aa(ButBP *self) {
         if (fr != self->last_freq || q != self->last_q) {
             self->last_freq = fr;
             self->last_q = q;
-            ButBP_compute_coeffs(self, fr, q);
+            ButBR_compute_coeffs(self, fr, q);
         }
-        val = self->a0 * in[i] + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
+        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
         self->x2 = self->x1;
         self->x1 = in[i];
         self->y2 = self->y1;
@@ -10175,18 +11127,18 @@ ButBP_filters_aa(ButBP *self) {
     }
 }
 
-static void ButBP_postprocessing_ii(ButBP *self) { POST_PROCESSING_II };
-static void ButBP_postprocessing_ai(ButBP *self) { POST_PROCESSING_AI };
-static void ButBP_postprocessing_ia(ButBP *self) { POST_PROCESSING_IA };
-static void ButBP_postprocessing_aa(ButBP *self) { POST_PROCESSING_AA };
-static void ButBP_postprocessing_ireva(ButBP *self) { POST_PROCESSING_IREVA };
-static void ButBP_postprocessing_areva(ButBP *self) { POST_PROCESSING_AREVA };
-static void ButBP_postprocessing_revai(ButBP *self) { POST_PROCESSING_REVAI };
-static void ButBP_postprocessing_revaa(ButBP *self) { POST_PROCESSING_REVAA };
-static void ButBP_postprocessing_revareva(ButBP *self) { POST_PROCESSING_REVAREVA };
+static void ButBR_postprocessing_ii(ButBR *self) { POST_PROCESSING_II };
+static void ButBR_postprocessing_ai(ButBR *self) { POST_PROCESSING_AI };
+static void ButBR_postprocessing_ia(ButBR *self) { POST_PROCESSING_IA };
+static void ButBR_postprocessing_aa(ButBR *self) { POST_PROCESSING_AA };
+static void ButBR_postprocessing_ireva(ButBR *self) { POST_PROCESSING_IREVA };
+static void ButBR_postprocessing_areva(ButBR *self) { POST_PROCESSING_AREVA };
+static void ButBR_postprocessing_revai(ButBR *self) { POST_PROCESSING_REVAI };
+static void ButBR_postprocessing_revaa(ButBR *self) { POST_PROCESSING_REVAA };
+static void ButBR_postprocessing_revareva(ButBR *self) { POST_PROCESSING_REVAREVA };
 
 static void
-ButBP_setProcMode(ButBP *self)
+ButBR_setProcMode(ButBR *self)
 {
     int procmode, muladdmode;
     procmode = self->modebuffer[2] + self->modebuffer[3] * 10;
@@ -10194,58 +11146,58 @@ ButBP_setProcMode(ButBP *self)
 
 	switch (procmode) {
         case 0:
-            self->proc_func_ptr = ButBP_filters_ii;
+            self->proc_func_ptr = ButBR_filters_ii;
             break;
         case 1:
-            self->proc_func_ptr = ButBP_filters_ai;
+            self->proc_func_ptr = ButBR_filters_ai;
             break;
         case 10:
-            self->proc_func_ptr = ButBP_filters_ia;
+            self->proc_func_ptr = ButBR_filters_ia;
             break;
         case 11:
-            self->proc_func_ptr = ButBP_filters_aa;
+            self->proc_func_ptr = ButBR_filters_aa;
             break;
     }
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = ButBP_postprocessing_ii;
+            self->muladd_func_ptr = ButBR_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = ButBP_postprocessing_ai;
+            self->muladd_func_ptr = ButBR_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = ButBP_postprocessing_revai;
+            self->muladd_func_ptr = ButBR_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = ButBP_postprocessing_ia;
+            self->muladd_func_ptr = ButBR_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = ButBP_postprocessing_aa;
+            self->muladd_func_ptr = ButBR_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = ButBP_postprocessing_revaa;
+            self->muladd_func_ptr = ButBR_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = ButBP_postprocessing_ireva;
+            self->muladd_func_ptr = ButBR_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = ButBP_postprocessing_areva;
+            self->muladd_func_ptr = ButBR_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = ButBP_postprocessing_revareva;
+            self->muladd_func_ptr = ButBR_postprocessing_revareva;
             break;
     }
 }
 
 static void
-ButBP_compute_next_data_frame(ButBP *self)
+ButBR_compute_next_data_frame(ButBR *self)
 {
     (*self->proc_func_ptr)(self);
     (*self->muladd_func_ptr)(self);
 }
 
 static int
-ButBP_traverse(ButBP *self, visitproc visit, void *arg)
+ButBR_traverse(ButBR *self, visitproc visit, void *arg)
 {
     pyo_VISIT
     Py_VISIT(self->input);
@@ -10258,7 +11210,7 @@ ButBP_traverse(ButBP *self, visitproc visit, void *arg)
 }
 
 static int
-ButBP_clear(ButBP *self)
+ButBR_clear(ButBR *self)
 {
     pyo_CLEAR
     Py_CLEAR(self->input);
@@ -10271,26 +11223,26 @@ ButBP_clear(ButBP *self)
 }
 
 static void
-ButBP_dealloc(ButBP* self)
+ButBR_dealloc(ButBR* self)
 {
     pyo_DEALLOC
-    ButBP_clear(self);
+    ButBR_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
 static PyObject *
-ButBP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+ButBR_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
     PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *qtmp=NULL, *multmp=NULL, *addtmp=NULL;
-    ButBP *self;
-    self = (ButBP *)type->tp_alloc(type, 0);
+    ButBR *self;
+    self = (ButBR *)type->tp_alloc(type, 0);
 
     self->freq = PyFloat_FromDouble(1000);
     self->q = PyFloat_FromDouble(1);
     self->last_freq = self->last_q = -1.0;
     self->x1 = self->x2 = self->y1 = self->y2 = 0.0;
-    self->a0 = self->a2 = self->b1 = self->b2 = 0.0;
+    self->a0 = self->a1 = self->a2 = self->b1 = self->b2 = 0.0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
 	self->modebuffer[2] = 0;
@@ -10301,8 +11253,8 @@ ButBP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->nyquist = (MYFLT)self->sr * 0.49;
     self->piOnSr = PI / (MYFLT)self->sr;
 
-    Stream_setFunctionPtr(self->stream, ButBP_compute_next_data_frame);
-    self->mode_func_ptr = ButBP_setProcMode;
+    Stream_setFunctionPtr(self->stream, ButBR_compute_next_data_frame);
+    self->mode_func_ptr = ButBR_setProcMode;
 
     static char *kwlist[] = {"input", "freq", "q", "mul", "add", NULL};
 
@@ -10334,28 +11286,28 @@ ButBP_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     return (PyObject *)self;
 }
 
-static PyObject * ButBP_getServer(ButBP* self) { GET_SERVER };
-static PyObject * ButBP_getStream(ButBP* self) { GET_STREAM };
-static PyObject * ButBP_setMul(ButBP *self, PyObject *arg) { SET_MUL };
-static PyObject * ButBP_setAdd(ButBP *self, PyObject *arg) { SET_ADD };
-static PyObject * ButBP_setSub(ButBP *self, PyObject *arg) { SET_SUB };
-static PyObject * ButBP_setDiv(ButBP *self, PyObject *arg) { SET_DIV };
+static PyObject * ButBR_getServer(ButBR* self) { GET_SERVER };
+static PyObject * ButBR_getStream(ButBR* self) { GET_STREAM };
+static PyObject * ButBR_setMul(ButBR *self, PyObject *arg) { SET_MUL };
+static PyObject * ButBR_setAdd(ButBR *self, PyObject *arg) { SET_ADD };
+static PyObject * ButBR_setSub(ButBR *self, PyObject *arg) { SET_SUB };
+static PyObject * ButBR_setDiv(ButBR *self, PyObject *arg) { SET_DIV };
 
-static PyObject * ButBP_play(ButBP *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * ButBP_out(ButBP *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * ButBP_stop(ButBP *self) { STOP };
+static PyObject * ButBR_play(ButBR *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * ButBR_out(ButBR *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * ButBR_stop(ButBR *self) { STOP };
 
-static PyObject * ButBP_multiply(ButBP *self, PyObject *arg) { MULTIPLY };
-static PyObject * ButBP_inplace_multiply(ButBP *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * ButBP_add(ButBP *self, PyObject *arg) { ADD };
-static PyObject * ButBP_inplace_add(ButBP *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * ButBP_sub(ButBP *self, PyObject *arg) { SUB };
-static PyObject * ButBP_inplace_sub(ButBP *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * ButBP_div(ButBP *self, PyObject *arg) { DIV };
-static PyObject * ButBP_inplace_div(ButBP *self, PyObject *arg) { INPLACE_DIV };
+static PyObject * ButBR_multiply(ButBR *self, PyObject *arg) { MULTIPLY };
+static PyObject * ButBR_inplace_multiply(ButBR *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * ButBR_add(ButBR *self, PyObject *arg) { ADD };
+static PyObject * ButBR_inplace_add(ButBR *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * ButBR_sub(ButBR *self, PyObject *arg) { SUB };
+static PyObject * ButBR_inplace_sub(ButBR *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * ButBR_div(ButBR *self, PyObject *arg) { DIV };
+static PyObject * ButBR_inplace_div(ButBR *self, PyObject *arg) { INPLACE_DIV };
 
 static PyObject *
-ButBP_setFreq(ButBP *self, PyObject *arg)
+ButBR_setFreq(ButBR *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -10389,7 +11341,7 @@ ButBP_setFreq(ButBP *self, PyObject *arg)
 }
 
 static PyObject *
-ButBP_setQ(ButBP *self, PyObject *arg)
+ButBR_setQ(ButBR *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -10422,37 +11374,37 @@ ButBP_setQ(ButBP *self, PyObject *arg)
 	return Py_None;
 }
 
-static PyMemberDef ButBP_members[] = {
-    {"server", T_OBJECT_EX, offsetof(ButBP, server), 0, "Pyo server."},
-    {"stream", T_OBJECT_EX, offsetof(ButBP, stream), 0, "Stream object."},
-    {"input", T_OBJECT_EX, offsetof(ButBP, input), 0, "Input sound object."},
-    {"freq", T_OBJECT_EX, offsetof(ButBP, freq), 0, "Cutoff frequency in cycle per second."},
-    {"q", T_OBJECT_EX, offsetof(ButBP, q), 0, "Q factor."},
-    {"mul", T_OBJECT_EX, offsetof(ButBP, mul), 0, "Mul factor."},
-    {"add", T_OBJECT_EX, offsetof(ButBP, add), 0, "Add factor."},
+static PyMemberDef ButBR_members[] = {
+    {"server", T_OBJECT_EX, offsetof(ButBR, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(ButBR, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(ButBR, input), 0, "Input sound object."},
+    {"freq", T_OBJECT_EX, offsetof(ButBR, freq), 0, "Cutoff frequency in cycle per second."},
+    {"q", T_OBJECT_EX, offsetof(ButBR, q), 0, "Q factor."},
+    {"mul", T_OBJECT_EX, offsetof(ButBR, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(ButBR, add), 0, "Add factor."},
     {NULL}  /* Sentinel */
 };
 
-static PyMethodDef ButBP_methods[] = {
-    {"getServer", (PyCFunction)ButBP_getServer, METH_NOARGS, "Returns server object."},
-    {"_getStream", (PyCFunction)ButBP_getStream, METH_NOARGS, "Returns stream object."},
-    {"play", (PyCFunction)ButBP_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-    {"out", (PyCFunction)ButBP_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-    {"stop", (PyCFunction)ButBP_stop, METH_NOARGS, "Stops computing."},
-	{"setFreq", (PyCFunction)ButBP_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
-    {"setQ", (PyCFunction)ButBP_setQ, METH_O, "Sets filter Q factor."},
-	{"setMul", (PyCFunction)ButBP_setMul, METH_O, "Sets oscillator mul factor."},
-	{"setAdd", (PyCFunction)ButBP_setAdd, METH_O, "Sets oscillator add factor."},
-    {"setSub", (PyCFunction)ButBP_setSub, METH_O, "Sets inverse add factor."},
-    {"setDiv", (PyCFunction)ButBP_setDiv, METH_O, "Sets inverse mul factor."},
+static PyMethodDef ButBR_methods[] = {
+    {"getServer", (PyCFunction)ButBR_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)ButBR_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)ButBR_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)ButBR_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)ButBR_stop, METH_NOARGS, "Stops computing."},
+	{"setFreq", (PyCFunction)ButBR_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
+    {"setQ", (PyCFunction)ButBR_setQ, METH_O, "Sets filter Q factor."},
+	{"setMul", (PyCFunction)ButBR_setMul, METH_O, "Sets oscillator mul factor."},
+	{"setAdd", (PyCFunction)ButBR_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)ButBR_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)ButBR_setDiv, METH_O, "Sets inverse mul factor."},
     {NULL}  /* Sentinel */
 };
 
-static PyNumberMethods ButBP_as_number = {
-    (binaryfunc)ButBP_add,                         /*nb_add*/
-    (binaryfunc)ButBP_sub,                         /*nb_subtract*/
-    (binaryfunc)ButBP_multiply,                    /*nb_multiply*/
-    (binaryfunc)ButBP_div,                                              /*nb_divide*/
+static PyNumberMethods ButBR_as_number = {
+    (binaryfunc)ButBR_add,                         /*nb_add*/
+    (binaryfunc)ButBR_sub,                         /*nb_subtract*/
+    (binaryfunc)ButBR_multiply,                    /*nb_multiply*/
+    (binaryfunc)ButBR_div,                                              /*nb_divide*/
     0,                                              /*nb_remainder*/
     0,                                              /*nb_divmod*/
     0,                                              /*nb_power*/
@@ -10472,10 +11424,10 @@ static PyNumberMethods ButBP_as_number = {
     0,                                              /*nb_float*/
     0,                                              /*nb_oct*/
     0,                                              /*nb_hex*/
-    (binaryfunc)ButBP_inplace_add,                 /*inplace_add*/
-    (binaryfunc)ButBP_inplace_sub,                 /*inplace_subtract*/
-    (binaryfunc)ButBP_inplace_multiply,            /*inplace_multiply*/
-    (binaryfunc)ButBP_inplace_div,                                              /*inplace_divide*/
+    (binaryfunc)ButBR_inplace_add,                 /*inplace_add*/
+    (binaryfunc)ButBR_inplace_sub,                 /*inplace_subtract*/
+    (binaryfunc)ButBR_inplace_multiply,            /*inplace_multiply*/
+    (binaryfunc)ButBR_inplace_div,                                              /*inplace_divide*/
     0,                                              /*inplace_remainder*/
     0,                                              /*inplace_power*/
     0,                                              /*inplace_lshift*/
@@ -10490,19 +11442,19 @@ static PyNumberMethods ButBP_as_number = {
     0,                                              /* nb_index */
 };
 
-PyTypeObject ButBPType = {
+PyTypeObject ButBRType = {
     PyObject_HEAD_INIT(NULL)
     0,                                              /*ob_size*/
-    "_pyo.ButBP_base",                                   /*tp_name*/
-    sizeof(ButBP),                                 /*tp_basicsize*/
+    "_pyo.ButBR_base",                                   /*tp_name*/
+    sizeof(ButBR),                                 /*tp_basicsize*/
     0,                                              /*tp_itemsize*/
-    (destructor)ButBP_dealloc,                     /*tp_dealloc*/
+    (destructor)ButBR_dealloc,                     /*tp_dealloc*/
     0,                                              /*tp_print*/
     0,                                              /*tp_getattr*/
     0,                                              /*tp_setattr*/
     0,                                              /*tp_compare*/
     0,                                              /*tp_repr*/
-    &ButBP_as_number,                              /*tp_as_number*/
+    &ButBR_as_number,                              /*tp_as_number*/
     0,                                              /*tp_as_sequence*/
     0,                                              /*tp_as_mapping*/
     0,                                              /*tp_hash */
@@ -10512,15 +11464,15 @@ PyTypeObject ButBPType = {
     0,                                              /*tp_setattro*/
     0,                                              /*tp_as_buffer*/
     Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-    "ButBP objects. Second-order Butterworth bandpass filter.",           /* tp_doc */
-    (traverseproc)ButBP_traverse,                  /* tp_traverse */
-    (inquiry)ButBP_clear,                          /* tp_clear */
+    "ButBR objects. Second-order Butterworth band-reject filter.",           /* tp_doc */
+    (traverseproc)ButBR_traverse,                  /* tp_traverse */
+    (inquiry)ButBR_clear,                          /* tp_clear */
     0,                                              /* tp_richcompare */
     0,                                              /* tp_weaklistoffset */
     0,                                              /* tp_iter */
     0,                                              /* tp_iternext */
-    ButBP_methods,                                 /* tp_methods */
-    ButBP_members,                                 /* tp_members */
+    ButBR_methods,                                 /* tp_methods */
+    ButBR_members,                                 /* tp_members */
     0,                                              /* tp_getset */
     0,                                              /* tp_base */
     0,                                              /* tp_dict */
@@ -10529,164 +11481,170 @@ PyTypeObject ButBPType = {
     0,                                              /* tp_dictoffset */
     0,                          /* tp_init */
     0,                                              /* tp_alloc */
-    ButBP_new,                                     /* tp_new */
+    ButBR_new,                                     /* tp_new */
 };
 
-/************/
-/* ButBR */
-/************/
+/****************/
+/** ComplexRes **/
+/****************/
 typedef struct {
     pyo_audio_HEAD
     PyObject *input;
     Stream *input_stream;
     PyObject *freq;
     Stream *freq_stream;
-    PyObject *q;
-    Stream *q_stream;
+    PyObject *decay;
+    Stream *decay_stream;
     int modebuffer[4]; // need at least 2 slots for mul & add
-    MYFLT nyquist;
     MYFLT last_freq;
-    MYFLT last_q;
-    MYFLT piOnSr;
+    MYFLT last_decay;
+    MYFLT oneOnSr;
+    // variables
+    MYFLT res;
+    MYFLT norm;
+    MYFLT coeffx;
+    MYFLT coeffy;
     // sample memories
-    MYFLT x1;
-    MYFLT x2;
-    MYFLT y1;
-    MYFLT y2;
-    // coefficients
-    MYFLT a0;
-    MYFLT a1;
-    MYFLT a2;
-    MYFLT b1;
-    MYFLT b2;
-} ButBR;
-
-static void
-ButBR_compute_coeffs(ButBR *self, MYFLT freq, MYFLT q)
-{
-    MYFLT bw, c, d;
-
-    if (freq < 1.0)
-        freq = 1.0;
-    else if (freq > self->nyquist)
-        freq = self->nyquist;
-    if (q < 1.0)
-        q = 1.0;
-
-    bw = freq / q;
-    c = MYTAN(self->piOnSr * bw);
-    d = 2.0 * MYCOS(2.0 * self->piOnSr * freq);
-
-    self->a0 = self->a2 = 1.0 / (1.0 + c);
-    self->a1 = self->b1 = -self->a0 * d;
-    self->b2 = self->a0 * (1.0 - c);
-}
+    MYFLT x;
+    MYFLT y;
+} ComplexRes;
 
 static void
-ButBR_filters_ii(ButBR *self) {
-    MYFLT val, fr, q;
+ComplexRes_filters_ii(ComplexRes *self) {
     int i;
+    MYFLT ang, x, y;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    fr = PyFloat_AS_DOUBLE(self->freq);
-    q = PyFloat_AS_DOUBLE(self->q);
+    MYFLT freq = PyFloat_AS_DOUBLE(self->freq);
+    MYFLT decay = PyFloat_AS_DOUBLE(self->decay);
 
-    if (fr != self->last_freq || q != self->last_q) {
-        self->last_freq = fr;
-        self->last_q = q;
-        ButBR_compute_coeffs(self, fr, q);
+    if (decay <= 0.0001)
+        decay = 0.0001;
+
+    if (decay != self->last_decay || freq != self->last_freq) {
+        self->res = MYEXP(-1.0/(decay*self->sr));
+        //self->norm = (1.0-self->res*self->res)/self->res;
+        self->last_decay = decay;
+        ang = (freq*self->oneOnSr)*TWOPI;
+        self->coeffx = self->res * MYCOS(ang);
+        self->coeffy = self->res * MYSIN(ang);
+        self->last_freq = freq;
     }
 
     for (i=0; i<self->bufsize; i++) {
-        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
-        self->x2 = self->x1;
-        self->x1 = in[i];
-        self->y2 = self->y1;
-        self->data[i] = self->y1 = val;
+        x = self->coeffx * self->x - self->coeffy * self->y + in[i];
+        y = self->coeffy * self->x + self->coeffx * self->y;
+        self->data[i] = y * self->norm;
+        self->x = x;
+        self->y = y;
     }
 }
 
 static void
-ButBR_filters_ai(ButBR *self) {
-    MYFLT val, fr, q;
-    int i;
+ComplexRes_filters_ai(ComplexRes *self) {
+    int i, check = 0;
+    MYFLT freq, ang, x, y;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
-    q = PyFloat_AS_DOUBLE(self->q);
+    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
+    MYFLT decay = PyFloat_AS_DOUBLE(self->decay);
+
+    if (decay <= 0.0001)
+        decay = 0.0001;
+
+    if (decay != self->last_decay) {
+        self->res = MYEXP(-1.0/(decay*self->sr));
+        //self->norm = (1.0-self->res*self->res)/self->res;
+        self->last_decay = decay;
+        check = 1;
+    }
 
     for (i=0; i<self->bufsize; i++) {
-        fr = freq[i];
-        if (fr != self->last_freq || q != self->last_q) {
-            self->last_freq = fr;
-            self->last_q = q;
-            ButBR_compute_coeffs(self, fr, q);
+        freq = fr[i];
+        if (freq != self->last_freq || check) {
+            ang = (freq*self->oneOnSr)*TWOPI;
+            self->coeffx = self->res * MYCOS(ang);
+            self->coeffy = self->res * MYSIN(ang);
+            self->last_freq = freq;
+            check = 0;
         }
-        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
-        self->x2 = self->x1;
-        self->x1 = in[i];
-        self->y2 = self->y1;
-        self->data[i] = self->y1 = val;
+        x = self->coeffx * self->x - self->coeffy * self->y + in[i];
+        y = self->coeffy * self->x + self->coeffx * self->y;
+        self->data[i] = y * self->norm;
+        self->x = x;
+        self->y = y;
     }
 }
 
 static void
-ButBR_filters_ia(ButBR *self) {
-    MYFLT val, fr, q;
+ComplexRes_filters_ia(ComplexRes *self) {
     int i;
+    MYFLT decay, ang, x, y;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    fr = PyFloat_AS_DOUBLE(self->freq);
-    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
+    MYFLT freq = PyFloat_AS_DOUBLE(self->freq);
+    MYFLT *dec = Stream_getData((Stream *)self->decay_stream);
 
     for (i=0; i<self->bufsize; i++) {
-        q = qst[i];
-        if (fr != self->last_freq || q != self->last_q) {
-            self->last_freq = fr;
-            self->last_q = q;
-            ButBR_compute_coeffs(self, fr, q);
+        decay = dec[i];
+        if (decay <= 0.0001)
+            decay = 0.0001;
+        if (freq != self->last_freq || decay != self->last_decay) {
+            self->res = MYEXP(-1.0/(decay*self->sr));
+            //self->norm = (1.0-self->res*self->res)/self->res;
+            self->last_decay = decay;
+            ang = (freq*self->oneOnSr)*TWOPI;
+            self->coeffx = self->res * MYCOS(ang);
+            self->coeffy = self->res * MYSIN(ang);
+            self->last_freq = freq;
         }
-        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
-        self->x2 = self->x1;
-        self->x1 = in[i];
-        self->y2 = self->y1;
-        self->data[i] = self->y1 = val;
+        x = self->coeffx * self->x - self->coeffy * self->y + in[i];
+        y = self->coeffy * self->x + self->coeffx * self->y;
+        self->data[i] = y * self->norm;
+        self->x = x;
+        self->y = y;
     }
 }
 
 static void
-ButBR_filters_aa(ButBR *self) {
-    MYFLT val, fr, q;
+ComplexRes_filters_aa(ComplexRes *self) {
     int i;
+    MYFLT freq, decay, ang, x, y;
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *freq = Stream_getData((Stream *)self->freq_stream);
-    MYFLT *qst = Stream_getData((Stream *)self->q_stream);
+    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
+    MYFLT *dec = Stream_getData((Stream *)self->decay_stream);
 
     for (i=0; i<self->bufsize; i++) {
-        fr = freq[i];
-        q = qst[i];
-        if (fr != self->last_freq || q != self->last_q) {
-            self->last_freq = fr;
-            self->last_q = q;
-            ButBR_compute_coeffs(self, fr, q);
+        freq = fr[i];
+        decay = dec[i];
+        if (decay <= 0.0001)
+            decay = 0.0001;
+        if (freq != self->last_freq || decay != self->last_decay) {
+            self->res = MYEXP(-1.0/(decay*self->sr));
+            //self->norm = (1.0-self->res*self->res)/self->res;
+            self->last_decay = decay;
+            ang = (freq*self->oneOnSr)*TWOPI;
+            self->coeffx = self->res * MYCOS(ang);
+            self->coeffy = self->res * MYSIN(ang);
+            self->last_freq = freq;
         }
-        val = self->a0 * in[i] + self->a1 * self->x1 + self->a2 * self->x2 - self->b1 * self->y1 - self->b2 * self->y2;
-        self->x2 = self->x1;
-        self->x1 = in[i];
-        self->y2 = self->y1;
-        self->data[i] = self->y1 = val;
+        x = self->coeffx * self->x - self->coeffy * self->y + in[i];
+        y = self->coeffy * self->x + self->coeffx * self->y;
+        self->data[i] = y * self->norm;
+        self->x = x;
+        self->y = y;
     }
 }
 
-static void ButBR_postprocessing_ii(ButBR *self) { POST_PROCESSING_II };
-static void ButBR_postprocessing_ai(ButBR *self) { POST_PROCESSING_AI };
-static void ButBR_postprocessing_ia(ButBR *self) { POST_PROCESSING_IA };
-static void ButBR_postprocessing_aa(ButBR *self) { POST_PROCESSING_AA };
-static void ButBR_postprocessing_ireva(ButBR *self) { POST_PROCESSING_IREVA };
-static void ButBR_postprocessing_areva(ButBR *self) { POST_PROCESSING_AREVA };
-static void ButBR_postprocessing_revai(ButBR *self) { POST_PROCESSING_REVAI };
-static void ButBR_postprocessing_revaa(ButBR *self) { POST_PROCESSING_REVAA };
-static void ButBR_postprocessing_revareva(ButBR *self) { POST_PROCESSING_REVAREVA };
+static void ComplexRes_postprocessing_ii(ComplexRes *self) { POST_PROCESSING_II };
+static void ComplexRes_postprocessing_ai(ComplexRes *self) { POST_PROCESSING_AI };
+static void ComplexRes_postprocessing_ia(ComplexRes *self) { POST_PROCESSING_IA };
+static void ComplexRes_postprocessing_aa(ComplexRes *self) { POST_PROCESSING_AA };
+static void ComplexRes_postprocessing_ireva(ComplexRes *self) { POST_PROCESSING_IREVA };
+static void ComplexRes_postprocessing_areva(ComplexRes *self) { POST_PROCESSING_AREVA };
+static void ComplexRes_postprocessing_revai(ComplexRes *self) { POST_PROCESSING_REVAI };
+static void ComplexRes_postprocessing_revaa(ComplexRes *self) { POST_PROCESSING_REVAA };
+static void ComplexRes_postprocessing_revareva(ComplexRes *self) { POST_PROCESSING_REVAREVA };
 
 static void
-ButBR_setProcMode(ButBR *self)
+ComplexRes_setProcMode(ComplexRes *self)
 {
     int procmode, muladdmode;
     procmode = self->modebuffer[2] + self->modebuffer[3] * 10;
@@ -10694,103 +11652,105 @@ ButBR_setProcMode(ButBR *self)
 
 	switch (procmode) {
         case 0:
-            self->proc_func_ptr = ButBR_filters_ii;
+            self->proc_func_ptr = ComplexRes_filters_ii;
             break;
         case 1:
-            self->proc_func_ptr = ButBR_filters_ai;
+            self->proc_func_ptr = ComplexRes_filters_ai;
             break;
         case 10:
-            self->proc_func_ptr = ButBR_filters_ia;
+            self->proc_func_ptr = ComplexRes_filters_ia;
             break;
         case 11:
-            self->proc_func_ptr = ButBR_filters_aa;
+            self->proc_func_ptr = ComplexRes_filters_aa;
             break;
     }
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = ButBR_postprocessing_ii;
+            self->muladd_func_ptr = ComplexRes_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = ButBR_postprocessing_ai;
+            self->muladd_func_ptr = ComplexRes_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = ButBR_postprocessing_revai;
+            self->muladd_func_ptr = ComplexRes_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = ButBR_postprocessing_ia;
+            self->muladd_func_ptr = ComplexRes_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = ButBR_postprocessing_aa;
+            self->muladd_func_ptr = ComplexRes_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = ButBR_postprocessing_revaa;
+            self->muladd_func_ptr = ComplexRes_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = ButBR_postprocessing_ireva;
+            self->muladd_func_ptr = ComplexRes_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = ButBR_postprocessing_areva;
+            self->muladd_func_ptr = ComplexRes_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = ButBR_postprocessing_revareva;
+            self->muladd_func_ptr = ComplexRes_postprocessing_revareva;
             break;
     }
 }
 
 static void
-ButBR_compute_next_data_frame(ButBR *self)
+ComplexRes_compute_next_data_frame(ComplexRes *self)
 {
     (*self->proc_func_ptr)(self);
     (*self->muladd_func_ptr)(self);
 }
 
 static int
-ButBR_traverse(ButBR *self, visitproc visit, void *arg)
+ComplexRes_traverse(ComplexRes *self, visitproc visit, void *arg)
 {
     pyo_VISIT
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
     Py_VISIT(self->freq);
     Py_VISIT(self->freq_stream);
-    Py_VISIT(self->q);
-    Py_VISIT(self->q_stream);
+    Py_VISIT(self->decay);
+    Py_VISIT(self->decay_stream);
     return 0;
 }
 
 static int
-ButBR_clear(ButBR *self)
+ComplexRes_clear(ComplexRes *self)
 {
     pyo_CLEAR
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
     Py_CLEAR(self->freq);
     Py_CLEAR(self->freq_stream);
-    Py_CLEAR(self->q);
-    Py_CLEAR(self->q_stream);
+    Py_CLEAR(self->decay);
+    Py_CLEAR(self->decay_stream);
     return 0;
 }
 
 static void
-ButBR_dealloc(ButBR* self)
+ComplexRes_dealloc(ComplexRes* self)
 {
     pyo_DEALLOC
-    ButBR_clear(self);
+    ComplexRes_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
 static PyObject *
-ButBR_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+ComplexRes_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
-    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *qtmp=NULL, *multmp=NULL, *addtmp=NULL;
-    ButBR *self;
-    self = (ButBR *)type->tp_alloc(type, 0);
+    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *decaytmp=NULL, *multmp=NULL, *addtmp=NULL;
+    ComplexRes *self;
+    self = (ComplexRes *)type->tp_alloc(type, 0);
 
     self->freq = PyFloat_FromDouble(1000);
-    self->q = PyFloat_FromDouble(1);
-    self->last_freq = self->last_q = -1.0;
-    self->x1 = self->x2 = self->y1 = self->y2 = 0.0;
-    self->a0 = self->a1 = self->a2 = self->b1 = self->b2 = 0.0;
+    self->decay = PyFloat_FromDouble(.25);
+    self->last_freq = self->last_decay = -1.0;
+    self->x = self->y = 0.0;
+    self->res = 1.0;
+    self->norm = 0.01; /* normalization factor fixed at -40 dB */
+    self->coeffx = self->coeffy = 0.0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
 	self->modebuffer[2] = 0;
@@ -10798,15 +11758,14 @@ ButBR_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
 
-    self->nyquist = (MYFLT)self->sr * 0.49;
-    self->piOnSr = PI / (MYFLT)self->sr;
+    self->oneOnSr = 1.0 / self->sr;
 
-    Stream_setFunctionPtr(self->stream, ButBR_compute_next_data_frame);
-    self->mode_func_ptr = ButBR_setProcMode;
+    Stream_setFunctionPtr(self->stream, ComplexRes_compute_next_data_frame);
+    self->mode_func_ptr = ComplexRes_setProcMode;
 
-    static char *kwlist[] = {"input", "freq", "q", "mul", "add", NULL};
+    static char *kwlist[] = {"input", "freq", "decay", "mul", "add", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOO", kwlist, &inputtmp, &freqtmp, &qtmp, &multmp, &addtmp))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOO", kwlist, &inputtmp, &freqtmp, &decaytmp, &multmp, &addtmp))
         Py_RETURN_NONE;
 
     INIT_INPUT_STREAM
@@ -10815,8 +11774,8 @@ ButBR_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
     }
 
-    if (qtmp) {
-        PyObject_CallMethod((PyObject *)self, "setQ", "O", qtmp);
+    if (decaytmp) {
+        PyObject_CallMethod((PyObject *)self, "setDecay", "O", decaytmp);
     }
 
     if (multmp) {
@@ -10834,28 +11793,28 @@ ButBR_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     return (PyObject *)self;
 }
 
-static PyObject * ButBR_getServer(ButBR* self) { GET_SERVER };
-static PyObject * ButBR_getStream(ButBR* self) { GET_STREAM };
-static PyObject * ButBR_setMul(ButBR *self, PyObject *arg) { SET_MUL };
-static PyObject * ButBR_setAdd(ButBR *self, PyObject *arg) { SET_ADD };
-static PyObject * ButBR_setSub(ButBR *self, PyObject *arg) { SET_SUB };
-static PyObject * ButBR_setDiv(ButBR *self, PyObject *arg) { SET_DIV };
+static PyObject * ComplexRes_getServer(ComplexRes* self) { GET_SERVER };
+static PyObject * ComplexRes_getStream(ComplexRes* self) { GET_STREAM };
+static PyObject * ComplexRes_setMul(ComplexRes *self, PyObject *arg) { SET_MUL };
+static PyObject * ComplexRes_setAdd(ComplexRes *self, PyObject *arg) { SET_ADD };
+static PyObject * ComplexRes_setSub(ComplexRes *self, PyObject *arg) { SET_SUB };
+static PyObject * ComplexRes_setDiv(ComplexRes *self, PyObject *arg) { SET_DIV };
 
-static PyObject * ButBR_play(ButBR *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * ButBR_out(ButBR *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * ButBR_stop(ButBR *self) { STOP };
+static PyObject * ComplexRes_play(ComplexRes *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * ComplexRes_out(ComplexRes *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * ComplexRes_stop(ComplexRes *self) { STOP };
 
-static PyObject * ButBR_multiply(ButBR *self, PyObject *arg) { MULTIPLY };
-static PyObject * ButBR_inplace_multiply(ButBR *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * ButBR_add(ButBR *self, PyObject *arg) { ADD };
-static PyObject * ButBR_inplace_add(ButBR *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * ButBR_sub(ButBR *self, PyObject *arg) { SUB };
-static PyObject * ButBR_inplace_sub(ButBR *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * ButBR_div(ButBR *self, PyObject *arg) { DIV };
-static PyObject * ButBR_inplace_div(ButBR *self, PyObject *arg) { INPLACE_DIV };
+static PyObject * ComplexRes_multiply(ComplexRes *self, PyObject *arg) { MULTIPLY };
+static PyObject * ComplexRes_inplace_multiply(ComplexRes *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * ComplexRes_add(ComplexRes *self, PyObject *arg) { ADD };
+static PyObject * ComplexRes_inplace_add(ComplexRes *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * ComplexRes_sub(ComplexRes *self, PyObject *arg) { SUB };
+static PyObject * ComplexRes_inplace_sub(ComplexRes *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * ComplexRes_div(ComplexRes *self, PyObject *arg) { DIV };
+static PyObject * ComplexRes_inplace_div(ComplexRes *self, PyObject *arg) { INPLACE_DIV };
 
 static PyObject *
-ButBR_setFreq(ButBR *self, PyObject *arg)
+ComplexRes_setFreq(ComplexRes *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -10889,7 +11848,7 @@ ButBR_setFreq(ButBR *self, PyObject *arg)
 }
 
 static PyObject *
-ButBR_setQ(ButBR *self, PyObject *arg)
+ComplexRes_setDecay(ComplexRes *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -10902,17 +11861,17 @@ ButBR_setQ(ButBR *self, PyObject *arg)
 
 	tmp = arg;
 	Py_INCREF(tmp);
-	Py_DECREF(self->q);
+	Py_DECREF(self->decay);
 	if (isNumber == 1) {
-		self->q = PyNumber_Float(tmp);
+		self->decay = PyNumber_Float(tmp);
         self->modebuffer[3] = 0;
 	}
 	else {
-		self->q = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->q, "_getStream", NULL);
+		self->decay = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->decay, "_getStream", NULL);
         Py_INCREF(streamtmp);
-        Py_XDECREF(self->q_stream);
-        self->q_stream = (Stream *)streamtmp;
+        Py_XDECREF(self->decay_stream);
+        self->decay_stream = (Stream *)streamtmp;
 		self->modebuffer[3] = 1;
 	}
 
@@ -10922,383 +11881,542 @@ ButBR_setQ(ButBR *self, PyObject *arg)
 	return Py_None;
 }
 
-static PyMemberDef ButBR_members[] = {
-    {"server", T_OBJECT_EX, offsetof(ButBR, server), 0, "Pyo server."},
-    {"stream", T_OBJECT_EX, offsetof(ButBR, stream), 0, "Stream object."},
-    {"input", T_OBJECT_EX, offsetof(ButBR, input), 0, "Input sound object."},
-    {"freq", T_OBJECT_EX, offsetof(ButBR, freq), 0, "Cutoff frequency in cycle per second."},
-    {"q", T_OBJECT_EX, offsetof(ButBR, q), 0, "Q factor."},
-    {"mul", T_OBJECT_EX, offsetof(ButBR, mul), 0, "Mul factor."},
-    {"add", T_OBJECT_EX, offsetof(ButBR, add), 0, "Add factor."},
-    {NULL}  /* Sentinel */
+static PyMemberDef ComplexRes_members[] = {
+{"server", T_OBJECT_EX, offsetof(ComplexRes, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(ComplexRes, stream), 0, "Stream object."},
+{"input", T_OBJECT_EX, offsetof(ComplexRes, input), 0, "Input sound object."},
+{"freq", T_OBJECT_EX, offsetof(ComplexRes, freq), 0, "Center frequency in cycle per second."},
+{"decay", T_OBJECT_EX, offsetof(ComplexRes, decay), 0, "Decaying envelope time in seconds."},
+{"mul", T_OBJECT_EX, offsetof(ComplexRes, mul), 0, "Mul factor."},
+{"add", T_OBJECT_EX, offsetof(ComplexRes, add), 0, "Add factor."},
+{NULL}  /* Sentinel */
 };
 
-static PyMethodDef ButBR_methods[] = {
-    {"getServer", (PyCFunction)ButBR_getServer, METH_NOARGS, "Returns server object."},
-    {"_getStream", (PyCFunction)ButBR_getStream, METH_NOARGS, "Returns stream object."},
-    {"play", (PyCFunction)ButBR_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-    {"out", (PyCFunction)ButBR_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-    {"stop", (PyCFunction)ButBR_stop, METH_NOARGS, "Stops computing."},
-	{"setFreq", (PyCFunction)ButBR_setFreq, METH_O, "Sets filter cutoff frequency in cycle per second."},
-    {"setQ", (PyCFunction)ButBR_setQ, METH_O, "Sets filter Q factor."},
-	{"setMul", (PyCFunction)ButBR_setMul, METH_O, "Sets oscillator mul factor."},
-	{"setAdd", (PyCFunction)ButBR_setAdd, METH_O, "Sets oscillator add factor."},
-    {"setSub", (PyCFunction)ButBR_setSub, METH_O, "Sets inverse add factor."},
-    {"setDiv", (PyCFunction)ButBR_setDiv, METH_O, "Sets inverse mul factor."},
-    {NULL}  /* Sentinel */
+static PyMethodDef ComplexRes_methods[] = {
+{"getServer", (PyCFunction)ComplexRes_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)ComplexRes_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)ComplexRes_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"out", (PyCFunction)ComplexRes_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+{"stop", (PyCFunction)ComplexRes_stop, METH_NOARGS, "Stops computing."},
+{"setFreq", (PyCFunction)ComplexRes_setFreq, METH_O, "Sets filter center frequency in cycle per second."},
+{"setDecay", (PyCFunction)ComplexRes_setDecay, METH_O, "Sets filter decaying envelope time."},
+{"setMul", (PyCFunction)ComplexRes_setMul, METH_O, "Sets oscillator mul factor."},
+{"setAdd", (PyCFunction)ComplexRes_setAdd, METH_O, "Sets oscillator add factor."},
+{"setSub", (PyCFunction)ComplexRes_setSub, METH_O, "Sets inverse add factor."},
+{"setDiv", (PyCFunction)ComplexRes_setDiv, METH_O, "Sets inverse mul factor."},
+{NULL}  /* Sentinel */
 };
 
-static PyNumberMethods ButBR_as_number = {
-    (binaryfunc)ButBR_add,                         /*nb_add*/
-    (binaryfunc)ButBR_sub,                         /*nb_subtract*/
-    (binaryfunc)ButBR_multiply,                    /*nb_multiply*/
-    (binaryfunc)ButBR_div,                                              /*nb_divide*/
-    0,                                              /*nb_remainder*/
-    0,                                              /*nb_divmod*/
-    0,                                              /*nb_power*/
-    0,                                              /*nb_neg*/
-    0,                                              /*nb_pos*/
-    0,                                              /*(unaryfunc)array_abs,*/
-    0,                                              /*nb_nonzero*/
-    0,                                              /*nb_invert*/
-    0,                                              /*nb_lshift*/
-    0,                                              /*nb_rshift*/
-    0,                                              /*nb_and*/
-    0,                                              /*nb_xor*/
-    0,                                              /*nb_or*/
-    0,                                              /*nb_coerce*/
-    0,                                              /*nb_int*/
-    0,                                              /*nb_long*/
-    0,                                              /*nb_float*/
-    0,                                              /*nb_oct*/
-    0,                                              /*nb_hex*/
-    (binaryfunc)ButBR_inplace_add,                 /*inplace_add*/
-    (binaryfunc)ButBR_inplace_sub,                 /*inplace_subtract*/
-    (binaryfunc)ButBR_inplace_multiply,            /*inplace_multiply*/
-    (binaryfunc)ButBR_inplace_div,                                              /*inplace_divide*/
-    0,                                              /*inplace_remainder*/
-    0,                                              /*inplace_power*/
-    0,                                              /*inplace_lshift*/
-    0,                                              /*inplace_rshift*/
-    0,                                              /*inplace_and*/
-    0,                                              /*inplace_xor*/
-    0,                                              /*inplace_or*/
-    0,                                              /*nb_floor_divide*/
-    0,                                              /*nb_true_divide*/
-    0,                                              /*nb_inplace_floor_divide*/
-    0,                                              /*nb_inplace_true_divide*/
-    0,                                              /* nb_index */
+static PyNumberMethods ComplexRes_as_number = {
+(binaryfunc)ComplexRes_add,                         /*nb_add*/
+(binaryfunc)ComplexRes_sub,                         /*nb_subtract*/
+(binaryfunc)ComplexRes_multiply,                    /*nb_multiply*/
+(binaryfunc)ComplexRes_div,                                              /*nb_divide*/
+0,                                              /*nb_remainder*/
+0,                                              /*nb_divmod*/
+0,                                              /*nb_power*/
+0,                                              /*nb_neg*/
+0,                                              /*nb_pos*/
+0,                                              /*(unaryfunc)array_abs,*/
+0,                                              /*nb_nonzero*/
+0,                                              /*nb_invert*/
+0,                                              /*nb_lshift*/
+0,                                              /*nb_rshift*/
+0,                                              /*nb_and*/
+0,                                              /*nb_xor*/
+0,                                              /*nb_or*/
+0,                                              /*nb_coerce*/
+0,                                              /*nb_int*/
+0,                                              /*nb_long*/
+0,                                              /*nb_float*/
+0,                                              /*nb_oct*/
+0,                                              /*nb_hex*/
+(binaryfunc)ComplexRes_inplace_add,                 /*inplace_add*/
+(binaryfunc)ComplexRes_inplace_sub,                 /*inplace_subtract*/
+(binaryfunc)ComplexRes_inplace_multiply,            /*inplace_multiply*/
+(binaryfunc)ComplexRes_inplace_div,                                              /*inplace_divide*/
+0,                                              /*inplace_remainder*/
+0,                                              /*inplace_power*/
+0,                                              /*inplace_lshift*/
+0,                                              /*inplace_rshift*/
+0,                                              /*inplace_and*/
+0,                                              /*inplace_xor*/
+0,                                              /*inplace_or*/
+0,                                              /*nb_floor_divide*/
+0,                                              /*nb_true_divide*/
+0,                                              /*nb_inplace_floor_divide*/
+0,                                              /*nb_inplace_true_divide*/
+0,                                              /* nb_index */
 };
 
-PyTypeObject ButBRType = {
-    PyObject_HEAD_INIT(NULL)
-    0,                                              /*ob_size*/
-    "_pyo.ButBR_base",                                   /*tp_name*/
-    sizeof(ButBR),                                 /*tp_basicsize*/
-    0,                                              /*tp_itemsize*/
-    (destructor)ButBR_dealloc,                     /*tp_dealloc*/
-    0,                                              /*tp_print*/
-    0,                                              /*tp_getattr*/
-    0,                                              /*tp_setattr*/
-    0,                                              /*tp_compare*/
-    0,                                              /*tp_repr*/
-    &ButBR_as_number,                              /*tp_as_number*/
-    0,                                              /*tp_as_sequence*/
-    0,                                              /*tp_as_mapping*/
-    0,                                              /*tp_hash */
-    0,                                              /*tp_call*/
-    0,                                              /*tp_str*/
-    0,                                              /*tp_getattro*/
-    0,                                              /*tp_setattro*/
-    0,                                              /*tp_as_buffer*/
-    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-    "ButBR objects. Second-order Butterworth band-reject filter.",           /* tp_doc */
-    (traverseproc)ButBR_traverse,                  /* tp_traverse */
-    (inquiry)ButBR_clear,                          /* tp_clear */
-    0,                                              /* tp_richcompare */
-    0,                                              /* tp_weaklistoffset */
-    0,                                              /* tp_iter */
-    0,                                              /* tp_iternext */
-    ButBR_methods,                                 /* tp_methods */
-    ButBR_members,                                 /* tp_members */
-    0,                                              /* tp_getset */
-    0,                                              /* tp_base */
-    0,                                              /* tp_dict */
-    0,                                              /* tp_descr_get */
-    0,                                              /* tp_descr_set */
-    0,                                              /* tp_dictoffset */
-    0,                          /* tp_init */
-    0,                                              /* tp_alloc */
-    ButBR_new,                                     /* tp_new */
+PyTypeObject ComplexResType = {
+PyObject_HEAD_INIT(NULL)
+0,                                              /*ob_size*/
+"_pyo.ComplexRes_base",                                   /*tp_name*/
+sizeof(ComplexRes),                                 /*tp_basicsize*/
+0,                                              /*tp_itemsize*/
+(destructor)ComplexRes_dealloc,                     /*tp_dealloc*/
+0,                                              /*tp_print*/
+0,                                              /*tp_getattr*/
+0,                                              /*tp_setattr*/
+0,                                              /*tp_compare*/
+0,                                              /*tp_repr*/
+&ComplexRes_as_number,                              /*tp_as_number*/
+0,                                              /*tp_as_sequence*/
+0,                                              /*tp_as_mapping*/
+0,                                              /*tp_hash */
+0,                                              /*tp_call*/
+0,                                              /*tp_str*/
+0,                                              /*tp_getattro*/
+0,                                              /*tp_setattro*/
+0,                                              /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"ComplexRes objects. Second order allpass filter.",           /* tp_doc */
+(traverseproc)ComplexRes_traverse,                  /* tp_traverse */
+(inquiry)ComplexRes_clear,                          /* tp_clear */
+0,                                              /* tp_richcompare */
+0,                                              /* tp_weaklistoffset */
+0,                                              /* tp_iter */
+0,                                              /* tp_iternext */
+ComplexRes_methods,                                 /* tp_methods */
+ComplexRes_members,                                 /* tp_members */
+0,                                              /* tp_getset */
+0,                                              /* tp_base */
+0,                                              /* tp_dict */
+0,                                              /* tp_descr_get */
+0,                                              /* tp_descr_set */
+0,                                              /* tp_dictoffset */
+0,                          /* tp_init */
+0,                                              /* tp_alloc */
+ComplexRes_new,                                     /* tp_new */
 };
+/* Modal resonator bank: many ComplexRes sharing one input. The states and
+** coefficients are stored as structure-of-arrays, padded to a multiple of
+** MODALBANK_LANES modes. The recursion runs on MODALBANK_LANES independent
+** modes at a time, a loop the compiler turns into vector instructions, and
+** tasks of MODALBANK_TASK_MODES modes are spread over the server's worker
+** threads. */
+#define MODALBANK_LANES 8
+#define MODALBANK_TASK_MODES 64
+
+enum { MODAL_FREQS = 0, MODAL_DECAYS, MODAL_GAINS, MODAL_NUM_PARAMS };
 
-/****************/
-/** ComplexRes **/
-/****************/
 typedef struct {
     pyo_audio_HEAD
     PyObject *input;
     Stream *input_stream;
-    PyObject *freq;
-    Stream *freq_stream;
-    PyObject *decay;
-    Stream *decay_stream;
-    int modebuffer[4]; // need at least 2 slots for mul & add
-    MYFLT last_freq;
-    MYFLT last_decay;
+    PyObject *freqscale;
+    Stream *freqscale_stream;
+    PyObject *decayscale;
+    Stream *decayscale_stream;
+    /* float, list of floats or TableStream, for freqs, decays and gains */
+    PyObject *sources[MODAL_NUM_PARAMS];
+    MYFLT *values[MODAL_NUM_PARAMS]; /* num values each */
+    int num;
+    int numpadded;
+    int ntasks;
+    int dirty;
+    MYFLT last_freqscale;
+    MYFLT last_decayscale;
     MYFLT oneOnSr;
-    // variables
-    MYFLT res;
-    MYFLT norm;
-    MYFLT coeffx;
-    MYFLT coeffy;
-    // sample memories
-    MYFLT x;
-    MYFLT y;
-} ComplexRes;
-
-static void
-ComplexRes_filters_ii(ComplexRes *self) {
-    int i;
-    MYFLT ang, x, y;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT freq = PyFloat_AS_DOUBLE(self->freq);
-    MYFLT decay = PyFloat_AS_DOUBLE(self->decay);
-
-    if (decay <= 0.0001)
-        decay = 0.0001;
+    MYFLT nyquist;
+    /* numpadded each */
+    MYFLT *sre;
+    MYFLT *sim;
+    MYFLT *cre;
+    MYFLT *cim;
+    MYFLT *gain;
+    MYFLT *lanebuf; /* ntasks * bufsize * MODALBANK_LANES partial sums */
+    MYFLT *taskbuffers; /* outputs of the tasks 1 to ntasks - 1 */
+    int modebuffer[4]; // need at least 2 slots for mul & add
+} ModalBank;
 
-    if (decay != self->last_decay || freq != self->last_freq) {
-        self->res = MYEXP(-1.0/(decay*self->sr));
-        //self->norm = (1.0-self->res*self->res)/self->res;
-        self->last_decay = decay;
-        ang = (freq*self->oneOnSr)*TWOPI;
-        self->coeffx = self->res * MYCOS(ang);
-        self->coeffy = self->res * MYSIN(ang);
-        self->last_freq = freq;
+/* Fills the values of a parameter from its source. Lists and tables shorter
+** than the bank are read circularly. Returns 1 if a value changed. */
+static int
+ModalBank_readSource(ModalBank *self, int p)
+{
+    int i, size, changed = 0;
+    MYFLT v, *tab, *values = self->values[p];
+    PyObject *src = self->sources[p];
+
+    if (PyFloat_Check(src)) {
+        v = PyFloat_AS_DOUBLE(src);
+        for (i=0; i<self->num; i++) {
+            if (values[i] != v) {
+                values[i] = v;
+                changed = 1;
+            }
+        }
+    }
+    else if (PyList_Check(src)) {
+        size = PyList_GET_SIZE(src);
+        for (i=0; i<self->num; i++) {
+            v = PyFloat_AS_DOUBLE(PyList_GET_ITEM(src, i % size));
+            if (values[i] != v) {
+                values[i] = v;
+                changed = 1;
+            }
+        }
+    }
+    else {
+        tab = TableStream_getData(src);
+        size = TableStream_getSize(src);
+        if (size < 1)
+            return 0;
+        for (i=0; i<self->num; i++) {
+            v = tab[i % size];
+            if (values[i] != v) {
+                values[i] = v;
+                changed = 1;
+            }
+        }
     }
+    return changed;
+}
 
-    for (i=0; i<self->bufsize; i++) {
-        x = self->coeffx * self->x - self->coeffy * self->y + in[i];
-        y = self->coeffy * self->x + self->coeffx * self->y;
-        self->data[i] = y * self->norm;
-        self->x = x;
-        self->y = y;
+static void
+ModalBank_allocate_memories(ModalBank *self)
+{
+    int i, p;
+
+    self->numpadded = (self->num + MODALBANK_LANES - 1) / MODALBANK_LANES * MODALBANK_LANES;
+    self->ntasks = (self->numpadded + MODALBANK_TASK_MODES - 1) / MODALBANK_TASK_MODES;
+    for (p=0; p<MODAL_NUM_PARAMS; p++) {
+        self->values[p] = (MYFLT *)realloc(self->values[p], self->num * sizeof(MYFLT));
+        for (i=0; i<self->num; i++)
+            self->values[p][i] = 0.0;
     }
+    self->sre = (MYFLT *)realloc(self->sre, self->numpadded * sizeof(MYFLT));
+    self->sim = (MYFLT *)realloc(self->sim, self->numpadded * sizeof(MYFLT));
+    self->cre = (MYFLT *)realloc(self->cre, self->numpadded * sizeof(MYFLT));
+    self->cim = (MYFLT *)realloc(self->cim, self->numpadded * sizeof(MYFLT));
+    self->gain = (MYFLT *)realloc(self->gain, self->numpadded * sizeof(MYFLT));
+    for (i=0; i<self->numpadded; i++)
+        self->sre[i] = self->sim[i] = self->cre[i] = self->cim[i] = self->gain[i] = 0.0;
+    self->lanebuf = (MYFLT *)realloc(self->lanebuf, self->ntasks * self->bufsize * MODALBANK_LANES * sizeof(MYFLT));
+    self->taskbuffers = (MYFLT *)realloc(self->taskbuffers, ((self->ntasks - 1) * self->bufsize + 1) * sizeof(MYFLT));
+    Server_prefaultMemory((Server *)self->server, self->lanebuf, self->ntasks * self->bufsize * MODALBANK_LANES * sizeof(MYFLT));
+    Server_prefaultMemory((Server *)self->server, self->taskbuffers, ((self->ntasks - 1) * self->bufsize + 1) * sizeof(MYFLT));
+    self->dirty = 1;
 }
 
+/* Per-block update. Scales are sampled at the first sample of the buffer,
+** tables are read again and the coefficients are computed only if something
+** changed. Same resonator as ComplexRes, with its -40 dB normalization. */
 static void
-ComplexRes_filters_ai(ComplexRes *self) {
-    int i, check = 0;
-    MYFLT freq, ang, x, y;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    MYFLT decay = PyFloat_AS_DOUBLE(self->decay);
+ModalBank_update(ModalBank *self)
+{
+    int i, p, changed = self->dirty;
+    MYFLT freqscale, decayscale, freq, decay, res, ang;
 
-    if (decay <= 0.0001)
-        decay = 0.0001;
+    if (self->modebuffer[2] == 0)
+        freqscale = PyFloat_AS_DOUBLE(self->freqscale);
+    else
+        freqscale = Stream_getData((Stream *)self->freqscale_stream)[0];
+    if (self->modebuffer[3] == 0)
+        decayscale = PyFloat_AS_DOUBLE(self->decayscale);
+    else
+        decayscale = Stream_getData((Stream *)self->decayscale_stream)[0];
 
-    if (decay != self->last_decay) {
-        self->res = MYEXP(-1.0/(decay*self->sr));
-        //self->norm = (1.0-self->res*self->res)/self->res;
-        self->last_decay = decay;
-        check = 1;
+    for (p=0; p<MODAL_NUM_PARAMS; p++) {
+        if (!PyFloat_Check(self->sources[p]) && !PyList_Check(self->sources[p]))
+            changed |= ModalBank_readSource(self, p);
     }
-
-    for (i=0; i<self->bufsize; i++) {
-        freq = fr[i];
-        if (freq != self->last_freq || check) {
-            ang = (freq*self->oneOnSr)*TWOPI;
-            self->coeffx = self->res * MYCOS(ang);
-            self->coeffy = self->res * MYSIN(ang);
-            self->last_freq = freq;
-            check = 0;
+
+    if (!changed && freqscale == self->last_freqscale && decayscale == self->last_decayscale)
+        return;
+
+    self->dirty = 0;
+    self->last_freqscale = freqscale;
+    self->last_decayscale = decayscale;
+    for (i=0; i<self->num; i++) {
+        freq = self->values[MODAL_FREQS][i] * freqscale;
+        decay = self->values[MODAL_DECAYS][i] * decayscale;
+        if (freq <= 0.0 || freq >= self->nyquist) {
+            /* Silent mode, its state dies away. */
+            self->cre[i] = self->cim[i] = self->gain[i] = 0.0;
+            continue;
         }
-        x = self->coeffx * self->x - self->coeffy * self->y + in[i];
-        y = self->coeffy * self->x + self->coeffx * self->y;
-        self->data[i] = y * self->norm;
-        self->x = x;
-        self->y = y;
+        if (decay <= 0.0001)
+            decay = 0.0001;
+        res = MYEXP(-1.0/(decay*self->sr));
+        ang = (freq*self->oneOnSr)*TWOPI;
+        self->cre[i] = res * MYCOS(ang);
+        self->cim[i] = res * MYSIN(ang);
+        self->gain[i] = self->values[MODAL_GAINS][i] * 0.01;
     }
 }
 
+/* Runs the modes [task * MODALBANK_TASK_MODES, ...] in the task's own buffer. */
 static void
-ComplexRes_filters_ia(ComplexRes *self) {
-    int i;
-    MYFLT decay, ang, x, y;
+ModalBank_task(void *data, int task)
+{
+    ModalBank *self = (ModalBank *)data;
+    int i, l, b, start, end;
+    MYFLT x, re, im, sum, *out, *acc;
+    MYFLT sre[MODALBANK_LANES], sim[MODALBANK_LANES], cre[MODALBANK_LANES], cim[MODALBANK_LANES], gain[MODALBANK_LANES];
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT freq = PyFloat_AS_DOUBLE(self->freq);
-    MYFLT *dec = Stream_getData((Stream *)self->decay_stream);
+    MYFLT *lanebuf = &self->lanebuf[task * self->bufsize * MODALBANK_LANES];
+
+    start = task * MODALBANK_TASK_MODES;
+    end = start + MODALBANK_TASK_MODES;
+    if (end > self->numpadded)
+        end = self->numpadded;
+    out = task == 0 ? self->data : &self->taskbuffers[(task - 1) * self->bufsize];
+
+    for (i=0; i<self->bufsize * MODALBANK_LANES; i++)
+        lanebuf[i] = 0.0;
+
+    for (b=start; b<end; b+=MODALBANK_LANES) {
+        /* Local copies, so the lanes loop doesn't alias the bank's arrays. */
+        for (l=0; l<MODALBANK_LANES; l++) {
+            sre[l] = self->sre[b+l];
+            sim[l] = self->sim[b+l];
+            cre[l] = self->cre[b+l];
+            cim[l] = self->cim[b+l];
+            gain[l] = self->gain[b+l];
+        }
+        for (i=0; i<self->bufsize; i++) {
+            x = in[i];
+            acc = &lanebuf[i * MODALBANK_LANES];
+            for (l=0; l<MODALBANK_LANES; l++) {
+                re = cre[l] * sre[l] - cim[l] * sim[l] + x;
+                im = cim[l] * sre[l] + cre[l] * sim[l];
+                sre[l] = re;
+                sim[l] = im;
+                acc[l] += gain[l] * im;
+            }
+        }
+        for (l=0; l<MODALBANK_LANES; l++) {
+            self->sre[b+l] = sre[l];
+            self->sim[b+l] = sim[l];
+        }
+    }
 
     for (i=0; i<self->bufsize; i++) {
-        decay = dec[i];
-        if (decay <= 0.0001)
-            decay = 0.0001;
-        if (freq != self->last_freq || decay != self->last_decay) {
-            self->res = MYEXP(-1.0/(decay*self->sr));
-            //self->norm = (1.0-self->res*self->res)/self->res;
-            self->last_decay = decay;
-            ang = (freq*self->oneOnSr)*TWOPI;
-            self->coeffx = self->res * MYCOS(ang);
-            self->coeffy = self->res * MYSIN(ang);
-            self->last_freq = freq;
-        }
-        x = self->coeffx * self->x - self->coeffy * self->y + in[i];
-        y = self->coeffy * self->x + self->coeffx * self->y;
-        self->data[i] = y * self->norm;
-        self->x = x;
-        self->y = y;
+        acc = &lanebuf[i * MODALBANK_LANES];
+        sum = 0.0;
+        for (l=0; l<MODALBANK_LANES; l++)
+            sum += acc[l];
+        out[i] = sum;
     }
 }
 
 static void
-ComplexRes_filters_aa(ComplexRes *self) {
-    int i;
-    MYFLT freq, decay, ang, x, y;
-    MYFLT *in = Stream_getData((Stream *)self->input_stream);
-    MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
-    MYFLT *dec = Stream_getData((Stream *)self->decay_stream);
+ModalBank_process(ModalBank *self)
+{
+    int i, j;
+    MYFLT *buf;
 
-    for (i=0; i<self->bufsize; i++) {
-        freq = fr[i];
-        decay = dec[i];
-        if (decay <= 0.0001)
-            decay = 0.0001;
-        if (freq != self->last_freq || decay != self->last_decay) {
-            self->res = MYEXP(-1.0/(decay*self->sr));
-            //self->norm = (1.0-self->res*self->res)/self->res;
-            self->last_decay = decay;
-            ang = (freq*self->oneOnSr)*TWOPI;
-            self->coeffx = self->res * MYCOS(ang);
-            self->coeffy = self->res * MYSIN(ang);
-            self->last_freq = freq;
+    ModalBank_update(self);
+
+    TaskPool_run(Server_getTaskPool((Server *)self->server), ModalBank_task, self, self->ntasks);
+
+    /* Reduction in task order, the result doesn't depend on the threads. */
+    for (j=1; j<self->ntasks; j++) {
+        buf = &self->taskbuffers[(j - 1) * self->bufsize];
+        for (i=0; i<self->bufsize; i++) {
+            self->data[i] += buf[i];
         }
-        x = self->coeffx * self->x - self->coeffy * self->y + in[i];
-        y = self->coeffy * self->x + self->coeffx * self->y;
-        self->data[i] = y * self->norm;
-        self->x = x;
-        self->y = y;
     }
 }
 
-static void ComplexRes_postprocessing_ii(ComplexRes *self) { POST_PROCESSING_II };
-static void ComplexRes_postprocessing_ai(ComplexRes *self) { POST_PROCESSING_AI };
-static void ComplexRes_postprocessing_ia(ComplexRes *self) { POST_PROCESSING_IA };
-static void ComplexRes_postprocessing_aa(ComplexRes *self) { POST_PROCESSING_AA };
-static void ComplexRes_postprocessing_ireva(ComplexRes *self) { POST_PROCESSING_IREVA };
-static void ComplexRes_postprocessing_areva(ComplexRes *self) { POST_PROCESSING_AREVA };
-static void ComplexRes_postprocessing_revai(ComplexRes *self) { POST_PROCESSING_REVAI };
-static void ComplexRes_postprocessing_revaa(ComplexRes *self) { POST_PROCESSING_REVAA };
-static void ComplexRes_postprocessing_revareva(ComplexRes *self) { POST_PROCESSING_REVAREVA };
+static void ModalBank_postprocessing_ii(ModalBank *self) { POST_PROCESSING_II };
+static void ModalBank_postprocessing_ai(ModalBank *self) { POST_PROCESSING_AI };
+static void ModalBank_postprocessing_ia(ModalBank *self) { POST_PROCESSING_IA };
+static void ModalBank_postprocessing_aa(ModalBank *self) { POST_PROCESSING_AA };
+static void ModalBank_postprocessing_ireva(ModalBank *self) { POST_PROCESSING_IREVA };
+static void ModalBank_postprocessing_areva(ModalBank *self) { POST_PROCESSING_AREVA };
+static void ModalBank_postprocessing_revai(ModalBank *self) { POST_PROCESSING_REVAI };
+static void ModalBank_postprocessing_revaa(ModalBank *self) { POST_PROCESSING_REVAA };
+static void ModalBank_postprocessing_revareva(ModalBank *self) { POST_PROCESSING_REVAREVA };
 
 static void
-ComplexRes_setProcMode(ComplexRes *self)
+ModalBank_setProcMode(ModalBank *self)
 {
-    int procmode, muladdmode;
-    procmode = self->modebuffer[2] + self->modebuffer[3] * 10;
+    int muladdmode;
     muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
 
-	switch (procmode) {
-        case 0:
-            self->proc_func_ptr = ComplexRes_filters_ii;
-            break;
-        case 1:
-            self->proc_func_ptr = ComplexRes_filters_ai;
-            break;
-        case 10:
-            self->proc_func_ptr = ComplexRes_filters_ia;
-            break;
-        case 11:
-            self->proc_func_ptr = ComplexRes_filters_aa;
-            break;
-    }
+    self->proc_func_ptr = ModalBank_process;
+
 	switch (muladdmode) {
         case 0:
-            self->muladd_func_ptr = ComplexRes_postprocessing_ii;
+            self->muladd_func_ptr = ModalBank_postprocessing_ii;
             break;
         case 1:
-            self->muladd_func_ptr = ComplexRes_postprocessing_ai;
+            self->muladd_func_ptr = ModalBank_postprocessing_ai;
             break;
         case 2:
-            self->muladd_func_ptr = ComplexRes_postprocessing_revai;
+            self->muladd_func_ptr = ModalBank_postprocessing_revai;
             break;
         case 10:
-            self->muladd_func_ptr = ComplexRes_postprocessing_ia;
+            self->muladd_func_ptr = ModalBank_postprocessing_ia;
             break;
         case 11:
-            self->muladd_func_ptr = ComplexRes_postprocessing_aa;
+            self->muladd_func_ptr = ModalBank_postprocessing_aa;
             break;
         case 12:
-            self->muladd_func_ptr = ComplexRes_postprocessing_revaa;
+            self->muladd_func_ptr = ModalBank_postprocessing_revaa;
             break;
         case 20:
-            self->muladd_func_ptr = ComplexRes_postprocessing_ireva;
+            self->muladd_func_ptr = ModalBank_postprocessing_ireva;
             break;
         case 21:
-            self->muladd_func_ptr = ComplexRes_postprocessing_areva;
+            self->muladd_func_ptr = ModalBank_postprocessing_areva;
             break;
         case 22:
-            self->muladd_func_ptr = ComplexRes_postprocessing_revareva;
+            self->muladd_func_ptr = ModalBank_postprocessing_revareva;
             break;
     }
 }
 
 static void
-ComplexRes_compute_next_data_frame(ComplexRes *self)
+ModalBank_compute_next_data_frame(ModalBank *self)
 {
     (*self->proc_func_ptr)(self);
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+ModalBank_memory(ModalBank *self) {
+    return (MODAL_NUM_PARAMS * self->num + 5 * self->numpadded +
+            self->ntasks * self->bufsize * (MODALBANK_LANES + 1)) * sizeof(MYFLT);
+}
+
 static int
-ComplexRes_traverse(ComplexRes *self, visitproc visit, void *arg)
+ModalBank_traverse(ModalBank *self, visitproc visit, void *arg)
 {
+    int p;
     pyo_VISIT
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
-    Py_VISIT(self->freq);
-    Py_VISIT(self->freq_stream);
-    Py_VISIT(self->decay);
-    Py_VISIT(self->decay_stream);
+    Py_VISIT(self->freqscale);
+    Py_VISIT(self->freqscale_stream);
+    Py_VISIT(self->decayscale);
+    Py_VISIT(self->decayscale_stream);
+    for (p=0; p<MODAL_NUM_PARAMS; p++)
+        Py_VISIT(self->sources[p]);
     return 0;
 }
 
 static int
-ComplexRes_clear(ComplexRes *self)
+ModalBank_clear(ModalBank *self)
 {
+    int p;
     pyo_CLEAR
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
-    Py_CLEAR(self->freq);
-    Py_CLEAR(self->freq_stream);
-    Py_CLEAR(self->decay);
-    Py_CLEAR(self->decay_stream);
+    Py_CLEAR(self->freqscale);
+    Py_CLEAR(self->freqscale_stream);
+    Py_CLEAR(self->decayscale);
+    Py_CLEAR(self->decayscale_stream);
+    for (p=0; p<MODAL_NUM_PARAMS; p++)
+        Py_CLEAR(self->sources[p]);
     return 0;
 }
 
 static void
-ComplexRes_dealloc(ComplexRes* self)
+ModalBank_dealloc(ModalBank* self)
 {
+    int p;
     pyo_DEALLOC
-    ComplexRes_clear(self);
+    for (p=0; p<MODAL_NUM_PARAMS; p++)
+        free(self->values[p]);
+    free(self->sre);
+    free(self->sim);
+    free(self->cre);
+    free(self->cim);
+    free(self->gain);
+    free(self->lanebuf);
+    free(self->taskbuffers);
+    ModalBank_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
 
+/* Converts a float, a sequence of floats or a table object into a source:
+** a python float, a list of python floats or a TableStream. Returns a new
+** reference, or NULL with an exception set. */
 static PyObject *
-ComplexRes_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+ModalBank_makeSource(PyObject *arg)
+{
+    int i, size;
+    PyObject *list, *item;
+
+    if (PyObject_HasAttrString(arg, "getTableStream"))
+        return PyObject_CallMethod(arg, "getTableStream", "");
+    if (PyNumber_Check(arg))
+        return PyNumber_Float(arg);
+    if (PySequence_Check(arg) && (size = PySequence_Size(arg)) > 0) {
+        list = PyList_New(size);
+        for (i=0; i<size; i++) {
+            item = PySequence_GetItem(arg, i);
+            if (item == NULL || !PyNumber_Check(item)) {
+                Py_XDECREF(item);
+                Py_DECREF(list);
+                PyErr_SetString(PyExc_TypeError, "ModalBank values must be numbers.");
+                return NULL;
+            }
+            PyList_SET_ITEM(list, i, PyNumber_Float(item));
+            Py_DECREF(item);
+        }
+        return list;
+    }
+    PyErr_SetString(PyExc_TypeError, "ModalBank values must be a number, a non-empty list of numbers or a table.");
+    return NULL;
+}
+
+/* Sets the source of a parameter. The frequencies give the number of modes:
+** the length of the list or the size of the table. */
+static int
+ModalBank_setSource(ModalBank *self, int p, PyObject *arg)
 {
-    int i;
-    PyObject *inputtmp, *input_streamtmp, *freqtmp=NULL, *decaytmp=NULL, *multmp=NULL, *addtmp=NULL;
-    ComplexRes *self;
-    self = (ComplexRes *)type->tp_alloc(type, 0);
+    int q, num;
+    PyObject *src = ModalBank_makeSource(arg);
 
-    self->freq = PyFloat_FromDouble(1000);
-    self->decay = PyFloat_FromDouble(.25);
-    self->last_freq = self->last_decay = -1.0;
-    self->x = self->y = 0.0;
-    self->res = 1.0;
-    self->norm = 0.01; /* normalization factor fixed at -40 dB */
-    self->coeffx = self->coeffy = 0.0;
+    if (src == NULL)
+        return -1;
+    Py_XDECREF(self->sources[p]);
+    self->sources[p] = src;
+
+    if (p == MODAL_FREQS) {
+        if (PyList_Check(src))
+            num = PyList_GET_SIZE(src);
+        else if (PyFloat_Check(src))
+            num = 1;
+        else
+            num = TableStream_getSize(src);
+        if (num < 1)
+            num = 1;
+        if (num != self->num) {
+            self->num = num;
+            ModalBank_allocate_memories(self);
+            for (q=0; q<MODAL_NUM_PARAMS; q++) {
+                if (self->sources[q] != NULL)
+                    ModalBank_readSource(self, q);
+            }
+            return 0;
+        }
+    }
+    if (self->num > 0)
+        ModalBank_readSource(self, p);
+    self->dirty = 1;
+    return 0;
+}
+
+static PyObject *
+ModalBank_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i, p;
+    PyObject *inputtmp, *input_streamtmp, *freqstmp, *decaystmp=NULL, *gainstmp=NULL, *freqscaletmp=NULL, *decayscaletmp=NULL, *multmp=NULL, *addtmp=NULL;
+    PyObject *defaults[MODAL_NUM_PARAMS];
+    ModalBank *self;
+    self = (ModalBank *)type->tp_alloc(type, 0);
+
+    self->freqscale = PyFloat_FromDouble(1);
+    self->decayscale = PyFloat_FromDouble(1);
+    self->last_freqscale = self->last_decayscale = -1.0;
+    self->num = 0;
 	self->modebuffer[0] = 0;
 	self->modebuffer[1] = 0;
 	self->modebuffer[2] = 0;
@@ -11307,23 +12425,38 @@ ComplexRes_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     INIT_OBJECT_COMMON
 
     self->oneOnSr = 1.0 / self->sr;
+    self->nyquist = self->sr * 0.5;
 
-    Stream_setFunctionPtr(self->stream, ComplexRes_compute_next_data_frame);
-    self->mode_func_ptr = ComplexRes_setProcMode;
+    Stream_setFunctionPtr(self->stream, ModalBank_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, ModalBank_memory);
+    self->mode_func_ptr = ModalBank_setProcMode;
 
-    static char *kwlist[] = {"input", "freq", "decay", "mul", "add", NULL};
+    static char *kwlist[] = {"input", "freqs", "decays", "gains", "freqscale", "decayscale", "mul", "add", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOO", kwlist, &inputtmp, &freqtmp, &decaytmp, &multmp, &addtmp))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OO|OOOOOO", kwlist, &inputtmp, &freqstmp, &decaystmp, &gainstmp, &freqscaletmp, &decayscaletmp, &multmp, &addtmp))
         Py_RETURN_NONE;
 
     INIT_INPUT_STREAM
 
-    if (freqtmp) {
-        PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
+    /* Decays and gains are set first, the frequencies then size the bank. */
+    self->sources[MODAL_DECAYS] = PyFloat_FromDouble(1);
+    self->sources[MODAL_GAINS] = PyFloat_FromDouble(1);
+    defaults[MODAL_FREQS] = freqstmp;
+    defaults[MODAL_DECAYS] = decaystmp;
+    defaults[MODAL_GAINS] = gainstmp;
+    for (p=MODAL_NUM_PARAMS-1; p>=0; p--) {
+        if (defaults[p] != NULL && ModalBank_setSource(self, p, defaults[p]) < 0) {
+            Py_DECREF(self);
+            return NULL;
+        }
     }
 
-    if (decaytmp) {
-        PyObject_CallMethod((PyObject *)self, "setDecay", "O", decaytmp);
+    if (freqscaletmp) {
+        PyObject_CallMethod((PyObject *)self, "setFreqScale", "O", freqscaletmp);
+    }
+
+    if (decayscaletmp) {
+        PyObject_CallMethod((PyObject *)self, "setDecayScale", "O", decayscaletmp);
     }
 
     if (multmp) {
@@ -11341,28 +12474,58 @@ ComplexRes_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     return (PyObject *)self;
 }
 
-static PyObject * ComplexRes_getServer(ComplexRes* self) { GET_SERVER };
-static PyObject * ComplexRes_getStream(ComplexRes* self) { GET_STREAM };
-static PyObject * ComplexRes_setMul(ComplexRes *self, PyObject *arg) { SET_MUL };
-static PyObject * ComplexRes_setAdd(ComplexRes *self, PyObject *arg) { SET_ADD };
-static PyObject * ComplexRes_setSub(ComplexRes *self, PyObject *arg) { SET_SUB };
-static PyObject * ComplexRes_setDiv(ComplexRes *self, PyObject *arg) { SET_DIV };
+static PyObject * ModalBank_getServer(ModalBank* self) { GET_SERVER };
+static PyObject * ModalBank_getStream(ModalBank* self) { GET_STREAM };
+static PyObject * ModalBank_setMul(ModalBank *self, PyObject *arg) { SET_MUL };
+static PyObject * ModalBank_setAdd(ModalBank *self, PyObject *arg) { SET_ADD };
+static PyObject * ModalBank_setSub(ModalBank *self, PyObject *arg) { SET_SUB };
+static PyObject * ModalBank_setDiv(ModalBank *self, PyObject *arg) { SET_DIV };
 
-static PyObject * ComplexRes_play(ComplexRes *self, PyObject *args, PyObject *kwds) { PLAY };
-static PyObject * ComplexRes_out(ComplexRes *self, PyObject *args, PyObject *kwds) { OUT };
-static PyObject * ComplexRes_stop(ComplexRes *self) { STOP };
+static PyObject * ModalBank_play(ModalBank *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * ModalBank_out(ModalBank *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * ModalBank_stop(ModalBank *self) { STOP };
 
-static PyObject * ComplexRes_multiply(ComplexRes *self, PyObject *arg) { MULTIPLY };
-static PyObject * ComplexRes_inplace_multiply(ComplexRes *self, PyObject *arg) { INPLACE_MULTIPLY };
-static PyObject * ComplexRes_add(ComplexRes *self, PyObject *arg) { ADD };
-static PyObject * ComplexRes_inplace_add(ComplexRes *self, PyObject *arg) { INPLACE_ADD };
-static PyObject * ComplexRes_sub(ComplexRes *self, PyObject *arg) { SUB };
-static PyObject * ComplexRes_inplace_sub(ComplexRes *self, PyObject *arg) { INPLACE_SUB };
-static PyObject * ComplexRes_div(ComplexRes *self, PyObject *arg) { DIV };
-static PyObject * ComplexRes_inplace_div(ComplexRes *self, PyObject *arg) { INPLACE_DIV };
+static PyObject * ModalBank_multiply(ModalBank *self, PyObject *arg) { MULTIPLY };
+static PyObject * ModalBank_inplace_multiply(ModalBank *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * ModalBank_add(ModalBank *self, PyObject *arg) { ADD };
+static PyObject * ModalBank_inplace_add(ModalBank *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * ModalBank_sub(ModalBank *self, PyObject *arg) { SUB };
+static PyObject * ModalBank_inplace_sub(ModalBank *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * ModalBank_div(ModalBank *self, PyObject *arg) { DIV };
+static PyObject * ModalBank_inplace_div(ModalBank *self, PyObject *arg) { INPLACE_DIV };
 
 static PyObject *
-ComplexRes_setFreq(ComplexRes *self, PyObject *arg)
+ModalBank_setFreqs(ModalBank *self, PyObject *arg)
+{
+    if (ModalBank_setSource(self, MODAL_FREQS, arg) < 0)
+        return NULL;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+ModalBank_setDecays(ModalBank *self, PyObject *arg)
+{
+    if (ModalBank_setSource(self, MODAL_DECAYS, arg) < 0)
+        return NULL;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+ModalBank_setGains(ModalBank *self, PyObject *arg)
+{
+    if (ModalBank_setSource(self, MODAL_GAINS, arg) < 0)
+        return NULL;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+ModalBank_setFreqScale(ModalBank *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -11375,17 +12538,17 @@ ComplexRes_setFreq(ComplexRes *self, PyObject *arg)
 
 	tmp = arg;
 	Py_INCREF(tmp);
-	Py_DECREF(self->freq);
+	Py_DECREF(self->freqscale);
 	if (isNumber == 1) {
-		self->freq = PyNumber_Float(tmp);
+		self->freqscale = PyNumber_Float(tmp);
         self->modebuffer[2] = 0;
 	}
 	else {
-		self->freq = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->freq, "_getStream", NULL);
+		self->freqscale = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->freqscale, "_getStream", NULL);
         Py_INCREF(streamtmp);
-        Py_XDECREF(self->freq_stream);
-        self->freq_stream = (Stream *)streamtmp;
+        Py_XDECREF(self->freqscale_stream);
+        self->freqscale_stream = (Stream *)streamtmp;
 		self->modebuffer[2] = 1;
 	}
 
@@ -11396,7 +12559,7 @@ ComplexRes_setFreq(ComplexRes *self, PyObject *arg)
 }
 
 static PyObject *
-ComplexRes_setDecay(ComplexRes *self, PyObject *arg)
+ModalBank_setDecayScale(ModalBank *self, PyObject *arg)
 {
 	PyObject *tmp, *streamtmp;
 
@@ -11409,17 +12572,17 @@ ComplexRes_setDecay(ComplexRes *self, PyObject *arg)
 
 	tmp = arg;
 	Py_INCREF(tmp);
-	Py_DECREF(self->decay);
+	Py_DECREF(self->decayscale);
 	if (isNumber == 1) {
-		self->decay = PyNumber_Float(tmp);
+		self->decayscale = PyNumber_Float(tmp);
         self->modebuffer[3] = 0;
 	}
 	else {
-		self->decay = tmp;
-        streamtmp = PyObject_CallMethod((PyObject *)self->decay, "_getStream", NULL);
+		self->decayscale = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->decayscale, "_getStream", NULL);
         Py_INCREF(streamtmp);
-        Py_XDECREF(self->decay_stream);
-        self->decay_stream = (Stream *)streamtmp;
+        Py_XDECREF(self->decayscale_stream);
+        self->decayscale_stream = (Stream *)streamtmp;
 		self->modebuffer[3] = 1;
 	}
 
@@ -11429,37 +12592,59 @@ ComplexRes_setDecay(ComplexRes *self, PyObject *arg)
 	return Py_None;
 }
 
-static PyMemberDef ComplexRes_members[] = {
-{"server", T_OBJECT_EX, offsetof(ComplexRes, server), 0, "Pyo server."},
-{"stream", T_OBJECT_EX, offsetof(ComplexRes, stream), 0, "Stream object."},
-{"input", T_OBJECT_EX, offsetof(ComplexRes, input), 0, "Input sound object."},
-{"freq", T_OBJECT_EX, offsetof(ComplexRes, freq), 0, "Center frequency in cycle per second."},
-{"decay", T_OBJECT_EX, offsetof(ComplexRes, decay), 0, "Decaying envelope time in seconds."},
-{"mul", T_OBJECT_EX, offsetof(ComplexRes, mul), 0, "Mul factor."},
-{"add", T_OBJECT_EX, offsetof(ComplexRes, add), 0, "Add factor."},
+static PyObject *
+ModalBank_reset(ModalBank *self)
+{
+    int i;
+    for (i=0; i<self->numpadded; i++)
+        self->sre[i] = self->sim[i] = 0.0;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+ModalBank_getNumModes(ModalBank *self)
+{
+    return PyInt_FromLong(self->num);
+}
+
+static PyMemberDef ModalBank_members[] = {
+{"server", T_OBJECT_EX, offsetof(ModalBank, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(ModalBank, stream), 0, "Stream object."},
+{"input", T_OBJECT_EX, offsetof(ModalBank, input), 0, "Input sound object."},
+{"freqscale", T_OBJECT_EX, offsetof(ModalBank, freqscale), 0, "Multiplier of the frequencies."},
+{"decayscale", T_OBJECT_EX, offsetof(ModalBank, decayscale), 0, "Multiplier of the decay times."},
+{"mul", T_OBJECT_EX, offsetof(ModalBank, mul), 0, "Mul factor."},
+{"add", T_OBJECT_EX, offsetof(ModalBank, add), 0, "Add factor."},
 {NULL}  /* Sentinel */
 };
 
-static PyMethodDef ComplexRes_methods[] = {
-{"getServer", (PyCFunction)ComplexRes_getServer, METH_NOARGS, "Returns server object."},
-{"_getStream", (PyCFunction)ComplexRes_getStream, METH_NOARGS, "Returns stream object."},
-{"play", (PyCFunction)ComplexRes_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
-{"out", (PyCFunction)ComplexRes_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
-{"stop", (PyCFunction)ComplexRes_stop, METH_NOARGS, "Stops computing."},
-{"setFreq", (PyCFunction)ComplexRes_setFreq, METH_O, "Sets filter center frequency in cycle per second."},
-{"setDecay", (PyCFunction)ComplexRes_setDecay, METH_O, "Sets filter decaying envelope time."},
-{"setMul", (PyCFunction)ComplexRes_setMul, METH_O, "Sets oscillator mul factor."},
-{"setAdd", (PyCFunction)ComplexRes_setAdd, METH_O, "Sets oscillator add factor."},
-{"setSub", (PyCFunction)ComplexRes_setSub, METH_O, "Sets inverse add factor."},
-{"setDiv", (PyCFunction)ComplexRes_setDiv, METH_O, "Sets inverse mul factor."},
+static PyMethodDef ModalBank_methods[] = {
+{"getServer", (PyCFunction)ModalBank_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)ModalBank_getStream, METH_NOARGS, "Returns stream object."},
+{"play", (PyCFunction)ModalBank_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"out", (PyCFunction)ModalBank_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+{"stop", (PyCFunction)ModalBank_stop, METH_NOARGS, "Stops computing."},
+{"setFreqs", (PyCFunction)ModalBank_setFreqs, METH_O, "Sets the frequencies of the modes, list or table."},
+{"setDecays", (PyCFunction)ModalBank_setDecays, METH_O, "Sets the decay times of the modes, float, list or table."},
+{"setGains", (PyCFunction)ModalBank_setGains, METH_O, "Sets the gains of the modes, float, list or table."},
+{"setFreqScale", (PyCFunction)ModalBank_setFreqScale, METH_O, "Sets the multiplier of the frequencies."},
+{"setDecayScale", (PyCFunction)ModalBank_setDecayScale, METH_O, "Sets the multiplier of the decay times."},
+{"reset", (PyCFunction)ModalBank_reset, METH_NOARGS, "Silences all modes."},
+{"getNumModes", (PyCFunction)ModalBank_getNumModes, METH_NOARGS, "Returns the number of modes."},
+{"setMul", (PyCFunction)ModalBank_setMul, METH_O, "Sets oscillator mul factor."},
+{"setAdd", (PyCFunction)ModalBank_setAdd, METH_O, "Sets oscillator add factor."},
+{"setSub", (PyCFunction)ModalBank_setSub, METH_O, "Sets inverse add factor."},
+{"setDiv", (PyCFunction)ModalBank_setDiv, METH_O, "Sets inverse mul factor."},
 {NULL}  /* Sentinel */
 };
 
-static PyNumberMethods ComplexRes_as_number = {
-(binaryfunc)ComplexRes_add,                         /*nb_add*/
-(binaryfunc)ComplexRes_sub,                         /*nb_subtract*/
-(binaryfunc)ComplexRes_multiply,                    /*nb_multiply*/
-(binaryfunc)ComplexRes_div,                                              /*nb_divide*/
+static PyNumberMethods ModalBank_as_number = {
+(binaryfunc)ModalBank_add,                         /*nb_add*/
+(binaryfunc)ModalBank_sub,                         /*nb_subtract*/
+(binaryfunc)ModalBank_multiply,                    /*nb_multiply*/
+(binaryfunc)ModalBank_div,                                              /*nb_divide*/
 0,                                              /*nb_remainder*/
 0,                                              /*nb_divmod*/
 0,                                              /*nb_power*/
@@ -11479,10 +12664,10 @@ static PyNumberMethods ComplexRes_as_number = {
 0,                                              /*nb_float*/
 0,                                              /*nb_oct*/
 0,                                              /*nb_hex*/
-(binaryfunc)ComplexRes_inplace_add,                 /*inplace_add*/
-(binaryfunc)ComplexRes_inplace_sub,                 /*inplace_subtract*/
-(binaryfunc)ComplexRes_inplace_multiply,            /*inplace_multiply*/
-(binaryfunc)ComplexRes_inplace_div,                                              /*inplace_divide*/
+(binaryfunc)ModalBank_inplace_add,                 /*inplace_add*/
+(binaryfunc)ModalBank_inplace_sub,                 /*inplace_subtract*/
+(binaryfunc)ModalBank_inplace_multiply,            /*inplace_multiply*/
+(binaryfunc)ModalBank_inplace_div,                                              /*inplace_divide*/
 0,                                              /*inplace_remainder*/
 0,                                              /*inplace_power*/
 0,                                              /*inplace_lshift*/
@@ -11497,19 +12682,19 @@ static PyNumberMethods ComplexRes_as_number = {
 0,                                              /* nb_index */
 };
 
-PyTypeObject ComplexResType = {
+PyTypeObject ModalBankType = {
 PyObject_HEAD_INIT(NULL)
 0,                                              /*ob_size*/
-"_pyo.ComplexRes_base",                                   /*tp_name*/
-sizeof(ComplexRes),                                 /*tp_basicsize*/
+"_pyo.ModalBank_base",                                   /*tp_name*/
+sizeof(ModalBank),                                 /*tp_basicsize*/
 0,                                              /*tp_itemsize*/
-(destructor)ComplexRes_dealloc,                     /*tp_dealloc*/
+(destructor)ModalBank_dealloc,                     /*tp_dealloc*/
 0,                                              /*tp_print*/
 0,                                              /*tp_getattr*/
 0,                                              /*tp_setattr*/
 0,                                              /*tp_compare*/
 0,                                              /*tp_repr*/
-&ComplexRes_as_number,                              /*tp_as_number*/
+&ModalBank_as_number,                              /*tp_as_number*/
 0,                                              /*tp_as_sequence*/
 0,                                              /*tp_as_mapping*/
 0,                                              /*tp_hash */
@@ -11519,15 +12704,15 @@ sizeof(ComplexRes),                                 /*tp_basicsize*/
 0,                                              /*tp_setattro*/
 0,                                              /*tp_as_buffer*/
 Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
-"ComplexRes objects. Second order allpass filter.",           /* tp_doc */
-(traverseproc)ComplexRes_traverse,                  /* tp_traverse */
-(inquiry)ComplexRes_clear,                          /* tp_clear */
+"ModalBank objects. Bank of complex one-pole resonators.",           /* tp_doc */
+(traverseproc)ModalBank_traverse,                  /* tp_traverse */
+(inquiry)ModalBank_clear,                          /* tp_clear */
 0,                                              /* tp_richcompare */
 0,                                              /* tp_weaklistoffset */
 0,                                              /* tp_iter */
 0,                                              /* tp_iternext */
-ComplexRes_methods,                                 /* tp_methods */
-ComplexRes_members,                                 /* tp_members */
+ModalBank_methods,                                 /* tp_methods */
+ModalBank_members,                                 /* tp_members */
 0,                                              /* tp_getset */
 0,                                              /* tp_base */
 0,                                              /* tp_dict */
@@ -11536,5 +12721,5 @@ ComplexRes_members,                                 /* tp_members */
 0,                                              /* tp_dictoffset */
 0,                          /* tp_init */
 0,                                              /* tp_alloc */
-ComplexRes_new,                                     /* tp_new */
-};
\ No newline at end of file
+ModalBank_new,                                     /* tp_new */
+};
@@ -571,6 +571,17 @@ Freeverb_compute_next_data_frame(Freeverb *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+Freeverb_memory(Freeverb *self) {
+    int i;
+    long samps = 0;
+    for (i=0; i<NUM_COMB; i++)
+        samps += self->comb_nSamples[i] + 1;
+    for (i=0; i<NUM_ALLPASS; i++)
+        samps += self->allpass_nSamples[i] + 1;
+    return samps * sizeof(MYFLT);
+}
+
 static int
 Freeverb_traverse(Freeverb *self, visitproc visit, void *arg)
 {
@@ -638,6 +649,7 @@ Freeverb_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, Freeverb_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, Freeverb_memory);
     self->mode_func_ptr = Freeverb_setProcMode;
 
     static char *kwlist[] = {"input", "size", "damp", "mix", "mul", "add", NULL};
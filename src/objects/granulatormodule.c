@@ -50,14 +50,16 @@ typedef struct {
     MYFLT *gphase;
     MYFLT *lastppos;
     int modebuffer[5];
+    TableReadQueue queue;
 } Granulator;
 
 static void
 Granulator_transform_iii(Granulator *self) {
-    MYFLT val, x, x1, inc, index, fpart, amp, ppos;
+    MYFLT x, x1, inc, index, fpart, amp, ppos;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *envlist = TableStream_getData(self->env);
@@ -97,14 +99,14 @@ Granulator_transform_iii(Granulator *self) {
             if (index >= 0 && index < size) {
                 ipart = (int)index;
                 fpart = index - ipart;
-                x = tablelist[ipart];
-                x1 = tablelist[ipart+1];
-                val = x + (x1 - x) * fpart;
+                if (packed)
+                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                else {
+                    x = tablelist[ipart];
+                    x1 = tablelist[ipart+1];
+                    self->data[i] += (x + (x1 - x) * fpart) * amp;
+                }
             }
-            else
-                val = 0.0;
-
-            self->data[i] += (val * amp);
         }
 
         if (self->pointerPos < 0)
@@ -112,14 +114,18 @@ Granulator_transform_iii(Granulator *self) {
         else if (self->pointerPos >= 1)
             self->pointerPos -= 1.0;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, linear, self->data);
 }
 
 static void
 Granulator_transform_aii(Granulator *self) {
-    MYFLT val, x, x1, inc, index, fpart, amp, ppos, frtosamps;
+    MYFLT x, x1, inc, index, fpart, amp, ppos, frtosamps;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *envlist = TableStream_getData(self->env);
@@ -160,14 +166,14 @@ Granulator_transform_aii(Granulator *self) {
             if (index >= 0 && index < size) {
                 ipart = (int)index;
                 fpart = index - ipart;
-                x = tablelist[ipart];
-                x1 = tablelist[ipart+1];
-                val = x + (x1 - x) * fpart;
+                if (packed)
+                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                else {
+                    x = tablelist[ipart];
+                    x1 = tablelist[ipart+1];
+                    self->data[i] += (x + (x1 - x) * fpart) * amp;
+                }
             }
-            else
-                val = 0.0;
-
-            self->data[i] += (val * amp);
         }
 
         if (self->pointerPos < 0)
@@ -175,14 +181,18 @@ Granulator_transform_aii(Granulator *self) {
         else if (self->pointerPos >= 1)
             self->pointerPos -= 1.0;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, linear, self->data);
 }
 
 static void
 Granulator_transform_iai(Granulator *self) {
-    MYFLT val, x, x1, inc, index, fpart, amp, ppos;
+    MYFLT x, x1, inc, index, fpart, amp, ppos;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *envlist = TableStream_getData(self->env);
@@ -227,14 +237,14 @@ Granulator_transform_iai(Granulator *self) {
             if (index >= 0 && index < size) {
                 ipart = (int)index;
                 fpart = index - ipart;
-                x = tablelist[ipart];
-                x1 = tablelist[ipart+1];
-                val = x + (x1 - x) * fpart;
+                if (packed)
+                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                else {
+                    x = tablelist[ipart];
+                    x1 = tablelist[ipart+1];
+                    self->data[i] += (x + (x1 - x) * fpart) * amp;
+                }
             }
-            else
-                val = 0.0;
-
-            self->data[i] += (val * amp);
         }
 
         if (self->pointerPos < 0)
@@ -242,14 +252,18 @@ Granulator_transform_iai(Granulator *self) {
         else if (self->pointerPos >= 1)
             self->pointerPos -= 1.0;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, linear, self->data);
 }
 
 static void
 Granulator_transform_aai(Granulator *self) {
-    MYFLT val, x, x1, inc, index, fpart, amp, ppos, frtosamps;
+    MYFLT x, x1, inc, index, fpart, amp, ppos, frtosamps;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *envlist = TableStream_getData(self->env);
@@ -290,14 +304,14 @@ Granulator_transform_aai(Granulator *self) {
             if (index >= 0 && index < size) {
                 ipart = (int)index;
                 fpart = index - ipart;
-                x = tablelist[ipart];
-                x1 = tablelist[ipart+1];
-                val = x + (x1 - x) * fpart;
+                if (packed)
+                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                else {
+                    x = tablelist[ipart];
+                    x1 = tablelist[ipart+1];
+                    self->data[i] += (x + (x1 - x) * fpart) * amp;
+                }
             }
-            else
-                val = 0.0;
-
-            self->data[i] += (val * amp);
         }
 
         if (self->pointerPos < 0)
@@ -305,14 +319,18 @@ Granulator_transform_aai(Granulator *self) {
         else if (self->pointerPos >= 1)
             self->pointerPos -= 1.0;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, linear, self->data);
 }
 
 static void
 Granulator_transform_iia(Granulator *self) {
-    MYFLT val, x, x1, inc, index, fpart, amp, ppos;
+    MYFLT x, x1, inc, index, fpart, amp, ppos;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *envlist = TableStream_getData(self->env);
@@ -352,14 +370,14 @@ Granulator_transform_iia(Granulator *self) {
             if (index >= 0 && index < size) {
                 ipart = (int)index;
                 fpart = index - ipart;
-                x = tablelist[ipart];
-                x1 = tablelist[ipart+1];
-                val = x + (x1 - x) * fpart;
+                if (packed)
+                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                else {
+                    x = tablelist[ipart];
+                    x1 = tablelist[ipart+1];
+                    self->data[i] += (x + (x1 - x) * fpart) * amp;
+                }
             }
-            else
-                val = 0.0;
-
-            self->data[i] += (val * amp);
         }
 
         if (self->pointerPos < 0)
@@ -367,14 +385,18 @@ Granulator_transform_iia(Granulator *self) {
         else if (self->pointerPos >= 1)
             self->pointerPos -= 1.0;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, linear, self->data);
 }
 
 static void
 Granulator_transform_aia(Granulator *self) {
-    MYFLT val, x, x1, inc, index, fpart, amp, ppos, frtosamps;
+    MYFLT x, x1, inc, index, fpart, amp, ppos, frtosamps;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *envlist = TableStream_getData(self->env);
@@ -415,14 +437,14 @@ Granulator_transform_aia(Granulator *self) {
             if (index >= 0 && index < size) {
                 ipart = (int)index;
                 fpart = index - ipart;
-                x = tablelist[ipart];
-                x1 = tablelist[ipart+1];
-                val = x + (x1 - x) * fpart;
+                if (packed)
+                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                else {
+                    x = tablelist[ipart];
+                    x1 = tablelist[ipart+1];
+                    self->data[i] += (x + (x1 - x) * fpart) * amp;
+                }
             }
-            else
-                val = 0.0;
-
-            self->data[i] += (val * amp);
         }
 
         if (self->pointerPos < 0)
@@ -430,14 +452,18 @@ Granulator_transform_aia(Granulator *self) {
         else if (self->pointerPos >= 1)
             self->pointerPos -= 1.0;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, linear, self->data);
 }
 
 static void
 Granulator_transform_iaa(Granulator *self) {
-    MYFLT val, x, x1, inc, index, fpart, amp, ppos;
+    MYFLT x, x1, inc, index, fpart, amp, ppos;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *envlist = TableStream_getData(self->env);
@@ -477,14 +503,14 @@ Granulator_transform_iaa(Granulator *self) {
             if (index >= 0 && index < size) {
                 ipart = (int)index;
                 fpart = index - ipart;
-                x = tablelist[ipart];
-                x1 = tablelist[ipart+1];
-                val = x + (x1 - x) * fpart;
+                if (packed)
+                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                else {
+                    x = tablelist[ipart];
+                    x1 = tablelist[ipart+1];
+                    self->data[i] += (x + (x1 - x) * fpart) * amp;
+                }
             }
-            else
-                val = 0.0;
-
-            self->data[i] += (val * amp);
         }
 
         if (self->pointerPos < 0)
@@ -492,14 +518,18 @@ Granulator_transform_iaa(Granulator *self) {
         else if (self->pointerPos >= 1)
             self->pointerPos -= 1.0;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, linear, self->data);
 }
 
 static void
 Granulator_transform_aaa(Granulator *self) {
-    MYFLT val, x, x1, inc, index, fpart, amp, ppos, frtosamps;
+    MYFLT x, x1, inc, index, fpart, amp, ppos, frtosamps;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *envlist = TableStream_getData(self->env);
@@ -540,14 +570,14 @@ Granulator_transform_aaa(Granulator *self) {
             if (index >= 0 && index < size) {
                 ipart = (int)index;
                 fpart = index - ipart;
-                x = tablelist[ipart];
-                x1 = tablelist[ipart+1];
-                val = x + (x1 - x) * fpart;
+                if (packed)
+                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                else {
+                    x = tablelist[ipart];
+                    x1 = tablelist[ipart+1];
+                    self->data[i] += (x + (x1 - x) * fpart) * amp;
+                }
             }
-            else
-                val = 0.0;
-
-            self->data[i] += (val * amp);
         }
 
         if (self->pointerPos < 0)
@@ -555,6 +585,9 @@ Granulator_transform_aaa(Granulator *self) {
         else if (self->pointerPos >= 1)
             self->pointerPos -= 1.0;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, linear, self->data);
 }
 
 static void Granulator_postprocessing_ii(Granulator *self) { POST_PROCESSING_II };
@@ -672,6 +705,7 @@ static void
 Granulator_dealloc(Granulator* self)
 {
     pyo_DEALLOC
+    TableReadQueue_free(&self->queue);
     free(self->startPos);
     free(self->gphase);
     free(self->gsize);
@@ -715,7 +749,11 @@ Granulator_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         Py_RETURN_NONE;
     }
     Py_XDECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tabletmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tabletmp);
+    if (TableReadQueue_reserve(&self->queue, self->bufsize * self->ngrains) < 0) {
+        PyErr_NoMemory();
+        Py_RETURN_NONE;
+    }
 
     if ( PyObject_HasAttrString((PyObject *)envtmp, "getTableStream") == 0 ) {
         PyErr_SetString(PyExc_TypeError, "\"env\" argument of Granulator must be a PyoTableObject.\n");
@@ -910,7 +948,7 @@ Granulator_setTable(Granulator *self, PyObject *arg)
 
 	tmp = arg;
 	Py_DECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tmp);
 
 	Py_INCREF(Py_None);
 	return Py_None;
@@ -958,6 +996,8 @@ Granulator_setGrains(Granulator *self, PyObject *arg)
     MYFLT phase;
 	if (PyLong_Check(arg) || PyInt_Check(arg)) {
         self->ngrains = PyLong_AsLong(arg);
+        if (TableReadQueue_reserve(&self->queue, self->bufsize * self->ngrains) < 0)
+            return PyErr_NoMemory();
         self->startPos = (MYFLT *)realloc(self->startPos, self->ngrains * sizeof(MYFLT));
         self->gsize = (MYFLT *)realloc(self->gsize, self->ngrains * sizeof(MYFLT));
         self->gphase = (MYFLT *)realloc(self->gphase, self->ngrains * sizeof(MYFLT));
@@ -1135,6 +1175,7 @@ typedef struct {
     // variables
     MYFLT c1;
 
+    TableReadQueue queue;
 } Looper;
 
 static void
@@ -1283,8 +1324,10 @@ Looper_transform_i(Looper *self) {
     double pit;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
+
     double tableSr = TableStream_getSamplingRate(self->table);
 
     MYFLT pitval = PyFloat_AS_DOUBLE(self->pitch);
@@ -1316,7 +1359,10 @@ Looper_transform_i(Looper *self) {
                                 amp = 1.0;
                             ipart = (int)self->pointerPos[j];
                             fpart = self->pointerPos[j] - ipart;
-                            self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                            if (packed)
+                                TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                            else
+                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                         }
                         self->pointerPos[j] += pit;
                         if (self->pointerPos[j] < 0.0)
@@ -1340,7 +1386,10 @@ Looper_transform_i(Looper *self) {
                                 amp = 1.0;
                             ipart = (int)self->pointerPos[j];
                             fpart = self->pointerPos[j] - ipart;
-                            self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                            if (packed)
+                                TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                            else
+                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                         }
                         self->pointerPos[j] += pit;
                         if (self->pointerPos[j] < 0.0)
@@ -1364,7 +1413,10 @@ Looper_transform_i(Looper *self) {
                                 amp = 1.0;
                             ipart = (int)self->pointerPos[j];
                             fpart = self->pointerPos[j] - ipart;
-                            self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                            if (packed)
+                                TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                            else
+                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                         }
                         self->pointerPos[j] -= pit;
                         if (self->pointerPos[j] >= size)
@@ -1389,7 +1441,10 @@ Looper_transform_i(Looper *self) {
                                     amp = 1.0;
                                 ipart = (int)self->pointerPos[j];
                                 fpart = self->pointerPos[j] - ipart;
-                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                                if (packed)
+                                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                                else
+                                    self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                             }
                             self->pointerPos[j] += pit;
                             if (self->pointerPos[j] < 0.0)
@@ -1413,7 +1468,10 @@ Looper_transform_i(Looper *self) {
                                     amp = 1.0;
                                 ipart = (int)self->pointerPos[j];
                                 fpart = self->pointerPos[j] - ipart;
-                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                                if (packed)
+                                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                                else
+                                    self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                             }
                             self->pointerPos[j] -= pit;
                             if (self->pointerPos[j] >= size)
@@ -1429,6 +1487,9 @@ Looper_transform_i(Looper *self) {
         }
     }
 
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, self->interp_func_ptr, self->data);
+
     /* Automatic smoothering of low transposition */
     if (self->autosmooth == 1 && pitval < 1.0) {
         if (self->lastpitch != pitval) {
@@ -1452,8 +1513,10 @@ Looper_transform_a(Looper *self) {
     double pit, srFactor;
     int i, j, ipart;
 
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
+
     double tableSr = TableStream_getSamplingRate(self->table);
 
     MYFLT *pitch = Stream_getData((Stream *)self->pitch_stream);
@@ -1487,7 +1550,10 @@ Looper_transform_a(Looper *self) {
                                 amp = 1.0;
                             ipart = (int)self->pointerPos[j];
                             fpart = self->pointerPos[j] - ipart;
-                            self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                            if (packed)
+                                TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                            else
+                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                         }
                         self->pointerPos[j] += pit;
                         if (self->pointerPos[j] < 0.0)
@@ -1511,7 +1577,10 @@ Looper_transform_a(Looper *self) {
                                 amp = 1.0;
                             ipart = (int)self->pointerPos[j];
                             fpart = self->pointerPos[j] - ipart;
-                            self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                            if (packed)
+                                TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                            else
+                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                         }
                         self->pointerPos[j] += pit;
                         if (self->pointerPos[j] < 0.0)
@@ -1535,7 +1604,10 @@ Looper_transform_a(Looper *self) {
                                 amp = 1.0;
                             ipart = (int)self->pointerPos[j];
                             fpart = self->pointerPos[j] - ipart;
-                            self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                            if (packed)
+                                TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                            else
+                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                         }
                         self->pointerPos[j] -= pit;
                         if (self->pointerPos[j] >= size)
@@ -1560,7 +1632,10 @@ Looper_transform_a(Looper *self) {
                                     amp = 1.0;
                                 ipart = (int)self->pointerPos[j];
                                 fpart = self->pointerPos[j] - ipart;
-                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                                if (packed)
+                                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                                else
+                                    self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                             }
                             self->pointerPos[j] += pit;
                             if (self->pointerPos[j] < 0.0)
@@ -1584,7 +1659,10 @@ Looper_transform_a(Looper *self) {
                                     amp = 1.0;
                                 ipart = (int)self->pointerPos[j];
                                 fpart = self->pointerPos[j] - ipart;
-                                self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
+                                if (packed)
+                                    TableReadQueue_push(&self->queue, ipart, fpart, amp, i);
+                                else
+                                    self->data[i] += (*self->interp_func_ptr)(tablelist, ipart, fpart, size) * amp;
                             }
                             self->pointerPos[j] -= pit;
                             if (self->pointerPos[j] >= size)
@@ -1600,6 +1678,9 @@ Looper_transform_a(Looper *self) {
         }
     }
 
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, self->interp_func_ptr, self->data);
+
     /* Automatic smoothering of low transposition */
     if (self->autosmooth == 1) {
         for (i=0; i<self->bufsize; i++) {
@@ -1719,6 +1800,7 @@ static void
 Looper_dealloc(Looper* self)
 {
     pyo_DEALLOC
+    TableReadQueue_free(&self->queue);
     Looper_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -1766,7 +1848,11 @@ Looper_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         Py_RETURN_NONE;
     }
     Py_XDECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tabletmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tabletmp);
+    if (TableReadQueue_reserve(&self->queue, self->bufsize * 2) < 0) {
+        PyErr_NoMemory();
+        Py_RETURN_NONE;
+    }
 
     if (pitchtmp) {
         PyObject_CallMethod((PyObject *)self, "setPitch", "O", pitchtmp);
@@ -1975,7 +2061,7 @@ Looper_setTable(Looper *self, PyObject *arg)
 
 	tmp = arg;
 	Py_DECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tmp);
 
 	Py_INCREF(Py_None);
 	return Py_None;
@@ -390,6 +390,11 @@ Harmonizer_compute_next_data_frame(Harmonizer *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+Harmonizer_memory(Harmonizer *self) {
+    return ((long)self->sr + 1) * sizeof(MYFLT);
+}
+
 static int
 Harmonizer_traverse(Harmonizer *self, visitproc visit, void *arg)
 {
@@ -446,6 +451,7 @@ Harmonizer_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, Harmonizer_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, Harmonizer_memory);
     self->mode_func_ptr = Harmonizer_setProcMode;
 
     static char *kwlist[] = {"input", "transpo", "feedback", "winsize", "mul", "add", NULL};
@@ -702,3 +708,703 @@ PyTypeObject HarmonizerType = {
     0,                         /* tp_alloc */
     Harmonizer_new,                 /* tp_new */
 };
+
+/************************************************************************************************/
+/* MultiHarmonizerMain object. Multichannel harmonizer sharing the window computations. */
+/************************************************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream **input_streams;
+    int inputSize;
+    PyObject *transpo;
+    Stream *transpo_stream;
+    PyObject *feedback;
+    Stream *feedback_stream;
+    MYFLT winsize;
+	MYFLT pointerPos;
+    int in_count;
+    MYFLT *buffer; /* interleaved frames, one sample per channel */
+    MYFLT *input_buffer; /* interleaved input block */
+    MYFLT *buffer_streams;
+    MYFLT *param_buffer; /* increment and feedback values of the current block */
+    int modebuffer[2];
+} MultiHarmonizerMain;
+
+static void
+MultiHarmonizerMain_transform(MultiHarmonizerMain *self) {
+    MYFLT val, amp1, amp2, ratio, del, xind, pos, envpos, fpart1, fpart2, feed;
+    MYFLT *in, *rd1, *rd2, *wr, *frame;
+    int i, k, ipart, size, nchnls = self->inputSize;
+    MYFLT *inc = self->param_buffer;
+    MYFLT *fdb = self->param_buffer + self->bufsize;
+
+    size = (int)self->sr;
+	MYFLT oneOnWinsize = 1.0 / self->winsize;
+	MYFLT oneOnSr = 1.0 / self->sr;
+    if (self->modebuffer[0] == 0) {
+        ratio = MYPOW(2.0, PyFloat_AS_DOUBLE(self->transpo)/12.0);
+        val = -(ratio-1.0) / self->winsize / self->sr;
+        for (i=0; i<self->bufsize; i++)
+            inc[i] = val;
+    }
+    else {
+        in = Stream_getData((Stream *)self->transpo_stream);
+        for (i=0; i<self->bufsize; i++) {
+            ratio = MYPOW(2.0, in[i]/12.0);
+            inc[i] = -(ratio-1.0) * oneOnWinsize * oneOnSr;
+        }
+    }
+    if (self->modebuffer[1] == 0) {
+        val = PyFloat_AS_DOUBLE(self->feedback);
+        for (i=0; i<self->bufsize; i++)
+            fdb[i] = val;
+    }
+    else {
+        in = Stream_getData((Stream *)self->feedback_stream);
+        for (i=0; i<self->bufsize; i++)
+            fdb[i] = in[i];
+    }
+
+    for (k=0; k<nchnls; k++) {
+        in = Stream_getData(self->input_streams[k]);
+        for (i=0; i<self->bufsize; i++) {
+            self->input_buffer[i*nchnls+k] = in[i];
+        }
+    }
+
+    for (i=0; i<self->bufsize; i++) {
+        frame = self->input_buffer + i * nchnls;
+        feed = fdb[i];
+        if (feed < 0.0)
+            feed = 0.0;
+        else if (feed > 1.0)
+            feed = 1.0;
+
+        /* Envelopes and read positions of both overlaps are shared by all channels. */
+		pos = self->pointerPos;
+		envpos = pos * 8192.0;
+		ipart = (int)envpos;
+		fpart1 = envpos - ipart;
+		amp1 = ENVELOPE[ipart] + (ENVELOPE[ipart+1] - ENVELOPE[ipart]) * fpart1;
+		del = pos * self->winsize;
+        xind = self->in_count - (del * self->sr);
+        if (xind < 0)
+            xind += self->sr;
+        ipart = (int)xind;
+        fpart1 = xind - ipart;
+        rd1 = self->buffer + ipart * nchnls;
+
+		pos = self->pointerPos + 0.5;
+        if (pos >= 1)
+            pos -= 1.0;
+		envpos = pos * 8192.0;
+		ipart = (int)envpos;
+		fpart2 = envpos - ipart;
+		amp2 = ENVELOPE[ipart] + (ENVELOPE[ipart+1] - ENVELOPE[ipart]) * fpart2;
+		del = pos * self->winsize;
+        xind = self->in_count - (del * self->sr);
+        if (xind < 0)
+            xind += self->sr;
+        ipart = (int)xind;
+        fpart2 = xind - ipart;
+        rd2 = self->buffer + ipart * nchnls;
+
+        wr = self->buffer + self->in_count * nchnls;
+        for (k=0; k<nchnls; k++) {
+            val = (rd1[k] + (rd1[k+nchnls] - rd1[k]) * fpart1) * amp1;
+            val += (rd2[k] + (rd2[k+nchnls] - rd2[k]) * fpart2) * amp2;
+            self->buffer_streams[i+k*self->bufsize] = val;
+            wr[k] = frame[k] + val * feed;
+        }
+
+        self->pointerPos += inc[i];
+        if (self->pointerPos < 0.0)
+            self->pointerPos += 1.0;
+        else if (self->pointerPos >= 1.0)
+            self->pointerPos -= 1.0;
+
+        if (self->in_count == 0) {
+            for (k=0; k<nchnls; k++)
+                self->buffer[size*nchnls+k] = wr[k];
+        }
+        self->in_count++;
+        if (self->in_count >= size)
+            self->in_count = 0;
+    }
+}
+
+MYFLT *
+MultiHarmonizerMain_getSamplesBuffer(MultiHarmonizerMain *self)
+{
+    return (MYFLT *)self->buffer_streams;
+}
+
+static void
+MultiHarmonizerMain_setProcMode(MultiHarmonizerMain *self)
+{
+    self->proc_func_ptr = MultiHarmonizerMain_transform;
+}
+
+static void
+MultiHarmonizerMain_compute_next_data_frame(MultiHarmonizerMain *self)
+{
+    (*self->proc_func_ptr)(self);
+}
+
+static long
+MultiHarmonizerMain_memory(MultiHarmonizerMain *self) {
+    return ((((long)self->sr + 1) + 2 * self->bufsize) * self->inputSize + 2 * self->bufsize) * sizeof(MYFLT);
+}
+
+static int
+MultiHarmonizerMain_traverse(MultiHarmonizerMain *self, visitproc visit, void *arg)
+{
+    int i;
+    pyo_VISIT
+    Py_VISIT(self->input);
+    for (i=0; i<self->inputSize; i++) {
+        Py_VISIT(self->input_streams[i]);
+    }
+    Py_VISIT(self->transpo);
+    Py_VISIT(self->transpo_stream);
+    Py_VISIT(self->feedback);
+    Py_VISIT(self->feedback_stream);
+    return 0;
+}
+
+static int
+MultiHarmonizerMain_clear(MultiHarmonizerMain *self)
+{
+    int i;
+    pyo_CLEAR
+    Py_CLEAR(self->input);
+    for (i=0; i<self->inputSize; i++) {
+        Py_CLEAR(self->input_streams[i]);
+    }
+    Py_CLEAR(self->transpo);
+    Py_CLEAR(self->transpo_stream);
+    Py_CLEAR(self->feedback);
+    Py_CLEAR(self->feedback_stream);
+    return 0;
+}
+
+static void
+MultiHarmonizerMain_dealloc(MultiHarmonizerMain* self)
+{
+    pyo_DEALLOC
+    free(self->buffer);
+    free(self->input_buffer);
+    free(self->buffer_streams);
+    free(self->param_buffer);
+    MultiHarmonizerMain_clear(self);
+    free(self->input_streams);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+MultiHarmonizerMain_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    MYFLT wintmp = 0.1;
+    PyObject *inputtmp, *transpotmp=NULL, *feedbacktmp=NULL;
+    MultiHarmonizerMain *self;
+    self = (MultiHarmonizerMain *)type->tp_alloc(type, 0);
+
+    self->transpo = PyFloat_FromDouble(-7.0);
+    self->feedback = PyFloat_FromDouble(0.0);
+    self->winsize = 0.1;
+    self->pointerPos = 1.0;
+	self->in_count = 0;
+    self->inputSize = 0;
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, MultiHarmonizerMain_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, MultiHarmonizerMain_memory);
+    self->mode_func_ptr = MultiHarmonizerMain_setProcMode;
+
+    self->param_buffer = (MYFLT *)realloc(self->param_buffer, 2 * self->bufsize * sizeof(MYFLT));
+
+    static char *kwlist[] = {"input", "transpo", "feedback", "winsize", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, TYPE_O_OOF, kwlist, &inputtmp, &transpotmp, &feedbacktmp, &wintmp))
+        Py_RETURN_NONE;
+
+    if (inputtmp) {
+        PyObject_CallMethod((PyObject *)self, "setInput", "O", inputtmp);
+    }
+
+    if (transpotmp) {
+        PyObject_CallMethod((PyObject *)self, "setTranspo", "O", transpotmp);
+    }
+
+    if (feedbacktmp) {
+        PyObject_CallMethod((PyObject *)self, "setFeedback", "O", feedbacktmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    if (wintmp > 0.0 && wintmp <= 1.0)
+        self->winsize = wintmp;
+    else
+        printf("MultiHarmonizer : winsize lower than 0.0 or larger than 1.0 second, keeping default value.\n");
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * MultiHarmonizerMain_getServer(MultiHarmonizerMain* self) { GET_SERVER };
+static PyObject * MultiHarmonizerMain_getStream(MultiHarmonizerMain* self) { GET_STREAM };
+
+static PyObject * MultiHarmonizerMain_play(MultiHarmonizerMain *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * MultiHarmonizerMain_stop(MultiHarmonizerMain *self) { STOP };
+
+static PyObject *
+MultiHarmonizerMain_setInput(MultiHarmonizerMain *self, PyObject *arg)
+{
+    int i, nchnls;
+    PyObject *tmp, *streamtmp;
+
+    if (! PyList_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "The inputs attribute must be a list.");
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    tmp = arg;
+    nchnls = PyList_Size(tmp);
+    Py_INCREF(tmp);
+    Py_XDECREF(self->input);
+    self->input = tmp;
+
+    for (i=0; i<self->inputSize; i++) {
+        Py_XDECREF(self->input_streams[i]);
+    }
+    self->input_streams = (Stream **)realloc(self->input_streams, nchnls * sizeof(Stream *));
+    for (i=0; i<nchnls; i++) {
+        streamtmp = PyObject_CallMethod((PyObject *)PyList_GET_ITEM(self->input, i), "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        self->input_streams[i] = (Stream *)streamtmp;
+    }
+
+    if (nchnls != self->inputSize) {
+        self->inputSize = nchnls;
+        self->in_count = 0;
+        self->buffer = (MYFLT *)realloc(self->buffer, ((int)self->sr+1) * nchnls * sizeof(MYFLT));
+        for (i=0; i<(((int)self->sr+1)*nchnls); i++) {
+            self->buffer[i] = 0.;
+        }
+        self->input_buffer = (MYFLT *)realloc(self->input_buffer, self->bufsize * nchnls * sizeof(MYFLT));
+        self->buffer_streams = (MYFLT *)realloc(self->buffer_streams, self->bufsize * nchnls * sizeof(MYFLT));
+        for (i=0; i<(self->bufsize*nchnls); i++) {
+            self->buffer_streams[i] = 0.0;
+        }
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+MultiHarmonizerMain_setTranspo(MultiHarmonizerMain *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->transpo);
+	if (isNumber == 1) {
+		self->transpo = PyNumber_Float(tmp);
+        self->modebuffer[0] = 0;
+	}
+	else {
+		self->transpo = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->transpo, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->transpo_stream);
+        self->transpo_stream = (Stream *)streamtmp;
+		self->modebuffer[0] = 1;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+MultiHarmonizerMain_setFeedback(MultiHarmonizerMain *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->feedback);
+	if (isNumber == 1) {
+		self->feedback = PyNumber_Float(tmp);
+        self->modebuffer[1] = 0;
+	}
+	else {
+		self->feedback = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->feedback, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->feedback_stream);
+        self->feedback_stream = (Stream *)streamtmp;
+		self->modebuffer[1] = 1;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+MultiHarmonizerMain_setWinsize(MultiHarmonizerMain *self, PyObject *arg)
+{
+	MYFLT wintmp;
+	if (arg != NULL) {
+        wintmp = PyFloat_AS_DOUBLE(PyNumber_Float(arg));
+        if (wintmp > 0.0 && wintmp <= 1.0)
+			self->winsize = wintmp;
+        else
+            printf("winsize lower than 0.0 or larger than 1.0 second!\n");
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyMemberDef MultiHarmonizerMain_members[] = {
+    {"server", T_OBJECT_EX, offsetof(MultiHarmonizerMain, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(MultiHarmonizerMain, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(MultiHarmonizerMain, input), 0, "List of input sound objects."},
+    {"transpo", T_OBJECT_EX, offsetof(MultiHarmonizerMain, transpo), 0, "Transposition factor."},
+    {"feedback", T_OBJECT_EX, offsetof(MultiHarmonizerMain, feedback), 0, "Feedback factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef MultiHarmonizerMain_methods[] = {
+    {"getServer", (PyCFunction)MultiHarmonizerMain_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)MultiHarmonizerMain_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)MultiHarmonizerMain_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"stop", (PyCFunction)MultiHarmonizerMain_stop, METH_NOARGS, "Stops computing."},
+    {"setInput", (PyCFunction)MultiHarmonizerMain_setInput, METH_O, "Sets list of input streams."},
+    {"setTranspo", (PyCFunction)MultiHarmonizerMain_setTranspo, METH_O, "Sets global transpo factor."},
+    {"setFeedback", (PyCFunction)MultiHarmonizerMain_setFeedback, METH_O, "Sets feedback factor."},
+    {"setWinsize", (PyCFunction)MultiHarmonizerMain_setWinsize, METH_O, "Sets the window size."},
+    {NULL}  /* Sentinel */
+};
+
+PyTypeObject MultiHarmonizerMainType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.MultiHarmonizerMain_base",         /*tp_name*/
+    sizeof(MultiHarmonizerMain),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)MultiHarmonizerMain_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    0,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "MultiHarmonizerMain objects. Harmonizer over an interleaved multichannel buffer.",           /* tp_doc */
+    (traverseproc)MultiHarmonizerMain_traverse,   /* tp_traverse */
+    (inquiry)MultiHarmonizerMain_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    MultiHarmonizerMain_methods,             /* tp_methods */
+    MultiHarmonizerMain_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    MultiHarmonizerMain_new,                 /* tp_new */
+};
+
+/************************************************************************************************/
+/* MultiHarmonizer streamer object */
+/************************************************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    MultiHarmonizerMain *mainSplitter;
+    int modebuffer[2];
+    int chnl;
+} MultiHarmonizer;
+
+static void MultiHarmonizer_postprocessing_ii(MultiHarmonizer *self) { POST_PROCESSING_II };
+static void MultiHarmonizer_postprocessing_ai(MultiHarmonizer *self) { POST_PROCESSING_AI };
+static void MultiHarmonizer_postprocessing_ia(MultiHarmonizer *self) { POST_PROCESSING_IA };
+static void MultiHarmonizer_postprocessing_aa(MultiHarmonizer *self) { POST_PROCESSING_AA };
+static void MultiHarmonizer_postprocessing_ireva(MultiHarmonizer *self) { POST_PROCESSING_IREVA };
+static void MultiHarmonizer_postprocessing_areva(MultiHarmonizer *self) { POST_PROCESSING_AREVA };
+static void MultiHarmonizer_postprocessing_revai(MultiHarmonizer *self) { POST_PROCESSING_REVAI };
+static void MultiHarmonizer_postprocessing_revaa(MultiHarmonizer *self) { POST_PROCESSING_REVAA };
+static void MultiHarmonizer_postprocessing_revareva(MultiHarmonizer *self) { POST_PROCESSING_REVAREVA };
+
+static void
+MultiHarmonizer_setProcMode(MultiHarmonizer *self)
+{
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+	switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = MultiHarmonizer_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = MultiHarmonizer_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = MultiHarmonizer_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = MultiHarmonizer_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = MultiHarmonizer_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = MultiHarmonizer_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = MultiHarmonizer_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = MultiHarmonizer_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = MultiHarmonizer_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+MultiHarmonizer_compute_next_data_frame(MultiHarmonizer *self)
+{
+    int i;
+    MYFLT *tmp;
+    int offset = self->chnl * self->bufsize;
+    tmp = MultiHarmonizerMain_getSamplesBuffer((MultiHarmonizerMain *)self->mainSplitter);
+    for (i=0; i<self->bufsize; i++) {
+        self->data[i] = tmp[i + offset];
+    }
+    (*self->muladd_func_ptr)(self);
+}
+
+static int
+MultiHarmonizer_traverse(MultiHarmonizer *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->mainSplitter);
+    return 0;
+}
+
+static int
+MultiHarmonizer_clear(MultiHarmonizer *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->mainSplitter);
+    return 0;
+}
+
+static void
+MultiHarmonizer_dealloc(MultiHarmonizer* self)
+{
+    pyo_DEALLOC
+    MultiHarmonizer_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+MultiHarmonizer_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *maintmp=NULL, *multmp=NULL, *addtmp=NULL;
+    MultiHarmonizer *self;
+    self = (MultiHarmonizer *)type->tp_alloc(type, 0);
+
+    self->modebuffer[0] = 0;
+    self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, MultiHarmonizer_compute_next_data_frame);
+    self->mode_func_ptr = MultiHarmonizer_setProcMode;
+
+    static char *kwlist[] = {"mainSplitter", "chnl", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "Oi|OO", kwlist, &maintmp, &self->chnl, &multmp, &addtmp))
+        Py_RETURN_NONE;
+
+    Py_XDECREF(self->mainSplitter);
+    Py_INCREF(maintmp);
+    self->mainSplitter = (MultiHarmonizerMain *)maintmp;
+
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
+
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * MultiHarmonizer_getServer(MultiHarmonizer* self) { GET_SERVER };
+static PyObject * MultiHarmonizer_getStream(MultiHarmonizer* self) { GET_STREAM };
+static PyObject * MultiHarmonizer_setMul(MultiHarmonizer *self, PyObject *arg) { SET_MUL };
+static PyObject * MultiHarmonizer_setAdd(MultiHarmonizer *self, PyObject *arg) { SET_ADD };
+static PyObject * MultiHarmonizer_setSub(MultiHarmonizer *self, PyObject *arg) { SET_SUB };
+static PyObject * MultiHarmonizer_setDiv(MultiHarmonizer *self, PyObject *arg) { SET_DIV };
+
+static PyObject * MultiHarmonizer_play(MultiHarmonizer *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * MultiHarmonizer_out(MultiHarmonizer *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * MultiHarmonizer_stop(MultiHarmonizer *self) { STOP };
+
+static PyObject * MultiHarmonizer_multiply(MultiHarmonizer *self, PyObject *arg) { MULTIPLY };
+static PyObject * MultiHarmonizer_inplace_multiply(MultiHarmonizer *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * MultiHarmonizer_add(MultiHarmonizer *self, PyObject *arg) { ADD };
+static PyObject * MultiHarmonizer_inplace_add(MultiHarmonizer *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * MultiHarmonizer_sub(MultiHarmonizer *self, PyObject *arg) { SUB };
+static PyObject * MultiHarmonizer_inplace_sub(MultiHarmonizer *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * MultiHarmonizer_div(MultiHarmonizer *self, PyObject *arg) { DIV };
+static PyObject * MultiHarmonizer_inplace_div(MultiHarmonizer *self, PyObject *arg) { INPLACE_DIV };
+
+static PyMemberDef MultiHarmonizer_members[] = {
+    {"server", T_OBJECT_EX, offsetof(MultiHarmonizer, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(MultiHarmonizer, stream), 0, "Stream object."},
+    {"mul", T_OBJECT_EX, offsetof(MultiHarmonizer, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(MultiHarmonizer, add), 0, "Add factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef MultiHarmonizer_methods[] = {
+    {"getServer", (PyCFunction)MultiHarmonizer_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)MultiHarmonizer_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)MultiHarmonizer_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)MultiHarmonizer_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)MultiHarmonizer_stop, METH_NOARGS, "Stops computing."},
+    {"setMul", (PyCFunction)MultiHarmonizer_setMul, METH_O, "Sets MultiHarmonizer mul factor."},
+    {"setAdd", (PyCFunction)MultiHarmonizer_setAdd, METH_O, "Sets MultiHarmonizer add factor."},
+    {"setSub", (PyCFunction)MultiHarmonizer_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)MultiHarmonizer_setDiv, METH_O, "Sets inverse mul factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyNumberMethods MultiHarmonizer_as_number = {
+    (binaryfunc)MultiHarmonizer_add,                      /*nb_add*/
+    (binaryfunc)MultiHarmonizer_sub,                 /*nb_subtract*/
+    (binaryfunc)MultiHarmonizer_multiply,                 /*nb_multiply*/
+    (binaryfunc)MultiHarmonizer_div,                   /*nb_divide*/
+    0,                /*nb_remainder*/
+    0,                   /*nb_divmod*/
+    0,                   /*nb_power*/
+    0,                  /*nb_neg*/
+    0,                /*nb_pos*/
+    0,                  /*(unaryfunc)array_abs,*/
+    0,                    /*nb_nonzero*/
+    0,                    /*nb_invert*/
+    0,               /*nb_lshift*/
+    0,              /*nb_rshift*/
+    0,              /*nb_and*/
+    0,              /*nb_xor*/
+    0,               /*nb_or*/
+    0,                                          /*nb_coerce*/
+    0,                       /*nb_int*/
+    0,                      /*nb_long*/
+    0,                     /*nb_float*/
+    0,                       /*nb_oct*/
+    0,                       /*nb_hex*/
+    (binaryfunc)MultiHarmonizer_inplace_add,              /*inplace_add*/
+    (binaryfunc)MultiHarmonizer_inplace_sub,         /*inplace_subtract*/
+    (binaryfunc)MultiHarmonizer_inplace_multiply,         /*inplace_multiply*/
+    (binaryfunc)MultiHarmonizer_inplace_div,           /*inplace_divide*/
+    0,        /*inplace_remainder*/
+    0,           /*inplace_power*/
+    0,       /*inplace_lshift*/
+    0,      /*inplace_rshift*/
+    0,      /*inplace_and*/
+    0,      /*inplace_xor*/
+    0,       /*inplace_or*/
+    0,             /*nb_floor_divide*/
+    0,              /*nb_true_divide*/
+    0,     /*nb_inplace_floor_divide*/
+    0,      /*nb_inplace_true_divide*/
+    0,                     /* nb_index */
+};
+
+PyTypeObject MultiHarmonizerType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.MultiHarmonizer_base",         /*tp_name*/
+    sizeof(MultiHarmonizer),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)MultiHarmonizer_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    &MultiHarmonizer_as_number,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "MultiHarmonizer objects. Reads one channel from a MultiHarmonizerMain object.",           /* tp_doc */
+    (traverseproc)MultiHarmonizer_traverse,   /* tp_traverse */
+    (inquiry)MultiHarmonizer_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    MultiHarmonizer_methods,             /* tp_methods */
+    MultiHarmonizer_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    MultiHarmonizer_new,                 /* tp_new */
+};
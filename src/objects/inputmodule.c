@@ -273,3 +273,273 @@ PyTypeObject InputType = {
     0,                         /* tp_alloc */
     Input_new,                 /* tp_new */
 };
+
+typedef struct {
+    pyo_audio_HEAD
+    int bus;
+    int modebuffer[2];
+} BusIn;
+
+static void BusIn_postprocessing_ii(BusIn *self) { POST_PROCESSING_II };
+static void BusIn_postprocessing_ai(BusIn *self) { POST_PROCESSING_AI };
+static void BusIn_postprocessing_ia(BusIn *self) { POST_PROCESSING_IA };
+static void BusIn_postprocessing_aa(BusIn *self) { POST_PROCESSING_AA };
+static void BusIn_postprocessing_ireva(BusIn *self) { POST_PROCESSING_IREVA };
+static void BusIn_postprocessing_areva(BusIn *self) { POST_PROCESSING_AREVA };
+static void BusIn_postprocessing_revai(BusIn *self) { POST_PROCESSING_REVAI };
+static void BusIn_postprocessing_revaa(BusIn *self) { POST_PROCESSING_REVAA };
+static void BusIn_postprocessing_revareva(BusIn *self) { POST_PROCESSING_REVAREVA };
+
+static void
+BusIn_setProcMode(BusIn *self)
+{
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+	switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = BusIn_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = BusIn_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = BusIn_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = BusIn_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = BusIn_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = BusIn_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = BusIn_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = BusIn_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = BusIn_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+BusIn_compute_next_data_frame(BusIn *self)
+{
+    int i;
+    MYFLT *tmp;
+    tmp = Server_getBusBuffer((Server *)self->server, self->bus);
+    if (tmp == NULL) {
+        for (i=0; i<self->bufsize; i++)
+            self->data[i] = 0.0;
+    }
+    else {
+        for (i=0; i<self->bufsize; i++)
+            self->data[i] = tmp[i];
+    }
+    (*self->muladd_func_ptr)(self);
+}
+
+static int
+BusIn_traverse(BusIn *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    return 0;
+}
+
+static int
+BusIn_clear(BusIn *self)
+{
+    pyo_CLEAR
+    return 0;
+}
+
+static void
+BusIn_dealloc(BusIn* self)
+{
+    pyo_DEALLOC
+    BusIn_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+BusIn_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *multmp=NULL, *addtmp=NULL;
+    BusIn *self;
+    self = (BusIn *)type->tp_alloc(type, 0);
+
+    self->bus = 0;
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, BusIn_compute_next_data_frame);
+    self->mode_func_ptr = BusIn_setProcMode;
+
+    static char *kwlist[] = {"bus", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "|iOO", kwlist, &self->bus, &multmp, &addtmp))
+        Py_RETURN_NONE;
+
+    if (self->bufsize != ((Server *)self->server)->bufferSize) {
+        PyErr_SetString(PyExc_RuntimeError, "BusIn can't be created inside a Domain.");
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
+
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * BusIn_getServer(BusIn* self) { GET_SERVER };
+static PyObject * BusIn_getStream(BusIn* self) { GET_STREAM };
+static PyObject * BusIn_setMul(BusIn *self, PyObject *arg) { SET_MUL };
+static PyObject * BusIn_setAdd(BusIn *self, PyObject *arg) { SET_ADD };
+static PyObject * BusIn_setSub(BusIn *self, PyObject *arg) { SET_SUB };
+static PyObject * BusIn_setDiv(BusIn *self, PyObject *arg) { SET_DIV };
+
+static PyObject *
+BusIn_setBus(BusIn *self, PyObject *arg)
+{
+    if (PyInt_Check(arg))
+        self->bus = PyInt_AsLong(arg);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject * BusIn_play(BusIn *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * BusIn_out(BusIn *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * BusIn_stop(BusIn *self) { STOP };
+
+static PyObject * BusIn_multiply(BusIn *self, PyObject *arg) { MULTIPLY };
+static PyObject * BusIn_inplace_multiply(BusIn *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * BusIn_add(BusIn *self, PyObject *arg) { ADD };
+static PyObject * BusIn_inplace_add(BusIn *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * BusIn_sub(BusIn *self, PyObject *arg) { SUB };
+static PyObject * BusIn_inplace_sub(BusIn *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * BusIn_div(BusIn *self, PyObject *arg) { DIV };
+static PyObject * BusIn_inplace_div(BusIn *self, PyObject *arg) { INPLACE_DIV };
+
+static PyMemberDef BusIn_members[] = {
+    {"server", T_OBJECT_EX, offsetof(BusIn, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(BusIn, stream), 0, "Stream object."},
+    {"mul", T_OBJECT_EX, offsetof(BusIn, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(BusIn, add), 0, "Add factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef BusIn_methods[] = {
+    {"getServer", (PyCFunction)BusIn_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)BusIn_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)BusIn_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)BusIn_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)BusIn_stop, METH_NOARGS, "Stops computing."},
+    {"setBus", (PyCFunction)BusIn_setBus, METH_O, "Sets the bus to read from."},
+	{"setMul", (PyCFunction)BusIn_setMul, METH_O, "Sets oscillator mul factor."},
+	{"setAdd", (PyCFunction)BusIn_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)BusIn_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)BusIn_setDiv, METH_O, "Sets inverse mul factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyNumberMethods BusIn_as_number = {
+    (binaryfunc)BusIn_add,                      /*nb_add*/
+    (binaryfunc)BusIn_sub,                 /*nb_subtract*/
+    (binaryfunc)BusIn_multiply,                 /*nb_multiply*/
+    (binaryfunc)BusIn_div,                   /*nb_divide*/
+    0,                /*nb_remainder*/
+    0,                   /*nb_divmod*/
+    0,                   /*nb_power*/
+    0,                  /*nb_neg*/
+    0,                /*nb_pos*/
+    0,                  /*(unaryfunc)array_abs,*/
+    0,                    /*nb_nonzero*/
+    0,                    /*nb_invert*/
+    0,               /*nb_lshift*/
+    0,              /*nb_rshift*/
+    0,              /*nb_and*/
+    0,              /*nb_xor*/
+    0,               /*nb_or*/
+    0,                                          /*nb_coerce*/
+    0,                       /*nb_int*/
+    0,                      /*nb_long*/
+    0,                     /*nb_float*/
+    0,                       /*nb_oct*/
+    0,                       /*nb_hex*/
+    (binaryfunc)BusIn_inplace_add,              /*inplace_add*/
+    (binaryfunc)BusIn_inplace_sub,         /*inplace_subtract*/
+    (binaryfunc)BusIn_inplace_multiply,         /*inplace_multiply*/
+    (binaryfunc)BusIn_inplace_div,           /*inplace_divide*/
+    0,        /*inplace_remainder*/
+    0,           /*inplace_power*/
+    0,       /*inplace_lshift*/
+    0,      /*inplace_rshift*/
+    0,      /*inplace_and*/
+    0,      /*inplace_xor*/
+    0,       /*inplace_or*/
+    0,             /*nb_floor_divide*/
+    0,              /*nb_true_divide*/
+    0,     /*nb_inplace_floor_divide*/
+    0,      /*nb_inplace_true_divide*/
+    0,                     /* nb_index */
+};
+
+PyTypeObject BusInType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.BusIn_base",         /*tp_name*/
+    sizeof(BusIn),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)BusIn_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    &BusIn_as_number,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "BusIn objects. Reads the sum of the sends to an aux bus.",           /* tp_doc */
+    (traverseproc)BusIn_traverse,   /* tp_traverse */
+    (inquiry)BusIn_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    BusIn_methods,             /* tp_methods */
+    BusIn_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    BusIn_new,                 /* tp_new */
+};
@@ -121,6 +121,19 @@ MatrixStream_setHeight(MatrixStream *self, int size)
     self->height = size;
 }
 
+/* Bytes held by the rows, NewMatrix allocates height + 1 rows of width + 1 points. */
+static PyObject *
+MatrixStream_memory(MatrixStream *self)
+{
+    long bytes = sizeof(MatrixStream) + (self->height + 1) * (sizeof(MYFLT *) + (self->width + 1) * sizeof(MYFLT));
+    return PyInt_FromLong(bytes);
+}
+
+static PyMethodDef MatrixStream_methods[] = {
+{"getMemory", (PyCFunction)MatrixStream_memory, METH_NOARGS, "Returns the native memory, in bytes, used by the points."},
+{NULL}  /* Sentinel */
+};
+
 PyTypeObject MatrixStreamType = {
 PyObject_HEAD_INIT(NULL)
 0, /*ob_size*/
@@ -150,7 +163,7 @@ Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
 0, /* tp_weaklistoffset */
 0, /* tp_iter */
 0, /* tp_iternext */
-0, /* tp_methods */
+MatrixStream_methods, /* tp_methods */
 0, /* tp_members */
 0, /* tp_getset */
 0, /* tp_base */
@@ -5333,4 +5333,756 @@ PyTypeObject TrigBurstEndStreamType = {
     0,      /* tp_init */
     0,                         /* tp_alloc */
     TrigBurstEndStream_new,                 /* tp_new */
-};
\ No newline at end of file
+};
+/****************/
+/** StepSeqer ***/
+/****************/
+/* Multi-track step sequencer. Each track holds a list of steps of
+** STEPSEQ_FIELDS values (note, velocity, probability, offset) followed by
+** nparams free values. Every track is evaluated, sample by sample, in the
+** main object; the StepSeq streams only copy one output of one track.
+** Outputs of a track: trigger, note, velocity, step index, then the params.
+** Trigger buffers are cleared only where the previous triggers were
+** written and held values are refilled only when they changed. */
+#define STEPSEQ_FIELDS 4
+#define STEPSEQ_HELD_OUTPUTS 3 /* note, velocity, step index */
+
+typedef struct {
+    int length;
+    MYFLT *steps; /* length * width values */
+} StepSeqPattern;
+
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *time;
+    Stream *time_stream;
+    int modebuffer[1];
+    int tracks;
+    int nparams;
+    int width; /* STEPSEQ_FIELDS + nparams */
+    int outputs; /* 1 + STEPSEQ_HELD_OUTPUTS + nparams */
+    StepSeqPattern *patterns;
+    StepSeqPattern *pending; /* swapped in when the track wraps around */
+    StepSeqPattern *retired; /* swapped out in the audio thread, freed later */
+    int *current;
+    int *fired;
+    double *elapsed; /* in samples, to keep the steps sample-accurate */
+    MYFLT *values; /* held values, tracks * (outputs - 1) */
+    int *numtrigs;
+    int *trigpos; /* tracks * bufsize */
+    int *flat;
+    MYFLT *buffer; /* outputs * tracks * bufsize */
+} StepSeqer;
+
+static void
+StepSeqer_freePattern(StepSeqPattern *pattern)
+{
+    if (pattern->steps != NULL)
+        free(pattern->steps);
+    pattern->steps = NULL;
+    pattern->length = 0;
+}
+
+static void
+StepSeqer_fillHeld(StepSeqer *self, int track, int start, int end)
+{
+    int k, j, nheld = self->outputs - 1;
+    MYFLT value, *out;
+
+    for (k=0; k<nheld; k++) {
+        value = self->values[track * nheld + k];
+        out = &self->buffer[((k + 1) * self->tracks + track) * self->bufsize];
+        for (j=start; j<end; j++)
+            out[j] = value;
+    }
+}
+
+static void
+StepSeqer_generate(StepSeqer *self) {
+    int i, k, t, nev, filled, nheld = self->outputs - 1;
+    double tm, tmi = 0.0;
+    MYFLT *time = NULL, *trig, *step, *held;
+    StepSeqPattern *pat;
+
+    if (self->modebuffer[0] == 0)
+        tmi = PyFloat_AS_DOUBLE(self->time);
+    else
+        time = Stream_getData((Stream *)self->time_stream);
+
+    for (t=0; t<self->tracks; t++) {
+        pat = &self->patterns[t];
+        trig = &self->buffer[t * self->bufsize];
+        held = &self->values[t * nheld];
+
+        for (i=0; i<self->numtrigs[t]; i++)
+            trig[self->trigpos[t * self->bufsize + i]] = 0.0;
+
+        nev = filled = 0;
+        for (i=0; i<self->bufsize; i++) {
+            if (pat->length == 0)
+                break;
+            tm = (time == NULL ? tmi : (double)time[i]) * self->sr;
+            if (tm < 1.0)
+                tm = 1.0;
+            step = &pat->steps[self->current[t] * self->width];
+            if (!self->fired[t] && self->elapsed[t] >= step[3] * tm) {
+                self->fired[t] = 1;
+                if (step[1] > 0.0 && (step[2] >= 1.0 || RANDOM_UNIFORM < step[2])) {
+                    trig[i] = 1.0;
+                    self->trigpos[t * self->bufsize + nev++] = i;
+                    StepSeqer_fillHeld(self, t, filled, i);
+                    filled = i;
+                    held[0] = step[0];
+                    held[1] = step[1];
+                    held[2] = (MYFLT)self->current[t];
+                    for (k=0; k<self->nparams; k++)
+                        held[STEPSEQ_HELD_OUTPUTS + k] = step[STEPSEQ_FIELDS + k];
+                }
+            }
+            self->elapsed[t] += 1.0;
+            if (self->elapsed[t] >= tm) {
+                self->elapsed[t] -= tm;
+                self->fired[t] = 0;
+                if (++self->current[t] >= pat->length) {
+                    self->current[t] = 0;
+                    if (self->pending[t].steps != NULL) {
+                        self->retired[t] = *pat;
+                        *pat = self->pending[t];
+                        self->pending[t].steps = NULL;
+                        self->pending[t].length = 0;
+                    }
+                }
+            }
+        }
+        self->numtrigs[t] = nev;
+
+        if (nev > 0 || !self->flat[t])
+            StepSeqer_fillHeld(self, t, filled, self->bufsize);
+        self->flat[t] = nev == 0;
+    }
+}
+
+MYFLT *
+StepSeqer_getSamplesBuffer(StepSeqer *self)
+{
+    return (MYFLT *)self->buffer;
+}
+
+int
+StepSeqer_getNumberOfTracks(StepSeqer *self)
+{
+    return self->tracks;
+}
+
+static void
+StepSeqer_setProcMode(StepSeqer *self)
+{
+    self->proc_func_ptr = StepSeqer_generate;
+}
+
+static void
+StepSeqer_compute_next_data_frame(StepSeqer *self)
+{
+    (*self->proc_func_ptr)(self);
+}
+
+static long
+StepSeqer_memory(StepSeqer *self)
+{
+    int t;
+    long bytes = self->outputs * self->tracks * self->bufsize * sizeof(MYFLT);
+    bytes += self->tracks * self->bufsize * sizeof(int);
+    for (t=0; t<self->tracks; t++)
+        bytes += (self->patterns[t].length + self->pending[t].length + self->retired[t].length) * self->width * sizeof(MYFLT);
+    return bytes;
+}
+
+static int
+StepSeqer_traverse(StepSeqer *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->time);
+    Py_VISIT(self->time_stream);
+    return 0;
+}
+
+static int
+StepSeqer_clear(StepSeqer *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->time);
+    Py_CLEAR(self->time_stream);
+    return 0;
+}
+
+static void
+StepSeqer_dealloc(StepSeqer* self)
+{
+    int t;
+    pyo_DEALLOC
+    for (t=0; t<self->tracks; t++) {
+        StepSeqer_freePattern(&self->patterns[t]);
+        StepSeqer_freePattern(&self->pending[t]);
+        StepSeqer_freePattern(&self->retired[t]);
+    }
+    free(self->patterns);
+    free(self->pending);
+    free(self->retired);
+    free(self->current);
+    free(self->fired);
+    free(self->elapsed);
+    free(self->values);
+    free(self->numtrigs);
+    free(self->trigpos);
+    free(self->flat);
+    free(self->buffer);
+    StepSeqer_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+StepSeqer_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *timetmp=NULL;
+    StepSeqer *self;
+    self = (StepSeqer *)type->tp_alloc(type, 0);
+
+    self->time = PyFloat_FromDouble(0.125);
+    self->tracks = 1;
+    self->nparams = 0;
+	self->modebuffer[0] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, StepSeqer_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, StepSeqer_memory);
+    self->mode_func_ptr = StepSeqer_setProcMode;
+
+    Stream_setStreamActive(self->stream, 0);
+
+    static char *kwlist[] = {"time", "tracks", "params", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "|Oii", kwlist, &timetmp, &self->tracks, &self->nparams))
+        Py_RETURN_NONE;
+
+    if (self->tracks < 1)
+        self->tracks = 1;
+    if (self->nparams < 0)
+        self->nparams = 0;
+    self->width = STEPSEQ_FIELDS + self->nparams;
+    self->outputs = 1 + STEPSEQ_HELD_OUTPUTS + self->nparams;
+
+    self->patterns = (StepSeqPattern *)calloc(self->tracks, sizeof(StepSeqPattern));
+    self->pending = (StepSeqPattern *)calloc(self->tracks, sizeof(StepSeqPattern));
+    self->retired = (StepSeqPattern *)calloc(self->tracks, sizeof(StepSeqPattern));
+    self->current = (int *)calloc(self->tracks, sizeof(int));
+    self->fired = (int *)calloc(self->tracks, sizeof(int));
+    self->elapsed = (double *)calloc(self->tracks, sizeof(double));
+    self->values = (MYFLT *)calloc(self->tracks * (self->outputs - 1), sizeof(MYFLT));
+    self->numtrigs = (int *)calloc(self->tracks, sizeof(int));
+    self->trigpos = (int *)calloc(self->tracks * self->bufsize, sizeof(int));
+    self->flat = (int *)malloc(self->tracks * sizeof(int));
+    for (i=0; i<self->tracks; i++)
+        self->flat[i] = 1;
+    self->buffer = (MYFLT *)calloc(self->outputs * self->tracks * self->bufsize, sizeof(MYFLT));
+    Server_prefaultMemory((Server *)self->server, self->trigpos, self->tracks * self->bufsize * sizeof(int));
+    Server_prefaultMemory((Server *)self->server, self->buffer, self->outputs * self->tracks * self->bufsize * sizeof(MYFLT));
+
+    if (timetmp) {
+        PyObject_CallMethod((PyObject *)self, "setTime", "O", timetmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    Server_generateSeed((Server *)self->server, STEPSEQ_ID);
+
+    return (PyObject *)self;
+}
+
+static PyObject * StepSeqer_getServer(StepSeqer* self) { GET_SERVER };
+static PyObject * StepSeqer_getStream(StepSeqer* self) { GET_STREAM };
+
+static PyObject * StepSeqer_play(StepSeqer *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * StepSeqer_stop(StepSeqer *self) { STOP };
+
+static PyObject *
+StepSeqer_setTime(StepSeqer *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->time);
+	if (isNumber == 1) {
+		self->time = PyNumber_Float(tmp);
+        self->modebuffer[0] = 0;
+	}
+	else {
+		self->time = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->time, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->time_stream);
+        self->time_stream = (Stream *)streamtmp;
+		self->modebuffer[0] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+/* Builds a pattern from a list of steps, each a sequence of width numbers. */
+static int
+StepSeqer_makePattern(StepSeqer *self, PyObject *steps, StepSeqPattern *pattern)
+{
+    int i, k;
+    PyObject *step;
+
+    pattern->length = 0;
+    pattern->steps = NULL;
+
+    if (! PyList_Check(steps)) {
+        PyErr_SetString(PyExc_TypeError, "StepSeq track must be a list of steps.");
+        return -1;
+    }
+
+    pattern->length = PyList_Size(steps);
+    pattern->steps = (MYFLT *)malloc((pattern->length > 0 ? pattern->length : 1) * self->width * sizeof(MYFLT));
+    for (i=0; i<pattern->length; i++) {
+        step = PyList_GET_ITEM(steps, i);
+        if (! PySequence_Check(step) || PySequence_Size(step) != self->width) {
+            PyErr_Format(PyExc_TypeError, "StepSeq steps must be sequences of %d numbers.", self->width);
+            StepSeqer_freePattern(pattern);
+            return -1;
+        }
+        for (k=0; k<self->width; k++) {
+            PyObject *value = PySequence_GetItem(step, k);
+            pattern->steps[i * self->width + k] = PyFloat_AsDouble(value);
+            Py_XDECREF(value);
+        }
+        if (PyErr_Occurred()) {
+            StepSeqer_freePattern(pattern);
+            return -1;
+        }
+    }
+    /* A track without any step is stored as a NULL pattern. */
+    if (pattern->length == 0)
+        StepSeqer_freePattern(pattern);
+    return 0;
+}
+
+/* setTracks(tracks, sync): tracks is a list with one entry per track, a list
+** of steps or None to leave the track unchanged. Every track is built before
+** any is changed, so the update is applied as a whole, between two buffers.
+** If sync is true, each track switches to its new steps when it wraps around,
+** otherwise the new steps are used from the next buffer. */
+static PyObject *
+StepSeqer_setTracks(StepSeqer *self, PyObject *args)
+{
+    int t, ntracks, sync = 1;
+    PyObject *tracks, *item;
+    StepSeqPattern *newpatterns;
+
+    if (! PyArg_ParseTuple(args, "O|i", &tracks, &sync))
+        return NULL;
+
+    if (! PyList_Check(tracks)) {
+        PyErr_SetString(PyExc_TypeError, "StepSeq tracks must be a list.");
+        return NULL;
+    }
+
+    ntracks = PyList_Size(tracks);
+    if (ntracks > self->tracks)
+        ntracks = self->tracks;
+
+    newpatterns = (StepSeqPattern *)calloc(ntracks > 0 ? ntracks : 1, sizeof(StepSeqPattern));
+    if (newpatterns == NULL)
+        return PyErr_NoMemory();
+    for (t=0; t<ntracks; t++) {
+        item = PyList_GET_ITEM(tracks, t);
+        if (item == Py_None)
+            continue;
+        if (StepSeqer_makePattern(self, item, &newpatterns[t]) < 0) {
+            for (t=0; t<ntracks; t++)
+                StepSeqer_freePattern(&newpatterns[t]);
+            free(newpatterns);
+            return NULL;
+        }
+    }
+
+    for (t=0; t<ntracks; t++) {
+        if (PyList_GET_ITEM(tracks, t) == Py_None)
+            continue;
+        StepSeqer_freePattern(&self->retired[t]);
+        StepSeqer_freePattern(&self->pending[t]);
+        if (sync && self->patterns[t].length > 0 && newpatterns[t].length > 0) {
+            self->pending[t] = newpatterns[t];
+        }
+        else {
+            StepSeqer_freePattern(&self->patterns[t]);
+            self->patterns[t] = newpatterns[t];
+            if (self->patterns[t].length > 0)
+                self->current[t] %= self->patterns[t].length;
+            else
+                self->current[t] = 0;
+        }
+    }
+    free(newpatterns);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+/* List of the current step index of each track. */
+static PyObject *
+StepSeqer_getPositions(StepSeqer *self)
+{
+    int t;
+    PyObject *list = PyList_New(self->tracks);
+    for (t=0; t<self->tracks; t++)
+        PyList_SET_ITEM(list, t, PyInt_FromLong(self->current[t]));
+    return list;
+}
+
+static PyObject *
+StepSeqer_reset(StepSeqer *self)
+{
+    int t;
+    for (t=0; t<self->tracks; t++) {
+        self->current[t] = 0;
+        self->fired[t] = 0;
+        self->elapsed[t] = 0.0;
+    }
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyMemberDef StepSeqer_members[] = {
+    {"server", T_OBJECT_EX, offsetof(StepSeqer, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(StepSeqer, stream), 0, "Stream object."},
+    {"time", T_OBJECT_EX, offsetof(StepSeqer, time), 0, "Step duration."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef StepSeqer_methods[] = {
+    {"getServer", (PyCFunction)StepSeqer_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)StepSeqer_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)StepSeqer_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"stop", (PyCFunction)StepSeqer_stop, METH_NOARGS, "Stops computing."},
+    {"setTime", (PyCFunction)StepSeqer_setTime, METH_O, "Sets the step duration."},
+    {"setTracks", (PyCFunction)StepSeqer_setTracks, METH_VARARGS, "Replaces the steps of some tracks at once."},
+    {"getPositions", (PyCFunction)StepSeqer_getPositions, METH_NOARGS, "Returns the current step of each track."},
+    {"reset", (PyCFunction)StepSeqer_reset, METH_NOARGS, "Moves every track back to its first step."},
+    {NULL}  /* Sentinel */
+};
+
+PyTypeObject StepSeqerType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.StepSeqer_base",         /*tp_name*/
+    sizeof(StepSeqer),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)StepSeqer_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    0,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "StepSeqer objects. Multi-track step sequencer.",           /* tp_doc */
+    (traverseproc)StepSeqer_traverse,   /* tp_traverse */
+    (inquiry)StepSeqer_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    StepSeqer_methods,             /* tp_methods */
+    StepSeqer_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    StepSeqer_new,                 /* tp_new */
+};
+
+/************************************************************************************************/
+/* StepSeq streamer object per track and output */
+/************************************************************************************************/
+typedef struct {
+    pyo_audio_HEAD
+    StepSeqer *mainPlayer;
+    int track;
+    int output;
+    int modebuffer[2];
+} StepSeq;
+
+static void StepSeq_postprocessing_ii(StepSeq *self) { POST_PROCESSING_II };
+static void StepSeq_postprocessing_ai(StepSeq *self) { POST_PROCESSING_AI };
+static void StepSeq_postprocessing_ia(StepSeq *self) { POST_PROCESSING_IA };
+static void StepSeq_postprocessing_aa(StepSeq *self) { POST_PROCESSING_AA };
+static void StepSeq_postprocessing_ireva(StepSeq *self) { POST_PROCESSING_IREVA };
+static void StepSeq_postprocessing_areva(StepSeq *self) { POST_PROCESSING_AREVA };
+static void StepSeq_postprocessing_revai(StepSeq *self) { POST_PROCESSING_REVAI };
+static void StepSeq_postprocessing_revaa(StepSeq *self) { POST_PROCESSING_REVAA };
+static void StepSeq_postprocessing_revareva(StepSeq *self) { POST_PROCESSING_REVAREVA };
+
+static void
+StepSeq_setProcMode(StepSeq *self) {
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+	switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = StepSeq_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = StepSeq_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = StepSeq_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = StepSeq_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = StepSeq_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = StepSeq_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = StepSeq_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = StepSeq_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = StepSeq_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+StepSeq_compute_next_data_frame(StepSeq *self)
+{
+    int i;
+    MYFLT *tmp;
+    int offset = (self->output * StepSeqer_getNumberOfTracks(self->mainPlayer) + self->track) * self->bufsize;
+    tmp = StepSeqer_getSamplesBuffer((StepSeqer *)self->mainPlayer);
+    for (i=0; i<self->bufsize; i++) {
+        self->data[i] = tmp[i + offset];
+    }
+    (*self->muladd_func_ptr)(self);
+}
+
+static int
+StepSeq_traverse(StepSeq *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->mainPlayer);
+    return 0;
+}
+
+static int
+StepSeq_clear(StepSeq *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->mainPlayer);
+    return 0;
+}
+
+static void
+StepSeq_dealloc(StepSeq* self)
+{
+    pyo_DEALLOC
+    StepSeq_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+StepSeq_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *maintmp=NULL;
+    StepSeq *self;
+    self = (StepSeq *)type->tp_alloc(type, 0);
+
+    self->track = 0;
+    self->output = 0;
+    self->modebuffer[0] = 0;
+    self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, StepSeq_compute_next_data_frame);
+    self->mode_func_ptr = StepSeq_setProcMode;
+
+    static char *kwlist[] = {"mainPlayer", "track", "output", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "O|ii", kwlist, &maintmp, &self->track, &self->output))
+        Py_RETURN_NONE;
+
+    if (! PyObject_TypeCheck(maintmp, &StepSeqerType) || self->track < 0 || self->output < 0 ||
+        self->track >= ((StepSeqer *)maintmp)->tracks || self->output >= ((StepSeqer *)maintmp)->outputs) {
+        PyErr_SetString(PyExc_ValueError, "StepSeq track or output out of range.");
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    Py_XDECREF(self->mainPlayer);
+    Py_INCREF(maintmp);
+    self->mainPlayer = (StepSeqer *)maintmp;
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * StepSeq_getServer(StepSeq* self) { GET_SERVER };
+static PyObject * StepSeq_getStream(StepSeq* self) { GET_STREAM };
+static PyObject * StepSeq_setMul(StepSeq *self, PyObject *arg) { SET_MUL };
+static PyObject * StepSeq_setAdd(StepSeq *self, PyObject *arg) { SET_ADD };
+static PyObject * StepSeq_setSub(StepSeq *self, PyObject *arg) { SET_SUB };
+static PyObject * StepSeq_setDiv(StepSeq *self, PyObject *arg) { SET_DIV };
+
+static PyObject * StepSeq_play(StepSeq *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * StepSeq_out(StepSeq *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * StepSeq_stop(StepSeq *self) { STOP };
+
+static PyObject * StepSeq_multiply(StepSeq *self, PyObject *arg) { MULTIPLY };
+static PyObject * StepSeq_inplace_multiply(StepSeq *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * StepSeq_add(StepSeq *self, PyObject *arg) { ADD };
+static PyObject * StepSeq_inplace_add(StepSeq *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * StepSeq_sub(StepSeq *self, PyObject *arg) { SUB };
+static PyObject * StepSeq_inplace_sub(StepSeq *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * StepSeq_div(StepSeq *self, PyObject *arg) { DIV };
+static PyObject * StepSeq_inplace_div(StepSeq *self, PyObject *arg) { INPLACE_DIV };
+
+static PyMemberDef StepSeq_members[] = {
+    {"server", T_OBJECT_EX, offsetof(StepSeq, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(StepSeq, stream), 0, "Stream object."},
+    {"mul", T_OBJECT_EX, offsetof(StepSeq, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(StepSeq, add), 0, "Add factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef StepSeq_methods[] = {
+    {"getServer", (PyCFunction)StepSeq_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)StepSeq_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)StepSeq_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)StepSeq_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)StepSeq_stop, METH_NOARGS, "Stops computing."},
+    {"setMul", (PyCFunction)StepSeq_setMul, METH_O, "Sets oscillator mul factor."},
+    {"setAdd", (PyCFunction)StepSeq_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)StepSeq_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)StepSeq_setDiv, METH_O, "Sets inverse mul factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyNumberMethods StepSeq_as_number = {
+    (binaryfunc)StepSeq_add,                         /*nb_add*/
+    (binaryfunc)StepSeq_sub,                         /*nb_subtract*/
+    (binaryfunc)StepSeq_multiply,                    /*nb_multiply*/
+    (binaryfunc)StepSeq_div,                                              /*nb_divide*/
+    0,                                              /*nb_remainder*/
+    0,                                              /*nb_divmod*/
+    0,                                              /*nb_power*/
+    0,                                              /*nb_neg*/
+    0,                                              /*nb_pos*/
+    0,                                              /*(unaryfunc)array_abs,*/
+    0,                                              /*nb_nonzero*/
+    0,                                              /*nb_invert*/
+    0,                                              /*nb_lshift*/
+    0,                                              /*nb_rshift*/
+    0,                                              /*nb_and*/
+    0,                                              /*nb_xor*/
+    0,                                              /*nb_or*/
+    0,                                              /*nb_coerce*/
+    0,                                              /*nb_int*/
+    0,                                              /*nb_long*/
+    0,                                              /*nb_float*/
+    0,                                              /*nb_oct*/
+    0,                                              /*nb_hex*/
+    (binaryfunc)StepSeq_inplace_add,                 /*inplace_add*/
+    (binaryfunc)StepSeq_inplace_sub,                 /*inplace_subtract*/
+    (binaryfunc)StepSeq_inplace_multiply,            /*inplace_multiply*/
+    (binaryfunc)StepSeq_inplace_div,                                              /*inplace_divide*/
+    0,                                              /*inplace_remainder*/
+    0,                                              /*inplace_power*/
+    0,                                              /*inplace_lshift*/
+    0,                                              /*inplace_rshift*/
+    0,                                              /*inplace_and*/
+    0,                                              /*inplace_xor*/
+    0,                                              /*inplace_or*/
+    0,                                              /*nb_floor_divide*/
+    0,                                              /*nb_true_divide*/
+    0,                                              /*nb_inplace_floor_divide*/
+    0,                                              /*nb_inplace_true_divide*/
+    0,                                              /* nb_index */
+};
+
+PyTypeObject StepSeqType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.StepSeq_base",         /*tp_name*/
+    sizeof(StepSeq),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)StepSeq_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    &StepSeq_as_number,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES,  /*tp_flags*/
+    "StepSeq objects. Reads one output of a track from a StepSeqer.",           /* tp_doc */
+    (traverseproc)StepSeq_traverse,   /* tp_traverse */
+    (inquiry)StepSeq_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    StepSeq_methods,             /* tp_methods */
+    StepSeq_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    StepSeq_new,                 /* tp_new */
+};
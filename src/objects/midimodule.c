@@ -3751,3 +3751,611 @@ PyTypeObject RawMidiType = {
     0,                         /* tp_alloc */
     RawMidi_new,                 /* tp_new */
 };
+
+/* Midi output objects. Events are detected sample by sample in the input
+   streams and posted to the server's midi output scheduler with their
+   position in the buffer, which gives them a sample-derived timestamp. */
+#define MIDIOUT_STATUS(status, chnl) ((chnl) == 0 ? (status) : ((status) | ((chnl) - 1)))
+
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *pitch;
+    Stream *pitch_stream;
+    PyObject *velocity;
+    Stream *velocity_stream;
+    int channel;
+    int note; /* sounding note, -1 if none */
+} Noteout;
+
+static void
+Noteout_compute_next_data_frame(Noteout *self)
+{
+    int i, pit, vel;
+    MYFLT *pin = Stream_getData((Stream *)self->pitch_stream);
+    MYFLT *vin = Stream_getData((Stream *)self->velocity_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        pit = (int)(pin[i] + 0.5);
+        vel = (int)(vin[i] * 127 + 0.5);
+        if (pit < 0) pit = 0;
+        else if (pit > 127) pit = 127;
+        if (vel < 0) vel = 0;
+        else if (vel > 127) vel = 127;
+
+        /* Velocity changes during a note are ignored, only a new pitch or
+           a velocity going from 0 to non-zero starts a note. */
+        if (vel > 0) {
+            if (pit != self->note) {
+                if (self->note >= 0)
+                    Server_midiOutPost((Server *)self->server, Pm_Message(MIDIOUT_STATUS(0x80, self->channel), self->note, 0), i);
+                Server_midiOutPost((Server *)self->server, Pm_Message(MIDIOUT_STATUS(0x90, self->channel), pit, vel), i);
+                self->note = pit;
+            }
+        }
+        else if (self->note >= 0) {
+            Server_midiOutPost((Server *)self->server, Pm_Message(MIDIOUT_STATUS(0x80, self->channel), self->note, 0), i);
+            self->note = -1;
+        }
+    }
+}
+
+static int
+Noteout_traverse(Noteout *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->pitch);
+    Py_VISIT(self->pitch_stream);
+    Py_VISIT(self->velocity);
+    Py_VISIT(self->velocity_stream);
+    return 0;
+}
+
+static int
+Noteout_clear(Noteout *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->pitch);
+    Py_CLEAR(self->pitch_stream);
+    Py_CLEAR(self->velocity);
+    Py_CLEAR(self->velocity_stream);
+    return 0;
+}
+
+static void
+Noteout_dealloc(Noteout* self)
+{
+    pyo_DEALLOC
+    Noteout_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+Noteout_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *pitchtmp, *pitch_streamtmp, *velocitytmp, *velocity_streamtmp;
+    Noteout *self;
+    self = (Noteout *)type->tp_alloc(type, 0);
+
+    self->channel = 0;
+    self->note = -1;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, Noteout_compute_next_data_frame);
+
+    static char *kwlist[] = {"pitch", "velocity", "channel", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OO|i", kwlist, &pitchtmp, &velocitytmp, &self->channel))
+        Py_RETURN_NONE;
+
+    Py_INCREF(pitchtmp);
+    Py_XDECREF(self->pitch);
+    self->pitch = pitchtmp;
+    pitch_streamtmp = PyObject_CallMethod((PyObject *)self->pitch, "_getStream", NULL);
+    Py_INCREF(pitch_streamtmp);
+    Py_XDECREF(self->pitch_stream);
+    self->pitch_stream = (Stream *)pitch_streamtmp;
+
+    Py_INCREF(velocitytmp);
+    Py_XDECREF(self->velocity);
+    self->velocity = velocitytmp;
+    velocity_streamtmp = PyObject_CallMethod((PyObject *)self->velocity, "_getStream", NULL);
+    Py_INCREF(velocity_streamtmp);
+    Py_XDECREF(self->velocity_stream);
+    self->velocity_stream = (Stream *)velocity_streamtmp;
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    return (PyObject *)self;
+}
+
+static PyObject * Noteout_getServer(Noteout* self) { GET_SERVER };
+static PyObject * Noteout_getStream(Noteout* self) { GET_STREAM };
+
+static PyObject * Noteout_play(Noteout *self, PyObject *args, PyObject *kwds) { PLAY };
+
+static PyObject * Noteout_stop(Noteout *self)
+{
+    /* Don't leave a hanging note. Called from python, so the message goes
+       through the python queue, timestamped 1 ms after the current buffer to
+       stay behind the note on already posted by the audio thread. */
+    if (self->note >= 0) {
+        Server_midiOutSend((Server *)self->server, Pm_Message(MIDIOUT_STATUS(0x80, self->channel), self->note, 0),
+                           Server_midiOutTime((Server *)self->server, self->bufsize) + 1);
+        self->note = -1;
+    }
+    STOP
+};
+
+static PyObject *
+Noteout_setChannel(Noteout *self, PyObject *arg)
+{
+    if (PyInt_Check(arg))
+        self->channel = PyInt_AsLong(arg);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyMemberDef Noteout_members[] = {
+    {"server", T_OBJECT_EX, offsetof(Noteout, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(Noteout, stream), 0, "Stream object."},
+    {"pitch", T_OBJECT_EX, offsetof(Noteout, pitch), 0, "Pitch input."},
+    {"velocity", T_OBJECT_EX, offsetof(Noteout, velocity), 0, "Velocity input."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef Noteout_methods[] = {
+    {"getServer", (PyCFunction)Noteout_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)Noteout_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)Noteout_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"stop", (PyCFunction)Noteout_stop, METH_NOARGS, "Stops computing."},
+    {"setChannel", (PyCFunction)Noteout_setChannel, METH_O, "Sets the midi channel."},
+    {NULL}  /* Sentinel */
+};
+
+PyTypeObject NoteoutType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.Noteout_base",         /*tp_name*/
+    sizeof(Noteout),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)Noteout_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    0,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "Noteout objects. Sends midi notes from pitch and velocity streams.",           /* tp_doc */
+    (traverseproc)Noteout_traverse,   /* tp_traverse */
+    (inquiry)Noteout_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    Noteout_methods,             /* tp_methods */
+    Noteout_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    Noteout_new,                 /* tp_new */
+};
+
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream *input_stream;
+    int ctlnumber;
+    int channel;
+    MYFLT minscale;
+    MYFLT maxscale;
+    int last; /* last value sent, -1 if none */
+} Ctlout;
+
+static void
+Ctlout_compute_next_data_frame(Ctlout *self)
+{
+    int i, val;
+    MYFLT scl = 127.0 / (self->maxscale - self->minscale);
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        val = (int)((in[i] - self->minscale) * scl + 0.5);
+        if (val < 0) val = 0;
+        else if (val > 127) val = 127;
+        if (val != self->last) {
+            Server_midiOutPost((Server *)self->server, Pm_Message(MIDIOUT_STATUS(0xB0, self->channel), self->ctlnumber, val), i);
+            self->last = val;
+        }
+    }
+}
+
+static int
+Ctlout_traverse(Ctlout *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->input);
+    Py_VISIT(self->input_stream);
+    return 0;
+}
+
+static int
+Ctlout_clear(Ctlout *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->input);
+    Py_CLEAR(self->input_stream);
+    return 0;
+}
+
+static void
+Ctlout_dealloc(Ctlout* self)
+{
+    pyo_DEALLOC
+    Ctlout_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+Ctlout_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *inputtmp, *input_streamtmp;
+    Ctlout *self;
+    self = (Ctlout *)type->tp_alloc(type, 0);
+
+    self->channel = 0;
+    self->minscale = 0.0;
+    self->maxscale = 1.0;
+    self->last = -1;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, Ctlout_compute_next_data_frame);
+
+    static char *kwlist[] = {"input", "ctlnumber", "minscale", "maxscale", "channel", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, TYPE_OI_FFI, kwlist, &inputtmp, &self->ctlnumber, &self->minscale, &self->maxscale, &self->channel))
+        Py_RETURN_NONE;
+
+    INIT_INPUT_STREAM
+
+    if (self->maxscale == self->minscale)
+        self->maxscale = self->minscale + 1.0;
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    return (PyObject *)self;
+}
+
+static PyObject * Ctlout_getServer(Ctlout* self) { GET_SERVER };
+static PyObject * Ctlout_getStream(Ctlout* self) { GET_STREAM };
+
+static PyObject * Ctlout_play(Ctlout *self, PyObject *args, PyObject *kwds)
+{
+    self->last = -1;
+    PLAY
+};
+
+static PyObject * Ctlout_stop(Ctlout *self) { STOP };
+
+static PyObject *
+Ctlout_setCtlNumber(Ctlout *self, PyObject *arg)
+{
+    if (PyInt_Check(arg)) {
+        self->ctlnumber = PyInt_AsLong(arg);
+        self->last = -1;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Ctlout_setChannel(Ctlout *self, PyObject *arg)
+{
+    if (PyInt_Check(arg)) {
+        self->channel = PyInt_AsLong(arg);
+        self->last = -1;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Ctlout_setMinScale(Ctlout *self, PyObject *arg)
+{
+    if (PyNumber_Check(arg)) {
+        self->minscale = PyFloat_AsDouble(arg);
+        if (self->maxscale == self->minscale)
+            self->maxscale = self->minscale + 1.0;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Ctlout_setMaxScale(Ctlout *self, PyObject *arg)
+{
+    if (PyNumber_Check(arg)) {
+        self->maxscale = PyFloat_AsDouble(arg);
+        if (self->maxscale == self->minscale)
+            self->maxscale = self->minscale + 1.0;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyMemberDef Ctlout_members[] = {
+    {"server", T_OBJECT_EX, offsetof(Ctlout, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(Ctlout, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(Ctlout, input), 0, "Input sound object."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef Ctlout_methods[] = {
+    {"getServer", (PyCFunction)Ctlout_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)Ctlout_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)Ctlout_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"stop", (PyCFunction)Ctlout_stop, METH_NOARGS, "Stops computing."},
+    {"setCtlNumber", (PyCFunction)Ctlout_setCtlNumber, METH_O, "Sets the controller number."},
+    {"setChannel", (PyCFunction)Ctlout_setChannel, METH_O, "Sets the midi channel."},
+    {"setMinScale", (PyCFunction)Ctlout_setMinScale, METH_O, "Sets the input value giving 0."},
+    {"setMaxScale", (PyCFunction)Ctlout_setMaxScale, METH_O, "Sets the input value giving 127."},
+    {NULL}  /* Sentinel */
+};
+
+PyTypeObject CtloutType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.Ctlout_base",         /*tp_name*/
+    sizeof(Ctlout),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)Ctlout_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    0,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "Ctlout objects. Sends midi control changes from an input stream.",           /* tp_doc */
+    (traverseproc)Ctlout_traverse,   /* tp_traverse */
+    (inquiry)Ctlout_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    Ctlout_methods,             /* tp_methods */
+    Ctlout_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    Ctlout_new,                 /* tp_new */
+};
+
+typedef struct {
+    pyo_audio_HEAD
+    PyObject *input;
+    Stream *input_stream;
+    int channel;
+    int scale; /* 0 = midi, 1 = transpo */
+    MYFLT range;
+    int last; /* last value sent, -1 if none */
+} Bendout;
+
+static void
+Bendout_compute_next_data_frame(Bendout *self)
+{
+    int i, val;
+    MYFLT semi;
+    MYFLT *in = Stream_getData((Stream *)self->input_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        if (self->scale == 0)
+            semi = in[i];
+        else
+            semi = in[i] > 0.0 ? 12.0 * MYLOG2(in[i]) : -self->range;
+        val = (int)(semi / self->range * 8192.0 + 8192.5);
+        if (val < 0) val = 0;
+        else if (val > 16383) val = 16383;
+        if (val != self->last) {
+            Server_midiOutPost((Server *)self->server, Pm_Message(MIDIOUT_STATUS(0xE0, self->channel), val & 0x7F, val >> 7), i);
+            self->last = val;
+        }
+    }
+}
+
+static int
+Bendout_traverse(Bendout *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->input);
+    Py_VISIT(self->input_stream);
+    return 0;
+}
+
+static int
+Bendout_clear(Bendout *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->input);
+    Py_CLEAR(self->input_stream);
+    return 0;
+}
+
+static void
+Bendout_dealloc(Bendout* self)
+{
+    pyo_DEALLOC
+    Bendout_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+Bendout_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i;
+    PyObject *inputtmp, *input_streamtmp;
+    Bendout *self;
+    self = (Bendout *)type->tp_alloc(type, 0);
+
+    self->channel = 0;
+    self->scale = 0;
+    self->range = 2.0;
+    self->last = -1;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, Bendout_compute_next_data_frame);
+
+    static char *kwlist[] = {"input", "brange", "scale", "channel", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, TYPE_O_FII, kwlist, &inputtmp, &self->range, &self->scale, &self->channel))
+        Py_RETURN_NONE;
+
+    INIT_INPUT_STREAM
+
+    if (self->range <= 0.0)
+        self->range = 2.0;
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    return (PyObject *)self;
+}
+
+static PyObject * Bendout_getServer(Bendout* self) { GET_SERVER };
+static PyObject * Bendout_getStream(Bendout* self) { GET_STREAM };
+
+static PyObject * Bendout_play(Bendout *self, PyObject *args, PyObject *kwds)
+{
+    self->last = -1;
+    PLAY
+};
+
+static PyObject * Bendout_stop(Bendout *self) { STOP };
+
+static PyObject *
+Bendout_setBrange(Bendout *self, PyObject *arg)
+{
+    if (PyNumber_Check(arg)) {
+        self->range = PyFloat_AsDouble(arg);
+        if (self->range <= 0.0)
+            self->range = 2.0;
+        self->last = -1;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Bendout_setScale(Bendout *self, PyObject *arg)
+{
+    if (PyInt_Check(arg))
+        self->scale = PyInt_AsLong(arg);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Bendout_setChannel(Bendout *self, PyObject *arg)
+{
+    if (PyInt_Check(arg)) {
+        self->channel = PyInt_AsLong(arg);
+        self->last = -1;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyMemberDef Bendout_members[] = {
+    {"server", T_OBJECT_EX, offsetof(Bendout, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(Bendout, stream), 0, "Stream object."},
+    {"input", T_OBJECT_EX, offsetof(Bendout, input), 0, "Input sound object."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef Bendout_methods[] = {
+    {"getServer", (PyCFunction)Bendout_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)Bendout_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)Bendout_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"stop", (PyCFunction)Bendout_stop, METH_NOARGS, "Stops computing."},
+    {"setBrange", (PyCFunction)Bendout_setBrange, METH_O, "Sets the bending range in semitones."},
+    {"setScale", (PyCFunction)Bendout_setScale, METH_O, "Sets the input scale (0 = semitones, 1 = transposition factor)."},
+    {"setChannel", (PyCFunction)Bendout_setChannel, METH_O, "Sets the midi channel."},
+    {NULL}  /* Sentinel */
+};
+
+PyTypeObject BendoutType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.Bendout_base",         /*tp_name*/
+    sizeof(Bendout),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)Bendout_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    0,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+    "Bendout objects. Sends midi pitch bend from an input stream.",           /* tp_doc */
+    (traverseproc)Bendout_traverse,   /* tp_traverse */
+    (inquiry)Bendout_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    Bendout_methods,             /* tp_methods */
+    Bendout_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    Bendout_new,                 /* tp_new */
+};
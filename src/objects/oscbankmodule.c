@@ -26,10 +26,15 @@
 #include "servermodule.h"
 #include "dummymodule.h"
 #include "tablemodule.h"
+#include "taskpool.h"
 
 /*******************/
 /***** OscBank ******/
 /*******************/
+/* Partials are computed by tasks of OSCBANK_TASK_PARTIALS oscillators,
+** spread over the server's worker threads. */
+#define OSCBANK_TASK_PARTIALS 64
+
 
 static MYFLT
 OscBank_clip(MYFLT x, int size) {
@@ -80,6 +85,15 @@ typedef struct {
     MYFLT *aOldValues;
     MYFLT *aValues;
     MYFLT *aDiffs;
+    /* state of the current buffer, shared by the tasks */
+    MYFLT *tablelist;
+    int tablesize;
+    MYFLT tabscl;
+    MYFLT curSlope;
+    MYFLT curFrnda;
+    MYFLT curArnda;
+    int ntasks;
+    MYFLT *taskbuffers; /* outputs of the tasks 1 to ntasks - 1 */
 } OscBank;
 
 static void
@@ -143,18 +157,59 @@ OscBank_pickNewArnds(OscBank *self, MYFLT arndf, MYFLT arnda) {
     }
 }
 
+/* Sums the partials [task * OSCBANK_TASK_PARTIALS, ...] in the task's own buffer. */
+static void
+OscBank_task(void *data, int task) {
+    OscBank *self = (OscBank *)data;
+    MYFLT amp, modamp, pos, inc, x, y, fpart, *out;
+    int i, j, ipart, start, end, size = self->tablesize;
+    MYFLT *tablelist = self->tablelist;
+
+    start = task * OSCBANK_TASK_PARTIALS;
+    end = start + OSCBANK_TASK_PARTIALS;
+    if (end > self->stages)
+        end = self->stages;
+    out = task == 0 ? self->data : &self->taskbuffers[(task - 1) * self->bufsize];
+
+    for (i=0; i<self->bufsize; i++) {
+        out[i] = 0.0;
+    }
+
+    amp = self->amplitude;
+    for (j=0; j<start; j++)
+        amp *= self->curSlope;
+
+    modamp = 1.0;
+    for (j=start; j<end; j++) {
+        inc = self->frequencies[j];
+        if (self->curFrnda != 0.0)
+            inc += self->fOldValues[j] + self->fDiffs[j] * self->ftime;
+        inc *= self->tabscl;
+        if (self->curArnda != 0.0)
+            modamp = (1.0 - self->curArnda) + (self->aOldValues[j] + self->aDiffs[j] * self->atime);
+        pos = self->pointerPos[j];
+        for (i=0; i<self->bufsize; i++) {
+            pos = OscBank_clip(pos, size);
+            ipart = (int)pos;
+            fpart = pos - ipart;
+            x = tablelist[ipart];
+            y = tablelist[ipart+1];
+            out[i] += (x + (y - x) * fpart) * amp * modamp;
+            pos += inc;
+        }
+        self->pointerPos[j] = pos;
+        amp *= self->curSlope;
+    }
+}
+
 static void
 OscBank_readframes(OscBank *self) {
-    MYFLT freq, spread, slope, frndf, frnda, arndf, arnda, amp, modamp, pos, inc, x, y, fpart;
-    int i, j, ipart;
+    MYFLT freq, spread, slope, frndf, frnda, arndf, arnda, *buf;
+    int i, j;
     MYFLT *tablelist = TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
     MYFLT tabscl = size / self->sr;
 
-    for (i=0; i<self->bufsize; i++) {
-        self->data[i] = 0.0;
-    }
-
     if (self->modebuffer[2] == 0)
         freq = PyFloat_AS_DOUBLE(self->freq);
     else
@@ -199,97 +254,33 @@ OscBank_readframes(OscBank *self) {
         }
     }
 
-    if (frnda == 0.0 && arnda == 0.0) {
-        amp = self->amplitude;
-        for (j=0; j<self->stages; j++) {
-            inc = self->frequencies[j] * tabscl;
-            pos = self->pointerPos[j];
-            for (i=0; i<self->bufsize; i++) {
-                pos = OscBank_clip(pos, size);
-                ipart = (int)pos;
-                fpart = pos - ipart;
-                x = tablelist[ipart];
-                y = tablelist[ipart+1];
-                self->data[i] += (x + (y - x) * fpart) * amp;
-                pos += inc;
-            }
-            self->pointerPos[j] = pos;
-            amp *= slope;
-        }
+    if (self->ftime >= 1.0 && frnda != 0.0) {
+        OscBank_pickNewFrnds(self, frndf, frnda);
     }
-    else if (frnda != 0.0 && arnda != 0.0) {
-        if (self->ftime >= 1.0) {
-            OscBank_pickNewFrnds(self, frndf, frnda);
-        }
-        if (self->atime >= 1.0) {
-            OscBank_pickNewArnds(self, arndf, arnda);
-        }
-        amp = self->amplitude;
-        for (j=0; j<self->stages; j++) {
-            inc = (self->frequencies[j] + (self->fOldValues[j] + self->fDiffs[j] * self->ftime)) * tabscl;
-            pos = self->pointerPos[j];
-            modamp = (1.0 - arnda) + (self->aOldValues[j] + self->aDiffs[j] * self->atime);
-            for (i=0; i<self->bufsize; i++) {
-                pos = OscBank_clip(pos, size);
-                ipart = (int)pos;
-                fpart = pos - ipart;
-                x = tablelist[ipart];
-                y = tablelist[ipart+1];
-                self->data[i] += (x + (y - x) * fpart) * amp * modamp;
-                pos += inc;
-            }
-            self->pointerPos[j] = pos;
-            amp *= slope;
-        }
-        self->ftime += self->finc;
-        self->atime += self->ainc;
-    }
-    else if (frnda != 0.0 && arnda == 0.0) {
-        if (self->ftime >= 1.0) {
-            OscBank_pickNewFrnds(self, frndf, frnda);
-        }
-        amp = self->amplitude;
-        for (j=0; j<self->stages; j++) {
-            inc = (self->frequencies[j] + (self->fOldValues[j] + self->fDiffs[j] * self->ftime)) * tabscl;
-            pos = self->pointerPos[j];
-            for (i=0; i<self->bufsize; i++) {
-                pos = OscBank_clip(pos, size);
-                ipart = (int)pos;
-                fpart = pos - ipart;
-                x = tablelist[ipart];
-                y = tablelist[ipart+1];
-                self->data[i] += (x + (y - x) * fpart) * amp;
-                pos += inc;
-            }
-            self->pointerPos[j] = pos;
-            amp *= slope;
-        }
-        self->ftime += self->finc;
+    if (self->atime >= 1.0 && arnda != 0.0) {
+        OscBank_pickNewArnds(self, arndf, arnda);
     }
-    else if (frnda == 0.0 && arnda != 0.0) {
-        if (self->atime >= 1.0) {
-            OscBank_pickNewArnds(self, arndf, arnda);
-        }
-        amp = self->amplitude;
-        for (j=0; j<self->stages; j++) {
-            inc = self->frequencies[j] * tabscl;
-            pos = self->pointerPos[j];
-            modamp = (1.0 - arnda) + (self->aOldValues[j] + self->aDiffs[j] * self->atime);
-            for (i=0; i<self->bufsize; i++) {
-                pos = OscBank_clip(pos, size);
-                ipart = (int)pos;
-                fpart = pos - ipart;
-                x = tablelist[ipart];
-                y = tablelist[ipart+1];
-                self->data[i] += (x + (y - x) * fpart) * amp * modamp;
-                pos += inc;
-            }
-            self->pointerPos[j] = pos;
-            amp *= slope;
+
+    self->tablelist = tablelist;
+    self->tablesize = size;
+    self->tabscl = tabscl;
+    self->curSlope = slope;
+    self->curFrnda = frnda;
+    self->curArnda = arnda;
+    TaskPool_run(Server_getTaskPool((Server *)self->server), OscBank_task, self, self->ntasks);
+
+    /* Reduction in task order, the result doesn't depend on the threads. */
+    for (j=1; j<self->ntasks; j++) {
+        buf = &self->taskbuffers[(j - 1) * self->bufsize];
+        for (i=0; i<self->bufsize; i++) {
+            self->data[i] += buf[i];
         }
-        self->atime += self->ainc;
     }
 
+    if (frnda != 0.0)
+        self->ftime += self->finc;
+    if (arnda != 0.0)
+        self->atime += self->ainc;
 }
 
 static void OscBank_postprocessing_ii(OscBank *self) { POST_PROCESSING_II };
@@ -404,6 +395,7 @@ OscBank_dealloc(OscBank* self)
     free(self->aOldValues);
     free(self->aValues);
     free(self->aDiffs);
+    free(self->taskbuffers);
     OscBank_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -511,6 +503,10 @@ OscBank_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     self->amplitude = 1. / self->stages;
 
+    self->ntasks = (self->stages + OSCBANK_TASK_PARTIALS - 1) / OSCBANK_TASK_PARTIALS;
+    self->taskbuffers = (MYFLT *)calloc((self->ntasks - 1) * self->bufsize + 1, sizeof(MYFLT));
+    Server_prefaultMemory((Server *)self->server, self->taskbuffers, ((self->ntasks - 1) * self->bufsize + 1) * sizeof(MYFLT));
+
     Server_generateSeed((Server *)self->server, OSCBANK_ID);
 
     return (PyObject *)self;
@@ -48,8 +48,8 @@ _clip(MYFLT x) {
         return x;
 }
 
-static MYFLT
-Sine_clip(MYFLT x) {
+static MYSTATE
+Sine_clip(MYSTATE x) {
     if (x < 0) {
         x += ((int)(-x * ONE_OVER_512) + 1) * 512;
     }
@@ -67,12 +67,12 @@ typedef struct {
     PyObject *phase;
     Stream *phase_stream;
     int modebuffer[4];
-    MYFLT pointerPos;
+    MYSTATE pointerPos;
 } Sine;
 
 static void
 Sine_readframes_ii(Sine *self) {
-    MYFLT inc, fr, ph, pos, fpart;
+    MYSTATE inc, fr, ph, pos, fpart;
     int i, ipart;
 
     fr = PyFloat_AS_DOUBLE(self->freq);
@@ -93,7 +93,7 @@ Sine_readframes_ii(Sine *self) {
 
 static void
 Sine_readframes_ai(Sine *self) {
-    MYFLT inc, ph, pos, fpart, fac;
+    MYSTATE inc, ph, pos, fpart, fac;
     int i, ipart;
 
     MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
@@ -115,7 +115,7 @@ Sine_readframes_ai(Sine *self) {
 
 static void
 Sine_readframes_ia(Sine *self) {
-    MYFLT inc, fr, pos, fpart;
+    MYSTATE inc, fr, pos, fpart;
     int i, ipart;
 
     fr = PyFloat_AS_DOUBLE(self->freq);
@@ -136,7 +136,7 @@ Sine_readframes_ia(Sine *self) {
 
 static void
 Sine_readframes_aa(Sine *self) {
-    MYFLT inc, pos, fpart, fac;
+    MYSTATE inc, pos, fpart, fac;
     int i, ipart;
 
     MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
@@ -521,13 +521,13 @@ typedef struct {
     PyObject *feedback;
     Stream *feedback_stream;
     int modebuffer[4];
-    MYFLT pointerPos;
+    MYSTATE pointerPos;
     MYFLT lastValue;
 } SineLoop;
 
 static void
 SineLoop_readframes_ii(SineLoop *self) {
-    MYFLT inc, fr, feed, pos, fpart;
+    MYSTATE inc, fr, feed, pos, fpart;
     int i, ipart;
 
     fr = PyFloat_AS_DOUBLE(self->freq);
@@ -546,7 +546,7 @@ SineLoop_readframes_ii(SineLoop *self) {
 
 static void
 SineLoop_readframes_ai(SineLoop *self) {
-    MYFLT inc, feed, pos, fpart, fac;
+    MYSTATE inc, feed, pos, fpart, fac;
     int i, ipart;
 
     MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
@@ -566,7 +566,7 @@ SineLoop_readframes_ai(SineLoop *self) {
 
 static void
 SineLoop_readframes_ia(SineLoop *self) {
-    MYFLT inc, fr, feed, pos, fpart;
+    MYSTATE inc, fr, feed, pos, fpart;
     int i, ipart;
 
     fr = PyFloat_AS_DOUBLE(self->freq);
@@ -586,7 +586,7 @@ SineLoop_readframes_ia(SineLoop *self) {
 
 static void
 SineLoop_readframes_aa(SineLoop *self) {
-    MYFLT inc, feed, pos, fpart, fac;
+    MYSTATE inc, feed, pos, fpart, fac;
     int i, ipart;
 
     MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
@@ -975,6 +975,7 @@ typedef struct {
     double pointerPos;
     int interp; /* 0 = default to 2, 1 = nointerp, 2 = linear, 3 = cos, 4 = cubic */
     MYFLT (*interp_func_ptr)(MYFLT *, int, MYFLT, int);
+    TableReadQueue queue;
 } Osc;
 
 static void
@@ -982,7 +983,8 @@ Osc_readframes_ii(Osc *self) {
     MYFLT fr, ph, fpart;
     double inc, pos;
     int i, ipart;
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     fr = PyFloat_AS_DOUBLE(self->freq);
@@ -998,8 +1000,16 @@ Osc_readframes_ii(Osc *self) {
             pos -= size;
         ipart = (int)pos;
         fpart = pos - ipart;
-        self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
+        if (packed) {
+            self->data[i] = 0.0;
+            TableReadQueue_push(&self->queue, ipart, fpart, 1.0, i);
+        }
+        else
+            self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, self->interp_func_ptr, self->data);
 }
 
 static void
@@ -1007,7 +1017,8 @@ Osc_readframes_ai(Osc *self) {
     MYFLT ph, fpart, sizeOnSr;
     double inc, pos;
     int i, ipart;
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
@@ -1024,8 +1035,16 @@ Osc_readframes_ai(Osc *self) {
             pos -= size;
         ipart = (int)pos;
         fpart = pos - ipart;
-        self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
+        if (packed) {
+            self->data[i] = 0.0;
+            TableReadQueue_push(&self->queue, ipart, fpart, 1.0, i);
+        }
+        else
+            self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, self->interp_func_ptr, self->data);
 }
 
 static void
@@ -1033,7 +1052,8 @@ Osc_readframes_ia(Osc *self) {
     MYFLT fr, pha, fpart;
     double inc, pos;
     int i, ipart;
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     fr = PyFloat_AS_DOUBLE(self->freq);
@@ -1049,8 +1069,16 @@ Osc_readframes_ia(Osc *self) {
             pos -= size;
         ipart = (int)pos;
         fpart = pos - ipart;
-        self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
+        if (packed) {
+            self->data[i] = 0.0;
+            TableReadQueue_push(&self->queue, ipart, fpart, 1.0, i);
+        }
+        else
+            self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, self->interp_func_ptr, self->data);
 }
 
 static void
@@ -1058,7 +1086,8 @@ Osc_readframes_aa(Osc *self) {
     MYFLT pha, fpart, sizeOnSr;
     double inc, pos;
     int i, ipart;
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
@@ -1075,8 +1104,16 @@ Osc_readframes_aa(Osc *self) {
             pos -= size;
         ipart = (int)pos;
         fpart = pos - ipart;
-        self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
+        if (packed) {
+            self->data[i] = 0.0;
+            TableReadQueue_push(&self->queue, ipart, fpart, 1.0, i);
+        }
+        else
+            self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, self->interp_func_ptr, self->data);
 }
 
 static void Osc_postprocessing_ii(Osc *self) { POST_PROCESSING_II };
@@ -1176,6 +1213,7 @@ static void
 Osc_dealloc(Osc* self)
 {
     pyo_DEALLOC
+    TableReadQueue_free(&self->queue);
     Osc_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -1211,7 +1249,11 @@ Osc_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         Py_RETURN_NONE;
     }
     Py_XDECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tabletmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tabletmp);
+    if (TableReadQueue_reserve(&self->queue, self->bufsize) < 0) {
+        PyErr_NoMemory();
+        Py_RETURN_NONE;
+    }
 
     if (phasetmp) {
         PyObject_CallMethod((PyObject *)self, "setPhase", "O", phasetmp);
@@ -1277,7 +1319,7 @@ Osc_setTable(Osc *self, PyObject *arg)
 
 	tmp = arg;
 	Py_DECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tmp);
 
 	Py_INCREF(Py_None);
 	return Py_None;
@@ -3064,6 +3106,7 @@ typedef struct {
     PyObject *index;
     Stream *index_stream;
     int modebuffer[2];
+    TableReadQueue queue;
 } Pointer;
 
 static void
@@ -3071,7 +3114,8 @@ Pointer_readframes_a(Pointer *self) {
     MYFLT fpart;
     double ph;
     int i, ipart;
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *pha = Stream_getData((Stream *)self->index_stream);
@@ -3080,8 +3124,16 @@ Pointer_readframes_a(Pointer *self) {
         ph = Osc_clip(pha[i] * size, size);
         ipart = (int)ph;
         fpart = ph - ipart;
-        self->data[i] = tablelist[ipart] + (tablelist[ipart+1] - tablelist[ipart]) * fpart;
+        if (packed) {
+            self->data[i] = 0.0;
+            TableReadQueue_push(&self->queue, ipart, fpart, 1.0, i);
+        }
+        else
+            self->data[i] = tablelist[ipart] + (tablelist[ipart+1] - tablelist[ipart]) * fpart;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, linear, self->data);
 }
 
 static void Pointer_postprocessing_ii(Pointer *self) { POST_PROCESSING_II };
@@ -3164,6 +3216,7 @@ static void
 Pointer_dealloc(Pointer* self)
 {
     pyo_DEALLOC
+    TableReadQueue_free(&self->queue);
     Pointer_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -3193,7 +3246,11 @@ Pointer_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         Py_RETURN_NONE;
     }
     Py_XDECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tabletmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tabletmp);
+    if (TableReadQueue_reserve(&self->queue, self->bufsize) < 0) {
+        PyErr_NoMemory();
+        Py_RETURN_NONE;
+    }
 
     if (indextmp) {
         PyObject_CallMethod((PyObject *)self, "setIndex", "O", indextmp);
@@ -3251,7 +3308,7 @@ Pointer_setTable(Pointer *self, PyObject *arg)
 
 	tmp = arg;
 	Py_DECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tmp);
 
 	Py_INCREF(Py_None);
 	return Py_None;
@@ -5386,13 +5443,15 @@ typedef struct {
     int init;
     int interp; /* 0 = default to 2, 1 = nointerp, 2 = linear, 3 = cos, 4 = cubic */
     MYFLT (*interp_func_ptr)(MYFLT *, int, MYFLT, int);
+    TableReadQueue queue;
 } TableRead;
 
 static void
 TableRead_readframes_i(TableRead *self) {
     MYFLT fr, inc, fpart;
     int i, ipart;
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     fr = PyFloat_AS_DOUBLE(self->freq);
@@ -5420,20 +5479,29 @@ TableRead_readframes_i(TableRead *self) {
         if (self->go == 1) {
             ipart = (int)self->pointerPos;
             fpart = self->pointerPos - ipart;
-            self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
+            if (packed) {
+                self->data[i] = 0.0;
+                TableReadQueue_push(&self->queue, ipart, fpart, 1.0, i);
+            }
+            else
+                self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
         }
         else
             self->data[i] = 0.0;
 
         self->pointerPos += inc;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, self->interp_func_ptr, self->data);
 }
 
 static void
 TableRead_readframes_a(TableRead *self) {
     MYFLT inc, fpart, sizeOnSr;
     int i, ipart;
-    MYFLT *tablelist = TableStream_getData(self->table);
+    int packed = TableStream_isPacked(self->table);
+    MYFLT *tablelist = packed ? NULL : TableStream_getData(self->table);
     int size = TableStream_getSize(self->table);
 
     MYFLT *fr = Stream_getData((Stream *)self->freq_stream);
@@ -5462,7 +5530,12 @@ TableRead_readframes_a(TableRead *self) {
         if (self->go == 1) {
             ipart = (int)self->pointerPos;
             fpart = self->pointerPos - ipart;
-            self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
+            if (packed) {
+                self->data[i] = 0.0;
+                TableReadQueue_push(&self->queue, ipart, fpart, 1.0, i);
+            }
+            else
+                self->data[i] = (*self->interp_func_ptr)(tablelist, ipart, fpart, size);
         }
         else
             self->data[i] = 0.0;
@@ -5470,6 +5543,9 @@ TableRead_readframes_a(TableRead *self) {
         inc = fr[i] * sizeOnSr;
         self->pointerPos += inc;
     }
+
+    if (packed)
+        TableReadQueue_flush(&self->queue, self->table, self->interp_func_ptr, self->data);
 }
 
 static void TableRead_postprocessing_ii(TableRead *self) { POST_PROCESSING_II };
@@ -5561,6 +5637,7 @@ static void
 TableRead_dealloc(TableRead* self)
 {
     pyo_DEALLOC
+    TableReadQueue_free(&self->queue);
     free(self->trigsBuffer);
     TableRead_clear(self);
     self->ob_type->tp_free((PyObject*)self);
@@ -5598,7 +5675,11 @@ TableRead_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         Py_RETURN_NONE;
     }
     Py_XDECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tabletmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tabletmp);
+    if (TableReadQueue_reserve(&self->queue, self->bufsize) < 0) {
+        PyErr_NoMemory();
+        Py_RETURN_NONE;
+    }
 
     if (freqtmp) {
         PyObject_CallMethod((PyObject *)self, "setFreq", "O", freqtmp);
@@ -5692,7 +5773,7 @@ TableRead_setTable(TableRead *self, PyObject *arg)
 
 	tmp = arg;
 	Py_DECREF(self->table);
-    self->table = PyObject_CallMethod((PyObject *)tmp, "getTableStream", "");
+    self->table = GET_PACKED_TABLE_STREAM(tmp);
 
 	Py_INCREF(Py_None);
 	return Py_None;
@@ -5901,14 +5982,14 @@ typedef struct {
     PyObject *index;
     Stream *index_stream;
     int modebuffer[5];
-    MYFLT pointerPos_car;
-    MYFLT pointerPos_mod;
-    MYFLT scaleFactor;
+    MYSTATE pointerPos_car;
+    MYSTATE pointerPos_mod;
+    MYSTATE scaleFactor;
 } Fm;
 
 static void
 Fm_readframes_iii(Fm *self) {
-    MYFLT mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
+    MYSTATE mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
     int i, ipart;
 
     MYFLT car = PyFloat_AS_DOUBLE(self->car);
@@ -5938,7 +6019,7 @@ Fm_readframes_iii(Fm *self) {
 
 static void
 Fm_readframes_aii(Fm *self) {
-    MYFLT mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
+    MYSTATE mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
     int i, ipart;
 
     MYFLT *car = Stream_getData((Stream *)self->car_stream);
@@ -5967,7 +6048,7 @@ Fm_readframes_aii(Fm *self) {
 
 static void
 Fm_readframes_iai(Fm *self) {
-    MYFLT mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
+    MYSTATE mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
     int i, ipart;
 
     MYFLT car = PyFloat_AS_DOUBLE(self->car);
@@ -5996,7 +6077,7 @@ Fm_readframes_iai(Fm *self) {
 
 static void
 Fm_readframes_aai(Fm *self) {
-    MYFLT mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
+    MYSTATE mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
     int i, ipart;
 
     MYFLT *car = Stream_getData((Stream *)self->car_stream);
@@ -6024,7 +6105,7 @@ Fm_readframes_aai(Fm *self) {
 
 static void
 Fm_readframes_iia(Fm *self) {
-    MYFLT mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
+    MYSTATE mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
     int i, ipart;
 
     MYFLT car = PyFloat_AS_DOUBLE(self->car);
@@ -6054,7 +6135,7 @@ Fm_readframes_iia(Fm *self) {
 
 static void
 Fm_readframes_aia(Fm *self) {
-    MYFLT mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
+    MYSTATE mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
     int i, ipart;
 
     MYFLT *car = Stream_getData((Stream *)self->car_stream);
@@ -6083,7 +6164,7 @@ Fm_readframes_aia(Fm *self) {
 
 static void
 Fm_readframes_iaa(Fm *self) {
-    MYFLT mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
+    MYSTATE mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
     int i, ipart;
 
     MYFLT car = PyFloat_AS_DOUBLE(self->car);
@@ -6112,7 +6193,7 @@ Fm_readframes_iaa(Fm *self) {
 
 static void
 Fm_readframes_aaa(Fm *self) {
-    MYFLT mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
+    MYSTATE mod_freq, mod_amp, mod_delta, mod_val, car_freq, car_delta, fpart;
     int i, ipart;
 
     MYFLT *car = Stream_getData((Stream *)self->car_stream);
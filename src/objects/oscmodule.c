@@ -21,6 +21,9 @@
 #include <Python.h>
 #include "structmember.h"
 #include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/time.h>
 #include "pyomodule.h"
 #include "streammodule.h"
 #include "servermodule.h"
@@ -542,17 +545,337 @@ PyTypeObject OscReceiveType = {
     OscReceive_new,                 /* tp_new */
 };
 
+/* Background OSC sender shared by OscSend and OscDataSend.
+ *
+ * Audio objects never touch the network: they post values (or ready-made
+ * messages) in a ring buffer, which is drained by a network thread. Every
+ * producer holds the GIL (the audio callback and the python methods), so
+ * the ring has a single producer and a single consumer and needs no lock.
+ * At each cycle, the network thread keeps only the last value of each
+ * sender (coalescing), applies the per-sender rate limit and groups the
+ * messages for the same destination in OSC bundles, each one small enough
+ * to fit in a single UDP datagram. Senders can also ask for plain messages.
+ * The thread is started by the first sender and joined when the last one
+ * is removed. */
+#define OSC_QUEUE_SIZE 8192
+#define OSC_SENDER_PERIOD 1000 /* network thread polling period, in microseconds */
+/* Largest bundle sent, in bytes: an ethernet MTU (1500) minus the IPv6
+ * and UDP headers. A bigger message is sent alone. */
+#define OSC_MAX_BUNDLE_SIZE 1452
+#define OSC_BUNDLE_HEADER_SIZE 16 /* "#bundle" string and time tag */
+
+typedef struct OscSendSlot {
+    lo_address address;
+    char *host;
+    int port;
+    char *path;
+    double interval; /* minimum time between two messages, in seconds */
+    int bundle; /* 0 = plain messages */
+    /* owned by the network thread */
+    int pending;
+    float value;
+    double last_time;
+    struct OscSendSlot *next;
+    /* statistics */
+    volatile long sent;
+    volatile long coalesced;
+    volatile long dropped;
+} OscSendSlot;
+
+enum { OSC_ITEM_ADD, OSC_ITEM_VALUE, OSC_ITEM_MESSAGE, OSC_ITEM_REMOVE };
+
+typedef struct {
+    int kind;
+    OscSendSlot *slot;
+    float value;
+    lo_message msg;
+} OscQueueItem;
+
+typedef struct {
+    OscSendSlot *slot; /* first sender found for this destination */
+    lo_bundle bundle;
+    size_t size; /* size of the bundle, in bytes */
+} OscDestination;
+
+static OscQueueItem osc_queue[OSC_QUEUE_SIZE];
+static volatile long osc_queue_head = 0;
+static volatile long osc_queue_tail = 0;
+static pthread_t osc_sender_thread;
+static int osc_sender_running = 0;
+static int osc_sender_users = 0; /* number of slots, the thread runs while > 0 */
+static volatile int osc_sender_quit = 0;
+
+static double
+OscSender_now(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 0.000001;
+}
+
+/* Called with the GIL held. Returns -1 if the queue is full. */
+static int
+OscSender_post(int kind, OscSendSlot *slot, float value, lo_message msg)
+{
+    OscQueueItem *item;
+    long head = osc_queue_head;
+
+    if ((head - osc_queue_tail) >= OSC_QUEUE_SIZE) {
+        slot->dropped++;
+        return -1;
+    }
+    item = &osc_queue[head % OSC_QUEUE_SIZE];
+    item->kind = kind;
+    item->slot = slot;
+    item->value = value;
+    item->msg = msg;
+    __sync_synchronize();
+    osc_queue_head = head + 1;
+    return 0;
+}
+
+static OscDestination *
+OscSender_getDestination(OscDestination *dests, int *numdests, OscSendSlot *slot)
+{
+    int i;
+    OscSendSlot *other;
+
+    for (i=0; i<*numdests; i++) {
+        other = dests[i].slot;
+        if (other->port == slot->port && strcmp(other->host, slot->host) == 0)
+            return &dests[i];
+    }
+    dests[i].slot = slot;
+    dests[i].bundle = NULL;
+    dests[i].size = 0;
+    (*numdests)++;
+    return &dests[i];
+}
+
+static void
+OscSender_flush(OscDestination *dest)
+{
+    if (dest->bundle == NULL)
+        return;
+    if (lo_send_bundle(dest->slot->address, dest->bundle) == -1) {
+        printf("OSC error %d: %s\n", lo_address_errno(dest->slot->address), lo_address_errstr(dest->slot->address));
+    }
+    lo_bundle_free_messages(dest->bundle);
+    dest->bundle = NULL;
+    dest->size = 0;
+}
+
+/* Sends `msg`, or adds it to the bundle of its destination. Takes ownership of `msg`. */
+static void
+OscSender_send(OscDestination *dests, int *numdests, OscSendSlot *slot, lo_message msg)
+{
+    size_t len;
+    OscDestination *dest;
+
+    slot->sent++;
+    /* Each bundle element is preceded by its size. */
+    len = lo_message_length(msg, slot->path) + 4;
+
+    if (!slot->bundle || (len + OSC_BUNDLE_HEADER_SIZE) > OSC_MAX_BUNDLE_SIZE) {
+        if (lo_send_message(slot->address, slot->path, msg) == -1) {
+            printf("OSC error %d: %s\n", lo_address_errno(slot->address), lo_address_errstr(slot->address));
+        }
+        lo_message_free(msg);
+        return;
+    }
+
+    dest = OscSender_getDestination(dests, numdests, slot);
+    if (dest->bundle != NULL && (dest->size + len) > OSC_MAX_BUNDLE_SIZE)
+        OscSender_flush(dest);
+    if (dest->bundle == NULL) {
+        dest->bundle = lo_bundle_new(LO_TT_IMMEDIATE);
+        dest->size = OSC_BUNDLE_HEADER_SIZE;
+    }
+    lo_bundle_add_message(dest->bundle, slot->path, msg);
+    dest->size += len;
+}
+
+static void
+OscSender_freeSlot(OscSendSlot *slot)
+{
+    lo_address_free(slot->address);
+    free(slot->host);
+    free(slot->path);
+    free(slot);
+}
+
+static void *
+OscSender_run(void *arg)
+{
+    int i, quit, numslots = 0, numdests, maxdests = 0;
+    long head;
+    double now;
+    lo_message msg;
+    OscQueueItem *item;
+    OscSendSlot *slot, *prev, *slots = NULL, *trash = NULL;
+    OscDestination *dests = NULL, *tmp;
+
+    for (;;) {
+        numdests = 0;
+        now = OscSender_now();
+        /* Read before the queue: items posted before the request are sent. */
+        quit = osc_sender_quit;
+        __sync_synchronize();
+        head = osc_queue_head;
+        __sync_synchronize();
+
+        /* Reserve one destination per possible sender in this cycle. */
+        if ((numslots + head - osc_queue_tail) > maxdests) {
+            tmp = (OscDestination *)realloc(dests, (numslots + head - osc_queue_tail) * sizeof(OscDestination));
+            if (tmp == NULL) {
+                usleep(OSC_SENDER_PERIOD);
+                continue;
+            }
+            dests = tmp;
+            maxdests = numslots + head - osc_queue_tail;
+        }
+
+        while (osc_queue_tail < head) {
+            item = &osc_queue[osc_queue_tail % OSC_QUEUE_SIZE];
+            slot = item->slot;
+            switch (item->kind) {
+                case OSC_ITEM_ADD:
+                    slot->next = slots;
+                    slots = slot;
+                    numslots++;
+                    break;
+                case OSC_ITEM_VALUE:
+                    if (slot->pending)
+                        slot->coalesced++;
+                    slot->value = item->value;
+                    slot->pending = 1;
+                    break;
+                case OSC_ITEM_MESSAGE:
+                    /* Data messages are events, they are never coalesced. */
+                    OscSender_send(dests, &numdests, slot, item->msg);
+                    break;
+                case OSC_ITEM_REMOVE:
+                    for (prev=NULL, slot=slots; slot!=NULL; prev=slot, slot=slot->next) {
+                        if (slot == item->slot) {
+                            if (prev == NULL)
+                                slots = slot->next;
+                            else
+                                prev->next = slot->next;
+                            numslots--;
+                            break;
+                        }
+                    }
+                    /* Freed after sending, its path may be used by a bundle. */
+                    item->slot->next = trash;
+                    trash = item->slot;
+                    break;
+            }
+            __sync_synchronize();
+            osc_queue_tail++;
+        }
+
+        for (slot=slots; slot!=NULL; slot=slot->next) {
+            if (slot->pending && (now - slot->last_time) >= slot->interval) {
+                msg = lo_message_new();
+                lo_message_add_float(msg, slot->value);
+                OscSender_send(dests, &numdests, slot, msg);
+                slot->pending = 0;
+                slot->last_time = now;
+            }
+        }
+
+        for (i=0; i<numdests; i++) {
+            OscSender_flush(&dests[i]);
+        }
+
+        while (trash != NULL) {
+            slot = trash;
+            trash = slot->next;
+            OscSender_freeSlot(slot);
+        }
+
+        if (quit)
+            break;
+
+        usleep(slots == NULL ? OSC_SENDER_PERIOD * 20 : OSC_SENDER_PERIOD);
+    }
+    free(dests);
+    return NULL;
+}
+
+/* Creates a sender slot and registers it to the network thread. */
+static OscSendSlot *
+OscSender_newSlot(char *host, int port, char *path)
+{
+    char buf[20];
+    OscSendSlot *slot = (OscSendSlot *)calloc(1, sizeof(OscSendSlot));
+
+    sprintf(buf, "%i", port);
+    slot->address = lo_address_new(host, buf);
+    slot->host = strdup(host == NULL ? "" : host);
+    slot->port = port;
+    slot->path = strdup(path);
+    slot->bundle = 1;
+
+    if (!osc_sender_running) {
+        if (pthread_create(&osc_sender_thread, NULL, OscSender_run, NULL) == 0)
+            osc_sender_running = 1;
+        else
+            printf("OSC error: can't start the network thread.\n");
+    }
+    osc_sender_users++;
+
+    while (OscSender_post(OSC_ITEM_ADD, slot, 0.0, NULL) < 0 && osc_sender_running)
+        usleep(OSC_SENDER_PERIOD);
+    slot->dropped = 0;
+    return slot;
+}
+
+static void
+OscSender_removeSlot(OscSendSlot *slot)
+{
+    if (slot == NULL)
+        return;
+    while (OscSender_post(OSC_ITEM_REMOVE, slot, 0.0, NULL) < 0 && osc_sender_running)
+        usleep(OSC_SENDER_PERIOD);
+
+    /* Last sender: the thread sends what is left in the queue and exits. */
+    if (--osc_sender_users == 0 && osc_sender_running) {
+        osc_sender_quit = 1;
+        __sync_synchronize();
+        pthread_join(osc_sender_thread, NULL);
+        osc_sender_running = 0;
+        osc_sender_quit = 0;
+    }
+}
+
+static PyObject *
+OscSender_setBundle(OscSendSlot *slot, PyObject *arg)
+{
+    if (arg != NULL && slot != NULL)
+        slot->bundle = PyObject_IsTrue(arg);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+OscSender_getStats(OscSendSlot *slot)
+{
+    if (slot == NULL)
+        return Py_BuildValue("(lll)", 0, 0, 0);
+    return Py_BuildValue("(lll)", slot->sent, slot->coalesced, slot->dropped);
+}
+
 /* OSC send object */
 typedef struct {
     pyo_audio_HEAD
     PyObject *input;
     Stream *input_stream;
-    PyObject *address_path;
-    lo_address address;
-    char *host;
-    int port;
+    OscSendSlot *slot;
     int count;
     int bufrate;
+    int changes;
+    int has_sent; /* 0 until a first value is posted, for `changes` */
+    float last_value;
 } OscSend;
 
 static void
@@ -564,10 +887,11 @@ OscSend_compute_next_data_frame(OscSend *self)
         MYFLT *in = Stream_getData((Stream *)self->input_stream);
         float value = (float)in[0];
 
-        char *path  = PyString_AsString(self->address_path);
-
-        if (lo_send(self->address, path, "f", value) == -1) {
-            printf("OSC error %d: %s\n", lo_address_errno(self->address), lo_address_errstr(self->address));
+        if (self->changes && self->has_sent && value == self->last_value)
+            return;
+        if (OscSender_post(OSC_ITEM_VALUE, self->slot, value, NULL) == 0) {
+            self->last_value = value;
+            self->has_sent = 1;
         }
     }
 }
@@ -576,7 +900,6 @@ static int
 OscSend_traverse(OscSend *self, visitproc visit, void *arg)
 {
     pyo_VISIT
-    Py_VISIT(self->address_path);
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
     return 0;
@@ -586,7 +909,6 @@ static int
 OscSend_clear(OscSend *self)
 {
     pyo_CLEAR
-    Py_CLEAR(self->address_path);
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
     return 0;
@@ -596,6 +918,7 @@ static void
 OscSend_dealloc(OscSend* self)
 {
     pyo_DEALLOC
+    OscSender_removeSlot(self->slot);
     OscSend_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -603,21 +926,23 @@ OscSend_dealloc(OscSend* self)
 static PyObject *
 OscSend_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
-    int i;
+    int i, port;
+    char *host = NULL;
     PyObject *inputtmp, *input_streamtmp, *pathtmp;
     OscSend *self;
     self = (OscSend *)type->tp_alloc(type, 0);
 
-    self->host = NULL;
     self->count = 0;
     self->bufrate = 1;
+    self->changes = 0;
+    self->has_sent = 0;
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, OscSend_compute_next_data_frame);
 
     static char *kwlist[] = {"input", "port", "address", "host", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OiO|s", kwlist, &inputtmp, &self->port, &pathtmp, &self->host))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OiO|s", kwlist, &inputtmp, &port, &pathtmp, &host))
         Py_RETURN_NONE;
 
     INIT_INPUT_STREAM
@@ -629,13 +954,7 @@ OscSend_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         Py_RETURN_NONE;
     }
 
-    Py_INCREF(pathtmp);
-    Py_XDECREF(self->address_path);
-    self->address_path = pathtmp;
-
-    char buf[20];
-    sprintf(buf, "%i", self->port);
-    self->address = lo_address_new(self->host, buf);
+    self->slot = OscSender_newSlot(host, port, PyString_AsString(pathtmp));
 
     return (PyObject *)self;
 }
@@ -656,6 +975,40 @@ OscSend_setBufferRate(OscSend *self, PyObject *arg)
 	return Py_None;
 }
 
+static PyObject *
+OscSend_setChanges(OscSend *self, PyObject *arg)
+{
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+    self->changes = PyObject_IsTrue(arg);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+OscSend_setMaxRate(OscSend *self, PyObject *arg)
+{
+    double rate;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+    rate = PyFloat_AsDouble(arg);
+    self->slot->interval = rate > 0.0 ? 1.0 / rate : 0.0;
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject * OscSend_setBundle(OscSend *self, PyObject *arg) { return OscSender_setBundle(self->slot, arg); };
+static PyObject * OscSend_getStats(OscSend *self) { return OscSender_getStats(self->slot); };
+
 static PyObject * OscSend_getServer(OscSend* self) { GET_SERVER };
 static PyObject * OscSend_getStream(OscSend* self) { GET_STREAM };
 
@@ -675,6 +1028,10 @@ static PyMethodDef OscSend_methods[] = {
 {"play", (PyCFunction)OscSend_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
 {"stop", (PyCFunction)OscSend_stop, METH_NOARGS, "Stops computing."},
 {"setBufferRate", (PyCFunction)OscSend_setBufferRate, METH_O, "Set how many buffers to wait before sending a new value."},
+{"setChanges", (PyCFunction)OscSend_setChanges, METH_O, "If True, values are sent only when they change."},
+{"setMaxRate", (PyCFunction)OscSend_setMaxRate, METH_O, "Sets the maximum number of messages sent per second."},
+{"setBundle", (PyCFunction)OscSend_setBundle, METH_O, "If True, messages are grouped in OSC bundles."},
+{"getStats", (PyCFunction)OscSend_getStats, METH_NOARGS, "Returns the number of sent, coalesced and dropped messages."},
 {NULL}  /* Sentinel */
 };
 
@@ -723,91 +1080,19 @@ OscSend_new,                 /* tp_new */
 /* OscDataSend object */
 typedef struct {
     pyo_audio_HEAD
-    PyObject *value;
-    PyObject *address_path;
-    lo_address address;
-    char *host;
+    OscSendSlot *slot;
+    lo_message msg; /* built by send(), posted at the next buffer */
     char *types;
-    int port;
-    int something_to_send;
     int num_items;
 } OscDataSend;
 
 static void
 OscDataSend_compute_next_data_frame(OscDataSend *self)
 {
-    int i, j = 0;
-    Py_ssize_t blobsize = 0;
-    PyObject *datalist = NULL;
-    char *blobdata = NULL;
-    uint8_t midi[4];
-    lo_blob *blob = NULL;
-    
-    lo_message *msg;
-    char *path  = PyString_AsString(self->address_path);
-
-    if (self->something_to_send == 1) {
-        msg = lo_message_new();
-
-        for (i=0; i<self->num_items; i++) {
-            switch (self->types[i]) {
-                case LO_INT32:
-                    lo_message_add_int32(msg, PyInt_AS_LONG(PyList_GET_ITEM(self->value, i)));
-                    break;
-                case LO_INT64:
-                    lo_message_add_int64(msg, (long)PyLong_AsLong(PyList_GET_ITEM(self->value, i)));
-                    break;
-                case LO_FLOAT:
-                    lo_message_add_float(msg, PyFloat_AS_DOUBLE(PyList_GET_ITEM(self->value, i)));
-                    break;
-                case LO_DOUBLE:
-                    lo_message_add_double(msg, (double)PyFloat_AS_DOUBLE(PyList_GET_ITEM(self->value, i)));
-                    break;
-                case LO_STRING:
-                    lo_message_add_string(msg, PyString_AsString(PyList_GET_ITEM(self->value, i)));
-                    break;
-                case LO_CHAR:
-                    lo_message_add_char(msg, (char)PyString_AsString(PyList_GET_ITEM(self->value, i))[0]);
-                    break;
-                case LO_BLOB:
-                    datalist = PyList_GET_ITEM(self->value, i);
-                    blobsize = PyList_Size(datalist);
-                    blobdata = (char *)malloc(blobsize * sizeof(char));
-                    for (j=0; j<blobsize; j++) {
-                        blobdata[j] = (char)PyString_AsString(PyList_GET_ITEM(datalist, j))[0];
-                    }
-                    blob = lo_blob_new(blobsize * sizeof(char), blobdata);
-                    lo_message_add_blob(msg, blob);
-                    break;
-                case LO_MIDI:
-                    datalist = PyList_GET_ITEM(self->value, i);
-                    for (j=0; j<4; j++) {
-                        midi[j] = (uint8_t)PyInt_AS_LONG(PyList_GET_ITEM(datalist, j));
-                    }
-                    lo_message_add_midi(msg, midi);
-                    break;
-                case LO_NIL:
-                    lo_message_add_nil(msg);
-                    break;
-                case LO_TRUE:
-                    lo_message_add_true(msg);
-                    break;
-                case LO_FALSE:
-                    lo_message_add_false(msg);
-                    break;
-                default:
-                    break;
-            }
-        }
-        if (lo_send_message(self->address, path, msg) == -1) {
-            printf("OSC error %d: %s\n", lo_address_errno(self->address), lo_address_errstr(self->address));
-        }
-        self->something_to_send = 0;
-        lo_message_free(msg);
-        if (blob != NULL)
-            lo_blob_free(blob);
-        if (blobdata != NULL)
-            free(blobdata);
+    if (self->msg != NULL) {
+        if (OscSender_post(OSC_ITEM_MESSAGE, self->slot, 0.0, self->msg) < 0)
+            lo_message_free(self->msg);
+        self->msg = NULL;
     }
 }
 
@@ -815,8 +1100,6 @@ static int
 OscDataSend_traverse(OscDataSend *self, visitproc visit, void *arg)
 {
     pyo_VISIT
-    Py_VISIT(self->value);
-    Py_VISIT(self->address_path);
     return 0;
 }
 
@@ -824,8 +1107,6 @@ static int
 OscDataSend_clear(OscDataSend *self)
 {
     pyo_CLEAR
-    Py_CLEAR(self->value);
-    Py_CLEAR(self->address_path);
     return 0;
 }
 
@@ -833,6 +1114,9 @@ static void
 OscDataSend_dealloc(OscDataSend* self)
 {
     pyo_DEALLOC
+    if (self->msg != NULL)
+        lo_message_free(self->msg);
+    OscSender_removeSlot(self->slot);
     OscDataSend_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -840,19 +1124,20 @@ OscDataSend_dealloc(OscDataSend* self)
 static PyObject *
 OscDataSend_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
-    int i;
+    int i, port;
+    char *host = NULL;
     PyObject *pathtmp;
     OscDataSend *self;
     self = (OscDataSend *)type->tp_alloc(type, 0);
 
-    self->host = NULL;
+    self->msg = NULL;
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, OscDataSend_compute_next_data_frame);
 
     static char *kwlist[] = {"types", "port", "address", "host", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "siO|s", kwlist, &self->types, &self->port, &pathtmp, &self->host))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "siO|s", kwlist, &self->types, &port, &pathtmp, &host))
         Py_RETURN_NONE;
 
     PyObject_CallMethod(self->server, "addStream", "O", self->stream);
@@ -864,13 +1149,7 @@ OscDataSend_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     self->num_items = strlen(self->types);
 
-    Py_INCREF(pathtmp);
-    Py_XDECREF(self->address_path);
-    self->address_path = pathtmp;
-
-    char buf[20];
-    sprintf(buf, "%i", self->port);
-    self->address = lo_address_new(self->host, buf);
+    self->slot = OscSender_newSlot(host, port, PyString_AsString(pathtmp));
 
     return (PyObject *)self;
 }
@@ -884,27 +1163,95 @@ static PyObject * OscDataSend_stop(OscDataSend *self) { STOP };
 static PyObject *
 OscDataSend_send(OscDataSend *self, PyObject *arg)
 {
-    PyObject *tmp;
+    int i, j;
+    Py_ssize_t blobsize = 0;
+    PyObject *datalist = NULL;
+    char *blobdata = NULL;
+    uint8_t midi[4];
+    lo_blob *blob = NULL;
+    lo_message *msg;
 
 	if (arg == NULL) {
 		Py_INCREF(Py_None);
 		return Py_None;
 	}
 
-    if (PyList_Check(arg)) {
-        tmp = arg;
-        Py_XDECREF(self->value);
-        Py_INCREF(tmp);
-        self->value = tmp;
-        self->something_to_send = 1;
-    }
-    else
+    if (! PyList_Check(arg)) {
         printf("argument to send() method must be a list of values.\n");
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    msg = lo_message_new();
+
+    for (i=0; i<self->num_items; i++) {
+        switch (self->types[i]) {
+            case LO_INT32:
+                lo_message_add_int32(msg, PyInt_AS_LONG(PyList_GET_ITEM(arg, i)));
+                break;
+            case LO_INT64:
+                lo_message_add_int64(msg, (long)PyLong_AsLong(PyList_GET_ITEM(arg, i)));
+                break;
+            case LO_FLOAT:
+                lo_message_add_float(msg, PyFloat_AS_DOUBLE(PyList_GET_ITEM(arg, i)));
+                break;
+            case LO_DOUBLE:
+                lo_message_add_double(msg, (double)PyFloat_AS_DOUBLE(PyList_GET_ITEM(arg, i)));
+                break;
+            case LO_STRING:
+                lo_message_add_string(msg, PyString_AsString(PyList_GET_ITEM(arg, i)));
+                break;
+            case LO_CHAR:
+                lo_message_add_char(msg, (char)PyString_AsString(PyList_GET_ITEM(arg, i))[0]);
+                break;
+            case LO_BLOB:
+                datalist = PyList_GET_ITEM(arg, i);
+                blobsize = PyList_Size(datalist);
+                blobdata = (char *)malloc(blobsize * sizeof(char));
+                for (j=0; j<blobsize; j++) {
+                    blobdata[j] = (char)PyString_AsString(PyList_GET_ITEM(datalist, j))[0];
+                }
+                blob = lo_blob_new(blobsize * sizeof(char), blobdata);
+                lo_message_add_blob(msg, blob);
+                /* The message keeps its own copy of the blob. */
+                lo_blob_free(blob);
+                free(blobdata);
+                break;
+            case LO_MIDI:
+                datalist = PyList_GET_ITEM(arg, i);
+                for (j=0; j<4; j++) {
+                    midi[j] = (uint8_t)PyInt_AS_LONG(PyList_GET_ITEM(datalist, j));
+                }
+                lo_message_add_midi(msg, midi);
+                break;
+            case LO_NIL:
+                lo_message_add_nil(msg);
+                break;
+            case LO_TRUE:
+                lo_message_add_true(msg);
+                break;
+            case LO_FALSE:
+                lo_message_add_false(msg);
+                break;
+            default:
+                break;
+        }
+    }
+
+    /* Only the last message given during a buffer is sent. */
+    if (self->msg != NULL) {
+        lo_message_free(self->msg);
+        self->slot->coalesced++;
+    }
+    self->msg = msg;
 
 	Py_INCREF(Py_None);
 	return Py_None;
 }
 
+static PyObject * OscDataSend_setBundle(OscDataSend *self, PyObject *arg) { return OscSender_setBundle(self->slot, arg); };
+static PyObject * OscDataSend_getStats(OscDataSend *self) { return OscSender_getStats(self->slot); };
+
 static PyMemberDef OscDataSend_members[] = {
     {"server", T_OBJECT_EX, offsetof(OscDataSend, server), 0, "Pyo server."},
     {"stream", T_OBJECT_EX, offsetof(OscDataSend, stream), 0, "Stream object."},
@@ -915,6 +1262,8 @@ static PyMethodDef OscDataSend_methods[] = {
     {"getServer", (PyCFunction)OscDataSend_getServer, METH_NOARGS, "Returns server object."},
     {"_getStream", (PyCFunction)OscDataSend_getStream, METH_NOARGS, "Returns stream object."},
     {"send", (PyCFunction)OscDataSend_send, METH_O, "Sets values to be sent."},
+    {"setBundle", (PyCFunction)OscDataSend_setBundle, METH_O, "If True, messages are grouped in OSC bundles."},
+    {"getStats", (PyCFunction)OscDataSend_getStats, METH_NOARGS, "Returns the number of sent, coalesced and dropped messages."},
     {"play", (PyCFunction)OscDataSend_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
     {"stop", (PyCFunction)OscDataSend_stop, METH_NOARGS, "Stops computing."},
     {NULL}  /* Sentinel */
@@ -1046,7 +1395,9 @@ int OscDataReceive_handler(const char *path, const char *types, lo_arg **argv, i
                     break;
             }
         }
+        Server_traceCallable((Server *)self->server, 'B', self->callable);
         result = PyObject_Call(self->callable, tup, NULL);
+        Server_traceCallable((Server *)self->server, 'E', self->callable);
         if (result == NULL)
             PyErr_Print();
     }
@@ -55,7 +55,9 @@ Pattern_generate_i(Pattern *self) {
     }
     if (flag == 1 || self->init == 1) {
         self->init = 0;
+        Server_traceCallable((Server *)self->server, 'B', self->callable);
         result = PyObject_Call((PyObject *)self->callable, PyTuple_New(0), NULL);
+        Server_traceCallable((Server *)self->server, 'E', self->callable);
         if (result == NULL)
             PyErr_Print();
     }
@@ -79,7 +81,9 @@ Pattern_generate_a(Pattern *self) {
     }
     if (flag == 1 || self->init == 1) {
         self->init = 0;
+        Server_traceCallable((Server *)self->server, 'B', self->callable);
         result = PyObject_Call((PyObject *)self->callable, PyTuple_New(0), NULL);
+        Server_traceCallable((Server *)self->server, 'E', self->callable);
         if (result == NULL)
             PyErr_Print();
     }
@@ -481,7 +485,9 @@ CallAfter_generate(CallAfter *self) {
                 tuple = PyTuple_New(1);
                 PyTuple_SET_ITEM(tuple, 0, self->arg);
             }
+            Server_traceCallable((Server *)self->server, 'B', self->callable);
             result = PyObject_Call(self->callable, tuple, NULL);
+            Server_traceCallable((Server *)self->server, 'E', self->callable);
             if (result == NULL)
                 PyErr_Print();
             PyObject_CallMethod((PyObject *)self, "stop", NULL);
@@ -30,6 +30,19 @@
 #include "fft.h"
 #include "wind.h"
 
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+
+/* Bytes held by an object's output frames, [olaps][hsize] magnitudes and
+** frequencies, and by its count buffer. */
+#define PV_FRAMES_MEMORY \
+    (self->olaps * (sizeof(MYFLT *) * 2 + self->hsize * sizeof(MYFLT) * 2) + self->bufsize * sizeof(int))
+
+/* Bytes held by the numFrames recorded frames of the buffering objects. */
+#define PV_BUFFER_MEMORY \
+    (self->numFrames * (sizeof(MYFLT *) * 2 + self->hsize * sizeof(MYFLT) * 2))
+
 static int
 isPowerOfTwo(int x) {
     return (x != 0) && ((x & (x - 1)) == 0);
@@ -166,6 +179,11 @@ PVAnal_compute_next_data_frame(PVAnal *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVAnal_memory(PVAnal *self) {
+    return PV_FRAMES_MEMORY + (4 * self->size + 3 * self->hsize + 4 * (self->size >> 3)) * sizeof(MYFLT);
+}
+
 static int
 PVAnal_traverse(PVAnal *self, visitproc visit, void *arg)
 {
@@ -226,6 +244,7 @@ PVAnal_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->wintype = 2;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVAnal_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVAnal_memory);
     self->mode_func_ptr = PVAnal_setProcMode;
 
     static char *kwlist[] = {"input", "size", "olaps", "wintype", NULL};
@@ -549,6 +568,11 @@ PVSynth_compute_next_data_frame(PVSynth *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+PVSynth_memory(PVSynth *self) {
+    return (5 * self->size + self->hopsize + 3 * self->hsize + 4 * (self->size >> 3)) * sizeof(MYFLT);
+}
+
 static int
 PVSynth_traverse(PVSynth *self, visitproc visit, void *arg)
 {
@@ -604,6 +628,7 @@ PVSynth_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->wintype = 2;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVSynth_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVSynth_memory);
     self->mode_func_ptr = PVSynth_setProcMode;
 
     static char *kwlist[] = {"input", "wintype", "mul", "add", NULL};
@@ -1021,6 +1046,11 @@ PVAddSynth_compute_next_data_frame(PVAddSynth *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+PVAddSynth_memory(PVAddSynth *self) {
+    return (3 * self->num + self->hopsize + 8193) * sizeof(MYFLT);
+}
+
 static int
 PVAddSynth_traverse(PVAddSynth *self, visitproc visit, void *arg)
 {
@@ -1075,6 +1105,7 @@ PVAddSynth_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVAddSynth_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVAddSynth_memory);
     self->mode_func_ptr = PVAddSynth_setProcMode;
 
     static char *kwlist[] = {"input", "pitch", "num", "first", "inc", "mul", "add", NULL};
@@ -1504,6 +1535,11 @@ PVTranspose_compute_next_data_frame(PVTranspose *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVTranspose_memory(PVTranspose *self) {
+    return PV_FRAMES_MEMORY;
+}
+
 static int
 PVTranspose_traverse(PVTranspose *self, visitproc visit, void *arg)
 {
@@ -1557,6 +1593,7 @@ PVTranspose_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVTranspose_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVTranspose_memory);
     self->mode_func_ptr = PVTranspose_setProcMode;
 
     static char *kwlist[] = {"input", "transpo", NULL};
@@ -2015,6 +2052,11 @@ PVVerb_compute_next_data_frame(PVVerb *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVVerb_memory(PVVerb *self) {
+    return PV_FRAMES_MEMORY + 2 * self->hsize * sizeof(MYFLT);
+}
+
 static int
 PVVerb_traverse(PVVerb *self, visitproc visit, void *arg)
 {
@@ -2075,6 +2117,7 @@ PVVerb_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVVerb_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVVerb_memory);
     self->mode_func_ptr = PVVerb_setProcMode;
 
     static char *kwlist[] = {"input", "revtime", "damp", NULL};
@@ -2507,6 +2550,11 @@ PVGate_compute_next_data_frame(PVGate *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVGate_memory(PVGate *self) {
+    return PV_FRAMES_MEMORY;
+}
+
 static int
 PVGate_traverse(PVGate *self, visitproc visit, void *arg)
 {
@@ -2565,6 +2613,7 @@ PVGate_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVGate_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVGate_memory);
     self->mode_func_ptr = PVGate_setProcMode;
 
     static char *kwlist[] = {"input", "thresh", "damp", NULL};
@@ -2904,6 +2953,11 @@ PVCross_compute_next_data_frame(PVCross *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVCross_memory(PVCross *self) {
+    return PV_FRAMES_MEMORY;
+}
+
 static int
 PVCross_traverse(PVCross *self, visitproc visit, void *arg)
 {
@@ -2961,6 +3015,7 @@ PVCross_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVCross_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVCross_memory);
     self->mode_func_ptr = PVCross_setProcMode;
 
     static char *kwlist[] = {"input", "input2", "fade", NULL};
@@ -3249,6 +3304,11 @@ PVMult_compute_next_data_frame(PVMult *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVMult_memory(PVMult *self) {
+    return PV_FRAMES_MEMORY;
+}
+
 static int
 PVMult_traverse(PVMult *self, visitproc visit, void *arg)
 {
@@ -3301,6 +3361,7 @@ PVMult_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVMult_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVMult_memory);
     self->mode_func_ptr = PVMult_setProcMode;
 
     static char *kwlist[] = {"input", "input2", NULL};
@@ -3607,6 +3668,11 @@ PVMorph_compute_next_data_frame(PVMorph *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVMorph_memory(PVMorph *self) {
+    return PV_FRAMES_MEMORY;
+}
+
 static int
 PVMorph_traverse(PVMorph *self, visitproc visit, void *arg)
 {
@@ -3664,6 +3730,7 @@ PVMorph_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVMorph_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVMorph_memory);
     self->mode_func_ptr = PVMorph_setProcMode;
 
     static char *kwlist[] = {"input", "input2", "fade", NULL};
@@ -4048,6 +4115,11 @@ PVFilter_compute_next_data_frame(PVFilter *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVFilter_memory(PVFilter *self) {
+    return PV_FRAMES_MEMORY;
+}
+
 static int
 PVFilter_traverse(PVFilter *self, visitproc visit, void *arg)
 {
@@ -4105,6 +4177,7 @@ PVFilter_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
                        1 : index between 0 and hsize are scaled over table length */
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVFilter_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVFilter_memory);
     self->mode_func_ptr = PVFilter_setProcMode;
 
     static char *kwlist[] = {"input", "table", "gain", "mode", NULL};
@@ -4527,6 +4600,11 @@ PVDelay_compute_next_data_frame(PVDelay *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVDelay_memory(PVDelay *self) {
+    return PV_FRAMES_MEMORY + PV_BUFFER_MEMORY;
+}
+
 static int
 PVDelay_traverse(PVDelay *self, visitproc visit, void *arg)
 {
@@ -4587,6 +4665,7 @@ PVDelay_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->mode = 0;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVDelay_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVDelay_memory);
     self->mode_func_ptr = PVDelay_setProcMode;
 
     static char *kwlist[] = {"input", "deltable", "feedtable", "maxdelay", "mode", NULL};
@@ -4983,6 +5062,11 @@ PVBuffer_compute_next_data_frame(PVBuffer *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVBuffer_memory(PVBuffer *self) {
+    return PV_FRAMES_MEMORY + PV_BUFFER_MEMORY;
+}
+
 static int
 PVBuffer_traverse(PVBuffer *self, visitproc visit, void *arg)
 {
@@ -5047,6 +5131,7 @@ PVBuffer_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->length = 1.0;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVBuffer_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVBuffer_memory);
     self->mode_func_ptr = PVBuffer_setProcMode;
 
     static char *kwlist[] = {"input", "index", "pitch", "length", NULL};
@@ -5399,6 +5484,11 @@ PVShift_compute_next_data_frame(PVShift *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVShift_memory(PVShift *self) {
+    return PV_FRAMES_MEMORY;
+}
+
 static int
 PVShift_traverse(PVShift *self, visitproc visit, void *arg)
 {
@@ -5452,6 +5542,7 @@ PVShift_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVShift_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVShift_memory);
     self->mode_func_ptr = PVShift_setProcMode;
 
     static char *kwlist[] = {"input", "shift", NULL};
@@ -5867,6 +5958,11 @@ PVAmpMod_compute_next_data_frame(PVAmpMod *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVAmpMod_memory(PVAmpMod *self) {
+    return PV_FRAMES_MEMORY + (self->hsize + 8193) * sizeof(MYFLT);
+}
+
 static int
 PVAmpMod_traverse(PVAmpMod *self, visitproc visit, void *arg)
 {
@@ -5927,6 +6023,7 @@ PVAmpMod_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVAmpMod_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVAmpMod_memory);
     self->mode_func_ptr = PVAmpMod_setProcMode;
 
     static char *kwlist[] = {"input", "basefreq", "spread", NULL};
@@ -6467,6 +6564,11 @@ PVFreqMod_compute_next_data_frame(PVFreqMod *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVFreqMod_memory(PVFreqMod *self) {
+    return PV_FRAMES_MEMORY + (self->hsize + 8193) * sizeof(MYFLT);
+}
+
 static int
 PVFreqMod_traverse(PVFreqMod *self, visitproc visit, void *arg)
 {
@@ -6532,6 +6634,7 @@ PVFreqMod_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVFreqMod_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVFreqMod_memory);
     self->mode_func_ptr = PVFreqMod_setProcMode;
 
     static char *kwlist[] = {"input", "basefreq", "spread", "depth", NULL};
@@ -7006,6 +7109,11 @@ PVBufLoops_compute_next_data_frame(PVBufLoops *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVBufLoops_memory(PVBufLoops *self) {
+    return PV_FRAMES_MEMORY + PV_BUFFER_MEMORY + 2 * self->hsize * sizeof(MYFLT);
+}
+
 static int
 PVBufLoops_traverse(PVBufLoops *self, visitproc visit, void *arg)
 {
@@ -7076,6 +7184,7 @@ PVBufLoops_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->length = 1.0;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVBufLoops_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVBufLoops_memory);
     self->mode_func_ptr = PVBufLoops_setProcMode;
 
     static char *kwlist[] = {"input", "low", "high", "mode", "length", NULL};
@@ -7447,6 +7556,11 @@ PVBufTabLoops_compute_next_data_frame(PVBufTabLoops *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVBufTabLoops_memory(PVBufTabLoops *self) {
+    return PV_FRAMES_MEMORY + PV_BUFFER_MEMORY + self->hsize * sizeof(MYFLT);
+}
+
 static int
 PVBufTabLoops_traverse(PVBufTabLoops *self, visitproc visit, void *arg)
 {
@@ -7505,6 +7619,7 @@ PVBufTabLoops_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->length = 1.0;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVBufTabLoops_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVBufTabLoops_memory);
     self->mode_func_ptr = PVBufTabLoops_setProcMode;
 
     static char *kwlist[] = {"input", "speed", "length", NULL};
@@ -7763,6 +7878,11 @@ PVMix_compute_next_data_frame(PVMix *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+PVMix_memory(PVMix *self) {
+    return PV_FRAMES_MEMORY;
+}
+
 static int
 PVMix_traverse(PVMix *self, visitproc visit, void *arg)
 {
@@ -7815,6 +7935,7 @@ PVMix_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->olaps = 4;
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, PVMix_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVMix_memory);
     self->mode_func_ptr = PVMix_setProcMode;
 
     static char *kwlist[] = {"input", "input2", NULL};
@@ -7975,4 +8096,497 @@ PVMix_members,                                 /* tp_members */
 0,                          /* tp_init */
 0,                                              /* tp_alloc */
 PVMix_new,                                     /* tp_new */
-};
\ No newline at end of file
+};
+/*****************/
+/**** PVRead *****/
+/*****************/
+typedef struct {
+    pyo_audio_HEAD
+    PVStream *pv_stream;
+    PyObject *speed;
+    Stream *speed_stream;
+    void *map;
+    size_t mapsize;
+    int mapped; /* 1 if map is a locked mapping, 0 if it is a heap buffer */
+    float *frames; /* numFrames * [hsize magnitudes, hsize frequencies] */
+    int numFrames;
+    double filesr;
+    double frameinc; /* File frames per output hop, filesr / sr. */
+    double pos; /* Current frame, fractional. */
+    int loop;
+    int size;
+    int olaps;
+    int hsize;
+    int hopsize;
+    int incount;
+    int inputLatency;
+    int overcount;
+    MYFLT **magn;
+    MYFLT **freq;
+    int *count;
+    int modebuffer[1];
+} PVRead;
+
+/* Maps the analysis file written by pvanalysis() in memory (reads it on
+** Windows). Returns 0 on success, -1 if the file can't be opened and -2 if
+** it is not a valid analysis file. */
+static int
+PVRead_openFile(PVRead *self, const char *path) {
+    long filesize;
+    size_t mapsize;
+    PVFileHeader hd;
+    FILE *f;
+
+    if ((f = fopen(path, "rb")) == NULL)
+        return -1;
+
+    if (fread(&hd, sizeof(PVFileHeader), 1, f) != 1 || memcmp(hd.magic, PV_FILE_MAGIC, 4) != 0 ||
+        hd.version != PV_FILE_VERSION || hd.fftsize < 16 || !isPowerOfTwo(hd.fftsize) ||
+        hd.olaps < 1 || hd.olaps >= hd.fftsize || !isPowerOfTwo(hd.olaps) ||
+        hd.hsize != hd.fftsize / 2 || hd.numframes < 0 || hd.sr <= 0.0) {
+        fclose(f);
+        return -2;
+    }
+
+    fseek(f, 0, SEEK_END);
+    filesize = ftell(f);
+    mapsize = PV_FILE_HEADER_SIZE + (size_t)hd.numframes * hd.fftsize * sizeof(float);
+    if (filesize < 0 || (size_t)filesize < mapsize) {
+        fclose(f);
+        return -2;
+    }
+
+    self->map = NULL;
+    self->mapped = 0;
+#if !defined(_WIN32)
+    /* The pages are read and locked here, the audio thread must never wait
+    ** for the disk. The mapping stays valid once the file is closed. */
+#ifdef MAP_POPULATE
+    self->map = mmap(NULL, mapsize, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fileno(f), 0);
+#else
+    self->map = mmap(NULL, mapsize, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+#endif
+    if (self->map != MAP_FAILED && mlock(self->map, mapsize) == 0)
+        self->mapped = 1;
+    else {
+        if (self->map != MAP_FAILED)
+            munmap(self->map, mapsize);
+        self->map = NULL;
+    }
+#endif
+
+    /* No mapping, or it can't be locked (RLIMIT_MEMLOCK): reads the file in a heap buffer. */
+    if (self->map == NULL) {
+        self->map = malloc(mapsize);
+        fseek(f, 0, SEEK_SET);
+        if (self->map == NULL || fread(self->map, 1, mapsize, f) != mapsize) {
+            free(self->map);
+            self->map = NULL;
+            fclose(f);
+            return -1;
+        }
+    }
+    fclose(f);
+
+    self->mapsize = mapsize;
+    self->frames = (float *)((char *)self->map + PV_FILE_HEADER_SIZE);
+    self->numFrames = hd.numframes;
+    self->filesr = hd.sr;
+    self->frameinc = hd.sr / self->sr;
+    self->size = hd.fftsize;
+    self->olaps = hd.olaps;
+    return 0;
+}
+
+static void
+PVRead_closeFile(PVRead *self) {
+    if (self->map == NULL)
+        return;
+#if !defined(_WIN32)
+    if (self->mapped)
+        munmap(self->map, self->mapsize);
+    else
+#endif
+        free(self->map);
+    self->map = NULL;
+    self->frames = NULL;
+    self->numFrames = 0;
+}
+
+static void
+PVRead_realloc_memories(PVRead *self) {
+    int i, j;
+    self->hsize = self->size / 2;
+    self->hopsize = self->size / self->olaps;
+    self->inputLatency = self->size - self->hopsize;
+    self->incount = self->inputLatency;
+    self->overcount = 0;
+    self->magn = (MYFLT **)realloc(self->magn, self->olaps * sizeof(MYFLT *));
+    self->freq = (MYFLT **)realloc(self->freq, self->olaps * sizeof(MYFLT *));
+    for (i=0; i<self->olaps; i++) {
+        self->magn[i] = (MYFLT *)malloc(self->hsize * sizeof(MYFLT));
+        self->freq[i] = (MYFLT *)malloc(self->hsize * sizeof(MYFLT));
+        for (j=0; j<self->hsize; j++)
+            self->magn[i][j] = self->freq[i][j] = 0.0;
+    }
+    for (i=0; i<self->bufsize; i++)
+        self->count[i] = self->incount;
+    PVStream_setFFTsize(self->pv_stream, self->size);
+    PVStream_setOlaps(self->pv_stream, self->olaps);
+    PVStream_setMagn(self->pv_stream, self->magn);
+    PVStream_setFreq(self->pv_stream, self->freq);
+    PVStream_setCount(self->pv_stream, self->count);
+}
+
+/* Writes the frame at the current position in the current output slot.
+** Magnitudes are interpolated between the two surrounding frames, true
+** frequencies are taken from the nearest one. */
+static void
+PVRead_readFrame(PVRead *self) {
+    int k, ipos, i0, i1, hsize = self->hsize;
+    MYFLT frac;
+    float *f0, *f1, *fr;
+    MYFLT *magn = self->magn[self->overcount];
+    MYFLT *freq = self->freq[self->overcount];
+
+    ipos = (int)floor(self->pos);
+    if (ipos < 0 || ipos >= self->numFrames) {
+        for (k=0; k<hsize; k++)
+            magn[k] = freq[k] = 0.0;
+        return;
+    }
+    frac = (MYFLT)(self->pos - ipos);
+    i0 = ipos;
+    i1 = ipos + 1;
+    if (i1 >= self->numFrames)
+        i1 = self->loop ? 0 : ipos;
+
+    f0 = self->frames + (size_t)i0 * self->size;
+    f1 = self->frames + (size_t)i1 * self->size;
+    for (k=0; k<hsize; k++)
+        magn[k] = f0[k] + (f1[k] - f0[k]) * frac;
+    fr = frac < 0.5 ? f0 + hsize : f1 + hsize;
+    for (k=0; k<hsize; k++)
+        freq[k] = fr[k];
+}
+
+static void
+PVRead_advance(PVRead *self, MYFLT speed) {
+    double n = (double)self->numFrames;
+    self->pos += speed * self->frameinc;
+    if (self->loop && n > 0) {
+        if (self->pos >= n || self->pos < 0.0) {
+            self->pos = fmod(self->pos, n);
+            if (self->pos < 0.0)
+                self->pos += n;
+            if (self->pos >= n)
+                self->pos = 0.0;
+        }
+    }
+    /* Out of the file, outputs silence but can come back with a negative speed. */
+    else if (self->pos > n)
+        self->pos = n;
+    else if (self->pos < -1.0)
+        self->pos = -1.0;
+}
+
+static void
+PVRead_process_i(PVRead *self) {
+    int i;
+    MYFLT speed = PyFloat_AS_DOUBLE(self->speed);
+
+    for (i=0; i<self->bufsize; i++) {
+        self->count[i] = self->incount;
+        self->incount++;
+        if (self->incount >= self->size) {
+            self->incount = self->inputLatency;
+            PVRead_readFrame(self);
+            PVRead_advance(self, speed);
+            self->overcount++;
+            if (self->overcount >= self->olaps)
+                self->overcount = 0;
+        }
+    }
+}
+
+static void
+PVRead_process_a(PVRead *self) {
+    int i;
+    MYFLT *speed = Stream_getData((Stream *)self->speed_stream);
+
+    for (i=0; i<self->bufsize; i++) {
+        self->count[i] = self->incount;
+        self->incount++;
+        if (self->incount >= self->size) {
+            self->incount = self->inputLatency;
+            PVRead_readFrame(self);
+            PVRead_advance(self, speed[i]);
+            self->overcount++;
+            if (self->overcount >= self->olaps)
+                self->overcount = 0;
+        }
+    }
+}
+
+static void
+PVRead_setProcMode(PVRead *self)
+{
+    int procmode;
+    procmode = self->modebuffer[0];
+
+	switch (procmode) {
+        case 0:
+            self->proc_func_ptr = PVRead_process_i;
+            break;
+        case 1:
+            self->proc_func_ptr = PVRead_process_a;
+            break;
+    }
+}
+
+static void
+PVRead_compute_next_data_frame(PVRead *self)
+{
+    (*self->proc_func_ptr)(self);
+}
+
+/* The frames are file-backed pages, only the output frames are counted. */
+static long
+PVRead_memory(PVRead *self) {
+    return PV_FRAMES_MEMORY;
+}
+
+static int
+PVRead_traverse(PVRead *self, visitproc visit, void *arg)
+{
+    pyo_VISIT
+    Py_VISIT(self->pv_stream);
+    Py_VISIT(self->speed);
+    Py_VISIT(self->speed_stream);
+    return 0;
+}
+
+static int
+PVRead_clear(PVRead *self)
+{
+    pyo_CLEAR
+    Py_CLEAR(self->pv_stream);
+    Py_CLEAR(self->speed);
+    Py_CLEAR(self->speed_stream);
+    return 0;
+}
+
+static void
+PVRead_dealloc(PVRead* self)
+{
+    int i;
+    pyo_DEALLOC
+    if (self->magn != NULL) {
+        for(i=0; i<self->olaps; i++) {
+            free(self->magn[i]);
+            free(self->freq[i]);
+        }
+    }
+    free(self->magn);
+    free(self->freq);
+    free(self->count);
+    PVRead_closeFile(self);
+    PVRead_clear(self);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+PVRead_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i, err;
+    char *path;
+    PyObject *speedtmp=NULL;
+    PVRead *self;
+    self = (PVRead *)type->tp_alloc(type, 0);
+
+    self->speed = PyFloat_FromDouble(1);
+    self->loop = 0;
+    self->modebuffer[0] = 0;
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, PVRead_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, PVRead_memory);
+    self->mode_func_ptr = PVRead_setProcMode;
+
+    static char *kwlist[] = {"path", "speed", "loop", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "s|Oi", kwlist, &path, &speedtmp, &self->loop))
+        Py_RETURN_NONE;
+
+    if ((err = PVRead_openFile(self, path)) < 0) {
+        if (err == -1)
+            PyErr_Format(PyExc_IOError, "PVRead: can't open the analysis file %s.", path);
+        else
+            PyErr_Format(PyExc_IOError, "PVRead: %s is not a valid analysis file (see pvanalysis).", path);
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    if (self->filesr != self->sr)
+        printf("PVRead : %s was analyzed at %.0f Hz and the server runs at %.0f Hz, frames are read at the analysis rate.\n",
+               path, self->filesr, self->sr);
+
+    if (speedtmp) {
+        PyObject_CallMethod((PyObject *)self, "setSpeed", "O", speedtmp);
+    }
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    MAKE_NEW_PV_STREAM(self->pv_stream, &PVStreamType, NULL);
+
+    self->count = (int *)realloc(self->count, self->bufsize * sizeof(int));
+
+    PVRead_realloc_memories(self);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * PVRead_getServer(PVRead* self) { GET_SERVER };
+static PyObject * PVRead_getStream(PVRead* self) { GET_STREAM };
+static PyObject * PVRead_getPVStream(PVRead* self) { GET_PV_STREAM };
+
+static PyObject * PVRead_play(PVRead *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * PVRead_stop(PVRead *self) { STOP };
+
+static PyObject *
+PVRead_setSpeed(PVRead *self, PyObject *arg)
+{
+	PyObject *tmp, *streamtmp;
+
+	if (arg == NULL) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+
+	int isNumber = PyNumber_Check(arg);
+
+	tmp = arg;
+	Py_INCREF(tmp);
+	Py_DECREF(self->speed);
+	if (isNumber == 1) {
+		self->speed = PyNumber_Float(tmp);
+        self->modebuffer[0] = 0;
+	}
+	else {
+		self->speed = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->speed, "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->speed_stream);
+        self->speed_stream = (Stream *)streamtmp;
+		self->modebuffer[0] = 1;
+	}
+
+    (*self->mode_func_ptr)(self);
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject *
+PVRead_setPosition(PVRead *self, PyObject *arg)
+{
+    if (PyNumber_Check(arg)) {
+        self->pos = PyFloat_AsDouble(arg) * self->filesr / self->hopsize;
+        if (self->pos < 0.0)
+            self->pos = 0.0;
+        else if (self->pos > self->numFrames)
+            self->pos = self->numFrames;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+PVRead_getPosition(PVRead *self)
+{
+    return PyFloat_FromDouble(self->pos * self->hopsize / self->filesr);
+}
+
+static PyObject *
+PVRead_setLoop(PVRead *self, PyObject *arg)
+{
+    if (PyInt_Check(arg) || PyLong_Check(arg) || PyBool_Check(arg))
+        self->loop = PyInt_AsLong(arg) != 0;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+PVRead_getInfo(PVRead *self)
+{
+    return Py_BuildValue("{s:i,s:i,s:i,s:d,s:d}", "size", self->size, "olaps", self->olaps,
+                         "numframes", self->numFrames, "sr", self->filesr,
+                         "dur", (double)self->numFrames * self->hopsize / self->filesr);
+}
+
+static PyMemberDef PVRead_members[] = {
+{"server", T_OBJECT_EX, offsetof(PVRead, server), 0, "Pyo server."},
+{"stream", T_OBJECT_EX, offsetof(PVRead, stream), 0, "Stream object."},
+{"pv_stream", T_OBJECT_EX, offsetof(PVRead, pv_stream), 0, "Phase Vocoder Stream object."},
+{"speed", T_OBJECT_EX, offsetof(PVRead, speed), 0, "Reading speed, in frames per hop."},
+{NULL}  /* Sentinel */
+};
+
+static PyMethodDef PVRead_methods[] = {
+{"getServer", (PyCFunction)PVRead_getServer, METH_NOARGS, "Returns server object."},
+{"_getStream", (PyCFunction)PVRead_getStream, METH_NOARGS, "Returns stream object."},
+{"_getPVStream", (PyCFunction)PVRead_getPVStream, METH_NOARGS, "Returns pvstream object."},
+{"play", (PyCFunction)PVRead_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+{"stop", (PyCFunction)PVRead_stop, METH_NOARGS, "Stops computing."},
+{"setSpeed", (PyCFunction)PVRead_setSpeed, METH_O, "Sets a new reading speed."},
+{"setPosition", (PyCFunction)PVRead_setPosition, METH_O, "Sets the reading position, in seconds."},
+{"getPosition", (PyCFunction)PVRead_getPosition, METH_NOARGS, "Returns the reading position, in seconds."},
+{"setLoop", (PyCFunction)PVRead_setLoop, METH_O, "Sets the looping mode."},
+{"getInfo", (PyCFunction)PVRead_getInfo, METH_NOARGS, "Returns the analysis parameters of the file."},
+{NULL}  /* Sentinel */
+};
+
+PyTypeObject PVReadType = {
+PyObject_HEAD_INIT(NULL)
+0,                                              /*ob_size*/
+"_pyo.PVRead_base",                                   /*tp_name*/
+sizeof(PVRead),                                 /*tp_basicsize*/
+0,                                              /*tp_itemsize*/
+(destructor)PVRead_dealloc,                     /*tp_dealloc*/
+0,                                              /*tp_print*/
+0,                                              /*tp_getattr*/
+0,                                              /*tp_setattr*/
+0,                                              /*tp_compare*/
+0,                                              /*tp_repr*/
+0,                              /*tp_as_number*/
+0,                                              /*tp_as_sequence*/
+0,                                              /*tp_as_mapping*/
+0,                                              /*tp_hash */
+0,                                              /*tp_call*/
+0,                                              /*tp_str*/
+0,                                              /*tp_getattro*/
+0,                                              /*tp_setattro*/
+0,                                              /*tp_as_buffer*/
+Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_CHECKTYPES, /*tp_flags*/
+"PVRead objects. Reads a phase vocoder analysis file.",           /* tp_doc */
+(traverseproc)PVRead_traverse,                  /* tp_traverse */
+(inquiry)PVRead_clear,                          /* tp_clear */
+0,                                              /* tp_richcompare */
+0,                                              /* tp_weaklistoffset */
+0,                                              /* tp_iter */
+0,                                              /* tp_iternext */
+PVRead_methods,                                 /* tp_methods */
+PVRead_members,                                 /* tp_members */
+0,                                              /* tp_getset */
+0,                                              /* tp_base */
+0,                                              /* tp_dict */
+0,                                              /* tp_descr_get */
+0,                                              /* tp_descr_set */
+0,                                              /* tp_dictoffset */
+0,                          /* tp_init */
+0,                                              /* tp_alloc */
+PVRead_new,                                     /* tp_new */
+};
@@ -0,0 +1,640 @@
+/**************************************************************************
+ * Copyright 2009-2015 Olivier Belanger                                   *
+ *                                                                        *
+ * This file is part of pyo, a python module to help digital signal       *
+ * processing script creation.                                            *
+ *                                                                        *
+ * pyo is free software: you can redistribute it and/or modify            *
+ * it under the terms of the GNU Lesser General Public License as         *
+ * published by the Free Software Foundation, either version 3 of the     *
+ * License, or (at your option) any later version.                        *
+ *                                                                        *
+ * pyo is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU Lesser General Public License for more details.                    *
+ *                                                                        *
+ * You should have received a copy of the GNU Lesser General Public       *
+ * License along with pyo.  If not, see <http://www.gnu.org/licenses/>.   *
+ *************************************************************************/
+
+#include <Python.h>
+#include "structmember.h"
+#include "pyomodule.h"
+#include "streammodule.h"
+#include "servermodule.h"
+#include "dummymodule.h"
+#include "pyoplugin.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#define PLUGIN_OPEN(path) ((void *)LoadLibraryA(path))
+#define PLUGIN_SYMBOL(handle, name) ((void *)GetProcAddress((HMODULE)(handle), name))
+#define PLUGIN_CLOSE(handle) FreeLibrary((HMODULE)(handle))
+#define PLUGIN_ERROR() "LoadLibrary failed"
+#else
+#include <dlfcn.h>
+#define PLUGIN_OPEN(path) dlopen(path, RTLD_NOW | RTLD_LOCAL)
+#define PLUGIN_SYMBOL(handle, name) dlsym(handle, name)
+#define PLUGIN_CLOSE(handle) dlclose(handle)
+#define PLUGIN_ERROR() dlerror()
+#endif
+
+/* Kernel matching the precision of the build. */
+#ifdef USE_DOUBLE
+typedef PyoPluginProcessDouble PluginProcess;
+#define PLUGIN_PROCESS(desc) ((desc)->process_double)
+#define PLUGIN_PRECISION "double"
+#else
+typedef PyoPluginProcessFloat PluginProcess;
+#define PLUGIN_PROCESS(desc) ((desc)->process_float)
+#define PLUGIN_PRECISION "single"
+#endif
+
+/************/
+/* PluginLib */
+/************/
+/* A loaded shared library. Every Plugin object keeps a reference to its
+** library, which is closed when the last one is deleted. */
+typedef struct {
+    PyObject_HEAD
+    void *handle;
+    const PyoPluginDescriptor *desc;
+} PluginLib;
+
+static void
+PluginLib_dealloc(PluginLib* self)
+{
+    if (self->handle != NULL)
+        PLUGIN_CLOSE(self->handle);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+PluginLib_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    char *path;
+    PyoPluginEntry entry;
+    const PyoPluginDescriptor *desc;
+    PluginLib *self;
+
+    static char *kwlist[] = {"path", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "s", kwlist, &path))
+        return NULL;
+
+    self = (PluginLib *)type->tp_alloc(type, 0);
+    self->desc = NULL;
+
+    self->handle = PLUGIN_OPEN(path);
+    if (self->handle == NULL) {
+        PyErr_Format(PyExc_ImportError, "Can't load plugin %s: %s", path, PLUGIN_ERROR());
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    entry = (PyoPluginEntry)PLUGIN_SYMBOL(self->handle, PYO_PLUGIN_ENTRY);
+    if (entry == NULL) {
+        PyErr_Format(PyExc_ImportError, "%s is not a pyo plugin (no %s function).", path, PYO_PLUGIN_ENTRY);
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    desc = (*entry)(PYO_PLUGIN_ABI_VERSION);
+    if (desc == NULL || desc->abi_version != PYO_PLUGIN_ABI_VERSION) {
+        PyErr_Format(PyExc_ImportError, "Plugin %s is not compatible with the plugin ABI version %d of this pyo.",
+                     path, PYO_PLUGIN_ABI_VERSION);
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    if (desc->name == NULL || desc->num_inputs < 0 || desc->num_inputs > PYO_PLUGIN_MAX_INPUTS ||
+        desc->num_params < 0 || desc->num_params > PYO_PLUGIN_MAX_PARAMS ||
+        (desc->num_params > 0 && desc->params == NULL)) {
+        PyErr_Format(PyExc_ImportError, "Plugin %s has an invalid descriptor.", path);
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    if (PLUGIN_PROCESS(desc) == NULL) {
+        PyErr_Format(PyExc_ImportError, "Plugin %s has no %s precision kernel.", path, PLUGIN_PRECISION);
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    self->desc = desc;
+
+    return (PyObject *)self;
+}
+
+/* Dictionary describing the plugin: name, doc, inputs and params, a list of
+** (name, doc, init, min, max) tuples. */
+static PyObject *
+PluginLib_getInfo(PluginLib *self)
+{
+    int i;
+    const PyoPluginParam *p;
+    PyObject *params, *tmp;
+
+    params = PyList_New(self->desc->num_params);
+    for (i=0; i<self->desc->num_params; i++) {
+        p = &self->desc->params[i];
+        PyList_SET_ITEM(params, i, Py_BuildValue("(ssddd)", p->name, p->doc ? p->doc : "", p->init, p->min, p->max));
+    }
+
+    tmp = Py_BuildValue("{s:s,s:s,s:i,s:N}", "name", self->desc->name, "doc", self->desc->doc ? self->desc->doc : "",
+                        "inputs", self->desc->num_inputs, "params", params);
+    return tmp;
+}
+
+static PyMethodDef PluginLib_methods[] = {
+    {"getInfo", (PyCFunction)PluginLib_getInfo, METH_NOARGS, "Returns the description of the plugin."},
+    {NULL}  /* Sentinel */
+};
+
+PyTypeObject PluginLibType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.PluginLib_base",         /*tp_name*/
+    sizeof(PluginLib),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)PluginLib_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    0,                         /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
+    "PluginLib objects. Shared library holding a pyo plugin.",           /* tp_doc */
+    0,		               /* tp_traverse */
+    0,		               /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    PluginLib_methods,             /* tp_methods */
+    0,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    PluginLib_new,                 /* tp_new */
+};
+
+/**********/
+/* Plugin */
+/**********/
+typedef struct {
+    pyo_audio_HEAD
+    PluginLib *lib;
+    PluginProcess process;
+    PyObject *inputs[PYO_PLUGIN_MAX_INPUTS];
+    Stream *input_streams[PYO_PLUGIN_MAX_INPUTS];
+    PyObject *params[PYO_PLUGIN_MAX_PARAMS];
+    Stream *param_streams[PYO_PLUGIN_MAX_PARAMS];
+    MYFLT last_params[PYO_PLUGIN_MAX_PARAMS];
+    MYFLT *parambuf; /* num_params * bufsize, holds the float parameters */
+    const MYFLT *inptrs[PYO_PLUGIN_MAX_INPUTS];
+    const MYFLT *parptrs[PYO_PLUGIN_MAX_PARAMS];
+    void *state;
+    int modebuffer[2];
+} Plugin;
+
+static void Plugin_postprocessing_ii(Plugin *self) { POST_PROCESSING_II };
+static void Plugin_postprocessing_ai(Plugin *self) { POST_PROCESSING_AI };
+static void Plugin_postprocessing_ia(Plugin *self) { POST_PROCESSING_IA };
+static void Plugin_postprocessing_aa(Plugin *self) { POST_PROCESSING_AA };
+static void Plugin_postprocessing_ireva(Plugin *self) { POST_PROCESSING_IREVA };
+static void Plugin_postprocessing_areva(Plugin *self) { POST_PROCESSING_AREVA };
+static void Plugin_postprocessing_revai(Plugin *self) { POST_PROCESSING_REVAI };
+static void Plugin_postprocessing_revaa(Plugin *self) { POST_PROCESSING_REVAA };
+static void Plugin_postprocessing_revareva(Plugin *self) { POST_PROCESSING_REVAREVA };
+
+static void
+Plugin_setProcMode(Plugin *self)
+{
+    int muladdmode;
+    muladdmode = self->modebuffer[0] + self->modebuffer[1] * 10;
+
+	switch (muladdmode) {
+        case 0:
+            self->muladd_func_ptr = Plugin_postprocessing_ii;
+            break;
+        case 1:
+            self->muladd_func_ptr = Plugin_postprocessing_ai;
+            break;
+        case 2:
+            self->muladd_func_ptr = Plugin_postprocessing_revai;
+            break;
+        case 10:
+            self->muladd_func_ptr = Plugin_postprocessing_ia;
+            break;
+        case 11:
+            self->muladd_func_ptr = Plugin_postprocessing_aa;
+            break;
+        case 12:
+            self->muladd_func_ptr = Plugin_postprocessing_revaa;
+            break;
+        case 20:
+            self->muladd_func_ptr = Plugin_postprocessing_ireva;
+            break;
+        case 21:
+            self->muladd_func_ptr = Plugin_postprocessing_areva;
+            break;
+        case 22:
+            self->muladd_func_ptr = Plugin_postprocessing_revareva;
+            break;
+    }
+}
+
+static void
+Plugin_compute_next_data_frame(Plugin *self)
+{
+    int i, j;
+    MYFLT value, *buf;
+    const PyoPluginDescriptor *desc = self->lib->desc;
+
+    for (i=0; i<desc->num_inputs; i++)
+        self->inptrs[i] = Stream_getData((Stream *)self->input_streams[i]);
+
+    /* Float parameters are expanded in parambuf only when they change. */
+    for (i=0; i<desc->num_params; i++) {
+        if (self->param_streams[i] != NULL)
+            self->parptrs[i] = Stream_getData((Stream *)self->param_streams[i]);
+        else {
+            buf = &self->parambuf[i * self->bufsize];
+            value = PyFloat_AS_DOUBLE(self->params[i]);
+            if (value != self->last_params[i] || self->parptrs[i] != buf) {
+                for (j=0; j<self->bufsize; j++)
+                    buf[j] = value;
+                self->last_params[i] = value;
+                self->parptrs[i] = buf;
+            }
+        }
+    }
+
+    (*self->process)(self->state, self->inptrs, self->parptrs, self->data, self->bufsize);
+    (*self->muladd_func_ptr)(self);
+}
+
+static long
+Plugin_memory(Plugin *self)
+{
+    return self->lib->desc->state_size + self->lib->desc->num_params * self->bufsize * sizeof(MYFLT);
+}
+
+static int
+Plugin_traverse(Plugin *self, visitproc visit, void *arg)
+{
+    int i;
+    pyo_VISIT
+    Py_VISIT(self->lib);
+    for (i=0; i<PYO_PLUGIN_MAX_INPUTS; i++) {
+        Py_VISIT(self->inputs[i]);
+        Py_VISIT(self->input_streams[i]);
+    }
+    for (i=0; i<PYO_PLUGIN_MAX_PARAMS; i++) {
+        Py_VISIT(self->params[i]);
+        Py_VISIT(self->param_streams[i]);
+    }
+    return 0;
+}
+
+static int
+Plugin_clear(Plugin *self)
+{
+    int i;
+    pyo_CLEAR
+    for (i=0; i<PYO_PLUGIN_MAX_INPUTS; i++) {
+        Py_CLEAR(self->inputs[i]);
+        Py_CLEAR(self->input_streams[i]);
+    }
+    for (i=0; i<PYO_PLUGIN_MAX_PARAMS; i++) {
+        Py_CLEAR(self->params[i]);
+        Py_CLEAR(self->param_streams[i]);
+    }
+    return 0;
+}
+
+static void
+Plugin_dealloc(Plugin* self)
+{
+    pyo_DEALLOC
+    if (self->state != NULL) {
+        if (self->lib->desc->release != NULL)
+            (*self->lib->desc->release)(self->state);
+        free(self->state);
+    }
+    free(self->parambuf);
+    Plugin_clear(self);
+    Py_XDECREF(self->lib);
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+static PyObject *
+Plugin_setInput(Plugin *self, PyObject *args)
+{
+    int index;
+    PyObject *tmp, *streamtmp;
+
+    if (! PyArg_ParseTuple(args, "iO", &index, &tmp))
+        return NULL;
+
+    if (index < 0 || index >= self->lib->desc->num_inputs) {
+        PyErr_SetString(PyExc_IndexError, "Plugin input index out of range.");
+        return NULL;
+    }
+
+    if (! PyObject_HasAttrString((PyObject *)tmp, "server")) {
+        PyErr_SetString(PyExc_TypeError, "Plugin inputs must be PyoObjects.");
+        return NULL;
+    }
+
+    Py_INCREF(tmp);
+    Py_XDECREF(self->inputs[index]);
+    self->inputs[index] = tmp;
+    streamtmp = PyObject_CallMethod((PyObject *)self->inputs[index], "_getStream", NULL);
+    Py_INCREF(streamtmp);
+    Py_XDECREF(self->input_streams[index]);
+    self->input_streams[index] = (Stream *)streamtmp;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Plugin_setParam(Plugin *self, PyObject *args)
+{
+    int index;
+    PyObject *tmp, *streamtmp;
+
+    if (! PyArg_ParseTuple(args, "iO", &index, &tmp))
+        return NULL;
+
+    if (index < 0 || index >= self->lib->desc->num_params) {
+        PyErr_SetString(PyExc_IndexError, "Plugin parameter index out of range.");
+        return NULL;
+    }
+
+    if (PyNumber_Check(tmp)) {
+        Py_XDECREF(self->params[index]);
+        self->params[index] = PyNumber_Float(tmp);
+        Py_CLEAR(self->param_streams[index]);
+    }
+    else {
+        Py_INCREF(tmp);
+        Py_XDECREF(self->params[index]);
+        self->params[index] = tmp;
+        streamtmp = PyObject_CallMethod((PyObject *)self->params[index], "_getStream", NULL);
+        Py_INCREF(streamtmp);
+        Py_XDECREF(self->param_streams[index]);
+        self->param_streams[index] = (Stream *)streamtmp;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Plugin_reset(Plugin *self)
+{
+    if (self->lib->desc->reset != NULL)
+        (*self->lib->desc->reset)(self->state);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+Plugin_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    int i, nparams;
+    PyObject *libtmp, *inputstmp, *paramstmp, *multmp=NULL, *addtmp=NULL, *ret;
+    const PyoPluginDescriptor *desc;
+    Plugin *self;
+    self = (Plugin *)type->tp_alloc(type, 0);
+
+    self->lib = NULL;
+    self->state = NULL;
+    self->parambuf = NULL;
+    for (i=0; i<PYO_PLUGIN_MAX_INPUTS; i++) {
+        self->inputs[i] = NULL;
+        self->input_streams[i] = NULL;
+    }
+    for (i=0; i<PYO_PLUGIN_MAX_PARAMS; i++) {
+        self->params[i] = NULL;
+        self->param_streams[i] = NULL;
+        self->parptrs[i] = NULL;
+    }
+	self->modebuffer[0] = 0;
+	self->modebuffer[1] = 0;
+
+    INIT_OBJECT_COMMON
+    Stream_setFunctionPtr(self->stream, Plugin_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, Plugin_memory);
+    self->mode_func_ptr = Plugin_setProcMode;
+
+    static char *kwlist[] = {"lib", "inputs", "params", "mul", "add", NULL};
+
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OOO|OO", kwlist, &libtmp, &inputstmp, &paramstmp, &multmp, &addtmp))
+        Py_RETURN_NONE;
+
+    if (! PyObject_TypeCheck(libtmp, &PluginLibType)) {
+        PyErr_SetString(PyExc_TypeError, "Plugin \"lib\" argument must be a PluginLib_base object.");
+        Py_DECREF(self);
+        return NULL;
+    }
+    Py_INCREF(libtmp);
+    self->lib = (PluginLib *)libtmp;
+    desc = self->lib->desc;
+    self->process = PLUGIN_PROCESS(desc);
+
+    if (! PyList_Check(inputstmp) || PyList_Size(inputstmp) != desc->num_inputs ||
+        ! PyList_Check(paramstmp) || PyList_Size(paramstmp) != desc->num_params) {
+        PyErr_Format(PyExc_TypeError, "%s expects a list of %d inputs and a list of %d parameters.",
+                     desc->name, desc->num_inputs, desc->num_params);
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    for (i=0; i<desc->num_inputs; i++) {
+        ret = PyObject_CallMethod((PyObject *)self, "setInput", "iO", i, PyList_GET_ITEM(inputstmp, i));
+        if (ret == NULL) {
+            Py_DECREF(self);
+            return NULL;
+        }
+        Py_DECREF(ret);
+    }
+
+    for (i=0; i<desc->num_params; i++) {
+        ret = PyObject_CallMethod((PyObject *)self, "setParam", "iO", i, PyList_GET_ITEM(paramstmp, i));
+        if (ret == NULL) {
+            Py_DECREF(self);
+            return NULL;
+        }
+        Py_DECREF(ret);
+    }
+
+    if (multmp) {
+        PyObject_CallMethod((PyObject *)self, "setMul", "O", multmp);
+    }
+
+    if (addtmp) {
+        PyObject_CallMethod((PyObject *)self, "setAdd", "O", addtmp);
+    }
+
+    nparams = desc->num_params > 0 ? desc->num_params : 1;
+    self->parambuf = (MYFLT *)calloc(nparams * self->bufsize, sizeof(MYFLT));
+    self->state = calloc(1, desc->state_size > 0 ? desc->state_size : 1);
+    Server_prefaultMemory((Server *)self->server, self->parambuf, nparams * self->bufsize * sizeof(MYFLT));
+    Server_prefaultMemory((Server *)self->server, self->state, desc->state_size);
+    if (desc->init != NULL)
+        (*desc->init)(self->state, self->sr, self->bufsize);
+
+    PyObject_CallMethod(self->server, "addStream", "O", self->stream);
+
+    (*self->mode_func_ptr)(self);
+
+    return (PyObject *)self;
+}
+
+static PyObject * Plugin_getServer(Plugin* self) { GET_SERVER };
+static PyObject * Plugin_getStream(Plugin* self) { GET_STREAM };
+static PyObject * Plugin_setMul(Plugin *self, PyObject *arg) { SET_MUL };
+static PyObject * Plugin_setAdd(Plugin *self, PyObject *arg) { SET_ADD };
+static PyObject * Plugin_setSub(Plugin *self, PyObject *arg) { SET_SUB };
+static PyObject * Plugin_setDiv(Plugin *self, PyObject *arg) { SET_DIV };
+
+static PyObject * Plugin_play(Plugin *self, PyObject *args, PyObject *kwds) { PLAY };
+static PyObject * Plugin_out(Plugin *self, PyObject *args, PyObject *kwds) { OUT };
+static PyObject * Plugin_stop(Plugin *self) { STOP };
+
+static PyObject * Plugin_multiply(Plugin *self, PyObject *arg) { MULTIPLY };
+static PyObject * Plugin_inplace_multiply(Plugin *self, PyObject *arg) { INPLACE_MULTIPLY };
+static PyObject * Plugin_add(Plugin *self, PyObject *arg) { ADD };
+static PyObject * Plugin_inplace_add(Plugin *self, PyObject *arg) { INPLACE_ADD };
+static PyObject * Plugin_sub(Plugin *self, PyObject *arg) { SUB };
+static PyObject * Plugin_inplace_sub(Plugin *self, PyObject *arg) { INPLACE_SUB };
+static PyObject * Plugin_div(Plugin *self, PyObject *arg) { DIV };
+static PyObject * Plugin_inplace_div(Plugin *self, PyObject *arg) { INPLACE_DIV };
+
+static PyMemberDef Plugin_members[] = {
+    {"server", T_OBJECT_EX, offsetof(Plugin, server), 0, "Pyo server."},
+    {"stream", T_OBJECT_EX, offsetof(Plugin, stream), 0, "Stream object."},
+    {"mul", T_OBJECT_EX, offsetof(Plugin, mul), 0, "Mul factor."},
+    {"add", T_OBJECT_EX, offsetof(Plugin, add), 0, "Add factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyMethodDef Plugin_methods[] = {
+    {"getServer", (PyCFunction)Plugin_getServer, METH_NOARGS, "Returns server object."},
+    {"_getStream", (PyCFunction)Plugin_getStream, METH_NOARGS, "Returns stream object."},
+    {"play", (PyCFunction)Plugin_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
+    {"out", (PyCFunction)Plugin_out, METH_VARARGS|METH_KEYWORDS, "Starts computing and sends sound to soundcard channel speficied by argument."},
+    {"stop", (PyCFunction)Plugin_stop, METH_NOARGS, "Stops computing."},
+    {"setInput", (PyCFunction)Plugin_setInput, METH_VARARGS, "Sets the audio input at the given index."},
+    {"setParam", (PyCFunction)Plugin_setParam, METH_VARARGS, "Sets the parameter at the given index."},
+    {"reset", (PyCFunction)Plugin_reset, METH_NOARGS, "Resets the state of the plugin."},
+	{"setMul", (PyCFunction)Plugin_setMul, METH_O, "Sets oscillator mul factor."},
+	{"setAdd", (PyCFunction)Plugin_setAdd, METH_O, "Sets oscillator add factor."},
+    {"setSub", (PyCFunction)Plugin_setSub, METH_O, "Sets inverse add factor."},
+    {"setDiv", (PyCFunction)Plugin_setDiv, METH_O, "Sets inverse mul factor."},
+    {NULL}  /* Sentinel */
+};
+
+static PyNumberMethods Plugin_as_number = {
+    (binaryfunc)Plugin_add,                      /*nb_add*/
+    (binaryfunc)Plugin_sub,                 /*nb_subtract*/
+    (binaryfunc)Plugin_multiply,                 /*nb_multiply*/
+    (binaryfunc)Plugin_div,                   /*nb_divide*/
+    0,                /*nb_remainder*/
+    0,                   /*nb_divmod*/
+    0,                   /*nb_power*/
+    0,                  /*nb_neg*/
+    0,                /*nb_pos*/
+    0,                  /*(unaryfunc)array_abs,*/
+    0,                    /*nb_nonzero*/
+    0,                    /*nb_invert*/
+    0,               /*nb_lshift*/
+    0,              /*nb_rshift*/
+    0,              /*nb_and*/
+    0,              /*nb_xor*/
+    0,               /*nb_or*/
+    0,                                          /*nb_coerce*/
+    0,                       /*nb_int*/
+    0,                      /*nb_long*/
+    0,                     /*nb_float*/
+    0,                       /*nb_oct*/
+    0,                       /*nb_hex*/
+    (binaryfunc)Plugin_inplace_add,              /*inplace_add*/
+    (binaryfunc)Plugin_inplace_sub,         /*inplace_subtract*/
+    (binaryfunc)Plugin_inplace_multiply,         /*inplace_multiply*/
+    (binaryfunc)Plugin_inplace_div,           /*inplace_divide*/
+    0,        /*inplace_remainder*/
+    0,           /*inplace_power*/
+    0,       /*inplace_lshift*/
+    0,      /*inplace_rshift*/
+    0,      /*inplace_and*/
+    0,      /*inplace_xor*/
+    0,       /*inplace_or*/
+    0,             /*nb_floor_divide*/
+    0,              /*nb_true_divide*/
+    0,     /*nb_inplace_floor_divide*/
+    0,      /*nb_inplace_true_divide*/
+    0,                     /* nb_index */
+};
+
+PyTypeObject PluginType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "_pyo.Plugin_base",         /*tp_name*/
+    sizeof(Plugin),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)Plugin_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    &Plugin_as_number,             /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_CHECKTYPES | Py_TPFLAGS_HAVE_GC, /*tp_flags*/
+    "Plugin objects. Runs the kernel of a runtime-loaded plugin.",           /* tp_doc */
+    (traverseproc)Plugin_traverse,   /* tp_traverse */
+    (inquiry)Plugin_clear,           /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    Plugin_methods,             /* tp_methods */
+    Plugin_members,             /* tp_members */
+    0,                      /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,      /* tp_init */
+    0,                         /* tp_alloc */
+    Plugin_new,                 /* tp_new */
+};
@@ -19,6 +19,8 @@
  *************************************************************************/
 
 #include <Python.h>
+#include <pthread.h>
+#include <unistd.h>
 #include "structmember.h"
 #include "pyomodule.h"
 #include "streammodule.h"
@@ -287,6 +289,402 @@ Record_members,                                 /* tp_members */
 Record_new,                                     /* tp_new */
 };
 
+/*****************************************************************/
+/* Chunked storage shared by ControlRec and NoteinRec.           */
+/*                                                               */
+/* Recorded frames (`width` doubles each) are stored in native   */
+/* chunks of REC_CHUNK_FRAMES frames, allocated in advance, so   */
+/* the audio callback never allocates memory. With a fixed       */
+/* duration, all chunks are allocated by RecChunks_init. For an  */
+/* open-ended recording in memory, a pool thread keeps           */
+/* REC_SPARE_CHUNKS chunks ready ahead of the one being filled   */
+/* and grows the chunks table. When a file is given, a writer    */
+/* thread streams full chunks to disk through a small ring of    */
+/* REC_FLUSH_CHUNKS buffers (single producer, single consumer)   */
+/* and the memory footprint stays constant. In both cases, the   */
+/* frames that can't be stored because the thread was late are   */
+/* counted and reported when the recording stops. With an       */
+/* offline server, the audio thread waits for the threads        */
+/* instead, since there is no real-time constraint.              */
+/*                                                               */
+/* File format (native byte order):                              */
+/*   char[4] "PYOC", int32 version, int32 width, int32 rate,     */
+/*   float64 sr, followed by float64 frames.                     */
+/*****************************************************************/
+#define REC_CHUNK_FRAMES 4096
+#define REC_FLUSH_CHUNKS 16
+#define REC_SPARE_CHUNKS 4
+#define REC_MAX_RETIRED 40 /* replaced chunks tables, the size doubles each time */
+#define REC_FLUSH_PERIOD 10000 /* writer and pool threads polling period, in microseconds */
+#define REC_WAIT_PERIOD 500 /* polling period when the audio thread waits for them (offline server) */
+#define REC_FILE_VERSION 1
+#define REC_OFFLINE_SERVER(server) (((Server *)(server))->audio_be_type == PyoOffline || \
+                                    ((Server *)(server))->audio_be_type == PyoOfflineNB)
+#define REC_HEADER_SIZE 24
+
+typedef struct {
+    int width;
+    double ** volatile chunks; /* replaced by the pool thread when it grows */
+    volatile long numchunks; /* allocated chunks */
+    long maxchunks; /* size of the chunks table */
+    double **retired[REC_MAX_RETIRED]; /* previous chunks tables, freed with the recorder */
+    int numretired;
+    volatile long current; /* chunk being filled */
+    long pos; /* frames in the current chunk */
+    long frames; /* total recorded frames */
+    long dropped; /* frames lost because the writer or pool thread was late */
+    int flushing;
+    int streamed; /* frames were sent to a file instead of being kept in memory */
+    int running;
+    int wait; /* the audio thread waits for the writer or pool thread instead of dropping frames */
+    FILE *file;
+    pthread_t thread;
+    long sizes[REC_FLUSH_CHUNKS];
+    volatile long head; /* chunks handed to the writer thread */
+    volatile long tail; /* chunks written on the disk */
+    volatile int closing;
+} RecChunks;
+
+static void
+RecChunks_init(RecChunks *c, int width, long frames)
+{
+    long i, num = frames / REC_CHUNK_FRAMES + 1;
+
+    if (num < REC_FLUSH_CHUNKS)
+        num = REC_FLUSH_CHUNKS;
+
+    c->width = width;
+    c->numchunks = c->maxchunks = num;
+    c->numretired = 0;
+    c->chunks = (double **)malloc(num * sizeof(double *));
+    for (i=0; i<num; i++)
+        c->chunks[i] = (double *)malloc(REC_CHUNK_FRAMES * width * sizeof(double));
+    c->current = c->pos = c->frames = c->dropped = 0;
+    c->flushing = c->streamed = c->running = c->closing = c->wait = 0;
+    c->head = c->tail = 0;
+    c->file = NULL;
+}
+
+/* Returns 1 if the audio thread must drop the frame, 0 once it can continue. */
+static inline int
+RecChunks_late(RecChunks *c)
+{
+    if (!c->wait || !c->running) {
+        c->dropped++;
+        return 1;
+    }
+    usleep(REC_WAIT_PERIOD);
+    __sync_synchronize();
+    return 0;
+}
+
+/* Called from the audio thread. */
+static void
+RecChunks_append(RecChunks *c, double *frame)
+{
+    int k;
+    double *dst;
+
+    if (c->pos >= REC_CHUNK_FRAMES) {
+        if (c->flushing) {
+            /* The chunk that follows must not be waiting for the writer thread. */
+            while ((c->head - c->tail) >= (REC_FLUSH_CHUNKS - 1)) {
+                if (RecChunks_late(c))
+                    return;
+            }
+            c->sizes[c->head % REC_FLUSH_CHUNKS] = c->pos;
+            __sync_synchronize();
+            c->head++;
+            c->current = c->head % REC_FLUSH_CHUNKS;
+        }
+        else {
+            /* The next chunk must have been allocated by the pool thread. */
+            while ((c->current + 1) >= c->numchunks) {
+                if (RecChunks_late(c))
+                    return;
+            }
+            __sync_synchronize();
+            c->current++;
+        }
+        c->pos = 0;
+    }
+
+    dst = c->chunks[c->current] + c->pos * c->width;
+    for (k=0; k<c->width; k++)
+        dst[k] = frame[k];
+    c->pos++;
+    c->frames++;
+}
+
+static double
+RecChunks_get(RecChunks *c, long frame, int k)
+{
+    return c->chunks[frame / REC_CHUNK_FRAMES][(frame % REC_CHUNK_FRAMES) * c->width + k];
+}
+
+/* Bytes held by the allocated chunks. */
+static long
+RecChunks_getMemory(RecChunks *c)
+{
+    return c->maxchunks * sizeof(double *) + c->numchunks * REC_CHUNK_FRAMES * c->width * sizeof(double);
+}
+
+/* Number of frames available in memory (the whole recording unless flushing to disk). */
+static long
+RecChunks_getSize(RecChunks *c)
+{
+    if (c->streamed)
+        return 0;
+    return c->frames;
+}
+
+static int
+RecChunks_writeHeader(FILE *f, int width, int rate, double sr)
+{
+    int header[3];
+    header[0] = REC_FILE_VERSION;
+    header[1] = width;
+    header[2] = rate;
+    if (fwrite("PYOC", 1, 4, f) != 4 || fwrite(header, sizeof(int), 3, f) != 3 || fwrite(&sr, sizeof(double), 1, f) != 1)
+        return -1;
+    return 0;
+}
+
+static void *
+RecChunks_writer(void *arg)
+{
+    int closing;
+    long which;
+    RecChunks *c = (RecChunks *)arg;
+
+    for (;;) {
+        closing = c->closing;
+        __sync_synchronize();
+        while (c->tail < c->head) {
+            which = c->tail % REC_FLUSH_CHUNKS;
+            fwrite(c->chunks[which], sizeof(double), c->sizes[which] * c->width, c->file);
+            __sync_synchronize();
+            c->tail++;
+        }
+        if (closing)
+            break;
+        usleep(REC_FLUSH_PERIOD);
+    }
+    fclose(c->file);
+    return NULL;
+}
+
+/* Allocates chunks until REC_SPARE_CHUNKS are ready after the current one.
+** Only the pool thread writes in the chunks table while recording. A full
+** table is copied in a larger one, the old one stays valid for the audio
+** thread until the recorder is freed. */
+static void
+RecChunks_refill(RecChunks *c)
+{
+    double *chunk, **table;
+
+    while ((c->numchunks - c->current) <= REC_SPARE_CHUNKS) {
+        if (c->numchunks >= c->maxchunks) {
+            if (c->numretired >= REC_MAX_RETIRED)
+                return;
+            table = (double **)malloc(c->maxchunks * 2 * sizeof(double *));
+            if (table == NULL)
+                return;
+            memcpy(table, c->chunks, c->numchunks * sizeof(double *));
+            c->retired[c->numretired++] = c->chunks;
+            __sync_synchronize();
+            c->chunks = table;
+            c->maxchunks *= 2;
+        }
+        chunk = (double *)malloc(REC_CHUNK_FRAMES * c->width * sizeof(double));
+        if (chunk == NULL)
+            return;
+        c->chunks[c->numchunks] = chunk;
+        __sync_synchronize();
+        c->numchunks++;
+    }
+}
+
+static void *
+RecChunks_pool(void *arg)
+{
+    RecChunks *c = (RecChunks *)arg;
+
+    for (;;) {
+        __sync_synchronize();
+        if (c->closing)
+            break;
+        RecChunks_refill(c);
+        usleep(c->wait ? REC_WAIT_PERIOD : REC_FLUSH_PERIOD);
+    }
+    return NULL;
+}
+
+/* Waits for a previous writer or pool thread to finish its work. */
+static void
+RecChunks_join(RecChunks *c)
+{
+    if (c->running) {
+        pthread_join(c->thread, NULL);
+        c->running = 0;
+        c->file = NULL;
+    }
+}
+
+static void
+RecChunks_reset(RecChunks *c)
+{
+    RecChunks_join(c);
+    c->current = c->pos = c->frames = c->dropped = 0;
+    c->head = c->tail = 0;
+    c->streamed = c->closing = 0;
+}
+
+static int
+RecChunks_startFlush(RecChunks *c, const char *path, int rate, double sr, int wait)
+{
+    RecChunks_reset(c);
+    c->wait = wait;
+
+    c->file = fopen(path, "wb");
+    if (c->file == NULL) {
+        PySys_WriteStderr("Pyo error: can't open \"%s\" for writing, recording in memory.\n", path);
+        return -1;
+    }
+    RecChunks_writeHeader(c->file, c->width, rate, sr);
+
+    c->flushing = c->streamed = 1;
+    if (pthread_create(&c->thread, NULL, RecChunks_writer, c) != 0) {
+        PySys_WriteStderr("Pyo error: can't start the writer thread, recording in memory.\n");
+        fclose(c->file);
+        c->file = NULL;
+        c->flushing = c->streamed = 0;
+        return -1;
+    }
+    c->running = 1;
+    return 0;
+}
+
+/* Starts a recording in memory. An open-ended recording gets a pool thread
+** allocating the chunks ahead of the audio thread. */
+static void
+RecChunks_startMemory(RecChunks *c, int growing, int wait)
+{
+    RecChunks_reset(c);
+    c->wait = wait;
+
+    if (!growing)
+        return;
+    RecChunks_refill(c);
+    if (pthread_create(&c->thread, NULL, RecChunks_pool, c) != 0)
+        PySys_WriteStderr("Pyo warning: can't start the memory pool thread, the recording is limited to %ld frames.\n",
+                          c->numchunks * REC_CHUNK_FRAMES);
+    else
+        c->running = 1;
+}
+
+/* Stops the writer or pool thread. The writer gets the last partial chunk
+** and closes the file. */
+static void
+RecChunks_stop(RecChunks *c)
+{
+    if (c->flushing) {
+        if (c->pos > 0) {
+            if ((c->head - c->tail) < REC_FLUSH_CHUNKS) {
+                c->sizes[c->head % REC_FLUSH_CHUNKS] = c->pos;
+                __sync_synchronize();
+                c->head++;
+            }
+            else
+                c->dropped += c->pos;
+            c->pos = 0;
+        }
+        if (c->dropped > 0)
+            PySys_WriteStderr("Pyo warning: disk streaming was too slow, %ld frames dropped.\n", c->dropped);
+        c->flushing = 0;
+    }
+    else if (c->dropped > 0)
+        PySys_WriteStderr("Pyo warning: memory allocation was too slow, %ld frames dropped.\n", c->dropped);
+    c->dropped = 0;
+    __sync_synchronize();
+    c->closing = 1;
+}
+
+static void
+RecChunks_free(RecChunks *c)
+{
+    long i;
+
+    RecChunks_stop(c);
+    RecChunks_join(c);
+    for (i=0; i<c->numchunks; i++)
+        free(c->chunks[i]);
+    free(c->chunks);
+    for (i=0; i<c->numretired; i++)
+        free(c->retired[i]);
+    c->chunks = NULL;
+    c->numchunks = c->numretired = 0;
+}
+
+/* Writes frames recorded in memory in a binary file. */
+static int
+RecChunks_writeFile(RecChunks *c, const char *path, int rate, double sr)
+{
+    long i, n, size = RecChunks_getSize(c);
+    FILE *f = fopen(path, "wb");
+
+    if (f == NULL)
+        return -1;
+    RecChunks_writeHeader(f, c->width, rate, sr);
+    for (i=0; i<size; i+=REC_CHUNK_FRAMES) {
+        n = (size - i) < REC_CHUNK_FRAMES ? (size - i) : REC_CHUNK_FRAMES;
+        fwrite(c->chunks[i / REC_CHUNK_FRAMES], sizeof(double), n * c->width, f);
+    }
+    fclose(f);
+    return 0;
+}
+
+/* Reads one column of a binary file into `values` (realloc'ed). Returns the number of frames or -1. */
+static long
+RecChunks_readColumn(const char *path, int column, MYFLT **values, int *rate)
+{
+    char magic[4];
+    int header[3];
+    double sr, *frame;
+    long i, size, bytes;
+    FILE *f = fopen(path, "rb");
+
+    if (f == NULL)
+        return -1;
+    if (fread(magic, 1, 4, f) != 4 || strncmp(magic, "PYOC", 4) != 0 ||
+        fread(header, sizeof(int), 3, f) != 3 || fread(&sr, sizeof(double), 1, f) != 1 ||
+        header[1] < 1 || column >= header[1]) {
+        fclose(f);
+        return -1;
+    }
+
+    fseek(f, 0, SEEK_END);
+    bytes = ftell(f) - REC_HEADER_SIZE;
+    fseek(f, REC_HEADER_SIZE, SEEK_SET);
+    size = bytes / (header[1] * sizeof(double));
+
+    frame = (double *)malloc(header[1] * sizeof(double));
+    *values = (MYFLT *)realloc(*values, (size + 1) * sizeof(MYFLT));
+    for (i=0; i<size; i++) {
+        if (fread(frame, sizeof(double), header[1], f) != header[1]) {
+            size = i;
+            break;
+        }
+        (*values)[i] = (MYFLT)frame[column];
+    }
+    free(frame);
+    fclose(f);
+
+    if (rate != NULL)
+        *rate = header[2];
+    return size;
+}
+
 /************/
 /* ControlRec */
 /************/
@@ -294,40 +692,32 @@ typedef struct {
     pyo_audio_HEAD
     PyObject *input;
     Stream *input_stream;
-    PyObject *tmp_list;
     MYFLT dur;
     int rate;
     int modulo;
-    long count;
     long time;
     long size;
-    MYFLT *buffer;
+    char *filename;
+    RecChunks rec;
 } ControlRec;
 
 static void
 ControlRec_process(ControlRec *self) {
     int i;
+    double value;
 
     MYFLT *in = Stream_getData((Stream *)self->input_stream);
 
-    if (self->dur > 0.0) {
-        for (i=0; i<self->bufsize; i++) {
-            if ((self->time % self->modulo) == 0 && self->count < self->size) {
-                self->buffer[self->count] = in[i];
-                self->count++;
-            }
-            self->time++;
-            if (self->count >= self->size)
+    for (i=0; i<self->bufsize; i++) {
+        if ((self->time % self->modulo) == 0) {
+            value = in[i];
+            RecChunks_append(&self->rec, &value);
+            if (self->dur > 0.0 && self->rec.frames >= self->size) {
                 PyObject_CallMethod((PyObject *)self, "stop", NULL);
-        }
-    }
-    else {
-        for (i=0; i<self->bufsize; i++) {
-            if ((self->time % self->modulo) == 0) {
-                PyList_Append(self->tmp_list, PyFloat_FromDouble(in[i]));
+                break;
             }
-            self->time++;
         }
+        self->time++;
     }
 }
 
@@ -343,13 +733,17 @@ ControlRec_compute_next_data_frame(ControlRec *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+ControlRec_memory(ControlRec *self) {
+    return RecChunks_getMemory(&self->rec);
+}
+
 static int
 ControlRec_traverse(ControlRec *self, visitproc visit, void *arg)
 {
     pyo_VISIT
     Py_VISIT(self->input);
     Py_VISIT(self->input_stream);
-    Py_VISIT(self->tmp_list);
     return 0;
 }
 
@@ -359,7 +753,6 @@ ControlRec_clear(ControlRec *self)
     pyo_CLEAR
     Py_CLEAR(self->input);
     Py_CLEAR(self->input_stream);
-    Py_CLEAR(self->tmp_list);
     return 0;
 }
 
@@ -367,8 +760,9 @@ static void
 ControlRec_dealloc(ControlRec* self)
 {
     pyo_DEALLOC
-    if (self->buffer != NULL)
-        free(self->buffer);
+    RecChunks_free(&self->rec);
+    if (self->filename != NULL)
+        free(self->filename);
     ControlRec_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -377,35 +771,36 @@ static PyObject *
 ControlRec_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
-    long j;
+    char *filename = NULL;
     PyObject *inputtmp, *input_streamtmp;
     ControlRec *self;
     self = (ControlRec *)type->tp_alloc(type, 0);
 
     self->dur = 0.0;
     self->rate = 1000;
-    self->tmp_list = PyList_New(0);
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, ControlRec_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, ControlRec_memory);
     self->mode_func_ptr = ControlRec_setProcMode;
 
-    static char *kwlist[] = {"input", "rate", "dur", NULL};
+    static char *kwlist[] = {"input", "rate", "dur", "filename", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, TYPE_O_IF, kwlist, &inputtmp, &self->rate, &self->dur))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, TYPE_O_IFS, kwlist, &inputtmp, &self->rate, &self->dur, &filename))
         Py_RETURN_NONE;
 
     INIT_INPUT_STREAM
 
     PyObject_CallMethod(self->server, "addStream", "O", self->stream);
 
-    if (self->dur > 0.0) {
+    if (filename != NULL)
+        self->filename = strdup(filename);
+
+    /* With a fixed duration, all chunks are allocated here. */
+    if (self->dur > 0.0)
         self->size = (long)(self->dur * self->rate + 1);
-        self->buffer = (MYFLT *)realloc(self->buffer, self->size * sizeof(MYFLT));
-        for (j=0; j<self->size; j++) {
-            self->buffer[j] = 0.0;
-        }
-    }
+    RecChunks_init(&self->rec, 1, self->size);
+
     self->modulo = (int)(self->sr / self->rate);
 
     (*self->mode_func_ptr)(self);
@@ -417,42 +812,55 @@ static PyObject * ControlRec_getServer(ControlRec* self) { GET_SERVER };
 static PyObject * ControlRec_getStream(ControlRec* self) { GET_STREAM };
 
 static PyObject * ControlRec_play(ControlRec *self, PyObject *args, PyObject *kwds) {
-    self->count = self->time = 0;
+    int wait = REC_OFFLINE_SERVER(self->server);
+    self->time = 0;
+    RecChunks_stop(&self->rec);
+    if (self->filename == NULL || RecChunks_startFlush(&self->rec, self->filename, self->rate, self->sr, wait) < 0)
+        RecChunks_startMemory(&self->rec, self->dur <= 0.0, wait);
     PLAY
 };
 
-static PyObject * ControlRec_stop(ControlRec *self) { STOP };
+static PyObject * ControlRec_stop(ControlRec *self) {
+    RecChunks_stop(&self->rec);
+    STOP
+};
 
 static PyObject *
 ControlRec_getData(ControlRec *self) {
-    int i;
+    long i, size;
     PyObject *data, *point;
-    MYFLT time, timescl = 1.0 / self->rate;
+    MYFLT timescl = 1.0 / self->rate;
 
-    if (self->dur > 0.0) {
-        data = PyList_New(self->size);
-        for (i=0; i<self->size; i++) {
-            time = i * timescl;
-            point = PyTuple_New(2);
-            PyTuple_SET_ITEM(point, 0, PyFloat_FromDouble(time));
-            PyTuple_SET_ITEM(point, 1, PyFloat_FromDouble(self->buffer[i]));
-            PyList_SetItem(data, i, point);
-        }
-    }
-    else {
-        Py_ssize_t size = PyList_Size(self->tmp_list);
-        data = PyList_New(size);
-        for (i=0; i<size; i++) {
-            time = i * timescl;
-            point = PyTuple_New(2);
-            PyTuple_SET_ITEM(point, 0, PyFloat_FromDouble(time));
-            PyTuple_SET_ITEM(point, 1, PyList_GET_ITEM(self->tmp_list, i));
-            PyList_SetItem(data, i, point);
-        }
+    size = RecChunks_getSize(&self->rec);
+    data = PyList_New(size);
+    for (i=0; i<size; i++) {
+        point = PyTuple_New(2);
+        PyTuple_SET_ITEM(point, 0, PyFloat_FromDouble(i * timescl));
+        PyTuple_SET_ITEM(point, 1, PyFloat_FromDouble(RecChunks_get(&self->rec, i, 0)));
+        PyList_SET_ITEM(data, i, point);
     }
 	return data;
 }
 
+static PyObject *
+ControlRec_getSize(ControlRec *self) {
+    return PyInt_FromLong(self->rec.frames);
+}
+
+static PyObject *
+ControlRec_writeFile(ControlRec *self, PyObject *arg) {
+    if (! PyString_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "writeFile: argument must be a string.");
+        return NULL;
+    }
+    if (RecChunks_writeFile(&self->rec, PyString_AsString(arg), self->rate, self->sr) < 0) {
+        PyErr_Format(PyExc_IOError, "writeFile: can't open \"%s\" for writing.", PyString_AsString(arg));
+        return NULL;
+    }
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
 static PyMemberDef ControlRec_members[] = {
     {"server", T_OBJECT_EX, offsetof(ControlRec, server), 0, "Pyo server."},
     {"stream", T_OBJECT_EX, offsetof(ControlRec, stream), 0, "Stream object."},
@@ -466,6 +874,8 @@ static PyMethodDef ControlRec_methods[] = {
     {"play", (PyCFunction)ControlRec_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
     {"stop", (PyCFunction)ControlRec_stop, METH_NOARGS, "Stops computing."},
     {"getData", (PyCFunction)ControlRec_getData, METH_NOARGS, "Returns list of sampled points."},
+    {"getSize", (PyCFunction)ControlRec_getSize, METH_NOARGS, "Returns the number of recorded points."},
+    {"writeFile", (PyCFunction)ControlRec_writeFile, METH_O, "Writes recorded points in a binary file."},
     {NULL}  /* Sentinel */
 };
 
@@ -673,7 +1083,10 @@ ControlRead_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         Py_RETURN_NONE;
 
     if (valuestmp) {
-        PyObject_CallMethod((PyObject *)self, "setValues", "O", valuestmp);
+        if (PyObject_CallMethod((PyObject *)self, "setValues", "O", valuestmp) == NULL) {
+            Py_DECREF(self);
+            return NULL;
+        }
     }
 
     if (multmp) {
@@ -738,12 +1151,37 @@ static PyObject *
 ControlRead_setValues(ControlRead *self, PyObject *arg)
 {
     Py_ssize_t i;
+    long size;
 
 	if (arg == NULL) {
 		Py_INCREF(Py_None);
 		return Py_None;
 	}
 
+    /* Binary file written by ControlRec. */
+    if (PyString_Check(arg)) {
+        size = RecChunks_readColumn(PyString_AsString(arg), 0, &self->values, NULL);
+        if (size < 0) {
+            PyErr_Format(PyExc_IOError, "ControlRead: \"%s\" is not a valid control file.", PyString_AsString(arg));
+            return NULL;
+        }
+        self->size = size;
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    /* Points kept in memory by a ControlRec object. */
+    if (PyObject_TypeCheck(arg, &ControlRecType)) {
+        RecChunks *rec = &((ControlRec *)arg)->rec;
+        self->size = RecChunks_getSize(rec);
+        self->values = (MYFLT *)realloc(self->values, (self->size + 1) * sizeof(MYFLT));
+        for (i=0; i<self->size; i++) {
+            self->values[i] = (MYFLT)RecChunks_get(rec, i, 0);
+        }
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
     self->size = PyList_Size(arg);
     self->values = (MYFLT *)realloc(self->values, self->size * sizeof(MYFLT));
     for (i=0; i<self->size; i++) {
@@ -922,18 +1360,18 @@ typedef struct {
     Stream *inputp_stream;
     PyObject *inputv;
     Stream *inputv_stream;
-    PyObject *tmp_list_p;
-    PyObject *tmp_list_v;
-    PyObject *tmp_list_t;
     MYFLT last_pitch;
     MYFLT last_vel;
     long time;
+    char *filename;
+    RecChunks rec; /* frames are (time, pitch, velocity) */
 } NoteinRec;
 
 static void
 NoteinRec_process(NoteinRec *self) {
     int i;
     MYFLT pit, vel;
+    double frame[3];
 
     MYFLT *inp = Stream_getData((Stream *)self->inputp_stream);
     MYFLT *inv = Stream_getData((Stream *)self->inputv_stream);
@@ -944,9 +1382,10 @@ NoteinRec_process(NoteinRec *self) {
         if (pit != self->last_pitch || vel != self->last_vel) {
             self->last_pitch = pit;
             self->last_vel = vel;
-            PyList_Append(self->tmp_list_p, PyFloat_FromDouble(pit));
-            PyList_Append(self->tmp_list_v, PyFloat_FromDouble(vel));
-            PyList_Append(self->tmp_list_t, PyFloat_FromDouble( (float)self->time / self->sr) );
+            frame[0] = (float)self->time / self->sr;
+            frame[1] = pit;
+            frame[2] = vel;
+            RecChunks_append(&self->rec, frame);
         }
         self->time++;
     }
@@ -964,6 +1403,11 @@ NoteinRec_compute_next_data_frame(NoteinRec *self)
     (*self->proc_func_ptr)(self);
 }
 
+static long
+NoteinRec_memory(NoteinRec *self) {
+    return RecChunks_getMemory(&self->rec);
+}
+
 static int
 NoteinRec_traverse(NoteinRec *self, visitproc visit, void *arg)
 {
@@ -972,9 +1416,6 @@ NoteinRec_traverse(NoteinRec *self, visitproc visit, void *arg)
     Py_VISIT(self->inputp_stream);
     Py_VISIT(self->inputv);
     Py_VISIT(self->inputv_stream);
-    Py_VISIT(self->tmp_list_p);
-    Py_VISIT(self->tmp_list_v);
-    Py_VISIT(self->tmp_list_t);
     return 0;
 }
 
@@ -986,9 +1427,6 @@ NoteinRec_clear(NoteinRec *self)
     Py_CLEAR(self->inputp_stream);
     Py_CLEAR(self->inputv);
     Py_CLEAR(self->inputv_stream);
-    Py_CLEAR(self->tmp_list_p);
-    Py_CLEAR(self->tmp_list_v);
-    Py_CLEAR(self->tmp_list_t);
     return 0;
 }
 
@@ -996,6 +1434,9 @@ static void
 NoteinRec_dealloc(NoteinRec* self)
 {
     pyo_DEALLOC
+    RecChunks_free(&self->rec);
+    if (self->filename != NULL)
+        free(self->filename);
     NoteinRec_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -1004,22 +1445,21 @@ static PyObject *
 NoteinRec_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     int i;
+    char *filename = NULL;
     PyObject *inputptmp, *inputp_streamtmp, *inputvtmp, *inputv_streamtmp;
     NoteinRec *self;
     self = (NoteinRec *)type->tp_alloc(type, 0);
 
-    self->tmp_list_p = PyList_New(0);
-    self->tmp_list_v = PyList_New(0);
-    self->tmp_list_t = PyList_New(0);
     self->last_pitch = self->last_vel = 0.0;
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, NoteinRec_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, NoteinRec_memory);
     self->mode_func_ptr = NoteinRec_setProcMode;
 
-    static char *kwlist[] = {"inputp", "inputv", NULL};
+    static char *kwlist[] = {"inputp", "inputv", "filename", NULL};
 
-    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OO", kwlist, &inputptmp, &inputvtmp))
+    if (! PyArg_ParseTupleAndKeywords(args, kwds, "OO|s", kwlist, &inputptmp, &inputvtmp, &filename))
         Py_RETURN_NONE;
 
     Py_XDECREF(self->inputp);
@@ -1038,6 +1478,11 @@ NoteinRec_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     PyObject_CallMethod(self->server, "addStream", "O", self->stream);
 
+    if (filename != NULL)
+        self->filename = strdup(filename);
+
+    RecChunks_init(&self->rec, 3, 0);
+
     (*self->mode_func_ptr)(self);
 
     return (PyObject *)self;
@@ -1047,30 +1492,56 @@ static PyObject * NoteinRec_getServer(NoteinRec* self) { GET_SERVER };
 static PyObject * NoteinRec_getStream(NoteinRec* self) { GET_STREAM };
 
 static PyObject * NoteinRec_play(NoteinRec *self, PyObject *args, PyObject *kwds) {
+    int wait = REC_OFFLINE_SERVER(self->server);
     self->time = 0;
+    RecChunks_stop(&self->rec);
+    if (self->filename == NULL || RecChunks_startFlush(&self->rec, self->filename, 0, self->sr, wait) < 0)
+        RecChunks_startMemory(&self->rec, 1, wait);
     PLAY
 };
 
-static PyObject * NoteinRec_stop(NoteinRec *self) { STOP };
+static PyObject * NoteinRec_stop(NoteinRec *self) {
+    RecChunks_stop(&self->rec);
+    STOP
+};
 
 static PyObject *
 NoteinRec_getData(NoteinRec *self) {
-    int i;
+    int k;
+    long i, size;
     PyObject *data, *point;
 
-    Py_ssize_t size = PyList_Size(self->tmp_list_p);
+    size = RecChunks_getSize(&self->rec);
     data = PyList_New(size);
 
     for (i=0; i<size; i++) {
         point = PyTuple_New(3);
-        PyTuple_SET_ITEM(point, 0, PyList_GET_ITEM(self->tmp_list_t, i));
-        PyTuple_SET_ITEM(point, 1, PyList_GET_ITEM(self->tmp_list_p, i));
-        PyTuple_SET_ITEM(point, 2, PyList_GET_ITEM(self->tmp_list_v, i));
-        PyList_SetItem(data, i, point);
+        for (k=0; k<3; k++)
+            PyTuple_SET_ITEM(point, k, PyFloat_FromDouble(RecChunks_get(&self->rec, i, k)));
+        PyList_SET_ITEM(data, i, point);
     }
 	return data;
 }
 
+static PyObject *
+NoteinRec_getSize(NoteinRec *self) {
+    return PyInt_FromLong(self->rec.frames);
+}
+
+static PyObject *
+NoteinRec_writeFile(NoteinRec *self, PyObject *arg) {
+    if (! PyString_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "writeFile: argument must be a string.");
+        return NULL;
+    }
+    if (RecChunks_writeFile(&self->rec, PyString_AsString(arg), 0, self->sr) < 0) {
+        PyErr_Format(PyExc_IOError, "writeFile: can't open \"%s\" for writing.", PyString_AsString(arg));
+        return NULL;
+    }
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
 static PyMemberDef NoteinRec_members[] = {
     {"server", T_OBJECT_EX, offsetof(NoteinRec, server), 0, "Pyo server."},
     {"stream", T_OBJECT_EX, offsetof(NoteinRec, stream), 0, "Stream object."},
@@ -1085,6 +1556,8 @@ static PyMethodDef NoteinRec_methods[] = {
     {"play", (PyCFunction)NoteinRec_play, METH_VARARGS|METH_KEYWORDS, "Starts computing without sending sound to soundcard."},
     {"stop", (PyCFunction)NoteinRec_stop, METH_NOARGS, "Stops computing."},
     {"getData", (PyCFunction)NoteinRec_getData, METH_NOARGS, "Returns list of sampled points."},
+    {"getSize", (PyCFunction)NoteinRec_getSize, METH_NOARGS, "Returns the number of recorded events."},
+    {"writeFile", (PyCFunction)NoteinRec_writeFile, METH_O, "Writes recorded events in a binary file."},
     {NULL}  /* Sentinel */
 };
 
@@ -1263,6 +1736,44 @@ NoteinRead_dealloc(NoteinRead* self)
     self->ob_type->tp_free((PyObject*)self);
 }
 
+static int
+NoteinRead_loadColumn(NoteinRead *self, PyObject *source, int column)
+{
+    long i, size;
+    MYFLT *times = NULL;
+    RecChunks *rec;
+
+    if (column < 1 || column > 2) {
+        PyErr_SetString(PyExc_ValueError, "NoteinRead: column must be 1 (pitch) or 2 (velocity).");
+        return -1;
+    }
+
+    if (PyString_Check(source)) {
+        size = RecChunks_readColumn(PyString_AsString(source), column, &self->values, NULL);
+        if (size < 0 || RecChunks_readColumn(PyString_AsString(source), 0, &times, NULL) != size) {
+            free(times);
+            PyErr_Format(PyExc_IOError, "NoteinRead: \"%s\" is not a valid notes file.", PyString_AsString(source));
+            return -1;
+        }
+        self->timestamps = (long *)realloc(self->timestamps, (size + 1) * sizeof(long));
+        for (i=0; i<size; i++)
+            self->timestamps[i] = (long)(times[i] * self->sr);
+        free(times);
+    }
+    else {
+        rec = &((NoteinRec *)source)->rec;
+        size = RecChunks_getSize(rec);
+        self->values = (MYFLT *)realloc(self->values, (size + 1) * sizeof(MYFLT));
+        self->timestamps = (long *)realloc(self->timestamps, (size + 1) * sizeof(long));
+        for (i=0; i<size; i++) {
+            self->values[i] = (MYFLT)RecChunks_get(rec, i, column);
+            self->timestamps[i] = (long)(RecChunks_get(rec, i, 0) * self->sr);
+        }
+    }
+    self->size = size;
+    return 0;
+}
+
 static PyObject *
 NoteinRead_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
@@ -1286,12 +1797,21 @@ NoteinRead_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     if (! PyArg_ParseTupleAndKeywords(args, kwds, "OO|iOO", kwlist, &valuestmp, &timestampstmp, &self->loop, &multmp, &addtmp))
         Py_RETURN_NONE;
 
-    if (valuestmp) {
-        PyObject_CallMethod((PyObject *)self, "setValues", "O", valuestmp);
+    /* From a binary file or a NoteinRec object, `timestamps` gives the column to read. */
+    if (PyString_Check(valuestmp) || PyObject_TypeCheck(valuestmp, &NoteinRecType)) {
+        if (NoteinRead_loadColumn(self, valuestmp, PyInt_AsLong(timestampstmp)) < 0) {
+            Py_DECREF(self);
+            return NULL;
+        }
     }
+    else {
+        if (valuestmp) {
+            PyObject_CallMethod((PyObject *)self, "setValues", "O", valuestmp);
+        }
 
-    if (timestampstmp) {
-        PyObject_CallMethod((PyObject *)self, "setTimestamps", "O", timestampstmp);
+        if (timestampstmp) {
+            PyObject_CallMethod((PyObject *)self, "setTimestamps", "O", timestampstmp);
+        }
     }
 
      if (multmp) {
@@ -782,7 +782,9 @@ VarPort_generates_i(VarPort *self) {
                 tuple = PyTuple_New(0);
             }
 
+            Server_traceCallable((Server *)self->server, 'B', self->callable);
             result = PyObject_Call(self->callable, tuple, NULL);
+            Server_traceCallable((Server *)self->server, 'E', self->callable);
             if (result == NULL) {
                 PyErr_Print();
                 return;
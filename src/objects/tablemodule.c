@@ -38,6 +38,8 @@
 static void
 TableStream_dealloc(TableStream* self)
 {
+    if (self->expanded != NULL)
+        free(self->expanded);
     self->ob_type->tp_free((PyObject*)self);
 }
 
@@ -49,18 +51,237 @@ TableStream_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     return (PyObject *)self;
 }
 
+/* Packed samples conversion. Audio is stored in the range -1 .. 1, int16 and
+** int24 are linear pcm and float16 is an IEEE 754 half precision float. */
+static inline MYFLT
+table_int16_to_myflt(short x)
+{
+    return (MYFLT)x * (1.0 / 32768.0);
+}
+
+static inline short
+table_myflt_to_int16(MYFLT x)
+{
+    x = MYFLOOR(x * 32768.0 + 0.5);
+    if (x > 32767.0)
+        x = 32767.0;
+    else if (x < -32768.0)
+        x = -32768.0;
+    return (short)x;
+}
+
+static inline MYFLT
+table_int24_to_myflt(const unsigned char *p)
+{
+    int x = (int)p[0] | ((int)p[1] << 8) | ((int)(signed char)p[2] << 16);
+    return (MYFLT)x * (1.0 / 8388608.0);
+}
+
+static inline void
+table_myflt_to_int24(MYFLT x, unsigned char *p)
+{
+    int v;
+    x = MYFLOOR(x * 8388608.0 + 0.5);
+    if (x > 8388607.0)
+        x = 8388607.0;
+    else if (x < -8388608.0)
+        x = -8388608.0;
+    v = (int)x;
+    p[0] = v & 0xff;
+    p[1] = (v >> 8) & 0xff;
+    p[2] = (v >> 16) & 0xff;
+}
+
+static inline MYFLT
+table_half_to_myflt(unsigned short h)
+{
+    union { unsigned int u; float f; } o, magic;
+    unsigned int exp;
+    magic.u = 113 << 23;
+    o.u = (h & 0x7fff) << 13;
+    exp = o.u & (0x7c00 << 13);
+    o.u += (127 - 15) << 23;
+    if (exp == (0x7c00 << 13)) /* inf and nan */
+        o.u += (128 - 16) << 23;
+    else if (exp == 0) { /* zero and denormals */
+        o.u += 1 << 23;
+        o.f -= magic.f;
+    }
+    o.u |= (unsigned int)(h & 0x8000) << 16;
+    return (MYFLT)o.f;
+}
+
+static inline unsigned short
+table_myflt_to_half(MYFLT x)
+{
+    union { unsigned int u; float f; } f, f32infty, f16max, denorm_magic;
+    unsigned int sign, mant_odd;
+    unsigned short o;
+    f32infty.u = 255 << 23;
+    f16max.u = (127 + 16) << 23;
+    denorm_magic.u = ((127 - 15) + (23 - 10) + 1) << 23;
+    f.f = (float)x;
+    sign = f.u & 0x80000000u;
+    f.u ^= sign;
+    if (f.u >= f16max.u) /* overflow, inf and nan */
+        o = (f.u > f32infty.u) ? 0x7e00 : 0x7c00;
+    else if (f.u < (113 << 23)) { /* denormals and zero */
+        f.f += denorm_magic.f;
+        o = (unsigned short)(f.u - denorm_magic.u);
+    }
+    else { /* normals, rounded to nearest even */
+        mant_odd = (f.u >> 13) & 1;
+        f.u += ((unsigned int)(15 - 127) << 23) + 0xfff;
+        f.u += mant_odd;
+        o = (unsigned short)(f.u >> 13);
+    }
+    return o | (unsigned short)(sign >> 16);
+}
+
+/* Bytes per sample of each packed storage format. */
+static int
+TableStream_packedSampleSize(int packing)
+{
+    switch (packing) {
+        case TABLE_PACK_INT16: return 2;
+        case TABLE_PACK_INT24: return 3;
+        case TABLE_PACK_HALF: return 2;
+        default: return sizeof(MYFLT);
+    }
+}
+
+/* Encodes `count` samples in a newly allocated packed buffer. */
+static void *
+TableStream_pack(MYFLT *data, int count, int packing)
+{
+    int i;
+    void *packed = malloc(count * TableStream_packedSampleSize(packing));
+
+    if (packed == NULL)
+        return NULL;
+    switch (packing) {
+        case TABLE_PACK_INT16: {
+            short *p = (short *)packed;
+            for (i=0; i<count; i++)
+                p[i] = table_myflt_to_int16(data[i]);
+            break;
+        }
+        case TABLE_PACK_INT24: {
+            unsigned char *p = (unsigned char *)packed;
+            for (i=0; i<count; i++)
+                table_myflt_to_int24(data[i], p + i * 3);
+            break;
+        }
+        case TABLE_PACK_HALF: {
+            unsigned short *p = (unsigned short *)packed;
+            for (i=0; i<count; i++)
+                p[i] = table_myflt_to_half(data[i]);
+            break;
+        }
+        default:
+            memcpy(packed, data, count * sizeof(MYFLT));
+            break;
+    }
+    return packed;
+}
+
+/* Decodes a contiguous range of samples. Each format has its own
+** branch-free loop so that the compiler can vectorize the conversion. */
+void
+TableStream_decode(TableStream *self, int start, int count, MYFLT *out)
+{
+    int i;
+
+    switch (self->packing) {
+        case TABLE_PACK_INT16: {
+            const short *p = (const short *)self->packed + start;
+            for (i=0; i<count; i++)
+                out[i] = table_int16_to_myflt(p[i]);
+            break;
+        }
+        case TABLE_PACK_INT24: {
+            const unsigned char *p = (const unsigned char *)self->packed + start * 3;
+            for (i=0; i<count; i++)
+                out[i] = table_int24_to_myflt(p + i * 3);
+            break;
+        }
+        case TABLE_PACK_HALF: {
+            const unsigned short *p = (const unsigned short *)self->packed + start;
+            for (i=0; i<count; i++)
+                out[i] = table_half_to_myflt(p[i]);
+            break;
+        }
+        default:
+            memcpy(out, self->data + start, count * sizeof(MYFLT));
+            break;
+    }
+}
+
+/* Returns 1 if the samples are only available in packed form. Once a reader
+** without packed support has asked for the stream, the decoded copy is used. */
+int
+TableStream_isPacked(TableStream *self)
+{
+    return self->packing != TABLE_PACK_NONE && self->expanded == NULL;
+}
+
+/* Never allocates, this is called from the audio thread. The decoded copy of
+** a packed table is made by TableStream_expand, from the python side. */
 MYFLT *
 TableStream_getData(TableStream *self)
 {
     return (MYFLT *)self->data;
 }
 
+/* Decodes the packed samples for the readers without packed support and
+** keeps the copy up to date when the table is packed again. Must be called
+** from the python side. Returns -1 if the copy can't be allocated. */
+int
+TableStream_expand(TableStream *self)
+{
+    self->expand = 1;
+    if (self->packing != TABLE_PACK_NONE && self->expanded == NULL) {
+        self->expanded = (MYFLT *)malloc((self->size + 1) * sizeof(MYFLT));
+        if (self->expanded == NULL)
+            return -1;
+        TableStream_decode(self, 0, self->size + 1, self->expanded);
+        self->data = self->expanded;
+    }
+    return 0;
+}
+
+static void
+TableStream_freeExpanded(TableStream *self)
+{
+    if (self->expanded != NULL) {
+        free(self->expanded);
+        self->expanded = NULL;
+    }
+}
+
 void
 TableStream_setData(TableStream *self, MYFLT *data)
 {
+    TableStream_freeExpanded(self);
+    self->packing = TABLE_PACK_NONE;
+    self->packed = NULL;
     self->data = data;
 }
 
+/* Sets packed samples (size + 1, including the guard point) as table data.
+** Returns -1 if a decoded copy is needed but can't be allocated. */
+int
+TableStream_setPackedData(TableStream *self, void *packed, int packing)
+{
+    TableStream_freeExpanded(self);
+    self->packing = packing;
+    self->packed = packed;
+    self->data = NULL;
+    if (self->expand)
+        return TableStream_expand(self);
+    return 0;
+}
+
 int
 TableStream_getSize(TableStream *self)
 {
@@ -85,6 +306,124 @@ TableStream_setSamplingRate(TableStream *self, double sr)
     self->samplingRate = sr;
 }
 
+/* Deferred table reads */
+int
+TableReadQueue_reserve(TableReadQueue *q, int size)
+{
+    int *index, *slot;
+    MYFLT *frac, *amp, *frame;
+
+    q->count = 0;
+    if (size <= q->maxsize)
+        return 0;
+    index = (int *)malloc(size * sizeof(int));
+    slot = (int *)malloc(size * sizeof(int));
+    frac = (MYFLT *)malloc(size * sizeof(MYFLT));
+    amp = (MYFLT *)malloc(size * sizeof(MYFLT));
+    frame = (MYFLT *)malloc(size * 4 * sizeof(MYFLT));
+    if (index == NULL || slot == NULL || frac == NULL || amp == NULL || frame == NULL) {
+        free(index); free(slot); free(frac); free(amp); free(frame);
+        return -1;
+    }
+    TableReadQueue_free(q);
+    q->index = index;
+    q->slot = slot;
+    q->frac = frac;
+    q->amp = amp;
+    q->frame = frame;
+    q->maxsize = size;
+    return 0;
+}
+
+void
+TableReadQueue_free(TableReadQueue *q)
+{
+    free(q->index);
+    free(q->frac);
+    free(q->amp);
+    free(q->slot);
+    free(q->frame);
+    q->index = q->slot = NULL;
+    q->frac = q->amp = q->frame = NULL;
+    q->count = q->maxsize = 0;
+}
+
+/* Gathers the 4 points around each read. Points outside of the table are
+** extrapolated the same way the cubic interpolation does. */
+#define TABLE_GATHER(FETCH) \
+for (k=0; k<q->count; k++) { \
+    idx = q->index[k]; \
+    f = q->frame + k * 4; \
+    if (idx < 0 || idx >= size) { \
+        f[0] = f[1] = f[2] = f[3] = 0.0; \
+        continue; \
+    } \
+    x1 = FETCH(idx); \
+    x2 = FETCH(idx + 1); \
+    f[0] = idx > 0 ? FETCH(idx - 1) : x1 + (x1 - x2); \
+    f[1] = x1; \
+    f[2] = x2; \
+    f[3] = idx < (size - 2) ? FETCH(idx + 2) : x2 + (x2 - x1); \
+}
+
+#define TABLE_FETCH_INT16(x) table_int16_to_myflt(p16[(x)])
+#define TABLE_FETCH_INT24(x) table_int24_to_myflt(p24 + (x) * 3)
+#define TABLE_FETCH_HALF(x) table_half_to_myflt(ph[(x)])
+#define TABLE_FETCH_MYFLT(x) self->data[(x)]
+
+/* Decodes and interpolates all pending reads of the queue, accumulating
+** the results (scaled by their amplitude) into `out`. */
+void
+TableReadQueue_flush(TableReadQueue *q, TableStream *self, MYFLT (*interp)(MYFLT *, int, MYFLT, int), MYFLT *out)
+{
+    int k, idx;
+    MYFLT x1, x2, *f;
+    int size = self->size;
+    const short *p16 = (const short *)self->packed;
+    const unsigned char *p24 = (const unsigned char *)self->packed;
+    const unsigned short *ph = (const unsigned short *)self->packed;
+
+    if (self->expanded != NULL || self->packing == TABLE_PACK_NONE) {
+        TABLE_GATHER(TABLE_FETCH_MYFLT)
+    }
+    else if (self->packing == TABLE_PACK_INT16) {
+        TABLE_GATHER(TABLE_FETCH_INT16)
+    }
+    else if (self->packing == TABLE_PACK_INT24) {
+        TABLE_GATHER(TABLE_FETCH_INT24)
+    }
+    else {
+        TABLE_GATHER(TABLE_FETCH_HALF)
+    }
+
+    /* Every read now has its points at index 1 of a 4 samples frame. */
+    for (k=0; k<q->count; k++) {
+        out[q->slot[k]] += (*interp)(q->frame + k * 4, 1, q->frac[k], 4) * q->amp[k];
+    }
+    q->count = 0;
+}
+
+/* Bytes held by the samples, packed and decoded copies included. */
+long
+TableStream_getMemory(TableStream *self)
+{
+    long bytes = (self->size + 1) * TableStream_packedSampleSize(self->packing);
+    if (self->expanded != NULL)
+        bytes += (self->size + 1) * sizeof(MYFLT);
+    return bytes;
+}
+
+static PyObject *
+TableStream_memory(TableStream *self)
+{
+    return PyInt_FromLong(sizeof(TableStream) + TableStream_getMemory(self));
+}
+
+static PyMethodDef TableStream_methods[] = {
+{"getMemory", (PyCFunction)TableStream_memory, METH_NOARGS, "Returns the native memory, in bytes, used by the samples."},
+{NULL}  /* Sentinel */
+};
+
 PyTypeObject TableStreamType = {
 PyObject_HEAD_INIT(NULL)
 0, /*ob_size*/
@@ -114,7 +453,7 @@ Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
 0, /* tp_weaklistoffset */
 0, /* tp_iter */
 0, /* tp_iternext */
-0, /* tp_methods */
+TableStream_methods, /* tp_methods */
 0, /* tp_members */
 0, /* tp_getset */
 0, /* tp_base */
@@ -3646,8 +3985,48 @@ typedef struct {
     MYFLT stop;
     MYFLT crossfade;
     MYFLT insertPos;
+    int packing;
+    void *packed;
 } SndTable;
 
+/* Replaces the samples by their packed version, if a packed storage is used. */
+static void
+SndTable_pack(SndTable *self) {
+    void *packed;
+
+    if (self->packing == TABLE_PACK_NONE || self->data == NULL)
+        return;
+
+    packed = TableStream_pack(self->data, self->size + 1, self->packing);
+    if (packed == NULL)
+        return;
+    if (TableStream_setPackedData(self->tablestream, packed, self->packing) < 0) {
+        /* No room for the decoded copy needed by some readers, keep the samples as they are. */
+        printf("SndTable: not enough memory to pack the samples, they are kept unpacked.\n");
+        TableStream_setData(self->tablestream, self->data);
+        free(packed);
+        return;
+    }
+    free(self->data);
+    self->data = NULL;
+    if (self->packed != NULL)
+        free(self->packed);
+    self->packed = packed;
+}
+
+/* Decodes packed samples back to MYFLT. */
+static void
+SndTable_unpack(SndTable *self) {
+    if (self->packed == NULL)
+        return;
+
+    self->data = (MYFLT *)malloc((self->size + 1) * sizeof(MYFLT));
+    TableStream_decode(self->tablestream, 0, self->size + 1, self->data);
+    TableStream_setData(self->tablestream, self->data);
+    free(self->packed);
+    self->packed = NULL;
+}
+
 static void
 SndTable_loadSound(SndTable *self) {
     SNDFILE *sf;
@@ -4041,6 +4420,7 @@ static void
 SndTable_dealloc(SndTable* self)
 {
     free(self->data);
+    free(self->packed);
     SndTable_clear(self);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -4060,6 +4440,8 @@ SndTable_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->stop = -1.0;
     self->crossfade = 0.0;
     self->insertPos = 0.0;
+    self->packing = TABLE_PACK_NONE;
+    self->packed = NULL;
 
     MAKE_NEW_TABLESTREAM(self->tablestream, &TableStreamType, NULL);
 
@@ -4090,30 +4472,40 @@ SndTable_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 }
 
 static PyObject * SndTable_getServer(SndTable* self) { GET_SERVER };
-static PyObject * SndTable_getTableStream(SndTable* self) { GET_TABLE_STREAM };
-static PyObject * SndTable_setData(SndTable *self, PyObject *arg) { SET_TABLE_DATA };
-static PyObject * SndTable_normalize(SndTable *self) { NORMALIZE };
-static PyObject * SndTable_reset(SndTable *self) { TABLE_RESET };
-static PyObject * SndTable_removeDC(SndTable *self) { REMOVE_DC };
-static PyObject * SndTable_reverse(SndTable *self) { REVERSE };
-static PyObject * SndTable_invert(SndTable *self) { INVERT };
-static PyObject * SndTable_rectify(SndTable *self) { RECTIFY };
-static PyObject * SndTable_bipolarGain(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_BIPOLAR_GAIN };
-static PyObject * SndTable_lowpass(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_LOWPASS };
-static PyObject * SndTable_fadein(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_FADEIN };
-static PyObject * SndTable_fadeout(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_FADEOUT };
-static PyObject * SndTable_pow(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_POWER };
-static PyObject * SndTable_copy(SndTable *self, PyObject *arg) { COPY };
-static PyObject * SndTable_setTable(SndTable *self, PyObject *arg) { SET_TABLE };
-static PyObject * SndTable_getTable(SndTable *self) { GET_TABLE };
-static PyObject * SndTable_put(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_PUT };
-static PyObject * SndTable_get(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_GET };
-static PyObject * SndTable_add(SndTable *self, PyObject *arg) { TABLE_ADD };
-static PyObject * SndTable_sub(SndTable *self, PyObject *arg) { TABLE_SUB };
-static PyObject * SndTable_mul(SndTable *self, PyObject *arg) { TABLE_MUL };
+static PyObject * SndTable_getPackedTableStream(SndTable* self) { GET_TABLE_STREAM };
+
+/* Readers asking for the stream with this method don't know about packed
+** samples, so the decoded copy is made here rather than in the audio thread. */
+static PyObject *
+SndTable_getTableStream(SndTable* self)
+{
+    if (TableStream_expand(self->tablestream) < 0)
+        return PyErr_NoMemory();
+    GET_TABLE_STREAM
+}
+static PyObject * SndTable_setData_unpacked(SndTable *self, PyObject *arg) { SET_TABLE_DATA };
+static PyObject * SndTable_normalize_unpacked(SndTable *self) { NORMALIZE };
+static PyObject * SndTable_reset_unpacked(SndTable *self) { TABLE_RESET };
+static PyObject * SndTable_removeDC_unpacked(SndTable *self) { REMOVE_DC };
+static PyObject * SndTable_reverse_unpacked(SndTable *self) { REVERSE };
+static PyObject * SndTable_invert_unpacked(SndTable *self) { INVERT };
+static PyObject * SndTable_rectify_unpacked(SndTable *self) { RECTIFY };
+static PyObject * SndTable_bipolarGain_unpacked(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_BIPOLAR_GAIN };
+static PyObject * SndTable_lowpass_unpacked(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_LOWPASS };
+static PyObject * SndTable_fadein_unpacked(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_FADEIN };
+static PyObject * SndTable_fadeout_unpacked(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_FADEOUT };
+static PyObject * SndTable_pow_unpacked(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_POWER };
+static PyObject * SndTable_copy_unpacked(SndTable *self, PyObject *arg) { COPY };
+static PyObject * SndTable_setTable_unpacked(SndTable *self, PyObject *arg) { SET_TABLE };
+static PyObject * SndTable_getTable_unpacked(SndTable *self) { GET_TABLE };
+static PyObject * SndTable_put_unpacked(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_PUT };
+static PyObject * SndTable_get_unpacked(SndTable *self, PyObject *args, PyObject *kwds) { TABLE_GET };
+static PyObject * SndTable_add_unpacked(SndTable *self, PyObject *arg) { TABLE_ADD };
+static PyObject * SndTable_sub_unpacked(SndTable *self, PyObject *arg) { TABLE_SUB };
+static PyObject * SndTable_mul_unpacked(SndTable *self, PyObject *arg) { TABLE_MUL };
 
 static PyObject *
-SndTable_getViewTable(SndTable *self, PyObject *args, PyObject *kwds) {
+SndTable_getViewTable_unpacked(SndTable *self, PyObject *args, PyObject *kwds) {
     int i, j, y, w, h, h2, step, size;
     int count = 0;
     int yOffset = 0;
@@ -4215,7 +4607,7 @@ SndTable_getViewTable(SndTable *self, PyObject *args, PyObject *kwds) {
 };
 
 static PyObject *
-SndTable_getEnvelope(SndTable *self, PyObject *arg) {
+SndTable_getEnvelope_unpacked(SndTable *self, PyObject *arg) {
     int i, j, step, points;
     long count;
     MYFLT absin, last;
@@ -4252,7 +4644,7 @@ SndTable_getEnvelope(SndTable *self, PyObject *arg) {
 };
 
 static PyObject *
-SndTable_setSound(SndTable *self, PyObject *args, PyObject *kwds)
+SndTable_setSound_unpacked(SndTable *self, PyObject *args, PyObject *kwds)
 {
     static char *kwlist[] = {"path", "chnl", "start", "stop", NULL};
 
@@ -4271,7 +4663,7 @@ SndTable_setSound(SndTable *self, PyObject *args, PyObject *kwds)
 }
 
 static PyObject *
-SndTable_append(SndTable *self, PyObject *args, PyObject *kwds)
+SndTable_append_unpacked(SndTable *self, PyObject *args, PyObject *kwds)
 {
     static char *kwlist[] = {"path", "crossfade", "chnl", "start", "stop", NULL};
 
@@ -4296,7 +4688,7 @@ SndTable_append(SndTable *self, PyObject *args, PyObject *kwds)
 }
 
 static PyObject *
-SndTable_insert(SndTable *self, PyObject *args, PyObject *kwds)
+SndTable_insert_unpacked(SndTable *self, PyObject *args, PyObject *kwds)
 {
     static char *kwlist[] = {"path", "pos", "crossfade", "chnl", "start", "stop", NULL};
 
@@ -4329,7 +4721,7 @@ SndTable_insert(SndTable *self, PyObject *args, PyObject *kwds)
 }
 
 static PyObject *
-SndTable_setSize(SndTable *self, PyObject *value)
+SndTable_setSize_unpacked(SndTable *self, PyObject *value)
 {
     Py_ssize_t i;
 
@@ -4363,6 +4755,70 @@ SndTable_getRate(SndTable *self)
     return PyFloat_FromDouble(sr * (self->sndSr/sr) / self->size);
 };
 
+static PyObject *
+SndTable_setPacking(SndTable *self, PyObject *arg)
+{
+    int packing;
+
+    if (! PyInt_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "SndTable packing must be an integer.");
+        return NULL;
+    }
+    packing = PyInt_AsLong(arg);
+    if (packing < TABLE_PACK_NONE || packing > TABLE_PACK_HALF) {
+        PyErr_SetString(PyExc_ValueError, "SndTable packing must be between 0 and 3.");
+        return NULL;
+    }
+
+    SndTable_unpack(self);
+    self->packing = packing;
+    SndTable_pack(self);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *
+SndTable_getPacking(SndTable *self)
+{
+    return PyInt_FromLong(self->packing);
+};
+
+/* Methods working on the samples decode a packed table first and pack it again after. */
+#define SNDTABLE_UNPACKED(call) \
+    PyObject *ret; \
+    SndTable_unpack(self); \
+    ret = call; \
+    SndTable_pack(self); \
+    return ret;
+
+static PyObject * SndTable_setData(SndTable *self, PyObject *arg) { SNDTABLE_UNPACKED(SndTable_setData_unpacked(self, arg)) };
+static PyObject * SndTable_normalize(SndTable *self) { SNDTABLE_UNPACKED(SndTable_normalize_unpacked(self)) };
+static PyObject * SndTable_reset(SndTable *self) { SNDTABLE_UNPACKED(SndTable_reset_unpacked(self)) };
+static PyObject * SndTable_removeDC(SndTable *self) { SNDTABLE_UNPACKED(SndTable_removeDC_unpacked(self)) };
+static PyObject * SndTable_reverse(SndTable *self) { SNDTABLE_UNPACKED(SndTable_reverse_unpacked(self)) };
+static PyObject * SndTable_invert(SndTable *self) { SNDTABLE_UNPACKED(SndTable_invert_unpacked(self)) };
+static PyObject * SndTable_rectify(SndTable *self) { SNDTABLE_UNPACKED(SndTable_rectify_unpacked(self)) };
+static PyObject * SndTable_bipolarGain(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_bipolarGain_unpacked(self, args, kwds)) };
+static PyObject * SndTable_lowpass(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_lowpass_unpacked(self, args, kwds)) };
+static PyObject * SndTable_fadein(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_fadein_unpacked(self, args, kwds)) };
+static PyObject * SndTable_fadeout(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_fadeout_unpacked(self, args, kwds)) };
+static PyObject * SndTable_pow(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_pow_unpacked(self, args, kwds)) };
+static PyObject * SndTable_copy(SndTable *self, PyObject *arg) { SNDTABLE_UNPACKED(SndTable_copy_unpacked(self, arg)) };
+static PyObject * SndTable_setTable(SndTable *self, PyObject *arg) { SNDTABLE_UNPACKED(SndTable_setTable_unpacked(self, arg)) };
+static PyObject * SndTable_getTable(SndTable *self) { SNDTABLE_UNPACKED(SndTable_getTable_unpacked(self)) };
+static PyObject * SndTable_put(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_put_unpacked(self, args, kwds)) };
+static PyObject * SndTable_get(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_get_unpacked(self, args, kwds)) };
+static PyObject * SndTable_add(SndTable *self, PyObject *arg) { SNDTABLE_UNPACKED(SndTable_add_unpacked(self, arg)) };
+static PyObject * SndTable_sub(SndTable *self, PyObject *arg) { SNDTABLE_UNPACKED(SndTable_sub_unpacked(self, arg)) };
+static PyObject * SndTable_mul(SndTable *self, PyObject *arg) { SNDTABLE_UNPACKED(SndTable_mul_unpacked(self, arg)) };
+static PyObject * SndTable_getViewTable(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_getViewTable_unpacked(self, args, kwds)) };
+static PyObject * SndTable_getEnvelope(SndTable *self, PyObject *arg) { SNDTABLE_UNPACKED(SndTable_getEnvelope_unpacked(self, arg)) };
+static PyObject * SndTable_setSound(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_setSound_unpacked(self, args, kwds)) };
+static PyObject * SndTable_append(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_append_unpacked(self, args, kwds)) };
+static PyObject * SndTable_insert(SndTable *self, PyObject *args, PyObject *kwds) { SNDTABLE_UNPACKED(SndTable_insert_unpacked(self, args, kwds)) };
+static PyObject * SndTable_setSize(SndTable *self, PyObject *value) { SNDTABLE_UNPACKED(SndTable_setSize_unpacked(self, value)) };
+
 static PyMemberDef SndTable_members[] = {
 {"server", T_OBJECT_EX, offsetof(SndTable, server), 0, "Pyo server."},
 {"tablestream", T_OBJECT_EX, offsetof(SndTable, tablestream), 0, "Table stream object."},
@@ -4371,11 +4827,14 @@ static PyMemberDef SndTable_members[] = {
 
 static PyMethodDef SndTable_methods[] = {
 {"getServer", (PyCFunction)SndTable_getServer, METH_NOARGS, "Returns server object."},
+{"setPacking", (PyCFunction)SndTable_setPacking, METH_O, "Sets the storage format of the samples (0 = float, 1 = int16, 2 = int24, 3 = float16)."},
+{"getPacking", (PyCFunction)SndTable_getPacking, METH_NOARGS, "Returns the storage format of the samples."},
 {"copy", (PyCFunction)SndTable_copy, METH_O, "Copy data from table given in argument."},
 {"setTable", (PyCFunction)SndTable_setTable, METH_O, "Sets the table content from a list of floats (must be the same size as the object size)."},
 {"getTable", (PyCFunction)SndTable_getTable, METH_NOARGS, "Returns a list of table samples."},
 {"getViewTable", (PyCFunction)SndTable_getViewTable, METH_VARARGS|METH_KEYWORDS, "Returns a list of pixel coordinates for drawing the table."},
 {"getTableStream", (PyCFunction)SndTable_getTableStream, METH_NOARGS, "Returns table stream object created by this table."},
+{"getPackedTableStream", (PyCFunction)SndTable_getPackedTableStream, METH_NOARGS, "Returns table stream object, without making a decoded copy of packed samples."},
 {"getEnvelope", (PyCFunction)SndTable_getEnvelope, METH_O, "Returns X points envelope follower of the table."},
 {"setData", (PyCFunction)SndTable_setData, METH_O, "Sets the table from samples in a text file."},
 {"normalize", (PyCFunction)SndTable_normalize, METH_NOARGS, "Normalize table samples between -1 and 1"},
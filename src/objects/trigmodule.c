@@ -1274,7 +1274,9 @@ TrigFunc_generate(TrigFunc *self) {
     for (i=0; i<self->bufsize; i++) {
         if (in[i] == 1) {
             if (self->arg == Py_None) {
+                Server_traceCallable((Server *)self->server, 'B', self->func);
                 result = PyObject_Call(self->func, PyTuple_New(0), NULL);
+                Server_traceCallable((Server *)self->server, 'E', self->func);
                 if (result == NULL) {
                     PyErr_Print();
                     return;
@@ -1283,7 +1285,9 @@ TrigFunc_generate(TrigFunc *self) {
             else {
                 tuple = PyTuple_New(1);
                 PyTuple_SET_ITEM(tuple, 0, self->arg);
+                Server_traceCallable((Server *)self->server, 'B', self->func);
                 result = PyObject_Call(self->func, tuple, NULL);
+                Server_traceCallable((Server *)self->server, 'E', self->func);
                 if (result == NULL) {
                     PyErr_Print();
                     return;
@@ -433,6 +433,11 @@ WGVerb_compute_next_data_frame(WGVerb *self)
     (*self->muladd_func_ptr)(self);
 }
 
+static long
+WGVerb_memory(WGVerb *self) {
+    return (self->size[0] + self->size[1] + self->size[2] + self->size[3] + self->size[4] + self->size[5] + self->size[6] + self->size[7] + 8) * sizeof(MYFLT);
+}
+
 static int
 WGVerb_traverse(WGVerb *self, visitproc visit, void *arg)
 {
@@ -497,6 +502,7 @@ WGVerb_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     INIT_OBJECT_COMMON
     Stream_setFunctionPtr(self->stream, WGVerb_compute_next_data_frame);
+    Stream_setMemoryFunctionPtr(self->stream, WGVerb_memory);
     self->mode_func_ptr = WGVerb_setProcMode;
 
     for (i=0; i<8; i++) {
@@ -0,0 +1,352 @@
+/**************************************************************************
+ * Copyright 2009-2015 Olivier Belanger                                   *
+ *                                                                        *
+ * This file is part of pyo, a python module to help digital signal       *
+ * processing script creation.                                            *
+ *                                                                        *
+ * pyo is free software: you can redistribute it and/or modify            *
+ * it under the terms of the GNU Lesser General Public License as         *
+ * published by the Free Software Foundation, either version 3 of the     *
+ * License, or (at your option) any later version.                        *
+ *                                                                        *
+ * pyo is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU Lesser General Public License for more details.                    *
+ *                                                                        *
+ * You should have received a copy of the GNU Lesser General Public       *
+ * License along with pyo.  If not, see <http://www.gnu.org/licenses/>.   *
+ *************************************************************************/
+
+/* Real-time violations detector, a debugging tool for Linux (glibc).
+**
+** Build it with scripts/compile_rtcheck_linux.sh and preload it:
+**
+**     LD_PRELOAD=/path/to/libpyortcheck.so python script.py
+**
+** then call Server.setRTCheck(True). The server tells the library which
+** stream is computing, and every allocation or potentially blocking call
+** made by the audio thread meanwhile is counted for that stream.
+**
+** Only calls crossing a shared library boundary are seen: calls made
+** inside the C library itself (ex. the write() done by printf) are counted
+** at the public entry point, and stack allocations (variable length arrays,
+** alloca) are invisible. */
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include "pyortcheck.h"
+
+#define RT_EXPORT __attribute__((visibility("default")))
+
+/* initial-exec: reading the context must never allocate a TLS block. */
+static __thread const char *rt_name __attribute__((tls_model("initial-exec"))) = NULL;
+static __thread int rt_id __attribute__((tls_model("initial-exec"))) = 0;
+
+/* Open addressing table, written only by the audio thread(s). */
+static PyoRTCheckEntry rt_entries[PYO_RT_MAX_ENTRIES];
+static volatile int rt_lock = 0;
+
+static void
+rt_spin_lock()
+{
+    while (__sync_lock_test_and_set(&rt_lock, 1))
+        ;
+}
+
+static void
+rt_spin_unlock()
+{
+    __sync_lock_release(&rt_lock);
+}
+
+static void
+rt_hit(int kind)
+{
+    int i, slot;
+    const char *name = rt_name;
+    int id = rt_id;
+
+    if (name == NULL)
+        return;
+
+    slot = (unsigned int)(id * 2654435761u ^ ((size_t)name >> 4)) & (PYO_RT_MAX_ENTRIES - 1);
+    for (i=0; i<PYO_RT_MAX_ENTRIES; i++) {
+        PyoRTCheckEntry *e = &rt_entries[slot];
+        if (e->name == name && e->id == id) {
+            __sync_fetch_and_add(&e->counts[kind], 1);
+            return;
+        }
+        if (e->name == NULL) {
+            rt_spin_lock();
+            if (e->name == NULL) {
+                e->id = id;
+                __sync_synchronize();
+                e->name = name;
+            }
+            rt_spin_unlock();
+            if (e->name == name && e->id == id) {
+                __sync_fetch_and_add(&e->counts[kind], 1);
+                return;
+            }
+        }
+        slot = (slot + 1) & (PYO_RT_MAX_ENTRIES - 1);
+    }
+    /* Table full, the hit is dropped. */
+}
+
+/* Exported interface */
+RT_EXPORT void
+pyo_rtcheck_set_context(const char *name, int id)
+{
+    rt_id = id;
+    rt_name = name;
+}
+
+RT_EXPORT int
+pyo_rtcheck_get_report(PyoRTCheckEntry *entries, int max)
+{
+    int i, count = 0;
+
+    for (i=0; i<PYO_RT_MAX_ENTRIES && count<max; i++) {
+        if (rt_entries[i].name != NULL)
+            entries[count++] = rt_entries[i];
+    }
+    return count;
+}
+
+RT_EXPORT void
+pyo_rtcheck_reset()
+{
+    rt_spin_lock();
+    memset(rt_entries, 0, sizeof(rt_entries));
+    rt_spin_unlock();
+}
+
+/* Allocator, forwarded to the glibc implementation (dlsym itself allocates). */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void __libc_free(void *ptr);
+
+RT_EXPORT void *
+malloc(size_t size)
+{
+    rt_hit(PYO_RT_MALLOC);
+    return __libc_malloc(size);
+}
+
+RT_EXPORT void *
+calloc(size_t nmemb, size_t size)
+{
+    rt_hit(PYO_RT_MALLOC);
+    return __libc_calloc(nmemb, size);
+}
+
+RT_EXPORT void *
+realloc(void *ptr, size_t size)
+{
+    rt_hit(PYO_RT_MALLOC);
+    return __libc_realloc(ptr, size);
+}
+
+RT_EXPORT void *
+memalign(size_t alignment, size_t size)
+{
+    rt_hit(PYO_RT_MALLOC);
+    return __libc_memalign(alignment, size);
+}
+
+RT_EXPORT void *
+aligned_alloc(size_t alignment, size_t size)
+{
+    rt_hit(PYO_RT_MALLOC);
+    return __libc_memalign(alignment, size);
+}
+
+RT_EXPORT int
+posix_memalign(void **memptr, size_t alignment, size_t size)
+{
+    void *ptr;
+
+    if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0)
+        return EINVAL;
+    rt_hit(PYO_RT_MALLOC);
+    ptr = __libc_memalign(alignment, size);
+    if (ptr == NULL)
+        return ENOMEM;
+    *memptr = ptr;
+    return 0;
+}
+
+RT_EXPORT void
+free(void *ptr)
+{
+    if (ptr != NULL)
+        rt_hit(PYO_RT_FREE);
+    __libc_free(ptr);
+}
+
+/* Everything else is forwarded to the next definition. The pointers are
+** resolved by the constructor, or on first use if called before it. */
+#define RT_REAL(name) \
+    if (real_##name == NULL) \
+        *(void **)(&real_##name) = dlsym(RTLD_NEXT, #name)
+
+#define RT_WRAP(kind, ret, name, params, args) \
+static ret (*real_##name) params = NULL; \
+RT_EXPORT ret \
+name params \
+{ \
+    rt_hit(kind); \
+    RT_REAL(name); \
+    return real_##name args; \
+}
+
+RT_WRAP(PYO_RT_FILE, ssize_t, read, (int fd, void *buf, size_t count), (fd, buf, count))
+RT_WRAP(PYO_RT_FILE, ssize_t, write, (int fd, const void *buf, size_t count), (fd, buf, count))
+RT_WRAP(PYO_RT_FILE, int, close, (int fd), (fd))
+RT_WRAP(PYO_RT_FILE, FILE *, fopen, (const char *path, const char *mode), (path, mode))
+RT_WRAP(PYO_RT_FILE, FILE *, fopen64, (const char *path, const char *mode), (path, mode))
+RT_WRAP(PYO_RT_FILE, int, fclose, (FILE *stream), (stream))
+RT_WRAP(PYO_RT_FILE, size_t, fread, (void *ptr, size_t size, size_t nmemb, FILE *stream), (ptr, size, nmemb, stream))
+RT_WRAP(PYO_RT_FILE, size_t, fwrite, (const void *ptr, size_t size, size_t nmemb, FILE *stream), (ptr, size, nmemb, stream))
+RT_WRAP(PYO_RT_FILE, int, fputs, (const char *s, FILE *stream), (s, stream))
+RT_WRAP(PYO_RT_FILE, int, fflush, (FILE *stream), (stream))
+RT_WRAP(PYO_RT_PRINT, int, puts, (const char *s), (s))
+RT_WRAP(PYO_RT_PRINT, int, vprintf, (const char *format, va_list ap), (format, ap))
+RT_WRAP(PYO_RT_PRINT, int, vfprintf, (FILE *stream, const char *format, va_list ap), (stream, format, ap))
+RT_WRAP(PYO_RT_SOCKET, ssize_t, send, (int fd, const void *buf, size_t len, int flags), (fd, buf, len, flags))
+RT_WRAP(PYO_RT_SOCKET, ssize_t, sendto, (int fd, const void *buf, size_t len, int flags, const struct sockaddr *addr, socklen_t addrlen), (fd, buf, len, flags, addr, addrlen))
+RT_WRAP(PYO_RT_SOCKET, ssize_t, sendmsg, (int fd, const struct msghdr *msg, int flags), (fd, msg, flags))
+RT_WRAP(PYO_RT_SOCKET, ssize_t, recv, (int fd, void *buf, size_t len, int flags), (fd, buf, len, flags))
+RT_WRAP(PYO_RT_SOCKET, ssize_t, recvfrom, (int fd, void *buf, size_t len, int flags, struct sockaddr *addr, socklen_t *addrlen), (fd, buf, len, flags, addr, addrlen))
+RT_WRAP(PYO_RT_SOCKET, int, socket, (int domain, int type, int protocol), (domain, type, protocol))
+RT_WRAP(PYO_RT_SOCKET, int, connect, (int fd, const struct sockaddr *addr, socklen_t addrlen), (fd, addr, addrlen))
+RT_WRAP(PYO_RT_LOCK, int, pthread_mutex_lock, (pthread_mutex_t *mutex), (mutex))
+RT_WRAP(PYO_RT_LOCK, int, sem_wait, (sem_t *sem), (sem))
+RT_WRAP(PYO_RT_LOCK, int, sem_timedwait, (sem_t *sem, const struct timespec *abstime), (sem, abstime))
+RT_WRAP(PYO_RT_SLEEP, int, nanosleep, (const struct timespec *req, struct timespec *rem), (req, rem))
+RT_WRAP(PYO_RT_SLEEP, int, clock_nanosleep, (clockid_t clk, int flags, const struct timespec *req, struct timespec *rem), (clk, flags, req, rem))
+RT_WRAP(PYO_RT_SLEEP, int, usleep, (useconds_t usec), (usec))
+RT_WRAP(PYO_RT_SLEEP, unsigned int, sleep, (unsigned int seconds), (seconds))
+RT_WRAP(PYO_RT_SLEEP, int, poll, (struct pollfd *fds, nfds_t nfds, int timeout), (fds, nfds, timeout))
+RT_WRAP(PYO_RT_SLEEP, int, select, (int nfds, fd_set *rfds, fd_set *wfds, fd_set *efds, struct timeval *timeout), (nfds, rfds, wfds, efds, timeout))
+
+/* Variadic functions, forwarded to their va_list version. */
+static int (*real_open)(const char *, int, ...) = NULL;
+static int (*real_open64)(const char *, int, ...) = NULL;
+
+RT_EXPORT int
+open(const char *path, int flags, ...)
+{
+    va_list ap;
+    mode_t mode;
+
+    va_start(ap, flags);
+    mode = va_arg(ap, mode_t);
+    va_end(ap);
+    rt_hit(PYO_RT_FILE);
+    RT_REAL(open);
+    return real_open(path, flags, mode);
+}
+
+RT_EXPORT int
+open64(const char *path, int flags, ...)
+{
+    va_list ap;
+    mode_t mode;
+
+    va_start(ap, flags);
+    mode = va_arg(ap, mode_t);
+    va_end(ap);
+    rt_hit(PYO_RT_FILE);
+    RT_REAL(open64);
+    return real_open64(path, flags, mode);
+}
+
+RT_EXPORT int
+printf(const char *format, ...)
+{
+    int ret;
+    va_list ap;
+
+    rt_hit(PYO_RT_PRINT);
+    RT_REAL(vprintf);
+    va_start(ap, format);
+    ret = real_vprintf(format, ap);
+    va_end(ap);
+    return ret;
+}
+
+RT_EXPORT int
+fprintf(FILE *stream, const char *format, ...)
+{
+    int ret;
+    va_list ap;
+
+    rt_hit(PYO_RT_PRINT);
+    RT_REAL(vfprintf);
+    va_start(ap, format);
+    ret = real_vfprintf(stream, format, ap);
+    va_end(ap);
+    return ret;
+}
+
+/* Fortified versions, used when compiled with _FORTIFY_SOURCE. */
+RT_EXPORT int
+__printf_chk(int flag, const char *format, ...)
+{
+    int ret;
+    va_list ap;
+
+    rt_hit(PYO_RT_PRINT);
+    RT_REAL(vprintf);
+    va_start(ap, format);
+    ret = real_vprintf(format, ap);
+    va_end(ap);
+    return ret;
+}
+
+RT_EXPORT int
+__fprintf_chk(FILE *stream, int flag, const char *format, ...)
+{
+    int ret;
+    va_list ap;
+
+    rt_hit(PYO_RT_PRINT);
+    RT_REAL(vfprintf);
+    va_start(ap, format);
+    ret = real_vfprintf(stream, format, ap);
+    va_end(ap);
+    return ret;
+}
+
+/* Resolve everything before the audio thread runs, so that it never goes
+** through dlsym. */
+__attribute__((constructor)) static void
+rt_init()
+{
+    RT_REAL(read); RT_REAL(write); RT_REAL(close); RT_REAL(open); RT_REAL(open64);
+    RT_REAL(fopen); RT_REAL(fopen64); RT_REAL(fclose); RT_REAL(fread); RT_REAL(fwrite);
+    RT_REAL(fputs); RT_REAL(fflush); RT_REAL(puts); RT_REAL(vprintf); RT_REAL(vfprintf);
+    RT_REAL(send); RT_REAL(sendto); RT_REAL(sendmsg); RT_REAL(recv); RT_REAL(recvfrom);
+    RT_REAL(socket); RT_REAL(connect); RT_REAL(pthread_mutex_lock); RT_REAL(sem_wait);
+    RT_REAL(sem_timedwait); RT_REAL(nanosleep); RT_REAL(clock_nanosleep); RT_REAL(usleep);
+    RT_REAL(sleep); RT_REAL(poll); RT_REAL(select);
+}